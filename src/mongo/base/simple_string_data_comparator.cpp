@@ -31,34 +31,11 @@
 
 #include "mongo/base/simple_string_data_comparator.h"
 
-#include <third_party/murmurhash3/MurmurHash3.h>
-
-#include "mongo/base/data_type_endian.h"
-#include "mongo/base/data_view.h"
+#include <absl/hash/hash.h>
+#include <boost/functional/hash.hpp>
 
 namespace mongo {
 
-namespace {
-
-template <int SizeofSizeT>
-size_t murmur3(StringData str, size_t seed);
-
-template <>
-size_t murmur3<4>(StringData str, size_t seed) {
-    char hash[4];
-    MurmurHash3_x86_32(str.rawData(), str.size(), seed, &hash);
-    return ConstDataView(hash).read<LittleEndian<std::uint32_t>>();
-}
-
-template <>
-size_t murmur3<8>(StringData str, size_t seed) {
-    char hash[16];
-    MurmurHash3_x64_128(str.rawData(), str.size(), seed, hash);
-    return static_cast<size_t>(ConstDataView(hash).read<LittleEndian<std::uint64_t>>());
-}
-
-}  // namespace
-
 const SimpleStringDataComparator SimpleStringDataComparator::kInstance{};
 
 int SimpleStringDataComparator::compare(StringData left, StringData right) const {
@@ -66,7 +43,14 @@ int SimpleStringDataComparator::compare(StringData left, StringData right) const
 }
 
 void SimpleStringDataComparator::hash_combine(size_t& seed, StringData stringToHash) const {
-    seed = murmur3<sizeof(size_t)>(stringToHash, seed);
+    // absl::Hash selects a word-at-a-time kernel (wyhash-derived on 64-bit platforms), which is
+    // considerably faster than byte-oriented alternatives for the string lengths typical of user
+    // data. These hashes only ever feed process-local hash tables, so the exact kernel may change
+    // between versions; anything that needs a stable on-disk or cross-node hash (e.g. hashed
+    // indexes via BSONElementHasher) must not route through here.
+    boost::hash_combine(seed,
+                        absl::Hash<absl::string_view>{}(
+                            absl::string_view{stringToHash.rawData(), stringToHash.size()}));
 }
 
 }  // namespace mongo
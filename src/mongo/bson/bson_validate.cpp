@@ -31,11 +31,16 @@
 #include <cstring>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/data_view.h"
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/bson_validate.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/bits.h"
 
 namespace mongo {
 namespace {
@@ -150,6 +155,18 @@ private:
             // This is actually by far the hottest code in all of BSON validation.
             dassert(ptr < end);
             size_t len = 0;
+#if defined(__SSE2__)
+            // Scan for the terminating NUL with 16-byte wide loads. Documents consisting of
+            // scalar fields are dominated by field name scanning, so this is a significant win
+            // over the byte-at-a-time loop below. Only full in-bounds vectors are loaded: the
+            // scalar tail loop below remains safe because a validated buffer ends in EOO (NUL).
+            while (ptr + len + 16 <= end) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + len));
+                if (int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_setzero_si128())))
+                    return len + countTrailingZeros64(static_cast<unsigned>(mask));
+                len += 16;
+            }
+#endif
             while (ptr[len])
                 ++len;
             return len;
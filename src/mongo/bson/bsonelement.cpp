@@ -282,12 +282,66 @@ int compareElementStringValues(const BSONElement& leftStr, const BSONElement& ri
     return lsz - rsz;
 }
 
+int compareIntElements(const BSONElement& l, const BSONElement& r) {
+    return compareInts(l._numberInt(), r._numberInt());
+}
+
+int compareLongElements(const BSONElement& l, const BSONElement& r) {
+    return compareLongs(l._numberLong(), r._numberLong());
+}
+
+int compareDoubleElements(const BSONElement& l, const BSONElement& r) {
+    return compareDoubles(l._numberDouble(), r._numberDouble());
+}
+
+int compareStringElements(const BSONElement& l, const BSONElement& r) {
+    return compareElementStringValues(l, r);
+}
+
+int compareDateElements(const BSONElement& l, const BSONElement& r) {
+    const Date_t a = l.date();
+    const Date_t b = r.date();
+    if (a < b)
+        return -1;
+    return a == b ? 0 : 1;
+}
+
 }  // namespace
 
+BSONElement::ComparisonKernel BSONElement::getComparisonKernel(BSONType lhsType,
+                                                               BSONType rhsType) {
+    if (lhsType != rhsType)
+        return nullptr;
+
+    switch (lhsType) {
+        case BSONType::NumberInt:
+            return &compareIntElements;
+        case BSONType::NumberLong:
+            return &compareLongElements;
+        case BSONType::NumberDouble:
+            return &compareDoubleElements;
+        case BSONType::String:
+            return &compareStringElements;
+        case BSONType::Date:
+            return &compareDateElements;
+        default:
+            return nullptr;
+    }
+}
+
 int BSONElement::compareElements(const BSONElement& l,
                                  const BSONElement& r,
                                  ComparisonRulesSet rules,
                                  const StringData::ComparatorInterface* comparator) {
+    // Fast path for the dominant case of comparing two elements of the same specialized type,
+    // skipping the type-bridging dispatch below. The kernels compare strings bytewise, so this
+    // path cannot be taken when a string comparator is in effect.
+    if (!comparator) {
+        if (auto kernel = getComparisonKernel(l.type(), r.type())) {
+            return kernel(l, r);
+        }
+    }
+
     switch (l.type()) {
         case BSONType::EOO:
         case BSONType::Undefined:  // EOO and Undefined are same canonicalType
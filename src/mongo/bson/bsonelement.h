@@ -105,6 +105,22 @@ public:
                                ComparisonRulesSet rules,
                                const StringData::ComparatorInterface* comparator);
 
+    /**
+     * Signature of a comparison function specialized for a fixed pair of element types.
+     */
+    using ComparisonKernel = int (*)(const BSONElement& l, const BSONElement& r);
+
+    /**
+     * Returns a comparison kernel specialized for comparing an element of type 'lhsType' to an
+     * element of type 'rhsType', or nullptr when no specialized kernel exists for the pair.
+     * Kernels exist for the homogeneous types that dominate sorting and key ordering: NumberInt,
+     * NumberLong, NumberDouble, String and Date. A kernel behaves like compareElements() with no
+     * comparison rules and bytewise string comparison, so callers that compare many elements
+     * whose types are observed once up front can cache the kernel and skip the per-comparison
+     * type dispatch. Invoking a kernel on elements of other types is undefined.
+     */
+    static ComparisonKernel getComparisonKernel(BSONType lhsType, BSONType rhsType);
+
 
     /**
      * These functions, which start with a capital letter, throw if the
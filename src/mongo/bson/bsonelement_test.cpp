@@ -131,6 +131,32 @@ TEST(BSONElement, BinDataVectorWithBinDataGeneral) {
 }
 
 
+TEST(BSONElement, ComparisonKernelsMatchGenericComparison) {
+    BSONObj lhsObj = BSON("int" << 1 << "long" << 5LL << "double" << 1.5 << "string"
+                                << "abc"
+                                << "date" << Date_t::fromMillisSinceEpoch(100));
+    BSONObj rhsObj = BSON("int" << 2 << "long" << 3LL << "double" << 2.5 << "string"
+                                << "abd"
+                                << "date" << Date_t::fromMillisSinceEpoch(50));
+
+    for (auto&& fieldName : {"int", "long", "double", "string", "date"}) {
+        auto lhs = lhsObj[fieldName];
+        auto rhs = rhsObj[fieldName];
+
+        auto kernel = BSONElement::getComparisonKernel(lhs.type(), rhs.type());
+        ASSERT(kernel) << fieldName;
+        ASSERT_EQ(kernel(lhs, rhs), lhs.woCompare(rhs, 0 /* rules */)) << fieldName;
+        ASSERT_EQ(kernel(rhs, lhs), rhs.woCompare(lhs, 0 /* rules */)) << fieldName;
+        ASSERT_EQ(kernel(lhs, lhs), 0) << fieldName;
+    }
+
+    // No kernel exists for mixed-type pairs or types without a specialized comparison.
+    ASSERT_FALSE(BSONElement::getComparisonKernel(BSONType::NumberInt, BSONType::NumberLong));
+    ASSERT_FALSE(BSONElement::getComparisonKernel(BSONType::NumberDouble, BSONType::NumberInt));
+    ASSERT_FALSE(BSONElement::getComparisonKernel(BSONType::Object, BSONType::Object));
+    ASSERT_FALSE(BSONElement::getComparisonKernel(BSONType::NumberDecimal, BSONType::NumberDecimal));
+}
+
 TEST(BSONElement, TimestampToString) {
 
     // Testing default BSONObj Timestamp method, which constructs an empty Timestamp
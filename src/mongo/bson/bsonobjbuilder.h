@@ -116,6 +116,21 @@ public:
         _b.reserveBytes(1);
     }
 
+    // Tag for constructing a builder whose buffer builder does not allocate its own memory but
+    // carves it out of an externally owned allocator, e.g. PooledFragmentBuilder over a
+    // SharedBufferFragmentBuilder.
+    struct ConstructBufTag {};
+
+    template <typename... BufArgs>
+    BSONObjBuilderBase(ConstructBufTag, BufArgs&&... args)
+        : _b(_buf), _buf(std::forward<BufArgs>(args)...) {
+        // See the comments in the first constructor for details.
+        _b.skip(sizeof(int));
+
+        // Reserve space for the EOO byte. This means _done() can't fail.
+        _b.reserveBytes(1);
+    }
+
     // Move constructible, but not assignable due to reference member.
     BSONObjBuilderBase(BSONObjBuilderBase<Derived, B>&& other)
         : _b(&other._b == &other._buf ? _buf : other._b),
@@ -896,6 +911,79 @@ private:
     }
 };
 
+// The following forward declaration exists to enable the extern
+// declaration, which must come before the use of the matching
+// instantiation of the base class of PooledBSONObjBuilder. Do not
+// remove or re-order these lines w.r.t BSONObjBuilderBase or
+// PooledBSONObjBuilder without being sure that you are not undoing
+// the advantages of the extern template declaration.
+class PooledBSONObjBuilder;
+extern template class BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
+
+// PooledBSONObjBuilder needs this forward declared in order to
+// declare the ArrayBuilder typedef. This forward declaration is also
+// required to allow one of the extern template declarations for
+// BSONArrayBuilderBase below.
+class PooledBSONArrayBuilder;
+
+/**
+ * Alternative to BSONObjBuilder which carves its buffer out of an externally owned
+ * SharedBufferFragmentBuilder instead of allocating one per builder. All builders over one
+ * fragment builder reuse the same underlying memory block, which avoids the per-document
+ * malloc/free traffic of short-lived builders on high-rate insert and command paths. KeyString's
+ * PooledBuilder uses the same memory pooling scheme.
+ *
+ * The built object is not refcounted: done() returns a BSONObj view that is only valid while the
+ * fragment builder's memory is alive, and doneFragment() returns the underlying fragment for
+ * callers that need to extend the lifetime beyond the pool's reset.
+ */
+class PooledBSONObjBuilder
+    : public BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder> {
+private:
+    using Super = BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
+    friend Super;
+
+public:
+    using ArrayBuilder = PooledBSONArrayBuilder;
+
+    explicit PooledBSONObjBuilder(SharedBufferFragmentBuilder& memPool)
+        : Super(Super::ConstructBufTag{}, memPool) {}
+
+    /**
+     * Constructs a sub-object builder appending through 'baseBuilder'. See subobjStart().
+     */
+    PooledBSONObjBuilder(PooledFragmentBuilder& baseBuilder) : Super(baseBuilder) {}
+
+    PooledBSONObjBuilder(PooledBSONObjBuilder&&) = default;
+    PooledBSONObjBuilder(const PooledBSONObjBuilder&) = delete;
+    PooledBSONObjBuilder& operator=(const PooledBSONObjBuilder&) = delete;
+
+    ~PooledBSONObjBuilder() {
+        Super::_destruct();
+    }
+
+    /**
+     * destructive
+     * Finishes building and detaches the fragment from the pool. The returned fragment shares
+     * ownership of the pool's underlying buffer, so the BSON data stays valid after the pool
+     * moves on to its next fragment.
+     */
+    SharedBufferFragment doneFragment() {
+        done();
+        return _b.done();
+    }
+
+private:
+    // Compile-time "virtual" which must be provided to satisfy the base class.
+    void doDone() {
+        // Intentionally left empty.
+    }
+
+    void doResetToEmpty() {
+        // Intentionally left empty.
+    }
+};
+
 /**
  * Base class for building BSON arrays. Similar to BSONObjBuilderBase.
  */
@@ -1103,6 +1191,22 @@ public:
         : BSONArrayBuilderBase<UniqueBSONArrayBuilder, UniqueBSONObjBuilder>(bufBuilder) {}
 };
 
+/**
+ * Alternative to BSONArrayBuilder. This class is analogous to PooledBSONObjBuilder.
+ *
+ * There is deliberately no extern template declaration (nor explicit instantiation) of the base
+ * class here: PooledBSONObjBuilder has no size-hint constructors, so not all base class members
+ * are well-formed for it and they must only be instantiated as used.
+ */
+class PooledBSONArrayBuilder
+    : public BSONArrayBuilderBase<PooledBSONArrayBuilder, PooledBSONObjBuilder> {
+public:
+    using ObjBuilder = PooledBSONObjBuilder;
+
+    PooledBSONArrayBuilder(PooledFragmentBuilder& bufBuilder)
+        : BSONArrayBuilderBase<PooledBSONArrayBuilder, PooledBSONObjBuilder>(bufBuilder) {}
+};
+
 template <class Derived, class B>
 template <class T>
 inline Derived& BSONObjBuilderBase<Derived, B>::append(StringData fieldName,
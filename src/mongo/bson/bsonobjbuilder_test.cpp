@@ -604,5 +604,42 @@ TEST(BSONObjBuilderTest, UniqueArrayBuilderReleaseToBuffer) {
         auto tmp = UniqueBuffer::reclaim(rawData);
     }
 }
+
+TEST(BSONObjBuilderTest, PooledBuilderReusesOneMemPool) {
+    SharedBufferFragmentBuilder memPool(1024);
+
+    PooledBSONObjBuilder bob(memPool);
+    bob.append("a", 1);
+    bob.append("b", "hello");
+    SharedBufferFragment fragment = bob.doneFragment();
+    ASSERT_BSONOBJ_EQ(BSONObj(fragment.get()), BSON("a" << 1 << "b"
+                                                        << "hello"));
+
+    // The next builder carves its fragment out of the same underlying buffer.
+    PooledBSONObjBuilder bob2(memPool);
+    bob2.append("c", 2);
+    SharedBufferFragment fragment2 = bob2.doneFragment();
+    ASSERT_BSONOBJ_EQ(BSONObj(fragment2.get()), BSON("c" << 2));
+    ASSERT_EQ(fragment.get() + fragment.size(), fragment2.get());
+}
+
+TEST(BSONObjBuilderTest, PooledBuilderNesting) {
+    SharedBufferFragmentBuilder memPool(1024);
+
+    PooledBSONObjBuilder bob(memPool);
+    bob.append("x", 1);
+    {
+        PooledBSONObjBuilder sub(bob.subobjStart("sub"));
+        sub.append("y", 2);
+    }
+    {
+        PooledBSONArrayBuilder arr(bob.subarrayStart("arr"));
+        arr.append(1);
+        arr.append(2);
+    }
+    SharedBufferFragment fragment = bob.doneFragment();
+    ASSERT_BSONOBJ_EQ(BSONObj(fragment.get()),
+                      BSON("x" << 1 << "sub" << BSON("y" << 2) << "arr" << BSON_ARRAY(1 << 2)));
+}
 }  // namespace
 }  // namespace mongo
@@ -850,6 +850,86 @@ BSONColumn::Iterator BSONColumn::end() {
     return it;
 }
 
+const BSONElement* BSONColumn::_tryRandomAccess(size_t index, bool* outOfBounds) {
+    const char* end = _binary + _size;
+
+    // Scan control bytes forward from the largest known decoding start position. Simple-8b
+    // control blocks are skipped over using the element counts in their block headers, only
+    // literals and interleaved starts need to be inspected.
+    const char* control = _maxDecodingStartPos._control;
+    size_t curIndex = _maxDecodingStartPos._index;
+
+    // Last uncompressed literal found on or before 'index', decompression below restarts from
+    // this position as literals reset all decoding state.
+    const char* literalControl = nullptr;
+    size_t literalIndex = 0;
+
+    while (curIndex <= index) {
+        uassert(6929908, "Invalid BSON Column encoding", control < end);
+
+        if (*control == EOO) {
+            *outOfBounds = true;
+            return nullptr;
+        }
+
+        if (Iterator::_isInterleavedStart(*control)) {
+            // We cannot skip over interleaved mode as element counts in the different streams
+            // cannot be cheaply determined, fall back to sequential decompression.
+            *outOfBounds = false;
+            return nullptr;
+        }
+
+        if (Iterator::_isLiteral(*control)) {
+            literalControl = control;
+            literalIndex = curIndex;
+            ++curIndex;
+            control += BSONElement(control, 1, -1).size();
+            continue;
+        }
+
+        // Simple-8b delta blocks, sum up the element counts from the block headers without
+        // decoding any values. The counts are independent of the value type stored.
+        int size = sizeof(uint64_t) * Iterator::_numSimple8bBlocks(*control);
+        uassert(6929909, "Invalid BSON Column encoding", control + size + 1 < end);
+        Simple8b<uint128_t> reader(control + 1, size);
+        for (auto it = reader.begin(), itEnd = reader.end(); it != itEnd; it.advanceBlock()) {
+            curIndex += it.blockSize();
+        }
+        control += size + 1;
+    }
+
+    if (!literalControl) {
+        // No literal on or before 'index' to restart decompression from.
+        *outOfBounds = false;
+        return nullptr;
+    }
+
+    // Materialize the run from the literal up to 'index', this is the only range before 'index'
+    // where the actual values need to be decoded.
+    Iterator::DecodingState state;
+    auto result = state._loadControl(*this, literalControl, end, nullptr);
+    BSONElement elem = result.element;
+    const char* pos = literalControl + result.size;
+    for (size_t i = literalIndex; i < index; ++i) {
+        if (state._decoder64 && ++state._decoder64->pos != state._decoder64->end) {
+            elem = state._loadDelta(*this, *state._decoder64->pos, nullptr);
+        } else if (state._decoder128 && ++state._decoder128->pos != state._decoder128->end) {
+            elem = state._loadDelta(*this, *state._decoder128->pos, nullptr);
+        } else {
+            // The element count scan above guarantees that 'index' is reached before EOO or
+            // interleaved mode.
+            uassert(6929910,
+                    "Invalid BSON Column encoding",
+                    pos < end && *pos != EOO && !Iterator::_isInterleavedStart(*pos));
+            result = state._loadControl(*this, pos, end, nullptr);
+            elem = result.element;
+            pos += result.size;
+        }
+    }
+
+    return &_randomAccessed.emplace(index, elem).first->second;
+}
+
 boost::optional<const BSONElement&> BSONColumn::operator[](size_t index) {
     // If index is already decompressed, we can just return the element
     if (index < _decompressed.size()) {
@@ -860,7 +940,21 @@ boost::optional<const BSONElement&> BSONColumn::operator[](size_t index) {
     if (_fullyDecompressed)
         return boost::none;
 
-    // We can begin iterating from last known literal
+    // Return element if it was previously materialized by random access
+    if (auto it = _randomAccessed.find(index); it != _randomAccessed.end()) {
+        return it->second;
+    }
+
+    // Try to reach the element by skipping over the Simple-8b blocks before it instead of
+    // decompressing them
+    bool outOfBounds = false;
+    if (const BSONElement* elem = _tryRandomAccess(index, &outOfBounds)) {
+        return *elem;
+    }
+    if (outOfBounds)
+        return boost::none;
+
+    // Interleaved mode needs sequential decompression, begin iterating from last known literal
     Iterator it{*this, _maxDecodingStartPos._control, _binary + _size};
     it._initialize(_maxDecodingStartPos._index);
 
@@ -35,6 +35,7 @@
 #include "mongo/bson/util/simple8b.h"
 
 #include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -234,7 +235,10 @@ public:
      * Returns EOO if index represent skipped element.
      * Returns boost::none if index is out of bounds.
      *
-     * O(1) time complexity if element has been previously accessed
+     * O(1) time complexity if element has been previously accessed.
+     * For binaries not using interleaved mode only the elements after the last uncompressed
+     * literal on or before 'index' are decompressed, elements before it are skipped over using
+     * the element counts in the Simple-8b block headers.
      * O(N) time complexity otherwise
      *
      * Materializes compressed BSONElement as needed. It is NOT safe to do this from multiple
@@ -395,9 +399,26 @@ private:
      */
     void _init();
 
+    /**
+     * Attempts to materialize the element at 'index' without decompressing the elements before
+     * it. Scans control bytes forward from the largest known decoding start position, skipping
+     * over Simple-8b control blocks using the element counts in their block headers, and only
+     * decompresses the run from the last uncompressed literal on or before 'index'.
+     *
+     * Returns the materialized element on success, owned by this BSONColumn. Returns nullptr if
+     * the element cannot be reached this way, 'outOfBounds' is then set to indicate if this was
+     * because 'index' is beyond the last element or because interleaved mode was encountered
+     * where the caller needs to fall back to sequential decompression.
+     */
+    const BSONElement* _tryRandomAccess(size_t index, bool* outOfBounds);
+
     struct SubObjectAllocator;
 
     std::deque<BSONElement> _decompressed;
+
+    // Elements materialized by random access ahead of the sequentially decompressed prefix.
+    // Kept separate from '_decompressed' which must remain a dense prefix for iteration.
+    std::map<size_t, BSONElement> _randomAccessed;
     ElementStorage _elementStorage;
 
     const char* _binary;
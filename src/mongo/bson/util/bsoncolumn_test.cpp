@@ -574,6 +574,91 @@ TEST_F(BSONColumnTest, ValueAfterSkip) {
     verifyDecompression(binData, {BSONElement(), elem});
 }
 
+TEST_F(BSONColumnTest, RestartIntervalWritesPeriodicLiterals) {
+    BSONColumnBuilder cb("test"_sd, false /* arrayCompression */, 4 /* restartInterval */);
+
+    std::vector<BSONElement> elems;
+    for (int i = 0; i < 9; ++i) {
+        elems.push_back(createElementInt64(i));
+        cb.append(elems.back());
+    }
+
+    // A full literal should be written for every fourth element even though all values are delta
+    // compressable.
+    BufBuilder expected;
+    appendLiteral(expected, elems[0]);
+    appendSimple8bControl(expected, 0b1000, 0b0000);
+    appendSimple8bBlocks64(expected,
+                           deltaInt64(elems.begin() + 1, elems.begin() + 4, elems[0]),
+                           1);
+    appendLiteral(expected, elems[4]);
+    appendSimple8bControl(expected, 0b1000, 0b0000);
+    appendSimple8bBlocks64(expected,
+                           deltaInt64(elems.begin() + 5, elems.begin() + 8, elems[4]),
+                           1);
+    appendLiteral(expected, elems[8]);
+    appendEOO(expected);
+
+    auto binData = cb.finalize();
+    verifyBinary(binData, expected);
+    verifyDecompression(binData, elems);
+}
+
+TEST_F(BSONColumnTest, RestartIntervalCountsSkips) {
+    BSONColumnBuilder cb("test"_sd, false /* arrayCompression */, 2 /* restartInterval */);
+
+    auto first = createElementInt32(1);
+    auto second = createElementInt32(2);
+    cb.append(first);
+    cb.skip();
+    cb.append(second);
+
+    // The skip counts towards the restart interval so the second value is written as a literal.
+    BufBuilder expected;
+    appendLiteral(expected, first);
+    appendSimple8bControl(expected, 0b1000, 0b0000);
+    appendSimple8bBlock64(expected, boost::none);
+    appendLiteral(expected, second);
+    appendEOO(expected);
+
+    auto binData = cb.finalize();
+    verifyBinary(binData, expected);
+    verifyDecompression(binData, {first, BSONElement(), second});
+}
+
+TEST_F(BSONColumnTest, RandomAccessSeeksUsingLiterals) {
+    BSONColumnBuilder cb("test"_sd, false /* arrayCompression */, 4 /* restartInterval */);
+
+    std::vector<BSONElement> elems;
+    for (int i = 0; i < 20; ++i) {
+        elems.push_back(createElementInt64(i * 2));
+        cb.append(elems.back());
+    }
+
+    auto binData = cb.finalize();
+
+    BSONObjBuilder obj;
+    obj.append(""_sd, binData);
+    BSONElement columnElement = obj.done().firstElement();
+
+    // Access elements in the middle of the column without iterating to them first, this seeks
+    // using the periodic literals.
+    BSONColumn col(columnElement);
+    ASSERT(elems[17].binaryEqualValues(*col[17]));
+    ASSERT(elems[3].binaryEqualValues(*col[3]));
+    ASSERT(elems[16].binaryEqualValues(*col[16]));
+
+    // Out of bounds access is detected without decompressing any elements.
+    ASSERT_FALSE(col[20]);
+    ASSERT_FALSE(col[1000]);
+
+    // Iteration still produces all elements after random access.
+    auto it = col.begin();
+    for (auto elem : elems) {
+        ASSERT(elem.binaryEqualValues(*(it++)));
+    }
+    ASSERT(it == col.end());
+}
 
 TEST_F(BSONColumnTest, LargeDeltaIsLiteral) {
     BSONColumnBuilder cb("test"_sd);
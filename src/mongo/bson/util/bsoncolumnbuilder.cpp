@@ -499,15 +499,19 @@ BSONObj mergeObjLegacy(const BSONObj& reference, const BSONObj& obj) {
 
 }  // namespace
 
-BSONColumnBuilder::BSONColumnBuilder(StringData fieldName, bool arrayCompression)
-    : BSONColumnBuilder(fieldName, BufBuilder(), arrayCompression) {}
+BSONColumnBuilder::BSONColumnBuilder(StringData fieldName,
+                                     bool arrayCompression,
+                                     size_t restartInterval)
+    : BSONColumnBuilder(fieldName, BufBuilder(), arrayCompression, restartInterval) {}
 
 BSONColumnBuilder::BSONColumnBuilder(StringData fieldName,
                                      BufBuilder&& builder,
-                                     bool arrayCompression)
-    : _state(&_bufBuilder, nullptr),
+                                     bool arrayCompression,
+                                     size_t restartInterval)
+    : _state(&_bufBuilder, nullptr, restartInterval),
       _bufBuilder(std::move(builder)),
       _fieldName(fieldName),
+      _restartInterval(restartInterval),
       _arrayCompression(arrayCompression) {
     _bufBuilder.reset();
 }
@@ -679,11 +683,14 @@ int BSONColumnBuilder::numInterleavedStartWritten() const {
 }
 
 BSONColumnBuilder::EncodingState::EncodingState(
-    BufBuilder* bufBuilder, std::function<void(const char*, size_t)> controlBlockWriter)
+    BufBuilder* bufBuilder,
+    std::function<void(const char*, size_t)> controlBlockWriter,
+    size_t restartInterval)
     : _simple8bBuilder64(_createBufferWriter()),
       _simple8bBuilder128(_createBufferWriter()),
       _controlByteOffset(kNoSimple8bControl),
       _scaleIndex(Simple8bTypeUtil::kMemoryAsInteger),
+      _restartInterval(restartInterval),
       _bufBuilder(bufBuilder),
       _controlBlockWriter(controlBlockWriter) {
     // Store EOO type with empty field name as previous.
@@ -703,6 +710,8 @@ BSONColumnBuilder::EncodingState::EncodingState(EncodingState&& other)
       _prevEncoded128(std::move(other._prevEncoded128)),
       _lastValueInPrevBlock(std::move(other._lastValueInPrevBlock)),
       _scaleIndex(std::move(other._scaleIndex)),
+      _restartInterval(std::move(other._restartInterval)),
+      _elemsSincePrevLiteral(std::move(other._elemsSincePrevLiteral)),
       _bufBuilder(std::move(other._bufBuilder)),
       _controlBlockWriter(std::move(other._controlBlockWriter)) {}
 
@@ -717,6 +726,8 @@ BSONColumnBuilder::EncodingState& BSONColumnBuilder::EncodingState::operator=(En
     _prevEncoded128 = std::move(rhs._prevEncoded128);
     _lastValueInPrevBlock = std::move(rhs._lastValueInPrevBlock);
     _scaleIndex = std::move(rhs._scaleIndex);
+    _restartInterval = std::move(rhs._restartInterval);
+    _elemsSincePrevLiteral = std::move(rhs._elemsSincePrevLiteral);
     _bufBuilder = std::move(rhs._bufBuilder);
     _controlBlockWriter = std::move(rhs._controlBlockWriter);
     return *this;
@@ -725,10 +736,14 @@ BSONColumnBuilder::EncodingState& BSONColumnBuilder::EncodingState::operator=(En
 void BSONColumnBuilder::EncodingState::append(BSONElement elem) {
     auto type = elem.type();
     auto previous = _previous();
+    ++_elemsSincePrevLiteral;
 
     // If we detect a type change (or this is first value). Flush all pending values in Simple-8b
-    // and write uncompressed literal. Reset all default values.
-    if (previous.type() != elem.type()) {
+    // and write uncompressed literal. Reset all default values. We also write a literal when the
+    // restart interval has passed so that a reader seeking into the column never needs to apply
+    // more than a bounded number of deltas to materialize an element.
+    if (previous.type() != elem.type() ||
+        (_restartInterval != 0 && _elemsSincePrevLiteral >= _restartInterval)) {
         _storePrevious(elem);
         _simple8bBuilder128.flush();
         _simple8bBuilder64.flush();
@@ -859,6 +874,7 @@ void BSONColumnBuilder::EncodingState::append(BSONElement elem) {
 }
 
 void BSONColumnBuilder::EncodingState::skip() {
+    ++_elemsSincePrevLiteral;
     auto before = _bufBuilder->len();
     if (_storeWith128) {
         _simple8bBuilder128.skip();
@@ -1060,6 +1076,7 @@ void BSONColumnBuilder::EncodingState::_writeLiteralFromPrevious() {
     _controlByteOffset = kNoSimple8bControl;
     _scaleIndex = Simple8bTypeUtil::kMemoryAsInteger;
     _prevDelta = 0;
+    _elemsSincePrevLiteral = 0;
 
     _initializeFromPrevious();
 }
@@ -1254,7 +1271,9 @@ void BSONColumnBuilder::_finishDetermineSubObjReference() {
         // literal to be written when we append the first element. We want this
         // to be a zero delta as the reference object already contain this
         // literal.
-        _subobjStates.emplace_back(buffer, controlBlockWriter);
+        // Periodic literals are not written in interleaved mode, a reader cannot seek over
+        // interleaved control blocks anyway so they would only cost compression.
+        _subobjStates.emplace_back(buffer, controlBlockWriter, 0 /* restartInterval */);
         _subobjStates.back()._storePrevious(ref);
         _subobjStates.back()._initializeFromPrevious();
         if (!elem.eoo()) {
@@ -46,8 +46,19 @@ namespace mongo {
  */
 class BSONColumnBuilder {
 public:
-    BSONColumnBuilder(StringData fieldName, bool arrayCompression = false);
-    BSONColumnBuilder(StringData fieldName, BufBuilder&& builder, bool arrayCompression = false);
+    /**
+     * 'restartInterval' sets the number of elements after which a full uncompressed literal is
+     * written even when delta compression would be possible. Literals reset all decompressor
+     * state and act as restart points that BSONColumn can seek to without applying every delta
+     * before them, at a small compression cost. 0 disables periodic literals.
+     */
+    BSONColumnBuilder(StringData fieldName,
+                      bool arrayCompression = false,
+                      size_t restartInterval = 0);
+    BSONColumnBuilder(StringData fieldName,
+                      BufBuilder&& builder,
+                      bool arrayCompression = false,
+                      size_t restartInterval = 0);
 
     /**
      * Appends a BSONElement to this BSONColumnBuilder.
@@ -98,7 +109,8 @@ private:
      */
     struct EncodingState {
         EncodingState(BufBuilder* bufBuilder,
-                      std::function<void(const char*, size_t)> controlBlockWriter);
+                      std::function<void(const char*, size_t)> controlBlockWriter,
+                      size_t restartInterval);
         EncodingState(EncodingState&& other);
         EncodingState& operator=(EncodingState&& rhs);
 
@@ -147,6 +159,11 @@ private:
         double _lastValueInPrevBlock = 0;
         uint8_t _scaleIndex;
 
+        // Write a full literal when this many elements have been appended since the last one,
+        // even if delta compression is possible. 0 disables periodic literals.
+        size_t _restartInterval;
+        size_t _elemsSincePrevLiteral = 0;
+
         BufBuilder* _bufBuilder;
         std::function<void(const char*, size_t)> _controlBlockWriter;
     };
@@ -194,6 +211,9 @@ private:
     std::string _fieldName;
     int _numInterleavedStartWritten = 0;
 
+    // Interval for periodic uncompressed literals, see constructor documentation.
+    size_t _restartInterval = 0;
+
     // Indicates if array compression should be used
     bool _arrayCompression = false;
 };
@@ -138,10 +138,19 @@ class SharedBufferFragmentAllocator {
 
 public:
     SharedBufferFragmentAllocator(SharedBufferFragmentBuilder& fragmentBuilder)
-        : _fragmentBuilder(fragmentBuilder) {}
+        : _fragmentBuilder(&fragmentBuilder) {}
+
+    /**
+     * Constructs a detached allocator that is not backed by any fragment builder and must never
+     * allocate. The size argument is ignored; it exists so buffer builders over this allocator
+     * can be constructed generically alongside self-allocating ones (see BSONObjBuilderBase,
+     * which constructs the unused '_buf' of sub-object builders with a size of 0).
+     */
+    explicit SharedBufferFragmentAllocator(size_t) : _fragmentBuilder(nullptr) {}
+
     ~SharedBufferFragmentAllocator() {
         // Discard if the build was not finished at the time of destruction.
-        if (_fragmentBuilder.building()) {
+        if (_fragmentBuilder && _fragmentBuilder->building()) {
             free();
         }
     }
@@ -156,29 +165,33 @@ public:
     }
 
     void realloc(size_t sz) {
-        auto capacity = _fragmentBuilder.capacity();
+        invariant(_fragmentBuilder);
+        auto capacity = _fragmentBuilder->capacity();
         if (capacity < sz)
-            _fragmentBuilder.grow(sz);
+            _fragmentBuilder->grow(sz);
     }
 
     void free() {
-        _fragmentBuilder.discard();
+        invariant(_fragmentBuilder);
+        _fragmentBuilder->discard();
     }
 
     void start(size_t sz) {
-        _fragmentBuilder.start(sz);
+        invariant(_fragmentBuilder);
+        _fragmentBuilder->start(sz);
     }
 
     SharedBufferFragment finish(size_t sz) {
-        return _fragmentBuilder.finish(sz);
+        invariant(_fragmentBuilder);
+        return _fragmentBuilder->finish(sz);
     }
 
     size_t capacity() const {
-        return _fragmentBuilder.capacity();
+        return _fragmentBuilder ? _fragmentBuilder->capacity() : 0;
     }
 
     char* get() const {
-        return _fragmentBuilder.get();
+        return _fragmentBuilder ? _fragmentBuilder->get() : nullptr;
     }
 
     // SharedBufferFragmentAllocator does not allocate any extra amount of memory for the buffer
@@ -186,7 +199,7 @@ public:
     static constexpr size_t kBuffHolderSize = 0;
 
 private:
-    SharedBufferFragmentBuilder& _fragmentBuilder;
+    SharedBufferFragmentBuilder* _fragmentBuilder;
 };
 
 class UniqueBufferAllocator {
@@ -598,6 +611,13 @@ public:
     PooledFragmentBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
         : BasicBufBuilder(fragmentBuilder.start(0)) {}
 
+    /**
+     * Constructs a detached builder that writes nowhere and must never grow. Only meaningful for
+     * builders that are never written to, such as the unused '_buf' member of a sub-object
+     * builder appending through its parent's buffer. The size argument is ignored.
+     */
+    explicit PooledFragmentBuilder(int) : BasicBufBuilder(size_t(0)) {}
+
     SharedBufferFragment done() {
         return _buf.finish(len());
     }
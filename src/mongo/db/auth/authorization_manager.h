@@ -342,6 +342,14 @@ public:
      */
     virtual Status refreshExternalUsers(OperationContext* opCtx) = 0;
 
+    /**
+     * Invalidates all users whose source is not the "$external" database and removes them from
+     * the user cache. Used together with refreshExternalUsers() to pick up authorization data
+     * changes without discarding externally-sourced users, whose role resolution may be
+     * comparatively expensive.
+     */
+    virtual void invalidateNonExternalUsers(OperationContext* opCtx) = 0;
+
     /**
      * Initializes the authorization manager.  Depending on what version the authorization
      * system is at, this may involve building up the user cache and/or the roles graph.
@@ -699,6 +699,15 @@ void AuthorizationManagerImpl::invalidateUsersByTenant(OperationContext* opCtx,
         [&](const UserRequest& userRequest) { return userRequest.name.getTenant() == tenant; });
 }
 
+void AuthorizationManagerImpl::invalidateNonExternalUsers(OperationContext* opCtx) {
+    LOGV2_DEBUG(6650039, 2, "Invalidating all users not sourced from the $external database");
+    _updateCacheGeneration();
+    _authSchemaVersionCache.invalidateAll();
+    _userCache.invalidateKeyIf([&](const UserRequest& userRequest) {
+        return userRequest.name.getDB() != "$external"_sd;
+    });
+}
+
 void AuthorizationManagerImpl::invalidateUserCache(OperationContext* opCtx) {
     LOGV2_DEBUG(20237, 2, "Invalidating user cache");
     _updateCacheGeneration();
@@ -115,6 +115,8 @@ public:
      */
     Status refreshExternalUsers(OperationContext* opCtx) override;
 
+    void invalidateNonExternalUsers(OperationContext* opCtx) override;
+
     Status initialize(OperationContext* opCtx) override;
 
     /**
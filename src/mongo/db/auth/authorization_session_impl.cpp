@@ -802,59 +802,60 @@ bool AuthorizationSessionImpl::isAuthorizedForAnyActionOnAnyResourceInDB(StringD
         return true;
     }
 
-    for (const auto& user : _authenticatedUsers) {
-        // First lookup any Privileges on this database specifying Database resources
-        if (user->hasActionsForResource(ResourcePattern::forDatabaseName(db))) {
-            return true;
-        }
+    auto hasResolvedActionsForResource = [&](const ResourcePattern& resource) {
+        auto it = _resolvedPrivileges.find(resource);
+        return it != _resolvedPrivileges.end() && !it->second.empty();
+    };
+
+    // First lookup any Privileges on this database specifying Database resources
+    if (hasResolvedActionsForResource(ResourcePattern::forDatabaseName(db))) {
+        return true;
+    }
 
-        // Any resource will match any collection in the database
-        if (user->hasActionsForResource(ResourcePattern::forAnyResource())) {
+    // Any resource will match any collection in the database
+    if (hasResolvedActionsForResource(ResourcePattern::forAnyResource())) {
+        return true;
+    }
+
+    // Any resource will match any system_buckets collection in the database
+    if (hasResolvedActionsForResource(ResourcePattern::forAnySystemBuckets()) ||
+        hasResolvedActionsForResource(ResourcePattern::forAnySystemBucketsInDatabase(db))) {
+        return true;
+    }
+
+    // If the user is authorized for anyNormalResource, then they implicitly have access
+    // to most databases.
+    if (db != "local" && db != "config" &&
+        hasResolvedActionsForResource(ResourcePattern::forAnyNormalResource())) {
+        return true;
+    }
+
+    // We've checked all the resource types that can be directly expressed. Now we must
+    // iterate all privileges, until we see something that could reside in the target database.
+    for (const auto& privilege : _resolvedPrivileges) {
+        // If the user has a Collection privilege, then they're authorized for this resource
+        // on all databases.
+        if (privilege.first.isCollectionPattern()) {
             return true;
         }
 
-        // Any resource will match any system_buckets collection in the database
-        if (user->hasActionsForResource(ResourcePattern::forAnySystemBuckets()) ||
-            user->hasActionsForResource(ResourcePattern::forAnySystemBucketsInDatabase(db))) {
+        // User can see system_buckets in any database so we consider them to have permission in
+        // this database
+        if (privilege.first.isAnySystemBucketsCollectionInAnyDB()) {
             return true;
         }
 
-        // If the user is authorized for anyNormalResource, then they implicitly have access
-        // to most databases.
-        if (db != "local" && db != "config" &&
-            user->hasActionsForResource(ResourcePattern::forAnyNormalResource())) {
+        // If the user has an exact namespace privilege on a collection in this database, they
+        // have access to a resource in this database.
+        if (privilege.first.isExactNamespacePattern() && privilege.first.databaseToMatch() == db) {
             return true;
         }
 
-        // We've checked all the resource types that can be directly expressed. Now we must
-        // iterate all privileges, until we see something that could reside in the target database.
-        User::ResourcePrivilegeMap map = user->getPrivileges();
-        for (const auto& privilege : map) {
-            // If the user has a Collection privilege, then they're authorized for this resource
-            // on all databases.
-            if (privilege.first.isCollectionPattern()) {
-                return true;
-            }
-
-            // User can see system_buckets in any database so we consider them to have permission in
-            // this database
-            if (privilege.first.isAnySystemBucketsCollectionInAnyDB()) {
-                return true;
-            }
-
-            // If the user has an exact namespace privilege on a collection in this database, they
-            // have access to a resource in this database.
-            if (privilege.first.isExactNamespacePattern() &&
-                privilege.first.databaseToMatch() == db) {
-                return true;
-            }
-
-            // If the user has an exact namespace privilege on a system.buckets collection in this
-            // database, they have access to a resource in this database.
-            if (privilege.first.isExactSystemBucketsCollection() &&
-                privilege.first.databaseToMatch() == db) {
-                return true;
-            }
+        // If the user has an exact namespace privilege on a system.buckets collection in this
+        // database, they have access to a resource in this database.
+        if (privilege.first.isExactSystemBucketsCollection() &&
+            privilege.first.databaseToMatch() == db) {
+            return true;
         }
     }
 
@@ -873,10 +874,9 @@ bool AuthorizationSessionImpl::isAuthorizedForAnyActionOnResource(const Resource
         buildResourceSearchList(resource, resourceSearchList.data());
 
     for (int i = 0; i < resourceSearchListLength; ++i) {
-        for (const auto& user : _authenticatedUsers) {
-            if (user->hasActionsForResource(resourceSearchList[i])) {
-                return true;
-            }
+        auto it = _resolvedPrivileges.find(resourceSearchList[i]);
+        if (it != _resolvedPrivileges.end() && !it->second.empty()) {
+            return true;
         }
     }
 
@@ -909,14 +909,15 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
         }
     }
 
-    for (const auto& user : _authenticatedUsers) {
-        for (int i = 0; i < resourceSearchListLength; ++i) {
-            ActionSet userActions = user->getActionsForResource(resourceSearchList[i]);
-            unmetRequirements.removeAllActionsFromSet(userActions);
+    for (int i = 0; i < resourceSearchListLength; ++i) {
+        auto it = _resolvedPrivileges.find(resourceSearchList[i]);
+        if (it == _resolvedPrivileges.end()) {
+            continue;
+        }
+        unmetRequirements.removeAllActionsFromSet(it->second);
 
-            if (unmetRequirements.empty()) {
-                return true;
-            }
+        if (unmetRequirements.empty()) {
+            return true;
         }
     }
 
@@ -1102,6 +1103,16 @@ void AuthorizationSessionImpl::verifyContract(const AuthorizationContract* contr
 }
 
 void AuthorizationSessionImpl::_updateInternalAuthorizationState() {
+    // Regenerate the merged per-resource privilege table. The table must be up to date before
+    // computing _mayBypassWriteBlockingMode below, which performs a privilege check against it.
+    _resolvedPrivileges.clear();
+    for (const auto& userHandle : _authenticatedUsers) {
+        for (const auto& privilegeEntry : userHandle->getPrivileges()) {
+            _resolvedPrivileges[privilegeEntry.first].addAllActionsFromSet(
+                privilegeEntry.second.getActions());
+        }
+    }
+
     // Update the authenticated role names vector to reflect current state.
     _authenticatedRoleNames.clear();
     for (const auto& userHandle : _authenticatedUsers) {
@@ -39,9 +39,11 @@
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/authz_session_external_state.h"
 #include "mongo/db/auth/privilege.h"
+#include "mongo/db/auth/resource_pattern.h"
 #include "mongo/db/auth/user_name.h"
 #include "mongo/db/auth/user_set.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 
@@ -163,6 +165,8 @@ protected:
     friend class AuthorizationSessionImplTestHelper;
 
     // Updates internal cached authorization state, i.e.:
+    // - _resolvedPrivileges, the merged per-resource privilege table of all authenticated users,
+    // which per-operation privilege checks probe instead of walking every user's privilege map.
     // - _mayBypassWriteBlockingMode, reflecting whether the connection is authorized for the
     // privilege of bypassing write blocking mode on cluster resource.
     // - _authenticatedRoleNames, which stores all roles held by users who are authenticated on this
@@ -183,6 +187,12 @@ protected:
     // users set is changed.
     std::vector<RoleName> _authenticatedRoleNames;
 
+    // The union of the privileges of all authenticated users, keyed by resource pattern. Like
+    // _authenticatedRoleNames, this is regenerated when the authenticated users set is changed,
+    // so the per-operation privilege check is a probe of this session-private table with no
+    // shared state involved. Only ever read and written by the session's own thread.
+    stdx::unordered_map<ResourcePattern, ActionSet> _resolvedPrivileges;
+
 private:
     // If any users authenticated on this session are marked as invalid this updates them with
     // up-to-date information. May require a read lock on the "admin" db to read the user data.
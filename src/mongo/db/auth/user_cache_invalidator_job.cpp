@@ -41,6 +41,7 @@
 #include "mongo/db/auth/user_cache_invalidator_job_parameters_gen.h"
 #include "mongo/db/client.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/random.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/grid.h"
 #include "mongo/util/duration.h"
@@ -55,7 +56,14 @@ const auto getUserCacheInvalidator =
     ServiceContext::declareDecoration<std::unique_ptr<UserCacheInvalidator>>();
 
 Seconds loadInterval() {
-    return Seconds(userCacheInvalidationIntervalSecs.load());
+    auto interval = Seconds(userCacheInvalidationIntervalSecs.load());
+    // Spread invalidation passes out by a random amount so that multiple routers sharing a
+    // deployment do not all hit the config servers and external providers on the same cadence.
+    const auto maxJitter = userCacheInvalidationIntervalJitterSecs.load();
+    if (maxJitter > 0) {
+        interval += Seconds(SecureRandom().nextInt64(maxJitter + 1));
+    }
+    return interval;
 }
 
 StatusWith<OIDorTimestamp> getCurrentCacheGeneration(OperationContext* opCtx) {
@@ -179,7 +187,21 @@ void UserCacheInvalidator::run() {
               "previousGeneration"_attr = oidOrTimestampToString(_previousGeneration),
               "currentGeneration"_attr = oidOrTimestampToString(swCurrentGeneration.getValue()));
         try {
-            _authzManager->invalidateUserCache(opCtx.get());
+            // Refresh externally-sourced users in place rather than invalidating them.
+            // Re-resolving roles through an external provider can be expensive, and invalidating
+            // every externally-authorized connection at once serializes the resulting
+            // re-acquisitions behind the provider. Refreshing swaps in updated role data while
+            // connections continue to operate on their current users.
+            auto refreshStatus = _authzManager->refreshExternalUsers(opCtx.get());
+            if (refreshStatus.isOK()) {
+                _authzManager->invalidateNonExternalUsers(opCtx.get());
+            } else {
+                LOGV2_WARNING(6650040,
+                              "Error refreshing external users in user cache, so invalidating "
+                              "the full user cache",
+                              "error"_attr = refreshStatus);
+                _authzManager->invalidateUserCache(opCtx.get());
+            }
         } catch (const DBException& e) {
             LOGV2_WARNING(20268, "Error invalidating user cache", "error"_attr = e.toStatus());
         }
@@ -203,6 +225,11 @@ void UserCacheInvalidator::run() {
             }
         }
     }
+
+    // Re-arm the period so each pass gets a fresh jitter value.
+    if (userCacheInvalidationIntervalJitterSecs.load() > 0) {
+        setPeriod(loadInterval());
+    }
 }
 
 }  // namespace mongo
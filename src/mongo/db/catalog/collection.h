@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -99,6 +100,11 @@ struct CollectionUpdateArgs {
 
     // Set if OpTimes were reserved for the update ahead of time.
     std::vector<OplogSlot> oplogSlots;
+
+    // When set, the dotted paths modified by the update. Allows updateDocument() to skip schema
+    // validation of the post-image when the collection validator cannot be affected by the
+    // update. Left unset when the modified paths are unknown.
+    boost::optional<std::set<std::string>> modifiedPaths;
 };
 
 /**
@@ -261,10 +267,19 @@ public:
          * Note: this is shared state across cloned Collection instances
          */
         StatusWith<std::shared_ptr<MatchExpression>> filter = {nullptr};
+
+        /**
+         * A semantically equivalent copy of 'filter' rewritten by MatchExpression::optimize().
+         * Large $jsonSchema validators parse into deeply nested $and trees which the optimizer
+         * flattens, so this copy is cheaper to evaluate; 'filter' is kept unoptimized because
+         * the optimizer restructures the tree in ways the validation error generator does not
+         * understand. Null when there is no validator or when optimization failed.
+         */
+        std::shared_ptr<MatchExpression> optimizedFilter;
     };
 
     /**
-     * Callback function for callers of insertDocumentForBulkLoader().
+     * Callback function for callers of insertDocumentsForBulkLoader().
      */
     using OnRecordInsertedFn = std::function<Status(const RecordId& loc)>;
 
@@ -428,15 +443,17 @@ public:
                                            const std::vector<Timestamp>& timestamps) const = 0;
 
     /**
-     * Inserts a document into the record store for a bulk loader that manages the index building
-     * outside this Collection. The bulk loader is notified with the RecordId of the document
-     * inserted into the RecordStore.
+     * Inserts a batch of documents into the record store with a single vectored write for a bulk
+     * loader that manages the index building outside this Collection. The bulk loader is notified
+     * with the RecordId of each document inserted into the RecordStore, in order. Document
+     * validation is skipped: the documents are copied verbatim from a sync source that enforced
+     * any validator when they were originally inserted.
      *
      * NOTE: It is up to caller to commit the indexes.
      */
-    virtual Status insertDocumentForBulkLoader(
+    virtual Status insertDocumentsForBulkLoader(
         OperationContext* opCtx,
-        const BSONObj& doc,
+        const std::vector<BSONObj>& docs,
         const OnRecordInsertedFn& onRecordInserted) const = 0;
 
     /**
@@ -40,6 +40,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/snapshot_helper.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/uuid.h"
 
@@ -47,6 +48,11 @@ namespace mongo {
 namespace {
 struct LatestCollectionCatalog {
     std::shared_ptr<CollectionCatalog> catalog = std::make_shared<CollectionCatalog>();
+
+    // Incremented after every publication of a new catalog instance. Lets readers that have
+    // already loaded 'catalog' detect with a plain shared read whether their instance is still
+    // the latest, without touching the shared_ptr control block.
+    AtomicWord<uint64_t> catalogVersion{0};
 };
 const ServiceContext::Decoration<LatestCollectionCatalog> getCatalog =
     ServiceContext::declareDecoration<LatestCollectionCatalog>();
@@ -56,6 +62,18 @@ std::shared_ptr<CollectionCatalog> batchedCatalogWriteInstance;
 const OperationContext::Decoration<std::shared_ptr<const CollectionCatalog>> stashedCatalog =
     OperationContext::declareDecoration<std::shared_ptr<const CollectionCatalog>>();
 
+/**
+ * Latest catalog instance loaded by an operation together with the version it was published
+ * under, so repeated CollectionCatalog::get calls within the operation can be served without an
+ * atomic load of the global shared_ptr.
+ */
+struct CachedCatalog {
+    std::shared_ptr<const CollectionCatalog> catalog;
+    uint64_t version = 0;
+};
+const OperationContext::Decoration<CachedCatalog> cachedCatalog =
+    OperationContext::declareDecoration<CachedCatalog>();
+
 }  // namespace
 
 /**
@@ -556,7 +574,21 @@ std::shared_ptr<const CollectionCatalog> CollectionCatalog::get(OperationContext
     const auto& stashed = stashedCatalog(opCtx);
     if (stashed)
         return stashed;
-    return get(opCtx->getServiceContext());
+
+    // Concurrent atomic loads of the global instance all contend on the reference count of its
+    // control block. Cache the loaded instance in a decoration together with the version it was
+    // published under, so steady-state calls only perform a shared read of the version counter
+    // and reload only when a new instance has been published. The version must be read before
+    // the instance so that a concurrent publication at worst causes a spurious reload, never a
+    // stale cache entry.
+    auto& storage = getCatalog(opCtx->getServiceContext());
+    auto version = storage.catalogVersion.load();
+    auto& cached = cachedCatalog(opCtx);
+    if (!cached.catalog || cached.version != version) {
+        cached.catalog = atomic_load(&storage.catalog);
+        cached.version = version;
+    }
+    return cached.catalog;
 }
 
 void CollectionCatalog::stash(OperationContext* opCtx,
@@ -667,6 +699,7 @@ void CollectionCatalog::write(ServiceContext* svcCtx, CatalogWriteFn job) {
         if (queue.empty()) {
             // Queue is empty, store catalog and relinquish responsibility of being worker thread
             atomic_store(&storage.catalog, std::move(clone));
+            storage.catalogVersion.fetchAndAdd(1);
             workerExists = false;
             break;
         }
@@ -1800,6 +1833,7 @@ BatchedCollectionCatalogWriter::~BatchedCollectionCatalogWriter() {
     auto& storage = getCatalog(_opCtx->getServiceContext());
     invariant(
         atomic_compare_exchange_strong(&storage.catalog, &_base, batchedCatalogWriteInstance));
+    storage.catalogVersion.fetchAndAdd(1);
 
     // Clear out batched pointer so no more attempts of batching are made
     _batchedInstance = nullptr;
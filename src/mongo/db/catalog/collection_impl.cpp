@@ -57,6 +57,7 @@
 #include "mongo/db/keypattern.h"
 #include "mongo/db/matcher/doc_validation_error.h"
 #include "mongo/db/matcher/doc_validation_util.h"
+#include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_always_boolean.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/matcher/implicit_validator.h"
@@ -491,7 +492,15 @@ SharedCollectionDecorations* CollectionImpl::getSharedDecorations() const {
 }
 
 void CollectionImpl::init(OperationContext* opCtx) {
-    _metadata = DurableCatalog::get(opCtx)->getMetaData(opCtx, getCatalogId());
+    if (!_metadata) {
+        // Only Collections constructed without metadata need to read the durable catalog here.
+        // Collections registered at startup are constructed with a parsed metadata snapshot, and
+        // every in-memory metadata mutation (_writeMetadata(), replaceMetadata()) updates
+        // '_metadata' together with the durable catalog, so re-reading and re-parsing the catalog
+        // entry would be redundant. Avoiding it matters at startup where every collection on the
+        // node is initialized.
+        _metadata = DurableCatalog::get(opCtx)->getMetaData(opCtx, getCatalogId());
+    }
     const auto& collectionOptions = _metadata->options;
 
     _shared->_collator = parseCollation(opCtx, _ns, collectionOptions.collation);
@@ -655,8 +664,12 @@ std::pair<CollectionImpl::SchemaValidationResult, Status> CollectionImpl::checkV
         return {SchemaValidationResult::kError, status};
     }
 
+    // Check the document against the optimized copy of the validator when one is available; the
+    // annotated original is only needed below to explain a failure.
+    const auto* const checkExpr = _validator.optimizedFilter ? _validator.optimizedFilter.get()
+                                                             : validatorMatchExpr;
     try {
-        if (validatorMatchExpr->matchesBSON(document))
+        if (checkExpr->matchesBSON(document))
             return {SchemaValidationResult::kPass, Status::OK()};
     } catch (DBException&) {
     };
@@ -675,6 +688,36 @@ std::pair<CollectionImpl::SchemaValidationResult, Status> CollectionImpl::checkV
     return {SchemaValidationResult::kError, status};
 }
 
+bool CollectionImpl::_validatorIsIndependentOfPaths(
+    const std::set<std::string>& modifiedPaths) const {
+    if (!_validator.isOK() || !_validator.filter.getValue()) {
+        // No (or unparseable) validator; let checkValidation() produce its usual result.
+        return false;
+    }
+
+    // Skipping validation is only behavior-preserving at level 'moderate'. At level 'strict' an
+    // update to an already-invalid document must fail even if it cannot change the validation
+    // outcome, and checking the pre-image to distinguish that case costs as much as validating
+    // the post-image.
+    if (validationLevelOrDefault(_metadata->options.validationLevel) !=
+        ValidationLevelEnum::moderate) {
+        return false;
+    }
+
+    if (modifiedPaths.empty()) {
+        return false;
+    }
+
+    for (const auto& path : modifiedPaths) {
+        if (path.empty()) {
+            // An empty path means the entire document was replaced.
+            return false;
+        }
+    }
+
+    return expression::isIndependentOf(*_validator.filter.getValue(), modifiedPaths);
+}
+
 Status CollectionImpl::_checkValidationAndParseResult(OperationContext* opCtx,
                                                       const BSONObj& document) const {
     std::pair<CollectionImpl::SchemaValidationResult, Status> result =
@@ -791,7 +834,20 @@ Collection::Validator CollectionImpl::parseValidator(
                 "Combined match expression",
                 "expression"_attr = combinedMatchExpr->serialize());
 
-    return Collection::Validator{validator, std::move(expCtx), std::move(combinedMatchExpr)};
+    // Documents are checked against an optimized copy of the validator: optimization flattens
+    // the deeply nested $and trees that large $jsonSchema validators parse into. The original
+    // expression is kept alongside because generating a detailed validation error requires the
+    // unoptimized, annotated tree.
+    std::shared_ptr<MatchExpression> optimizedMatchExpr;
+    try {
+        optimizedMatchExpr = MatchExpression::optimize(combinedMatchExpr->shallowClone());
+    } catch (const DBException&) {
+        // Optimization of a well formed expression should not fail, but a validator is long
+        // lived, so prefer falling back to the unoptimized expression over erroring.
+    }
+
+    return Collection::Validator{
+        validator, std::move(expCtx), std::move(combinedMatchExpr), std::move(optimizedMatchExpr)};
 }
 
 Status CollectionImpl::insertDocumentsForOplog(OperationContext* opCtx,
@@ -892,37 +948,49 @@ Status CollectionImpl::insertDocument(OperationContext* opCtx,
     return insertDocuments(opCtx, docs.begin(), docs.end(), opDebug, fromMigrate);
 }
 
-Status CollectionImpl::insertDocumentForBulkLoader(
-    OperationContext* opCtx, const BSONObj& doc, const OnRecordInsertedFn& onRecordInserted) const {
-
-    auto status = checkFailCollectionInsertsFailPoint(_ns, doc);
-    if (!status.isOK()) {
-        return status;
-    }
+Status CollectionImpl::insertDocumentsForBulkLoader(
+    OperationContext* opCtx,
+    const std::vector<BSONObj>& docs,
+    const OnRecordInsertedFn& onRecordInserted) const {
+    dassert(opCtx->lockState()->isCollectionLockedForMode(ns(), MODE_IX));
+    invariant(!docs.empty());
 
-    status = _checkValidationAndParseResult(opCtx, doc);
-    if (!status.isOK()) {
-        return status;
-    }
+    std::vector<Record> records;
+    records.reserve(docs.size());
+    for (const auto& doc : docs) {
+        auto status = checkFailCollectionInsertsFailPoint(_ns, doc);
+        if (!status.isOK()) {
+            return status;
+        }
 
-    dassert(opCtx->lockState()->isCollectionLockedForMode(ns(), MODE_IX));
+        // Documents are copied verbatim from the sync source, which enforced any document
+        // validator when they were originally inserted. Re-validating them here could only fail
+        // the clone for documents that legitimately exist upstream, e.g. ones that predate the
+        // validator.
 
-    RecordId recordId;
-    if (isClustered()) {
-        invariant(_shared->_recordStore->keyFormat() == KeyFormat::String);
-        recordId = uassertStatusOK(record_id_helpers::keyForDoc(
-            doc, getClusteredInfo()->getIndexSpec(), getDefaultCollator()));
+        RecordId recordId;
+        if (isClustered()) {
+            invariant(_shared->_recordStore->keyFormat() == KeyFormat::String);
+            recordId = uassertStatusOK(record_id_helpers::keyForDoc(
+                doc, getClusteredInfo()->getIndexSpec(), getDefaultCollator()));
+        }
+        records.emplace_back(Record{std::move(recordId), RecordData(doc.objdata(), doc.objsize())});
     }
 
     // Using timestamp 0 for these inserts, which are non-oplog so we don't have an appropriate
     // timestamp to use.
-    StatusWith<RecordId> loc = _shared->_recordStore->insertRecord(
-        opCtx, recordId, doc.objdata(), doc.objsize(), Timestamp());
-
-    if (!loc.isOK())
-        return loc.getStatus();
+    std::vector<Timestamp> timestamps(records.size(), Timestamp());
+    auto status = _shared->_recordStore->insertRecords(opCtx, &records, timestamps);
+    if (!status.isOK()) {
+        return status;
+    }
 
-    status = onRecordInserted(loc.getValue());
+    for (const auto& record : records) {
+        status = onRecordInserted(record.id);
+        if (!status.isOK()) {
+            return status;
+        }
+    }
 
     if (MONGO_unlikely(failAfterBulkLoadDocInsert.shouldFail())) {
         LOGV2(20290,
@@ -933,24 +1001,27 @@ Status CollectionImpl::insertDocumentForBulkLoader(
     }
 
     std::vector<InsertStatement> inserts;
-    OplogSlot slot;
-    // Fetch a new optime now, if necessary.
+    inserts.reserve(docs.size());
     auto replCoord = repl::ReplicationCoordinator::get(opCtx);
-    if (!replCoord->isOplogDisabledFor(opCtx, _ns)) {
-        // Populate 'slot' with a new optime.
-        slot = repl::getNextOpTime(opCtx);
+    const bool fetchOpTimes = !replCoord->isOplogDisabledFor(opCtx, _ns);
+    for (const auto& doc : docs) {
+        OplogSlot slot;
+        // Fetch a new optime now, if necessary.
+        if (fetchOpTimes) {
+            slot = repl::getNextOpTime(opCtx);
+        }
+        inserts.emplace_back(kUninitializedStmtId, doc, slot);
     }
-    inserts.emplace_back(kUninitializedStmtId, doc, slot);
 
     opCtx->getServiceContext()->getOpObserver()->onInserts(
         opCtx, ns(), uuid(), inserts.begin(), inserts.end(), false);
 
-    _cappedDeleteAsNeeded(opCtx, loc.getValue());
+    _cappedDeleteAsNeeded(opCtx, records.back().id);
 
     opCtx->recoveryUnit()->onCommit(
         [this](boost::optional<Timestamp>) { _shared->notifyCappedWaitersIfNeeded(); });
 
-    return loc.getStatus();
+    return Status::OK();
 }
 
 Status CollectionImpl::_insertDocuments(OperationContext* opCtx,
@@ -1340,7 +1411,7 @@ RecordId CollectionImpl::updateDocument(OperationContext* opCtx,
                                         bool indexesAffected,
                                         OpDebug* opDebug,
                                         CollectionUpdateArgs* args) const {
-    {
+    if (!args->modifiedPaths || !_validatorIsIndependentOfPaths(*args->modifiedPaths)) {
         auto status = _checkValidationAndParseResult(opCtx, newDoc);
         if (!status.isOK()) {
             if (validationLevelOrDefault(_metadata->options.validationLevel) ==
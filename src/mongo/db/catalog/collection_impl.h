@@ -212,15 +212,15 @@ public:
                                    const std::vector<Timestamp>& timestamps) const final;
 
     /**
-     * Inserts a document into the record store for a bulk loader that manages the index building
-     * outside this Collection. The bulk loader is notified with the RecordId of the document
-     * inserted into the RecordStore.
+     * Inserts a batch of documents into the record store with a single vectored write for a bulk
+     * loader that manages the index building outside this Collection. The bulk loader is notified
+     * with the RecordId of each document inserted into the RecordStore, in order.
      *
      * NOTE: It is up to caller to commit the indexes.
      */
-    Status insertDocumentForBulkLoader(OperationContext* opCtx,
-                                       const BSONObj& doc,
-                                       const OnRecordInsertedFn& onRecordInserted) const final;
+    Status insertDocumentsForBulkLoader(OperationContext* opCtx,
+                                        const std::vector<BSONObj>& docs,
+                                        const OnRecordInsertedFn& onRecordInserted) const final;
 
     /**
      * Updates the document @ oldLocation with newDoc.
@@ -513,6 +513,14 @@ private:
 
     Status _checkValidationAndParseResult(OperationContext* opCtx, const BSONObj& document) const;
 
+    /**
+     * Returns true if an update that modifies exactly 'modifiedPaths' cannot change the outcome
+     * of schema validation, so validation of the post-image may be skipped. Only returns true at
+     * validation level 'moderate', where a pre-image and post-image with identical validation
+     * results always yield the same decision.
+     */
+    bool _validatorIsIndependentOfPaths(const std::set<std::string>& modifiedPaths) const;
+
     /**
      * Writes metadata to the DurableCatalog. Func should have the function signature
      * 'void(BSONCollectionCatalogEntry::MetaData&)'
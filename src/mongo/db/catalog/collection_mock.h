@@ -162,9 +162,9 @@ public:
         std::abort();
     }
 
-    Status insertDocumentForBulkLoader(OperationContext* opCtx,
-                                       const BSONObj& doc,
-                                       const OnRecordInsertedFn& onRecordInserted) const {
+    Status insertDocumentsForBulkLoader(OperationContext* opCtx,
+                                        const std::vector<BSONObj>& docs,
+                                        const OnRecordInsertedFn& onRecordInserted) const {
         std::abort();
     }
 
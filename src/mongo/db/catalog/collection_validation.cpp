@@ -647,6 +647,29 @@ Status validate(OperationContext* opCtx,
             return Status::OK();
         }
 
+        // A validation that does not inspect the underlying storage-engine state may be skipped
+        // when the collection's content checksum is unchanged since the last validation that
+        // completed cleanly: no records have been written since that run, so traversing the
+        // records and indexes again cannot turn up anything new. The checksum is only maintained
+        // when incremental validation is enabled and, like the fast count, may be stale after an
+        // unclean shutdown.
+        if (!validateState.isFullIndexValidation() && !validateState.fixErrors() &&
+            !validateState.adjustMultikey()) {
+            auto* recordStore = validateState.getCollection()->getRecordStore();
+            auto checksum = recordStore->dataChecksum();
+            auto cleanChecksum = recordStore->lastCleanValidateChecksum();
+            if (checksum && cleanChecksum && *checksum == *cleanChecksum) {
+                output->appendBool("checksumUnchangedSinceLastValidate", true);
+                LOGV2_OPTIONS(6650014,
+                              {LogComponent::kIndex},
+                              "Validation skipped for collection whose content checksum is "
+                              "unchanged since its last clean validation",
+                              logAttrs(validateState.nss()),
+                              logAttrs(validateState.uuid()));
+                return Status::OK();
+            }
+        }
+
         // Open all cursors at once before running non-full validation code so that all steps of
         // validation during background validation use the same view of the data.
         validateState.initializeCursors(opCtx);
@@ -721,6 +744,10 @@ Status validate(OperationContext* opCtx,
         // Report the validation results for the user to see.
         _reportValidationResults(opCtx, &validateState, results, output);
 
+        // Record the content checksum as of this clean validation so that, while the collection
+        // remains unwritten, subsequent validations can be skipped.
+        validateState.getCollection()->getRecordStore()->recordCleanValidation();
+
         if (MONGO_unlikely(gRoundtripBsonColumnOnValidate && getTestCommandsEnabled())) {
             _validateBSONColumnRoundtrip(opCtx, &validateState, results);
         }
@@ -77,13 +77,26 @@ MONGO_FAIL_POINT_DEFINE(leaveIndexBuildUnfinishedForShutdown);
 
 namespace {
 
-size_t getEachIndexBuildMaxMemoryUsageBytes(size_t numIndexSpecs) {
+// Refreshing the progress meter total requires a size storer lookup, so only do it periodically
+// rather than for every scanned record.
+constexpr int64_t kProgressTotalRefreshInterval = 4096;
+
+// Number of MultiIndexBlocks between init() and destruction across the process. The memory budget
+// is split between concurrent builds so they do not collectively overcommit the
+// 'maxIndexBuildMemoryUsageMegabytes' limit.
+AtomicWord<int> numActiveIndexBuilds{0};
+
+size_t getEachIndexBuildMaxMemoryUsageBytes(size_t numIndexSpecs, int numActiveBuilds) {
     if (numIndexSpecs == 0) {
         return 0;
     }
 
+    // Split the overall limit between the active builds, and between the indexes within this
+    // build. A build that runs alone gets the entire budget; builds that start while others are
+    // in progress get a proportional share. A sorter's budget is fixed when it is created, so an
+    // early build's share is not reclaimed if more builds start later.
     return static_cast<std::size_t>(maxIndexBuildMemoryUsageMegabytes.load()) * 1024 * 1024 /
-        numIndexSpecs;
+        (numActiveBuilds > 0 ? numActiveBuilds : 1) / numIndexSpecs;
 }
 
 Status timeseriesMixedSchemaDataFailure(const Collection* collection) {
@@ -102,6 +115,9 @@ Status timeseriesMixedSchemaDataFailure(const Collection* collection) {
 
 MultiIndexBlock::~MultiIndexBlock() {
     invariant(_buildIsCleanedUp);
+    if (_countedAsActiveBuild) {
+        numActiveIndexBuilds.fetchAndSubtract(1);
+    }
 }
 
 MultiIndexBlock::OnCleanUpFn MultiIndexBlock::kNoopOnCleanUpFn = []() {};
@@ -231,8 +247,13 @@ StatusWith<std::vector<BSONObj>> MultiIndexBlock::init(
 
         std::vector<BSONObj> indexInfoObjs;
         indexInfoObjs.reserve(indexSpecs.size());
+        if (!_countedAsActiveBuild) {
+            _countedAsActiveBuild = true;
+            numActiveIndexBuilds.fetchAndAdd(1);
+        }
+        const int numActiveBuilds = numActiveIndexBuilds.load();
         std::size_t eachIndexBuildMaxMemoryUsageBytes =
-            getEachIndexBuildMaxMemoryUsageBytes(indexSpecs.size());
+            getEachIndexBuildMaxMemoryUsageBytes(indexSpecs.size(), numActiveBuilds);
 
         // Initializing individual index build blocks below performs un-timestamped writes to the
         // durable catalog. It's possible for the onInit function to set multiple timestamps
@@ -344,7 +365,8 @@ StatusWith<std::vector<BSONObj>> MultiIndexBlock::init(
                   "ident"_attr = indexCatalogEntry->getIdent(),
                   "collectionIdent"_attr = collection->getSharedIdent()->getIdent(),
                   "maxTemporaryMemoryUsageMB"_attr =
-                      eachIndexBuildMaxMemoryUsageBytes / 1024 / 1024);
+                      eachIndexBuildMaxMemoryUsageBytes / 1024 / 1024,
+                  "numActiveIndexBuilds"_attr = numActiveBuilds);
 
             index.filterExpression = indexCatalogEntry->getFilterExpression();
         }
@@ -507,7 +529,8 @@ Status MultiIndexBlock::insertAllDocumentsInCollection(
                 _lastRecordIdInserted = boost::none;
                 for (auto& index : _indexes) {
                     index.bulk = index.real->initiateBulk(
-                        getEachIndexBuildMaxMemoryUsageBytes(_indexes.size()),
+                        getEachIndexBuildMaxMemoryUsageBytes(_indexes.size(),
+                                                             numActiveIndexBuilds.load()),
                         /*stateInfo=*/boost::none,
                         collection->ns().db());
                 }
@@ -610,6 +633,7 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
     BSONObj objToIndex;
     RecordId loc;
     PlanExecutor::ExecState state;
+    int64_t recordsScanned = 0;
     while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
            MONGO_unlikely(hangAfterStartingIndexBuild.shouldFail())) {
         opCtx->checkForInterrupt();
@@ -618,7 +642,9 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
             continue;
         }
 
-        progress->get()->setTotalWhileRunning(collection->numRecords(opCtx));
+        if (recordsScanned++ % kProgressTotalRefreshInterval == 0) {
+            progress->get()->setTotalWhileRunning(collection->numRecords(opCtx));
+        }
 
         uassertStatusOK(
             _failPointHangDuringBuild(opCtx,
@@ -362,6 +362,10 @@ private:
     // incorrect state set anywhere.
     bool _buildIsCleanedUp = true;
 
+    // True once this build has been counted towards the process-wide number of active index
+    // builds, which is used to split the index build memory budget between concurrent builds.
+    bool _countedAsActiveBuild = false;
+
     // A unique identifier associating this index build with a two-phase index build within a
     // replica set.
     boost::optional<UUID> _buildUUID;
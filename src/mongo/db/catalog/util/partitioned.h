@@ -291,9 +291,12 @@ public:
 
     /**
      * Constructs a partitioned version of AssociativeContainer, with `nPartitions` partitions.
+     * Each partition is default-constructed in place, so unlike the constructor below this one is
+     * usable with containers whose value types are move-only.
      */
-    explicit Partitioned(std::size_t nPartitions)
-        : Partitioned(nPartitions, AssociativeContainer{}) {}
+    explicit Partitioned(std::size_t nPartitions) : _mutexes(nPartitions), _partitions(nPartitions) {
+        invariant(nPartitions > 0);
+    }
 
     /**
      * Constructs a partitioned AssociativeContainer with `nPartitions` copies of container.
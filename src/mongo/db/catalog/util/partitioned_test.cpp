@@ -29,6 +29,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <memory>
 #include <set>
 
 #include "mongo/db/catalog/util/partitioned.h"
@@ -105,6 +106,17 @@ TEST(Partitioned, ErasingEntryShouldModifySize) {
     ASSERT_EQ(test.size(), 2UL);
 }
 
+TEST(Partitioned, ShouldSupportMoveOnlyMappedTypes) {
+    Partitioned<stdx::unordered_map<std::size_t, std::unique_ptr<char>>> test(nPartitions);
+    ASSERT_TRUE(test.empty());
+    {
+        auto partition = test.lockOnePartition(4);
+        partition->emplace(4, std::make_unique<char>('d'));
+    }
+    ASSERT_EQ(test.size(), 1UL);
+    ASSERT_EQ(test.count(4), 1UL);
+}
+
 TEST(Partitioned, ErasingEntryThatDoesNotExistShouldNotModifySize) {
     auto test = makePartitionedIntSet();
     test.insert(0);
@@ -98,6 +98,7 @@ ClientCursor::ClientCursor(ClientCursorParams params,
       _originatingPrivileges(std::move(params.originatingPrivileges)),
       _tailableMode(params.tailableMode),
       _isNoTimeout(params.isNoTimeout),
+      _fillBatchToMaxBytes(params.fillBatchToMaxBytes),
       _exec(std::move(params.exec)),
       _operationUsingCursor(operationUsingCursor),
       _lastUseDate(now),
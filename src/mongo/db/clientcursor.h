@@ -76,6 +76,11 @@ struct ClientCursorParams {
                   ? static_cast<bool>(
                         exec->getCanonicalQuery()->getFindCommandRequest().getNoCursorTimeout())
                   : false),
+          fillBatchToMaxBytes(
+              exec->getCanonicalQuery()
+                  ? static_cast<bool>(
+                        exec->getCanonicalQuery()->getFindCommandRequest().getFillBatchToMaxBytes())
+                  : false),
           tailableMode(exec->getCanonicalQuery()
                            ? query_request_helper::getTailableMode(
                                  exec->getCanonicalQuery()->getFindCommandRequest())
@@ -99,6 +104,7 @@ struct ClientCursorParams {
     const repl::ReadConcernArgs readConcernArgs;
     const ReadPreferenceSetting readPreferenceSetting;
     const bool isNoTimeout;
+    const bool fillBatchToMaxBytes;
     TailableModeEnum tailableMode;
     BSONObj originatingCommandObj;
     PrivilegeVector originatingPrivileges;
@@ -351,6 +357,15 @@ private:
         return _isNoTimeout;
     }
 
+    /**
+     * Returns true if the originating command opted in to filling every batch up to the maximum
+     * response size, in which case getMore batch sizes do not limit the number of documents
+     * returned.
+     */
+    bool shouldFillBatchToMaxBytes() const {
+        return _fillBatchToMaxBytes;
+    }
+
     // The ID of the ClientCursor. A value of 0 is used to mean that no cursor id has been assigned.
     const CursorId _cursorid = 0;
 
@@ -396,6 +411,8 @@ private:
 
     const bool _isNoTimeout;
 
+    const bool _fillBatchToMaxBytes;
+
     // Unused maxTime budget for this cursor.
     Microseconds _leftoverMaxTimeMicros = Microseconds::max();
 
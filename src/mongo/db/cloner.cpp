@@ -72,6 +72,10 @@ using IndexVersion = IndexDescriptor::IndexVersion;
 
 MONGO_FAIL_POINT_DEFINE(movePrimaryFailPoint);
 
+// Maximum number of documents the cloner groups into one WriteUnitOfWork when copying a
+// collection. Batches are additionally bounded by the size of the remote cursor's network batch.
+constexpr size_t kClonerInsertBatchDocs = 64;
+
 BSONElement getErrField(const BSONObj& o);
 
 BSONObj Cloner::_getIdIndexSpec(const std::list<BSONObj>& indexSpecs) {
@@ -126,6 +130,57 @@ struct Cloner::Fun {
             });
         }
 
+        std::vector<InsertStatement> batch;
+
+        // Inserts everything gathered in 'batch' and clears it. Tries a single WriteUnitOfWork
+        // for the whole batch first; on failure, falls back to inserting one document at a time,
+        // which retries write conflicts and reports any persistent error against the offending
+        // document.
+        auto flushBatch = [&] {
+            bool batchInserted = false;
+            if (batch.size() > 1) {
+                try {
+                    opCtx->checkForInterrupt();
+
+                    WriteUnitOfWork wunit(opCtx);
+                    OpDebug* const nullOpDebug = nullptr;
+                    uassertStatusOK(collection->insertDocuments(
+                        opCtx, batch.cbegin(), batch.cend(), nullOpDebug, true));
+                    wunit.commit();
+                    batchInserted = true;
+                } catch (const DBException&) {
+                    // Fall through to the one-at-a-time path below.
+                }
+            }
+
+            if (!batchInserted) {
+                for (const auto& insertStmt : batch) {
+                    writeConflictRetry(opCtx, "cloner insert", nss.ns(), [&] {
+                        opCtx->checkForInterrupt();
+
+                        WriteUnitOfWork wunit(opCtx);
+
+                        OpDebug* const nullOpDebug = nullptr;
+                        Status status =
+                            collection->insertDocument(opCtx, insertStmt, nullOpDebug, true);
+                        if (!status.isOK() && status.code() != ErrorCodes::DuplicateKey) {
+                            LOGV2_ERROR(20424,
+                                        "error: exception cloning object",
+                                        "Exception cloning document",
+                                        logAttrs(nss),
+                                        "error"_attr = redact(status),
+                                        "document"_attr = redact(insertStmt.doc));
+                            uassertStatusOK(status);
+                        }
+                        if (status.isOK()) {
+                            wunit.commit();
+                        }
+                    });
+                }
+            }
+            batch.clear();
+        };
+
         while (i.moreInCurrentBatch()) {
             if (numSeen % 128 == 127) {
                 time_t now = time(nullptr);
@@ -182,29 +237,16 @@ struct Cloner::Fun {
 
             verify(collection);
             ++numSeen;
-
-            writeConflictRetry(opCtx, "cloner insert", nss.ns(), [&] {
-                opCtx->checkForInterrupt();
-
-                WriteUnitOfWork wunit(opCtx);
-
-                BSONObj doc = tmp;
-                OpDebug* const nullOpDebug = nullptr;
-                Status status =
-                    collection->insertDocument(opCtx, InsertStatement(doc), nullOpDebug, true);
-                if (!status.isOK() && status.code() != ErrorCodes::DuplicateKey) {
-                    LOGV2_ERROR(20424,
-                                "error: exception cloning object",
-                                "Exception cloning document",
-                                logAttrs(nss),
-                                "error"_attr = redact(status),
-                                "document"_attr = redact(doc));
-                    uassertStatusOK(status);
-                }
-                if (status.isOK()) {
-                    wunit.commit();
-                }
-            });
+            batch.emplace_back(tmp);
+
+            // Group several documents into each WriteUnitOfWork so that collections of small
+            // documents do not pay for a full commit per document. The batch is cut at the yield
+            // point above so the database lock is still released periodically. Capped collections
+            // must be inserted into one document at a time (see Collection::insertDocuments).
+            const size_t maxBatchDocs = collection->isCapped() ? 1 : kClonerInsertBatchDocs;
+            if (batch.size() >= maxBatchDocs || numSeen % 128 == 127) {
+                flushBatch();
+            }
 
             static Rarely sampler;
             if (sampler.tick() && (time(nullptr) - saveLast > 60)) {
@@ -215,6 +257,9 @@ struct Cloner::Fun {
                 saveLast = time(nullptr);
             }
         }
+
+        // Insert any leftover partial batch before the cursor's data goes away.
+        flushBatch();
     }
 
     time_t lastLog;
@@ -345,74 +390,95 @@ Status Cloner::_createCollectionsForDb(
     invariant(opCtx->lockState()->isDbLockedForMode(dbName, MODE_X));
 
     auto catalog = CollectionCatalog::get(opCtx);
-    auto collCount = 0;
-    for (auto&& params : createCollectionParams) {
-        if (MONGO_unlikely(movePrimaryFailPoint.shouldFail()) && collCount > 0) {
+
+    // Create the collections several at a time per WriteUnitOfWork. Each commit journals and
+    // replicates separately, so committing once per collection makes movePrimary on a database
+    // with thousands of small collections bound by the number of collections rather than by the
+    // amount of data being copied.
+    constexpr size_t kMaxCollectionsPerBatch = 16;
+
+    // With the fail point enabled, revert to one collection per batch so that the simulated
+    // failure below still happens after exactly one collection has been committed.
+    const size_t maxCollectionsPerBatch =
+        MONGO_unlikely(movePrimaryFailPoint.shouldFail()) ? 1 : kMaxCollectionsPerBatch;
+
+    for (size_t batchStart = 0; batchStart < createCollectionParams.size();
+         batchStart += maxCollectionsPerBatch) {
+        const size_t batchEnd =
+            std::min(batchStart + maxCollectionsPerBatch, createCollectionParams.size());
+
+        // The batch boundary is the only point where earlier creations have durably committed,
+        // so this is where a simulated mid-clone failure belongs.
+        if (MONGO_unlikely(movePrimaryFailPoint.shouldFail()) && batchStart > 0) {
             return Status(ErrorCodes::CommandFailed, "movePrimary failed due to failpoint");
         }
-        collCount++;
-
-        BSONObjBuilder optionsBuilder;
-        optionsBuilder.appendElements(params.collectionInfo["options"].Obj());
-
-        const NamespaceString nss(dbName, params.collectionName);
 
-        uassertStatusOK(userAllowedCreateNS(opCtx, nss));
-        Status status = writeConflictRetry(opCtx, "createCollection", nss.ns(), [&] {
+        Status status = writeConflictRetry(opCtx, "createCollections", dbName, [&] {
             opCtx->checkForInterrupt();
             WriteUnitOfWork wunit(opCtx);
 
-            CollectionPtr collection = catalog->lookupCollectionByNamespace(opCtx, nss);
-            if (collection) {
-                if (!params.shardedColl) {
-                    // If the collection is unsharded then we want to fail when a collection
-                    // we're trying to create already exists.
-                    return Status(ErrorCodes::NamespaceExists,
-                                  str::stream() << "unsharded collection with same namespace "
-                                                << nss.ns() << " already exists.");
+            for (size_t i = batchStart; i < batchEnd; i++) {
+                const auto& params = createCollectionParams[i];
+
+                BSONObjBuilder optionsBuilder;
+                optionsBuilder.appendElements(params.collectionInfo["options"].Obj());
+
+                const NamespaceString nss(dbName, params.collectionName);
+
+                uassertStatusOK(userAllowedCreateNS(opCtx, nss));
+
+                CollectionPtr collection = catalog->lookupCollectionByNamespace(opCtx, nss);
+                if (collection) {
+                    if (!params.shardedColl) {
+                        // If the collection is unsharded then we want to fail when a collection
+                        // we're trying to create already exists.
+                        return Status(ErrorCodes::NamespaceExists,
+                                      str::stream() << "unsharded collection with same namespace "
+                                                    << nss.ns() << " already exists.");
+                    }
+
+                    // If the collection is sharded and a collection with the same name already
+                    // exists on the target, we check if the existing collection's UUID matches
+                    // that of the one we're trying to create. If it does, we treat the create
+                    // as a no-op; if it doesn't match, we return an error.
+                    const auto& existingOpts = collection->getCollectionOptions();
+                    const UUID clonedUUID =
+                        uassertStatusOK(UUID::parse(params.collectionInfo["info"]["uuid"]));
+
+                    if (clonedUUID == existingOpts.uuid)
+                        continue;
+
+                    return Status(ErrorCodes::InvalidOptions,
+                                  str::stream()
+                                      << "sharded collection with same namespace " << nss.ns()
+                                      << " already exists, but UUIDs don't match. Existing UUID is "
+                                      << existingOpts.uuid << " and new UUID is " << clonedUUID);
                 }
 
-                // If the collection is sharded and a collection with the same name already
-                // exists on the target, we check if the existing collection's UUID matches
-                // that of the one we're trying to create. If it does, we treat the create
-                // as a no-op; if it doesn't match, we return an error.
-                const auto& existingOpts = collection->getCollectionOptions();
-                const UUID clonedUUID =
-                    uassertStatusOK(UUID::parse(params.collectionInfo["info"]["uuid"]));
-
-                if (clonedUUID == existingOpts.uuid)
-                    return Status::OK();
-
-                return Status(ErrorCodes::InvalidOptions,
-                              str::stream()
-                                  << "sharded collection with same namespace " << nss.ns()
-                                  << " already exists, but UUIDs don't match. Existing UUID is "
-                                  << existingOpts.uuid << " and new UUID is " << clonedUUID);
-            }
-
-            // If the collection does not already exist and is sharded, we create a new
-            // collection on the target shard with the UUID of the original collection and
-            // copy the options and secondary indexes. If the collection does not already
-            // exist and is unsharded, we create a new collection with its own UUID and
-            // copy the options and secondary indexes of the original collection.
-
-            if (params.shardedColl) {
-                optionsBuilder.append(params.collectionInfo["info"]["uuid"]);
-            }
+                // If the collection does not already exist and is sharded, we create a new
+                // collection on the target shard with the UUID of the original collection and
+                // copy the options and secondary indexes. If the collection does not already
+                // exist and is unsharded, we create a new collection with its own UUID and
+                // copy the options and secondary indexes of the original collection.
 
-            const bool createDefaultIndexes = true;
-            auto options = optionsBuilder.obj();
+                if (params.shardedColl) {
+                    optionsBuilder.append(params.collectionInfo["info"]["uuid"]);
+                }
 
-            CollectionOptions collectionOptions = uassertStatusOK(
-                CollectionOptions::parse(options, CollectionOptions::ParseKind::parseForStorage));
+                const bool createDefaultIndexes = true;
+                auto options = optionsBuilder.obj();
 
-            {
-                OperationShardingState::ScopedAllowImplicitCollectionCreate_UNSAFE
-                    unsafeCreateCollection(opCtx);
-                Status createStatus = db->userCreateNS(
-                    opCtx, nss, collectionOptions, createDefaultIndexes, params.idIndexSpec);
-                if (!createStatus.isOK()) {
-                    return createStatus;
+                CollectionOptions collectionOptions = uassertStatusOK(CollectionOptions::parse(
+                    options, CollectionOptions::ParseKind::parseForStorage));
+
+                {
+                    OperationShardingState::ScopedAllowImplicitCollectionCreate_UNSAFE
+                        unsafeCreateCollection(opCtx);
+                    Status createStatus = db->userCreateNS(
+                        opCtx, nss, collectionOptions, createDefaultIndexes, params.idIndexSpec);
+                    if (!createStatus.isOK()) {
+                        return createStatus;
+                    }
                 }
             }
 
@@ -420,7 +486,7 @@ Status Cloner::_createCollectionsForDb(
             return Status::OK();
         });
 
-        // Break early if one of the creations fails.
+        // Break early if one of the batches fails.
         if (!status.isOK()) {
             return status;
         }
@@ -44,6 +44,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/dbcheck.h"
+#include "mongo/db/repl/dbcheck_dirty_ranges.h"
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/write_concern_options.h"
@@ -143,6 +144,9 @@ struct DbCheckCollectionInfo {
     int64_t maxBytesPerBatch;
     int64_t maxBatchTimeMillis;
     bool snapshotRead;
+    // When set, 'start' is an inclusive rather than exclusive bound. Used for the dirty ranges
+    // produced by incremental dbCheck, whose bounds are dirty keys that must be checked.
+    bool inclusiveStart;
     WriteConcernOptions writeConcern;
 };
 
@@ -173,6 +177,34 @@ std::unique_ptr<DbCheckRun> singleCollectionRun(OperationContext* opCtx,
     const auto maxDocsPerBatch = invocation.getMaxDocsPerBatch();
     const auto maxBytesPerBatch = invocation.getMaxBytesPerBatch();
     const auto maxBatchTimeMillis = invocation.getMaxBatchTimeMillis();
+    auto result = std::make_unique<DbCheckRun>();
+
+    if (invocation.getOnlyDirtyRanges()) {
+        uassert(6929920,
+                "Cannot specify minKey or maxKey together with onlyDirtyRanges",
+                start == BSONKey::min() && end == BSONKey::max());
+        // Check only the key ranges written since the last incremental run, which the op
+        // observer has been recording. Each dirty range's bounds are themselves dirty keys, so
+        // the start bound must be checked too.
+        auto ranges =
+            DbCheckDirtyRanges::get(opCtx->getServiceContext()).takeRanges(nss);
+        for (auto&& range : ranges) {
+            result->push_back(DbCheckCollectionInfo{nss,
+                                                    range.start,
+                                                    range.end,
+                                                    maxCount,
+                                                    maxSize,
+                                                    maxRate,
+                                                    maxDocsPerBatch,
+                                                    maxBytesPerBatch,
+                                                    maxBatchTimeMillis,
+                                                    invocation.getSnapshotRead(),
+                                                    true /* inclusiveStart */,
+                                                    invocation.getBatchWriteConcern()});
+        }
+        return result;
+    }
+
     const auto info = DbCheckCollectionInfo{nss,
                                             start,
                                             end,
@@ -183,8 +215,8 @@ std::unique_ptr<DbCheckRun> singleCollectionRun(OperationContext* opCtx,
                                             maxBytesPerBatch,
                                             maxBatchTimeMillis,
                                             invocation.getSnapshotRead(),
+                                            false /* inclusiveStart */,
                                             invocation.getBatchWriteConcern()};
-    auto result = std::make_unique<DbCheckRun>();
     result->push_back(info);
     return result;
 }
@@ -218,6 +250,7 @@ std::unique_ptr<DbCheckRun> fullDatabaseRun(OperationContext* opCtx,
                                    maxBytesPerBatch,
                                    maxBatchTimeMillis,
                                    invocation.getSnapshotRead(),
+                                   false /* inclusiveStart */,
                                    invocation.getBatchWriteConcern()};
         result->push_back(info);
         return true;
@@ -536,6 +569,10 @@ private:
                                           << " due to pending catalog changes"};
                 }
 
+                // Only the first batch of a range starts at the range's own (possibly
+                // inclusive) bound; later batches resume after the previous batch's last key.
+                const bool inclusiveStart = info.inclusiveStart && first == info.start;
+
                 boost::optional<DbCheckHasher> hasher;
                 try {
                     hasher.emplace(opCtx,
@@ -543,7 +580,8 @@ private:
                                    first,
                                    info.end,
                                    std::min(batchDocs, info.maxCount),
-                                   std::min(batchBytes, info.maxSize));
+                                   std::min(batchBytes, info.maxSize),
+                                   inclusiveStart);
                 } catch (const DBException& e) {
                     return e.toStatus();
                 }
@@ -564,6 +602,9 @@ private:
                 batch.setMinKey(first);
                 batch.setMaxKey(BSONKey(hasher->lastKey()));
                 batch.setReadTimestamp(readTimestamp);
+                if (inclusiveStart) {
+                    batch.setInclusiveStart(true);
+                }
 
                 // Send information on this batch over the oplog.
                 result.time = _logOp(opCtx, info.nss, collection->uuid(), batch.toBSON());
@@ -665,7 +706,9 @@ public:
                "              maxDocsPerBatch: <max number of docs/batch>\n"
                "              maxBytesPerBatch: <try to keep a batch within max bytes/batch>\n"
                "              maxBatchTimeMillis: <max time processing a batch in milliseconds>\n"
-               "              readTimestamp: <bool, read at a timestamp without strong locks> }\n"
+               "              readTimestamp: <bool, read at a timestamp without strong locks>,\n"
+               "              onlyDirtyRanges: <bool, only check the _id ranges written since\n"
+               "                                the last incremental run> }\n"
                "to check a collection.\n"
                "Invoke with {dbCheck: 1} to check all collections in the database.";
     }
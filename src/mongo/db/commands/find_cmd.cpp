@@ -34,13 +34,16 @@
 #include "mongo/db/auth/authorization_checks.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/collection_uuid_mismatch.h"
+#include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/concurrency/lock_state.h"
 #include "mongo/db/commands/run_aggregate.h"
 #include "mongo/db/commands/test_commands_enabled.h"
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/dbhelpers.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/fle_crud.h"
 #include "mongo/db/matcher/extensions_callback_real.h"
@@ -53,7 +56,9 @@
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/query/query_results_cache.h"
 #include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
@@ -186,6 +191,94 @@ void beginQueryOp(OperationContext* opCtx, const NamespaceString& nss, const BSO
     curOp->setNS_inlock(nss.ns());
 }
 
+/**
+ * Returns whether 'findCommand' is a point read on _id that can be answered with a single _id
+ * index lookup, without constructing a CanonicalQuery or a plan executor: a filter of the shape
+ * {_id: <value>} and no query modifiers that could change the result.
+ *
+ * The value types are restricted to those for which equality-match semantics coincide with an
+ * _id index key lookup. Objects may contain match operators, arrays and regexes have
+ * non-equality match semantics, and null also matches documents with an undefined _id.
+ */
+bool isExpressIdPointQuery(const FindCommandRequest& findCommand) {
+    const BSONObj& filter = findCommand.getFilter();
+    BSONElement idElem = filter.firstElement();
+    if (filter.nFields() != 1 || idElem.fieldNameStringData() != "_id") {
+        return false;
+    }
+
+    switch (idElem.type()) {
+        case NumberInt:
+        case NumberLong:
+        case NumberDouble:
+        case NumberDecimal:
+        case String:
+        case jstOID:
+        case BinData:
+        case Bool:
+        case Date:
+        case bsonTimestamp:
+            break;
+        default:
+            return false;
+    }
+
+    return findCommand.getSort().isEmpty() && findCommand.getProjection().isEmpty() &&
+        findCommand.getHint().isEmpty() && findCommand.getCollation().isEmpty() &&
+        findCommand.getMin().isEmpty() && findCommand.getMax().isEmpty() &&
+        findCommand.getResumeAfter().isEmpty() && !findCommand.getSkip().value_or(0) &&
+        findCommand.getBatchSize().value_or(1) > 0 && !findCommand.getNtoreturn() &&
+        !findCommand.getTailable() && !findCommand.getReturnKey() &&
+        !findCommand.getShowRecordId() && !findCommand.getRequestResumeToken() &&
+        !findCommand.getLet() && !findCommand.getLegacyRuntimeConstants() &&
+        !findCommand.getEncryptionInformation();
+}
+
+// Process-wide count of point reads currently executing without a storage execution ticket.
+AtomicWord<int> pointReadTicketBypassCount{0};
+
+/**
+ * Optimistic ticketless lane for express _id point reads. While at most
+ * 'internalQueryPointReadTicketBypassBudget' such reads are in flight, skips storage ticket
+ * admission for the enclosing operation so that a sub-millisecond lookup does not queue behind
+ * long-running ticketed operations. When the budget is exhausted (or the bypass is disabled) the
+ * query takes the regular ticketed path.
+ *
+ * relinquish() must be called after locks have been released if the query leaves the point read
+ * path, e.g. when a view redirects it into an aggregation.
+ */
+class PointReadTicketBypass {
+public:
+    PointReadTicketBypass(const PointReadTicketBypass&) = delete;
+    PointReadTicketBypass& operator=(const PointReadTicketBypass&) = delete;
+
+    explicit PointReadTicketBypass(OperationContext* opCtx) {
+        const auto budget = internalQueryPointReadTicketBypassBudget.load();
+        if (budget <= 0) {
+            return;
+        }
+        if (pointReadTicketBypassCount.addAndFetch(1) > budget) {
+            pointReadTicketBypassCount.subtractAndFetch(1);
+            return;
+        }
+        _skip.emplace(opCtx);
+    }
+
+    ~PointReadTicketBypass() {
+        relinquish();
+    }
+
+    void relinquish() {
+        if (_skip) {
+            _skip.reset();
+            pointReadTicketBypassCount.subtractAndFetch(1);
+        }
+    }
+
+private:
+    boost::optional<SkipTicketAcquisitionForLock> _skip;
+};
+
 /**
  * A command for running .find() queries.
  */
@@ -478,6 +571,26 @@ public:
                 }
             }
 
+            // Capture the results cache write generation before any locks are taken; the
+            // generation must predate the storage snapshot the batch will be read from for
+            // invalidation to be sound (see QueryResultsCache). Finds by UUID are not cached since
+            // their namespace is not known at this point.
+            boost::optional<uint64_t> resultsCacheGeneration;
+            if (internalQueryEnableResultsCache.load() &&
+                !findCommand->getNamespaceOrUUID().uuid()) {
+                resultsCacheGeneration = QueryResultsCache::get(opCtx).writeGeneration(
+                    findCommand->getNamespaceOrUUID().nss()->ns());
+            }
+
+            // Point reads eligible for the express _id path hold their storage ticket only for
+            // the few microseconds of the index lookup, yet under load they queue at admission
+            // behind long-running scans. Let a bounded number of them run without a ticket.
+            // Declared before 'ctx' so it is destroyed after the locks are released.
+            boost::optional<PointReadTicketBypass> ticketBypass;
+            if (isExpressIdPointQuery(*findCommand)) {
+                ticketBypass.emplace(opCtx);
+            }
+
             // Acquire locks. If the query is on a view, we release our locks and convert the query
             // request into an aggregation command.
             boost::optional<AutoGetCollectionForReadCommandMaybeLockFree> ctx;
@@ -519,6 +632,67 @@ public:
             // Fill out curop information.
             beginQueryOp(opCtx, nss, _request.body);
 
+            // Express path for point reads on _id: answer the query with a single _id index
+            // lookup, skipping canonicalization and plan executor construction. Versioned
+            // operations on sharded collections stay on the regular path, which attaches the
+            // shard filter; so do clustered collections, which have no _id IndexDescriptor.
+            if (ctx->getCollection() && !ctx->getView() && isExpressIdPointQuery(*findCommand) &&
+                !(OperationShardingState::isComingFromRouter(opCtx) &&
+                  ctx->getCollection().isSharded()) &&
+                ctx->getCollection()->getIndexCatalog()->findIdIndex(opCtx) &&
+                !(feature_flags::gfeatureFlagCommonQueryFramework.isEnabled(
+                      serverGlobalParams.featureCompatibility) &&
+                  internalQueryEnableCascadesOptimizer.load())) {
+                // Check whether we are allowed to read from this node after acquiring our locks.
+                uassertStatusOK(replCoord->checkCanServeReadsFor(
+                    opCtx, nss, ReadPreferenceSetting::get(opCtx).canRunOnSecondary()));
+
+                if (findCommand->getReadOnce()) {
+                    opCtx->recoveryUnit()->setReadOnce(true);
+                }
+
+                {
+                    stdx::lock_guard<Client> lk(*opCtx->getClient());
+                    CurOp::get(opCtx)->setPlanSummary_inlock("IDHACK");
+                }
+
+                const auto& collection = ctx->getCollection();
+                BSONObj obj;
+                bool found = false;
+                auto recordId = Helpers::findById(opCtx, collection, findCommand->getFilter());
+                if (!recordId.isNull()) {
+                    obj = collection->docFor(opCtx, recordId).value();
+                    found = true;
+                }
+
+                CursorResponseBuilder::Options options;
+                options.isInitialResponse = true;
+                if (!opCtx->inMultiDocumentTransaction()) {
+                    options.atClusterTime =
+                        repl::ReadConcernArgs::get(opCtx).getArgsAtClusterTime();
+                }
+                CursorResponseBuilder firstBatch(result, options);
+                ResourceConsumption::DocumentUnitCounter docUnitsReturned;
+                if (found) {
+                    firstBatch.append(obj);
+                    docUnitsReturned.observeOne(obj.objsize());
+                }
+
+                auto curOp = CurOp::get(opCtx);
+                curOp->debug().nreturned = found ? 1 : 0;
+                curOp->debug().cursorid = -1;
+                curOp->debug().cursorExhausted = true;
+                curOp->debug().additiveMetrics.keysExamined = found ? 1 : 0;
+                curOp->debug().additiveMetrics.docsExamined = found ? 1 : 0;
+
+                firstBatch.done(0 /* cursorId */, nss.ns());
+
+                auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
+                metricsCollector.incrementDocUnitsReturned(docUnitsReturned);
+                query_request_helper::validateCursorResponse(result->getBodyBuilder().asTempObj());
+                return;
+            }
+
             // Finish the parsing step by using the FindCommandRequest to create a CanonicalQuery.
             const ExtensionsCallbackReal extensionsCallback(opCtx, &nss);
             auto expCtx = makeExpressionContext(opCtx, *findCommand, boost::none /* verbosity */);
@@ -545,6 +719,12 @@ public:
                 auto viewAggregationCommand =
                     uassertStatusOK(query_request_helper::asAggregationCommand(findCommand));
 
+                // The query is no longer a bounded point read; make sure the aggregation below
+                // goes through regular ticket admission.
+                if (ticketBypass) {
+                    ticketBypass->relinquish();
+                }
+
                 BSONObj aggResult = CommandHelpers::runCommandDirectly(
                     opCtx, OpMsgRequest::fromDBAndBody(_dbName, std::move(viewAggregationCommand)));
                 auto status = getStatusFromCommandResult(aggResult);
@@ -569,6 +749,42 @@ public:
                 opCtx->recoveryUnit()->setReadOnce(true);
             }
 
+            // Serve the first batch from the results cache when an identical eligible query has
+            // run since the last write to this collection. Capped collections are excluded
+            // because their deletes do not pass through the op observer, and shard-versioned
+            // queries because chunk ownership can change without a local write.
+            std::string resultsCacheKey;
+            if (resultsCacheGeneration && collection && !collection->isCapped() &&
+                !OperationShardingState::isComingFromRouter(opCtx) &&
+                QueryResultsCache::isEligible(opCtx, *cq)) {
+                resultsCacheKey = QueryResultsCache::computeKey(*cq);
+                if (auto cachedBatch = QueryResultsCache::get(opCtx).lookup(collection->uuid(),
+                                                                            resultsCacheKey)) {
+                    CursorResponseBuilder::Options options;
+                    options.isInitialResponse = true;
+                    CursorResponseBuilder firstBatch(result, options);
+                    ResourceConsumption::DocumentUnitCounter docUnitsReturned;
+                    for (const auto& obj : *cachedBatch) {
+                        firstBatch.append(obj);
+                        docUnitsReturned.observeOne(obj.objsize());
+                    }
+
+                    auto curOp = CurOp::get(opCtx);
+                    curOp->debug().nreturned = cachedBatch->size();
+                    curOp->debug().cursorExhausted = true;
+
+                    firstBatch.done(0 /* cursorId */, nss.ns());
+
+                    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
+                    metricsCollector.incrementDocUnitsReturned(docUnitsReturned);
+                    query_request_helper::validateCursorResponse(
+                        result->getBodyBuilder().asTempObj());
+                    return;
+                }
+            } else {
+                resultsCacheGeneration = boost::none;
+            }
+
             // Get the execution plan for the query.
             bool permitYield = true;
             auto exec =
@@ -620,6 +836,7 @@ public:
             std::uint64_t numResults = 0;
             bool stashedResult = false;
             ResourceConsumption::DocumentUnitCounter docUnitsReturned;
+            std::vector<BSONObj> docsForResultsCache;
 
             try {
                 while (!FindCommon::enoughForFirstBatch(originalFC, numResults) &&
@@ -639,6 +856,9 @@ public:
                     firstBatch.append(obj);
                     numResults++;
                     docUnitsReturned.observeOne(obj.objsize());
+                    if (!resultsCacheKey.empty()) {
+                        docsForResultsCache.push_back(obj.getOwned());
+                    }
                 }
             } catch (DBException& exception) {
                 firstBatch.abandon();
@@ -722,6 +942,17 @@ public:
             // Generate the response object to send to the client.
             firstBatch.done(cursorId, nss.ns());
 
+            // Cache the batch if it is the complete response to an eligible query and no write
+            // committed while it was being produced (checked inside add() against the generation
+            // captured before our snapshot was opened).
+            if (!resultsCacheKey.empty() && cursorId == 0 && !stashedResult) {
+                QueryResultsCache::get(opCtx).add(collection->uuid(),
+                                                  nss.ns(),
+                                                  std::move(resultsCacheKey),
+                                                  *resultsCacheGeneration,
+                                                  std::move(docsForResultsCache));
+            }
+
             // Increment this metric once we have generated a response and we know it will return
             // documents.
             auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
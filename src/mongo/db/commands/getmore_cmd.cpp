@@ -50,6 +50,7 @@
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/pipeline/aggregate_command_gen.h"
 #include "mongo/db/pipeline/change_stream_invalidation_info.h"
 #include "mongo/db/query/cursor_response.h"
 #include "mongo/db/query/find.h"
@@ -381,7 +382,10 @@ public:
             // timeout to the user.
             BSONObj obj;
             PlanExecutor::ExecState state;
-            size_t batchSize = cmd.getBatchSize().value_or(0);
+            // A cursor whose originating command opted in to byte-limited batches ignores the
+            // getMore's batchSize; only the response size limit terminates the batch.
+            size_t batchSize =
+                cursor->shouldFillBatchToMaxBytes() ? 0 : cmd.getBatchSize().value_or(0);
             try {
                 while (!FindCommon::enoughForGetMore(batchSize, *numResults) &&
                        PlanExecutor::ADVANCED == (state = exec->getNext(&obj, nullptr))) {
@@ -574,6 +578,14 @@ public:
                 // The readOnce option causes any storage-layer cursors created during plan
                 // execution to assume read data will not be needed again and need not be cached.
                 opCtx->recoveryUnit()->setReadOnce(true);
+            } else if (!cq &&
+                       cursorPin
+                           ->getOriginatingCommand()[AggregateCommandRequest::kReadOnceFieldName]
+                           .trueValue()) {
+                // Aggregation executors carry no CanonicalQuery; recover the option from the
+                // originating command so later batches of a readOnce aggregation are read with
+                // the same cache hint as the first.
+                opCtx->recoveryUnit()->setReadOnce(true);
             }
             exec->reattachToOperationContext(opCtx);
             exec->restoreState(readLock ? &readLock->getCollection() : nullptr);
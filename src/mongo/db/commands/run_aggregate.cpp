@@ -714,6 +714,14 @@ Status runAggregate(OperationContext* opCtx,
     auto curOp = CurOp::get(opCtx);
     auto catalog = CollectionCatalog::get(opCtx);
 
+    if (request.getReadOnce().value_or(false)) {
+        // The readOnce option causes any storage-layer cursors created during plan execution to
+        // assume read data will not be needed again and need not be cached, so a large analytical
+        // pipeline streams through the storage cache instead of evicting other operations'
+        // working set. Set before the storage transaction is opened below.
+        opCtx->recoveryUnit()->setReadOnce(true);
+    }
+
     {
         // If we are in a transaction, check whether the parsed pipeline supports being in
         // a transaction and if the transaction's read concern is supported.
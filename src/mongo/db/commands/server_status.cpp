@@ -31,7 +31,9 @@
 
 #include "mongo/db/commands/server_status.h"
 
+#include "mongo/db/commands/server_status_gen.h"
 #include "mongo/db/commands/server_status_internal.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/util/version.h"
 
@@ -67,4 +69,44 @@ ServerStatusSection::ServerStatusSection(const std::string& sectionName)
     ServerStatusSectionRegistry::get()->addSection(this);
 }
 
+BSONObj ServerStatusSection::_generateSectionMaybeCached(OperationContext* opCtx,
+                                                         const BSONElement& configElement) const {
+    const auto maxAge = Milliseconds(serverStatusCachedSectionMaxAgeMillis.load());
+
+    // Only serve cached results for the plain form of the section request; a richer
+    // configuration element (e.g. an object or a verbosity level) may change the output.
+    const bool plainRequest = configElement.eoo() || configElement.isBoolean() ||
+        (configElement.isNumber() && configElement.numberInt() == 1);
+    if (maxAge == Milliseconds(0) || !supportsCaching() || !plainRequest) {
+        return generateSection(opCtx, configElement);
+    }
+
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+    {
+        stdx::lock_guard<Latch> lk(_cacheMutex);
+        // Serve the cached result while it is fresh, and also while another operation is
+        // already regenerating a stale one, so that only one operation at a time pays the cost
+        // of generating the section.
+        if (!_cachedResult.isEmpty() && (now < _cacheValidUntil || _cacheRefreshInProgress)) {
+            return _cachedResult;
+        }
+        _cacheRefreshInProgress = true;
+    }
+
+    BSONObj fresh;
+    try {
+        fresh = generateSection(opCtx, configElement).getOwned();
+    } catch (...) {
+        stdx::lock_guard<Latch> lk(_cacheMutex);
+        _cacheRefreshInProgress = false;
+        throw;
+    }
+
+    stdx::lock_guard<Latch> lk(_cacheMutex);
+    _cacheRefreshInProgress = false;
+    _cachedResult = fresh;
+    _cacheValidUntil = now + maxAge;
+    return fresh;
+}
+
 }  // namespace mongo
@@ -33,6 +33,8 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/time_support.h"
 #include <string>
 
 namespace mongo {
@@ -64,6 +66,18 @@ public:
      */
     virtual bool includeByDefault() const = 0;
 
+    /**
+     * Sections which are expensive to generate may opt in to result caching by returning true
+     * here. When the 'serverStatusCachedSectionMaxAgeMillis' server parameter is nonzero,
+     * appendSection() serves a previously generated result while it is fresher than that age,
+     * and a single operation at a time regenerates a stale result while concurrent operations
+     * continue to be served the stale copy. Requests with a non-trivial section configuration
+     * element are never served from cache since the configuration may change the output.
+     */
+    virtual bool supportsCaching() const {
+        return false;
+    }
+
     /**
      * Adds the privileges that are required to view this section
      * TODO: Remove this empty default implementation and implement for every section.
@@ -97,14 +111,29 @@ public:
     virtual void appendSection(OperationContext* opCtx,
                                const BSONElement& configElement,
                                BSONObjBuilder* result) const {
-        const auto ret = generateSection(opCtx, configElement);
+        const auto ret = _generateSectionMaybeCached(opCtx, configElement);
         if (ret.isEmpty())
             return;
         result->append(getSectionName(), ret);
     }
 
 private:
+    /**
+     * Calls generateSection(), serving and maintaining the cached result for sections which
+     * support caching when the 'serverStatusCachedSectionMaxAgeMillis' server parameter is
+     * nonzero.
+     */
+    BSONObj _generateSectionMaybeCached(OperationContext* opCtx,
+                                        const BSONElement& configElement) const;
+
     const std::string _sectionName;
+
+    // Cache state for sections which support caching, maintained by
+    // _generateSectionMaybeCached().
+    mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("ServerStatusSection::_cacheMutex");
+    mutable BSONObj _cachedResult;
+    mutable Date_t _cacheValidUntil;
+    mutable bool _cacheRefreshInProgress = false;
 };
 
 /**
@@ -81,7 +81,22 @@ public:
                         "Received voteCommitIndexBuild request",
                         "buildUUID"_attr = cmd.getCommandParameter(),
                         "host"_attr = cmd.getHostAndPort().toString());
-            auto voteStatus = IndexBuildsCoordinator::get(opCtx)->voteCommitIndexBuild(
+
+            auto coordinator = IndexBuildsCoordinator::get(opCtx);
+            if (cmd.getKeysProcessed() || cmd.getPhase()) {
+                coordinator->setMemberIndexBuildProgress(cmd.getCommandParameter(),
+                                                         cmd.getHostAndPort(),
+                                                         cmd.getKeysProcessed(),
+                                                         cmd.getPhase());
+            }
+
+            // A progress-only report is advisory: it carries no vote, needs no persistence and
+            // therefore no majority write concern wait.
+            if (!cmd.getReadyToCommit().value_or(true)) {
+                return;
+            }
+
+            auto voteStatus = coordinator->voteCommitIndexBuild(
                 opCtx, cmd.getCommandParameter(), cmd.getHostAndPort());
 
             // No need to wait for majority write concern if we fail to persist the voter's info.
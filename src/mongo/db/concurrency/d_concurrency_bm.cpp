@@ -29,19 +29,28 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
 
 #include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
 #include <benchmark/benchmark.h>
+#include <boost/optional.hpp>
 
 #include "mongo/base/init.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_test_help.h"
 #include "mongo/db/storage/recovery_unit_noop.h"
+#include "mongo/db/storage/ticketholders.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/ticketholder.h"
 
 namespace mongo {
 namespace {
 
-const int kMaxPerfThreads = 16;  // max number of threads to use for lock perf
+const int kMaxPerfThreads = 32;  // max number of threads to use for lock perf
 
 MONGO_INITIALIZER_GENERAL(DConcurrencyTestServiceContext, ("DConcurrencyTestClientObserver"), ())
 (InitializerContext* context) {
@@ -71,6 +80,73 @@ const ServiceContext::ConstructorActionRegisterer clientObserverRegisterer{
     },
     [](ServiceContext* serviceContext) {}};
 
+/**
+ * Records per-acquisition latencies and reports p50/p95/p99/max as benchmark counters, averaged
+ * across threads. The benchmark framework only reports mean iteration time, which hides the tail
+ * behavior that lock contention regressions typically show up in first.
+ */
+class LatencyRecorder {
+public:
+    LatencyRecorder() {
+        _samples.reserve(kMaxSamples);
+    }
+
+    void startSample() {
+        _start = std::chrono::steady_clock::now();
+    }
+
+    void stopSample() {
+        // Recording stops once the buffer is full; long runs report the percentiles of the first
+        // kMaxSamples acquisitions, which keeps the recorder allocation-free inside the loop.
+        if (_samples.size() < kMaxSamples) {
+            _samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - _start)
+                                   .count());
+        }
+    }
+
+    void report(benchmark::State& state) {
+        if (_samples.empty()) {
+            return;
+        }
+        std::sort(_samples.begin(), _samples.end());
+        auto percentile = [&](double p) {
+            auto idx = std::min(_samples.size() - 1, static_cast<size_t>(p * _samples.size()));
+            return static_cast<double>(_samples[idx]);
+        };
+        using benchmark::Counter;
+        state.counters["p50_ns"] = Counter(percentile(0.50), Counter::kAvgThreads);
+        state.counters["p95_ns"] = Counter(percentile(0.95), Counter::kAvgThreads);
+        state.counters["p99_ns"] = Counter(percentile(0.99), Counter::kAvgThreads);
+        state.counters["max_ns"] = Counter(static_cast<double>(_samples.back()),
+                                           Counter::kAvgThreads);
+    }
+
+private:
+    static constexpr size_t kMaxSamples = 1 << 18;
+
+    std::chrono::steady_clock::time_point _start;
+    std::vector<int64_t> _samples;
+};
+
+/**
+ * Limits the number of concurrent global lock holders while in scope, mimicking the
+ * wiredTigerConcurrentRead/WriteTransactions throttling. Must be constructed and destroyed while
+ * no benchmark thread holds the global lock.
+ */
+class UseGlobalThrottling {
+public:
+    explicit UseGlobalThrottling(int numTickets) {
+        auto& ticketHolders = ticketHoldersDecoration(getGlobalServiceContext());
+        ticketHolders.setGlobalThrottling(std::make_unique<SemaphoreTicketHolder>(numTickets),
+                                          std::make_unique<SemaphoreTicketHolder>(numTickets));
+    }
+    ~UseGlobalThrottling() {
+        auto& ticketHolders = ticketHoldersDecoration(getGlobalServiceContext());
+        ticketHolders.setGlobalThrottling(nullptr, nullptr);
+    }
+};
+
 class DConcurrencyTest : public benchmark::Fixture {
 public:
     /**
@@ -91,6 +167,7 @@ protected:
     std::vector<std::pair<ServiceContext::UniqueClient, ServiceContext::UniqueOperationContext>>
         clients;
     std::array<LockerImpl, kMaxPerfThreads> locker;
+    boost::optional<UseGlobalThrottling> throttle;
 };
 
 BENCHMARK_DEFINE_F(DConcurrencyTest, BM_StdMutex)(benchmark::State& state) {
@@ -181,6 +258,133 @@ BENCHMARK_DEFINE_F(DConcurrencyTest, BM_CollectionExclusiveLock)(benchmark::Stat
     }
 }
 
+// Mixed intent workload over a single collection: a configurable percentage of the threads (arg 0)
+// act as writers taking DBLock IX + CollectionLock IX, the rest as readers taking IS + IS. This is
+// the shape of a typical CRUD workload, where all modes are compatible and throughput is bounded
+// by the lock manager itself rather than by conflicts.
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_MixedIntentLockWorkload)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+    const bool isWriter = state.thread_index * 100 < state.range(0) * state.threads;
+
+    LatencyRecorder latency;
+    for (auto keepRunning : state) {
+        latency.startSample();
+        auto opCtx = clients[state.thread_index].second.get();
+        if (isWriter) {
+            Lock::DBLock dlk(opCtx, "test", MODE_IX);
+            Lock::CollectionLock clk(opCtx, NamespaceString("test.coll"), MODE_IX);
+        } else {
+            Lock::DBLock dlk(opCtx, "test", MODE_IS);
+            Lock::CollectionLock clk(opCtx, NamespaceString("test.coll"), MODE_IS);
+        }
+        latency.stopSample();
+    }
+    latency.report(state);
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+// Like the mixed intent workload, but writers take CollectionLock X, so every write conflicts with
+// all concurrent readers of the collection. Measures conflict queueing and the latency tail the
+// readers see behind an exclusive writer.
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_MixedExclusiveWriterWorkload)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+    const bool isWriter = state.thread_index * 100 < state.range(0) * state.threads;
+
+    LatencyRecorder latency;
+    for (auto keepRunning : state) {
+        latency.startSample();
+        auto opCtx = clients[state.thread_index].second.get();
+        if (isWriter) {
+            Lock::DBLock dlk(opCtx, "test", MODE_IX);
+            Lock::CollectionLock clk(opCtx, NamespaceString("test.coll"), MODE_X);
+        } else {
+            Lock::DBLock dlk(opCtx, "test", MODE_IS);
+            Lock::CollectionLock clk(opCtx, NamespaceString("test.coll"), MODE_S);
+        }
+        latency.stopSample();
+    }
+    latency.report(state);
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+// Each thread locks its own database and collection, so apart from the global lock no resource is
+// shared and acquisitions spread across the lock manager's partitions. Comparing against
+// BM_CollectionIntentExclusiveLock (all threads on one LockHead) isolates the cost of partition
+// occupancy from the cost of queueing on a shared resource.
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_DistinctCollectionIntentLocks)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+    const std::string dbName = str::stream() << "test" << state.thread_index;
+    const NamespaceString nss(dbName + ".coll");
+
+    for (auto keepRunning : state) {
+        auto opCtx = clients[state.thread_index].second.get();
+        Lock::DBLock dlk(opCtx, dbName, MODE_IX);
+        Lock::CollectionLock clk(opCtx, nss, MODE_IX);
+    }
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+// Global lock acquisition with ticket-based admission enabled, with the number of tickets as
+// arg 0. With fewer tickets than threads, acquisitions queue in the ticket holder before ever
+// reaching the lock manager; the latency percentiles show the admission wait.
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_GlobalIntentLockTicketed)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+        throttle.emplace(state.range(0));
+    }
+
+    LatencyRecorder latency;
+    for (auto keepRunning : state) {
+        latency.startSample();
+        Lock::GlobalLock lk(clients[state.thread_index].second.get(), MODE_IX);
+        latency.stopSample();
+    }
+    latency.report(state);
+
+    if (state.thread_index == 0) {
+        throttle.reset();
+        clients.clear();
+    }
+}
+
+// All threads repeatedly take the replication state transition lock in intent mode, queueing on
+// the single RSTL LockHead exactly as every operation's GlobalLock does. A regression here shows
+// up as stepdown stalls and operation latency spikes in production.
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_RSTLIntentLock)(benchmark::State& state) {
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+    }
+
+    LatencyRecorder latency;
+    for (auto keepRunning : state) {
+        latency.startSample();
+        auto opCtx = clients[state.thread_index].second.get();
+        Lock::ResourceLock rstl(
+            opCtx, opCtx->lockState(), resourceIdReplicationStateTransitionLock, MODE_IX);
+        latency.stopSample();
+    }
+    latency.report(state);
+
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_StdMutex)->ThreadRange(1, kMaxPerfThreads);
 
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_ResourceMutexShared)->ThreadRange(1, kMaxPerfThreads);
@@ -194,5 +398,27 @@ BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionIntentExclusiveLock)
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionSharedLock)->ThreadRange(1, kMaxPerfThreads);
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionExclusiveLock)->ThreadRange(1, kMaxPerfThreads);
 
+// Arg 0 is the percentage of threads acting as writers.
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_MixedIntentLockWorkload)
+    ->Args({5})
+    ->Args({25})
+    ->Args({50})
+    ->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_MixedExclusiveWriterWorkload)
+    ->Args({5})
+    ->Args({25})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_DistinctCollectionIntentLocks)
+    ->ThreadRange(1, kMaxPerfThreads);
+
+// Arg 0 is the number of read and write tickets.
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_GlobalIntentLockTicketed)
+    ->Args({4})
+    ->Args({128})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_RSTLIntentLock)->ThreadRange(1, kMaxPerfThreads);
+
 }  // namespace
 }  // namespace mongo
@@ -98,10 +98,17 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
     }
 
     LOGV2_DEBUG(20519, 4, "Taking ticket.", "Available"_attr = _tickets);
-    if (_tickets == 0) {
-        ++stats->acquireWaitCount;
+    if (_tickets > 0) {
+        // There is nothing to wait for; avoid reading the clock on the common path. The wait
+        // accounting below would only record the overhead of its own clock reads.
+        opCtx->checkForInterrupt();
+        ++stats->ticketsAcquired;
+        --_tickets;
+        return;
     }
 
+    ++stats->acquireWaitCount;
+
     auto currentWaitTime = curTimeMicros64();
     auto updateTotalTime = [&]() {
         auto oldWaitTime = std::exchange(currentWaitTime, curTimeMicros64());
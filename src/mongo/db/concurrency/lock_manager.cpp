@@ -48,6 +48,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 #include "mongo/util/timer.h"
 
@@ -416,9 +417,21 @@ void LockHead::migratePartitionedLockHeads() {
 // Have more buckets than CPUs to reduce contention on lock and caches
 const unsigned LockManager::_numLockBuckets(128);
 
-// Balance scalability of intent locks against potential added cost of conflicting locks.
-// The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+namespace {
+
+// Balance scalability of intent locks against potential added cost of conflicting locks. Sized to
+// at least the number of CPU cores so that concurrently running threads mostly map to distinct
+// partitions and intent-mode acquisitions do not serialize on a shared partition mutex. Rounded up
+// to a power of two; the exact value beyond that doesn't appear very important.
+unsigned numPartitions() {
+    unsigned partitions = 32;
+    while (partitions < ProcessInfo::getNumAvailableCores()) {
+        partitions *= 2;
+    }
+    return partitions;
+}
+
+}  // namespace
 
 // static
 LockManager* LockManager::get(ServiceContext* service) {
@@ -462,7 +475,7 @@ std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serv
     return lockToClientMap;
 }
 
-LockManager::LockManager() {
+LockManager::LockManager() : _numPartitions(numPartitions()) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
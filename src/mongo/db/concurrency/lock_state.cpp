@@ -40,12 +40,14 @@
 #include "mongo/db/concurrency/flow_control_ticketholder.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/execution_resource_groups.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/db/storage/ticketholders.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/new.h"
 #include "mongo/util/background.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/fail_point.h"
@@ -350,11 +352,14 @@ void LockerImpl::reacquireTicket(OperationContext* opCtx) {
     if (!_maxLockTimeout || _uninterruptibleLocksRequested) {
         invariant(_acquireTicket(opCtx, _modeForTicket, Date_t::max()));
     } else {
+        // The coarse-grained fast clock is precise enough for the ticket timeout and avoids a
+        // clock read on every ticket reacquisition.
+        auto now = getGlobalServiceContext()->getFastClockSource()->now();
         uassert(ErrorCodes::LockTimeout,
                 str::stream() << "Unable to acquire ticket with mode '" << _modeForTicket
                               << "' within a max lock request timeout of '" << *_maxLockTimeout
                               << "' milliseconds.",
-                _acquireTicket(opCtx, _modeForTicket, Date_t::now() + *_maxLockTimeout));
+                _acquireTicket(opCtx, _modeForTicket, now + *_maxLockTimeout));
     }
 }
 
@@ -375,12 +380,34 @@ bool LockerImpl::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t d
             invariant(!opCtx->recoveryUnit()->isTimestamped());
 
         OperationContext* interruptible = _uninterruptibleLocksRequested ? nullptr : opCtx;
+
+        // If the client belongs to an execution resource group, queue against the group's ticket
+        // cap first so that a group at its limit waits without occupying one of the global
+        // tickets.
+        std::shared_ptr<ExecutionResourceGroup> group;
+        if (opCtx) {
+            group = ExecutionResourceGroups::get().lookupForClient(opCtx->getClient());
+        }
+        if (group) {
+            if (deadline == Date_t::max()) {
+                group->ticketHolder()->waitForTicket(interruptible);
+            } else if (!group->ticketHolder()->waitForTicketUntil(interruptible, deadline)) {
+                return false;
+            }
+        }
+        ScopeGuard releaseGroupTicketOnErrorGuard([&] {
+            if (group)
+                group->ticketHolder()->release();
+        });
+
         if (deadline == Date_t::max()) {
             holder->waitForTicket(interruptible);
         } else if (!holder->waitForTicketUntil(interruptible, deadline)) {
             return false;
         }
+        releaseGroupTicketOnErrorGuard.dismiss();
         restoreStateOnErrorGuard.dismiss();
+        _resourceGroup = std::move(group);
     }
     _clientState.store(reader ? kActiveReader : kActiveWriter);
     return true;
@@ -393,13 +420,17 @@ void LockerImpl::lockGlobal(OperationContext* opCtx, LockMode mode, Date_t deadl
             // Ignore deadline and _maxLockTimeout.
             invariant(_acquireTicket(opCtx, mode, Date_t::max()));
         } else {
-            auto beforeAcquire = Date_t::now();
+            // This runs on every operation's first global lock acquisition, so read the
+            // coarse-grained fast clock (a single atomic load) rather than the system clock. The
+            // ticket timeout bookkeeping does not need better than the fast clock's granularity.
+            auto clockSource = getGlobalServiceContext()->getFastClockSource();
+            auto beforeAcquire = clockSource->now();
             deadline = std::min(deadline,
                                 _maxLockTimeout ? beforeAcquire + *_maxLockTimeout : Date_t::max());
             uassert(ErrorCodes::LockTimeout,
                     str::stream() << "Unable to acquire ticket with mode '" << mode
                                   << "' within a max lock request timeout of '"
-                                  << Date_t::now() - beforeAcquire << "' milliseconds.",
+                                  << clockSource->now() - beforeAcquire << "' milliseconds.",
                     _acquireTicket(opCtx, mode, deadline));
         }
         _modeForTicket = mode;
@@ -1075,6 +1106,10 @@ void LockerImpl::_releaseTicket() {
     if (holder) {
         holder->release();
     }
+    if (_resourceGroup) {
+        _resourceGroup->ticketHolder()->release();
+        _resourceGroup.reset();
+    }
     _clientState.store(kInactive);
 }
 
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <memory>
 #include <queue>
 
 #include "mongo/db/concurrency/fast_map_noalloc.h"
@@ -40,6 +41,8 @@
 
 namespace mongo {
 
+class ExecutionResourceGroup;
+
 /**
  * Notfication callback, which stores the last notification result and signals a condition
  * variable, which can be waited on.
@@ -358,6 +361,11 @@ private:
     // Mode for which the Locker acquired a ticket, or MODE_NONE if no ticket was acquired.
     LockMode _modeForTicket = MODE_NONE;
 
+    // The execution resource group the held ticket is also accounted against, if the operation's
+    // client is assigned to one. Held as a shared_ptr so the group's ticket can be returned even
+    // if the group is dropped from the configuration in the meantime.
+    std::shared_ptr<ExecutionResourceGroup> _resourceGroup;
+
     // Indicates whether the client is active reader/writer or is queued.
     AtomicWord<ClientState> _clientState{kInactive};
 
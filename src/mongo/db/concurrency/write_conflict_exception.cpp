@@ -30,6 +30,14 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
 
 #include "mongo/db/concurrency/write_conflict_exception.h"
+
+#include <array>
+
+#include "mongo/base/simple_string_data_comparator.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/log_and_backoff.h"
 #include "mongo/util/stacktrace.h"
 
@@ -65,4 +73,97 @@ void WriteConflictException::logAndBackoff(int attempt, StringData operation, St
                          "operation"_attr = operation,
                          logAttrs(NamespaceString(ns)));
 }
+
+namespace write_conflict_detail {
+namespace {
+
+/**
+ * Threads retrying after a WriteConflictException park here, partitioned by a hash of the
+ * namespace, so that a writer completing on the same namespace can hand execution to exactly one
+ * of them. Waking one waiter per completed write drains contended retries in an orderly queue
+ * instead of letting every backed-off thread replay its operation at once.
+ */
+class ContentionTable {
+public:
+    void await(StringData ns, Milliseconds maxWait) {
+        auto& partition = _partitionFor(ns);
+        stdx::unique_lock<Latch> lk(partition.mutex);
+        partition.waiters.fetchAndAdd(1);
+        const auto target = partition.notifications + 1;
+        partition.cv.wait_for(
+            lk, maxWait.toSystemDuration(), [&] { return partition.notifications >= target; });
+        partition.waiters.fetchAndSubtract(1);
+    }
+
+    void notifyOne(StringData ns) {
+        auto& partition = _partitionFor(ns);
+        if (partition.waiters.loadRelaxed() == 0) {
+            return;
+        }
+        {
+            stdx::lock_guard<Latch> lk(partition.mutex);
+            ++partition.notifications;
+        }
+        partition.cv.notify_one();
+    }
+
+private:
+    struct Partition {
+        Mutex mutex = MONGO_MAKE_LATCH("ContentionTable::Partition::mutex");
+        stdx::condition_variable cv;
+
+        // Read without the mutex on the notify fast path; modified under the mutex.
+        AtomicWord<int> waiters{0};
+
+        // Guarded by 'mutex'. Counts hand-offs so a waiter can tell a wake-up meant for it apart
+        // from a spurious one.
+        uint64_t notifications = 0;
+    };
+
+    Partition& _partitionFor(StringData ns) {
+        return _partitions[SimpleStringDataComparator::kInstance.hash(ns) % kNumPartitions];
+    }
+
+    static constexpr size_t kNumPartitions = 64;
+    std::array<Partition, kNumPartitions> _partitions;
+};
+
+ContentionTable contentionTable;
+
+/**
+ * The same schedule the exponential backoff in logAndBackoff() uses; serves as the upper bound on
+ * how long a parked thread waits for a hand-off before retrying anyway.
+ */
+Milliseconds maxWaitFor(size_t attempt) {
+    if (attempt < 4) {
+        return Milliseconds(0);
+    } else if (attempt < 10) {
+        return Milliseconds(1);
+    } else if (attempt < 100) {
+        return Milliseconds(5);
+    } else if (attempt < 200) {
+        return Milliseconds(10);
+    }
+    return Milliseconds(100);
+}
+
+}  // namespace
+
+void logAndWaitForRetry(size_t attempt, StringData operation, StringData ns) {
+    LOGV2_DEBUG(6650021,
+                1,
+                "Caught WriteConflictException",
+                "operation"_attr = operation,
+                logAttrs(NamespaceString(ns)),
+                "attempt"_attr = attempt);
+    if (const auto maxWait = maxWaitFor(attempt); maxWait > Milliseconds(0)) {
+        contentionTable.await(ns, maxWait);
+    }
+}
+
+void notifyWaitersOnCommit(StringData ns) {
+    contentionTable.notifyOne(ns);
+}
+
+}  // namespace write_conflict_detail
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <exception>
+#include <type_traits>
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/concurrency/temporarily_unavailable_exception.h"
@@ -69,10 +70,32 @@ private:
     void defineOnlyInFinalSubclassToPreventSlicing() final {}
 };
 
+namespace write_conflict_detail {
+
+/**
+ * Logs the write conflict and then, once the cheap immediate retries are exhausted, parks the
+ * thread on a namespace-keyed wait queue rather than sleeping blind. A committing writer on the
+ * same namespace wakes exactly one parked thread via notifyWaitersOnCommit(), so contended
+ * retries drain in an orderly queue instead of all replaying at once. The wait never exceeds the
+ * sleep the old exponential backoff would have imposed for the same attempt number.
+ */
+void logAndWaitForRetry(size_t attempt, StringData operation, StringData ns);
+
+/**
+ * Hands execution to one thread backed off after a write conflict on 'ns', if any. Cheap (one
+ * relaxed atomic load) when nobody is waiting.
+ */
+void notifyWaitersOnCommit(StringData ns);
+
+}  // namespace write_conflict_detail
+
 /**
  * Runs the argument function f as many times as needed for f to complete or throw an exception
  * other than WriteConflictException or TemporarilyUnavailableException. For each time f throws an
- * one of these exceptions, logs the error, waits a spell, cleans up, and then tries f again.
+ * one of these exceptions, logs the error, waits a spell, cleans up, and then tries f again. The
+ * wait is contention-aware: once the cheap immediate retries are exhausted, the thread parks on a
+ * namespace-keyed queue and is woken as soon as another writer on the namespace completes, rather
+ * than sleeping for the full backoff interval.
  * Imposes no upper limit on the number of times to re-try f after a WriteConflictException, so any
  * required timeout behavior must be enforced within f. When retrying a
  * TemporarilyUnavailableException, f is called a finite number of times before we eventually let
@@ -110,15 +133,25 @@ auto writeConflictRetry(OperationContext* opCtx, StringData opStr, StringData ns
     // ExceptionFor<ErrorCodes::WriteConflict>
     while (true) {
         try {
-            return f();
+            // Completing f() means this operation's writes (if any) have committed, so hand
+            // execution to one thread that backed off after conflicting on this namespace.
+            if constexpr (std::is_void_v<std::invoke_result_t<F>>) {
+                f();
+                write_conflict_detail::notifyWaitersOnCommit(ns);
+                return;
+            } else {
+                auto result = f();
+                write_conflict_detail::notifyWaitersOnCommit(ns);
+                return result;
+            }
         } catch (WriteConflictException const&) {
             CurOp::get(opCtx)->debug().additiveMetrics.incrementWriteConflicts(1);
-            WriteConflictException::logAndBackoff(attempts, opStr, ns);
+            write_conflict_detail::logAndWaitForRetry(attempts, opStr, ns);
             ++attempts;
             opCtx->recoveryUnit()->abandonSnapshot();
         } catch (ExceptionFor<ErrorCodes::WriteConflict> const&) {
             CurOp::get(opCtx)->debug().additiveMetrics.incrementWriteConflicts(1);
-            WriteConflictException::logAndBackoff(attempts, opStr, ns);
+            write_conflict_detail::logAndWaitForRetry(attempts, opStr, ns);
             ++attempts;
             opCtx->recoveryUnit()->abandonSnapshot();
         } catch (TemporarilyUnavailableException const& e) {
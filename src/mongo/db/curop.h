@@ -39,6 +39,7 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/cursor_id.h"
+#include "mongo/db/op_cycle_segments.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/profile_filter.h"
 #include "mongo/db/server_options.h"
@@ -445,6 +446,15 @@ public:
         return _debug;
     }
 
+    /**
+     * Returns the per-segment cycle accounting for this operation, updated by the service entry
+     * point at fixed hot-path boundaries. A no-op unless the build enables
+     * MONGO_CONFIG_OP_SEGMENT_PROFILING.
+     */
+    OpCycleSegments& cycleSegments() {
+        return _cycleSegments;
+    }
+
     /**
      * Gets the name of the namespace on which the current operation operates.
      */
@@ -868,6 +878,8 @@ private:
 
     UserAcquisitionStats _userAcquisitionStats;
 
+    OpCycleSegments _cycleSegments;
+
     TickSource* _tickSource = nullptr;
 };
 
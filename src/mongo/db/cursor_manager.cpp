@@ -58,6 +58,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/platform/random.h"
 #include "mongo/util/exit.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -211,25 +212,43 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
     CursorId id,
     const std::function<void(const ClientCursor&)>& checkPinAllowed,
     AuthCheck checkSessionAuth) {
-    auto lockedPartition = _cursorMap->lockOnePartition(id);
-    auto it = lockedPartition->find(id);
-    if (it == lockedPartition->end()) {
-        return {ErrorCodes::CursorNotFound, str::stream() << "cursor id " << id << " not found"};
-    }
+    ClientCursor* cursor;
+    {
+        auto lockedPartition = _cursorMap->lockOnePartition(id);
+        auto it = lockedPartition->find(id);
+        if (it == lockedPartition->end()) {
+            return {ErrorCodes::CursorNotFound,
+                    str::stream() << "cursor id " << id << " not found"};
+        }
 
-    ClientCursor* cursor = it->second;
-    uassert(ErrorCodes::CursorInUse,
-            str::stream() << "cursor id " << id << " is already in use",
-            !cursor->_operationUsingCursor);
-    if (cursor->getExecutor()->isMarkedAsKilled()) {
-        // This cursor was killed while it was idle.
-        Status error = cursor->getExecutor()->getKillStatus();
-        deregisterAndDestroyCursor(std::move(lockedPartition),
-                                   opCtx,
-                                   std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
-        return error;
+        cursor = it->second;
+        uassert(ErrorCodes::CursorInUse,
+                str::stream() << "cursor id " << id << " is already in use",
+                !cursor->_operationUsingCursor);
+        if (cursor->getExecutor()->isMarkedAsKilled()) {
+            // This cursor was killed while it was idle.
+            Status error = cursor->getExecutor()->getKillStatus();
+            deregisterAndDestroyCursor(
+                std::move(lockedPartition),
+                opCtx,
+                std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
+            return error;
+        }
+
+        // Claiming the cursor is the only state transition that requires the partition lock. Once
+        // the cursor is claimed, the kill and timeout paths will not destroy it out from under us
+        // (killCursor() interrupts the claiming operation instead), so the remaining per-pin checks
+        // can run without serializing other operations on this partition.
+        cursor->_operationUsingCursor = opCtx;
     }
 
+    // If any of the checks below fail, release the claim so the cursor is left in the same state
+    // as it was before the unsuccessful call.
+    ScopeGuard releaseClaim([&] {
+        auto lockedPartition = _cursorMap->lockOnePartition(id);
+        cursor->_operationUsingCursor = nullptr;
+    });
+
     if (checkSessionAuth == kCheckSession) {
         auto cursorPrivilegeStatus = checkCursorSessionPrivilege(opCtx, cursor->getSessionId());
         if (!cursorPrivilegeStatus.isOK()) {
@@ -245,8 +264,6 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
     CurOp::get(opCtx)->debug().queryHash = cursor->_queryHash;
     CurOp::get(opCtx)->debug().planCacheKey = cursor->_planCacheKey;
 
-    cursor->_operationUsingCursor = opCtx;
-
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
     if (cursor->getSessionId()) {
@@ -257,6 +274,7 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
         }
     }
 
+    releaseClaim.dismiss();
     auto pin = ClientCursorPin(opCtx, cursor, this);
     pin.unstashResourcesOntoOperationContext();
     return StatusWith(std::move(pin));
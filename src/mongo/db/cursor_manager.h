@@ -113,9 +113,11 @@ public:
      * ErrorCodes::QueryPlanKilled if the cursor was killed in between uses.
      *
      * 'checkPinAllowed' is a function which gives the caller the option to make checks about the
-     * cursor before it is pinned. If 'checkPinAllowed' throws an exception, pinCursor() will
-     * also throw and the cursor will be left in the cursor manager in the same state as it was
-     * before the unsuccessful call to pinCursor().
+     * cursor before the pin is returned. If 'checkPinAllowed' throws an exception, pinCursor()
+     * will also throw and the cursor will be left in the cursor manager in the same state as it
+     * was before the unsuccessful call to pinCursor(). While 'checkPinAllowed' runs, concurrent
+     * attempts to pin the same cursor fail with CursorInUse, just as they would after a
+     * successful pin.
      *
      * If 'checkSessionAuth' is 'kCheckSession' or left unspecified, this function also checks if
      * the current session in the specified 'opCtx' has privilege to access the cursor specified by
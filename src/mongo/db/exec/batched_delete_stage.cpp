@@ -129,9 +129,6 @@ BatchedDeleteStage::BatchedDeleteStage(ExpressionContext* expCtx,
     tassert(6303800,
             "batched deletions only support multi-document deletions (multi: true)",
             _params->isMulti);
-    tassert(6303801,
-            "batched deletions do not support the 'fromMigrate' parameter",
-            !_params->fromMigrate);
     tassert(6303802,
             "batched deletions do not support the 'returnDelete' parameter",
             !_params->returnDeleted);
@@ -152,7 +149,8 @@ BatchedDeleteStage::BatchedDeleteStage(ExpressionContext* expCtx,
     tassert(6303807,
             "batch size parameters must be greater than or equal to zero",
             _batchParams->targetBatchBytes >= 0 && _batchParams->targetBatchDocs >= 0 &&
-                _batchParams->targetBatchTimeMS >= Milliseconds(0));
+                _batchParams->targetBatchTimeMS >= Milliseconds(0) &&
+                _batchParams->targetPassDocs >= 0);
 }
 
 BatchedDeleteStage::~BatchedDeleteStage() {}
@@ -174,8 +172,10 @@ PlanStage::StageState BatchedDeleteStage::_deleteBatch(WorkingSetID* out) {
 
     try {
         // Start a WUOW with 'groupOplogEntries' which groups a delete batch into a single timestamp
-        // and oplog entry
-        WriteUnitOfWork wuow(opCtx(), true /* groupOplogEntries */);
+        // and oplog entry. 'fromMigrate' deletes keep one oplog entry per document, since the
+        // grouped applyOps format does not carry the fromMigrate flag; they still commit as a
+        // single storage transaction.
+        WriteUnitOfWork wuow(opCtx(), !_params->fromMigrate /* groupOplogEntries */);
         for (; batchIdx < _stagedDeletesBuffer.size(); ++batchIdx) {
             if (MONGO_unlikely(throwWriteConflictExceptionInBatchedDeleteStage.shouldFail())) {
                 throw WriteConflictException();
@@ -225,6 +225,11 @@ PlanStage::StageState BatchedDeleteStage::_deleteBatch(WorkingSetID* out) {
     // TODO (SERVER-63039): report batch size
     _specificStats.docsDeleted += docsDeleted;
 
+    if (_batchParams->targetPassDocs != 0 &&
+        _specificStats.docsDeleted >= _batchParams->targetPassDocs) {
+        _passTargetMet = true;
+    }
+
     if (batchIdx < _stagedDeletesBuffer.size() - 1) {
         // _stagedDeletesBuffer[batchIdx] is the last document evaluated in this batch - and it is
         // not the last element in the buffer. targetBatchTimeMS was exceeded. Remove all records
@@ -248,6 +253,10 @@ PlanStage::StageState BatchedDeleteStage::_deleteBatch(WorkingSetID* out) {
 
 PlanStage::StageState BatchedDeleteStage::doWork(WorkingSetID* out) {
     if (!_drainRemainingBuffer) {
+        if (_passTargetMet) {
+            return PlanStage::IS_EOF;
+        }
+
         WorkingSetID id;
         auto status = child()->work(&id);
 
@@ -54,6 +54,10 @@ struct BatchedDeleteStageBatchParams {
     long long targetBatchDocs = 0;
     // A batch is committed as soon as this target execution time is met. Zero means unlimited.
     Milliseconds targetBatchTimeMS = Milliseconds(0);
+    // The stage reports EOF once this many documents have been deleted in total, permitting
+    // callers to re-evaluate between passes while still committing deletes in batches. A value of
+    // zero means unlimited.
+    long long targetPassDocs = 0;
 };
 
 /**
@@ -118,6 +122,10 @@ private:
     // be drained before fetching more documents.
     bool _drainRemainingBuffer = false;
 
+    // Whether 'targetPassDocs' has been reached, in which case the stage stops fetching documents
+    // and reports EOF once the buffer is drained.
+    bool _passTargetMet = false;
+
     // Batch targeting parameters.
     std::unique_ptr<BatchedDeleteStageBatchParams> _batchParams;
 };
@@ -0,0 +1,298 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/batched_update_stage.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/exec/scoped_timer.h"
+#include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/exec/write_stage_common.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+
+MONGO_FAIL_POINT_DEFINE(throwWriteConflictExceptionInBatchedUpdateStage);
+
+namespace {
+void incrementSSSMetricNoOverflow(AtomicWord<long long>& metric, long long value) {
+    const int64_t MAX = 1ULL << 60;
+
+    if (metric.loadRelaxed() > MAX) {
+        metric.store(value);
+    } else {
+        metric.fetchAndAdd(value);
+    }
+}
+}  // namespace
+
+/**
+ * Reports globally-aggregated batch stats.
+ */
+struct BatchedUpdatesSSS : ServerStatusSection {
+    BatchedUpdatesSSS()
+        : ServerStatusSection("batchedUpdates"), batches(0), docs(0), timeMillis(0) {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        bob.appendNumber("batches", batches.loadRelaxed());
+        bob.appendNumber("docs", docs.loadRelaxed());
+        bob.append("timeMillis", timeMillis.loadRelaxed());
+
+        return bob.obj();
+    }
+
+    AtomicWord<long long> batches;
+    AtomicWord<long long> docs;
+    AtomicWord<long long> timeMillis;
+} batchedUpdatesSSS;
+
+
+BatchedUpdateStage::BatchedUpdateStage(ExpressionContext* expCtx,
+                                       const UpdateStageParams& params,
+                                       std::unique_ptr<BatchedUpdateStageBatchParams> batchParams,
+                                       WorkingSet* ws,
+                                       const CollectionPtr& collection,
+                                       PlanStage* child)
+    : UpdateStage::UpdateStage(expCtx, params, ws, collection, child),
+      _batchParams(std::move(batchParams)) {
+    tassert(6929900,
+            "batched updates only support multi-document updates (multi: true)",
+            _params.request->isMulti());
+    tassert(6929901,
+            "batched updates do not support returning the pre- or post-image",
+            !_params.request->shouldReturnAnyDocs());
+    tassert(6929902,
+            "batched updates do not support the 'sort' parameter",
+            _params.request->getSort().isEmpty());
+    tassert(6929903,
+            "batched updates do not support the 'numStatsForDoc' parameter",
+            !_params.numStatsForDoc);
+    tassert(6929904,
+            "batch size cannot be unbounded; you must specify at least one of the following batch "
+            "parameters: 'targetBatchDocs', 'targetBatchTimeMS'",
+            _batchParams->targetBatchDocs || _batchParams->targetBatchTimeMS != Milliseconds(0));
+    tassert(6929905,
+            "batch size parameters must be greater than or equal to zero",
+            _batchParams->targetBatchDocs >= 0 &&
+                _batchParams->targetBatchTimeMS >= Milliseconds(0));
+}
+
+BatchedUpdateStage::~BatchedUpdateStage() {}
+
+PlanStage::StageState BatchedUpdateStage::_updateBatch(WorkingSetID* out) {
+    tassert(6929906, "Expected documents for batched update", _stagedUpdatesBuffer.size() != 0);
+    try {
+        child()->saveState();
+    } catch (const WriteConflictException&) {
+        std::terminate();
+    }
+
+    std::set<RecordId> recordsThatNoLongerMatch;
+    Timer batchTimer(opCtx()->getServiceContext()->getTickSource());
+
+    unsigned int docsUpdated = 0;
+    unsigned int batchIdx = 0;
+
+    try {
+        // Start a WUOW with 'groupOplogEntries' which groups an update batch into a single
+        // timestamp and oplog entry.
+        WriteUnitOfWork wuow(opCtx(), true /* groupOplogEntries */);
+        for (; batchIdx < _stagedUpdatesBuffer.size(); ++batchIdx) {
+            if (MONGO_unlikely(throwWriteConflictExceptionInBatchedUpdateStage.shouldFail())) {
+                throw WriteConflictException();
+            }
+
+            auto& stagedDocument = _stagedUpdatesBuffer.at(batchIdx);
+
+            // The document is always re-fetched under the current snapshot, since the WSM the
+            // document was staged from has been freed. The PlanExecutor YieldPolicy may have
+            // changed snapshots since the document was staged, in which case the document must
+            // also be re-checked against the query.
+            Snapshotted<BSONObj> docData;
+            const bool docExists = collection()->findDoc(opCtx(), stagedDocument.rid, &docData);
+            const bool docStillMatches = docExists &&
+                (docData.snapshotId() == stagedDocument.snapshotId || !_params.canonicalQuery ||
+                 _params.canonicalQuery->root()->matchesBSON(docData.value(), nullptr));
+
+            if (docStillMatches) {
+                transformAndUpdate(docData, stagedDocument.rid, false /* writeToOrphan */);
+                _specificStats.nMatched++;
+                docsUpdated++;
+            } else {
+                recordsThatNoLongerMatch.insert(stagedDocument.rid);
+            }
+
+            const Milliseconds elapsedMillis(batchTimer.millis());
+            if (_batchParams->targetBatchTimeMS != Milliseconds(0) &&
+                elapsedMillis >= _batchParams->targetBatchTimeMS) {
+                // Met targetBatchTimeMS after evaluating _stagedUpdatesBuffer[batchIdx].
+                break;
+            }
+        }
+
+        wuow.commit();
+    } catch (const WriteConflictException&) {
+        return _prepareToRetryDrainAfterWCE(out, recordsThatNoLongerMatch);
+    }
+
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.docs, docsUpdated);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.batches, 1);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.timeMillis, batchTimer.millis());
+
+    if (batchIdx < _stagedUpdatesBuffer.size() - 1) {
+        // _stagedUpdatesBuffer[batchIdx] is the last document evaluated in this batch - and it is
+        // not the last element in the buffer. targetBatchTimeMS was exceeded. Remove all records
+        // that have been evaluated (updated or skipped because they no longer match the query)
+        // from the buffer before retrying.
+        _stagedUpdatesBuffer.erase(_stagedUpdatesBuffer.begin(),
+                                   _stagedUpdatesBuffer.begin() + batchIdx + 1);
+
+        _drainRemainingBuffer = true;
+        return _tryRestoreState(out);
+    }
+
+    // The elements in the buffer are preserved during document updates so updates can be retried
+    // in case of a write conflict. No write conflict occurred, update the buffer that all
+    // documents are updated.
+    _stagedUpdatesBuffer.clear();
+    _drainRemainingBuffer = false;
+
+    return _tryRestoreState(out);
+}
+
+PlanStage::StageState BatchedUpdateStage::doWork(WorkingSetID* out) {
+    if (!_drainRemainingBuffer) {
+        WorkingSetID id;
+        auto status = child()->work(&id);
+
+        switch (status) {
+            case PlanStage::ADVANCED:
+                break;
+
+            case PlanStage::NEED_TIME:
+                return status;
+
+            case PlanStage::NEED_YIELD:
+                *out = id;
+                return status;
+
+            case PlanStage::IS_EOF:
+                if (!_stagedUpdatesBuffer.empty()) {
+                    // Drain the outstanding updates.
+                    auto ret = _updateBatch(out);
+                    if (ret != NEED_TIME || (ret == NEED_TIME && _drainRemainingBuffer == true)) {
+                        // Only return NEED_TIME if there is more to drain in the buffer.
+                        // Otherwise, there is no more to fetch and NEED_TIME signals all documents
+                        // have been successfully updated.
+                        return ret;
+                    }
+                }
+                return status;
+
+            default:
+                MONGO_UNREACHABLE;
+        }
+
+        WorkingSetMember* member = _ws->get(id);
+
+        // Free the WSM at the end of this scope. Retries will re-fetch by the RecordId and will
+        // not need to keep the WSM around.
+        ScopeGuard memberFreer([&] { _ws->free(id); });
+
+        invariant(member->hasRecordId());
+        RecordId recordId = member->recordId;
+
+        // Updates can't have projections. This means that covering analysis will always add
+        // a fetch. We should always get fetched data, and never just key data.
+        invariant(member->hasObj());
+
+        // Found a RecordId that refers to a document we had already updated. Note that we can
+        // never remove from _updatedRecordIds because updates by other clients could cause us to
+        // encounter a document again later.
+        if (_updatedRecordIds && _updatedRecordIds->count(recordId) > 0) {
+            return PlanStage::NEED_TIME;
+        }
+
+        if (!_params.request->explain()) {
+            _stagedUpdatesBuffer.push_back({recordId, member->doc.snapshotId()});
+        }
+    }
+
+    if (!_params.request->explain() &&
+        (_drainRemainingBuffer ||
+         (_batchParams->targetBatchDocs &&
+          _stagedUpdatesBuffer.size() >=
+              static_cast<unsigned long long>(_batchParams->targetBatchDocs)))) {
+        return _updateBatch(out);
+    }
+
+    return PlanStage::NEED_TIME;
+}
+
+PlanStage::StageState BatchedUpdateStage::_tryRestoreState(WorkingSetID* out) {
+    try {
+        child()->restoreState(&collection());
+    } catch (const WriteConflictException&) {
+        *out = WorkingSet::INVALID_ID;
+        return NEED_YIELD;
+    }
+    return NEED_TIME;
+}
+
+PlanStage::StageState BatchedUpdateStage::_prepareToRetryDrainAfterWCE(
+    WorkingSetID* out, const std::set<RecordId>& recordsThatNoLongerMatch) {
+    // Remove records that no longer match the query before retrying.
+    _stagedUpdatesBuffer.erase(std::remove_if(_stagedUpdatesBuffer.begin(),
+                                              _stagedUpdatesBuffer.end(),
+                                              [&](const auto& stagedUpdate) {
+                                                  return recordsThatNoLongerMatch.find(
+                                                             stagedUpdate.rid) !=
+                                                      recordsThatNoLongerMatch.end();
+                                              }),
+                               _stagedUpdatesBuffer.end());
+    *out = WorkingSet::INVALID_ID;
+    _drainRemainingBuffer = true;
+    return NEED_YIELD;
+}
+
+}  // namespace mongo
@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/exec/batched_update_stage_gen.h"
+#include "mongo/db/exec/update_stage.h"
+#include "mongo/db/exec/write_stage_common.h"
+#include "mongo/db/jsobj.h"
+
+namespace mongo {
+
+/**
+ * Batch sizing parameters. A batch of documents staged for update is committed as soon as one of
+ * the targets below is met, or upon reaching EOF.
+ */
+struct BatchedUpdateStageBatchParams {
+    BatchedUpdateStageBatchParams()
+        : targetBatchDocs(gBatchedUpdatesTargetBatchDocs.load()),
+          targetBatchTimeMS(Milliseconds(gBatchedUpdatesTargetBatchTimeMS.load())) {}
+
+    // Documents staged for update are processed in a batch once this document count target is met.
+    // A value of zero means unlimited.
+    long long targetBatchDocs = 0;
+    // A batch is committed as soon as this target execution time is met. Zero means unlimited.
+    Milliseconds targetBatchTimeMS = Milliseconds(0);
+};
+
+/**
+ * The BATCHED_UPDATE stage updates documents in batches, using RecordId's that are returned from
+ * its child. In comparison, the base class UpdateStage updates documents one by one, paying the
+ * WriteUnitOfWork commit and oplog entry overhead per document. The stage returns NEED_TIME after
+ * updating a document, or after staging a document to be updated in the next batch. Each batch is
+ * committed in a single WriteUnitOfWork with group oplog emission.
+ *
+ * Callers of work() must be holding a write lock (and, for replicated updates, callers must have
+ * had the replication coordinator approve the write).
+ */
+class BatchedUpdateStage final : public UpdateStage {
+    BatchedUpdateStage(const BatchedUpdateStage&) = delete;
+    BatchedUpdateStage& operator=(const BatchedUpdateStage&) = delete;
+
+public:
+    static constexpr StringData kStageType = "BATCHED_UPDATE"_sd;
+
+    BatchedUpdateStage(ExpressionContext* expCtx,
+                       const UpdateStageParams& params,
+                       std::unique_ptr<BatchedUpdateStageBatchParams> batchParams,
+                       WorkingSet* ws,
+                       const CollectionPtr& collection,
+                       PlanStage* child);
+    ~BatchedUpdateStage();
+
+    StageState doWork(WorkingSetID* out) override;
+
+    StageType stageType() const final {
+        return STAGE_BATCHED_UPDATE;
+    }
+
+private:
+    /**
+     * Returns NEED_YIELD when there is a write conflict. Otherwise, returns NEED_TIME when some,
+     * or all, of the documents staged in the _stagedUpdatesBuffer are successfully updated.
+     */
+    PlanStage::StageState _updateBatch(WorkingSetID* out);
+
+    // Tries to restore the child's state. Returns NEED_TIME if the restore succeeds, NEED_YIELD
+    // upon write conflict.
+    PlanStage::StageState _tryRestoreState(WorkingSetID* out);
+
+    // Prepares to retry draining the _stagedUpdatesBuffer after a write conflict. Removes
+    // 'recordsThatNoLongerMatch' then yields.
+    PlanStage::StageState _prepareToRetryDrainAfterWCE(
+        WorkingSetID* out, const std::set<RecordId>& recordsThatNoLongerMatch);
+
+    // Metadata of a document staged for update.
+    struct StagedDocumentMetadata {
+        RecordId rid;
+
+        // SnapshotId associated with the document when it is staged for update. The document is
+        // re-fetched at update time, and if the snapshot has since changed it must also be
+        // re-checked against the query.
+        SnapshotId snapshotId;
+    };
+
+    // Stores documents staged for update.
+    std::vector<StagedDocumentMetadata> _stagedUpdatesBuffer;
+
+    // Whether there are remaining docs in the buffer from a previous call to doWork() that should
+    // be drained before fetching more documents.
+    bool _drainRemainingBuffer = false;
+
+    // Batch targeting parameters.
+    std::unique_ptr<BatchedUpdateStageBatchParams> _batchParams;
+};
+
+}  // namespace mongo
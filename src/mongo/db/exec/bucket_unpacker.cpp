@@ -30,6 +30,7 @@
 #include "mongo/db/exec/bucket_unpacker.h"
 
 #include <algorithm>
+#include <deque>
 
 #include "mongo/bson/util/bsoncolumn.h"
 #include "mongo/db/matcher/expression.h"
@@ -682,6 +683,27 @@ public:
                          const Value& metaValue,
                          bool includeTimeField,
                          bool includeMetaField) = 0;
+
+    /**
+     * Unpacks up to 'measurements.size()' measurements in a single pass, returning the number
+     * actually unpacked and setting 'hasNext' to whether the bucket has more. The default
+     * implementation materializes row-at-a-time via getNext(); unpackers over columnar storage
+     * override this to decode column-at-a-time.
+     */
+    virtual std::size_t getNextBatch(std::deque<MutableDocument>& measurements,
+                                     const BucketSpec& spec,
+                                     const Value& metaValue,
+                                     bool includeTimeField,
+                                     bool includeMetaField,
+                                     bool* hasNext) {
+        std::size_t count = 0;
+        bool more = true;
+        for (; count < measurements.size() && more; ++count) {
+            more = getNext(measurements[count], spec, metaValue, includeTimeField, includeMetaField);
+        }
+        *hasNext = more;
+        return count;
+    }
     virtual void extractSingleMeasurement(MutableDocument& measurement,
                                           int j,
                                           const BucketSpec& spec,
@@ -868,6 +890,12 @@ public:
                  const Value& metaValue,
                  bool includeTimeField,
                  bool includeMetaField) override;
+    std::size_t getNextBatch(std::deque<MutableDocument>& measurements,
+                             const BucketSpec& spec,
+                             const Value& metaValue,
+                             bool includeTimeField,
+                             bool includeMetaField,
+                             bool* hasNext) override;
     void extractSingleMeasurement(MutableDocument& measurement,
                                   int j,
                                   const BucketSpec& spec,
@@ -948,6 +976,48 @@ bool BucketUnpackerV2::getNext(MutableDocument& measurement,
     return _timeColumn.it != _timeColumn.end;
 }
 
+std::size_t BucketUnpackerV2::getNextBatch(std::deque<MutableDocument>& measurements,
+                                           const BucketSpec& spec,
+                                           const Value& metaValue,
+                                           bool includeTimeField,
+                                           bool includeMetaField,
+                                           bool* hasNext) {
+    // Decode column-at-a-time: each compressed column iterator is resumed once per batch instead
+    // of once per measurement, so a column's control blocks stay hot while it is drained.
+    std::size_t count = 0;
+    for (; count < measurements.size() && _timeColumn.it != _timeColumn.end; ++count) {
+        if (includeTimeField) {
+            measurements[count].addField(spec.timeFieldHashed(), Value{*_timeColumn.it});
+        }
+        ++_timeColumn.it;
+    }
+    *hasNext = _timeColumn.it != _timeColumn.end;
+
+    // Includes metaField when we're instructed to do so and metaField value exists.
+    if (includeMetaField && !metaValue.missing()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            measurements[i].addField(*spec.metaFieldHashed(), metaValue);
+        }
+    }
+
+    for (auto& fieldColumn : _fieldColumns) {
+        for (std::size_t i = 0; i < count; ++i) {
+            uassert(6650000,
+                    "Bucket unexpectedly contained fewer values than count",
+                    fieldColumn.it != fieldColumn.end);
+            const BSONElement& elem = *fieldColumn.it;
+            // EOO represents missing field
+            if (!elem.eoo()) {
+                measurements[i].addField(HashedFieldName{fieldColumn.column.nameHashed()},
+                                         Value{elem});
+            }
+            ++fieldColumn.it;
+        }
+    }
+
+    return count;
+}
+
 void BucketUnpackerV2::extractSingleMeasurement(
     MutableDocument& measurement,
     int j,
@@ -1123,6 +1193,49 @@ Document BucketUnpacker::getNext() {
     return measurement.freeze();
 }
 
+std::vector<Document> BucketUnpacker::getNextBatch(std::size_t maxCount) {
+    tassert(6650001, "'getNextBatch()' requires the bucket to be owned", _bucket.isOwned());
+    tassert(6650002,
+            "'getNextBatch()' was called after the bucket has been exhausted",
+            hasNext());
+    tassert(6650003, "'getNextBatch()' requires a non-zero batch size", maxCount > 0);
+
+    // See the comment in getNext() regarding the sizing of each MutableDocument. A deque is used
+    // because MutableDocument is neither copyable nor movable.
+    std::deque<MutableDocument> measurements;
+    const auto expectedFields = 2 * _unpackingImpl->numberOfFields();
+    for (std::size_t i = 0; i < maxCount; ++i) {
+        measurements.emplace_back(expectedFields);
+    }
+
+    bool hasNext = false;
+    auto count = _unpackingImpl->getNextBatch(
+        measurements, _spec, _metaValue, _includeTimeField, _includeMetaField, &hasNext);
+    _hasNext = hasNext;
+
+    std::vector<Document> batch;
+    batch.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& measurement = measurements[i];
+
+        // Add computed meta projections.
+        for (auto&& name : _spec.computedMetaProjFields()) {
+            measurement.addField(name, Value{_computedMetaProjections[name]});
+        }
+
+        if (_includeMinTimeAsMetadata && _minTime) {
+            measurement.metadata().setTimeseriesBucketMinTime(*_minTime);
+        }
+
+        if (_includeMaxTimeAsMetadata && _maxTime) {
+            measurement.metadata().setTimeseriesBucketMaxTime(*_maxTime);
+        }
+
+        batch.push_back(measurement.freeze());
+    }
+    return batch;
+}
+
 Document BucketUnpacker::extractSingleMeasurement(int j) {
     tassert(5422101,
             "'extractSingleMeasurment' expects j to be greater than or equal to zero and less than "
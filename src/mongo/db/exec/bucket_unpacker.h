@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <set>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/exec/document_value/document.h"
@@ -226,6 +227,14 @@ public:
      */
     Document getNext();
 
+    /**
+     * Materializes up to 'maxCount' measurements in a single pass. This is cheaper than repeated
+     * getNext() calls for compressed (V2) buckets, whose columns are decoded column-at-a-time per
+     * batch instead of row-at-a-time. A precondition of this method is that 'hasNext()' must be
+     * true, and it always returns at least one measurement.
+     */
+    std::vector<Document> getNextBatch(std::size_t maxCount);
+
     /**
      * This method will extract the j-th measurement from the bucket. A precondition of this method
      * is that j >= 0 && j <= the number of measurements within the underlying bucket.
@@ -195,6 +195,68 @@ TEST_F(BucketUnpackerTest, UnpackBasicIncludeAllMeasurementFields) {
     ASSERT_FALSE(unpacker.hasNext());
 }
 
+TEST_F(BucketUnpackerTest, GetNextBatchMaterializesSameMeasurementsAsGetNext) {
+    std::set<std::string> fields{
+        "_id", kUserDefinedMetaName.toString(), kUserDefinedTimeName.toString(), "a", "b"};
+
+    auto bucket = fromjson(
+        "{control: {'version': 1}, meta: {'m1': 999, 'm2': 9999}, data: {_id: {'0':1, '1':2}, "
+        "time: {'0':1, '1':2}, "
+        "a:{'0':1, '1':2}, b:{'1':1}}}");
+
+    auto test = [&](BSONObj bucket) {
+        auto unpacker = makeBucketUnpacker(fields,
+                                           BucketUnpacker::Behavior::kInclude,
+                                           std::move(bucket),
+                                           kUserDefinedMetaName.toString());
+
+        ASSERT_TRUE(unpacker.hasNext());
+        auto batch = unpacker.getNextBatch(10);
+        ASSERT_EQ(batch.size(), 2U);
+        ASSERT_DOCUMENT_EQ(
+            batch[0], Document{fromjson("{time: 1, myMeta: {m1: 999, m2: 9999}, _id: 1, a: 1}")});
+        ASSERT_DOCUMENT_EQ(
+            batch[1],
+            Document{fromjson("{time: 2, myMeta: {m1: 999, m2: 9999}, _id: 2, a: 2, b: 1}")});
+        ASSERT_FALSE(unpacker.hasNext());
+    };
+
+    test(bucket);
+    test(*timeseries::compressBucket(bucket, "time"_sd, {}, false).compressedBucket);
+}
+
+TEST_F(BucketUnpackerTest, GetNextBatchRespectsMaxCount) {
+    std::set<std::string> fields{
+        "_id", kUserDefinedMetaName.toString(), kUserDefinedTimeName.toString(), "a", "b"};
+
+    auto bucket = fromjson(
+        "{control: {'version': 1}, meta: {'m1': 999, 'm2': 9999}, data: {_id: {'0':1, '1':2}, "
+        "time: {'0':1, '1':2}, "
+        "a:{'0':1, '1':2}, b:{'1':1}}}");
+
+    auto test = [&](BSONObj bucket) {
+        auto unpacker = makeBucketUnpacker(fields,
+                                           BucketUnpacker::Behavior::kInclude,
+                                           std::move(bucket),
+                                           kUserDefinedMetaName.toString());
+
+        ASSERT_TRUE(unpacker.hasNext());
+        auto batch = unpacker.getNextBatch(1);
+        ASSERT_EQ(batch.size(), 1U);
+        ASSERT_DOCUMENT_EQ(
+            batch[0], Document{fromjson("{time: 1, myMeta: {m1: 999, m2: 9999}, _id: 1, a: 1}")});
+
+        ASSERT_TRUE(unpacker.hasNext());
+        assertGetNext(unpacker,
+                      Document{fromjson("{time: 2, myMeta: {m1: 999, m2: 9999}, _id: 2, a: 2, "
+                                        "b: 1}")});
+        ASSERT_FALSE(unpacker.hasNext());
+    };
+
+    test(bucket);
+    test(*timeseries::compressBucket(bucket, "time"_sd, {}, false).compressedBucket);
+}
+
 TEST_F(BucketUnpackerTest, ExcludeASingleField) {
     std::set<std::string> fields{"b"};
 
@@ -42,6 +42,7 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/logv2/log.h"
@@ -121,6 +122,22 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
         // only support in the forward direction.
         invariant(params.direction == CollectionScanParams::FORWARD);
     }
+
+    // Plain scans may pull records from the record store a batch at a time, amortizing the
+    // per-record cursor overhead. Scans that perform per-record bookkeeping against the storage
+    // cursor position (tailing, oplog timestamp tracking and visibility waits, resume token
+    // support) must advance the cursor one record at a time.
+    _useBatchedReads = !params.tailable && !params.shouldTrackLatestOplogTimestamp &&
+        !params.shouldWaitForOplogVisibility && !params.requestResumeToken &&
+        !collection->ns().isOplog();
+
+    // A full scan of a collection much larger than memory evicts the cache's working set, and
+    // several such scans running concurrently (e.g. analytics jobs) thrash the cache against each
+    // other without making any of them faster. When the knob is enabled, unbounded plain scans
+    // hint their reads as 'read once' so the pages they bring in are evicted early and concurrent
+    // large scans stream through the cache rather than fight over it.
+    _useReadOnceCursor = _useBatchedReads && !params.minRecord && !params.maxRecord &&
+        internalQueryFullCollectionScansUseReadOnceCursors.load();
 }
 
 CollectionScan::CollectionScan(ExpressionContext* expCtx,
@@ -159,6 +176,12 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
                 collection()->getRecordStore()->waitForAllEarlierOplogWritesToBeVisible(opCtx());
             }
 
+            if (_useReadOnceCursor && !opCtx()->recoveryUnit()->isActive()) {
+                // The read-once hint may only be changed before the storage transaction starts,
+                // so it is skipped if another stage has already begun reading.
+                opCtx()->recoveryUnit()->setReadOnce(true);
+            }
+
             _cursor = collection()->getCursor(opCtx(), forward);
 
             if (!_lastSeenId.isNull()) {
@@ -200,6 +223,22 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
             return PlanStage::NEED_TIME;
         }
 
+        if (_cursorNeedsReseek) {
+            invariant(_params.tailable);
+            invariant(!_lastSeenId.isNull());
+            // Reposition the cursor retained across the tailable wait to where the scan left off.
+            // As with recreating the cursor, signal an error rather than silently dropping data
+            // from the stream if our position no longer exists.
+            if (!_cursor->seekExact(_lastSeenId)) {
+                uasserted(ErrorCodes::CappedPositionLost,
+                          str::stream() << "CollectionScan died due to failure to restore "
+                                        << "tailable cursor position. "
+                                        << "Last seen record id: " << _lastSeenId);
+            }
+            _cursorNeedsReseek = false;
+            return PlanStage::NEED_TIME;
+        }
+
         if (_lastSeenId.isNull() && _params.direction == CollectionScanParams::FORWARD &&
             _params.minRecord) {
             // Seek to the approximate start location.
@@ -213,7 +252,18 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         }
 
         if (!record) {
-            record = _cursor->next();
+            if (_useBatchedReads) {
+                if (_bufferedRecordIdx == _bufferedRecords.size()) {
+                    _bufferedRecords.clear();
+                    _bufferedRecordIdx = 0;
+                    _cursor->nextBatch(kScanBatchSize, &_bufferedRecords);
+                }
+                if (_bufferedRecordIdx < _bufferedRecords.size()) {
+                    record = std::move(_bufferedRecords[_bufferedRecordIdx++]);
+                }
+            } else {
+                record = _cursor->next();
+            }
         }
     } catch (const WriteConflictException&) {
         // Leave us in a state to try again next time.
@@ -225,9 +275,12 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
 
     if (!record) {
         // We hit EOF. If we are tailable and have already seen data, leave us in a state to pick up
-        // where we left off on the next call to work(). Otherwise, the EOF is permanent.
+        // where we left off on the next call to work(). We retain the storage cursor so that
+        // resuming is a single seek back to '_lastSeenId' rather than constructing a new cursor;
+        // this matters for capped collections with many tailing consumers, where every insert
+        // wakes all of them at once. Otherwise, the EOF is permanent.
         if (_params.tailable && !_lastSeenId.isNull()) {
-            _cursor.reset();
+            _cursorNeedsReseek = true;
         } else {
             _commonStats.isEOF = true;
         }
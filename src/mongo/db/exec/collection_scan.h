@@ -30,6 +30,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/collection_scan_common.h"
 #include "mongo/db/exec/requires_collection_stage.h"
@@ -130,10 +131,33 @@ private:
 
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
+    // Set when a tailable scan hits EOF and retains '_cursor' so that resuming after a wait for
+    // more data only needs to seek back to '_lastSeenId', rather than construct and position a
+    // brand new cursor. The cursor must not be read from until the seek has happened.
+    bool _cursorNeedsReseek = false;
+
     CollectionScanParams _params;
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
 
+    // Number of records pulled from the record store per storage-layer call when batched reads
+    // are in use.
+    static constexpr size_t kScanBatchSize = 64;
+
+    // True for plain scans (not tailable, no oplog bookkeeping, no resume token requested),
+    // where records may be read from the record store a batch at a time.
+    bool _useBatchedReads = false;
+
+    // True if this is a full unbounded scan that should hint its reads as 'read once' to the
+    // storage engine, marking the pages it brings into cache as early-eviction candidates. Set
+    // from the 'internalQueryFullCollectionScansUseReadOnceCursors' knob at construction.
+    bool _useReadOnceCursor = false;
+
+    // Records buffered from the record store but not yet returned, in scan order starting at
+    // '_bufferedRecordIdx'. Only used when '_useBatchedReads' is true.
+    std::vector<Record> _bufferedRecords;
+    size_t _bufferedRecordIdx = 0;
+
     // If _params.shouldTrackLatestOplogTimestamp is set and the collection is the oplog, the latest
     // timestamp seen in the collection.  Otherwise, this is a null timestamp.
     Timestamp _latestOplogEntryTimestamp;
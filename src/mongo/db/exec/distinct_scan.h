@@ -83,6 +83,10 @@ struct DistinctParams {
     // If we have an index {a:1, b:1} we could use it to distinct over either 'a' or 'b'.
     // If we distinct over 'a' the position is 0.
     // If we distinct over 'b' the position is 1.
+    //
+    // Since the scan skips past the whole key prefix through this field, distinct-ing over
+    // multiple fields that form a prefix of the key pattern is done by pointing this at the last
+    // of them: with fieldNo 1 on {a:1, b:1} the scan visits one key per distinct (a, b) pair.
     int fieldNo{0};
 };
 
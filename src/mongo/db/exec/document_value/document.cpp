@@ -400,10 +400,12 @@ void DocumentStorage::reset(const BSONObj& bson, bool stripMetadata) {
         it->val.~Value();  // explicit destructor call
     }
 
-    _cacheEnd = _cache;
+    // Keep the buffer and the hash table sizing ('_cacheEnd' and '_hashTabMask') so that refilling
+    // this storage reuses the existing allocation rather than growing a fresh one from 128 bytes.
+    // Any stale hash table contents are harmless: the table is reinitialized by rehash() once
+    // enough fields have been appended to need hashing.
     _usedBytes = 0;
     _numFields = 0;
-    _hashTabMask = 0;
 
     // Clean metadata.
     _metadataFields = DocumentMetadataFields{};
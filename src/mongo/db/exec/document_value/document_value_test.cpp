@@ -137,6 +137,31 @@ TEST(DocumentConstruction, FromBsonReset) {
     ASSERT_BSONOBJ_EQ(bson, toBson(newDocument));
 }
 
+TEST(DocumentConstruction, ResetReusesCacheBuffer) {
+    // Materialize enough fields to allocate a cache buffer and a hash table.
+    MutableDocument md;
+    for (int i = 0; i < 10; ++i) {
+        md.addField("f" + std::to_string(i), Value(i));
+    }
+
+    // Resetting keeps the allocation; refilling it past the hashing threshold must rebuild the
+    // hash table from scratch rather than consult stale contents.
+    auto bson = BSON("a" << 1 << "b"
+                         << "q");
+    md.reset(bson, false);
+    for (int i = 0; i < 10; ++i) {
+        md.addField("g" + std::to_string(i), Value(i));
+    }
+    auto newDocument = md.freeze();
+
+    ASSERT_EQUALS(12ULL, newDocument.computeSize());
+    ASSERT_EQUALS(1, newDocument["a"].getInt());
+    ASSERT_EQUALS("q", newDocument["b"].getString());
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_EQUALS(i, newDocument["g" + std::to_string(i)].getInt());
+    }
+}
+
 /**
  * Appends to 'builder' an object nested 'depth' levels deep.
  */
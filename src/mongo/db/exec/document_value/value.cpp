@@ -934,8 +934,7 @@ void Value::hash_combine(size_t& seed,
 
         case Code:
         case Symbol: {
-            StringData sd = getRawData();
-            MurmurHash3_x86_32(sd.rawData(), sd.size(), seed, &seed);
+            SimpleStringDataComparator::kInstance.hash_combine(seed, getRawData());
             break;
         }
 
@@ -944,7 +943,7 @@ void Value::hash_combine(size_t& seed,
             if (stringComparator) {
                 stringComparator->hash_combine(seed, sd);
             } else {
-                MurmurHash3_x86_32(sd.rawData(), sd.size(), seed, &seed);
+                SimpleStringDataComparator::kInstance.hash_combine(seed, sd);
             }
             break;
         }
@@ -967,15 +966,13 @@ void Value::hash_combine(size_t& seed,
 
 
         case BinData: {
-            StringData sd = getRawData();
-            MurmurHash3_x86_32(sd.rawData(), sd.size(), seed, &seed);
+            SimpleStringDataComparator::kInstance.hash_combine(seed, getRawData());
             boost::hash_combine(seed, _storage.binDataType());
             break;
         }
 
         case RegEx: {
-            StringData sd = getRawData();
-            MurmurHash3_x86_32(sd.rawData(), sd.size(), seed, &seed);
+            SimpleStringDataComparator::kInstance.hash_combine(seed, getRawData());
             break;
         }
 
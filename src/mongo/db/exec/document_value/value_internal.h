@@ -323,9 +323,10 @@ public:
 
             // bytes[1]
             struct {
-                uint8_t refCounter : 1;  // bit 0: true if we need to refCount
-                uint8_t shortStr : 1;    // bit 1: true if we are using short strings
-                uint8_t reservedFlags : 6;
+                uint8_t refCounter : 1;   // bit 0: true if we need to refCount
+                uint8_t shortStr : 1;     // bit 1: true if we are using short strings
+                uint8_t shortStrSize : 4;  // bits 2-5: size when using short strings
+                uint8_t reservedFlags : 2;
             };
 
             // bytes[2:15]
@@ -333,8 +334,9 @@ public:
                 unsigned char oid[12];
 
                 struct {
-                    char shortStrSize;  // TODO Consider moving into flags union (4 bits)
-                    char shortStrStorage[sizeof(bytes) - 3 /*offset*/ - 1 /*NUL byte*/];
+                    // The trailing byte is reserved so inline strings are always followed by a
+                    // NUL; getRegex() and getRegexFlags() rely on it.
+                    char shortStrStorage[sizeof(bytes) - 2 /*offset*/ - 1 /*NUL byte*/];
                     union {
                         char nulTerminator;
                     };
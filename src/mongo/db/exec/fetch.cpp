@@ -91,6 +91,15 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     if (PlanStage::ADVANCED == status) {
         WorkingSetMember* member = _ws->get(id);
 
+        // If an ancestor deduping OrStage already returned this record through another branch, it
+        // would drop whatever we produce for it as a duplicate; skip the fetch and filter work.
+        if (_dedupSet && member->hasRecordId() &&
+            _dedupSet->end() != _dedupSet->find(member->recordId)) {
+            ++_specificStats.dupsSkipped;
+            _ws->free(id);
+            return NEED_TIME;
+        }
+
         // If there's an obj there, there is no fetching to perform.
         if (member->hasObj()) {
             ++_specificStats.alreadyHasObj;
@@ -35,6 +35,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/record_id.h"
+#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
@@ -58,6 +59,17 @@ public:
 
     ~FetchStage();
 
+    /**
+     * Provides the set of RecordIds already returned by an ancestor deduping OrStage. When set,
+     * records found in it are discarded before being fetched or filtered, since the OrStage
+     * would drop them as duplicates anyway. This lets overlapping $or branches skip repeated
+     * fetch and residual filter work for documents another branch already produced.
+     */
+    void setRecordIdDedupSet(
+        std::shared_ptr<const stdx::unordered_set<RecordId, RecordId::Hasher>> dedupSet) {
+        _dedupSet = std::move(dedupSet);
+    }
+
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
 
@@ -95,6 +107,10 @@ private:
     // The filter is not owned by us.
     const MatchExpression* _filter;
 
+    // RecordIds already returned by an ancestor deduping OrStage, if any. The set is owned and
+    // populated by that stage; we only read it.
+    std::shared_ptr<const stdx::unordered_set<RecordId, RecordId::Hasher>> _dedupSet;
+
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
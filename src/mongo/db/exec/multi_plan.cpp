@@ -170,6 +170,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
                                              internalQueryPlanEvaluationCollFraction.load());
     size_t numResults = trial_period::getTrialPeriodNumToReturn(*_query);
 
+    _prunedCandidates.assign(_candidates.size(), false);
+    const bool pruningEnabled = internalQueryMultiPlanPruningEnabled.load();
+
     try {
         // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
         for (size_t ix = 0; ix < numWorks; ++ix) {
@@ -177,6 +180,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
             if (!moreToDo) {
                 break;
             }
+            if (pruningEnabled) {
+                prunePoorPerformingPlans();
+            }
         }
     } catch (DBException& e) {
         return e.toStatus().withContext("error while multiplanner was selecting best plan");
@@ -231,7 +237,7 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
         auto& candidate = _candidates[ix];
-        if (!candidate.status.isOK()) {
+        if (!candidate.status.isOK() || _prunedCandidates[ix]) {
             continue;
         }
 
@@ -292,6 +298,42 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
     return !doneWorking;
 }
 
+void MultiPlanStage::prunePoorPerformingPlans() {
+    // Find the leader among the candidates that are still in the running.
+    size_t maxResults = 0;
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        if (_candidates[ix].status.isOK() && !_prunedCandidates[ix]) {
+            maxResults = std::max(maxResults, _candidates[ix].results.size());
+        }
+    }
+
+    // Give every candidate a fair chance to start producing before drawing conclusions.
+    if (maxResults < static_cast<size_t>(internalQueryMultiPlanPruningMinResults.load())) {
+        return;
+    }
+
+    const auto ratio = static_cast<size_t>(internalQueryMultiPlanPruningRatio.load());
+    for (size_t ix = 0; ix < _candidates.size(); ++ix) {
+        auto& candidate = _candidates[ix];
+        if (!candidate.status.isOK() || _prunedCandidates[ix] ||
+            candidate.solution->hasBlockingStage) {
+            continue;
+        }
+        if (candidate.results.size() * ratio <= maxResults) {
+            _prunedCandidates[ix] = true;
+
+            auto explainer = plan_explainer_factory::make(
+                candidate.root, candidate.solution->_enumeratorExplainInfo);
+            LOGV2_DEBUG(6650008,
+                        2,
+                        "Pruning unproductive candidate plan from multi-plan trial period",
+                        "planSummary"_attr = explainer->getPlanSummary(),
+                        "candidateResults"_attr = candidate.results.size(),
+                        "leaderResults"_attr = maxResults);
+        }
+    }
+}
+
 bool MultiPlanStage::hasBackupPlan() const {
     return kNoSuchPlan != _backupPlanIdx;
 }
@@ -163,6 +163,15 @@ private:
      */
     void tryYield(PlanYieldPolicy* yieldPolicy);
 
+    /**
+     * Stops working candidates that have fallen too far behind the current leader in returned
+     * results, so hopeless plans stop consuming trial reads. Pruned candidates keep the stats they
+     * have accumulated so far and still participate in ranking; they are simply no longer worked.
+     * Candidates with blocking stages are never pruned, since they legitimately return no results
+     * during most of the trial period.
+     */
+    void prunePoorPerformingPlans();
+
     static const int kNoSuchPlan = -1;
 
     // Describes the cases in which we should write an entry for the winning plan to the plan cache.
@@ -178,6 +187,10 @@ private:
     // one-to-one with _candidates.
     std::vector<plan_ranker::CandidatePlan> _candidates;
 
+    // Parallel to '_candidates'. A pruned candidate is no longer worked during the trial period
+    // but is still ranked on the stats it accumulated before being pruned.
+    std::vector<bool> _prunedCandidates;
+
     // index into _candidates, of the winner of the plan competition
     // uses -1 / kNoSuchPlan when best plan is not (yet) known
     int _bestPlanIdx;
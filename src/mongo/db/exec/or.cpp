@@ -48,7 +48,11 @@ OrStage::OrStage(ExpressionContext* expCtx,
                  WorkingSet* ws,
                  bool dedup,
                  const MatchExpression* filter)
-    : PlanStage(kStageType, expCtx), _ws(ws), _filter(filter), _currentChild(0), _dedup(dedup) {}
+    : PlanStage(kStageType, expCtx), _ws(ws), _filter(filter), _currentChild(0), _dedup(dedup) {
+    if (_dedup) {
+        _seen = std::make_shared<stdx::unordered_set<RecordId, RecordId::Hasher>>();
+    }
+}
 
 void OrStage::addChild(std::unique_ptr<PlanStage> child) {
     _children.emplace_back(std::move(child));
@@ -80,14 +84,14 @@ PlanStage::StageState OrStage::doWork(WorkingSetID* out) {
             ++_specificStats.dupsTested;
 
             // ...and we've seen the RecordId before
-            if (_seen.end() != _seen.find(member->recordId)) {
+            if (_seen->end() != _seen->find(member->recordId)) {
                 // ...drop it.
                 ++_specificStats.dupsDropped;
                 _ws->free(id);
                 return PlanStage::NEED_TIME;
             } else {
                 // Otherwise, note that we've seen it.
-                _seen.insert(member->recordId);
+                _seen->insert(member->recordId);
             }
         }
 
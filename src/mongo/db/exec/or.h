@@ -62,6 +62,16 @@ public:
 
     const SpecificStats* getSpecificStats() const final;
 
+    /**
+     * Returns the set of RecordIds this stage has already returned, or nullptr if not deduping.
+     * Branch stages beneath this one may consult the set to skip work for records which a
+     * previously worked branch already produced, since this stage would discard them as
+     * duplicates anyway.
+     */
+    std::shared_ptr<const stdx::unordered_set<RecordId, RecordId::Hasher>> seenRecordIds() const {
+        return _seen;
+    }
+
     static const char* kStageType;
 
 private:
@@ -77,8 +87,9 @@ private:
     // True if we dedup on RecordId, false otherwise.
     const bool _dedup;
 
-    // Which RecordIds have we returned?
-    stdx::unordered_set<RecordId, RecordId::Hasher> _seen;
+    // Which RecordIds have we returned? Allocated only when deduping, and shared with branch
+    // stages via seenRecordIds().
+    std::shared_ptr<stdx::unordered_set<RecordId, RecordId::Hasher>> _seen;
 
     // Stats
     OrStats _specificStats;
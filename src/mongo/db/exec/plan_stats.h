@@ -503,6 +503,10 @@ struct FetchStats : public SpecificStats {
 
     // The total number of full documents touched by the fetch stage.
     size_t docsExamined = 0u;
+
+    // The number of records skipped without being fetched or filtered because an ancestor
+    // deduping OR stage had already returned them through another branch.
+    size_t dupsSkipped = 0u;
 };
 
 struct IDHackStats : public SpecificStats {
@@ -127,24 +127,6 @@ bool ProjectionStage::isEOF() {
     return child()->isEOF();
 }
 
-PlanStage::StageState ProjectionStage::doWork(WorkingSetID* out) {
-    WorkingSetID id = WorkingSet::INVALID_ID;
-    StageState status = child()->work(&id);
-
-    // Note that we don't do the normal if isEOF() return EOF thing here.  Our child might be a
-    // tailable cursor and isEOF() would be true even if it had more data...
-    if (PlanStage::ADVANCED == status) {
-        WorkingSetMember* member = _ws.get(id);
-        // Punt to our specific projection impl.
-        transform(member);
-        *out = id;
-    } else if (PlanStage::NEED_YIELD == status) {
-        *out = id;
-    }
-
-    return status;
-}
-
 std::unique_ptr<PlanStageStats> ProjectionStage::getStats() {
     _commonStats.isEOF = isEOF();
     auto ret = std::make_unique<PlanStageStats>(_commonStats, stageType());
@@ -162,7 +144,7 @@ ProjectionStageDefault::ProjectionStageDefault(boost::intrusive_ptr<ExpressionCo
                                                const projection_ast::Projection* projection,
                                                WorkingSet* ws,
                                                std::unique_ptr<PlanStage> child)
-    : ProjectionStage{expCtx.get(), projObj, ws, std::move(child), "PROJECTION_DEFAULT"},
+    : ProjectionStageT{expCtx.get(), projObj, ws, std::move(child), "PROJECTION_DEFAULT"},
       _requestedMetadata{projection->metadataDeps()},
       _projectType{projection->type()},
       _executor{projection_executor::buildProjectionExecutor(
@@ -218,7 +200,7 @@ ProjectionStageCovered::ProjectionStageCovered(ExpressionContext* expCtx,
                                                WorkingSet* ws,
                                                std::unique_ptr<PlanStage> child,
                                                const BSONObj& coveredKeyObj)
-    : ProjectionStage{expCtx, projObj, ws, std::move(child), "PROJECTION_COVERED"},
+    : ProjectionStageT{expCtx, projObj, ws, std::move(child), "PROJECTION_COVERED"},
       _coveredKeyObj{coveredKeyObj} {
     invariant(projection->isSimple());
 
@@ -273,7 +255,7 @@ ProjectionStageSimple::ProjectionStageSimple(ExpressionContext* expCtx,
                                              const projection_ast::Projection* projection,
                                              WorkingSet* ws,
                                              std::unique_ptr<PlanStage> child)
-    : ProjectionStage{expCtx, projObj, ws, std::move(child), "PROJECTION_SIMPLE"} {
+    : ProjectionStageT{expCtx, projObj, ws, std::move(child), "PROJECTION_SIMPLE"} {
     invariant(projection->isSimple());
     _includedFields = {projection->getRequiredFields().begin(),
                        projection->getRequiredFields().end()};
@@ -51,7 +51,6 @@ protected:
 
 public:
     bool isEOF() final;
-    StageState doWork(WorkingSetID* out) final;
 
     std::unique_ptr<PlanStageStats> getStats() final;
 
@@ -66,24 +65,49 @@ protected:
     // only in explain mode.
     boost::optional<BSONObj> _projObj;
 
-private:
-    /**
-     * Runs either the default complete implementation or a fast path depending on how this was
-     * constructed.
-     */
-    virtual void transform(WorkingSetMember* member) const = 0;
-
     // Used to retrieve a WorkingSetMember as part of 'doWork()'.
     WorkingSet& _ws;
 
+private:
     // Populated by 'getStats()'.
     ProjectionStats _specificStats;
 };
 
+/**
+ * CRTP helper implementing the 'doWork()' control flow shared by the projection stages. Binding
+ * the concrete stage type at compile time lets the per-document call to the derived stage's
+ * 'transform()' resolve statically, so each document pays for a single virtual dispatch into
+ * 'doWork()' rather than a second one into the projection implementation.
+ */
+template <typename Derived>
+class ProjectionStageT : public ProjectionStage {
+protected:
+    using ProjectionStage::ProjectionStage;
+
+public:
+    StageState doWork(WorkingSetID* out) final {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        StageState status = child()->work(&id);
+
+        // Note that we don't do the normal if isEOF() return EOF thing here.  Our child might be
+        // a tailable cursor and isEOF() would be true even if it had more data...
+        if (PlanStage::ADVANCED == status) {
+            WorkingSetMember* member = _ws.get(id);
+            // Punt to our specific projection impl.
+            static_cast<const Derived*>(this)->transform(member);
+            *out = id;
+        } else if (PlanStage::NEED_YIELD == status) {
+            *out = id;
+        }
+
+        return status;
+    }
+};
+
 /**
  * The default case. Can handle every projection.
  */
-class ProjectionStageDefault final : public ProjectionStage {
+class ProjectionStageDefault final : public ProjectionStageT<ProjectionStageDefault> {
 public:
     /**
      * ProjectionNodeDefault should use this for construction.
@@ -99,7 +123,9 @@ public:
     }
 
 private:
-    void transform(WorkingSetMember* member) const final;
+    friend class ProjectionStageT<ProjectionStageDefault>;
+
+    void transform(WorkingSetMember* member) const;
 
     // Represents all metadata used in the projection.
     const QueryMetadataBitSet _requestedMetadata;
@@ -112,7 +138,7 @@ private:
  * are met: the projection consists only of inclusions e.g. '{field: 1}', it has no $meta
  * projections, it is not a returnKey projection and it has no dotted fields.
  */
-class ProjectionStageCovered final : public ProjectionStage {
+class ProjectionStageCovered final : public ProjectionStageT<ProjectionStageCovered> {
 public:
     /**
      * ProjectionNodeCovered should obtain a fast-path object through this constructor.
@@ -129,7 +155,9 @@ public:
     }
 
 private:
-    void transform(WorkingSetMember* member) const final;
+    friend class ProjectionStageT<ProjectionStageCovered>;
+
+    void transform(WorkingSetMember* member) const;
 
     // Field names present in the simple projection.
     FieldSet _includedFields;
@@ -151,7 +179,7 @@ private:
  * consists only of inclusions e.g. '{field: 1}', it has no $meta projections, it is not a returnKey
  * projection and it has no dotted fields.
  */
-class ProjectionStageSimple final : public ProjectionStage {
+class ProjectionStageSimple final : public ProjectionStageT<ProjectionStageSimple> {
 public:
     /**
      * ProjectionNodeSimple should obtain a fast-path object through this constructor.
@@ -167,7 +195,9 @@ public:
     }
 
 private:
-    void transform(WorkingSetMember* member) const final;
+    friend class ProjectionStageT<ProjectionStageSimple>;
+
+    void transform(WorkingSetMember* member) const;
 
     // Has the field names present in the simple projection.
     stdx::unordered_set<std::string> _includedFields;
@@ -456,6 +456,11 @@ static stdx::unordered_map<std::string, BuiltinFn> kBuiltinFunctions = {
     {"sinh", BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::sinh, false}},
     {"tan", BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::tan, false}},
     {"tanh", BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::tanh, false}},
+    {"dotProduct", BuiltinFn{[](size_t n) { return n == 2; }, vm::Builtin::dotProduct, false}},
+    {"euclideanDistance",
+     BuiltinFn{[](size_t n) { return n == 2; }, vm::Builtin::euclideanDistance, false}},
+    {"cosineSimilarity",
+     BuiltinFn{[](size_t n) { return n == 2; }, vm::Builtin::cosineSimilarity, false}},
     {"round", BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::round, false}},
     {"concat", BuiltinFn{[](size_t n) { return n > 0; }, vm::Builtin::concat, false}},
     {"isMember", BuiltinFn{[](size_t n) { return n == 2; }, vm::Builtin::isMember, false}},
@@ -602,6 +607,23 @@ vm::CodeFragment EFunction::compileDirect(CompileCtx& ctx) const {
         return code;
     }
 
+    // The 'getField' instruction dominates predicate-heavy plans and its field name argument is
+    // almost always a string constant. Fuse the name into the instruction stream instead of
+    // pushing it through the value stack, saving two dispatches per field access. The constant
+    // is embedded as an unowned view; it stays alive because the expression tree owns it and
+    // outlives the compiled code.
+    if (_name == "getField" && _nodes.size() == 2) {
+        if (auto constArg = dynamic_cast<EConstant*>(_nodes[1].get())) {
+            auto [tag, val] = constArg->getConstant();
+            if (value::isString(tag)) {
+                vm::CodeFragment code;
+                code.append(_nodes[0]->compileDirect(ctx));
+                code.appendGetField(tag, val);
+                return code;
+            }
+        }
+    }
+
     if (auto it = kInstrFunctions.find(_name); it != kInstrFunctions.end()) {
         if (!it->second.arityTest(_nodes.size())) {
             uasserted(4822845,
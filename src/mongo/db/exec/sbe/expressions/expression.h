@@ -413,6 +413,12 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const override;
     size_t estimateSize() const final;
 
+    /**
+     * Returns a non-owning view of the constant value.
+     */
+    std::pair<value::TypeTags, value::Value> getConstant() const {
+        return {_tag, _val};
+    }
 
 private:
     value::TypeTags _tag;
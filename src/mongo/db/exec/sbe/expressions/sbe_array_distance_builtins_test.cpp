@@ -0,0 +1,183 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/expression_test_base.h"
+
+namespace mongo::sbe {
+
+class SBEArrayDistanceBuiltinTest : public EExpressionTestFixture {
+protected:
+    void runAndAssertExpression(const vm::CodeFragment* compiledExpr, double expectedVal) {
+        auto [tag, val] = runCompiledExpression(compiledExpr);
+        value::ValueGuard guard(tag, val);
+
+        ASSERT_EQUALS(value::TypeTags::NumberDouble, tag);
+        ASSERT_APPROX_EQUAL(value::bitcastTo<double>(val), expectedVal, 0.000001);
+    }
+
+    void runAndAssertNothing(const vm::CodeFragment* compiledExpr) {
+        auto [tag, val] = runCompiledExpression(compiledExpr);
+        value::ValueGuard guard(tag, val);
+        ASSERT_EQUALS(value::TypeTags::Nothing, tag);
+    }
+
+    void runAndAssertNull(const vm::CodeFragment* compiledExpr) {
+        auto [tag, val] = runCompiledExpression(compiledExpr);
+        value::ValueGuard guard(tag, val);
+        ASSERT_EQUALS(value::TypeTags::Null, tag);
+    }
+};
+
+TEST_F(SBEArrayDistanceBuiltinTest, ComputesDotProduct) {
+    value::OwnedValueAccessor lhsAccessor;
+    value::OwnedValueAccessor rhsAccessor;
+    auto lhsSlot = bindAccessor(&lhsAccessor);
+    auto rhsSlot = bindAccessor(&rhsAccessor);
+    auto dotProductExpr = sbe::makeE<sbe::EFunction>(
+        "dotProduct", sbe::makeEs(makeE<EVariable>(lhsSlot), makeE<EVariable>(rhsSlot)));
+    auto compiledExpr = compileExpression(*dotProductExpr);
+
+    auto [lhsTag, lhsVal] = makeArray(BSON_ARRAY(1.0 << 2.0 << 3.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    auto [rhsTag, rhsVal] = makeArray(BSON_ARRAY(4.0 << -5.0 << 6.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 12.0);
+
+    // Mixed numeric types are coerced to double.
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(1 << 2LL << 3.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(1.5 << 2 << Decimal128{2}));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 11.5);
+
+    // BSON arrays are accepted as well.
+    std::tie(lhsTag, lhsVal) = makeBsonArray(BSON_ARRAY(1.0 << 2.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeBsonArray(BSON_ARRAY(3.0 << 4.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 11.0);
+
+    // Empty arrays have a dot product of zero.
+    std::tie(lhsTag, lhsVal) = makeArray(BSONArray());
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSONArray());
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 0.0);
+}
+
+TEST_F(SBEArrayDistanceBuiltinTest, ComputesEuclideanDistance) {
+    value::OwnedValueAccessor lhsAccessor;
+    value::OwnedValueAccessor rhsAccessor;
+    auto lhsSlot = bindAccessor(&lhsAccessor);
+    auto rhsSlot = bindAccessor(&rhsAccessor);
+    auto distanceExpr = sbe::makeE<sbe::EFunction>(
+        "euclideanDistance", sbe::makeEs(makeE<EVariable>(lhsSlot), makeE<EVariable>(rhsSlot)));
+    auto compiledExpr = compileExpression(*distanceExpr);
+
+    auto [lhsTag, lhsVal] = makeArray(BSON_ARRAY(0.0 << 0.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    auto [rhsTag, rhsVal] = makeArray(BSON_ARRAY(3.0 << 4.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 5.0);
+
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(1 << 2LL << 3.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(1.0 << 2.0 << 3.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 0.0);
+}
+
+TEST_F(SBEArrayDistanceBuiltinTest, ComputesCosineSimilarity) {
+    value::OwnedValueAccessor lhsAccessor;
+    value::OwnedValueAccessor rhsAccessor;
+    auto lhsSlot = bindAccessor(&lhsAccessor);
+    auto rhsSlot = bindAccessor(&rhsAccessor);
+    auto similarityExpr = sbe::makeE<sbe::EFunction>(
+        "cosineSimilarity", sbe::makeEs(makeE<EVariable>(lhsSlot), makeE<EVariable>(rhsSlot)));
+    auto compiledExpr = compileExpression(*similarityExpr);
+
+    // Parallel vectors have a similarity of 1.
+    auto [lhsTag, lhsVal] = makeArray(BSON_ARRAY(1.0 << 2.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    auto [rhsTag, rhsVal] = makeArray(BSON_ARRAY(2.0 << 4.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 1.0);
+
+    // Orthogonal vectors have a similarity of 0.
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(1.0 << 0.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(0.0 << 1.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), 0.0);
+
+    // Opposite vectors have a similarity of -1.
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(1.0 << 2.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(-1.0 << -2.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertExpression(compiledExpr.get(), -1.0);
+
+    // The measure is undefined for zero-norm vectors, for which the builtin returns Null.
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(0.0 << 0.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(1.0 << 2.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertNull(compiledExpr.get());
+}
+
+TEST_F(SBEArrayDistanceBuiltinTest, ReturnsNothingForInvalidInput) {
+    value::OwnedValueAccessor lhsAccessor;
+    value::OwnedValueAccessor rhsAccessor;
+    auto lhsSlot = bindAccessor(&lhsAccessor);
+    auto rhsSlot = bindAccessor(&rhsAccessor);
+    auto dotProductExpr = sbe::makeE<sbe::EFunction>(
+        "dotProduct", sbe::makeEs(makeE<EVariable>(lhsSlot), makeE<EVariable>(rhsSlot)));
+    auto compiledExpr = compileExpression(*dotProductExpr);
+
+    // Non-array operand.
+    lhsAccessor.reset(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1));
+    auto [rhsTag, rhsVal] = makeArray(BSON_ARRAY(1.0 << 2.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertNothing(compiledExpr.get());
+
+    // Arrays of different lengths.
+    auto [lhsTag, lhsVal] = makeArray(BSON_ARRAY(1.0 << 2.0 << 3.0));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(1.0 << 2.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertNothing(compiledExpr.get());
+
+    // Non-numeric element.
+    std::tie(lhsTag, lhsVal) = makeArray(BSON_ARRAY(1.0 << "foo"));
+    lhsAccessor.reset(lhsTag, lhsVal);
+    std::tie(rhsTag, rhsVal) = makeArray(BSON_ARRAY(1.0 << 2.0));
+    rhsAccessor.reset(rhsTag, rhsVal);
+    runAndAssertNothing(compiledExpr.get());
+}
+}  // namespace mongo::sbe
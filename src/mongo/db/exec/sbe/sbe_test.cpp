@@ -291,6 +291,42 @@ TEST(SBEVM, Add) {
     }
 }
 
+TEST(SBEVM, GetFieldImm) {
+    auto [objTag, objVal] = value::makeNewObject();
+    value::ValueGuard objGuard{objTag, objVal};
+    auto obj = value::getObjectView(objVal);
+    obj->push_back("field"_sd, value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(42));
+
+    auto [fieldTag, fieldVal] = value::makeNewString("field"_sd);
+    value::ValueGuard fieldGuard{fieldTag, fieldVal};
+
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(objTag, objVal);
+        code.appendGetField(fieldTag, fieldVal);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::NumberInt64);
+        ASSERT_EQUALS(value::bitcastTo<int64_t>(val), 42);
+    }
+    {
+        // A missing field produces Nothing, the same as the unfused 'getField' instruction.
+        auto [missingTag, missingVal] = value::makeNewString("missing"_sd);
+        value::ValueGuard missingGuard{missingTag, missingVal};
+
+        vm::CodeFragment code;
+        code.appendConstVal(objTag, objVal);
+        code.appendGetField(missingTag, missingVal);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQUALS(tag, value::TypeTags::Nothing);
+    }
+}
+
 TEST(SBEVM, CompareBinData) {
     {
         uint8_t byteArray1[] = {1, 2, 3, 4};
@@ -32,6 +32,7 @@
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
+#include "mongo/db/query/operation_memory_usage_tracker.h"
 #include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/util/str.h"
@@ -128,7 +129,7 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         _inKeyAccessors.emplace_back(_children[0]->getAccessor(ctx, slot));
 
         // Construct accessors for the key to be processed from either the '_ht' or the
-        // '_recordStore'. Before the memory limit is reached the '_outHashKeyAccessors' will carry
+        // spilled record stores. Before the memory limit is reached the '_outHashKeyAccessors' will carry
         // the group-by keys, otherwise the '_outRecordStoreKeyAccessors' will carry the group-by
         // keys.
         _outHashKeyAccessors.emplace_back(std::make_unique<HashKeyAccessor>(_htIt, counter));
@@ -138,8 +139,8 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         counter++;
 
         // A SwitchAccessor is used to point the '_outKeyAccessors' to the key coming from the '_ht'
-        // or the '_recordStore' when draining the HashAgg stage in getNext. The group-by key will
-        // either be in the '_ht' or the '_recordStore' if the key lives in memory, or if the key
+        // or the spill partitions' record stores when draining the HashAgg stage in getNext. The group-by key will
+        // either be in the '_ht' or a spilled record store if the key lives in memory, or if the key
         // has been spilled to disk, respectively. The SwitchAccessor allows toggling between the
         // two so the parent stage can read it through the '_outAccessors'.
         _outKeyAccessors.emplace_back(
@@ -165,16 +166,16 @@ void HashAggStage::prepare(CompileCtx& ctx) {
         uassert(4822828, str::stream() << "duplicate field: " << slotId, inserted);
 
         // Construct accessors for the agg state to be processed from either the '_ht' or the
-        // '_recordStore' by the SwitchAccessor owned by '_outAggAccessors' below.
+        // spilled record stores by the SwitchAccessor owned by '_outAggAccessors' below.
         _outRecordStoreAggAccessors.emplace_back(
             std::make_unique<value::MaterializedSingleRowAccessor>(_aggValueRecordStore, counter));
         _outHashAggAccessors.emplace_back(std::make_unique<HashAggAccessor>(_htIt, counter));
         counter++;
 
         // A SwitchAccessor is used to toggle the '_outAggAccessors' between the '_ht' and the
-        // '_recordStore' when updating the agg state via the bytecode. By compiling the agg
+        // spilled record stores when updating the agg state via the bytecode. By compiling the agg
         // EExpressions with a SwitchAccessor we can load the agg value into the of memory
-        // '_aggValueRecordStore' if the value comes from the '_recordStore' or we can use the
+        // '_aggValueRecordStore' if the value comes from a spilled record store or we can use the
         // agg value referenced through '_htIt' and run the bytecode to mutate the value through the
         // SwitchAccessor.
         _outAggAccessors.emplace_back(
@@ -240,12 +241,22 @@ void HashAggStage::makeTemporaryRecordStore() {
             "No storage engine so HashAggStage cannot spill to disk",
             _opCtx->getServiceContext()->getStorageEngine());
     assertIgnorePrepareConflictsBehavior(_opCtx);
-    _recordStore = _opCtx->getServiceContext()->getStorageEngine()->makeTemporaryRecordStore(
-        _opCtx, KeyFormat::String);
+    _spillPartitions.reserve(kSpillPartitions);
+    for (size_t partition = 0; partition < kSpillPartitions; ++partition) {
+        _spillPartitions.emplace_back(
+            _opCtx->getServiceContext()->getStorageEngine()->makeTemporaryRecordStore(
+                _opCtx, KeyFormat::String));
+    }
 
     _specificStats.usedDisk = true;
 }
 
+RecordStore* HashAggStage::spillPartitionFor(const RecordId& rid) {
+    auto rawKey = rid.getStr();
+    auto hash = absl::Hash<absl::string_view>{}(absl::string_view{rawKey.rawData(), rawKey.size()});
+    return _spillPartitions[hash % kSpillPartitions]->rs();
+}
+
 void HashAggStage::spillRowToDisk(const value::MaterializedRow& key,
                                   const value::MaterializedRow& val) {
     KeyString::Builder kb{KeyString::Version::kLatestVersion};
@@ -274,12 +285,12 @@ void HashAggStage::spillValueToDisk(const RecordId& key,
 
     WriteUnitOfWork wuow(_opCtx);
 
+    auto* rs = spillPartitionFor(key);
     auto result = mongo::Status::OK();
     if (update) {
-        result = _recordStore->rs()->updateRecord(_opCtx, key, bufValue.buf(), bufValue.len());
+        result = rs->updateRecord(_opCtx, key, bufValue.buf(), bufValue.len());
     } else {
-        auto status = _recordStore->rs()->insertRecord(
-            _opCtx, key, bufValue.buf(), bufValue.len(), Timestamp{});
+        auto status = rs->insertRecord(_opCtx, key, bufValue.buf(), bufValue.len(), Timestamp{});
         result = status.getStatus();
     }
     wuow.commit();
@@ -295,7 +306,7 @@ void HashAggStage::spillValueToDisk(const RecordId& key,
 
 boost::optional<value::MaterializedRow> HashAggStage::getFromRecordStore(const RecordId& rid) {
     RecordData record;
-    if (_recordStore->rs()->findRecord(_opCtx, rid, &record)) {
+    if (spillPartitionFor(rid)->findRecord(_opCtx, rid, &record)) {
         auto valueReader = BufReader(record.data(), record.size());
         return value::MaterializedRow::deserializeForSorter(valueReader, {});
     } else {
@@ -333,7 +344,7 @@ void HashAggStage::checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd) {
                     "Exceeded memory limit for $group, but didn't allow external spilling."
                     " Pass allowDiskUse:true to opt in.",
                     _allowDiskUse);
-            if (!_recordStore) {
+            if (_spillPartitions.empty()) {
                 makeTemporaryRecordStore();
             }
 
@@ -348,6 +359,8 @@ void HashAggStage::checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd) {
             estimatedTotalSize = _ht->size() * estimatedRowSize;
         }
 
+        OperationMemoryUsageTracker::get(_opCtx).set(this, estimatedTotalSize);
+
         // Calculate the next memory checkpoint. We estimate it based on the prior growth of the
         // '_ht' and the remaining available memory. We have to keep doing this even after starting
         // to spill because some accumulators can grow in size inside '_ht' (with no bounds).
@@ -406,7 +419,7 @@ void HashAggStage::open(bool reOpen) {
                 key.reset(idx++, false, tag, val);
             }
 
-            if (!_recordStore) {
+            if (_spillPartitions.empty()) {
                 // The memory limit hasn't been reached yet, accumulate state in '_ht'.
                 auto [it, inserted] = _ht->try_emplace(std::move(key), value::MaterializedRow{0});
                 if (inserted) {
@@ -436,7 +449,7 @@ void HashAggStage::open(bool reOpen) {
                 }
             } else {
                 // The memory limit has been reached and the key wasn't in the '_ht' so we need
-                // to spill it to the '_recordStore'.
+                // to spill it to its spill partition.
                 KeyString::Builder kb{KeyString::Version::kLatestVersion};
                 // 'key' is moved only when 'updateAggStateHt' ends up "true", so it's safe to
                 // ignore the warning.
@@ -493,18 +506,19 @@ void HashAggStage::open(bool reOpen) {
     _htIt = _ht->end();
 
     // Set the SwitchAccessors to point to the '_ht' so we can drain it first before draining the
-    // '_recordStore' in getNext().
+    // spill partitions in getNext().
     for (size_t idx = 0; idx < _outAggAccessors.size(); ++idx) {
         _outAggAccessors[idx]->setIndex(0);
     }
     _drainingRecordStore = false;
+    _drainingPartition = 0;
 }
 
 PlanState HashAggStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
     if (_htIt == _ht->end() && !_drainingRecordStore) {
-        // First invocation of getNext() after open() when not draining the '_recordStore'.
+        // First invocation of getNext() after open() when not draining the spill partitions.
         if (!_seekKeysAccessors.empty()) {
             _htIt = _ht->find(_seekKeys);
         } else {
@@ -514,25 +528,31 @@ PlanState HashAggStage::getNext() {
         // Subsequent invocation with seek keys. Return only 1 single row (if any).
         _htIt = _ht->end();
     } else if (!_drainingRecordStore) {
-        // Returning the results of the entire hash table first before draining the '_recordStore'.
+        // Returning the results of the entire hash table first before draining the spill
+        // partitions.
         ++_htIt;
     }
 
-    if (_htIt == _ht->end() && !_recordStore) {
+    if (_htIt == _ht->end() && _spillPartitions.empty()) {
         // The hash table has been drained and nothing was spilled to disk.
         return trackPlanState(PlanState::IS_EOF);
     } else if (_htIt != _ht->end()) {
         // Drain the '_ht' on the next 'getNext()' call.
         return trackPlanState(PlanState::ADVANCED);
     } else if (_seekKeysAccessors.empty()) {
-        // A record store was created to spill to disk. Drain it then clean it up.
+        // Record stores were created to spill to disk. Drain the spill partitions one after
+        // another, then clean them up.
         if (!_rsCursor) {
-            _rsCursor = _recordStore->rs()->getCursor(_opCtx);
+            _rsCursor = _spillPartitions[_drainingPartition]->rs()->getCursor(_opCtx);
         }
         auto nextRecord = _rsCursor->next();
+        while (!nextRecord && ++_drainingPartition < kSpillPartitions) {
+            _rsCursor = _spillPartitions[_drainingPartition]->rs()->getCursor(_opCtx);
+            nextRecord = _rsCursor->next();
+        }
         if (nextRecord) {
             // Point the out accessors to the recordStore accessors to allow parent stages to read
-            // the agg state from the '_recordStore'.
+            // the agg state from the spilled record stores.
             if (!_drainingRecordStore) {
                 for (size_t i = 0; i < _outKeyAccessors.size(); ++i) {
                     _outKeyAccessors[i]->setIndex(1);
@@ -543,7 +563,7 @@ PlanState HashAggStage::getNext() {
             }
             _drainingRecordStore = true;
 
-            // Read the agg state value from the '_recordStore' and Reconstruct the key from the
+            // Read the agg state value from the record store and Reconstruct the key from the
             // typeBits stored along side of the value.
             BufReader valReader(nextRecord->data.data(), nextRecord->data.size());
             auto val = value::MaterializedRow::deserializeForSorter(valReader, {});
@@ -557,7 +577,7 @@ PlanState HashAggStage::getNext() {
             return trackPlanState(PlanState::ADVANCED);
         } else {
             _rsCursor.reset();
-            _recordStore.reset();
+            _spillPartitions.clear();
             return trackPlanState(PlanState::IS_EOF);
         }
     } else {
@@ -601,10 +621,12 @@ void HashAggStage::close() {
 
     trackClose();
     _ht = boost::none;
-    if (_recordStore) {
-        // A record store was created to spill to disk. Clean it up.
-        _recordStore.reset();
+    if (!_spillPartitions.empty()) {
+        // Record stores were created to spill to disk. Clean them up.
+        _rsCursor.reset();
+        _spillPartitions.clear();
         _drainingRecordStore = false;
+        _drainingPartition = 0;
     }
 
     if (_childOpened) {
@@ -113,18 +113,26 @@ private:
     void makeTemporaryRecordStore();
 
     /**
-     * Spills a key and value pair to the '_recordStore' where the semantics are insert or update
+     * Returns the spill partition the 'rid' key belongs to. Spilled rows are hash-partitioned
+     * across 'kSpillPartitions' temporary record stores so that each partition's backing B-tree
+     * stays small, which keeps the point lookups done by 'spillValueToDisk()' cheap even for very
+     * high cardinality groupings. Partitions are drained one at a time in 'getNext()'.
+     */
+    RecordStore* spillPartitionFor(const RecordId& rid);
+
+    /**
+     * Spills a key and value pair to its spill partition where the semantics are insert or update
      * depending on the 'update' flag. When the 'update' flag is true this method already expects
-     * the 'key' to be inserted into the '_recordStore', otherwise the 'key' and 'val' pair are
-     * fresh.
+     * the 'key' to be inserted into the partition's record store, otherwise the 'key' and 'val'
+     * pair are fresh.
      *
      * This method expects the key to be seralized into a KeyString::Value so that the key is
-     * memcmp-able and lookups can be done to update the 'val' in the '_recordStore'. Note that the
+     * memcmp-able and lookups can be done to update the 'val' in the record store. Note that the
      * 'typeBits' are needed to reconstruct the spilled 'key' when calling 'getNext' to deserialize
-     * the 'key' to a MaterializedRow. Since the '_recordStore' only stores the memcmp-able part of
+     * the 'key' to a MaterializedRow. Since the record store only stores the memcmp-able part of
      * the KeyString we need to carry the 'typeBits' separately, and we do this by appending the
      * 'typeBits' to the end of the serialized 'val' buffer and store them at the leaves of the
-     * backing B-tree of the '_recordStore'. used as the RecordId.
+     * backing B-tree of the record store. used as the RecordId.
      */
     void spillValueToDisk(const RecordId& key,
                           const value::MaterializedRow& val,
@@ -136,8 +144,8 @@ private:
     /**
      * We check amount of used memory every T processed incoming records, where T is calculated
      * based on the estimated used memory and its recent growth. When the memory limit is exceeded,
-     * 'checkMemoryUsageAndSpillIfNecessary()' will create '_recordStore' and might spill some of
-     * the already accumulated data into it.
+     * 'checkMemoryUsageAndSpillIfNecessary()' will create the spill partitions and might spill
+     * some of the already accumulated data into them.
      */
     struct MemoryCheckData {
         const double checkpointMargin = internalQuerySBEAggMemoryUseCheckMargin.load();
@@ -176,11 +184,11 @@ private:
     std::vector<value::SlotAccessor*> _inKeyAccessors;
 
     // Accesors for the key stored in '_ht', a SwitchAccessor is used so we can produce the key from
-    // either the '_ht' or the '_recordStore'.
+    // either the '_ht' or the spilled record stores.
     std::vector<std::unique_ptr<HashKeyAccessor>> _outHashKeyAccessors;
     std::vector<std::unique_ptr<value::SwitchAccessor>> _outKeyAccessors;
 
-    // Accessor for the agg state value stored in the '_recordStore' when data is spilled to disk.
+    // Accessor for the agg state value stored in a spill partition when data is spilled to disk.
     value::MaterializedRow _aggKeyRecordStore{0};
     value::MaterializedRow _aggValueRecordStore{0};
     std::vector<std::unique_ptr<value::MaterializedSingleRowAccessor>> _outRecordStoreKeyAccessors;
@@ -190,7 +198,7 @@ private:
     value::MaterializedRow _seekKeys;
 
     // Accesors for the agg state in '_ht', a SwitchAccessor is used so we can produce the agg state
-    // from either the '_ht' or the '_recordStore' when draining the HashAgg stage.
+    // from either the '_ht' or the spilled record stores when draining the HashAgg stage.
     std::vector<std::unique_ptr<value::SwitchAccessor>> _outAggAccessors;
     std::vector<std::unique_ptr<HashAggAccessor>> _outHashAggAccessors;
     std::vector<std::unique_ptr<vm::CodeFragment>> _aggCodes;
@@ -206,11 +214,16 @@ private:
     bool _compiled{false};
     bool _childOpened{false};
 
-    // Memory tracking and spilling to disk.
+    // Memory tracking and spilling to disk. Spilled rows are hash-partitioned across
+    // 'kSpillPartitions' temporary record stores; '_spillPartitions' is empty until the memory
+    // limit is first exceeded. When draining, '_drainingPartition' tracks the partition the
+    // '_rsCursor' is positioned on.
+    static constexpr size_t kSpillPartitions = 8;
     const long long _approxMemoryUseInBytesBeforeSpill =
         internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
-    std::unique_ptr<TemporaryRecordStore> _recordStore;
+    std::vector<std::unique_ptr<TemporaryRecordStore>> _spillPartitions;
     bool _drainingRecordStore{false};
+    size_t _drainingPartition{0};
     std::unique_ptr<SeekableRecordCursor> _rsCursor;
 
     HashAggStats _specificStats;
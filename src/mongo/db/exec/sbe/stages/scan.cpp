@@ -81,6 +81,9 @@ ScanStage::ScanStage(UUID collectionUuid,
                  _fields.end()));
     // We cannot use a random cursor if we are seeking or requesting a reverse scan.
     invariant(!_useRandomCursor || (!_seekKeySlot && _forward));
+
+    _useBatchedReads = !_seekKeySlot && !_oplogTsSlot && !_useRandomCursor &&
+        !_scanCallbacks.indexKeyConsistencyCheckCallBack;
 }
 
 std::unique_ptr<PlanStage> ScanStage::clone() const {
@@ -341,6 +344,8 @@ void ScanStage::open(bool reOpen) {
 
     _open = true;
     _firstGetNext = true;
+    _bufferedRecords.clear();
+    _bufferedRecordIdx = 0;
 }
 
 PlanState ScanStage::getNext() {
@@ -367,8 +372,24 @@ PlanState ScanStage::getNext() {
     }
 
     auto res = _firstGetNext && _seekKeyAccessor;
-    auto nextRecord = _useRandomCursor ? _randomCursor->next()
-                                       : (res ? _cursor->seekExact(_key) : _cursor->next());
+
+    boost::optional<Record> nextRecord;
+    if (_useBatchedReads) {
+        if (_bufferedRecordIdx == _bufferedRecords.size()) {
+            _bufferedRecords.clear();
+            _bufferedRecordIdx = 0;
+            _cursor->nextBatch(kScanBatchSize, &_bufferedRecords);
+        }
+        if (_bufferedRecordIdx < _bufferedRecords.size()) {
+            // The buffered records are owned copies, so the views installed into the output slots
+            // below remain valid until the buffer is refilled. Copying the 'Record' here only
+            // bumps a reference on the underlying buffer.
+            nextRecord = _bufferedRecords[_bufferedRecordIdx++];
+        }
+    } else {
+        nextRecord = _useRandomCursor ? _randomCursor->next()
+                                      : (res ? _cursor->seekExact(_key) : _cursor->next());
+    }
     _firstGetNext = false;
 
     if (!nextRecord) {
@@ -459,6 +480,8 @@ void ScanStage::close() {
     trackClose();
     _cursor.reset();
     _randomCursor.reset();
+    _bufferedRecords.clear();
+    _bufferedRecordIdx = 0;
     _coll.reset();
     _open = false;
 }
@@ -191,6 +191,15 @@ private:
     RecordId _key;
     bool _firstGetNext{false};
 
+    // When true, 'getNext()' reads records from the storage cursor in batches of 'kScanBatchSize'
+    // owned records rather than one at a time, amortizing the per-record cursor overhead. Batched
+    // reads are only used for plain scans: seeks, random cursors and oplog scans advance the
+    // cursor one record at a time.
+    static constexpr size_t kScanBatchSize = 64;
+    bool _useBatchedReads{false};
+    std::vector<Record> _bufferedRecords;
+    size_t _bufferedRecordIdx = 0;
+
     ScanStats _specificStats;
 
     // Flag set upon restoring the stage that indicates whether the cursor's position in the
@@ -59,6 +59,57 @@ auto abslHash(const T& val) {
 }
 }  // namespace
 
+namespace {
+// Big string buffers at most this large are interchangeable: allocateBigStringBuffer() rounds
+// such requests up to exactly this many bytes, so a cached buffer can satisfy any of them.
+constexpr uint32_t kCachedStringBufferBytes = 256;
+
+// Bounds the per-thread memory parked in the cache to 16KB.
+constexpr size_t kStringBufferCacheCapacity = 64;
+
+struct BigStringBufferCache {
+    ~BigStringBufferCache() {
+        while (size > 0) {
+            delete[] buffers[--size];
+        }
+    }
+
+    char* buffers[kStringBufferCacheCapacity];
+    size_t size = 0;
+};
+
+thread_local BigStringBufferCache bigStringBufferCache;
+}  // namespace
+
+char* allocateBigStringBuffer(uint32_t length) {
+    const uint32_t bytes = length + 5;
+    if (bytes <= kCachedStringBufferBytes) {
+        auto& cache = bigStringBufferCache;
+        if (cache.size > 0) {
+            return cache.buffers[--cache.size];
+        }
+        return new char[kCachedStringBufferBytes];
+    }
+    return new char[bytes];
+}
+
+namespace {
+void releaseBigStringBuffer(char* buf) noexcept {
+    // The allocated size can be recovered from the length prefix, since every cacheable buffer
+    // was rounded up to 'kCachedStringBufferBytes' on allocation.
+    const auto bytes =
+        static_cast<uint32_t>(ConstDataView(buf).read<LittleEndian<int32_t>>()) + 4;
+    if (bytes <= kCachedStringBufferBytes) {
+        auto& cache = bigStringBufferCache;
+        if (cache.size < kStringBufferCacheCapacity) {
+            cache.buffers[cache.size++] = buf;
+            return;
+        }
+    }
+    delete[] buf;
+}
+}  // namespace
+
 std::pair<TypeTags, Value> makeNewBsonRegex(StringData pattern, StringData flags) {
     // Add 2 to account NULL bytes after pattern and flags.
     auto totalSize = pattern.size() + flags.size() + 2;
@@ -287,6 +338,10 @@ void releaseValue(TypeTags tag, Value val) noexcept {
             break;
         case TypeTags::StringBig:
         case TypeTags::bsonSymbol:
+            // Both tags share the big string representation, and every owned buffer of that
+            // representation comes from allocateBigStringBuffer().
+            releaseBigStringBuffer(getRawPointerView(val));
+            break;
         case TypeTags::bsonObjectId:
         case TypeTags::bsonBinData:
         case TypeTags::bsonRegex:
@@ -1111,6 +1111,14 @@ inline std::pair<TypeTags, Value> makeSmallString(StringData input) {
     return {TypeTags::StringSmall, smallString};
 }
 
+/**
+ * Returns a buffer suitable for holding a big string of 'length' characters plus the length prefix
+ * and NUL terminator. Short-lived strings churn through the SBE inner loop, so small requests are
+ * served from a thread-local cache of uniformly sized buffers that releaseValue() refills, keeping
+ * the allocator out of the hot path.
+ */
+char* allocateBigStringBuffer(uint32_t length);
+
 inline std::pair<TypeTags, Value> makeBigString(StringData input) {
     auto len = input.size();
     auto ptr = input.rawData();
@@ -1118,7 +1126,7 @@ inline std::pair<TypeTags, Value> makeBigString(StringData input) {
     invariant(len < static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
 
     auto length = static_cast<uint32_t>(len);
-    auto buf = new char[length + 5];
+    auto buf = allocateBigStringBuffer(length);
     DataView(buf).write<LittleEndian<int32_t>>(length + 1);
     memcpy(buf + 4, ptr, length);
     buf[length + 4] = 0;
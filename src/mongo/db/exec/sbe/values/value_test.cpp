@@ -301,4 +301,28 @@ TEST_F(SbeValueTest, CompareTwoValueMapTypes) {
     valueMapTypeInequalityComparisonTestGenFn(addMultipleDecimalKeyFn, addObjectKeyFn);
 }
 
+TEST_F(SbeValueTest, BigStringsSurviveBufferReuse) {
+    // Churn strings of assorted lengths through makeNewString()/releaseValue() so later
+    // allocations are served from the thread-local big string buffer cache, and verify that a
+    // recycled buffer carries the new string's exact length and contents.
+    const std::vector<size_t> lengths = {8, 32, 100, 251, 252, 1000};
+
+    for (size_t outer : lengths) {
+        auto [tmpTag, tmpVal] = value::makeNewString(std::string(outer, 'x'));
+        value::releaseValue(tmpTag, tmpVal);
+
+        for (size_t inner : lengths) {
+            const std::string expected(inner, 'a' + static_cast<char>(inner % 26));
+            auto [tag, val] = value::makeNewString(expected);
+            value::ValueGuard guard{tag, val};
+
+            if (inner > value::kSmallStringMaxLength) {
+                ASSERT_EQ(tag, value::TypeTags::StringBig);
+            }
+            ASSERT_EQ(value::getStringLength(tag, val), inner);
+            ASSERT_EQ(value::getStringView(tag, val), StringData{expected});
+        }
+    }
+}
+
 }  // namespace mongo::sbe
@@ -35,6 +35,7 @@
 #include "mongo/db/exec/sbe/vm/vm.h"
 
 #include <boost/algorithm/string.hpp>
+#include <cmath>
 #include <pcre.h>
 
 #include "mongo/bson/oid.h"
@@ -106,6 +107,7 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
 
     -1,  // fillEmpty
     -1,  // getField
+    0,   // getFieldImm
     -1,  // getElement
     -1,  // collComparisonKey
     -1,  // getFieldOrElement
@@ -256,7 +258,8 @@ std::string CodeFragment::toString() const {
                 break;
             }
             // Instructions with other kinds of arguments.
-            case Instruction::pushConstVal: {
+            case Instruction::pushConstVal:
+            case Instruction::getFieldImm: {
                 auto tag = readFromMemory<value::TypeTags>(pcPointer);
                 pcPointer += sizeof(tag);
                 auto val = readFromMemory<value::Value>(pcPointer);
@@ -478,6 +481,18 @@ void CodeFragment::appendGetField() {
     appendSimpleInstruction(Instruction::getField);
 }
 
+void CodeFragment::appendGetField(value::TypeTags tag, value::Value val) {
+    Instruction i;
+    i.tag = Instruction::getFieldImm;
+    adjustStackSimple(i);
+
+    auto offset = allocateSpace(sizeof(Instruction) + sizeof(tag) + sizeof(val));
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, tag);
+    offset += writeToMemory(offset, val);
+}
+
 void CodeFragment::appendGetElement() {
     appendSimpleInstruction(Instruction::getElement);
 }
@@ -2729,6 +2744,114 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinTanh(ArityType
     return genericTanh(operandTag, operandValue);
 }
 
+namespace {
+/**
+ * Appends the elements of an array-like value to 'out' coerced to double. Returns false if the
+ * value is not an array or any element is non-numeric. The elements are materialized into a
+ * contiguous buffer first so the distance kernels below are tight loops over doubles that the
+ * compiler can vectorize, instead of per-element tag dispatch.
+ */
+bool extractNumericArray(value::TypeTags tag, value::Value val, std::vector<double>* out) {
+    if (!value::isArray(tag)) {
+        return false;
+    }
+    if (tag == value::TypeTags::Array) {
+        out->reserve(value::getArrayView(val)->size());
+    }
+    for (value::ArrayEnumerator enumerator(tag, val); !enumerator.atEnd(); enumerator.advance()) {
+        auto [elemTag, elemVal] = enumerator.getViewOfValue();
+        switch (elemTag) {
+            case value::TypeTags::NumberDouble:
+                out->push_back(value::bitcastTo<double>(elemVal));
+                break;
+            case value::TypeTags::NumberInt32:
+                out->push_back(static_cast<double>(value::bitcastTo<int32_t>(elemVal)));
+                break;
+            case value::TypeTags::NumberInt64:
+                out->push_back(static_cast<double>(value::bitcastTo<int64_t>(elemVal)));
+                break;
+            case value::TypeTags::NumberDecimal:
+                out->push_back(value::bitcastTo<Decimal128>(elemVal).toDouble());
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinDotProduct(ArityType arity) {
+    invariant(arity == 2);
+    auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+    auto [rhsOwned, rhsTag, rhsVal] = getFromStack(1);
+
+    std::vector<double> lhs;
+    std::vector<double> rhs;
+    if (!extractNumericArray(lhsTag, lhsVal, &lhs) || !extractNumericArray(rhsTag, rhsVal, &rhs) ||
+        lhs.size() != rhs.size()) {
+        return {false, value::TypeTags::Nothing, 0};
+    }
+
+    double dot = 0.0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        dot += lhs[i] * rhs[i];
+    }
+    return {false, value::TypeTags::NumberDouble, value::bitcastFrom<double>(dot)};
+}
+
+std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinEuclideanDistance(
+    ArityType arity) {
+    invariant(arity == 2);
+    auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+    auto [rhsOwned, rhsTag, rhsVal] = getFromStack(1);
+
+    std::vector<double> lhs;
+    std::vector<double> rhs;
+    if (!extractNumericArray(lhsTag, lhsVal, &lhs) || !extractNumericArray(rhsTag, rhsVal, &rhs) ||
+        lhs.size() != rhs.size()) {
+        return {false, value::TypeTags::Nothing, 0};
+    }
+
+    double distSquared = 0.0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        auto diff = lhs[i] - rhs[i];
+        distSquared += diff * diff;
+    }
+    return {false, value::TypeTags::NumberDouble, value::bitcastFrom<double>(std::sqrt(distSquared))};
+}
+
+std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinCosineSimilarity(ArityType arity) {
+    invariant(arity == 2);
+    auto [lhsOwned, lhsTag, lhsVal] = getFromStack(0);
+    auto [rhsOwned, rhsTag, rhsVal] = getFromStack(1);
+
+    std::vector<double> lhs;
+    std::vector<double> rhs;
+    if (!extractNumericArray(lhsTag, lhsVal, &lhs) || !extractNumericArray(rhsTag, rhsVal, &rhs) ||
+        lhs.size() != rhs.size()) {
+        return {false, value::TypeTags::Nothing, 0};
+    }
+
+    double dot = 0.0;
+    double lhsNormSquared = 0.0;
+    double rhsNormSquared = 0.0;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        dot += lhs[i] * rhs[i];
+        lhsNormSquared += lhs[i] * lhs[i];
+        rhsNormSquared += rhs[i] * rhs[i];
+    }
+
+    // The cosine of the angle to a zero-length vector is undefined; return Null to match the
+    // corresponding aggregation expression.
+    if (lhsNormSquared == 0.0 || rhsNormSquared == 0.0) {
+        return {false, value::TypeTags::Null, 0};
+    }
+    return {false,
+            value::TypeTags::NumberDouble,
+            value::bitcastFrom<double>(dot / (std::sqrt(lhsNormSquared) * std::sqrt(rhsNormSquared)))};
+}
+
 std::tuple<bool, value::TypeTags, value::Value> ByteCode::builtinRound(ArityType arity) {
     invariant(arity == 1);
     auto [owned, tag, val] = getFromStack(0);
@@ -4196,6 +4319,12 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::dispatchBuiltin(Builti
             return builtinTan(arity);
         case Builtin::tanh:
             return builtinTanh(arity);
+        case Builtin::dotProduct:
+            return builtinDotProduct(arity);
+        case Builtin::euclideanDistance:
+            return builtinEuclideanDistance(arity);
+        case Builtin::cosineSimilarity:
+            return builtinCosineSimilarity(arity);
         case Builtin::round:
             return builtinRound(arity);
         case Builtin::concat:
@@ -4855,6 +4984,23 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     }
                     break;
                 }
+                case Instruction::getFieldImm: {
+                    auto fieldTag = readFromMemory<value::TypeTags>(pcPointer);
+                    pcPointer += sizeof(fieldTag);
+                    auto fieldVal = readFromMemory<value::Value>(pcPointer);
+                    pcPointer += sizeof(fieldVal);
+
+                    auto [objOwned, objTag, objVal] = getFromStack(0);
+
+                    auto [owned, tag, val] = getField(objTag, objVal, fieldTag, fieldVal);
+
+                    topStack(owned, tag, val);
+
+                    if (objOwned) {
+                        value::releaseValue(objTag, objVal);
+                    }
+                    break;
+                }
                 case Instruction::getElement: {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
@@ -275,6 +275,10 @@ struct Instruction {
 
         fillEmpty,
         getField,
+        // Fused getField with the constant field name inlined in the instruction stream. Saves
+        // the dispatch and push/pop of the field name for the common 'getField(slot, "name")'
+        // pattern that predicate-heavy plans execute per document.
+        getFieldImm,
         getElement,
         collComparisonKey,
         getFieldOrElement,
@@ -393,6 +397,8 @@ struct Instruction {
                 return "fillEmpty";
             case getField:
                 return "getField";
+            case getFieldImm:
+                return "getFieldImm";
             case getElement:
                 return "getElement";
             case collComparisonKey:
@@ -532,6 +538,9 @@ enum class Builtin : uint8_t {
     sinh,
     tan,
     tanh,
+    dotProduct,         // dot product of two numeric arrays
+    euclideanDistance,  // euclidean distance between two numeric arrays
+    cosineSimilarity,   // cosine similarity of two numeric arrays
     round,
     isMember,
     collIsMember,
@@ -682,6 +691,11 @@ public:
         appendSimpleInstruction(Instruction::fillEmpty);
     }
     void appendGetField();
+    /**
+     * Emits the fused 'getFieldImm' instruction. 'tag' and 'val' describe the constant field
+     * name; they are embedded as unowned views, so the constant must outlive this code fragment.
+     */
+    void appendGetField(value::TypeTags tag, value::Value val);
     void appendGetElement();
     void appendCollComparisonKey();
     void appendGetFieldOrElement();
@@ -1108,6 +1122,9 @@ private:
     std::tuple<bool, value::TypeTags, value::Value> builtinSinh(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinTan(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinTanh(ArityType arity);
+    std::tuple<bool, value::TypeTags, value::Value> builtinDotProduct(ArityType arity);
+    std::tuple<bool, value::TypeTags, value::Value> builtinEuclideanDistance(ArityType arity);
+    std::tuple<bool, value::TypeTags, value::Value> builtinCosineSimilarity(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinRound(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinConcat(ArityType arity);
     std::tuple<bool, value::TypeTags, value::Value> builtinIsMember(ArityType arity);
@@ -32,6 +32,7 @@
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/sort.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/operation_memory_usage_tracker.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 
 namespace mongo {
@@ -119,6 +120,8 @@ void SortStageDefault::spool(WorkingSetID wsid) {
     SortableWorkingSetMember extractedMember{_ws->extract(wsid)};
     auto sortKey = _sortKeyGen.computeSortKey(*extractedMember);
     _sortExecutor.add(sortKey, extractedMember);
+    OperationMemoryUsageTracker::get(expCtx()->opCtx)
+        .set(this, _sortExecutor.currentMemoryUsageBytes());
 }
 
 PlanStage::StageState SortStageDefault::unspool(WorkingSetID* out) {
@@ -160,6 +163,8 @@ void SortStageSimple::spool(WorkingSetID wsid) {
     auto sortKey = _sortKeyGen.computeSortKeyFromDocument(member->doc.value());
 
     _sortExecutor.add(std::move(sortKey), member->doc.value().toBson());
+    OperationMemoryUsageTracker::get(expCtx()->opCtx)
+        .set(this, _sortExecutor.currentMemoryUsageBytes());
     _ws->free(wsid);
 }
 
@@ -118,6 +118,15 @@ public:
         return _stats;
     }
 
+    /**
+     * Returns the current amount of memory consumed by data buffered in the sorter. Only
+     * meaningful during the loading phase; once 'loadingDone()' is called the sorter is released
+     * and any in-memory data is owned by the output iterator instead.
+     */
+    size_t currentMemoryUsageBytes() const {
+        return _sorter ? _sorter->memUsed() : 0;
+    }
+
     /**
      * Add data item to be sorted of type T with sort key specified by Value to the sort executor.
      * Should only be called before 'loadingDone()' is called.
@@ -55,6 +55,7 @@
 #include "mongo/db/s/sharding_write_router.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/duplicate_key_error_info.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/path_support.h"
 #include "mongo/db/update/storage_validation.h"
 #include "mongo/logv2/log.h"
@@ -131,10 +132,10 @@ UpdateStage::UpdateStage(ExpressionContext* expCtx,
     : RequiresMutableCollectionStage(kStageType.rawData(), expCtx, collection),
       _params(params),
       _ws(ws),
+      _updatedRecordIds(params.request->isMulti() ? new RecordIdSet() : nullptr),
       _doc(params.driver->getDocument()),
       _idRetrying(WorkingSet::INVALID_ID),
       _idReturning(WorkingSet::INVALID_ID),
-      _updatedRecordIds(params.request->isMulti() ? new RecordIdSet() : nullptr),
       _preWriteFilter(opCtx(), collection->ns()) {
 
     // Should the modifiers validate their embedded docs via storage_validation::scanDocument()?
@@ -191,6 +192,12 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
         immutablePaths.keepShortest(&idFieldRef);
     }
 
+    // When the collection has a validator, have the driver track which paths the update modifies
+    // so that schema validation can be skipped if the validator cannot be affected (see
+    // CollectionImpl::updateDocument()). Tracking is not free, so skip it otherwise.
+    const bool trackModifiedPaths = !collection()->getValidatorDoc().isEmpty();
+    FieldRefSetWithStorage modifiedPaths;
+
     if (!driver->needMatchDetails()) {
         // If we don't need match details, avoid doing the rematch
         status = driver->update(opCtx(),
@@ -200,7 +207,8 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
                                 immutablePaths,
                                 isInsert,
                                 &logObj,
-                                &docWasModified);
+                                &docWasModified,
+                                trackModifiedPaths ? &modifiedPaths : nullptr);
     } else {
         // If there was a matched field, obtain it.
         MatchDetails matchDetails;
@@ -220,7 +228,8 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
                                 immutablePaths,
                                 isInsert,
                                 &logObj,
-                                &docWasModified);
+                                &docWasModified,
+                                trackModifiedPaths ? &modifiedPaths : nullptr);
     }
 
     if (!status.isOK()) {
@@ -317,14 +326,52 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
                     args.preImageDoc = oldObj.value().getOwned();
                 }
 
+                // Delta updates replace the whole document in the mutable bson layer even when
+                // the diff only touches a few bytes. When the diff cannot affect any index
+                // entries, translate it into damage events instead so that the storage engine
+                // can apply a partial update to the record and journal only the changed byte
+                // ranges rather than the full document. Requiring the pre-image to lead with
+                // '_id' guarantees that '_ensureIdFieldIsFirst()' above was a no-op, since a diff
+                // never reorders existing fields, so the damage events produce the same post-image
+                // as the mutable document.
+                const bool updateAsDamages = driver->type() == UpdateDriver::UpdateType::kDelta &&
+                    !driver->modsAffectIndices() && !collection()->isCapped() &&
+                    collection()->updateWithDamagesSupported() &&
+                    oldObj.value().firstElementFieldNameStringData() == idFieldName;
+
                 WriteUnitOfWork wunit(opCtx());
-                newRecordId = collection()->updateDocument(opCtx(),
-                                                           recordId,
-                                                           oldObj,
-                                                           newObj,
-                                                           driver->modsAffectIndices(),
-                                                           _params.opDebug,
-                                                           &args);
+                if (updateAsDamages) {
+                    const auto& updateMod = request->getUpdateModification();
+                    auto damagesOutput = doc_diff::computeDamages(
+                        oldObj.value(),
+                        updateMod.getDiff(),
+                        updateMod.mustCheckExistenceForInsertOperations());
+
+                    const RecordData oldRec(oldObj.value().objdata(), oldObj.value().objsize());
+                    Snapshotted<RecordData> snap(oldObj.snapshotId(), oldRec);
+
+                    StatusWith<RecordData> newRecStatus =
+                        collection()->updateDocumentWithDamages(opCtx(),
+                                                                recordId,
+                                                                std::move(snap),
+                                                                damagesOutput.damageSource.get(),
+                                                                damagesOutput.damages,
+                                                                &args);
+                    newObj = uassertStatusOK(std::move(newRecStatus)).releaseToBson();
+                    newRecordId = recordId;
+                } else {
+                    if (trackModifiedPaths) {
+                        const auto paths = modifiedPaths.serialize();
+                        args.modifiedPaths.emplace(paths.begin(), paths.end());
+                    }
+                    newRecordId = collection()->updateDocument(opCtx(),
+                                                               recordId,
+                                                               oldObj,
+                                                               newObj,
+                                                               driver->modsAffectIndices(),
+                                                               _params.opDebug,
+                                                               &args);
+                }
                 invariant(oldObj.snapshotId() == opCtx()->recoveryUnit()->getSnapshotId());
                 wunit.commit();
             }
@@ -138,11 +138,35 @@ protected:
     void _checkRestrictionsOnUpdatingShardKeyAreNotViolated(
         const ScopedCollectionDescription& collDesc, const FieldRefSet& shardKeyPaths);
 
+    /**
+     * Computes the result of applying mods to the document 'oldObj' at RecordId 'recordId' in
+     * memory, then commits these changes to the database. Returns a possibly unowned copy
+     * of the newly-updated version of the document.
+     */
+    BSONObj transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
+                               RecordId& recordId,
+                               bool writeOnOrphan);
+
     UpdateStageParams _params;
 
     // Not owned by us.
     WorkingSet* _ws;
 
+    // If the update was in-place, we may see it again.  This only matters if we're doing
+    // a multi-update; if we're not doing a multi-update we stop after one update and we
+    // won't see any more docs.
+    //
+    // For example: If we're scanning an index {x:1} and performing {$inc:{x:5}}, we'll keep
+    // moving the document forward and it will continue to reappear in our index scan.
+    // Unless the index is multikey, the underlying query machinery won't de-dup.
+    //
+    // If the update wasn't in-place we may see it again.  Our query may return the new
+    // document and we wouldn't want to update that.
+    //
+    // So, no matter what, we keep track of where the doc wound up.
+    typedef stdx::unordered_set<RecordId, RecordId::Hasher> RecordIdSet;
+    const std::unique_ptr<RecordIdSet> _updatedRecordIds;
+
     // Stats
     UpdateStats _specificStats;
 
@@ -155,15 +179,6 @@ protected:
     mutablebson::DamageVector _damages;
 
 private:
-    /**
-     * Computes the result of applying mods to the document 'oldObj' at RecordId 'recordId' in
-     * memory, then commits these changes to the database. Returns a possibly unowned copy
-     * of the newly-updated version of the document.
-     */
-    BSONObj transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
-                               RecordId& recordId,
-                               bool writeOnOrphan);
-
     /**
      * Stores 'idToRetry' in '_idRetrying' so the update can be retried during the next call to
      * doWork(). Always returns NEED_YIELD and sets 'out' to WorkingSet::INVALID_ID.
@@ -208,21 +223,6 @@ private:
     // If not WorkingSet::INVALID_ID, we return this member to our caller.
     WorkingSetID _idReturning;
 
-    // If the update was in-place, we may see it again.  This only matters if we're doing
-    // a multi-update; if we're not doing a multi-update we stop after one update and we
-    // won't see any more docs.
-    //
-    // For example: If we're scanning an index {x:1} and performing {$inc:{x:5}}, we'll keep
-    // moving the document forward and it will continue to reappear in our index scan.
-    // Unless the index is multikey, the underlying query machinery won't de-dup.
-    //
-    // If the update wasn't in-place we may see it again.  Our query may return the new
-    // document and we wouldn't want to update that.
-    //
-    // So, no matter what, we keep track of where the doc wound up.
-    typedef stdx::unordered_set<RecordId, RecordId::Hasher> RecordIdSet;
-    const std::unique_ptr<RecordIdSet> _updatedRecordIds;
-
     /**
      * This member is used to check whether the write should be performed, and if so, any other
      * behavior that should be done as part of the write (e.g. skipping it because it affects an
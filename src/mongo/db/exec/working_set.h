@@ -30,6 +30,7 @@
 #pragma once
 
 #include "boost/optional.hpp"
+#include <memory>
 #include <vector>
 
 #include "mongo/db/exec/document_value/document.h"
@@ -321,22 +322,22 @@ public:
      * release it.
      */
     WorkingSetMember* get(WorkingSetID i) {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                       // ID has been allocated.
+        dassert(_holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &_holder(i).member;
     }
 
     const WorkingSetMember* get(WorkingSetID i) const {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                       // ID has been allocated.
+        dassert(_holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &_holder(i).member;
     }
 
     /**
      * Returns true if WorkingSetMember with id 'i' is free.
      */
     bool isFree(WorkingSetID i) const {
-        return _data[i].nextFreeOrSelf != i;
+        return _holder(i).nextFreeOrSelf != i;
     }
 
     /**
@@ -397,13 +398,29 @@ private:
         WorkingSetMember member;
     };
 
-    // All WorkingSetIDs are indexes into this, except for INVALID_ID.
-    // Elements are added to _freeList rather than removed when freed.
-    std::vector<MemberHolder> _data;
+    MemberHolder& _holder(WorkingSetID i) {
+        return _slabs[i >> kSlabSizeLog2][i & (kSlabSize - 1)];
+    }
+
+    const MemberHolder& _holder(WorkingSetID i) const {
+        return _slabs[i >> kSlabSizeLog2][i & (kSlabSize - 1)];
+    }
 
-    // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
-    // link. INVALID_ID is the list terminator since 0 is a valid index.
-    // If _freeList == INVALID_ID, the free list is empty and all elements in _data are in use.
+    // Members live in fixed-capacity slabs that are never relocated, so growing the working set
+    // allocates one new slab instead of moving every live member the way a flat vector does when
+    // it reallocates. All WorkingSetIDs except INVALID_ID are logical indexes into this two-level
+    // structure: the slab number in the high bits and the slot within the slab in the low bits.
+    // Slots are added to _freeList rather than removed when freed.
+    static constexpr size_t kSlabSizeLog2 = 6;
+    static constexpr size_t kSlabSize = size_t{1} << kSlabSizeLog2;
+    std::vector<std::unique_ptr<MemberHolder[]>> _slabs;
+
+    // The number of member slots handed out so far, which is also the next unused logical index.
+    size_t _size = 0;
+
+    // Logical index forming a linked-list using MemberHolder::nextFreeOrSelf as the next link.
+    // INVALID_ID is the list terminator since 0 is a valid index.
+    // If _freeList == INVALID_ID, the free list is empty and all allocated slots are in use.
     WorkingSetID _freeList;
 
     // Holds IndexAccessMethods that have been registered with 'registerIndexAccessMethod()`. The
@@ -87,6 +87,38 @@ TEST_F(WorkingSetFixture, noFieldToGet) {
     ASSERT_TRUE(member->getFieldDotted("foo", &elt));
 }
 
+TEST_F(WorkingSetFixture, MembersStayPutWhenWorkingSetGrows) {
+    // Allocate enough members to force the working set through several slab extensions and check
+    // that ids stay live, members do not move and freed ids get recycled.
+    const int kNumMembers = 1000;
+
+    std::vector<WorkingSetID> ids;
+    std::vector<WorkingSetMember*> members;
+    for (int i = 0; i < kNumMembers; i++) {
+        auto wsid = ws->allocate();
+        ASSERT(wsid != WorkingSet::INVALID_ID);
+        ids.push_back(wsid);
+        members.push_back(ws->get(wsid));
+    }
+
+    // Growing the working set must not have relocated previously allocated members.
+    for (int i = 0; i < kNumMembers; i++) {
+        ASSERT_EQUALS(members[i], ws->get(ids[i]));
+        ASSERT_FALSE(ws->isFree(ids[i]));
+    }
+
+    // Freed ids go on the free list and are handed out again before any new slot.
+    for (int i = 0; i < kNumMembers; i++) {
+        ws->free(ids[i]);
+        ASSERT_TRUE(ws->isFree(ids[i]));
+    }
+    for (int i = 0; i < kNumMembers; i++) {
+        auto wsid = ws->allocate();
+        ASSERT(wsid != WorkingSet::INVALID_ID);
+        ASSERT_EQUALS(ids[kNumMembers - 1 - i], wsid);
+    }
+}
+
 TEST_F(WorkingSetFixture, getFieldUnowned) {
     string fieldName = "x";
 
@@ -27,10 +27,14 @@
  *    it in the license file.
  */
 
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kFTDC
+
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/ftdc/collector.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -39,22 +43,56 @@
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
 
+/**
+ * State shared between a concurrent collection task and the sampling thread.
+ *
+ * Owned jointly by the task and FTDCCollectorCollection so that a task which outlives its
+ * deadline can still publish its result safely.
+ */
+struct FTDCCollectorCollection::AsyncCollectorState {
+    Mutex mutex = MONGO_MAKE_LATCH("AsyncCollectorState::mutex");
+    stdx::condition_variable cv;
+
+    bool done = false;
+
+    // Time at which the collection task was scheduled, and at which it finished. Used to report
+    // the latency of collectors that overran their deadline.
+    Date_t scheduledAt;
+    Date_t finishedAt;
+
+    // The collector's subdocument, including its start/end timestamps.
+    BSONObj sample;
+};
+
 void FTDCCollectorCollection::add(std::unique_ptr<FTDCCollectorInterface> collector) {
     // TODO: ensure the collectors all have unique names.
     _collectors.emplace_back(std::move(collector));
+    _asyncStates.emplace_back();
 }
 
-std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
+std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client,
+                                                             Milliseconds perCollectorDeadline) {
     // If there are no collectors, just return an empty BSONObj so that that are caller knows we did
     // not collect anything
     if (_collectors.empty()) {
         return std::tuple<BSONObj, Date_t>(BSONObj(), Date_t());
     }
 
+    if (perCollectorDeadline > Milliseconds{0}) {
+        return _collectConcurrently(client, perCollectorDeadline);
+    }
+
+    return _collectSerially(client);
+}
+
+std::tuple<BSONObj, Date_t> FTDCCollectorCollection::_collectSerially(Client* client) {
     BSONObjBuilder builder;
 
     Date_t start = client->getServiceContext()->getPreciseClockSource()->now();
@@ -105,4 +143,135 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
     return std::tuple<BSONObj, Date_t>(builder.obj(), start);
 }
 
+std::tuple<BSONObj, Date_t> FTDCCollectorCollection::_collectConcurrently(
+    Client* client, Milliseconds perCollectorDeadline) {
+    auto* clock = client->getServiceContext()->getPreciseClockSource();
+
+    if (!_pool) {
+        ThreadPool::Options options;
+        options.poolName = "FTDCCollector";
+        options.minThreads = 0;
+        options.maxThreads = std::min<size_t>(_collectors.size(), 4);
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+        };
+        _pool = std::make_unique<ThreadPool>(options);
+        _pool->startup();
+    }
+
+    BSONObjBuilder builder;
+
+    Date_t start = clock->now();
+    builder.appendDate(kFTDCCollectStartField, start);
+
+    // Schedule a task for every collector that is not still busy with an overdue collection from
+    // an earlier sample.
+    std::vector<std::shared_ptr<AsyncCollectorState>> scheduled(_collectors.size());
+    for (size_t i = 0; i < _collectors.size(); ++i) {
+        auto* collector = _collectors[i].get();
+
+        // Skip collection if this collector has no data to return
+        if (!collector->hasData()) {
+            continue;
+        }
+
+        if (auto& overdue = _asyncStates[i]) {
+            bool stillRunning;
+            Milliseconds overdueLatency;
+            {
+                stdx::lock_guard<Latch> lk(overdue->mutex);
+                stillRunning = !overdue->done;
+                overdueLatency = duration_cast<Milliseconds>(overdue->finishedAt -
+                                                             overdue->scheduledAt);
+            }
+
+            if (stillRunning) {
+                // The collector is still working on a collection that overran its deadline in an
+                // earlier sample. Emit this sample without it rather than queueing up more work
+                // behind it.
+                continue;
+            }
+
+            // The overdue collection finally finished. Its data is stale, so discard it, but
+            // report how long it took so the slow section is visible.
+            LOGV2(6650009,
+                  "Overdue diagnostic data collection completed",
+                  "collector"_attr = collector->name(),
+                  "duration"_attr = overdueLatency);
+            _asyncStates[i].reset();
+        }
+
+        auto state = std::make_shared<AsyncCollectorState>();
+        state->scheduledAt = start;
+        scheduled[i] = state;
+
+        _pool->schedule([collector, state, clock](Status scheduleStatus) {
+            BSONObjBuilder subObjBuilder;
+
+            if (scheduleStatus.isOK()) {
+                auto client = Client::getCurrent();
+
+                // All collectors should be ok seeing the inconsistent states in the middle of
+                // replication batches. This is desirable because we want to be able to collect
+                // data in the middle of batches that are taking a long time.
+                auto opCtx = client->makeOperationContext();
+                ShouldNotConflictWithSecondaryBatchApplicationBlock shouldNotConflictBlock(
+                    opCtx->lockState());
+                opCtx->lockState()->skipAcquireTicket();
+
+                subObjBuilder.appendDate(kFTDCCollectStartField, clock->now());
+
+                collector->collect(opCtx.get(), subObjBuilder);
+
+                subObjBuilder.appendDate(kFTDCCollectEndField, clock->now());
+
+                // Ensure the collector did not set a read timestamp.
+                invariant(opCtx->recoveryUnit()->getTimestampReadSource() ==
+                          RecoveryUnit::ReadSource::kNoTimestamp);
+            }
+
+            stdx::lock_guard<Latch> lk(state->mutex);
+            state->sample = subObjBuilder.obj();
+            state->finishedAt = clock->now();
+            state->done = true;
+            state->cv.notify_all();
+        });
+    }
+
+    // Collectors run concurrently, so each one gets the full deadline from the start of the
+    // sample regardless of the order we wait on them in.
+    const Date_t deadline = start + perCollectorDeadline;
+
+    for (size_t i = 0; i < _collectors.size(); ++i) {
+        auto& state = scheduled[i];
+        if (!state) {
+            // Either the collector had no data or it is still overdue from an earlier sample.
+            continue;
+        }
+
+        bool finished;
+        {
+            stdx::unique_lock<Latch> lk(state->mutex);
+            finished = state->cv.wait_until(
+                lk, deadline.toSystemTimePoint(), [&] { return state->done; });
+        }
+
+        if (!finished) {
+            LOGV2_WARNING(6650010,
+                          "Diagnostic data collector missed its deadline, writing a partial "
+                          "sample without it",
+                          "collector"_attr = _collectors[i]->name(),
+                          "deadline"_attr = perCollectorDeadline);
+            _asyncStates[i] = std::move(state);
+            continue;
+        }
+
+        builder.append(_collectors[i]->name(), state->sample);
+    }
+
+    builder.appendDate(kFTDCCollectEndField, clock->now());
+
+    return std::tuple<BSONObj, Date_t>(builder.obj(), start);
+}
+
 }  // namespace mongo
@@ -34,6 +34,8 @@
 #include <tuple>
 #include <vector>
 
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
@@ -116,12 +118,32 @@ public:
      *    ...
      *    "end" : Date_t,      <- Time at which all collecting ended
      * }
+     *
+     * When perCollectorDeadline is non-zero, collectors run concurrently on a small thread pool
+     * and each is given perCollectorDeadline to finish. A collector that misses its deadline is
+     * omitted from the sample so that one slow collector does not stall the others, and is
+     * skipped in subsequent samples until its overdue collection completes.
      */
-    std::tuple<BSONObj, Date_t> collect(Client* client);
+    std::tuple<BSONObj, Date_t> collect(Client* client,
+                                        Milliseconds perCollectorDeadline = Milliseconds{0});
 
 private:
+    struct AsyncCollectorState;
+
+    std::tuple<BSONObj, Date_t> _collectSerially(Client* client);
+    std::tuple<BSONObj, Date_t> _collectConcurrently(Client* client,
+                                                     Milliseconds perCollectorDeadline);
+
     // collection of collectors
     std::vector<std::unique_ptr<FTDCCollectorInterface>> _collectors;
+
+    // One entry per collector. A non-null entry holds the state of a collection that overran its
+    // deadline in an earlier sample and may still be running. Only used by _collectConcurrently.
+    std::vector<std::shared_ptr<AsyncCollectorState>> _asyncStates;
+
+    // Lazily started pool for concurrent collection. Declared last so in-flight collection tasks
+    // are joined before the collectors they reference are destroyed.
+    std::unique_ptr<ThreadPool> _pool;
 };
 
 }  // namespace mongo
@@ -75,6 +75,12 @@ public:
      */
     void setPeriod(Milliseconds millis);
 
+    /**
+     * Set the per-collector deadline for each sample. Zero disables the deadline and runs the
+     * collectors serially.
+     */
+    void setSampleTimeout(Milliseconds millis);
+
     /**
      * Set the maximum directory size in bytes.
      */
@@ -159,6 +159,31 @@ public:
     }
 };
 
+class FTDCMetricsCollectorMockSlow : public FTDCCollectorInterface {
+public:
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) final {
+        stdx::unique_lock<Latch> lck(_mutex);
+        _condvar.wait(lck, [&] { return _released; });
+
+        builder.append("key1", 42);
+    }
+
+    std::string name() const final {
+        return "slow";
+    }
+
+    void release() {
+        stdx::lock_guard<Latch> lck(_mutex);
+        _released = true;
+        _condvar.notify_all();
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("FTDCMetricsCollectorMockSlow::_mutex");
+    stdx::condition_variable _condvar;
+    bool _released{false};
+};
+
 // Test a run of the controller and the data it logs to log file
 TEST_F(FTDCControllerTest, TestFull) {
     unittest::TempDir tempdir("metrics_testpath");
@@ -232,6 +257,42 @@ TEST_F(FTDCControllerTest, TestStartStop) {
     c.stop();
 }
 
+// Test that a per-collector deadline writes a partial sample without the slow collector, skips
+// the slow collector while its overdue collection is still running, and resumes sampling it once
+// the overdue collection completes.
+TEST_F(FTDCControllerTest, TestSampleTimeoutWritesPartialSample) {
+    FTDCCollectorCollection collection;
+
+    auto slow = std::make_unique<FTDCMetricsCollectorMockSlow>();
+    auto slowPtr = slow.get();
+
+    collection.add(std::make_unique<FTDCMetricsCollectorMock2>());
+    collection.add(std::move(slow));
+
+    Client* client = &cc();
+
+    auto doc1 = std::get<0>(collection.collect(client, Milliseconds(500)));
+    ASSERT_TRUE(doc1.hasField("mock"));
+    ASSERT_FALSE(doc1.hasField("slow"));
+
+    // The slow collector is still blocked; the next sample must skip it rather than queue more
+    // work behind it.
+    auto doc2 = std::get<0>(collection.collect(client, Milliseconds(500)));
+    ASSERT_TRUE(doc2.hasField("mock"));
+    ASSERT_FALSE(doc2.hasField("slow"));
+
+    slowPtr->release();
+
+    // Once the overdue collection finishes, the collector is sampled again.
+    BSONObj doc3;
+    for (int i = 0; i < 10000 && !doc3.hasField("slow"); ++i) {
+        doc3 = std::get<0>(collection.collect(client, Milliseconds(500)));
+        sleepmillis(1);
+    }
+    ASSERT_TRUE(doc3.hasField("slow"));
+    ASSERT_TRUE(doc3.hasField("mock"));
+}
+
 // Test we can start the controller as disabled, the directory is empty, and then we can succesfully
 // enable it
 TEST_F(FTDCControllerTest, TestStartAsDisabled) {
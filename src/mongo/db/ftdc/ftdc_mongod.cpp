@@ -34,6 +34,7 @@
 #include <boost/filesystem.hpp>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/concurrency/lock_manager.h"
 #include "mongo/db/ftdc/constants.h"
 #include "mongo/db/ftdc/controller.h"
 #include "mongo/db/ftdc/ftdc_mongod_gen.h"
@@ -41,7 +42,10 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/ticketholders.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/ticketholder.h"
 
 namespace mongo {
 
@@ -96,6 +100,91 @@ public:
 };
 
 
+/**
+ * Collects a compact, numeric summary of lock and latch contention.
+ *
+ * The full wait-for graph (which locker is blocked behind which) is string-heavy and changes shape
+ * from sample to sample, which defeats FTDC's schema-delta compression, so this collector only
+ * reports counters: how many resources have waiters, how deep the lock manager queues are, the
+ * ticket holder occupancy, and the per-latch acquisition/contention counts that Mutex maintains
+ * unconditionally. The lockInfo command remains available for interactive drill-down into the
+ * actual queue contents.
+ */
+class FTDCContentionCollector final : public FTDCCollectorInterface {
+public:
+    void collect(OperationContext* opCtx, BSONObjBuilder& builder) override {
+        {
+            // Summarize the lock manager's queues. getLockInfoBSON() also prunes unused lock heads
+            // as it walks the buckets, so sampling here doubles as periodic cleanup.
+            BSONObjBuilder lockInfoBuilder;
+            LockManager::get(opCtx)->getLockInfoBSON({}, &lockInfoBuilder);
+
+            long long resourcesWithWaiters = 0;
+            long long grantedRequests = 0;
+            long long pendingRequests = 0;
+            for (auto&& lockObj : lockInfoBuilder.done()["lockInfo"].Obj()) {
+                auto granted = lockObj["granted"].Obj().nFields();
+                auto pending = lockObj["pending"].Obj().nFields();
+                grantedRequests += granted;
+                pendingRequests += pending;
+                if (pending > 0) {
+                    ++resourcesWithWaiters;
+                }
+            }
+
+            BSONObjBuilder lockSub(builder.subobjStart("lockManager"));
+            lockSub.append("resourcesWithWaiters", resourcesWithWaiters);
+            lockSub.append("grantedRequests", grantedRequests);
+            lockSub.append("pendingRequests", pendingRequests);
+        }
+
+        {
+            auto& ticketHolders = ticketHoldersDecoration(opCtx->getServiceContext());
+            BSONObjBuilder ticketSub(builder.subobjStart("ticketHolders"));
+            auto appendHolder = [&](StringData name, TicketHolder* holder) {
+                // The holders are unset when admission throttling is disabled.
+                if (!holder) {
+                    return;
+                }
+                BSONObjBuilder sub(ticketSub.subobjStart(name));
+                sub.append("out", holder->used());
+                sub.append("available", holder->available());
+                sub.append("totalTickets", holder->outof());
+            };
+            appendHolder("read", ticketHolders.getTicketHolder(MODE_IS));
+            appendHolder("write", ticketHolders.getTicketHolder(MODE_IX));
+        }
+
+        {
+            // Report only latches that have seen contention; keying by the stable latch index
+            // keeps the document shape steady as quiescent latches come and go.
+            BSONObjBuilder latchSub(builder.subobjStart("latches"));
+            for (auto iter = latch_detail::Catalog::get().iter(); iter.more();) {
+                auto data = iter.next();
+                if (!data) {
+                    continue;
+                }
+
+                auto contended = data->counts().contended.loadRelaxed();
+                if (contended == 0) {
+                    continue;
+                }
+
+                BSONObjBuilder latchObj(
+                    latchSub.subobjStart(std::to_string(data->identity().index())));
+                latchObj.append("name", data->identity().name());
+                latchObj.append("acquired", data->counts().acquired.loadRelaxed());
+                latchObj.append("released", data->counts().released.loadRelaxed());
+                latchObj.append("contended", contended);
+            }
+        }
+    }
+
+    std::string name() const override {
+        return "contention";
+    }
+};
+
 void registerMongoDCollectors(FTDCController* controller) {
     // These metrics are only collected if replication is enabled
     if (repl::ReplicationCoordinator::get(getGlobalServiceContext())->getReplicationMode() !=
@@ -127,6 +216,7 @@ void registerMongoDCollectors(FTDCController* controller) {
     }
 
     controller->addPeriodicCollector(std::make_unique<FTDCCollectionStatsCollector>());
+    controller->addPeriodicCollector(std::make_unique<FTDCContentionCollector>());
 }
 
 }  // namespace
@@ -123,7 +123,8 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
                                            const std::vector<BsonRecord>& bsonRecords,
                                            const InsertDeleteOptions& options,
                                            int64_t* numInserted) {
-    for (auto bsonRecord : bsonRecords) {
+    auto& executionCtx = StorageExecutionContext::get(opCtx);
+    for (const auto& bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
         if (!bsonRecord.ts.isNull()) {
@@ -132,7 +133,6 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
                 return status;
         }
 
-        auto& executionCtx = StorageExecutionContext::get(opCtx);
         auto keys = executionCtx.keys();
         auto multikeyMetadataKeys = executionCtx.multikeyMetadataKeys();
         auto multikeyPaths = executionCtx.multikeyPaths();
@@ -289,6 +289,19 @@ Status SortedDataIndexAccessMethod::insertKeys(OperationContext* opCtx,
         dupsAllowed = !unique;
     }
     // Add all new keys into the index. The RecordId for each is already encoded in the KeyString.
+    // Non-unique indexes never report duplicates, so the whole sorted batch can go through the
+    // storage interface's batch insert, which amortizes the per-key cursor overhead. This matters
+    // for multikey inserts, where one document can produce hundreds of keys.
+    if (!unique && dupsAllowed) {
+        auto status = _newInterface->insertKeys(opCtx, keys, dupsAllowed);
+        if (!status.isOK()) {
+            return status;
+        }
+        if (numInserted) {
+            *numInserted = keys.size();
+        }
+        return Status::OK();
+    }
     for (const auto& keyString : keys) {
         auto status = _newInterface->insert(opCtx, keyString, dupsAllowed);
 
@@ -1708,6 +1708,25 @@ void IndexBuildsCoordinator::createIndexesOnEmptyCollection(OperationContext* op
     }
 }
 
+void IndexBuildsCoordinator::setMemberIndexBuildProgress(const UUID& buildUUID,
+                                                         const HostAndPort& member,
+                                                         boost::optional<long long> keysProcessed,
+                                                         boost::optional<StringData> phase) {
+    auto swReplState = _getIndexBuild(buildUUID);
+    if (!swReplState.isOK()) {
+        // Progress reports are advisory; the index build might have already been torn down.
+        return;
+    }
+    swReplState.getValue()->setMemberBuildProgress(member, keysProcessed, phase, Date_t::now());
+    LOGV2_DEBUG(6650034,
+                1,
+                "Index build: received member progress report",
+                "buildUUID"_attr = buildUUID,
+                "member"_attr = member,
+                "keysProcessed"_attr = keysProcessed,
+                "phase"_attr = phase);
+}
+
 void IndexBuildsCoordinator::sleepIndexBuilds_forTestOnly(bool sleep) {
     activeIndexBuilds.sleepIndexBuilds_forTestOnly(sleep);
 }
@@ -2276,11 +2295,13 @@ void IndexBuildsCoordinator::_resumeIndexBuildFromPhase(
             resumeAfterRecordId = *resumeInfo.getCollectionScanPosition();
         }
 
+        _signalPrimaryForBuildProgress(opCtx, replState, "scanCollection"_sd);
         _scanCollectionAndInsertSortedKeysIntoIndex(opCtx, replState, resumeAfterRecordId);
     } else if (resumeInfo.getPhase() == IndexBuildPhaseEnum::kBulkLoad) {
         _insertSortedKeysIntoIndexForResume(opCtx, replState);
     }
 
+    _signalPrimaryForBuildProgress(opCtx, replState, "drainSideWritesTable"_sd);
     _insertKeysFromSideTablesWithoutBlockingWrites(opCtx, replState);
     _signalPrimaryForCommitReadiness(opCtx, replState);
     _insertKeysFromSideTablesBlockingWrites(opCtx, replState, indexBuildOptions);
@@ -2385,7 +2406,9 @@ void IndexBuildsCoordinator::_buildIndex(OperationContext* opCtx,
               opCtx->recoveryUnit()->getTimestampReadSource());
     // The collection scan might read with a kMajorityCommitted read source, but will restore
     // kNoTimestamp afterwards.
+    _signalPrimaryForBuildProgress(opCtx, replState, "scanCollection"_sd);
     _scanCollectionAndInsertSortedKeysIntoIndex(opCtx, replState);
+    _signalPrimaryForBuildProgress(opCtx, replState, "drainSideWritesTable"_sd);
     _insertKeysFromSideTablesWithoutBlockingWrites(opCtx, replState);
     _signalPrimaryForCommitReadiness(opCtx, replState);
     _insertKeysFromSideTablesBlockingWrites(opCtx, replState, indexBuildOptions);
@@ -335,6 +335,17 @@ public:
                                         const UUID& buildUUID,
                                         const HostAndPort& hostAndPort) = 0;
 
+    /**
+     * Records build progress reported by a replica set member through the 'voteCommitIndexBuild'
+     * channel. Progress reports are advisory and best effort: they are kept in memory only, are
+     * surfaced through the 'activeIndexBuilds' serverStatus section, and are silently dropped if
+     * the index build is not active on this node.
+     */
+    void setMemberIndexBuildProgress(const UUID& buildUUID,
+                                     const HostAndPort& member,
+                                     boost::optional<long long> keysProcessed,
+                                     boost::optional<StringData> phase);
+
     /**
      * Sets a new commit quorum on an index build that manages 'indexNames' on collection 'nss'.
      * If the 'newCommitQuorum' is not satisfiable by the current replica set config, then the
@@ -506,6 +517,25 @@ public:
 
             indexBuilds.append("phases", phases.obj());
 
+            // Last known per-member progress of active builds, as reported by replica set members
+            // over the 'voteCommitIndexBuild' channel. Only populated on the node accepting the
+            // votes for a build, i.e. the primary.
+            BSONArrayBuilder buildsBuilder(indexBuilds.subarrayStart("builds"));
+            auto builds = IndexBuildsCoordinator::get(opCtx)->activeIndexBuilds.filterIndexBuilds(
+                [](const auto&) { return true; });
+            for (const auto& replState : builds) {
+                BSONObjBuilder progressBuilder;
+                replState->appendMemberBuildProgress(&progressBuilder);
+                auto progressObj = progressBuilder.obj();
+                if (progressObj.isEmpty()) {
+                    continue;
+                }
+                BSONObjBuilder buildBuilder(buildsBuilder.subobjStart());
+                replState->buildUUID.appendToBuilder(&buildBuilder, "buildUUID");
+                buildBuilder.appendElements(progressObj);
+            }
+            buildsBuilder.done();
+
             return indexBuilds.obj();
         }
 
@@ -727,6 +757,16 @@ protected:
     virtual void _signalPrimaryForCommitReadiness(
         OperationContext* opCtx, std::shared_ptr<ReplIndexBuildState> replState) = 0;
 
+    /**
+     * Streams this node's build progress to the primary over the 'voteCommitIndexBuild' channel
+     * without casting a vote, so the primary can surface stragglers while waiting for the commit
+     * quorum. Called at build phase transitions. Best effort; the default implementation does
+     * nothing.
+     */
+    virtual void _signalPrimaryForBuildProgress(OperationContext* opCtx,
+                                                std::shared_ptr<ReplIndexBuildState> replState,
+                                                StringData phase) {}
+
     /**
      * Drains the side-writes table periodically while waiting for the IndexBuildAction to be ready.
      */
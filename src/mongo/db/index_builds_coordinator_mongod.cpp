@@ -487,8 +487,17 @@ void IndexBuildsCoordinatorMongod::_signalIfCommitQuorumIsSatisfied(
     bool commitQuorumSatisfied = repl::ReplicationCoordinator::get(opCtx)->isCommitQuorumSatisfied(
         indexBuildEntry.getCommitQuorum(), voteMemberList.get());
 
-    if (!commitQuorumSatisfied)
+    if (!commitQuorumSatisfied) {
+        // Make stragglers visible: log the commit-ready members along with the last progress
+        // report of every member which has reported over the 'voteCommitIndexBuild' channel.
+        BSONObjBuilder progressBuilder;
+        replState->appendMemberBuildProgress(&progressBuilder);
+        LOGV2(6650035,
+              "Index build: commit quorum not yet satisfied",
+              "indexBuildEntry"_attr = indexBuildEntry,
+              "memberProgress"_attr = progressBuilder.obj());
         return;
+    }
 
     LOGV2(
         3856201, "Index build: commit quorum satisfied", "indexBuildEntry"_attr = indexBuildEntry);
@@ -635,6 +644,64 @@ void IndexBuildsCoordinatorMongod::_signalPrimaryForCommitReadiness(
     return;
 }
 
+void IndexBuildsCoordinatorMongod::_signalPrimaryForBuildProgress(
+    OperationContext* opCtx, std::shared_ptr<ReplIndexBuildState> replState, StringData phase) {
+    if (IndexBuildProtocol::kTwoPhase != replState->protocol) {
+        return;
+    }
+
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (!replCoord->getSettings().usingReplSets() || replCoord->getMemberState().primary()) {
+        // The primary is the node collecting the reports; it does not report to itself.
+        return;
+    }
+
+    auto myAddress = replCoord->getMyHostAndPort();
+    if (myAddress.empty()) {
+        return;
+    }
+
+    // The collection scan maintains its progress meter on this thread's CurOp; its current count
+    // tells the primary how many keys this member has processed so far.
+    const auto keysProcessed =
+        static_cast<long long>(CurOp::get(opCtx)->getProgressMeter().done());
+
+    // Reuse the vote request callback bookkeeping so a commit or abort signal can cancel an
+    // in-flight progress report the same way it cancels a vote.
+    auto onRemoteCmdScheduled = [opCtx, replState](executor::TaskExecutor::CallbackHandle handle) {
+        replState->onVoteRequestScheduled(opCtx, handle);
+    };
+    auto onRemoteCmdComplete = [replState](executor::TaskExecutor::CallbackHandle) {
+        replState->clearVoteRequestCbk();
+    };
+
+    auto const progressCmdRequest =
+        BSON("voteCommitIndexBuild" << replState->buildUUID << "hostAndPort"
+                                    << myAddress.toString() << "readyToCommit" << false
+                                    << "keysProcessed" << keysProcessed << "phase" << phase);
+
+    // Progress reports are advisory and best effort: a single attempt, with all errors logged and
+    // swallowed. Liveness is guaranteed by the voting path, which does retry.
+    try {
+        auto cmdResponse = replCoord->runCmdOnPrimaryAndAwaitResponse(
+            opCtx, "admin", progressCmdRequest, onRemoteCmdScheduled, onRemoteCmdComplete);
+        auto cmdStatus = getStatusFromCommandResult(cmdResponse);
+        if (!cmdStatus.isOK()) {
+            LOGV2_DEBUG(6650036,
+                        1,
+                        "Failed to report index build progress to primary",
+                        "indexBuildUUID"_attr = replState->buildUUID,
+                        "error"_attr = cmdStatus);
+        }
+    } catch (const DBException& ex) {
+        LOGV2_DEBUG(6650037,
+                    1,
+                    "Failed to run index build progress report command",
+                    "indexBuildUUID"_attr = replState->buildUUID,
+                    "error"_attr = ex.toStatus());
+    }
+}
+
 IndexBuildAction IndexBuildsCoordinatorMongod::_drainSideWritesUntilNextActionIsAvailable(
     OperationContext* opCtx, std::shared_ptr<ReplIndexBuildState> replState) {
     auto future = replState->getNextActionFuture();
@@ -160,6 +160,10 @@ private:
     void _signalPrimaryForCommitReadiness(OperationContext* opCtx,
                                           std::shared_ptr<ReplIndexBuildState> replState) override;
 
+    void _signalPrimaryForBuildProgress(OperationContext* opCtx,
+                                        std::shared_ptr<ReplIndexBuildState> replState,
+                                        StringData phase) override;
+
     IndexBuildAction _drainSideWritesUntilNextActionIsAvailable(
         OperationContext* opCtx, std::shared_ptr<ReplIndexBuildState> replState) override;
 
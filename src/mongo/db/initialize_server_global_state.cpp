@@ -366,6 +366,9 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         lv2Config.fileOpenMode = serverGlobalParams.logAppend
             ? logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kAppend
             : logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kTruncate;
+        lv2Config.asyncFileWritesEnabled = gAsyncLogFileWrites;
+        lv2Config.asyncFileWritesMaxQueueBytes =
+            static_cast<std::size_t>(gAsyncLogFileWritesMaxMemoryUsageMB) * 1024 * 1024;
 
         if (serverGlobalParams.logAppend && exists) {
             writeServerRestartedAfterLogConfig = true;
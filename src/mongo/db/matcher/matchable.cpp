@@ -33,9 +33,31 @@
 
 namespace mongo {
 
-BSONMatchableDocument::BSONMatchableDocument(const BSONObj& obj) : _obj(obj) {
+BSONMatchableDocument::BSONMatchableDocument(const BSONObj& obj)
+    : _obj(obj), _topLevelScan(_obj) {
     _iteratorUsed = false;
 }
 
 BSONMatchableDocument::~BSONMatchableDocument() {}
+
+BSONElement BSONMatchableDocument::_topLevelField(StringData fieldName) const {
+    auto it = _topLevelFields.find(fieldName);
+    if (it != _topLevelFields.end()) {
+        return it->second;
+    }
+
+    // Continue the single left-to-right scan from wherever the previous lookup stopped, memoizing
+    // every field passed over. As with BSONObj::getField(), the first occurrence of a duplicated
+    // field name wins.
+    while (_topLevelScan.more()) {
+        auto elt = _topLevelScan.next();
+        auto name = elt.fieldNameStringData();
+        _topLevelFields.try_emplace(elt.fieldName(), elt);
+        if (name == fieldName) {
+            return elt;
+        }
+    }
+
+    return BSONElement();
+}
 }  // namespace mongo
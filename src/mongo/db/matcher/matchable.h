@@ -33,6 +33,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/field_ref.h"
 #include "mongo/db/matcher/path.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -84,6 +85,19 @@ public:
     }
 
     virtual ElementIterator* allocateIterator(const ElementPath* path) const {
+        // The first clause to look up a path iterates the document directly. From the second
+        // lookup on, the top-level field is resolved through '_topLevelFields' instead, so that
+        // all clauses of a multi-clause match together read each top-level byte of the document
+        // only once rather than once per clause.
+        if (_numIteratorsAllocated++ > 0 && path->fieldRef().numParts() > 0) {
+            auto firstElt = _topLevelField(path->fieldRef().getPart(0));
+            if (_iteratorUsed)
+                return new BSONElementIterator(path, 1 /* suffixIndex */, firstElt);
+            _iteratorUsed = true;
+            _iterator.reset(path, 1 /* suffixIndex */, firstElt);
+            return &_iterator;
+        }
+
         if (_iteratorUsed)
             return new BSONElementIterator(path, _obj);
         _iteratorUsed = true;
@@ -100,9 +114,23 @@ public:
     }
 
 private:
+    /**
+     * Returns the top-level element of '_obj' named 'fieldName', or EOO if there is none,
+     * extending '_topLevelScan' just far enough to answer the lookup.
+     */
+    BSONElement _topLevelField(StringData fieldName) const;
+
     BSONObj _obj;
     mutable BSONElementIterator _iterator;
     mutable bool _iteratorUsed;
+
+    // Memo of the top-level fields seen so far by '_topLevelScan', which advances lazily over
+    // '_obj' and is shared by all paths looked up on this document. Only consulted from the
+    // second iterator allocation on, so that matching a single predicate does not pay for
+    // building it.
+    mutable StringMap<BSONElement> _topLevelFields;
+    mutable BSONObjIterator _topLevelScan;
+    mutable size_t _numIteratorsAllocated = 0;
 };
 
 /**
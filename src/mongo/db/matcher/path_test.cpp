@@ -29,8 +29,11 @@
 
 #include "mongo/unittest/unittest.h"
 
+#include <vector>
+
 #include "mongo/db/jsobj.h"
 #include "mongo/db/json.h"
+#include "mongo/db/matcher/matchable.h"
 #include "mongo/db/matcher/path.h"
 
 namespace mongo {
@@ -593,4 +596,84 @@ TEST(SingleElementElementIterator, Simple1) {
 
     ASSERT(!i.more());
 }
+
+/**
+ * Drains 'iterator' and returns the elements it produced.
+ */
+std::vector<BSONElement> drainIterator(ElementIterator* iterator) {
+    std::vector<BSONElement> elements;
+    while (iterator->more()) {
+        elements.push_back(iterator->next().element());
+    }
+    return elements;
+}
+
+/**
+ * Asserts that iterating 'doc' with 'path' produces the same elements as iterating the raw
+ * object directly. BSONMatchableDocument resolves top-level fields through a memo from its second
+ * iterator allocation on, so repeated lookups exercise the memoized code path.
+ */
+void assertMatchableDocIterationMatchesDirect(const BSONMatchableDocument& doc,
+                                              const BSONObj& obj,
+                                              const ElementPath& path) {
+    BSONElementIterator direct(&path, obj);
+    auto expected = drainIterator(&direct);
+
+    MatchableDocument::IteratorHolder cursor(&doc, &path);
+    auto actual = drainIterator(cursor.operator->());
+
+    ASSERT_EQUALS(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_BSONELT_EQ(expected[i], actual[i]);
+    }
+}
+
+TEST(BSONMatchableDocument, RepeatedLookupsMatchDirectIteration) {
+    BSONObj obj = BSON("w" << BSON("u" << 1) << "x" << 4 << "y" << BSON_ARRAY(5 << 6) << "z"
+                           << BSON("a" << BSON_ARRAY(BSON("b" << 7))));
+    BSONMatchableDocument doc(obj);
+
+    ElementPath w{"w.u"};
+    ElementPath x{"x"};
+    ElementPath y{"y"};
+    ElementPath z{"z.a.b"};
+
+    // Look the paths up twice each, in an order unrelated to the document's field order, so both
+    // the direct and the memoized lookups are covered.
+    for (int repeat = 0; repeat < 2; repeat++) {
+        assertMatchableDocIterationMatchesDirect(doc, obj, z);
+        assertMatchableDocIterationMatchesDirect(doc, obj, x);
+        assertMatchableDocIterationMatchesDirect(doc, obj, w);
+        assertMatchableDocIterationMatchesDirect(doc, obj, y);
+    }
+}
+
+TEST(BSONMatchableDocument, MemoizedLookupOfMissingFieldProducesEOO) {
+    BSONObj obj = BSON("x" << 4 << "y" << 5);
+    BSONMatchableDocument doc(obj);
+
+    ElementPath x{"x"};
+    ElementPath missing{"q"};
+    ElementPath missingNested{"x.q"};
+
+    assertMatchableDocIterationMatchesDirect(doc, obj, x);
+    assertMatchableDocIterationMatchesDirect(doc, obj, missing);
+    assertMatchableDocIterationMatchesDirect(doc, obj, missingNested);
+}
+
+TEST(BSONMatchableDocument, MemoizedLookupReturnsFirstOfDuplicatedFields) {
+    // As with BSONObj::getField(), the first occurrence of a duplicated field name wins.
+    BSONObj obj = BSON("x" << 1 << "x" << 2 << "y" << 3);
+    BSONMatchableDocument doc(obj);
+
+    ElementPath y{"y"};
+    ElementPath x{"x"};
+
+    assertMatchableDocIterationMatchesDirect(doc, obj, y);
+    assertMatchableDocIterationMatchesDirect(doc, obj, x);
+
+    MatchableDocument::IteratorHolder cursor(&doc, &x);
+    ASSERT(cursor->more());
+    ASSERT_EQUALS(1, cursor->next().element().numberInt());
+}
 }  // namespace mongo
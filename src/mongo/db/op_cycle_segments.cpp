@@ -0,0 +1,111 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/op_cycle_segments.h"
+
+#ifdef MONGO_CONFIG_OP_SEGMENT_PROFILING
+
+#include <memory>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace {
+
+// Process-wide cycle totals for one command type. Entries are created on first flush for a
+// command and never removed, so pointers into the registry remain valid without the mutex.
+struct SegmentTotals {
+    AtomicWord<long long> count;
+    std::array<AtomicWord<long long>, kNumOpSegments> cycles;
+};
+
+Mutex segmentRegistryMutex = MONGO_MAKE_LATCH("OpCycleSegments::segmentRegistryMutex");
+StringMap<std::unique_ptr<SegmentTotals>> segmentRegistry;
+
+SegmentTotals* totalsForCommand(StringData commandName) {
+    stdx::lock_guard<Latch> lk(segmentRegistryMutex);
+    auto& entry = segmentRegistry[commandName];
+    if (!entry) {
+        entry = std::make_unique<SegmentTotals>();
+    }
+    return entry.get();
+}
+
+constexpr std::array<StringData, kNumOpSegments> kSegmentFieldNames{
+    "parseCycles"_sd, "setupCycles"_sd, "executeCycles"_sd, "responseCycles"_sd};
+
+class OpSegmentProfilerSection : public ServerStatusSection {
+public:
+    OpSegmentProfilerSection() : ServerStatusSection("opSegmentProfiler") {}
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder result;
+        stdx::lock_guard<Latch> lk(segmentRegistryMutex);
+        for (auto&& [commandName, totals] : segmentRegistry) {
+            BSONObjBuilder command(result.subobjStart(commandName));
+            command.append("count", totals->count.load());
+            for (size_t i = 0; i < kNumOpSegments; i++) {
+                command.append(kSegmentFieldNames[i], totals->cycles[i].load());
+            }
+        }
+        return result.obj();
+    }
+} opSegmentProfilerSection;
+
+}  // namespace
+
+void OpCycleSegments::flush(StringData commandName) {
+    if (!_lastMark) {
+        return;  // start() was never called; this is not an instrumented path.
+    }
+
+    auto* totals = totalsForCommand(commandName);
+    totals->count.fetchAndAddRelaxed(1);
+    for (size_t i = 0; i < kNumOpSegments; i++) {
+        totals->cycles[i].fetchAndAddRelaxed(_cycles[i]);
+    }
+
+    _cycles.fill(0);
+    _lastMark = 0;
+}
+
+}  // namespace mongo
+
+#endif  // MONGO_CONFIG_OP_SEGMENT_PROFILING
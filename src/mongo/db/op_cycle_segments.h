@@ -0,0 +1,111 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "mongo/base/string_data.h"
+#include "mongo/config.h"
+
+namespace mongo {
+
+/**
+ * The fixed segments of the command hot path that the service entry point accounts cycles to.
+ * kParse covers message parsing and command lookup, kSetup covers authorization checks and the
+ * remaining per-command initialization, kExecute covers the command invocation itself (including
+ * query planning and serializing the reply body), and kResponse covers assembling the final
+ * response message.
+ */
+enum class OpSegment { kParse, kSetup, kExecute, kResponse };
+
+static constexpr size_t kNumOpSegments = 4;
+
+/**
+ * Per-operation cycle accounting for the segments of the command hot path, stored on CurOp.
+ *
+ * Compiled out unless the build enables MONGO_CONFIG_OP_SEGMENT_PROFILING (scons
+ * --use-op-segment-profiler=on); all members below are then empty inline functions, so call
+ * sites in the hot path cost nothing.
+ *
+ * Usage: call start() when the operation begins, mark(segment) at each segment boundary to
+ * attribute the cycles since the previous mark, and flush(commandName) once the response is
+ * built. flush() folds the counts into a process-wide per-command aggregate that the
+ * 'opSegmentProfiler' serverStatus section reports.
+ */
+class OpCycleSegments {
+public:
+#ifdef MONGO_CONFIG_OP_SEGMENT_PROFILING
+    void start() {
+        _lastMark = _readCycleCounter();
+    }
+
+    void mark(OpSegment segment) {
+        if (!_lastMark) {
+            return;  // start() was never called; this is not an instrumented path.
+        }
+        auto now = _readCycleCounter();
+        _cycles[static_cast<size_t>(segment)] += now - _lastMark;
+        _lastMark = now;
+    }
+
+    void flush(StringData commandName);
+
+private:
+    static uint64_t _readCycleCounter() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        // The virtual counter is not cycle-granular but is cheap to read, consistent across
+        // cores, and proportional to time, which is all the aggregate report needs.
+        uint64_t count;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(count));
+        return count;
+#else
+        return 0;
+#endif
+    }
+
+    std::array<uint64_t, kNumOpSegments> _cycles{};
+    uint64_t _lastMark = 0;
+#else
+    void start() {}
+    void mark(OpSegment) {}
+    void flush(StringData) {}
+#endif
+};
+
+}  // namespace mongo
@@ -57,6 +57,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/change_stream_pre_image_helpers.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
+#include "mongo/db/query/query_results_cache.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/db/repl/oplog.h"
@@ -104,6 +105,22 @@ Date_t getWallClockTimeForOpLog(OperationContext* opCtx) {
     return clockSource->now();
 }
 
+/**
+ * Invalidates cached query results for 'nss' once this write commits. The generation bump must not
+ * become visible before the write does, or a reader could fill the cache from a snapshot that
+ * misses the write and have the entry validate afterwards, so it is registered as an onCommit
+ * handler rather than performed inline.
+ */
+void invalidateQueryResultsCache(OperationContext* opCtx, const NamespaceString& nss) {
+    if (!QueryResultsCache::isActive(opCtx->getServiceContext())) {
+        return;
+    }
+    opCtx->recoveryUnit()->onCommit(
+        [serviceContext = opCtx->getServiceContext(), ns = nss.ns()](boost::optional<Timestamp>) {
+            QueryResultsCache::get(serviceContext).notifyOfWrite(ns);
+        });
+}
+
 repl::OpTime logOperation(OperationContext* opCtx,
                           MutableOplogEntry* oplogEntry,
                           bool assignWallClockTime = true) {
@@ -501,6 +518,8 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
                                std::vector<InsertStatement>::const_iterator first,
                                std::vector<InsertStatement>::const_iterator last,
                                bool fromMigrate) {
+    invalidateQueryResultsCache(opCtx, nss);
+
     auto txnParticipant = TransactionParticipant::get(opCtx);
     const bool inMultiDocumentTransaction =
         txnParticipant && opCtx->writesAreReplicated() && txnParticipant.transactionIsOpen();
@@ -628,14 +647,25 @@ void OpObserverImpl::onUpdate(OperationContext* opCtx, const OplogUpdateEntryArg
         return;
     }
 
+    invalidateQueryResultsCache(opCtx, args.nss);
+
     auto txnParticipant = TransactionParticipant::get(opCtx);
     const bool inMultiDocumentTransaction =
         txnParticipant && opCtx->writesAreReplicated() && txnParticipant.transactionIsOpen();
 
     ShardingWriteRouter shardingWriteRouter(opCtx, args.nss, Grid::get(opCtx)->catalogCache());
 
+    auto& batchedWriteContext = BatchedWriteContext::get(opCtx);
+    const bool inBatchedWrite = batchedWriteContext.writesAreBatched();
+
     OpTimeBundle opTime;
-    if (inMultiDocumentTransaction) {
+    if (inBatchedWrite) {
+        auto operation = MutableOplogEntry::makeUpdateOperation(
+            args.nss, args.uuid, args.updateArgs->update, args.updateArgs->criteria);
+        operation.setDestinedRecipient(
+            shardingWriteRouter.getReshardingDestinedRecipient(args.updateArgs->updatedDoc));
+        batchedWriteContext.addBatchedOperation(opCtx, operation);
+    } else if (inMultiDocumentTransaction) {
         const bool inRetryableInternalTransaction =
             isInternalSessionForRetryableWrite(*opCtx->getLogicalSessionId());
 
@@ -824,6 +854,8 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
                               const UUID& uuid,
                               StmtId stmtId,
                               const OplogDeleteEntryArgs& args) {
+    invalidateQueryResultsCache(opCtx, nss);
+
     auto optDocKey = documentKeyDecoration(opCtx);
     invariant(optDocKey, nss.ns());
     auto& documentKey = optDocKey.get();
@@ -2191,6 +2223,10 @@ void OpObserverImpl::_onReplicationRollback(OperationContext* opCtx,
     BucketCatalog::get(opCtx).clear([&timeseriesNamespaces](const NamespaceString& bucketNs) {
         return timeseriesNamespaces.contains(bucketNs);
     });
+
+    // Rollback rewinds collection data without the writes passing through this observer, so no
+    // cached query results can be trusted.
+    QueryResultsCache::get(opCtx->getServiceContext()).clear();
 }
 
 }  // namespace mongo
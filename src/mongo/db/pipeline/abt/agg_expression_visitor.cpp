@@ -200,6 +200,18 @@ public:
         pushArithmeticBinaryExpr(expr, Operations::Div);
     }
 
+    void visit(const ExpressionDotProduct* expr) override final {
+        unsupportedExpression("$dotProduct");
+    }
+
+    void visit(const ExpressionEuclideanDistance* expr) override final {
+        unsupportedExpression("$euclideanDistance");
+    }
+
+    void visit(const ExpressionCosineSimilarity* expr) override final {
+        unsupportedExpression("$cosineSimilarity");
+    }
+
     void visit(const ExpressionExp* expr) override final {
         pushSingleArgFunctionFromTop("exp");
     }
@@ -76,9 +76,12 @@ public:
 
     /** Process input and update internal state.
      *  merging should be true when processing outputs from getValue(true).
+     *
+     *  Takes the input by value so callers can move temporaries all the way into the
+     *  accumulator's internal state without copying the underlying storage.
      */
-    void process(const Value& input, bool merging) {
-        processInternal(input, merging);
+    void process(Value input, bool merging) {
+        processInternal(std::move(input), merging);
     }
 
     /**
@@ -148,7 +151,7 @@ public:
 
 protected:
     /// Update subclass's internal state based on input
-    virtual void processInternal(const Value& input, bool merging) = 0;
+    virtual void processInternal(Value input, bool merging) = 0;
 
     auto getExpressionContext() const {
         return _expCtx;
@@ -182,7 +185,7 @@ public:
     AccumulatorAddToSet(ExpressionContext* expCtx,
                         boost::optional<int> maxMemoryUsageBytes = boost::none);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -211,7 +214,7 @@ public:
 
     explicit AccumulatorFirst(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -236,7 +239,7 @@ public:
 
     explicit AccumulatorLast(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -260,7 +263,7 @@ public:
 
     explicit AccumulatorSum(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -290,7 +293,7 @@ public:
 
     AccumulatorMinMax(ExpressionContext* expCtx, Sense sense);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -348,7 +351,7 @@ public:
     AccumulatorPush(ExpressionContext* expCtx,
                     boost::optional<int> maxMemoryUsageBytes = boost::none);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -369,7 +372,7 @@ public:
 
     explicit AccumulatorAvg(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -393,7 +396,7 @@ class AccumulatorStdDev : public AccumulatorState {
 public:
     AccumulatorStdDev(ExpressionContext* expCtx, bool isSamp);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -440,7 +443,7 @@ public:
 
     AccumulatorMergeObjects(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -460,7 +463,7 @@ public:
 
     AccumulatorExpMovingAvg(ExpressionContext* expCtx, Decimal128 alpha);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -46,11 +46,12 @@ using std::vector;
 REGISTER_ACCUMULATOR(addToSet, genericParseSingleExpressionAccumulator<AccumulatorAddToSet>);
 REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(addToSet, AccumulatorAddToSet, WindowFunctionAddToSet);
 
-void AccumulatorAddToSet::processInternal(const Value& input, bool merging) {
-    auto addValue = [this](auto&& val) {
-        bool inserted = _set.insert(val).second;
+void AccumulatorAddToSet::processInternal(Value input, bool merging) {
+    auto addValue = [this](Value val) {
+        const auto size = val.getApproximateSize();
+        bool inserted = _set.insert(std::move(val)).second;
         if (inserted) {
-            _memUsageBytes += val.getApproximateSize();
+            _memUsageBytes += size;
             uassert(ErrorCodes::ExceededMemoryLimit,
                     str::stream()
                         << "$addToSet used too much memory and cannot spill to disk. Memory limit: "
@@ -60,7 +61,7 @@ void AccumulatorAddToSet::processInternal(const Value& input, bool merging) {
     };
     if (!merging) {
         if (!input.missing()) {
-            addValue(input);
+            addValue(std::move(input));
         }
     } else {
         // If we're merging, we need to take apart the arrays we receive and put their elements into
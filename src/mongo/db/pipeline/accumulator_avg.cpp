@@ -69,7 +69,7 @@ Value serializePartialSum(BSONType nonDecimalTotalType,
                           const DoubleDoubleSummation& nonDecimalTotal,
                           const Decimal128& decimalTotal);
 
-void AccumulatorAvg::processInternal(const Value& input, bool merging) {
+void AccumulatorAvg::processInternal(Value input, bool merging) {
     if (merging) {
         // We expect an object that contains both a subtotal and a count. Additionally there may
         // be an error value, that allows for additional precision.
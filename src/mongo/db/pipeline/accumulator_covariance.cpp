@@ -48,7 +48,7 @@ REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(covariancePop,
                                           AccumulatorCovariancePop,
                                           WindowFunctionCovariancePop);
 
-void AccumulatorCovariance::processInternal(const Value& input, bool merging) {
+void AccumulatorCovariance::processInternal(Value input, bool merging) {
     tassert(5424000, "$covariance can't be merged", !merging);
 
     _covarianceWF.add(input);
@@ -46,7 +46,7 @@ using boost::intrusive_ptr;
 REGISTER_STABLE_WINDOW_FUNCTION(expMovingAvg,
                                 mongo::window_function::ExpressionExpMovingAvg::parse);
 
-void AccumulatorExpMovingAvg::processInternal(const Value& input, bool merging) {
+void AccumulatorExpMovingAvg::processInternal(Value input, bool merging) {
     tassert(5433600, "$expMovingAvg can't be merged", !merging);
     if (!input.numeric()) {
         return;
@@ -40,13 +40,13 @@ using boost::intrusive_ptr;
 
 REGISTER_ACCUMULATOR(first, genericParseSingleExpressionAccumulator<AccumulatorFirst>);
 
-void AccumulatorFirst::processInternal(const Value& input, bool merging) {
+void AccumulatorFirst::processInternal(Value input, bool merging) {
     /* only remember the first value seen */
     if (!_haveFirst) {
         // can't use pValue.missing() since we want the first value even if missing
         _haveFirst = true;
-        _first = input;
         _memUsageBytes = sizeof(*this) + input.getApproximateSize() - sizeof(Value);
+        _first = std::move(input);
         _needsInput = false;
     }
 }
@@ -60,7 +60,7 @@ class AccumulatorCovariance : public AccumulatorForWindowFunctions {
 public:
     AccumulatorCovariance(ExpressionContext* expCtx, bool isSamp);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -113,7 +113,7 @@ public:
     }
 
     explicit AccumulatorRank(ExpressionContext* const expCtx) : AccumulatorRankBase(expCtx) {}
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     static boost::intrusive_ptr<AccumulatorState> create(ExpressionContext* expCtx);
     void reset() final;
 
@@ -131,7 +131,7 @@ public:
 
     explicit AccumulatorDocumentNumber(ExpressionContext* const expCtx)
         : AccumulatorRankBase(expCtx) {}
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     static boost::intrusive_ptr<AccumulatorState> create(ExpressionContext* expCtx);
 };
 
@@ -144,7 +144,7 @@ public:
     }
 
     explicit AccumulatorDenseRank(ExpressionContext* const expCtx) : AccumulatorRankBase(expCtx) {}
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     static boost::intrusive_ptr<AccumulatorState> create(ExpressionContext* expCtx);
 };
 
@@ -159,7 +159,7 @@ public:
     explicit AccumulatorIntegral(ExpressionContext* expCtx,
                                  boost::optional<long long> unitMillis = boost::none);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
 
@@ -180,7 +180,7 @@ public:
 
     explicit AccumulatorLocf(ExpressionContext* expCtx);
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     Value getValue(bool toBeMerged) final;
     void reset() final;
     static boost::intrusive_ptr<AccumulatorState> create(ExpressionContext* expCtx);
@@ -47,7 +47,7 @@ AccumulatorIntegral::AccumulatorIntegral(ExpressionContext* const expCtx,
     _memUsageBytes = sizeof(*this);
 }
 
-void AccumulatorIntegral::processInternal(const Value& input, bool merging) {
+void AccumulatorIntegral::processInternal(Value input, bool merging) {
     tassert(5558800, "$integral can't be merged", !merging);
 
     _integralWF.add(input);
@@ -89,7 +89,7 @@ std::string AccumulatorInternalJsReduce::parseReduceFunction(BSONElement func) {
     return func._asCode();
 }
 
-void AccumulatorInternalJsReduce::processInternal(const Value& input, bool merging) {
+void AccumulatorInternalJsReduce::processInternal(Value input, bool merging) {
     if (input.missing()) {
         return;
     }
@@ -396,7 +396,7 @@ void AccumulatorJs::reset() {
     resetMemUsageBytes();
 }
 
-void AccumulatorJs::processInternal(const Value& input, bool merging) {
+void AccumulatorJs::processInternal(Value input, bool merging) {
     // _state should be nonempty because we populate it in startNewGroup.
     invariant(_state);
     invariant(_pendingCalls.empty() || _pendingCallsMerging == merging);
@@ -408,13 +408,12 @@ void AccumulatorJs::processInternal(const Value& input, bool merging) {
                 input.getType() == BSONType::Array);
     }
 
-    _pendingCalls.emplace_back(input);
-    _pendingCallsMerging = merging;
-
     // getApproximateSize includes sizeof(Value), but we already counted that in resetMemUsageBytes
     // as part of sizeof(*this).
-    incrementMemUsageBytes(input.getApproximateSize() - sizeof(Value) +
-                           sizeof(std::pair<Value, bool>));
+    const auto inputSize = input.getApproximateSize();
+    _pendingCalls.emplace_back(std::move(input));
+    _pendingCallsMerging = merging;
+    incrementMemUsageBytes(inputSize - sizeof(Value) + sizeof(std::pair<Value, bool>));
 }
 
 void AccumulatorJs::reduceMemoryConsumptionIfAble() {
@@ -58,7 +58,7 @@ public:
         _memUsageBytes = sizeof(*this);
     }
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
 
     Value getValue(bool toBeMerged) final;
 
@@ -98,7 +98,7 @@ public:
 
     Value getValue(bool toBeMerged) final;
     void reset() final;
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
     void reduceMemoryConsumptionIfAble() final;
 
 
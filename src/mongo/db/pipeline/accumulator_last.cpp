@@ -40,9 +40,9 @@ using boost::intrusive_ptr;
 
 REGISTER_ACCUMULATOR(last, genericParseSingleExpressionAccumulator<AccumulatorLast>);
 
-void AccumulatorLast::processInternal(const Value& input, bool merging) {
+void AccumulatorLast::processInternal(Value input, bool merging) {
     /* always remember the last value seen */
-    _last = input;
+    _last = std::move(input);
     _memUsageBytes = sizeof(*this) + _last.getApproximateSize() - sizeof(Value);
 }
 
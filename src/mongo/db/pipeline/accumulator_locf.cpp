@@ -50,11 +50,11 @@ AccumulatorLocf::AccumulatorLocf(ExpressionContext* const expCtx)
     _memUsageBytes = sizeof(*this) + _lastNonNull.getApproximateSize();
 }
 
-void AccumulatorLocf::processInternal(const Value& input, bool merging) {
+void AccumulatorLocf::processInternal(Value input, bool merging) {
     tassert(6050100, "$locf can't be merged", !merging);
 
     if (!input.nullish()) {
-        _lastNonNull = input;
+        _lastNonNull = std::move(input);
         _memUsageBytes = sizeof(*this) + _lastNonNull.getApproximateSize();
     }
 }
@@ -59,7 +59,7 @@ void AccumulatorMergeObjects::reset() {
     _output.reset();
 }
 
-void AccumulatorMergeObjects::processInternal(const Value& input, bool merging) {
+void AccumulatorMergeObjects::processInternal(Value input, bool merging) {
     if (input.nullish()) {
         return;
     }
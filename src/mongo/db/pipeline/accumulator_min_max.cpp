@@ -48,14 +48,14 @@ REGISTER_STABLE_EXPRESSION(min, ExpressionFromAccumulator<AccumulatorMin>::parse
 REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(max, AccumulatorMax, WindowFunctionMax);
 REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(min, AccumulatorMin, WindowFunctionMin);
 
-void AccumulatorMinMax::processInternal(const Value& input, bool merging) {
+void AccumulatorMinMax::processInternal(Value input, bool merging) {
     // nullish values should have no impact on result
     if (!input.nullish()) {
         /* compare with the current value; swap if appropriate */
         int cmp = getExpressionContext()->getValueComparator().compare(_val, input) * _sense;
         if (cmp > 0 || _val.missing()) {  // missing is lower than all other values
-            _val = input;
-            _memUsageBytes = sizeof(*this) + input.getApproximateSize() - sizeof(Value);
+            _val = std::move(input);
+            _memUsageBytes = sizeof(*this) + _val.getApproximateSize() - sizeof(Value);
         }
     }
 }
@@ -147,7 +147,7 @@ void AccumulatorN::startNewGroup(const Value& input) {
     _n = validateN(input);
 }
 
-void AccumulatorN::processInternal(const Value& input, bool merging) {
+void AccumulatorN::processInternal(Value input, bool merging) {
     tassert(5787802, "'n' must be initialized", _n);
 
     if (merging) {
@@ -706,7 +706,7 @@ void AccumulatorTopBottomN<sense, single>::remove(const Value& val) {
 }
 
 template <TopBottomSense sense, bool single>
-void AccumulatorTopBottomN<sense, single>::processInternal(const Value& input, bool merging) {
+void AccumulatorTopBottomN<sense, single>::processInternal(Value input, bool merging) {
     if (merging) {
         if (input.isArray()) {
             // In the simplest case, we are merging arrays. This happens when we are merging
@@ -69,7 +69,7 @@ public:
      */
     static long long validateN(const Value& input);
 
-    void processInternal(const Value& input, bool merging) override;
+    void processInternal(Value input, bool merging) override;
 
     /**
      * Initialize 'n' with 'input'.
@@ -291,7 +291,7 @@ public:
         }
     }
 
-    void processInternal(const Value& input, bool merging) final;
+    void processInternal(Value input, bool merging) final;
 
     Value getValueConst(bool toBeMerged) const;
     Value getValue(bool toBeMerged) final {
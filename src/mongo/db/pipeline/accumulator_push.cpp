@@ -46,11 +46,12 @@ using std::vector;
 REGISTER_ACCUMULATOR(push, genericParseSingleExpressionAccumulator<AccumulatorPush>);
 REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(push, AccumulatorPush, WindowFunctionPush);
 
-void AccumulatorPush::processInternal(const Value& input, bool merging) {
+void AccumulatorPush::processInternal(Value input, bool merging) {
     if (!merging) {
         if (!input.missing()) {
-            _array.push_back(input);
-            _memUsageBytes += input.getApproximateSize();
+            const auto size = input.getApproximateSize();
+            _array.push_back(std::move(input));
+            _memUsageBytes += size;
             uassert(ErrorCodes::ExceededMemoryLimit,
                     str::stream()
                         << "$push used too much memory and cannot spill to disk. Memory limit: "
@@ -53,31 +53,31 @@ REGISTER_STABLE_WINDOW_FUNCTION(
     documentNumber,
     mongo::window_function::ExpressionFromRankAccumulator<AccumulatorDocumentNumber>::parse);
 
-void AccumulatorRank::processInternal(const Value& input, bool merging) {
+void AccumulatorRank::processInternal(Value input, bool merging) {
     tassert(5417001, "$rank can't be merged", !merging);
     if (!_lastInput ||
         getExpressionContext()->getValueComparator().compare(_lastInput.get(), input) != 0) {
         _lastRank += _numSameRank;
         _numSameRank = 1;
-        _lastInput = input;
+        _lastInput = std::move(input);
         _memUsageBytes = sizeof(*this) + _lastInput->getApproximateSize() - sizeof(Value);
     } else {
         ++_numSameRank;
     }
 }
 
-void AccumulatorDocumentNumber::processInternal(const Value& input, bool merging) {
+void AccumulatorDocumentNumber::processInternal(Value input, bool merging) {
     tassert(5417002, "$documentNumber can't be merged", !merging);
     // DocumentNumber doesn't need to keep track of what we just saw.
     ++_lastRank;
 }
 
-void AccumulatorDenseRank::processInternal(const Value& input, bool merging) {
+void AccumulatorDenseRank::processInternal(Value input, bool merging) {
     tassert(5417003, "$denseRank can't be merged", !merging);
     if (!_lastInput ||
         getExpressionContext()->getValueComparator().compare(_lastInput.get(), input) != 0) {
         ++_lastRank;
-        _lastInput = input;
+        _lastInput = std::move(input);
         _memUsageBytes = sizeof(*this) + _lastInput->getApproximateSize() - sizeof(Value);
     }
 }
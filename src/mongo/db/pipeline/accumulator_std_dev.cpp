@@ -51,7 +51,7 @@ REGISTER_STABLE_REMOVABLE_WINDOW_FUNCTION(stdDevSamp,
                                           AccumulatorStdDevSamp,
                                           WindowFunctionStdDevSamp);
 
-void AccumulatorStdDev::processInternal(const Value& input, bool merging) {
+void AccumulatorStdDev::processInternal(Value input, bool merging) {
     if (!merging) {
         // non numeric types have no impact on standard deviation
         if (!input.numeric())
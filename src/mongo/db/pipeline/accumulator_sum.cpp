@@ -102,7 +102,7 @@ void applyPartialSum(const std::vector<Value>& arr,
     }
 }
 
-void AccumulatorSum::processInternal(const Value& input, bool merging) {
+void AccumulatorSum::processInternal(Value input, bool merging) {
     if (!input.numeric()) {
         // Ignore non-numeric inputs when not merging.
         if (!merging) {
@@ -43,10 +43,10 @@
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/record_id_helpers.h"
-#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
+#include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
@@ -141,7 +141,20 @@ public:
     // upper bounds of a range are inclusive.
     class Iterator {
     public:
-        using RecordIdRange = std::pair<RecordId, RecordId>;
+        // In addition to the bounds, a range carries the number of documents it spans and their
+        // total size in bytes, so that the caller can adjust the collection's fast-count and data
+        // size after truncating the range without visiting the individual documents.
+        struct RecordIdRange {
+            RecordId minRecordId;
+            RecordId maxRecordId;
+            int64_t numRecords = 0;
+            int64_t bytes = 0;
+
+            // Two ranges are equal if they span the same record ids.
+            friend bool operator==(const RecordIdRange& a, const RecordIdRange& b) {
+                return a.minRecordId == b.minRecordId && a.maxRecordId == b.maxRecordId;
+            }
+        };
 
         Iterator(OperationContext* opCtx,
                  const CollectionPtr* preImagesCollPtr,
@@ -185,12 +198,14 @@ public:
         // more expired pre-images left.
         void advance() {
             const auto getNextPreImageAttributes =
-                [&](std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>& planExecutor)
+                [&](std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>& planExecutor,
+                    int64_t* preImageSizeBytes)
                 -> boost::optional<preImageRemoverInternal::PreImageAttributes> {
                 BSONObj preImageObj;
                 if (planExecutor->getNext(&preImageObj, nullptr) == PlanExecutor::IS_EOF) {
                     return boost::none;
                 }
+                *preImageSizeBytes = preImageObj.objsize();
 
                 auto preImage =
                     ChangeStreamPreImage::parse(IDLParserErrorContext("pre-image"), preImageObj);
@@ -207,12 +222,14 @@ public:
                                                             Timestamp::max(),
                                                             std::numeric_limits<int64_t>::max()))))
                     : createCollectionScan(boost::none);
-                auto preImageAttributes = getNextPreImageAttributes(planExecutor);
+                int64_t preImageSizeBytes = 0;
+                auto preImageAttributes =
+                    getNextPreImageAttributes(planExecutor, &preImageSizeBytes);
 
                 // If there aren't any pre-images left, set the range to the empty record ids and
                 // return.
                 if (!preImageAttributes) {
-                    _currentExpiredPreImageRange = std::pair(RecordId(), RecordId());
+                    _currentExpiredPreImageRange = RecordIdRange{};
                     return;
                 }
                 const auto currentCollectionUUID = preImageAttributes->collectionUUID;
@@ -225,46 +242,34 @@ public:
                     continue;
                 }
 
-                // If an expired pre-image is found, compute the max expired pre-image RecordId for
-                // this collection depending on the expiration parameter being set.
-                const auto minKey =
+                // An expired pre-image was found. Keep scanning forward while the pre-images stay
+                // expired to find the last record id of the range and to count the records and
+                // bytes the truncation will remove. The extra reads are cheap compared to removing
+                // the documents one-by-one, and they let the storage engine adjust its fast-count
+                // and data size without visiting the range it truncates.
+                RecordIdRange range;
+                range.minRecordId =
                     toRecordId(ChangeStreamPreImageId(currentCollectionUUID, Timestamp(), 0));
-                RecordId maxKey;
-                if (_preImageExpirationTime) {
-                    // Reset the collection scan to start one increment before the
-                    // '_earliestOplogEntryTimestamp', as the pre-images with smaller or equal
-                    // timestamp are guaranteed to be expired.
-                    Timestamp lastExpiredPreimageTs(_earliestOplogEntryTimestamp.asULL() - 1);
-                    auto planExecutor = createCollectionScan(RecordIdBound(
-                        toRecordId(ChangeStreamPreImageId(currentCollectionUUID,
-                                                          lastExpiredPreimageTs,
-                                                          std::numeric_limits<int64_t>::max()))));
-
-                    // Iterate over all the expired pre-images in the collection in order to find
-                    // the max RecordId.
-                    while ((preImageAttributes = getNextPreImageAttributes(planExecutor)) &&
-                           preImageAttributes->isExpiredPreImage(_preImageExpirationTime,
-                                                                 _earliestOplogEntryTimestamp) &&
-                           preImageAttributes->collectionUUID == currentCollectionUUID) {
-                        lastExpiredPreimageTs = preImageAttributes->ts;
-                    }
-
-                    maxKey =
-                        toRecordId(ChangeStreamPreImageId(currentCollectionUUID,
-                                                          lastExpiredPreimageTs,
-                                                          std::numeric_limits<int64_t>::max()));
-                } else {
-                    // If the expiration parameter is not set, then the last expired pre-image
-                    // timestamp equals to one increment before the '_earliestOplogEntryTimestamp'.
-                    maxKey = toRecordId(
-                        ChangeStreamPreImageId(currentCollectionUUID,
-                                               Timestamp(_earliestOplogEntryTimestamp.asULL() - 1),
-                                               std::numeric_limits<int64_t>::max()));
+                Timestamp lastExpiredPreimageTs = preImageAttributes->ts;
+                range.numRecords = 1;
+                range.bytes = preImageSizeBytes;
+                while ((preImageAttributes =
+                            getNextPreImageAttributes(planExecutor, &preImageSizeBytes)) &&
+                       preImageAttributes->isExpiredPreImage(_preImageExpirationTime,
+                                                             _earliestOplogEntryTimestamp) &&
+                       preImageAttributes->collectionUUID == currentCollectionUUID) {
+                    lastExpiredPreimageTs = preImageAttributes->ts;
+                    ++range.numRecords;
+                    range.bytes += preImageSizeBytes;
                 }
+                range.maxRecordId =
+                    toRecordId(ChangeStreamPreImageId(currentCollectionUUID,
+                                                      lastExpiredPreimageTs,
+                                                      std::numeric_limits<int64_t>::max()));
                 tassert(6138300,
                         "Max key of the expired pre-image range has to be valid",
-                        maxKey.isValid());
-                _currentExpiredPreImageRange = std::pair(minKey, maxKey);
+                        range.maxRecordId.isValid());
+                _currentExpiredPreImageRange = range;
                 return;
             }
         }
@@ -334,19 +339,12 @@ void deleteExpiredChangeStreamPreImages(Client* client, Date_t currentTimeForTim
         return;
     }
 
-    // Do not run the job on secondaries.
-    if (!repl::ReplicationCoordinator::get(opCtx.get())
-             ->canAcceptWritesForDatabase(opCtx.get(), NamespaceString::kAdminDb)) {
-        return;
-    }
-
     // Get the timestamp of the ealiest oplog entry.
     const auto currentEarliestOplogEntryTs =
         repl::StorageInterface::get(client->getServiceContext())
             ->getEarliestOplogTimestamp(opCtx.get());
 
-    const bool isBatchedRemoval = gBatchedExpiredChangeStreamPreImageRemoval.load();
-    size_t numberOfRemovals = 0;
+    int64_t numberOfRemovals = 0;
 
     ChangeStreamExpiredPreImageIterator expiredPreImages(
         opCtx.get(),
@@ -355,31 +353,27 @@ void deleteExpiredChangeStreamPreImages(Client* client, Date_t currentTimeForTim
         ::mongo::preImageRemoverInternal::getPreImageExpirationTime(
             opCtx.get(), currentTimeForTimeBasedExpiration));
 
+    // Each expired range is removed with a single record store truncate instead of deleting the
+    // documents one-by-one through the query path. The truncates are not replicated, so every
+    // node, including secondaries, prunes its own copy of the collection without generating an
+    // oplog entry per removed document.
     for (const auto& collectionRange : expiredPreImages) {
         writeConflictRetry(
             opCtx.get(),
             "ChangeStreamExpiredPreImagesRemover",
             NamespaceString::kChangeStreamPreImagesNamespace.ns(),
             [&] {
-                auto params = std::make_unique<DeleteStageParams>();
-                params->isMulti = true;
-
-                boost::optional<std::unique_ptr<BatchedDeleteStageBatchParams>> batchParams;
-                if (isBatchedRemoval) {
-                    batchParams = std::make_unique<BatchedDeleteStageBatchParams>();
-                }
-
-                auto exec = InternalPlanner::deleteWithCollectionScan(
-                    opCtx.get(),
-                    &preImagesColl,
-                    std::move(params),
-                    PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
-                    InternalPlanner::Direction::FORWARD,
-                    RecordIdBound(collectionRange.first),
-                    RecordIdBound(collectionRange.second),
-                    std::move(batchParams));
-                numberOfRemovals += exec->executeDelete();
+                repl::UnreplicatedWritesBlock unreplicatedWritesBlock(opCtx.get());
+                WriteUnitOfWork wuow(opCtx.get());
+                uassertStatusOK(
+                    preImagesColl->getRecordStore()->rangeTruncate(opCtx.get(),
+                                                                   collectionRange.minRecordId,
+                                                                   collectionRange.maxRecordId,
+                                                                   -collectionRange.bytes,
+                                                                   -collectionRange.numRecords));
+                wuow.commit();
             });
+        numberOfRemovals += collectionRange.numRecords;
     }
 
     LOGV2(5869104,
@@ -50,21 +50,19 @@ std::unique_ptr<MatchExpression> buildTsFilter(
 
 std::unique_ptr<MatchExpression> buildFromMigrateSystemOpFilter(
     const boost::intrusive_ptr<ExpressionContext>& expCtx, const MatchExpression* userMatch) {
-    auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
-
     // The filter {fromMigrate:true} allows quickly skip nonrelevant oplog entries
     auto andMigrateEvents = std::make_unique<AndMatchExpression>();
     andMigrateEvents->add(
         MatchExpressionParser::parseAndNormalize(BSON("fromMigrate" << true), expCtx));
-    andMigrateEvents->add(
-        MatchExpressionParser::parseAndNormalize(BSON("ns" << BSONRegEx(cmdNsRegex)), expCtx));
+    andMigrateEvents->add(MatchExpressionParser::parseAndNormalize(
+        DocumentSourceChangeStream::getCmdNsMatchForChangeStream(expCtx, "ns"), expCtx));
 
     auto orMigrateEvents = std::make_unique<OrMatchExpression>();
-    auto collRegex = DocumentSourceChangeStream::getCollRegexForChangeStream(expCtx);
-    orMigrateEvents->add(
-        MatchExpressionParser::parseAndNormalize(BSON("o.create" << BSONRegEx(collRegex)), expCtx));
     orMigrateEvents->add(MatchExpressionParser::parseAndNormalize(
-        BSON("o.createIndexes" << BSONRegEx(collRegex)), expCtx));
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.create"), expCtx));
+    orMigrateEvents->add(MatchExpressionParser::parseAndNormalize(
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.createIndexes"),
+        expCtx));
     andMigrateEvents->add(std::move(orMigrateEvents));
     return andMigrateEvents;
 }
@@ -87,11 +85,6 @@ std::unique_ptr<MatchExpression> buildNotFromMigrateFilter(
 std::unique_ptr<MatchExpression> buildOperationFilter(
     const boost::intrusive_ptr<ExpressionContext>& expCtx, const MatchExpression* userMatch) {
 
-    // Regexes to match each of the necessary namespace components for the current stream type.
-    auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
-    auto collRegex = DocumentSourceChangeStream::getCollRegexForChangeStream(expCtx);
-    auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
-
     auto streamType = DocumentSourceChangeStream::getChangeStreamType(expCtx->ns);
 
     /**
@@ -105,12 +98,12 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
     // The standard event filter, before it is combined with the user filter, is as follows:
     //    {
     //      $or: [
-    //        {ns: nsRegex, $nor: [{op: "n"}, {op: "c"}]},    // CRUD events
-    //        {ns: cmdNsRegex, op: "c", $or: [                // Commands on relevant DB(s)
-    //          {"o.drop": collRegex},                        // Drops of relevant collection(s)
-    //          {"o.renameCollection": nsRegex},              // Renames of relevant collection(s)
+    //        {ns: nsMatch, $nor: [{op: "n"}, {op: "c"}]},    // CRUD events
+    //        {ns: cmdNsMatch, op: "c", $or: [                // Commands on relevant DB(s)
+    //          {"o.drop": collMatch},                        // Drops of relevant collection(s)
+    //          {"o.renameCollection": nsMatch},              // Renames of relevant collection(s)
     //          {"o.renameCollection": {$exists: true},       // Relevant collection was overwritten
-    //              "o.to": nsRegex},
+    //              "o.to": nsMatch},
     //          {"o.dropDatabase": {$exists: true}}           // Omitted for single-coll streams
     //        ]}
     //      ]
@@ -120,28 +113,43 @@ std::unique_ptr<MatchExpression> buildOperationFilter(
     std::unique_ptr<ListOfMatchExpression> operationFilter = std::make_unique<OrMatchExpression>();
 
     // (1) CRUD events on a monitored namespace.
-    auto crudEvents = BSON("ns" << BSONRegEx(nsRegex) << "$nor"
-                                << BSON_ARRAY(BSON("op"
-                                                   << "n")
-                                              << BSON("op"
-                                                      << "c")));
+    BSONObjBuilder crudEventsBuilder;
+    crudEventsBuilder.appendElements(
+        DocumentSourceChangeStream::getNsMatchForChangeStream(expCtx, "ns"));
+    crudEventsBuilder.append("$nor",
+                             BSON_ARRAY(BSON("op"
+                                             << "n")
+                                        << BSON("op"
+                                                << "c")));
+    auto crudEvents = crudEventsBuilder.obj();
 
     // (2.1) The namespace for matching relevant commands.
-    auto cmdNsMatch = BSON("op"
-                           << "c"
-                           << "ns" << BSONRegEx(cmdNsRegex));
+    BSONObjBuilder cmdNsMatchBuilder;
+    cmdNsMatchBuilder.append("op", "c");
+    cmdNsMatchBuilder.appendElements(
+        DocumentSourceChangeStream::getCmdNsMatchForChangeStream(expCtx, "ns"));
+    auto cmdNsMatch = cmdNsMatchBuilder.obj();
 
     // (2.2) Commands that are run on a monitored database and/or collection.
-    auto dropEvent = BSON("o.drop" << BSONRegEx(collRegex));
+    auto dropEvent = DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.drop");
     auto dropDbEvent = BSON("o.dropDatabase" << BSON("$exists" << true));
-    auto renameFromEvent = BSON("o.renameCollection" << BSONRegEx(nsRegex));
-    auto renameToEvent =
-        BSON("o.renameCollection" << BSON("$exists" << true) << "o.to" << BSONRegEx(nsRegex));
-    const auto createEvent = BSON("o.create" << BSONRegEx(collRegex));
-    const auto createIndexesEvent = BSON("o.createIndexes" << BSONRegEx(collRegex));
-    const auto commitIndexBuildEvent = BSON("o.commitIndexBuild" << BSONRegEx(collRegex));
-    const auto dropIndexesEvent = BSON("o.dropIndexes" << BSONRegEx(collRegex));
-    const auto collModEvent = BSON("o.collMod" << BSONRegEx(collRegex));
+    auto renameFromEvent =
+        DocumentSourceChangeStream::getNsMatchForChangeStream(expCtx, "o.renameCollection");
+    BSONObjBuilder renameToBuilder;
+    renameToBuilder.append("o.renameCollection", BSON("$exists" << true));
+    renameToBuilder.appendElements(
+        DocumentSourceChangeStream::getNsMatchForChangeStream(expCtx, "o.to"));
+    auto renameToEvent = renameToBuilder.obj();
+    const auto createEvent =
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.create");
+    const auto createIndexesEvent =
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.createIndexes");
+    const auto commitIndexBuildEvent =
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.commitIndexBuild");
+    const auto dropIndexesEvent =
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.dropIndexes");
+    const auto collModEvent =
+        DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.collMod");
 
     auto orCmdEvents = std::make_unique<OrMatchExpression>();
     orCmdEvents->add(MatchExpressionParser::parseAndNormalize(dropEvent, expCtx));
@@ -245,23 +253,24 @@ std::unique_ptr<MatchExpression> buildTransactionFilter(
         // 'prevOpTime' link to another 'applyOps' command, indicating a multi-entry transaction.
         BSONArrayBuilder orBuilder(applyOpsBuilder.subarrayStart("$or"));
         {
-            // Regexes for full-namespace, collection, and command-namespace matching.
-            auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
-            auto collRegex = DocumentSourceChangeStream::getCollRegexForChangeStream(expCtx);
-            auto cmdNsRegex = DocumentSourceChangeStream::getCmdNsRegexForChangeStream(expCtx);
-
             // Match relevant CRUD events on the monitored namespaces.
-            orBuilder.append(BSON("o.applyOps.ns" << BSONRegEx(nsRegex)));
+            orBuilder.append(
+                DocumentSourceChangeStream::getNsMatchForChangeStream(expCtx, "o.applyOps.ns"));
 
             // Match relevant command events on the monitored namespaces.
-            orBuilder.append(BSON(
-                "o.applyOps" << BSON(
-                    "$elemMatch" << BSON(
-                        "ns" << BSONRegEx(cmdNsRegex)
-                             << OR(BSON("o.create" << BSONRegEx(collRegex)),
-                                   // We don't need to consider 'o.commitIndexBuild' here because
-                                   // creating an index on a non-empty collection is not allowed.
-                                   BSON("o.createIndexes" << BSONRegEx(collRegex)))))));
+            BSONObjBuilder elemMatchBuilder;
+            elemMatchBuilder.appendElements(
+                DocumentSourceChangeStream::getCmdNsMatchForChangeStream(expCtx, "ns"));
+            elemMatchBuilder.append(
+                "$or",
+                BSON_ARRAY(
+                    DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx, "o.create")
+                    // We don't need to consider 'o.commitIndexBuild' here because
+                    // creating an index on a non-empty collection is not allowed.
+                    << DocumentSourceChangeStream::getCollMatchForChangeStream(expCtx,
+                                                                              "o.createIndexes")));
+            orBuilder.append(
+                BSON("o.applyOps" << BSON("$elemMatch" << elemMatchBuilder.obj())));
 
             // The default repl::OpTime is the value used to indicate a null "prevOpTime" link.
             orBuilder.append(BSON(repl::OplogEntry::kPrevWriteOpTimeInTransactionFieldName
@@ -311,12 +320,13 @@ std::unique_ptr<MatchExpression> buildInternalOpFilter(
     }
 
     // Also filter for shardCollection events, which are recorded as {op: 'n'} in the oplog.
-    auto nsRegex = DocumentSourceChangeStream::getNsRegexForChangeStream(expCtx);
-    internalOpTypeOrBuilder.append(BSON("o2.shardCollection" << BSONRegEx(nsRegex)));
+    internalOpTypeOrBuilder.append(
+        DocumentSourceChangeStream::getNsMatchForChangeStream(expCtx, "o2.shardCollection"));
 
     // Only return the 'migrateLastChunkFromShard' event if 'showSystemEvents' is set.
     if (expCtx->changeStreamSpec->getShowSystemEvents()) {
-        internalOpTypeOrBuilder.append(BSON("o2.migrateLastChunkFromShard" << BSONRegEx(nsRegex)));
+        internalOpTypeOrBuilder.append(DocumentSourceChangeStream::getNsMatchForChangeStream(
+            expCtx, "o2.migrateLastChunkFromShard"));
     }
 
     // Finalize the array of $or filter predicates.
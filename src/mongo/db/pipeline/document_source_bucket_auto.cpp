@@ -31,6 +31,8 @@
 
 #include "mongo/db/pipeline/document_source_bucket_auto.h"
 
+#include <algorithm>
+
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
@@ -90,6 +92,10 @@ const char* DocumentSourceBucketAuto::getSourceName() const {
 }
 
 DocumentSource::GetNextResult DocumentSourceBucketAuto::doGetNext() {
+    if (!_approxBoundaries.empty()) {
+        return doStreamingGetNext();
+    }
+
     if (!_populated) {
         const auto populationResult = populateSorter();
         if (populationResult.isPaused()) {
@@ -115,6 +121,119 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::doGetNext() {
     return GetNextResult::makeEOF();
 }
 
+void DocumentSourceBucketAuto::setApproximateBoundaries(std::vector<Value> boundaries) {
+    tassert(6929921,
+            "Cannot set approximate boundaries on a $bucketAuto with a granularity, after "
+            "execution has begun, or with more cut points than internal bucket boundaries",
+            !_granularityRounder && !_populated && !_sorter &&
+                boundaries.size() < static_cast<size_t>(_nBuckets));
+    _approxBoundaries = std::move(boundaries);
+}
+
+DocumentSource::GetNextResult DocumentSourceBucketAuto::doStreamingGetNext() {
+    if (!_populated) {
+        const auto populationResult = populateStreamingBuckets();
+        if (populationResult.isPaused()) {
+            return populationResult;
+        }
+        invariant(populationResult.isEOF());
+
+        finalizeStreamingBuckets();
+        _populated = true;
+    }
+
+    if (_nextStreamedBucket < _streamedBuckets.size()) {
+        return makeDocument(_streamedBuckets[_nextStreamedBucket++]);
+    }
+
+    dispose();
+    return GetNextResult::makeEOF();
+}
+
+DocumentSource::GetNextResult DocumentSourceBucketAuto::populateStreamingBuckets() {
+    if (_streamedBuckets.empty()) {
+        // One bucket per gap between the cut points, including one below the first cut point and
+        // one above the last.
+        Document emptyDoc;
+        for (size_t i = 0; i < _approxBoundaries.size() + 1; ++i) {
+            Bucket bucket(pExpCtx, Value(), Value(), _accumulatedFields);
+            // Evaluate each initializer against an empty document, as the sorted path does.
+            for (size_t k = 0; k < _accumulatedFields.size(); ++k) {
+                Value initializerValue =
+                    _accumulatedFields[k].expr.initializer->evaluate(emptyDoc, &pExpCtx->variables);
+                bucket._accums[k]->startNewGroup(initializerValue);
+            }
+            _streamedBuckets.push_back(std::move(bucket));
+        }
+    }
+
+    const auto& valueCmp = pExpCtx->getValueComparator();
+    auto next = pSource->getNext();
+    for (; next.isAdvanced(); next = pSource->getNext()) {
+        auto nextDoc = next.releaseDocument();
+        Value key = extractKey(nextDoc);
+
+        // The first cut point greater than the key identifies the bucket, making bucket minimums
+        // inclusive and maximums exclusive.
+        auto boundaryIt = std::upper_bound(
+            _approxBoundaries.begin(), _approxBoundaries.end(), key, valueCmp.getLessThan());
+        auto& bucket = _streamedBuckets[boundaryIt - _approxBoundaries.begin()];
+
+        if (bucket._count == 0) {
+            bucket._min = key;
+            bucket._max = key;
+        } else if (valueCmp.evaluate(key < bucket._min)) {
+            bucket._min = key;
+        } else if (valueCmp.evaluate(key > bucket._max)) {
+            bucket._max = key;
+        }
+        ++bucket._count;
+
+        for (size_t k = 0; k < _accumulatedFields.size(); k++) {
+            if (bucket._accums[k]->needsInput()) {
+                bucket._accums[k]->process(
+                    _accumulatedFields[k].expr.argument->evaluate(nextDoc, &pExpCtx->variables),
+                    false);
+            }
+        }
+
+        // Unlike the sorted path, all buckets accumulate concurrently, so enforce the memory
+        // limit across them; there is no spilling in this mode.
+        if (++_nDocuments % 1024 == 0) {
+            uint64_t memUsage = 0;
+            for (auto&& memBucket : _streamedBuckets) {
+                for (auto&& accum : memBucket._accums) {
+                    memUsage += accum->getMemUsage();
+                }
+            }
+            uassert(6929922,
+                    str::stream() << "Exceeded memory limit for $bucketAuto with approximate "
+                                     "boundaries. Memory limit: "
+                                  << _maxMemoryUsageBytes << " bytes",
+                    memUsage <= _maxMemoryUsageBytes);
+        }
+    }
+    return next;
+}
+
+void DocumentSourceBucketAuto::finalizeStreamingBuckets() {
+    std::vector<Bucket> nonEmptyBuckets;
+    nonEmptyBuckets.reserve(_streamedBuckets.size());
+    for (auto&& bucket : _streamedBuckets) {
+        if (bucket._count > 0) {
+            nonEmptyBuckets.push_back(std::move(bucket));
+        }
+    }
+
+    // Stitch the observed bounds together so that each bucket's max is the next bucket's min,
+    // keeping minimums inclusive and maximums exclusive except for the last bucket, exactly as
+    // the sorted path reports them.
+    for (size_t i = 0; i + 1 < nonEmptyBuckets.size(); ++i) {
+        nonEmptyBuckets[i]._max = nonEmptyBuckets[i + 1]._min;
+    }
+    _streamedBuckets = std::move(nonEmptyBuckets);
+}
+
 boost::intrusive_ptr<DocumentSource> DocumentSourceBucketAuto::optimize() {
     _groupByExpression = _groupByExpression->optimize();
     for (auto&& accumulatedField : _accumulatedFields) {
@@ -370,6 +489,8 @@ Document DocumentSourceBucketAuto::makeDocument(const Bucket& bucket) {
 
 void DocumentSourceBucketAuto::doDispose() {
     _sortedInput.reset();
+    _streamedBuckets.clear();
+    _nextStreamedBucket = 0;
 }
 
 Value DocumentSourceBucketAuto::serialize(
@@ -95,6 +95,29 @@ public:
     const boost::intrusive_ptr<Expression> getGroupByExpression() const;
     const std::vector<AccumulationStatement>& getAccumulatedFields() const;
 
+    bool usesGranularity() const {
+        return static_cast<bool>(_granularityRounder);
+    }
+
+    int getNumBuckets() const {
+        return _nBuckets;
+    }
+
+    /**
+     * Seeds this stage with fixed, approximate bucket boundaries, typically derived from a random
+     * sample of the collection. Once set, the stage aggregates in a single streaming pass rather
+     * than sorting and buffering its entire input: each document is routed to the bucket whose
+     * boundary range contains its 'groupBy' value, and the reported bucket bounds are the observed
+     * per-bucket minimum and maximum, preserving the usual inclusive-min/exclusive-max output
+     * contract. Buckets are then only approximately evenly filled.
+     *
+     * The 'boundaries' are the internal cut points (strictly ascending, at most numBuckets - 1 of
+     * them); values below the first cut point fall in the first bucket and values greater than or
+     * equal to the last cut point fall in the last bucket. Illegal to call once execution has
+     * begun or if a 'granularity' was specified.
+     */
+    void setApproximateBoundaries(std::vector<Value> boundaries);
+
 protected:
     GetNextResult doGetNext() final;
     void doDispose() final;
@@ -115,6 +138,9 @@ private:
                const std::vector<AccumulationStatement>& accumulationStatements);
         Value _min;
         Value _max;
+        // Number of documents in the bucket; only maintained when aggregating in a streaming pass
+        // with approximate boundaries.
+        long long _count = 0;
         std::vector<boost::intrusive_ptr<AccumulatorState>> _accums;
     };
 
@@ -145,6 +171,20 @@ private:
      */
     boost::optional<Bucket> populateNextBucket();
 
+    /**
+     * The streaming counterparts of doGetNext()/populateSorter(), used when approximate
+     * boundaries have been provided via setApproximateBoundaries(). Documents are accumulated
+     * directly into the fixed buckets without sorting or buffering the input.
+     */
+    GetNextResult doStreamingGetNext();
+    GetNextResult populateStreamingBuckets();
+
+    /**
+     * Drops empty buckets and stitches the observed bucket bounds together so that each bucket's
+     * max equals the next bucket's min, matching the sorted path's output contract.
+     */
+    void finalizeStreamingBuckets();
+
     boost::optional<std::pair<Value, Document>> adjustBoundariesAndGetMinForNextBucket(
         Bucket* currentBucket);
     /**
@@ -170,6 +210,12 @@ private:
     int _nBuckets;
     long long _nDocuments = 0;
     BucketDetails _currentBucketDetails;
+
+    // When non-empty, the internal cut points provided by setApproximateBoundaries(), and the
+    // fixed buckets the streaming pass accumulates into.
+    std::vector<Value> _approxBoundaries;
+    std::vector<Bucket> _streamedBuckets;
+    size_t _nextStreamedBucket = 0;
 };
 
 }  // namespace mongo
@@ -853,5 +853,78 @@ TEST_F(BucketAutoTests, ShouldFailOnNegativeNumbersWhenGranularitySpecified) {
         AssertionException,
         40260);
 }
+
+vector<Document> getStreamingResults(BSONObj bucketAutoSpec,
+                                     vector<Value> boundaries,
+                                     deque<Document> inputs,
+                                     const boost::intrusive_ptr<ExpressionContext>& expCtx) {
+    auto bucketAutoStage = DocumentSourceBucketAuto::createFromBson(
+        bucketAutoSpec.firstElement(), expCtx);
+    auto* typedStage = dynamic_cast<DocumentSourceBucketAuto*>(bucketAutoStage.get());
+    ASSERT(typedStage);
+    typedStage->setApproximateBoundaries(std::move(boundaries));
+
+    deque<DocumentSource::GetNextResult> mockInputs;
+    for (auto&& input : inputs) {
+        mockInputs.emplace_back(std::move(input));
+    }
+    auto source = DocumentSourceMock::createForTest(std::move(mockInputs), expCtx);
+    bucketAutoStage->setSource(source.get());
+
+    vector<Document> results;
+    for (auto next = bucketAutoStage->getNext(); next.isAdvanced();
+         next = bucketAutoStage->getNext()) {
+        results.push_back(next.releaseDocument());
+    }
+    return results;
+}
+
+TEST_F(BucketAutoTests, StreamingPassUsesApproximateBoundaries) {
+    auto bucketAutoSpec = fromjson("{$bucketAuto : {groupBy : '$x', buckets : 2}}");
+
+    // With a cut point at 3, values below 3 land in the first bucket and the rest in the second.
+    auto results = getStreamingResults(
+        bucketAutoSpec,
+        {Value(3)},
+        {Document{{"x", 4}}, Document{{"x", 1}}, Document{{"x", 3}}, Document{{"x", 2}}},
+        getExpCtx());
+
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 1, max : 3}, count : 2}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 3, max : 4}, count : 2}")));
+}
+
+TEST_F(BucketAutoTests, StreamingPassOmitsEmptyBucketsAndStitchesBoundaries) {
+    auto bucketAutoSpec = fromjson("{$bucketAuto : {groupBy : '$x', buckets : 4}}");
+
+    // Nothing falls between the cut points 10 and 20, so that bucket is dropped and the
+    // neighbouring boundaries are stitched together.
+    auto results = getStreamingResults(
+        bucketAutoSpec,
+        {Value(10), Value(20), Value(30)},
+        {Document{{"x", 1}}, Document{{"x", 5}}, Document{{"x", 25}}, Document{{"x", 35}}},
+        getExpCtx());
+
+    ASSERT_EQUALS(results.size(), 3UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 1, max : 25}, count : 2}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 25, max : 35}, count : 1}")));
+    ASSERT_DOCUMENT_EQ(results[2], Document(fromjson("{_id : {min : 35, max : 35}, count : 1}")));
+}
+
+TEST_F(BucketAutoTests, StreamingPassComputesAccumulators) {
+    auto bucketAutoSpec = fromjson(
+        "{$bucketAuto : {groupBy : '$x', buckets : 2, output : {sum : {$sum : '$y'}}}}");
+
+    auto results = getStreamingResults(bucketAutoSpec,
+                                       {Value(3)},
+                                       {Document{{"x", 1}, {"y", 10}},
+                                        Document{{"x", 4}, {"y", 30}},
+                                        Document{{"x", 2}, {"y", 20}}},
+                                       getExpCtx());
+
+    ASSERT_EQUALS(results.size(), 2UL);
+    ASSERT_DOCUMENT_EQ(results[0], Document(fromjson("{_id : {min : 1, max : 3}, sum : 30}")));
+    ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 3, max : 4}, sum : 30}")));
+}
 }  // namespace
 }  // namespace mongo
@@ -214,6 +214,33 @@ std::string DocumentSourceChangeStream::getCmdNsRegexForChangeStream(
     }
 }
 
+BSONObj DocumentSourceChangeStream::getNsMatchForChangeStream(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, StringData fieldName) {
+    if (getChangeStreamType(expCtx->ns) == ChangeStreamType::kSingleCollection) {
+        // Match the target namespace exactly.
+        return BSON(fieldName << expCtx->ns.ns());
+    }
+    return BSON(fieldName << BSONRegEx(getNsRegexForChangeStream(expCtx)));
+}
+
+BSONObj DocumentSourceChangeStream::getCollMatchForChangeStream(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, StringData fieldName) {
+    if (getChangeStreamType(expCtx->ns) == ChangeStreamType::kSingleCollection) {
+        // Match the target collection exactly.
+        return BSON(fieldName << expCtx->ns.coll());
+    }
+    return BSON(fieldName << BSONRegEx(getCollRegexForChangeStream(expCtx)));
+}
+
+BSONObj DocumentSourceChangeStream::getCmdNsMatchForChangeStream(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, StringData fieldName) {
+    if (getChangeStreamType(expCtx->ns) != ChangeStreamType::kAllChangesForCluster) {
+        // Match the target database command namespace exactly.
+        return BSON(fieldName << expCtx->ns.getCommandNS().ns());
+    }
+    return BSON(fieldName << BSONRegEx(getCmdNsRegexForChangeStream(expCtx)));
+}
+
 std::string DocumentSourceChangeStream::regexEscapeNsForChangeStream(StringData source) {
     std::string result = "";
     std::string escapes = "*+|()^?[]./\\$";
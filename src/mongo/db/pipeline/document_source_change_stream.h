@@ -269,6 +269,20 @@ public:
     static std::string getViewNsRegexForChangeStream(
         const boost::intrusive_ptr<ExpressionContext>& expCtx);
 
+    /**
+     * Build a single-field predicate on 'fieldName' that matches the namespaces (or collections,
+     * or command namespaces) relevant to this change stream. Where the stream targets a single
+     * namespace the predicate is an exact string equality, which is considerably cheaper to
+     * evaluate against every oplog entry than the equivalent anchored regex; otherwise these
+     * helpers fall back to the regexes above.
+     */
+    static BSONObj getNsMatchForChangeStream(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                             StringData fieldName);
+    static BSONObj getCollMatchForChangeStream(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx, StringData fieldName);
+    static BSONObj getCmdNsMatchForChangeStream(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx, StringData fieldName);
+
     /**
      * Parses a $changeStream stage from 'elem' and produces the $match and transformation
      * stages required.
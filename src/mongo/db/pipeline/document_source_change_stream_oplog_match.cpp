@@ -32,6 +32,8 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/db/pipeline/change_stream_filter_helpers.h"
 #include "mongo/db/pipeline/document_source_change_stream_unwind_transaction.h"
+#include "mongo/db/pipeline/process_interface/mongo_process_interface.h"
+#include "mongo/db/pipeline/resume_token.h"
 
 namespace mongo {
 
@@ -105,7 +107,21 @@ boost::intrusive_ptr<DocumentSourceChangeStreamOplogMatch>
 DocumentSourceChangeStreamOplogMatch::create(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                              const DocumentSourceChangeStreamSpec& spec) {
     auto resumeToken = DocumentSourceChangeStream::resolveResumeTokenFromSpec(spec);
-    return make_intrusive<DocumentSourceChangeStreamOplogMatch>(resumeToken.clusterTime, expCtx);
+    auto startFrom = resumeToken.clusterTime;
+
+    // A high water mark token carries no event that must be re-surfaced, so a single-collection
+    // stream may begin its oplog scan past any region that provably contains no entries relevant
+    // to the watched collection. This turns resuming a quiet collection's stream on a large oplog
+    // from a scan of the entire tail into a seek. The skip point is conservative; see
+    // MongoProcessInterface::getOplogResumeSkipPoint().
+    if (ResumeToken::isHighWaterMarkToken(resumeToken) && expCtx->uuid && !expCtx->inMongos) {
+        if (auto skipTo = expCtx->mongoProcessInterface->getOplogResumeSkipPoint(
+                expCtx->opCtx, *expCtx->uuid, startFrom)) {
+            startFrom = *skipTo;
+        }
+    }
+
+    return make_intrusive<DocumentSourceChangeStreamOplogMatch>(startFrom, expCtx);
 }
 
 boost::intrusive_ptr<DocumentSource> DocumentSourceChangeStreamOplogMatch::createFromBson(
@@ -33,6 +33,8 @@
 
 #include "mongo/db/pipeline/document_source_cursor.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/working_set_common.h"
@@ -128,6 +130,15 @@ void DocumentSourceCursor::loadBatch() {
         return;
     }
 
+    if (_loadedInitialBatch) {
+        // The pipeline fully consumed the previous batch and has come back for more, so buffering
+        // a bigger batch this time is worthwhile.
+        _batchSizeBytes = std::min<long long>(
+            _batchSizeBytes * 2, internalDocumentSourceCursorBatchSizeBytes.load());
+    } else {
+        _loadedInitialBatch = true;
+    }
+
     while (MONGO_unlikely(hangBeforeDocumentSourceCursorLoadBatch.shouldFail())) {
         LOGV2(20895,
               "Hanging aggregation due to 'hangBeforeDocumentSourceCursorLoadBatch' failpoint");
@@ -160,8 +171,7 @@ void DocumentSourceCursor::loadBatch() {
             // As long as we're waiting for inserts, we shouldn't do any batching at this level we
             // need the whole pipeline to see each document to see if we should stop waiting.
             if (awaitDataState(pExpCtx->opCtx).shouldWaitForInserts ||
-                static_cast<long long>(_currentBatch.memUsageBytes()) >
-                    internalDocumentSourceCursorBatchSizeBytes.load()) {
+                static_cast<long long>(_currentBatch.memUsageBytes()) > _batchSizeBytes) {
                 // End this batch and prepare PlanExecutor for yielding.
                 _exec->saveState();
                 return;
@@ -308,6 +318,9 @@ DocumentSourceCursor::DocumentSourceCursor(
     bool trackOplogTimestamp)
     : DocumentSource(kStageName, pCtx),
       _currentBatch(cursorType),
+      _batchSizeBytes(std::min<long long>(
+          internalDocumentSourceCursorInitialBatchSizeBytes.load(),
+          internalDocumentSourceCursorBatchSizeBytes.load())),
       _exec(std::move(exec)),
       _trackOplogTS(trackOplogTimestamp) {
     // It is illegal for both 'kEmptyDocuments' and 'trackOplogTimestamp' to be set.
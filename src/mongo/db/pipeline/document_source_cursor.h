@@ -240,6 +240,18 @@ private:
     // Batches results returned from the underlying PlanExecutor.
     Batch _currentBatch;
 
+    // Current cap, in bytes, on the amount of data buffered by one loadBatch() call. Starts at
+    // internalDocumentSourceCursorInitialBatchSizeBytes and doubles each time the pipeline fully
+    // consumes a batch and comes back for more, up to
+    // internalDocumentSourceCursorBatchSizeBytes. Pipelines that stop early (e.g. under a small
+    // $limit) never grow past the initial size, bounding wasted fetch work, while pipelines that
+    // drain the cursor quickly reach the maximum, amortizing executor restore/save and lock
+    // reacquisition over large batches.
+    long long _batchSizeBytes;
+
+    // Whether loadBatch() has been called at least once.
+    bool _loadedInitialBatch = false;
+
     // The underlying query plan which feeds this pipeline. Must be destroyed while holding the
     // collection lock.
     std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> _exec;
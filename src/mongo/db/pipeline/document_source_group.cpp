@@ -29,6 +29,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/exec/document_value/document.h"
@@ -40,6 +41,7 @@
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/query/operation_memory_usage_tracker.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/util/destructor_guard.h"
 
@@ -115,9 +117,9 @@ DocumentSource::GetModPathsReturn GroupFromFirstDocumentTransformation::getModif
 
 std::unique_ptr<GroupFromFirstDocumentTransformation> GroupFromFirstDocumentTransformation::create(
     const intrusive_ptr<ExpressionContext>& expCtx,
-    const std::string& groupId,
+    std::vector<std::string> groupIdFields,
     vector<pair<std::string, intrusive_ptr<Expression>>> accumulatorExprs) {
-    return std::make_unique<GroupFromFirstDocumentTransformation>(groupId,
+    return std::make_unique<GroupFromFirstDocumentTransformation>(std::move(groupIdFields),
                                                                   std::move(accumulatorExprs));
 }
 
@@ -133,6 +135,9 @@ const char* DocumentSourceGroup::getSourceName() const {
 }
 
 bool DocumentSourceGroup::shouldSpillWithAttemptToSaveMemory() {
+    OperationMemoryUsageTracker::get(pExpCtx->opCtx)
+        .set(this, _memoryTracker.currentMemoryBytes());
+
     if (!_memoryTracker._allowDiskUse &&
         (_memoryTracker.currentMemoryBytes() >
          static_cast<long long>(_memoryTracker._maxAllowedMemoryUsageBytes))) {
@@ -239,6 +244,12 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
 
     Document out = makeDocument(groupsIterator->first, groupsIterator->second, pExpCtx->needsMerge);
 
+    // This group will never be visited again, so release its accumulators now rather than in
+    // doDispose(). Otherwise the state pinned by memory-hungry accumulators such as $push and
+    // $addToSet for every already-returned group would stay resident until the last group is
+    // returned.
+    groupsIterator->second.clear();
+
     if (++groupsIterator == _groups->end())
         dispose();
 
@@ -575,7 +586,6 @@ MONGO_COMPILER_NOINLINE DocumentSource::GetNextResult DocumentSourceGroup::initi
         vector<intrusive_ptr<AccumulatorState>>& group = (*_groups)[id];
         const bool inserted = _groups->size() != oldSize;
 
-        vector<uint64_t> oldAccumMemUsage(numAccumulators, 0);
         if (inserted) {
             _memoryTracker.set(_memoryTracker.currentMemoryBytes() + id.getApproximateSize());
 
@@ -838,29 +848,42 @@ bool DocumentSourceGroup::canRunInParallelBeforeWriteStage(
 
 std::unique_ptr<GroupFromFirstDocumentTransformation>
 DocumentSourceGroup::rewriteGroupAsTransformOnFirstDocument() const {
-    if (_idExpressions.size() != 1) {
-        // This transformation is only intended for $group stages that group on a single field.
+    if (_idExpressions.empty()) {
+        // An empty object group key (e.g. {_id: {}}) places every document in one group; there is
+        // no field to distinct over.
         return nullptr;
     }
 
-    auto fieldPathExpr = dynamic_cast<ExpressionFieldPath*>(_idExpressions.front().get());
-    if (!fieldPathExpr || fieldPathExpr->isVariableReference()) {
-        return nullptr;
-    }
+    // This transformation is only intended for $group stages where every part of the group key is
+    // a field path, so that a DISTINCT_SCAN over an index on those fields can produce exactly one
+    // document per group.
+    std::vector<std::string> groupIdFields;
+    groupIdFields.reserve(_idExpressions.size());
+    for (auto&& idExpression : _idExpressions) {
+        auto fieldPathExpr = dynamic_cast<ExpressionFieldPath*>(idExpression.get());
+        if (!fieldPathExpr || fieldPathExpr->isVariableReference()) {
+            return nullptr;
+        }
 
-    const auto fieldPath = fieldPathExpr->getFieldPath();
-    if (fieldPath.getPathLength() == 1) {
-        // The path is $$CURRENT or $$ROOT. This isn't really a sensible value to group by (since
-        // each document has a unique _id, it will just return the entire collection). We only
-        // apply the rewrite when grouping by a single field, so we cannot apply it in this case,
-        // where we are grouping by the entire document.
-        tassert(5943200,
-                "Optimization attempted on group by always-dissimilar system variable",
-                fieldPath.getFieldName(0) == "CURRENT" || fieldPath.getFieldName(0) == "ROOT");
-        return nullptr;
-    }
+        const auto fieldPath = fieldPathExpr->getFieldPath();
+        if (fieldPath.getPathLength() == 1) {
+            // The path is $$CURRENT or $$ROOT. This isn't really a sensible value to group by
+            // (since each document has a unique _id, it will just return the entire collection),
+            // and it cannot be answered by a distinct scan over an index, so we cannot apply the
+            // rewrite.
+            tassert(5943200,
+                    "Optimization attempted on group by always-dissimilar system variable",
+                    fieldPath.getFieldName(0) == "CURRENT" || fieldPath.getFieldName(0) == "ROOT");
+            return nullptr;
+        }
 
-    const auto groupId = fieldPath.tail().fullPath();
+        // The same field may be referenced by more than one part of the group key; it only needs
+        // to appear in the index once.
+        auto path = fieldPath.tail().fullPath();
+        if (std::find(groupIdFields.begin(), groupIdFields.end(), path) == groupIdFields.end()) {
+            groupIdFields.push_back(std::move(path));
+        }
+    }
 
     // We can't do this transformation if there are any non-$first accumulators.
     for (auto&& accumulator : _accumulatedFields) {
@@ -873,14 +896,19 @@ DocumentSourceGroup::rewriteGroupAsTransformOnFirstDocument() const {
     std::vector<std::pair<std::string, boost::intrusive_ptr<Expression>>> fields;
 
     boost::intrusive_ptr<Expression> idField;
-    // The _id field can be specified either as a fieldpath (ex. _id: "$a") or as a singleton
-    // object (ex. _id: {v: "$a"}).
+    // The _id field can be specified either as a fieldpath (ex. _id: "$a") or as an object
+    // (ex. _id: {v: "$a", w: "$b"}).
     if (_idFieldNames.empty()) {
-        idField = ExpressionFieldPath::deprecatedCreate(pExpCtx.get(), groupId);
+        invariant(_idExpressions.size() == 1);
+        idField = ExpressionFieldPath::deprecatedCreate(pExpCtx.get(), groupIdFields.front());
     } else {
-        invariant(_idFieldNames.size() == 1);
-        idField = ExpressionObject::create(pExpCtx.get(),
-                                           {{_idFieldNames.front(), _idExpressions.front()}});
+        invariant(_idFieldNames.size() == _idExpressions.size());
+        std::vector<std::pair<std::string, boost::intrusive_ptr<Expression>>> idChildren;
+        idChildren.reserve(_idFieldNames.size());
+        for (size_t i = 0; i < _idFieldNames.size(); ++i) {
+            idChildren.emplace_back(_idFieldNames[i], _idExpressions[i]);
+        }
+        idField = ExpressionObject::create(pExpCtx.get(), std::move(idChildren));
     }
     fields.push_back(std::make_pair("_id", idField));
 
@@ -891,7 +919,8 @@ DocumentSourceGroup::rewriteGroupAsTransformOnFirstDocument() const {
         // the initializer should always be trivial.
     }
 
-    return GroupFromFirstDocumentTransformation::create(pExpCtx, groupId, std::move(fields));
+    return GroupFromFirstDocumentTransformation::create(
+        pExpCtx, std::move(groupIdFields), std::move(fields));
 }
 
 size_t DocumentSourceGroup::getMaxMemoryUsageBytes() const {
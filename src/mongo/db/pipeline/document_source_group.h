@@ -50,20 +50,21 @@ namespace mongo {
 class GroupFromFirstDocumentTransformation final : public TransformerInterface {
 public:
     GroupFromFirstDocumentTransformation(
-        const std::string& groupId,
+        std::vector<std::string> groupIdFields,
         std::vector<std::pair<std::string, boost::intrusive_ptr<Expression>>> accumulatorExprs)
-        : _accumulatorExprs(std::move(accumulatorExprs)), _groupId(groupId) {}
+        : _accumulatorExprs(std::move(accumulatorExprs)), _groupIdFields(std::move(groupIdFields)) {}
 
     TransformerType getType() const final {
         return TransformerType::kGroupFromFirstDocument;
     }
 
     /**
-     * The path of the field that we are grouping on: i.e., the field in the input document that we
-     * will use to create the _id field of the ouptut document.
+     * The paths of the fields that we are grouping on: i.e., the fields in the input document that
+     * we will use to create the _id field of the output document. There is one path per distinct
+     * field referenced by the group key, in the order they appear in the _id expression.
      */
-    const std::string& groupId() const {
-        return _groupId;
+    const std::vector<std::string>& groupIdFields() const {
+        return _groupIdFields;
     }
 
     Document applyTransformation(const Document& input) final;
@@ -79,12 +80,12 @@ public:
 
     static std::unique_ptr<GroupFromFirstDocumentTransformation> create(
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
-        const std::string& groupId,
+        std::vector<std::string> groupIdFields,
         std::vector<std::pair<std::string, boost::intrusive_ptr<Expression>>> accumulatorExprs);
 
 private:
     std::vector<std::pair<std::string, boost::intrusive_ptr<Expression>>> _accumulatorExprs;
-    std::string _groupId;
+    std::vector<std::string> _groupIdFields;
 };
 
 class DocumentSourceGroup final : public DocumentSource {
@@ -181,8 +182,9 @@ public:
 
     /**
      * When possible, creates a document transformer that transforms the first document in a group
-     * into one of the output documents of the $group stage. This is possible when we are grouping
-     * on a single field and all accumulators are $first (or there are no accumluators).
+     * into one of the output documents of the $group stage. This is possible when every part of
+     * the group key is a field path and all accumulators are $first (or there are no
+     * accumluators).
      *
      * It is sometimes possible to use a DISTINCT_SCAN to scan the first document of each group,
      * in which case this transformation can replace the actual $group stage in the pipeline
@@ -234,6 +234,41 @@ TEST_F(DocumentSourceGroupTest, ShouldReportMultipleFieldGroupKeysAsARename) {
     ASSERT_EQ(modifiedPathsRet.renames["_id.y"], "y");
 }
 
+TEST_F(DocumentSourceGroupTest, ShouldRewriteSingleFieldGroupAsTransformOnFirstDocument) {
+    auto expCtx = getExpCtx();
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto groupByExpression = ExpressionFieldPath::parse(expCtx.get(), "$x", vps);
+    auto group = DocumentSourceGroup::create(expCtx, groupByExpression, {});
+    auto rewrite = group->rewriteGroupAsTransformOnFirstDocument();
+    ASSERT(rewrite);
+    ASSERT_EQ(rewrite->groupIdFields().size(), 1UL);
+    ASSERT_EQ(rewrite->groupIdFields()[0], "x");
+}
+
+TEST_F(DocumentSourceGroupTest, ShouldRewriteCompoundFieldPathGroupAsTransformOnFirstDocument) {
+    auto expCtx = getExpCtx();
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto x = ExpressionFieldPath::parse(expCtx.get(), "$x", vps);
+    auto y = ExpressionFieldPath::parse(expCtx.get(), "$y.z", vps);
+    auto groupByExpression = ExpressionObject::create(expCtx.get(), {{"x", x}, {"y", y}});
+    auto group = DocumentSourceGroup::create(expCtx, groupByExpression, {});
+    auto rewrite = group->rewriteGroupAsTransformOnFirstDocument();
+    ASSERT(rewrite);
+    ASSERT_EQ(rewrite->groupIdFields().size(), 2UL);
+    ASSERT_EQ(rewrite->groupIdFields()[0], "x");
+    ASSERT_EQ(rewrite->groupIdFields()[1], "y.z");
+}
+
+TEST_F(DocumentSourceGroupTest, ShouldNotRewriteGroupWithNonFieldPathKeyAsTransform) {
+    auto expCtx = getExpCtx();
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto x = ExpressionFieldPath::parse(expCtx.get(), "$x", vps);
+    auto constant = ExpressionConstant::create(expCtx.get(), Value(1));
+    auto groupByExpression = ExpressionObject::create(expCtx.get(), {{"x", x}, {"c", constant}});
+    auto group = DocumentSourceGroup::create(expCtx, groupByExpression, {});
+    ASSERT_FALSE(group->rewriteGroupAsTransformOnFirstDocument());
+}
+
 TEST_F(DocumentSourceGroupTest, ShouldNotReportDottedGroupKeyAsARename) {
     auto expCtx = getExpCtx();
     VariablesParseState vps = expCtx->variablesParseState;
@@ -0,0 +1,222 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
+
+#include "mongo/db/pipeline/document_path_support.h"
+
+namespace mongo {
+
+boost::intrusive_ptr<DocumentSourceInternalFusedTransformation>
+DocumentSourceInternalFusedTransformation::create(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, Pipeline::SourceContainer stages) {
+    return new DocumentSourceInternalFusedTransformation(expCtx, std::move(stages));
+}
+
+DocumentSourceInternalFusedTransformation::DocumentSourceInternalFusedTransformation(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, Pipeline::SourceContainer stages)
+    : DocumentSource(kStageName, expCtx), _stages(std::move(stages)) {
+    invariant(_stages.size() >= 2);
+    _steps.reserve(_stages.size());
+    for (auto&& stage : _stages) {
+        // The components are no longer part of a stitched pipeline; clear any stale source
+        // pointer so a dispose() of a component cannot propagate through it.
+        stage->setSource(nullptr);
+
+        Step step;
+        if ((step.transform =
+                 dynamic_cast<DocumentSourceSingleDocumentTransformation*>(stage.get()))) {
+            _steps.push_back(std::move(step));
+            continue;
+        }
+        step.match = dynamic_cast<DocumentSourceMatch*>(stage.get());
+        invariant(step.match);
+        invariant(!step.match->isTextQuery());
+        step.matchDeps = DepsTracker(DepsTracker::kAllMetadata);
+        step.match->getDependencies(&step.matchDeps);
+        _steps.push_back(std::move(step));
+    }
+}
+
+bool DocumentSourceInternalFusedTransformation::isFusible(
+    const boost::intrusive_ptr<DocumentSource>& stage) {
+    if (dynamic_cast<DocumentSourceSingleDocumentTransformation*>(stage.get())) {
+        return true;
+    }
+    auto match = dynamic_cast<DocumentSourceMatch*>(stage.get());
+    // Subclasses of DocumentSourceMatch (such as the internal change stream matches) carry their
+    // own serialization and optimization behavior and are left alone; the stage name check
+    // excludes them. Text queries must remain standalone stages.
+    return match && !match->isTextQuery() &&
+        StringData(match->getSourceName()) == DocumentSourceMatch::kStageName;
+}
+
+void DocumentSourceInternalFusedTransformation::fuseEligibleStages(
+    Pipeline::SourceContainer* container) {
+    // The leading stage is never fused, so a run needs at least three stages to be present.
+    if (container->size() < 3) {
+        return;
+    }
+
+    auto itr = std::next(container->begin());
+    while (itr != container->end()) {
+        if (!isFusible(*itr)) {
+            ++itr;
+            continue;
+        }
+        auto runStart = itr;
+        size_t runLength = 0;
+        while (itr != container->end() && isFusible(*itr)) {
+            ++itr;
+            ++runLength;
+        }
+        if (runLength < 2) {
+            continue;
+        }
+        auto expCtx = (*runStart)->getContext();
+        Pipeline::SourceContainer components(runStart, itr);
+        auto insertPos = container->erase(runStart, itr);
+        itr = std::next(
+            container->insert(insertPos, create(expCtx, std::move(components))), 1);
+    }
+}
+
+DocumentSource::GetNextResult DocumentSourceInternalFusedTransformation::doGetNext() {
+    auto nextInput = pSource->getNext();
+    for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
+        Document doc = nextInput.releaseDocument();
+        bool filtered = false;
+        for (auto&& step : _steps) {
+            if (step.transform) {
+                doc = step.transform->getTransformer().applyTransformation(doc);
+                continue;
+            }
+            // Mirrors DocumentSourceMatch::doGetNext(): serialize only the paths the match
+            // expression depends on.
+            BSONObj toMatch = step.matchDeps.needWholeDocument
+                ? doc.toBson()
+                : document_path_support::documentToBsonWithPaths(doc, step.matchDeps.fields);
+            if (!step.match->getMatchExpression()->matchesBSON(toMatch)) {
+                filtered = true;
+                break;
+            }
+        }
+        if (!filtered) {
+            return std::move(doc);
+        }
+    }
+    return nextInput;
+}
+
+StageConstraints DocumentSourceInternalFusedTransformation::constraints(
+    Pipeline::SplitState pipeState) const {
+    StageConstraints fusedConstraints(StreamType::kStreaming,
+                                      PositionRequirement::kNone,
+                                      HostTypeRequirement::kNone,
+                                      DiskUseRequirement::kNoDiskUse,
+                                      FacetRequirement::kAllowed,
+                                      TransactionRequirement::kAllowed,
+                                      LookupRequirement::kAllowed,
+                                      UnionRequirement::kAllowed);
+    fusedConstraints = StageConstraints::getStrictestConstraints(_stages, fusedConstraints);
+    // Fusion runs after all stage reordering; nothing may swap past the fused boundary.
+    fusedConstraints.canSwapWithMatch = false;
+    fusedConstraints.canSwapWithSkippingOrLimitingStage = false;
+    return fusedConstraints;
+}
+
+DepsTracker::State DocumentSourceInternalFusedTransformation::getDependenciesForComponents(
+    const Pipeline::SourceContainer& stages, DepsTracker* deps) {
+    // Mirrors Pipeline::getDependenciesForContainer() over the components, reporting them to the
+    // caller as a single unit.
+    bool knowAllFields = false;
+    bool knowAllMeta = false;
+    for (auto&& stage : stages) {
+        DepsTracker localDeps(deps->getUnavailableMetadata());
+        DepsTracker::State status = stage->getDependencies(&localDeps);
+
+        deps->vars.insert(localDeps.vars.begin(), localDeps.vars.end());
+        deps->needRandomGenerator |= localDeps.needRandomGenerator;
+
+        if (status == DepsTracker::State::NOT_SUPPORTED) {
+            return DepsTracker::State::NOT_SUPPORTED;
+        }
+        if (!knowAllFields) {
+            deps->fields.insert(localDeps.fields.begin(), localDeps.fields.end());
+            if (localDeps.needWholeDocument) {
+                deps->needWholeDocument = true;
+            }
+            knowAllFields = status & DepsTracker::State::EXHAUSTIVE_FIELDS;
+        }
+        if (!knowAllMeta) {
+            deps->requestMetadata(localDeps.metadataDeps());
+            knowAllMeta = status & DepsTracker::State::EXHAUSTIVE_META;
+        }
+    }
+    if (knowAllFields && knowAllMeta) {
+        return DepsTracker::State::EXHAUSTIVE_ALL;
+    }
+    if (knowAllFields) {
+        return DepsTracker::State::EXHAUSTIVE_FIELDS;
+    }
+    if (knowAllMeta) {
+        return DepsTracker::State::EXHAUSTIVE_META;
+    }
+    return DepsTracker::State::SEE_NEXT;
+}
+
+DepsTracker::State DocumentSourceInternalFusedTransformation::getDependencies(
+    DepsTracker* deps) const {
+    return getDependenciesForComponents(_stages, deps);
+}
+
+void DocumentSourceInternalFusedTransformation::serializeToArray(
+    std::vector<Value>& array, boost::optional<ExplainOptions::Verbosity> explain) const {
+    for (auto&& stage : _stages) {
+        stage->serializeToArray(array, explain);
+    }
+}
+
+boost::intrusive_ptr<DocumentSource> DocumentSourceInternalFusedTransformation::clone() const {
+    Pipeline::SourceContainer clonedStages;
+    for (auto&& stage : _stages) {
+        clonedStages.push_back(stage->clone());
+    }
+    return create(pExpCtx, std::move(clonedStages));
+}
+
+void DocumentSourceInternalFusedTransformation::doDispose() {
+    for (auto&& stage : _stages) {
+        stage->dispose();
+    }
+}
+
+}  // namespace mongo
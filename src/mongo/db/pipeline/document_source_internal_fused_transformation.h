@@ -0,0 +1,141 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_match.h"
+#include "mongo/db/pipeline/document_source_single_document_transformation.h"
+
+namespace mongo {
+
+/**
+ * An execution-only stage which applies a run of consecutive streaming per-document stages
+ * ($addFields/$project/$set/$unset/$replaceRoot and non-text $match) to each input document in a
+ * single pass, instead of pumping every document through one getNext() virtual dispatch per stage.
+ *
+ * The stage is created by the fusion pass in Pipeline::optimizeContainer() when the
+ * internalQueryEnablePipelineStageFusion knob is set; it cannot be parsed from BSON. It serializes
+ * as the stages it was fused from, so explain output, pipeline splitting for sharded execution and
+ * re-parsing on another node all see the original logical stages.
+ */
+class DocumentSourceInternalFusedTransformation final : public DocumentSource {
+public:
+    static constexpr StringData kStageName = "$_internalFusedTransformation"_sd;
+
+    /**
+     * Creates a fused stage from 'stages', each of which must be a
+     * DocumentSourceSingleDocumentTransformation or a non-text exact DocumentSourceMatch. Takes
+     * over ownership of the components; they must no longer be part of any pipeline.
+     */
+    static boost::intrusive_ptr<DocumentSourceInternalFusedTransformation> create(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx, Pipeline::SourceContainer stages);
+
+    /**
+     * Replaces every maximal run of at least two fusible stages in 'container' with a fused
+     * stage. The leading stage of the container is never fused, so pushdowns of a leading $match
+     * or projection into the query layer still apply.
+     */
+    static void fuseEligibleStages(Pipeline::SourceContainer* container);
+
+    /**
+     * Whether 'stage' may participate in a fused run.
+     */
+    static bool isFusible(const boost::intrusive_ptr<DocumentSource>& stage);
+
+    /**
+     * Reports the combined dependencies of 'stages' into 'deps', mirroring the merging logic of
+     * Pipeline::getDependenciesForContainer(). Shared with the parallel transform stage, which
+     * wraps the same kinds of components.
+     */
+    static DepsTracker::State getDependenciesForComponents(const Pipeline::SourceContainer& stages,
+                                                           DepsTracker* deps);
+
+    const char* getSourceName() const final {
+        return kStageName.rawData();
+    }
+
+    StageConstraints constraints(Pipeline::SplitState pipeState) const final;
+
+    boost::optional<DistributedPlanLogic> distributedPlanLogic() final {
+        // None of the fusible stages imposes a split requirement.
+        return boost::none;
+    }
+
+    DepsTracker::State getDependencies(DepsTracker* deps) const final;
+
+    GetModPathsReturn getModifiedPaths() const final {
+        // Later optimizations must not reason across the fused boundary, so conservatively report
+        // that all paths may be modified.
+        return {GetModPathsReturn::Type::kAllPaths, {}, {}};
+    }
+
+    void serializeToArray(
+        std::vector<Value>& array,
+        boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+    boost::intrusive_ptr<DocumentSource> clone() const final;
+
+    const Pipeline::SourceContainer& getFusedStages() const {
+        return _stages;
+    }
+
+protected:
+    GetNextResult doGetNext() final;
+
+    void doDispose() final;
+
+private:
+    DocumentSourceInternalFusedTransformation(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx, Pipeline::SourceContainer stages);
+
+    Value serialize(
+        boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final {
+        // This stage must serialize as its components; see serializeToArray().
+        MONGO_UNREACHABLE;
+    }
+
+    // One entry per fused stage, in pipeline order. Exactly one of the two pointers is set; they
+    // point into '_stages', which owns the components.
+    struct Step {
+        DocumentSourceSingleDocumentTransformation* transform = nullptr;
+        DocumentSourceMatch* match = nullptr;
+
+        // For a match step, the fields the match expression depends on, so only those need to be
+        // serialized to BSON for evaluation.
+        DepsTracker matchDeps;
+    };
+
+    Pipeline::SourceContainer _stages;
+    std::vector<Step> _steps;
+};
+
+}  // namespace mongo
@@ -0,0 +1,135 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <vector>
+
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/document_source_add_fields.h"
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
+#include "mongo/db/pipeline/document_source_match.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+using InternalFusedTransformationTest = AggregationContextFixture;
+
+TEST_F(InternalFusedTransformationTest, FusesRunsOfTransformAndMatchStages) {
+    Pipeline::SourceContainer container;
+    container.push_back(DocumentSourceAddFields::create(BSON("a" << 1), getExpCtx()));
+    container.push_back(DocumentSourceAddFields::create(BSON("b" << 2), getExpCtx()));
+    container.push_back(DocumentSourceMatch::create(BSON("a" << 1), getExpCtx()));
+
+    DocumentSourceInternalFusedTransformation::fuseEligibleStages(&container);
+
+    // The leading stage must be left alone; the trailing two stages form a fused run.
+    ASSERT_EQ(container.size(), 2U);
+    auto itr = container.begin();
+    ASSERT_EQ(std::string((*itr)->getSourceName()), DocumentSourceAddFields::kStageName);
+    ++itr;
+    auto fused = dynamic_cast<DocumentSourceInternalFusedTransformation*>(itr->get());
+    ASSERT(fused);
+    ASSERT_EQ(fused->getFusedStages().size(), 2U);
+}
+
+TEST_F(InternalFusedTransformationTest, DoesNotFuseLeadingStageOrSingletonRuns) {
+    Pipeline::SourceContainer container;
+    container.push_back(DocumentSourceAddFields::create(BSON("a" << 1), getExpCtx()));
+    container.push_back(DocumentSourceMatch::create(BSON("a" << 1), getExpCtx()));
+
+    DocumentSourceInternalFusedTransformation::fuseEligibleStages(&container);
+
+    // A run of one non-leading fusible stage is not worth fusing.
+    ASSERT_EQ(container.size(), 2U);
+    for (auto&& stage : container) {
+        ASSERT_FALSE(dynamic_cast<DocumentSourceInternalFusedTransformation*>(stage.get()));
+    }
+}
+
+TEST_F(InternalFusedTransformationTest, AppliesComponentsInOrderAndFiltersNonMatching) {
+    Pipeline::SourceContainer components;
+    components.push_back(DocumentSourceAddFields::create(BSON("b" << 5), getExpCtx()));
+    components.push_back(DocumentSourceMatch::create(BSON("a" << BSON("$gt" << 1)), getExpCtx()));
+    auto fused =
+        DocumentSourceInternalFusedTransformation::create(getExpCtx(), std::move(components));
+
+    auto mock = DocumentSourceMock::createForTest(
+        {Document{{"a", 1}}, Document{{"a", 2}}, Document{{"a", 3}}}, getExpCtx());
+    fused->setSource(mock.get());
+
+    auto next = fused->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(), (Document{{"a", 2}, {"b", 5}}));
+
+    next = fused->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(), (Document{{"a", 3}, {"b", 5}}));
+
+    ASSERT_TRUE(fused->getNext().isEOF());
+}
+
+TEST_F(InternalFusedTransformationTest, MatchSeesFieldsAddedByEarlierComponent) {
+    Pipeline::SourceContainer components;
+    components.push_back(DocumentSourceAddFields::create(BSON("b" << 5), getExpCtx()));
+    components.push_back(DocumentSourceMatch::create(BSON("b" << 5), getExpCtx()));
+    auto fused =
+        DocumentSourceInternalFusedTransformation::create(getExpCtx(), std::move(components));
+
+    auto mock = DocumentSourceMock::createForTest(Document{{"a", 1}}, getExpCtx());
+    fused->setSource(mock.get());
+
+    auto next = fused->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(), (Document{{"a", 1}, {"b", 5}}));
+    ASSERT_TRUE(fused->getNext().isEOF());
+}
+
+TEST_F(InternalFusedTransformationTest, SerializesAsItsComponents) {
+    Pipeline::SourceContainer components;
+    components.push_back(
+        DocumentSourceAddFields::create(BSON("a" << BSON("$const" << 1)), getExpCtx()));
+    components.push_back(DocumentSourceMatch::create(BSON("a" << 1), getExpCtx()));
+    auto fused =
+        DocumentSourceInternalFusedTransformation::create(getExpCtx(), std::move(components));
+
+    std::vector<Value> serialized;
+    fused->serializeToArray(serialized);
+    ASSERT_EQ(serialized.size(), 2U);
+    ASSERT_BSONOBJ_EQ(serialized[0].getDocument().toBson(),
+                      BSON("$addFields" << BSON("a" << BSON("$const" << 1))));
+    ASSERT_BSONOBJ_EQ(serialized[1].getDocument().toBson(), BSON("$match" << BSON("a" << 1)));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,339 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_internal_parallel_transform.h"
+
+#include "mongo/db/client.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+
+namespace {
+
+// Bounds on dispatched-but-uncollected documents; dispatching stops when either is reached until
+// results are collected. The byte bound matches the Exchange buffer cap.
+constexpr size_t kMaxQueuedPerWorker = 16;
+constexpr size_t kMaxInflightBytes = 100 * 1024 * 1024;  // 100 MB
+
+}  // namespace
+
+boost::intrusive_ptr<DocumentSourceInternalParallelTransform>
+DocumentSourceInternalParallelTransform::create(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    Pipeline::SourceContainer stages,
+    size_t numWorkers) {
+    return new DocumentSourceInternalParallelTransform(expCtx, std::move(stages), numWorkers);
+}
+
+DocumentSourceInternalParallelTransform::DocumentSourceInternalParallelTransform(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    Pipeline::SourceContainer stages,
+    size_t numWorkers)
+    : DocumentSource(kStageName, expCtx), _stages(std::move(stages)), _numWorkers(numWorkers) {
+    invariant(!_stages.empty());
+    invariant(_numWorkers >= 2);
+    std::vector<Value> serialized;
+    for (auto&& stage : _stages) {
+        invariant(DocumentSourceInternalFusedTransformation::isFusible(stage));
+        // The components are no longer part of a stitched pipeline; clear any stale source
+        // pointer so a dispose() of a component cannot propagate through it.
+        stage->setSource(nullptr);
+        stage->serializeToArray(serialized);
+    }
+    for (auto&& stage : serialized) {
+        _rawStages.push_back(stage.getDocument().toBson());
+    }
+}
+
+DocumentSourceInternalParallelTransform::~DocumentSourceInternalParallelTransform() {
+    _shutdownWorkers();
+}
+
+void DocumentSourceInternalParallelTransform::parallelizeEligibleStages(
+    Pipeline::SourceContainer* container, size_t numWorkers) {
+    // The leading stage is never parallelized; see the class comment.
+    if (container->size() < 2) {
+        return;
+    }
+    // Stages of a sub-pipeline run once per outer document; spinning up worker threads there
+    // would cost far more than it saves.
+    if (container->front()->getContext()->subPipelineDepth > 0) {
+        return;
+    }
+
+    auto itr = std::next(container->begin());
+    while (itr != container->end()) {
+        if (!DocumentSourceInternalFusedTransformation::isFusible(*itr)) {
+            ++itr;
+            continue;
+        }
+        auto runStart = itr;
+        while (itr != container->end() &&
+               DocumentSourceInternalFusedTransformation::isFusible(*itr)) {
+            ++itr;
+        }
+        auto expCtx = (*runStart)->getContext();
+        Pipeline::SourceContainer components(runStart, itr);
+        auto insertPos = container->erase(runStart, itr);
+        itr = std::next(
+            container->insert(insertPos, create(expCtx, std::move(components), numWorkers)), 1);
+    }
+}
+
+void DocumentSourceInternalParallelTransform::_startWorkers() {
+    invariant(_workers.empty());
+    auto serviceContext = pExpCtx->opCtx->getServiceContext();
+
+    for (size_t i = 0; i < _numWorkers; ++i) {
+        auto worker = std::make_unique<Worker>();
+        auto workerExpCtx = pExpCtx->copyWith(pExpCtx->ns);
+        worker->pipeline = Pipeline::parse(_rawStages, workerExpCtx);
+        auto queue = DocumentSourceQueue::create(workerExpCtx);
+        worker->queueSource = queue.get();
+        worker->pipeline->addInitialSource(std::move(queue));
+        // The worker reattaches the pipeline to its own operation context when it starts.
+        worker->pipeline->detachFromOperationContext();
+        _workers.push_back(std::move(worker));
+    }
+
+    for (auto&& worker : _workers) {
+        worker->thread = stdx::thread([this, worker = worker.get(), serviceContext] {
+            _workerMain(worker, serviceContext);
+        });
+    }
+}
+
+void DocumentSourceInternalParallelTransform::_workerMain(Worker* worker,
+                                                          ServiceContext* serviceContext) try {
+    ThreadClient threadClient("ParallelTransform", serviceContext);
+    auto opCtx = threadClient->makeOperationContext();
+    worker->pipeline->reattachToOperationContext(opCtx.get());
+    ScopeGuard disposeGuard([&] { worker->pipeline->dispose(opCtx.get()); });
+
+    for (;;) {
+        Document doc;
+        {
+            stdx::unique_lock<Latch> lk(worker->mutex);
+            worker->hasInput.wait(lk, [&] {
+                return !worker->input.empty() || worker->inputDone || _shutdown.load() ||
+                    _failed.load();
+            });
+            if (_shutdown.load() || _failed.load()) {
+                return;
+            }
+            if (worker->input.empty()) {
+                return;  // Input is done and fully drained.
+            }
+            doc = std::move(worker->input.front());
+            worker->input.pop_front();
+        }
+
+        // Feed the document through this worker's copy of the component stages. The components
+        // produce at most one result per input (transforms are 1:1, $match is 1:0), so a single
+        // pull either yields the transformed document or EOF when the document was filtered out.
+        worker->queueSource->emplace_back(std::move(doc));
+        auto result = worker->pipeline->getSources().back()->getNext();
+        boost::optional<Document> transformed;
+        if (result.isAdvanced()) {
+            transformed = result.releaseDocument();
+        }
+
+        {
+            stdx::lock_guard<Latch> lk(worker->mutex);
+            worker->output.push_back(std::move(transformed));
+        }
+        worker->hasOutput.notify_one();
+    }
+} catch (const DBException& ex) {
+    _recordError(ex.toStatus());
+}
+
+void DocumentSourceInternalParallelTransform::_dispatch(Document doc) {
+    const size_t approximateBytes = doc.getApproximateSize();
+    auto* worker = _workers[_nextWorker].get();
+    {
+        stdx::lock_guard<Latch> lk(worker->mutex);
+        worker->input.push_back(std::move(doc));
+    }
+    worker->hasInput.notify_one();
+
+    _dispatchOrder.push_back({_nextWorker, approximateBytes});
+    _inflightBytes += approximateBytes;
+    _nextWorker = (_nextWorker + 1) % _workers.size();
+}
+
+void DocumentSourceInternalParallelTransform::_markInputDone() {
+    for (auto&& worker : _workers) {
+        {
+            stdx::lock_guard<Latch> lk(worker->mutex);
+            worker->inputDone = true;
+        }
+        worker->hasInput.notify_one();
+    }
+}
+
+boost::optional<Document> DocumentSourceInternalParallelTransform::_collectNextResult() {
+    invariant(!_dispatchOrder.empty());
+    auto entry = _dispatchOrder.front();
+    _dispatchOrder.pop_front();
+    _inflightBytes -= entry.approximateBytes;
+
+    auto* worker = _workers[entry.workerId].get();
+    stdx::unique_lock<Latch> lk(worker->mutex);
+    worker->hasOutput.wait(lk, [&] { return !worker->output.empty() || _failed.load(); });
+    if (_failed.load()) {
+        lk.unlock();
+        stdx::lock_guard<Latch> errorLock(_errorMutex);
+        uassertStatusOK(_errorStatus);
+    }
+    auto result = std::move(worker->output.front());
+    worker->output.pop_front();
+    return result;
+}
+
+void DocumentSourceInternalParallelTransform::_recordError(Status status) {
+    invariant(!status.isOK());
+    {
+        stdx::lock_guard<Latch> lk(_errorMutex);
+        if (_errorStatus.isOK()) {
+            _errorStatus = std::move(status);
+        }
+    }
+    _failed.store(true);
+    // Wake up the pipeline thread and the other workers so they can observe the failure. Taking
+    // each worker's mutex before notifying guarantees a waiter cannot check the flag and then
+    // block without seeing the notification.
+    for (auto&& worker : _workers) {
+        stdx::lock_guard<Latch> lk(worker->mutex);
+        worker->hasInput.notify_all();
+        worker->hasOutput.notify_all();
+    }
+}
+
+void DocumentSourceInternalParallelTransform::_shutdownWorkers() {
+    _shutdown.store(true);
+    for (auto&& worker : _workers) {
+        stdx::lock_guard<Latch> lk(worker->mutex);
+        worker->hasInput.notify_all();
+    }
+    for (auto&& worker : _workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+DocumentSource::GetNextResult DocumentSourceInternalParallelTransform::doGetNext() {
+    if (_workers.empty()) {
+        _startWorkers();
+    }
+
+    for (;;) {
+        // Keep the workers fed: dispatch until the inflight bounds are hit, the source pauses or
+        // the source is exhausted.
+        while (!_sourceExhausted &&
+               _dispatchOrder.size() < _workers.size() * kMaxQueuedPerWorker &&
+               _inflightBytes < kMaxInflightBytes) {
+            auto nextInput = pSource->getNext();
+            if (nextInput.isPaused()) {
+                if (_dispatchOrder.empty()) {
+                    return nextInput;
+                }
+                break;
+            }
+            if (nextInput.isEOF()) {
+                _sourceExhausted = true;
+                _markInputDone();
+                break;
+            }
+            _dispatch(nextInput.releaseDocument());
+        }
+
+        if (_dispatchOrder.empty()) {
+            return GetNextResult::makeEOF();
+        }
+
+        // Collect results in dispatch order so the input order is preserved; a disengaged result
+        // means the document was filtered out by a $match component.
+        if (auto doc = _collectNextResult()) {
+            return std::move(*doc);
+        }
+    }
+}
+
+StageConstraints DocumentSourceInternalParallelTransform::constraints(
+    Pipeline::SplitState pipeState) const {
+    StageConstraints combined(StreamType::kStreaming,
+                              PositionRequirement::kNone,
+                              HostTypeRequirement::kNone,
+                              DiskUseRequirement::kNoDiskUse,
+                              FacetRequirement::kAllowed,
+                              TransactionRequirement::kAllowed,
+                              LookupRequirement::kAllowed,
+                              UnionRequirement::kAllowed);
+    combined = StageConstraints::getStrictestConstraints(_stages, combined);
+    // Parallelization runs after all stage reordering; nothing may swap past this boundary.
+    combined.canSwapWithMatch = false;
+    combined.canSwapWithSkippingOrLimitingStage = false;
+    return combined;
+}
+
+DepsTracker::State DocumentSourceInternalParallelTransform::getDependencies(
+    DepsTracker* deps) const {
+    return DocumentSourceInternalFusedTransformation::getDependenciesForComponents(_stages, deps);
+}
+
+void DocumentSourceInternalParallelTransform::serializeToArray(
+    std::vector<Value>& array, boost::optional<ExplainOptions::Verbosity> explain) const {
+    for (auto&& stage : _stages) {
+        stage->serializeToArray(array, explain);
+    }
+}
+
+boost::intrusive_ptr<DocumentSource> DocumentSourceInternalParallelTransform::clone() const {
+    Pipeline::SourceContainer clonedStages;
+    for (auto&& stage : _stages) {
+        clonedStages.push_back(stage->clone());
+    }
+    return create(pExpCtx, std::move(clonedStages), _numWorkers);
+}
+
+void DocumentSourceInternalParallelTransform::doDispose() {
+    _shutdownWorkers();
+    for (auto&& stage : _stages) {
+        stage->dispose();
+    }
+}
+
+}  // namespace mongo
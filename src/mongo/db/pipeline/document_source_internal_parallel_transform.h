@@ -0,0 +1,196 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_queue.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * An execution-only stage which evaluates a run of consecutive streaming per-document stages
+ * ($addFields/$project/$set/$unset/$replaceRoot and non-text $match) on a pool of worker threads,
+ * so that a CPU-bound per-document prefix of a pipeline can use more than one core. The pipeline
+ * thread pulls from the preceding stage (typically the collection scan, which remains serial as
+ * storage cursors are bound to a single snapshot and operation context), round-robins raw
+ * documents to the workers and collects results in dispatch order, so the observable document
+ * order is unchanged.
+ *
+ * Each worker runs its own parsed copy of the component stages against its own Client and
+ * OperationContext, so no execution state is shared between threads; the only synchronization is
+ * on the bounded per-worker input and output queues.
+ *
+ * The stage is created by the parallelization pass in Pipeline::optimizeContainer() when the
+ * internalQueryParallelTransformWorkers knob is set to 2 or more; it cannot be parsed from BSON.
+ * It serializes as the stages it replaced, so explain output, pipeline splitting for sharded
+ * execution and re-parsing on another node all see the original logical stages.
+ */
+class DocumentSourceInternalParallelTransform final : public DocumentSource {
+public:
+    static constexpr StringData kStageName = "$_internalParallelTransform"_sd;
+
+    /**
+     * Creates a parallel transform stage evaluating 'stages', each of which must be a
+     * DocumentSourceSingleDocumentTransformation or a non-text exact DocumentSourceMatch. Takes
+     * over ownership of the components; they must no longer be part of any pipeline.
+     */
+    static boost::intrusive_ptr<DocumentSourceInternalParallelTransform> create(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        Pipeline::SourceContainer stages,
+        size_t numWorkers);
+
+    /**
+     * Replaces every run of fusible stages in 'container' with a parallel transform stage running
+     * 'numWorkers' worker threads. The leading stage of the container is never touched, so
+     * pushdowns of a leading $match or projection into the query layer still apply. No-op inside
+     * sub-pipelines, where stages execute once per outer document and thread fan-out would not
+     * pay for itself.
+     */
+    static void parallelizeEligibleStages(Pipeline::SourceContainer* container, size_t numWorkers);
+
+    ~DocumentSourceInternalParallelTransform() override;
+
+    const char* getSourceName() const final {
+        return kStageName.rawData();
+    }
+
+    StageConstraints constraints(Pipeline::SplitState pipeState) const final;
+
+    boost::optional<DistributedPlanLogic> distributedPlanLogic() final {
+        return boost::none;
+    }
+
+    DepsTracker::State getDependencies(DepsTracker* deps) const final;
+
+    GetModPathsReturn getModifiedPaths() const final {
+        // Later optimizations must not reason across the parallelized boundary, so conservatively
+        // report that all paths may be modified.
+        return {GetModPathsReturn::Type::kAllPaths, {}, {}};
+    }
+
+    void serializeToArray(
+        std::vector<Value>& array,
+        boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+    boost::intrusive_ptr<DocumentSource> clone() const final;
+
+    size_t getNumWorkers() const {
+        return _numWorkers;
+    }
+
+    const Pipeline::SourceContainer& getComponentStages() const {
+        return _stages;
+    }
+
+protected:
+    GetNextResult doGetNext() final;
+
+    void doDispose() final;
+
+private:
+    /**
+     * Per-worker state. The pipeline thread appends to 'input' and pops from 'output'; the worker
+     * thread does the opposite. Both queues are guarded by 'mutex'. Everything else is written
+     * before the thread starts and only touched by the worker thread afterwards.
+     */
+    struct Worker {
+        std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
+        DocumentSourceQueue* queueSource = nullptr;
+        stdx::thread thread;
+
+        Mutex mutex = MONGO_MAKE_LATCH("DocumentSourceInternalParallelTransform::Worker::mutex");
+        stdx::condition_variable hasInput;
+        stdx::condition_variable hasOutput;
+        std::deque<Document> input;
+        // One entry per consumed input, in input order; boost::none means the document was
+        // filtered out by a $match component.
+        std::deque<boost::optional<Document>> output;
+        bool inputDone = false;
+    };
+
+    // An entry per dispatched document that has not been collected yet.
+    struct InflightEntry {
+        size_t workerId;
+        size_t approximateBytes;
+    };
+
+    DocumentSourceInternalParallelTransform(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        Pipeline::SourceContainer stages,
+        size_t numWorkers);
+
+    Value serialize(
+        boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final {
+        // This stage must serialize as its components; see serializeToArray().
+        MONGO_UNREACHABLE;
+    }
+
+    void _startWorkers();
+    void _workerMain(Worker* worker, ServiceContext* serviceContext);
+    void _dispatch(Document doc);
+    void _markInputDone();
+    boost::optional<Document> _collectNextResult();
+    void _recordError(Status status);
+    void _shutdownWorkers();
+
+    // The component stages, retained for serialization, cloning and dependency analysis. The
+    // workers execute their own re-parsed copies built from '_rawStages'.
+    Pipeline::SourceContainer _stages;
+    std::vector<BSONObj> _rawStages;
+    const size_t _numWorkers;
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+
+    // Dispatched-but-uncollected documents in dispatch order; results are collected in this order
+    // so the input order is preserved.
+    std::deque<InflightEntry> _dispatchOrder;
+    size_t _inflightBytes = 0;
+    size_t _nextWorker = 0;
+    bool _sourceExhausted = false;
+
+    // Error and shutdown flags shared with the worker threads. The first error wins; any error or
+    // shutdown makes all workers exit.
+    AtomicWord<bool> _shutdown{false};
+    AtomicWord<bool> _failed{false};
+    Mutex _errorMutex = MONGO_MAKE_LATCH("DocumentSourceInternalParallelTransform::_errorMutex");
+    Status _errorStatus = Status::OK();
+};
+
+}  // namespace mongo
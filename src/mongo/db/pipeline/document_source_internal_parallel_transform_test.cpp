@@ -0,0 +1,122 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <deque>
+#include <vector>
+
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/document_source_add_fields.h"
+#include "mongo/db/pipeline/document_source_internal_parallel_transform.h"
+#include "mongo/db/pipeline/document_source_match.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+using InternalParallelTransformTest = AggregationContextFixture;
+
+TEST_F(InternalParallelTransformTest, ParallelizesEligibleRunsButNotLeadingStage) {
+    Pipeline::SourceContainer container;
+    container.push_back(DocumentSourceAddFields::create(BSON("a" << 1), getExpCtx()));
+    container.push_back(DocumentSourceAddFields::create(BSON("b" << 2), getExpCtx()));
+    container.push_back(DocumentSourceMatch::create(BSON("a" << 1), getExpCtx()));
+
+    DocumentSourceInternalParallelTransform::parallelizeEligibleStages(&container, 4);
+
+    ASSERT_EQ(container.size(), 2U);
+    auto itr = container.begin();
+    ASSERT_EQ(std::string((*itr)->getSourceName()), DocumentSourceAddFields::kStageName);
+    ++itr;
+    auto parallel = dynamic_cast<DocumentSourceInternalParallelTransform*>(itr->get());
+    ASSERT(parallel);
+    ASSERT_EQ(parallel->getComponentStages().size(), 2U);
+    ASSERT_EQ(parallel->getNumWorkers(), 4U);
+}
+
+TEST_F(InternalParallelTransformTest, DoesNotParallelizeInsideSubPipeline) {
+    auto subExpCtx = getExpCtx()->copyForSubPipeline(getExpCtx()->ns);
+    Pipeline::SourceContainer container;
+    container.push_back(DocumentSourceAddFields::create(BSON("a" << 1), subExpCtx));
+    container.push_back(DocumentSourceAddFields::create(BSON("b" << 2), subExpCtx));
+
+    DocumentSourceInternalParallelTransform::parallelizeEligibleStages(&container, 4);
+
+    ASSERT_EQ(container.size(), 2U);
+    for (auto&& stage : container) {
+        ASSERT_FALSE(dynamic_cast<DocumentSourceInternalParallelTransform*>(stage.get()));
+    }
+}
+
+TEST_F(InternalParallelTransformTest, PreservesOrderAppliesTransformsAndFilters) {
+    Pipeline::SourceContainer components;
+    components.push_back(DocumentSourceAddFields::create(BSON("b" << 5), getExpCtx()));
+    components.push_back(
+        DocumentSourceMatch::create(BSON("i" << BSON("$gte" << 100)), getExpCtx()));
+    auto parallel =
+        DocumentSourceInternalParallelTransform::create(getExpCtx(), std::move(components), 4);
+
+    std::deque<DocumentSource::GetNextResult> inputs;
+    for (int i = 0; i < 200; ++i) {
+        inputs.push_back(Document{{"i", i}});
+    }
+    auto mock = DocumentSourceMock::createForTest(std::move(inputs), getExpCtx());
+    parallel->setSource(mock.get());
+
+    for (int i = 100; i < 200; ++i) {
+        auto next = parallel->getNext();
+        ASSERT_TRUE(next.isAdvanced());
+        ASSERT_DOCUMENT_EQ(next.releaseDocument(), (Document{{"i", i}, {"b", 5}}));
+    }
+    ASSERT_TRUE(parallel->getNext().isEOF());
+    parallel->dispose();
+}
+
+TEST_F(InternalParallelTransformTest, SerializesAsItsComponents) {
+    Pipeline::SourceContainer components;
+    components.push_back(
+        DocumentSourceAddFields::create(BSON("a" << BSON("$const" << 1)), getExpCtx()));
+    components.push_back(DocumentSourceMatch::create(BSON("a" << 1), getExpCtx()));
+    auto parallel =
+        DocumentSourceInternalParallelTransform::create(getExpCtx(), std::move(components), 2);
+
+    std::vector<Value> serialized;
+    parallel->serializeToArray(serialized);
+    ASSERT_EQ(serialized.size(), 2U);
+    ASSERT_BSONOBJ_EQ(serialized[0].getDocument().toBson(),
+                      BSON("$addFields" << BSON("a" << BSON("$const" << 1))));
+    ASSERT_BSONOBJ_EQ(serialized[1].getDocument().toBson(), BSON("$match" << BSON("a" << 1)));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -484,10 +484,15 @@ void DocumentSourceInternalUnpackBucket::serializeToArray(
 DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
     tassert(5521502, "calling doGetNext() when '_sampleSize' is set is disallowed", !_sampleSize);
 
+    // Drain measurements that were unpacked in bulk from the current bucket first.
+    if (_unpackedBatchIdx < _unpackedBatch.size()) {
+        return std::move(_unpackedBatch[_unpackedBatchIdx++]);
+    }
+
     // Otherwise, fallback to unpacking every measurement in all buckets until the child stage is
     // exhausted.
     if (_bucketUnpacker.hasNext()) {
-        return _bucketUnpacker.getNext();
+        return _refillUnpackedBatch();
     }
 
     auto nextResult = pSource->getNext();
@@ -499,12 +504,18 @@ DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
                               << _bucketUnpacker.bucket()[timeseries::kBucketIdFieldName].toString()
                               << " contains an empty data region",
                 _bucketUnpacker.hasNext());
-        return _bucketUnpacker.getNext();
+        return _refillUnpackedBatch();
     }
 
     return nextResult;
 }
 
+Document DocumentSourceInternalUnpackBucket::_refillUnpackedBatch() {
+    _unpackedBatch = _bucketUnpacker.getNextBatch(kUnpackBatchSize);
+    _unpackedBatchIdx = 1;
+    return std::move(_unpackedBatch.front());
+}
+
 bool DocumentSourceInternalUnpackBucket::pushDownComputedMetaProjection(
     Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
     bool nextStageWasRemoved = false;
@@ -630,89 +641,154 @@ std::pair<BSONObj, bool> DocumentSourceInternalUnpackBucket::extractProjectForPu
 }
 
 std::pair<bool, Pipeline::SourceContainer::iterator>
-DocumentSourceInternalUnpackBucket::rewriteGroupByMinMax(Pipeline::SourceContainer::iterator itr,
-                                                         Pipeline::SourceContainer* container) {
+DocumentSourceInternalUnpackBucket::rewriteGroupOnBucketMetadata(
+    Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
     const auto* groupPtr = dynamic_cast<DocumentSourceGroup*>(std::next(itr)->get());
     if (groupPtr == nullptr) {
         return {};
     }
 
     const auto& idFields = groupPtr->getIdFields();
-    if (idFields.size() != 1 || !_bucketUnpacker.bucketSpec().metaField().has_value()) {
+    if (idFields.size() != 1) {
         return {};
     }
 
+    const auto& metaField = _bucketUnpacker.bucketSpec().metaField();
+
+    // The group key must not depend on the measurements: either a constant (all buckets fall in
+    // one group) or a path on the metadata field, which is identical for every measurement of a
+    // bucket.
     const auto& exprId = idFields.cbegin()->second;
-    const auto* exprIdPath = dynamic_cast<const ExpressionFieldPath*>(exprId.get());
-    if (exprIdPath == nullptr) {
-        return {};
-    }
+    boost::intrusive_ptr<Expression> rewrittenIdExpr;
+    if (dynamic_cast<const ExpressionConstant*>(exprId.get())) {
+        rewrittenIdExpr = exprId;
+    } else if (const auto* exprIdPath = dynamic_cast<const ExpressionFieldPath*>(exprId.get())) {
+        const auto& idPath = exprIdPath->getFieldPath();
+        if (!metaField || idPath.getPathLength() < 2 || idPath.getFieldName(1) != *metaField) {
+            return {};
+        }
 
-    const auto& idPath = exprIdPath->getFieldPath();
-    if (idPath.getPathLength() < 2 ||
-        idPath.getFieldName(1) != _bucketUnpacker.bucketSpec().metaField().get()) {
+        std::ostringstream os;
+        os << timeseries::kBucketMetaFieldName;
+        for (size_t index = 2; index < idPath.getPathLength(); index++) {
+            os << "." << idPath.getFieldName(index);
+        }
+        rewrittenIdExpr = ExpressionFieldPath::createPathFromString(
+            pExpCtx.get(), os.str(), pExpCtx->variablesParseState);
+    } else {
         return {};
     }
 
+    // Expression computing the number of measurements in a bucket from its metadata: compressed
+    // (v2) buckets record it in 'control.count', and for v1 buckets it is the number of entries
+    // in the time column.
+    auto makeBucketCountExpression = [&]() {
+        std::ostringstream controlVersion;
+        controlVersion << "$" << timeseries::kBucketControlFieldName << "."
+                       << timeseries::kBucketControlVersionFieldName;
+        std::ostringstream controlCount;
+        controlCount << "$" << timeseries::kBucketControlFieldName << "."
+                     << timeseries::kBucketControlCountFieldName;
+        std::ostringstream dataTime;
+        dataTime << "$" << timeseries::kDataFieldNamePrefix
+                 << _bucketUnpacker.bucketSpec().timeField();
+
+        return Expression::parseExpression(
+            pExpCtx.get(),
+            BSON("$cond" << BSON_ARRAY(
+                     BSON("$gte" << BSON_ARRAY(controlVersion.str()
+                                               << timeseries::kTimeseriesControlCompressedVersion))
+                     << controlCount.str()
+                     << BSON("$size" << BSON("$objectToArray" << dataTime.str())))),
+            pExpCtx->variablesParseState);
+    };
+
     bool suitable = true;
     std::vector<AccumulationStatement> accumulationStatements;
     for (const AccumulationStatement& stmt : groupPtr->getAccumulatedFields()) {
         const auto op = stmt.expr.name;
         const bool isMin = op == "$min";
         const bool isMax = op == "$max";
+        const bool isSum = op == "$sum";
 
-        // Rewrite is valid only for min and max aggregates.
-        if (!isMin && !isMax) {
+        // The rewrite is valid only for min and max aggregates on non-time fields, and for sums
+        // of a numeric constant, which can be answered with the per-bucket measurement counts.
+        if (!isMin && !isMax && !isSum) {
             suitable = false;
             break;
         }
 
-        const auto* exprArg = stmt.expr.argument.get();
-        if (const auto* exprArgPath = dynamic_cast<const ExpressionFieldPath*>(exprArg)) {
-            const auto& path = exprArgPath->getFieldPath();
-            if (path.getPathLength() <= 1 ||
-                path.getFieldName(1) == _bucketUnpacker.bucketSpec().timeField()) {
-                // Rewrite not valid for time field. We want to eliminate the bucket
-                // unpack stage here.
+        if (isSum) {
+            const auto* exprConst =
+                dynamic_cast<const ExpressionConstant*>(stmt.expr.argument.get());
+            if (!exprConst || !exprConst->getValue().numeric()) {
                 suitable = false;
                 break;
             }
 
-            // Update aggregates to reference the control field.
-            std::ostringstream os;
-            if (isMin) {
-                os << timeseries::kControlMinFieldNamePrefix;
+            // Summing the integer 1 is exactly the measurement count; any other constant scales
+            // the count, with $multiply preserving the result type of the repeated addition.
+            auto countExpr = makeBucketCountExpression();
+            AccumulationExpression accExpr = stmt.expr;
+            const auto& constVal = exprConst->getValue();
+            if (constVal.getType() == BSONType::NumberInt && constVal.getInt() == 1) {
+                accExpr.argument = std::move(countExpr);
             } else {
-                os << timeseries::kControlMaxFieldNamePrefix;
-            }
-
-            for (size_t index = 1; index < path.getPathLength(); index++) {
-                if (index > 1) {
-                    os << ".";
-                }
-                os << path.getFieldName(index);
+                accExpr.argument = make_intrusive<ExpressionMultiply>(
+                    pExpCtx.get(),
+                    Expression::ExpressionVector{std::move(countExpr), stmt.expr.argument});
             }
+            accumulationStatements.emplace_back(stmt.fieldName, std::move(accExpr));
+            continue;
+        }
 
-            const auto& newExpr = ExpressionFieldPath::createPathFromString(
-                pExpCtx.get(), os.str(), pExpCtx->variablesParseState);
+        const auto* exprArgPath =
+            dynamic_cast<const ExpressionFieldPath*>(stmt.expr.argument.get());
+        if (exprArgPath == nullptr) {
+            suitable = false;
+            break;
+        }
 
-            AccumulationExpression accExpr = stmt.expr;
-            accExpr.argument = newExpr;
-            accumulationStatements.emplace_back(stmt.fieldName, std::move(accExpr));
+        const auto& path = exprArgPath->getFieldPath();
+        if (path.getPathLength() <= 1 ||
+            path.getFieldName(1) == _bucketUnpacker.bucketSpec().timeField()) {
+            // Rewrite not valid for time field. We want to eliminate the bucket
+            // unpack stage here.
+            suitable = false;
+            break;
         }
-    }
 
-    if (suitable) {
+        // Update aggregates to reference the control field, or the bucket-level metadata field
+        // for aggregates on the metadata, which is the same for every measurement of a bucket.
         std::ostringstream os;
-        os << timeseries::kBucketMetaFieldName;
-        for (size_t index = 2; index < idPath.getPathLength(); index++) {
-            os << "." << idPath.getFieldName(index);
+        size_t startIndex = 1;
+        if (metaField && path.getFieldName(1) == *metaField) {
+            os << timeseries::kBucketMetaFieldName;
+            startIndex = 2;
+        } else if (isMin) {
+            os << timeseries::kControlMinFieldNamePrefix;
+        } else {
+            os << timeseries::kControlMaxFieldNamePrefix;
         }
-        auto exprId1 = ExpressionFieldPath::createPathFromString(
+
+        for (size_t index = startIndex; index < path.getPathLength(); index++) {
+            if (index > startIndex || startIndex == 2) {
+                os << ".";
+            }
+            os << path.getFieldName(index);
+        }
+
+        const auto& newExpr = ExpressionFieldPath::createPathFromString(
             pExpCtx.get(), os.str(), pExpCtx->variablesParseState);
 
+        AccumulationExpression accExpr = stmt.expr;
+        accExpr.argument = newExpr;
+        accumulationStatements.emplace_back(stmt.fieldName, std::move(accExpr));
+    }
+
+    if (suitable) {
         auto newGroup = DocumentSourceGroup::create(pExpCtx,
-                                                    std::move(exprId1),
+                                                    std::move(rewrittenIdExpr),
                                                     std::move(accumulationStatements),
                                                     groupPtr->getMaxMemoryUsageBytes());
 
@@ -1005,8 +1081,9 @@ Pipeline::SourceContainer::iterator DocumentSourceInternalUnpackBucket::doOptimi
         }
     }
     {
-        // Check if we can avoid unpacking if we have a group stage with min/max aggregates.
-        auto [success, result] = rewriteGroupByMinMax(itr, container);
+        // Check if we can avoid unpacking if we have a group stage which only needs bucket
+        // metadata (min/max/count-style aggregates grouped on the meta field or a constant).
+        auto [success, result] = rewriteGroupOnBucketMetadata(itr, container);
         if (success) {
             return result;
         }
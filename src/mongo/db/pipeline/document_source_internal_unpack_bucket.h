@@ -185,11 +185,13 @@ public:
     std::pair<BSONObj, bool> extractProjectForPushDown(DocumentSource* src) const;
 
     /**
-     * Helper method which checks if we can avoid unpacking if we have a group stage with min/max
-     * aggregates. If a rewrite is possible, 'container' is modified, and we returns result value
-     * for 'doOptimizeAt'.
+     * Helper method which checks if we can avoid unpacking if we have a group stage which can be
+     * answered from the bucket-level metadata alone: grouped on the metaField (or a constant),
+     * with min/max aggregates on non-time fields and/or sums of a numeric constant, which are
+     * served from the 'control' block and the per-bucket measurement counts. If a rewrite is
+     * possible, 'container' is modified, and we returns result value for 'doOptimizeAt'.
      */
-    std::pair<bool, Pipeline::SourceContainer::iterator> rewriteGroupByMinMax(
+    std::pair<bool, Pipeline::SourceContainer::iterator> rewriteGroupOnBucketMetadata(
         Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container);
 
     /**
@@ -220,7 +222,17 @@ public:
     GetModPathsReturn getModifiedPaths() const final override;
 
 private:
+    // Number of measurements materialized from a bucket per getNextBatch() call. Bounds the
+    // memory spent on buffered measurements while still amortizing the per-batch decompression
+    // setup over many measurements.
+    static constexpr std::size_t kUnpackBatchSize = 128;
+
     GetNextResult doGetNext() final;
+
+    // Unpacks the next batch of measurements from the current bucket and returns the first one.
+    // May only be called when the unpacker has a next measurement.
+    Document _refillUnpackedBatch();
+
     bool haveComputedMetaField() const;
 
     // If buckets contained a mixed type schema along some path, we have to push down special
@@ -230,6 +242,10 @@ private:
     BucketUnpacker _bucketUnpacker;
     int _bucketMaxSpanSeconds;
 
+    // Measurements unpacked in bulk from the current bucket but not yet returned.
+    std::vector<Document> _unpackedBatch;
+    std::size_t _unpackedBatchIdx = 0;
+
     int _bucketMaxCount = 0;
     boost::optional<long long> _sampleSize;
 
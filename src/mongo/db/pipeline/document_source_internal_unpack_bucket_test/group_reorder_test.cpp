@@ -47,12 +47,13 @@ TEST_F(InternalUnpackBucketGroupReorder, OptimizeForCount) {
     pipeline->optimizePipeline();
 
     auto serialized = pipeline->serializeToBson();
-    // $count gets rewritten to $group + $project.
-    ASSERT_EQ(3, serialized.size());
+    // $count gets rewritten to $group + $project, and the $group is answered from the per-bucket
+    // measurement counts, so the unpack stage is eliminated entirely.
+    ASSERT_EQ(2, serialized.size());
 
     auto optimized = fromjson(
-        "{$_internalUnpackBucket: { include: [], timeField: 't', metaField: 'meta', "
-        "bucketMaxSpanSeconds: 3600}}");
+        "{$group: {_id: {$const: null}, foo: {$sum: {$cond: [{$gte: ['$control.version', {$const: "
+        "2}]}, '$control.count', {$size: [{$objectToArray: ['$data.t']}]}]}}}}");
     ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
 }
 
@@ -94,6 +95,65 @@ TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadata) {
     ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
 }
 
+TEST_F(InternalUnpackBucketGroupReorder, MinGroupOnMetadataField) {
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], metaField: 'meta1', timeField: 't', "
+        "bucketMaxSpanSeconds: 3600}}");
+    auto groupSpecObj = fromjson("{$group: {_id: '$meta1', accmin: {$min: '$meta1.f'}}}");
+
+    auto pipeline = Pipeline::parse(makeVector(unpackSpecObj, groupSpecObj), getExpCtx());
+    pipeline->optimizePipeline();
+
+    auto serialized = pipeline->serializeToBson();
+    ASSERT_EQ(1, serialized.size());
+
+    // Aggregates on the metadata are answered from the bucket-level meta field directly, since it
+    // is the same for every measurement of a bucket.
+    auto optimized = fromjson("{$group: {_id: '$meta', accmin: {$min: '$meta.f'}}}");
+    ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
+}
+
+TEST_F(InternalUnpackBucketGroupReorder, CountGroupOnMetadata) {
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], metaField: 'meta1', timeField: 't', "
+        "bucketMaxSpanSeconds: 3600}}");
+    auto groupSpecObj = fromjson("{$group: {_id: '$meta1', accmin: {$min: '$b'}, c: {$sum: 1}}}");
+
+    auto pipeline = Pipeline::parse(makeVector(unpackSpecObj, groupSpecObj), getExpCtx());
+    pipeline->optimizePipeline();
+
+    auto serialized = pipeline->serializeToBson();
+    ASSERT_EQ(1, serialized.size());
+
+    // A $sum of a constant is answered from the per-bucket measurement counts: 'control.count'
+    // for compressed buckets, and the number of entries in the time column otherwise.
+    auto optimized = fromjson(
+        "{$group: {_id: '$meta', accmin: {$min: '$control.min.b'}, c: {$sum: {$cond: [{$gte: "
+        "['$control.version', {$const: 2}]}, '$control.count', {$size: [{$objectToArray: "
+        "['$data.t']}]}]}}}}");
+    ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
+}
+
+TEST_F(InternalUnpackBucketGroupReorder, SumOfConstantGroupOnMetadata) {
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], metaField: 'meta1', timeField: 't', "
+        "bucketMaxSpanSeconds: 3600}}");
+    auto groupSpecObj = fromjson("{$group: {_id: '$meta1', s: {$sum: 3}}}");
+
+    auto pipeline = Pipeline::parse(makeVector(unpackSpecObj, groupSpecObj), getExpCtx());
+    pipeline->optimizePipeline();
+
+    auto serialized = pipeline->serializeToBson();
+    ASSERT_EQ(1, serialized.size());
+
+    // Summing a constant other than 1 scales the per-bucket measurement count.
+    auto optimized = fromjson(
+        "{$group: {_id: '$meta', s: {$sum: {$multiply: [{$cond: [{$gte: ['$control.version', "
+        "{$const: 2}]}, '$control.count', {$size: [{$objectToArray: ['$data.t']}]}]}, {$const: "
+        "3}]}}}}");
+    ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
+}
+
 TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataNegative) {
     auto unpackSpecObj = fromjson(
         "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], timeField: 't', metaField: 'meta', "
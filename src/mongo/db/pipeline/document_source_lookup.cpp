@@ -72,6 +72,51 @@ BSONObj buildEqualityOrQuery(const std::string& fieldName, const BSONArray& valu
     return orBuilder.obj();
 }
 
+/**
+ * Adds to 'keys' every value that an equality match on 'path' would compare against for 'doc':
+ * each terminal value reached by traversing arrays along 'path' and, when a terminal value is an
+ * array, the array itself in addition to its elements. This mirrors the array traversal performed
+ * by the match language, so for any non-null key a document produces that key exactly when an
+ * {$eq: <key>} query on 'path' would select it. 'path' must not contain numeric components.
+ */
+void addHashJoinKeys(const Document& doc,
+                     const FieldPath& path,
+                     size_t fieldPathIndex,
+                     std::vector<Value>* keys) {
+    invariant(fieldPathIndex < path.getPathLength());
+
+    auto nextValue = doc.getField(path.getFieldName(fieldPathIndex));
+    ++fieldPathIndex;
+
+    if (fieldPathIndex == path.getPathLength()) {
+        if (nextValue.isArray()) {
+            // An equality match on an array value considers both the array as a whole and each of
+            // its elements.
+            keys->push_back(nextValue);
+            for (auto&& element : nextValue.getArray()) {
+                if (!element.missing()) {
+                    keys->push_back(element);
+                }
+            }
+        } else if (!nextValue.missing()) {
+            keys->push_back(nextValue);
+        }
+        return;
+    }
+
+    if (nextValue.isArray()) {
+        // Note we do not expand arrays within arrays this way. For example, {a: [[{b: 1}]]} has no
+        // values on the path "a.b", but {a: [{b: 1}]} does.
+        for (auto&& subValue : nextValue.getArray()) {
+            if (subValue.getType() == BSONType::Object) {
+                addHashJoinKeys(subValue.getDocument(), path, fieldPathIndex, keys);
+            }
+        }
+    } else if (nextValue.getType() == BSONType::Object) {
+        addHashJoinKeys(nextValue.getDocument(), path, fieldPathIndex, keys);
+    }
+}
+
 void lookupPipeValidator(const Pipeline& pipeline) {
     const auto& sources = pipeline.getSources();
     std::for_each(sources.begin(), sources.end(), [](auto& src) {
@@ -448,15 +493,29 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
-    if (hasLocalFieldForeignFieldJoin()) {
-        auto matchStage =
-            makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
-        // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
-        _resolvedPipeline[*_fieldMatchPipelineIdx] = matchStage;
-    }
-
     std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
     try {
+        if (_hashJoinState == HashJoinState::kNotStarted) {
+            buildHashJoinTable();
+        }
+
+        if (_hashJoinState == HashJoinState::kServing) {
+            if (auto results = probeHashJoinTable(inputDoc)) {
+                MutableDocument output(std::move(inputDoc));
+                output.setNestedField(_as, Value(std::move(*results)));
+                return output.freeze();
+            }
+            // The local key was null or missing; fall through and run the join as a query, which
+            // implements the null-matching semantics.
+        }
+
+        if (hasLocalFieldForeignFieldJoin()) {
+            auto matchStage = makeMatchStageFromInput(
+                inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
+            // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
+            _resolvedPipeline[*_fieldMatchPipelineIdx] = matchStage;
+        }
+
         pipeline = buildPipeline(inputDoc);
     } catch (const ExceptionForCat<ErrorCategory::StaleShardVersionError>& ex) {
         // If lookup on a sharded collection is disallowed and the foreign collection is sharded,
@@ -660,6 +719,139 @@ void DocumentSourceLookUp::addCacheStageAndOptimize(Pipeline& pipeline) {
     pipeline.optimizePipeline();
 }
 
+bool DocumentSourceLookUp::hashJoinEligible() const {
+    // The hash table implements only the equality portion of the local/foreignField join, so the
+    // foreign side must consist of nothing but the generated $match (plus any resolved view
+    // prefix): no user pipeline, no absorbed $match, and no absorbed $unwind (the unwind path
+    // streams each sub-pipeline's results incrementally).
+    return hasLocalFieldForeignFieldJoin() && !hasPipeline() && !_unwindSrc && !_matchSrc &&
+        !_additionalFilter
+        // Match-like paths with numeric components have positional semantics that the key
+        // extraction does not implement.
+        && !FieldRef(_localField->fullPath()).hasNumericPathComponents() &&
+        !FieldRef(_foreignField->fullPath()).hasNumericPathComponents();
+}
+
+void DocumentSourceLookUp::buildHashJoinTable() {
+    invariant(_hashJoinState == HashJoinState::kNotStarted);
+    _hashJoinState = HashJoinState::kAbandoned;
+
+    const auto maxBytes = internalDocumentSourceLookupHashJoinMaxBytes.load();
+    if (maxBytes <= 0 || !hashJoinEligible()) {
+        return;
+    }
+
+    // Replacing the placeholder with an empty $match turns the resolved pipeline into a scan of
+    // the entire foreign collection (with any view prefix still applied). The per-document query
+    // path overwrites this slot on every input document, so there is nothing to restore if the
+    // build is abandoned.
+    _resolvedPipeline[*_fieldMatchPipelineIdx] = BSON("$match" << BSONObj());
+
+    auto pipeline = buildPipeline(Document());
+
+    auto table = _fromExpCtx->getValueComparator().makeUnorderedValueMap<std::vector<size_t>>();
+    std::vector<Document> docs;
+    std::vector<Value> keys;
+    long long bytes = 0;
+    bool exceededBudget = false;
+
+    while (auto result = pipeline->getNext()) {
+        bytes += static_cast<long long>(result->getApproximateSize());
+        if (bytes > maxBytes) {
+            exceededBudget = true;
+            break;
+        }
+
+        keys.clear();
+        addHashJoinKeys(*result, *_foreignField, 0, &keys);
+
+        const size_t index = docs.size();
+        for (auto&& key : keys) {
+            auto& entries = table[key];
+            // A document may produce the same key several times (e.g. repeated array elements).
+            // Offsets are appended in order, so a duplicate is always adjacent.
+            if (entries.empty() || entries.back() != index) {
+                entries.push_back(index);
+            }
+        }
+        docs.push_back(std::move(*result));
+    }
+
+    accumulatePipelinePlanSummaryStats(*pipeline, _stats.planSummaryStats);
+
+    if (exceededBudget) {
+        LOGV2_DEBUG(6650012,
+                    2,
+                    "$lookup foreign collection exceeds the hash join memory budget, falling back "
+                    "to one query per input document",
+                    logAttrs(_fromNs),
+                    "maxBytes"_attr = maxBytes);
+        return;
+    }
+
+    LOGV2_DEBUG(6650013,
+                2,
+                "$lookup built a hash table over the foreign collection",
+                logAttrs(_fromNs),
+                "documents"_attr = docs.size(),
+                "bytes"_attr = bytes);
+
+    _hashJoinDocs = std::move(docs);
+    _hashJoinTable.emplace(std::move(table));
+    _hashJoinState = HashJoinState::kServing;
+}
+
+boost::optional<std::vector<Value>> DocumentSourceLookUp::probeHashJoinTable(
+    const Document& inputDoc) {
+    // Gather the set of local keys, expanding arrays the same way makeMatchStageFromInput() does
+    // when it builds the $in list.
+    auto localKeys = _fromExpCtx->getValueComparator().makeUnorderedValueSet();
+    bool hasNullKey = false;
+    document_path_support::visitAllValuesAtPath(
+        inputDoc, *_localField, [&localKeys, &hasNullKey](const Value& nextValue) {
+            if (nextValue.nullish()) {
+                hasNullKey = true;
+            }
+            localKeys.insert(nextValue);
+        });
+
+    if (localKeys.empty() || hasNullKey) {
+        // A null or missing local key also matches foreign documents where the field is null or
+        // absent. The hash table does not index those, so this input document must be joined by
+        // running the resolved pipeline.
+        return boost::none;
+    }
+
+    // Take the union of the matching buckets in an ordered set, so that a document matching
+    // several keys is returned once, in the order the foreign documents were read.
+    std::set<size_t> matches;
+    for (auto&& key : localKeys) {
+        auto it = _hashJoinTable->find(key);
+        if (it != _hashJoinTable->end()) {
+            matches.insert(it->second.begin(), it->second.end());
+        }
+    }
+
+    std::vector<Value> results;
+    results.reserve(matches.size());
+    long long objsize = 0;
+    const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+
+    for (auto&& index : matches) {
+        const auto& doc = _hashJoinDocs[index];
+        long long safeSum = 0;
+        bool hasOverflowed = overflow::add(objsize, doc.getApproximateSize(), &safeSum);
+        uassert(6929907,
+                str::stream() << "Total size of documents in " << _fromNs.coll()
+                              << " matching pipeline's $lookup stage exceeds " << maxBytes
+                              << " bytes",
+                !hasOverflowed && safeSum <= maxBytes);
+        objsize = safeSum;
+        results.emplace_back(doc);
+    }
+    return results;
+}
+
 DocumentSource::GetModPathsReturn DocumentSourceLookUp::getModifiedPaths() const {
     std::set<std::string> modifiedPaths{_as.fullPath()};
     if (_unwindSrc) {
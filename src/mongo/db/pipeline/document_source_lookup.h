@@ -367,6 +367,29 @@ private:
      */
     void determineSbeCompatibility();
 
+    /**
+     * Returns true if this stage is permitted to answer input documents by probing a hash table
+     * built once over the foreign collection, rather than running the resolved pipeline once per
+     * input document.
+     */
+    bool hashJoinEligible() const;
+
+    /**
+     * Attempts to build the foreign-side hash table for the local/foreignField equality join.
+     * Transitions '_hashJoinState' to 'kServing' on success, or to 'kAbandoned' if this stage is
+     * ineligible or the foreign collection exceeds the memory budget, in which case every input
+     * document is joined by running the resolved pipeline, as before.
+     */
+    void buildHashJoinTable();
+
+    /**
+     * Returns the foreign documents matching 'inputDoc', in the order they were read at build
+     * time. Returns boost::none if the local key is null or missing, since those keys also match
+     * foreign documents where the field is null or absent; such input documents must be joined by
+     * running the resolved pipeline.
+     */
+    boost::optional<std::vector<Value>> probeHashJoinTable(const Document& inputDoc);
+
     DocumentSourceLookupStats _stats;
 
     NamespaceString _fromNs;
@@ -392,6 +415,15 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // When the foreign collection of a local/foreignField join fits the memory budget given by
+    // 'internalDocumentSourceLookupHashJoinMaxBytes', its documents are read once into
+    // '_hashJoinDocs' and each join key is mapped by '_hashJoinTable' to the offsets of the
+    // documents an equality match on '_foreignField' against that key would select.
+    enum class HashJoinState { kNotStarted, kServing, kAbandoned };
+    HashJoinState _hashJoinState = HashJoinState::kNotStarted;
+    std::vector<Document> _hashJoinDocs;
+    boost::optional<ValueUnorderedMap<std::vector<size_t>>> _hashJoinTable;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
@@ -50,6 +50,7 @@
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/server_options.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo {
 namespace {
@@ -893,6 +894,120 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePauses) {
     lookup->dispose();
 }
 
+TEST_F(DocumentSourceLookUpTest, ShouldJoinFromHashTableWhenForeignCollectionFitsMemoryBudget) {
+    RAIIServerParameterControllerForTest hashJoinBudget(
+        "internalDocumentSourceLookupHashJoinMaxBytes", 100 * 1024 * 1024);
+
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // Mock out a foreign collection read once at hash table build time. The array-valued key in
+    // the last document should be indexed both as a whole and by element.
+    deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document{{"_id", 0}, {"x", "a"_sd}},
+        Document{{"_id", 1}, {"x", "b"_sd}},
+        Document{{"_id", Value(std::vector<Value>{Value(2), Value(3)})}, {"x", "c"_sd}}};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "foreignId"_sd},
+                                         {"foreignField", "_id"_sd},
+                                         {"as", "foreignDocs"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    // An array-valued local key should match any of its elements, and a scalar local key should
+    // also match a foreign array containing it.
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document{{"foreignId", 0}},
+         Document{{"foreignId", Value(std::vector<Value>{Value(0), Value(1)})}},
+         Document{{"foreignId", 3}},
+         Document{{"foreignId", 99}}},
+        expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"foreignId", 0}, {"foreignDocs", {Document{{"_id", 0}, {"x", "a"_sd}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"foreignId", Value(std::vector<Value>{Value(0), Value(1)})},
+                                 {"foreignDocs",
+                                  {Document{{"_id", 0}, {"x", "a"_sd}},
+                                   Document{{"_id", 1}, {"x", "b"_sd}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"foreignId", 3},
+                  {"foreignDocs",
+                   {Document{{"_id", Value(std::vector<Value>{Value(2), Value(3)})},
+                             {"x", "c"_sd}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"foreignId", 99}, {"foreignDocs", Value(std::vector<Value>())}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
+TEST_F(DocumentSourceLookUpTest, ShouldRunQueryForNullOrMissingLocalKeyWhenHashJoinEnabled) {
+    RAIIServerParameterControllerForTest hashJoinBudget(
+        "internalDocumentSourceLookupHashJoinMaxBytes", 100 * 1024 * 1024);
+
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    deque<DocumentSource::GetNextResult> mockForeignContents{Document{{"_id", 0}, {"y", 0}},
+                                                             Document{{"_id", 1}}};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "localKey"_sd},
+                                         {"foreignField", "y"_sd},
+                                         {"as", "foreignDocs"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    // A missing local key matches foreign documents where the field is absent, which the hash
+    // table does not index; the stage must fall back to a per-document query for this input.
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document{{"_id", "missingKey"_sd}}, Document{{"localKey", 0}}}, expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"_id", "missingKey"_sd},
+                                 {"foreignDocs", {Document{{"_id", 1}}}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        (Document{{"localKey", 0}, {"foreignDocs", {Document{{"_id", 0}, {"y", 0}}}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
 TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs("test", "foreign");
@@ -94,6 +94,10 @@ public:
         return *_parsedTransform;
     }
 
+    auto& getTransformer() {
+        return *_parsedTransform;
+    }
+
     /**
      * Extract computed projection(s) depending on the 'oldName' argument if the transformation is
      * of type inclusion projection or computed projection. Extraction is not allowed if the name of
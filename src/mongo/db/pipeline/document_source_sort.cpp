@@ -44,6 +44,7 @@
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/pipeline/skip_and_limit.h"
 #include "mongo/db/query/collation/collation_index_key.h"
+#include "mongo/db/query/operation_memory_usage_tracker.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/overflow_arithmetic.h"
@@ -522,6 +523,8 @@ void DocumentSourceSort::loadDocument(Document&& doc) {
     // documents, and wouldn't use this method.
     std::tie(sortKey, docForSorter) = extractSortKey(std::move(doc));
     _sortExecutor->add(sortKey, docForSorter);
+    OperationMemoryUsageTracker::get(pExpCtx->opCtx)
+        .set(this, _sortExecutor->currentMemoryUsageBytes());
 }
 
 void DocumentSourceSort::loadingDone() {
@@ -40,6 +40,7 @@
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_union_with.h"
 #include "mongo/db/pipeline/document_source_union_with_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/views/resolved_view.h"
 #include "mongo/logv2/log.h"
 
@@ -208,6 +209,15 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
     }
 
     if (_executionState == ExecutionProgress::kIteratingSource) {
+        if (!_subPipelineDispatched && pExpCtx->inMongos &&
+            internalQueryUnionWithEagerRemoteDispatch.load()) {
+            // Dispatch the sub-pipeline's shard cursors now so that the shards execute the
+            // sub-pipeline concurrently with the rest of this pipeline. We do not iterate the
+            // cursors until 'pSource' is exhausted, so results are still returned in the usual
+            // order. If a sharded view is encountered the sub-pipeline is rebuilt and we fall
+            // back to dispatching it lazily below.
+            dispatchSubPipeline();
+        }
         auto nextInput = pSource->getNext();
         if (!nextInput.isEOF()) {
             return nextInput;
@@ -218,28 +228,11 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
     }
 
     if (_executionState == ExecutionProgress::kStartingSubPipeline) {
-        auto serializedPipe = _pipeline->serializeToBson();
-        logStartingSubPipeline(serializedPipe);
-        // $$SEARCH_META can be set during runtime earlier in the pipeline, and therefore must be
-        // copied to the subpipeline manually.
-        if (pExpCtx->variables.hasConstantValue(Variables::kSearchMetaId)) {
-            _pipeline->getContext()->variables.setReservedValue(
-                Variables::kSearchMetaId,
-                pExpCtx->variables.getValue(Variables::kSearchMetaId, Document()),
-                true);
-        }
-        try {
-            _pipeline =
-                pExpCtx->mongoProcessInterface->attachCursorSourceToPipeline(_pipeline.release());
-            _executionState = ExecutionProgress::kIteratingSubPipeline;
-        } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) {
-            _pipeline = buildPipelineFromViewDefinition(
-                pExpCtx,
-                ExpressionContext::ResolvedNamespace{e->getNamespace(), e->getPipeline()},
-                serializedPipe);
-            logShardedViewFound(e);
+        if (!_subPipelineDispatched && !dispatchSubPipeline()) {
+            // A sharded view was resolved and the sub-pipeline rebuilt; try again.
             return doGetNext();
         }
+        _executionState = ExecutionProgress::kIteratingSubPipeline;
     }
 
     // The $unionWith stage takes responsibility for disposing of its Pipeline. When the outer
@@ -258,6 +251,32 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
     return GetNextResult::makeEOF();
 }
 
+bool DocumentSourceUnionWith::dispatchSubPipeline() {
+    auto serializedPipe = _pipeline->serializeToBson();
+    logStartingSubPipeline(serializedPipe);
+    // $$SEARCH_META can be set during runtime earlier in the pipeline, and therefore must be
+    // copied to the subpipeline manually.
+    if (pExpCtx->variables.hasConstantValue(Variables::kSearchMetaId)) {
+        _pipeline->getContext()->variables.setReservedValue(
+            Variables::kSearchMetaId,
+            pExpCtx->variables.getValue(Variables::kSearchMetaId, Document()),
+            true);
+    }
+    try {
+        _pipeline =
+            pExpCtx->mongoProcessInterface->attachCursorSourceToPipeline(_pipeline.release());
+        _subPipelineDispatched = true;
+        return true;
+    } catch (const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e) {
+        _pipeline = buildPipelineFromViewDefinition(
+            pExpCtx,
+            ExpressionContext::ResolvedNamespace{e->getNamespace(), e->getPipeline()},
+            serializedPipe);
+        logShardedViewFound(e);
+        return false;
+    }
+}
+
 // The use of these logging macros is done in separate NOINLINE functions to reduce the stack space
 // used on the hot getNext() path. This is done to avoid stack overflows.
 MONGO_COMPILER_NOINLINE void DocumentSourceUnionWith::logStartingSubPipeline(
@@ -342,8 +361,9 @@ Value DocumentSourceUnionWith::serialize(boost::optional<ExplainOptions::Verbosi
         if (*explain == ExplainOptions::Verbosity::kQueryPlanner) {
             pipeCopy = Pipeline::create(_pipeline->getSources(), _pipeline->getContext()).release();
         } else if (*explain >= ExplainOptions::Verbosity::kExecStats &&
-                   _executionState > ExecutionProgress::kIteratingSource) {
-            // We've either exhausted the sub-pipeline or at least started iterating it. Use the
+                   (_executionState > ExecutionProgress::kIteratingSource ||
+                    _subPipelineDispatched)) {
+            // We've either dispatched the sub-pipeline or at least started iterating it. Use the
             // cached pipeline to get the explain output since the '_pipeline' may have been
             // modified for any optimizations or pushdowns into the initial $cursor stage.
             pipeCopy = Pipeline::create(_cachedPipeline, _pipeline->getContext()).release();
@@ -181,6 +181,13 @@ private:
 
     void addViewDefinition(NamespaceString nss, std::vector<BSONObj> viewPipeline);
 
+    /**
+     * Attaches a cursor source to '_pipeline', dispatching it for execution. Returns true on
+     * success. Returns false if a sharded view was encountered, in which case '_pipeline' has been
+     * rebuilt against the view definition and the caller should try again.
+     */
+    bool dispatchSubPipeline();
+
     void logStartingSubPipeline(const std::vector<BSONObj>& serializedPipeline);
     void logShardedViewFound(
         const ExceptionFor<ErrorCodes::CommandOnShardedViewNotSupportedOnMongod>& e);
@@ -188,6 +195,11 @@ private:
     std::unique_ptr<Pipeline, PipelineDeleter> _pipeline;
     Pipeline::SourceContainer _cachedPipeline;
     ExecutionProgress _executionState = ExecutionProgress::kIteratingSource;
+
+    // Whether '_pipeline' has had a cursor source attached. This may happen before we finish
+    // iterating 'pSource' when eager remote dispatch is enabled.
+    bool _subPipelineDispatched = false;
+
     UnionWithStats _stats;
 };
 
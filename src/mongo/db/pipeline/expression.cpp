@@ -1040,6 +1040,26 @@ boost::intrusive_ptr<Expression> ExpressionCond::optimize() {
         return ifOperand->getValue().coerceToBool() ? _children[1] : _children[2];
     }
 
+    // A $cond whose else branch is another conditional is equivalent to a single $switch over the
+    // flattened branch list. A $switch evaluates its branches in a loop, so a deeply nested else
+    // chain no longer pays a virtual evaluate() round trip per nesting level. The children were
+    // optimized above, so conditionals further down the else chain have already been collapsed
+    // and the else branch here is at most one $cond followed by a $switch.
+    if (dynamic_cast<ExpressionCond*>(_children[2].get()) ||
+        dynamic_cast<ExpressionSwitch*>(_children[2].get())) {
+        std::vector<boost::intrusive_ptr<Expression>> children;
+        children.push_back(_children[0]);
+        children.push_back(_children[1]);
+        boost::intrusive_ptr<Expression> defaultExpr = _children[2];
+        while (auto* elseCond = dynamic_cast<ExpressionCond*>(defaultExpr.get())) {
+            children.push_back(elseCond->_children[0]);
+            children.push_back(elseCond->_children[1]);
+            defaultExpr = elseCond->_children[2];
+        }
+        return ExpressionSwitch::create(
+            getExpressionContext(), std::move(children), std::move(defaultExpr));
+    }
+
     return this;
 }
 
@@ -2168,6 +2188,116 @@ const char* ExpressionDivide::getOpName() const {
     return "$divide";
 }
 
+/* ----------------------- Array distance measures ------------------ */
+
+namespace {
+/**
+ * Coerces the operands of an array distance expression to two equal-length vectors of doubles.
+ * Materializing into contiguous buffers up front lets the arithmetic below run as tight loops
+ * over doubles that the compiler can vectorize, rather than per-element Value dispatch.
+ */
+std::pair<std::vector<double>, std::vector<double>> extractNumericVectorPair(const char* opName,
+                                                                             const Value& lhs,
+                                                                             const Value& rhs) {
+    uassert(6929911,
+            str::stream() << opName << " requires array operands, but found "
+                          << typeName(lhs.getType()),
+            lhs.isArray());
+    uassert(6929912,
+            str::stream() << opName << " requires array operands, but found "
+                          << typeName(rhs.getType()),
+            rhs.isArray());
+    uassert(6929913,
+            str::stream() << opName << " requires arrays of the same length, but found lengths "
+                          << lhs.getArrayLength() << " and " << rhs.getArrayLength(),
+            lhs.getArrayLength() == rhs.getArrayLength());
+
+    auto extract = [&](const Value& operand) {
+        std::vector<double> vec;
+        vec.reserve(operand.getArrayLength());
+        for (const auto& element : operand.getArray()) {
+            uassert(6929914,
+                    str::stream() << opName << " requires arrays of numbers, but found "
+                                  << typeName(element.getType()),
+                    element.numeric());
+            vec.push_back(element.coerceToDouble());
+        }
+        return vec;
+    };
+    return {extract(lhs), extract(rhs)};
+}
+}  // namespace
+
+Value ExpressionDotProduct::evaluate(const Document& root, Variables* variables) const {
+    Value lhs = _children[0]->evaluate(root, variables);
+    Value rhs = _children[1]->evaluate(root, variables);
+    if (lhs.nullish() || rhs.nullish()) {
+        return Value(BSONNULL);
+    }
+
+    auto [a, b] = extractNumericVectorPair(getOpName(), lhs, rhs);
+    double dot = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        dot += a[i] * b[i];
+    }
+    return Value(dot);
+}
+
+REGISTER_STABLE_EXPRESSION(dotProduct, ExpressionDotProduct::parse);
+const char* ExpressionDotProduct::getOpName() const {
+    return "$dotProduct";
+}
+
+Value ExpressionEuclideanDistance::evaluate(const Document& root, Variables* variables) const {
+    Value lhs = _children[0]->evaluate(root, variables);
+    Value rhs = _children[1]->evaluate(root, variables);
+    if (lhs.nullish() || rhs.nullish()) {
+        return Value(BSONNULL);
+    }
+
+    auto [a, b] = extractNumericVectorPair(getOpName(), lhs, rhs);
+    double distSquared = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        auto diff = a[i] - b[i];
+        distSquared += diff * diff;
+    }
+    return Value(sqrt(distSquared));
+}
+
+REGISTER_STABLE_EXPRESSION(euclideanDistance, ExpressionEuclideanDistance::parse);
+const char* ExpressionEuclideanDistance::getOpName() const {
+    return "$euclideanDistance";
+}
+
+Value ExpressionCosineSimilarity::evaluate(const Document& root, Variables* variables) const {
+    Value lhs = _children[0]->evaluate(root, variables);
+    Value rhs = _children[1]->evaluate(root, variables);
+    if (lhs.nullish() || rhs.nullish()) {
+        return Value(BSONNULL);
+    }
+
+    auto [a, b] = extractNumericVectorPair(getOpName(), lhs, rhs);
+    double dot = 0.0;
+    double lhsNormSquared = 0.0;
+    double rhsNormSquared = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        dot += a[i] * b[i];
+        lhsNormSquared += a[i] * a[i];
+        rhsNormSquared += b[i] * b[i];
+    }
+
+    // The cosine of the angle to a zero-length vector is undefined.
+    if (lhsNormSquared == 0.0 || rhsNormSquared == 0.0) {
+        return Value(BSONNULL);
+    }
+    return Value(dot / (sqrt(lhsNormSquared) * sqrt(rhsNormSquared)));
+}
+
+REGISTER_STABLE_EXPRESSION(cosineSimilarity, ExpressionCosineSimilarity::parse);
+const char* ExpressionCosineSimilarity::getOpName() const {
+    return "$cosineSimilarity";
+}
+
 /* ----------------------- ExpressionExp ---------------------------- */
 
 Value ExpressionExp::evaluateNumericArg(const Value& numericArg) const {
@@ -5505,6 +5635,31 @@ boost::intrusive_ptr<Expression> ExpressionSwitch::parse(ExpressionContext* cons
     return new ExpressionSwitch(expCtx, std::move(children), std::move(branches));
 }
 
+boost::intrusive_ptr<Expression> ExpressionSwitch::create(
+    ExpressionContext* const expCtx,
+    std::vector<boost::intrusive_ptr<Expression>> children,
+    boost::intrusive_ptr<Expression> defaultExpr) {
+    invariant(!children.empty());
+    invariant(children.size() % 2 == 0);
+
+    if (auto* defaultSwitch = dynamic_cast<ExpressionSwitch*>(defaultExpr.get())) {
+        for (auto&& branch : defaultSwitch->_branches) {
+            children.push_back(branch.first);
+            children.push_back(branch.second);
+        }
+        children.push_back(defaultSwitch->_default);
+    } else {
+        children.push_back(std::move(defaultExpr));
+    }
+
+    std::vector<ExpressionPair> branches;
+    for (size_t i = 0; i + 1 < children.size(); i += 2) {
+        branches.emplace_back(children[i], children[i + 1]);
+    }
+
+    return new ExpressionSwitch(expCtx, std::move(children), std::move(branches));
+}
+
 void ExpressionSwitch::_doAddDependencies(DepsTracker* deps) const {
     for (auto&& branch : _branches) {
         branch.first->addDependencies(deps);
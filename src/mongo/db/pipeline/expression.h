@@ -1710,6 +1710,74 @@ public:
 };
 
 
+/**
+ * $dotProduct, $euclideanDistance and $cosineSimilarity compute a scalar distance measure over two
+ * equal-length arrays of numbers, e.g. vector embeddings. They return BSONNULL if either argument
+ * is nullish, fail if either argument is not an array, if the arrays differ in length or if any
+ * element is non-numeric, and compute in double precision.
+ */
+class ExpressionDotProduct final : public ExpressionFixedArity<ExpressionDotProduct, 2> {
+public:
+    explicit ExpressionDotProduct(ExpressionContext* const expCtx)
+        : ExpressionFixedArity<ExpressionDotProduct, 2>(expCtx) {}
+    ExpressionDotProduct(ExpressionContext* const expCtx, ExpressionVector&& children)
+        : ExpressionFixedArity<ExpressionDotProduct, 2>(expCtx, std::move(children)) {}
+
+    Value evaluate(const Document& root, Variables* variables) const final;
+    const char* getOpName() const final;
+
+    void acceptVisitor(ExpressionMutableVisitor* visitor) final {
+        return visitor->visit(this);
+    }
+
+    void acceptVisitor(ExpressionConstVisitor* visitor) const final {
+        return visitor->visit(this);
+    }
+};
+
+class ExpressionEuclideanDistance final
+    : public ExpressionFixedArity<ExpressionEuclideanDistance, 2> {
+public:
+    explicit ExpressionEuclideanDistance(ExpressionContext* const expCtx)
+        : ExpressionFixedArity<ExpressionEuclideanDistance, 2>(expCtx) {}
+    ExpressionEuclideanDistance(ExpressionContext* const expCtx, ExpressionVector&& children)
+        : ExpressionFixedArity<ExpressionEuclideanDistance, 2>(expCtx, std::move(children)) {}
+
+    Value evaluate(const Document& root, Variables* variables) const final;
+    const char* getOpName() const final;
+
+    void acceptVisitor(ExpressionMutableVisitor* visitor) final {
+        return visitor->visit(this);
+    }
+
+    void acceptVisitor(ExpressionConstVisitor* visitor) const final {
+        return visitor->visit(this);
+    }
+};
+
+/**
+ * Returns BSONNULL for zero-length vectors, for which the measure is undefined.
+ */
+class ExpressionCosineSimilarity final
+    : public ExpressionFixedArity<ExpressionCosineSimilarity, 2> {
+public:
+    explicit ExpressionCosineSimilarity(ExpressionContext* const expCtx)
+        : ExpressionFixedArity<ExpressionCosineSimilarity, 2>(expCtx) {}
+    ExpressionCosineSimilarity(ExpressionContext* const expCtx, ExpressionVector&& children)
+        : ExpressionFixedArity<ExpressionCosineSimilarity, 2>(expCtx, std::move(children)) {}
+
+    Value evaluate(const Document& root, Variables* variables) const final;
+    const char* getOpName() const final;
+
+    void acceptVisitor(ExpressionMutableVisitor* visitor) final {
+        return visitor->visit(this);
+    }
+
+    void acceptVisitor(ExpressionConstVisitor* visitor) const final {
+        return visitor->visit(this);
+    }
+};
+
 class ExpressionExp final : public ExpressionSingleNumericArg<ExpressionExp> {
 public:
     explicit ExpressionExp(ExpressionContext* const expCtx)
@@ -3205,6 +3273,18 @@ public:
     static boost::intrusive_ptr<Expression> parse(ExpressionContext* expCtx,
                                                   BSONElement expr,
                                                   const VariablesParseState& vpsIn);
+
+    /**
+     * Creates a $switch from 'children', which must hold an even, non-zero number of expressions
+     * interpreted as consecutive case/then pairs, and 'defaultExpr', which may be null to create a
+     * $switch without a default. If 'defaultExpr' is itself a $switch, its branches and default
+     * are spliced onto the end of the new branch list rather than kept as a nested expression.
+     */
+    static boost::intrusive_ptr<Expression> create(
+        ExpressionContext* expCtx,
+        std::vector<boost::intrusive_ptr<Expression>> children,
+        boost::intrusive_ptr<Expression> defaultExpr);
+
     Value serialize(bool explain) const final;
 
     void acceptVisitor(ExpressionMutableVisitor* visitor) final {
@@ -205,6 +205,68 @@ TEST(ExpressionArrayToObjectTest, ListFormWithDuplicates) {
                             Value(BSON("key1" << 3))}});
 }
 
+/* --------------------- Array distance measures ---------------------- */
+
+TEST(ExpressionDotProductTest, ComputesDotProduct) {
+    assertExpectedResults("$dotProduct",
+                          {{{Value(BSON_ARRAY(1.0 << 2.0 << 3.0)), Value(BSON_ARRAY(4 << -5 << 6))},
+                            Value(12.0)},
+                           {{Value(BSONArray()), Value(BSONArray())}, Value(0.0)}});
+}
+
+TEST(ExpressionDotProductTest, ReturnsNullWithNullishInput) {
+    assertExpectedResults("$dotProduct",
+                          {{{Value(BSONNULL), Value(BSON_ARRAY(1 << 2))}, Value(BSONNULL)},
+                           {{Value(BSON_ARRAY(1 << 2)), Value(BSONUndefined)}, Value(BSONNULL)}});
+}
+
+TEST(ExpressionDotProductTest, FailsOnInvalidInput) {
+    ASSERT_THROWS_CODE(
+        evaluateExpression("$dotProduct", {Value(1), Value(BSON_ARRAY(1 << 2))}),
+        AssertionException,
+        6929911);
+    ASSERT_THROWS_CODE(
+        evaluateExpression("$dotProduct", {Value(BSON_ARRAY(1 << 2)), Value("foo"_sd)}),
+        AssertionException,
+        6929912);
+    ASSERT_THROWS_CODE(
+        evaluateExpression("$dotProduct", {Value(BSON_ARRAY(1 << 2)), Value(BSON_ARRAY(1))}),
+        AssertionException,
+        6929913);
+    ASSERT_THROWS_CODE(
+        evaluateExpression("$dotProduct",
+                           {Value(BSON_ARRAY(1 << "foo")), Value(BSON_ARRAY(1 << 2))}),
+        AssertionException,
+        6929914);
+}
+
+TEST(ExpressionEuclideanDistanceTest, ComputesEuclideanDistance) {
+    assertExpectedResults(
+        "$euclideanDistance",
+        {{{Value(BSON_ARRAY(0 << 0)), Value(BSON_ARRAY(3.0 << 4.0))}, Value(5.0)},
+         {{Value(BSON_ARRAY(1 << 2LL << 3.0)), Value(BSON_ARRAY(1.0 << 2.0 << 3.0))},
+          Value(0.0)}});
+}
+
+TEST(ExpressionEuclideanDistanceTest, ReturnsNullWithNullishInput) {
+    assertExpectedResults("$euclideanDistance",
+                          {{{Value(BSONNULL), Value(BSON_ARRAY(1 << 2))}, Value(BSONNULL)}});
+}
+
+TEST(ExpressionCosineSimilarityTest, ComputesCosineSimilarity) {
+    assertExpectedResults(
+        "$cosineSimilarity",
+        {{{Value(BSON_ARRAY(1.0 << 2.0)), Value(BSON_ARRAY(2.0 << 4.0))}, Value(1.0)},
+         {{Value(BSON_ARRAY(1.0 << 0.0)), Value(BSON_ARRAY(0.0 << 1.0))}, Value(0.0)},
+         {{Value(BSON_ARRAY(1.0 << 2.0)), Value(BSON_ARRAY(-1.0 << -2.0))}, Value(-1.0)}});
+}
+
+TEST(ExpressionCosineSimilarityTest, ReturnsNullForZeroNormVector) {
+    assertExpectedResults(
+        "$cosineSimilarity",
+        {{{Value(BSON_ARRAY(0.0 << 0.0)), Value(BSON_ARRAY(1.0 << 2.0))}, Value(BSONNULL)}});
+}
+
 /* ------------------------ ExpressionRange --------------------------- */
 
 TEST(ExpressionRangeTest, ComputesStandardRange) {
@@ -1232,6 +1294,65 @@ TEST(ExpressionSwitch, ExpressionSwitchWithNoConstantsShouldStayTheSame) {
     ASSERT_BSONOBJ_BINARY_EQ(switchQ, expressionToBson(optimizedStaySame));
 }
 
+TEST(ExpressionCond, ExpressionCondWithNonConditionalElseShouldStayCond) {
+    auto expCtx = ExpressionContextForTest{};
+    VariablesParseState vps = expCtx.variablesParseState;
+
+    BSONObj condQ = fromjson("{$cond: {if: \"$x\", then: 1, else: 2}}");
+    auto condExp = ExpressionCond::parse(&expCtx, condQ.firstElement(), vps);
+    auto optimizedStaySame = condExp->optimize();
+
+    BSONObj condOptResult = fromjson("{$cond: [\"$x\", {$const: 1}, {$const: 2}]}");
+    ASSERT_BSONOBJ_BINARY_EQ(condOptResult, expressionToBson(optimizedStaySame));
+}
+
+TEST(ExpressionCond, NestedCondElseChainShouldOptimizeToSingleSwitch) {
+    auto expCtx = ExpressionContextForTest{};
+    VariablesParseState vps = expCtx.variablesParseState;
+
+    BSONObj condQ = fromjson(
+        "{$cond: {if: \"$x\", then: 1, else: {$cond: {if: \"$y\", then: 2, else: {$cond: {if: "
+        "\"$z\", then: 3, else: 4}}}}}}");
+    auto condExp = ExpressionCond::parse(&expCtx, condQ.firstElement(), vps);
+    auto optimizedToSwitch = condExp->optimize();
+
+    BSONObj condOptResult = fromjson(
+        "{$switch: {branches: [{case: \"$x\", then: {$const: 1}}, {case: \"$y\", then: {$const: "
+        "2}}, {case: \"$z\", then: {$const: 3}}], default: {$const: 4}}}");
+    ASSERT_BSONOBJ_BINARY_EQ(condOptResult, expressionToBson(optimizedToSwitch));
+}
+
+TEST(ExpressionCond, CondWithSwitchElseShouldMergeIntoSingleSwitch) {
+    auto expCtx = ExpressionContextForTest{};
+    VariablesParseState vps = expCtx.variablesParseState;
+
+    BSONObj condQ = fromjson(
+        "{$cond: {if: \"$a\", then: 1, else: {$switch: {branches: [{case: \"$b\", then: 2}], "
+        "default: 3}}}}");
+    auto condExp = ExpressionCond::parse(&expCtx, condQ.firstElement(), vps);
+    auto optimizedToSwitch = condExp->optimize();
+
+    BSONObj condOptResult = fromjson(
+        "{$switch: {branches: [{case: \"$a\", then: {$const: 1}}, {case: \"$b\", then: {$const: "
+        "2}}], default: {$const: 3}}}");
+    ASSERT_BSONOBJ_BINARY_EQ(condOptResult, expressionToBson(optimizedToSwitch));
+}
+
+TEST(ExpressionCond, CondWithSwitchElseWithoutDefaultShouldMergeIntoSingleSwitch) {
+    auto expCtx = ExpressionContextForTest{};
+    VariablesParseState vps = expCtx.variablesParseState;
+
+    BSONObj condQ = fromjson(
+        "{$cond: {if: \"$a\", then: 1, else: {$switch: {branches: [{case: \"$b\", then: 2}]}}}}");
+    auto condExp = ExpressionCond::parse(&expCtx, condQ.firstElement(), vps);
+    auto optimizedToSwitch = condExp->optimize();
+
+    BSONObj condOptResult = fromjson(
+        "{$switch: {branches: [{case: \"$a\", then: {$const: 1}}, {case: \"$b\", then: {$const: "
+        "2}}]}}");
+    ASSERT_BSONOBJ_BINARY_EQ(condOptResult, expressionToBson(optimizedToSwitch));
+}
+
 TEST(ExpressionArray, ExpressionArrayShouldOptimizeSubExpressionToExpressionConstant) {
     auto expCtx = ExpressionContextForTest{};
     VariablesParseState vps = expCtx.variablesParseState;
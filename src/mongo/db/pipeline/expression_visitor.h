@@ -66,6 +66,9 @@ class ExpressionDayOfMonth;
 class ExpressionDayOfWeek;
 class ExpressionDayOfYear;
 class ExpressionDivide;
+class ExpressionDotProduct;
+class ExpressionEuclideanDistance;
+class ExpressionCosineSimilarity;
 class ExpressionExp;
 class ExpressionFieldPath;
 class ExpressionFilter;
@@ -230,6 +233,9 @@ public:
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionDateToString>) = 0;
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionDateTrunc>) = 0;
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionDivide>) = 0;
+    virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionDotProduct>) = 0;
+    virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionEuclideanDistance>) = 0;
+    virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionCosineSimilarity>) = 0;
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionExp>) = 0;
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionFieldPath>) = 0;
     virtual void visit(expression_walker::MaybeConstPtr<IsConst, ExpressionFilter>) = 0;
@@ -407,6 +413,9 @@ struct SelectiveConstExpressionVisitorBase : public ExpressionConstVisitor {
     void visit(const ExpressionDateToString*) override {}
     void visit(const ExpressionDateTrunc*) override {}
     void visit(const ExpressionDivide*) override {}
+    void visit(const ExpressionDotProduct*) override {}
+    void visit(const ExpressionEuclideanDistance*) override {}
+    void visit(const ExpressionCosineSimilarity*) override {}
     void visit(const ExpressionExp*) override {}
     void visit(const ExpressionFieldPath*) override {}
     void visit(const ExpressionFilter*) override {}
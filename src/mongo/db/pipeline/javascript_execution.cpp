@@ -34,14 +34,52 @@
 #include <iostream>
 
 #include "mongo/base/status_with.h"
+#include "mongo/bson/simple_bsonobj_comparator.h"
+#include "mongo/db/auth/authorization_session.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
 
 namespace {
 const auto getExec = OperationContext::declareDecoration<std::unique_ptr<JsExecution>>();
+
+std::string getAuthenticatedUserNamesToken(Client* client) {
+    StringBuilder sb;
+
+    auto as = AuthorizationSession::get(client);
+    for (auto nameIter = as->getAuthenticatedUserNames(); nameIter.more(); nameIter.next()) {
+        // Using a NUL byte which isn't valid in usernames to separate them.
+        if (const auto& tenant = nameIter->getTenant()) {
+            sb << '\0' << tenant->toString();
+        }
+        sb << '\0' << nameIter->getUnambiguousName();
+    }
+
+    return sb.str();
+}
 }  // namespace
 
+JsExecution::JsExecution(OperationContext* opCtx,
+                         const BSONObj& scopeVars,
+                         StringData database,
+                         bool loadStoredProcedures,
+                         boost::optional<int> jsHeapLimitMB) {
+    _scopeVars = scopeVars.getOwned();
+
+    // The scope may be handed back to a later operation on this thread, and globals it has
+    // accumulated survive reuse. The pool id therefore has to isolate authenticated users from
+    // one another and separate distinct sets of scope variables and stored-procedure loading, so
+    // that state set up for one flavor of execution never leaks into another.
+    const std::string scopeToken = str::stream()
+        << "aggregation" << getAuthenticatedUserNamesToken(opCtx->getClient()) << '_'
+        << SimpleBSONObjComparator::kInstance.hash(_scopeVars) << '_' << loadStoredProcedures;
+
+    _scope = getGlobalScriptEngine()->getPooledScopeForCurrentThread(
+        opCtx, database.toString(), scopeToken, jsHeapLimitMB);
+    _scope->init(&_scopeVars);
+    _fnCallTimeoutMillis = internalQueryJavaScriptFnTimeoutMillis.load();
+}
+
 JsExecution* JsExecution::get(OperationContext* opCtx,
                               const BSONObj& scope,
                               StringData database,
@@ -49,8 +87,8 @@ JsExecution* JsExecution::get(OperationContext* opCtx,
                               boost::optional<int> jsHeapLimitMB) {
     auto& exec = getExec(opCtx);
     if (!exec) {
-        exec = std::make_unique<JsExecution>(opCtx, scope, jsHeapLimitMB);
-        exec->getScope()->setLocalDB(database);
+        exec = std::make_unique<JsExecution>(
+            opCtx, scope, database, loadStoredProcedures, jsHeapLimitMB);
         if (loadStoredProcedures) {
             exec->getScope()->loadStored(opCtx, true);
         }
@@ -59,17 +59,14 @@ public:
                             bool loadStoredProcedures,
                             boost::optional<int> jsHeapLimitMB);
     /**
-     * Construct with a thread-local scope and initialize with the given scope variables.
+     * Construct with a scope cached on the current thread, or a newly created thread-local scope
+     * if there is no reusable one, and initialize it with the given scope variables.
      */
     JsExecution(OperationContext* opCtx,
                 const BSONObj& scopeVars,
-                boost::optional<int> jsHeapLimitMB = boost::none)
-        : _scope(getGlobalScriptEngine()->newScopeForCurrentThread(jsHeapLimitMB)) {
-        _scopeVars = scopeVars.getOwned();
-        _scope->init(&_scopeVars);
-        _fnCallTimeoutMillis = internalQueryJavaScriptFnTimeoutMillis.load();
-        _scope->registerOperation(opCtx);
-    }
+                StringData database,
+                bool loadStoredProcedures,
+                boost::optional<int> jsHeapLimitMB = boost::none);
 
     ~JsExecution() {
         _scope->unregisterOperation();
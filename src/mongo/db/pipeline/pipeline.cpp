@@ -41,6 +41,8 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
+#include "mongo/db/pipeline/document_source_internal_parallel_transform.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_out.h"
@@ -277,6 +279,16 @@ void Pipeline::optimizeContainer(SourceContainer* container) {
             }
         }
         container->swap(optimizedSources);
+
+        // All reordering and absorption is complete; optionally parallelize or fuse runs of
+        // consecutive streaming per-document stages into single execution-only stages. The two
+        // passes target the same runs, so parallelization takes precedence.
+        if (auto workers = internalQueryParallelTransformWorkers.load(); workers >= 2) {
+            DocumentSourceInternalParallelTransform::parallelizeEligibleStages(
+                container, static_cast<size_t>(workers));
+        } else if (internalQueryEnablePipelineStageFusion.load()) {
+            DocumentSourceInternalFusedTransformation::fuseEligibleStages(container);
+        }
     } catch (DBException& ex) {
         ex.addContext("Failed to optimize pipeline");
         throw;
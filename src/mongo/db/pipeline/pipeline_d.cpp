@@ -59,6 +59,7 @@
 #include "mongo/db/ops/write_ops_exec.h"
 #include "mongo/db/ops/write_ops_gen.h"
 #include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_bucket_auto.h"
 #include "mongo/db/pipeline/document_source_change_stream.h"
 #include "mongo/db/pipeline/document_source_cursor.h"
 #include "mongo/db/pipeline/document_source_geo_near.h"
@@ -71,6 +72,7 @@
 #include "mongo/db/pipeline/document_source_sample_from_random_cursor.h"
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_sort.h"
+#include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/inner_pipeline_stage_impl.h"
 #include "mongo/db/pipeline/pipeline.h"
 #include "mongo/db/pipeline/skip_and_limit.h"
@@ -79,6 +81,7 @@
 #include "mongo/db/query/plan_executor_factory.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/query_feature_flags_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/s/collection_sharding_state.h"
@@ -202,7 +205,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> attemptToGetExe
     const QueryMetadataBitSet& metadataRequested,
     BSONObj sortObj,
     SkipThenLimit skipThenLimit,
-    boost::optional<std::string> groupIdForDistinctScan,
+    boost::optional<std::vector<std::string>> groupFieldsForDistinctScan,
     const AggregateCommandRequest* aggRequest,
     const size_t plannerOpts,
     const MatchExpressionParser::AllowedFeatureSet& matcherFeatures,
@@ -257,13 +260,14 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> attemptToGetExe
     // Mark the metadata that's requested by the pipeline on the CQ.
     cq.getValue()->requestAdditionalMetadata(metadataRequested);
 
-    if (groupIdForDistinctScan) {
-        // When the pipeline includes a $group that groups by a single field
-        // (groupIdForDistinctScan), we use getExecutorDistinct() to attempt to get an executor that
-        // uses a DISTINCT_SCAN to scan exactly one document for each group. When that's not
+    if (groupFieldsForDistinctScan) {
+        // When the pipeline includes a $group that groups by one or more field paths
+        // (groupFieldsForDistinctScan), we use getExecutorDistinct() to attempt to get an executor
+        // that uses a DISTINCT_SCAN to scan exactly one document for each group. When that's not
         // possible, we return nullptr, and the caller is responsible for trying again without
-        // passing a 'groupIdForDistinctScan' value.
-        ParsedDistinct parsedDistinct(std::move(cq.getValue()), *groupIdForDistinctScan);
+        // passing a 'groupFieldsForDistinctScan' value.
+        ParsedDistinct parsedDistinct(std::move(cq.getValue()),
+                                      std::move(*groupFieldsForDistinctScan));
 
         // Note that we request a "strict" distinct plan because:
         // 1) We do not want to have to de-duplicate the results of the plan.
@@ -841,6 +845,106 @@ auto buildProjectionForPushdown(const DepsTracker& deps,
         return BSONObj();
     return deps.toProjectionWithoutMetadata();
 }
+/**
+ * Attempts to seed an initial $bucketAuto stage with approximate bucket boundaries estimated from
+ * a random sample of the collection, allowing the stage to aggregate in a single streaming pass
+ * instead of sorting its entire input. This is only legal when the stage heads the pipeline with
+ * no initial query, since the sample must be drawn from the same distribution the stage will see.
+ *
+ * The optimization is off by default; it trades exactly even bucket sizes for the streaming pass,
+ * and applies only when 'internalQueryBucketAutoBoundariesSampleSize' is nonzero, the stage does
+ * not use 'granularity', the groupBy expression is a simple field path backed by a non-sparse,
+ * non-partial index (so the sampled field is cheap to produce and plausibly selective), and the
+ * collection is large enough for the sample to be representative.
+ */
+void trySeedBucketAutoBoundaries(const intrusive_ptr<ExpressionContext>& expCtx,
+                                 const CollectionPtr& collection,
+                                 DocumentSourceBucketAuto* bucketAutoStage) {
+    const long long sampleSize = internalQueryBucketAutoBoundariesSampleSize.load();
+    if (sampleSize <= 0 || !collection) {
+        return;
+    }
+
+    const int nBuckets = bucketAutoStage->getNumBuckets();
+    if (bucketAutoStage->usesGranularity() || nBuckets < 2) {
+        return;
+    }
+
+    auto opCtx = expCtx->opCtx;
+
+    // Require the collection to dwarf the sample so that sampling is meaningfully cheaper than
+    // the full sort and the sampled quantiles approximate the true ones.
+    if (collection->numRecords(opCtx) < 10 * sampleSize) {
+        return;
+    }
+
+    const auto* fieldPathExpr =
+        dynamic_cast<const ExpressionFieldPath*>(bucketAutoStage->getGroupByExpression().get());
+    if (!fieldPathExpr || fieldPathExpr->isROOT() || fieldPathExpr->isVariableReference()) {
+        return;
+    }
+    const auto groupByPath = fieldPathExpr->getFieldPathWithoutCurrentPrefix().fullPath();
+
+    // Only proceed when a suitable index covers the grouped field. The sample itself is drawn
+    // from the record store (this storage API has no random cursor over an index), but an index
+    // whose leading field is the groupBy path is a strong signal that the field is present on
+    // most documents, which keeps the sampled boundaries honest.
+    bool hasIndexOnGroupByField = false;
+    auto indexIterator = collection->getIndexCatalog()->getIndexIterator(
+        opCtx, false /* includeUnfinishedIndexes */);
+    while (indexIterator->more()) {
+        const auto* descriptor = indexIterator->next()->descriptor();
+        if (!descriptor->isSparse() && !descriptor->isPartial() &&
+            descriptor->keyPattern().firstElementFieldNameStringData() == groupByPath) {
+            hasIndexOnGroupByField = true;
+            break;
+        }
+    }
+    if (!hasIndexOnGroupByField) {
+        return;
+    }
+
+    auto randomCursor = collection->getRecordStore()->getRandomCursor(opCtx);
+    if (!randomCursor) {
+        return;
+    }
+
+    std::vector<Value> sampledKeys;
+    sampledKeys.reserve(sampleSize);
+    for (long long i = 0; i < sampleSize; ++i) {
+        auto record = randomCursor->next();
+        if (!record) {
+            break;
+        }
+        Document doc(record->data.toBson().getOwned());
+        Value key = fieldPathExpr->evaluate(doc, &expCtx->variables);
+        sampledKeys.push_back(key.missing() ? Value(BSONNULL) : std::move(key));
+    }
+
+    // Demand several sampled keys per bucket, or the estimated quantiles would be noise.
+    if (sampledKeys.size() < static_cast<size_t>(nBuckets) * 10) {
+        return;
+    }
+
+    const auto& valueCmp = expCtx->getValueComparator();
+    std::sort(sampledKeys.begin(), sampledKeys.end(), valueCmp.getLessThan());
+
+    // Take the sampled quantiles as cut points, deduplicated so they are strictly ascending.
+    // Heavily repeated keys can collapse the list; an empty list means no usable boundaries.
+    std::vector<Value> boundaries;
+    for (int i = 1; i < nBuckets; ++i) {
+        Value candidate = sampledKeys[sampledKeys.size() * i / nBuckets];
+        if (boundaries.empty() || valueCmp.compare(boundaries.back(), candidate) < 0) {
+            boundaries.push_back(std::move(candidate));
+        }
+    }
+    if (boundaries.empty()) {
+        return;
+    }
+
+    bucketAutoStage->setApproximateBoundaries(std::move(boundaries));
+}
+
 }  // namespace
 
 std::pair<PipelineD::AttachExecutorCallback, std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>>
@@ -871,6 +975,15 @@ PipelineD::buildInnerQueryExecutorGeneric(const MultipleCollectionAccessor& coll
         }
     }
 
+    // If an eligible $bucketAuto heads the pipeline, try to seed it with approximate bucket
+    // boundaries estimated from a random sample so it can aggregate in a single streaming pass.
+    if (queryObj.isEmpty() && !sources.empty()) {
+        if (auto* bucketAutoStage =
+                dynamic_cast<DocumentSourceBucketAuto*>(sources.front().get())) {
+            trySeedBucketAutoBoundaries(expCtx, collections.getMainCollection(), bucketAutoStage);
+        }
+    }
+
     auto&& [sortStage, groupStage] = getSortAndGroupStagesFromPipeline(pipeline->_sources);
     std::unique_ptr<GroupFromFirstDocumentTransformation> rewrittenGroupStage;
     if (groupStage) {
@@ -1098,7 +1211,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::prep
                                                       deps.metadataDeps(),
                                                       sortObj,
                                                       SkipThenLimit{boost::none, boost::none},
-                                                      rewrittenGroupStage->groupId(),
+                                                      rewrittenGroupStage->groupIdFields(),
                                                       aggRequest,
                                                       plannerOpts,
                                                       matcherFeatures,
@@ -1147,7 +1260,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::prep
                                 deps.metadataDeps(),
                                 sortObj,
                                 skipThenLimit,
-                                boost::none, /* groupIdForDistinctScan */
+                                boost::none, /* groupFieldsForDistinctScan */
                                 aggRequest,
                                 plannerOpts,
                                 matcherFeatures,
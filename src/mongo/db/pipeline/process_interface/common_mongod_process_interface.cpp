@@ -43,6 +43,7 @@
 #include "mongo/db/catalog/drop_collection.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/catalog/list_indexes.h"
+#include "mongo/db/catalog/local_oplog_info.h"
 #include "mongo/db/catalog/rename_collection.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
@@ -337,6 +338,17 @@ boost::optional<BSONObj> CommonMongodProcessInterface::getCatalogEntry(
     return boost::none;
 }
 
+boost::optional<Timestamp> CommonMongodProcessInterface::getOplogResumeSkipPoint(
+    OperationContext* opCtx, const UUID& uuid, Timestamp fromTs) const {
+    Lock::GlobalLock globalLock{opCtx, MODE_IS};
+
+    const auto& oplog = LocalOplogInfo::get(opCtx)->getCollection();
+    if (!oplog) {
+        return boost::none;
+    }
+    return oplog->getRecordStore()->getOplogResumeSkipPoint(opCtx, uuid, fromTs);
+}
+
 void CommonMongodProcessInterface::appendLatencyStats(OperationContext* opCtx,
                                                       const NamespaceString& nss,
                                                       bool includeHistograms,
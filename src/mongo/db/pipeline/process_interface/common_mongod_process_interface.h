@@ -62,6 +62,10 @@ public:
     boost::optional<BSONObj> getCatalogEntry(OperationContext* opCtx,
                                              const NamespaceString& ns) const final;
 
+    boost::optional<Timestamp> getOplogResumeSkipPoint(OperationContext* opCtx,
+                                                       const UUID& uuid,
+                                                       Timestamp fromTs) const final;
+
     void appendLatencyStats(OperationContext* opCtx,
                             const NamespaceString& nss,
                             bool includeHistograms,
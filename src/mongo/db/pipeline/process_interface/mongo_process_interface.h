@@ -201,6 +201,18 @@ public:
     virtual boost::optional<BSONObj> getCatalogEntry(OperationContext* opCtx,
                                                      const NamespaceString& ns) const = 0;
 
+    /**
+     * On a mongod with an oplog, returns a timestamp at or after 'fromTs' from which a change
+     * stream on the collection identified by 'uuid' may begin scanning the oplog without missing
+     * any relevant event; see RecordStore::getOplogResumeSkipPoint(). Returns boost::none when no
+     * skip information is available, in which case the scan must begin at 'fromTs'.
+     */
+    virtual boost::optional<Timestamp> getOplogResumeSkipPoint(OperationContext* opCtx,
+                                                               const UUID& uuid,
+                                                               Timestamp fromTs) const {
+        return boost::none;
+    }
+
     /**
      * Appends operation latency statistics for collection "nss" to "builder"
      */
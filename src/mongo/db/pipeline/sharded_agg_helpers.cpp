@@ -780,10 +780,6 @@ std::unique_ptr<Pipeline, PipelineDeleter> runPipelineDirectlyOnSingleShard(
 
 boost::optional<ShardedExchangePolicy> checkIfEligibleForExchange(OperationContext* opCtx,
                                                                   const Pipeline* mergePipeline) {
-    if (internalQueryDisableExchange.load()) {
-        return boost::none;
-    }
-
     if (mergePipeline->getSources().empty()) {
         return boost::none;
     }
@@ -796,9 +792,24 @@ boost::optional<ShardedExchangePolicy> checkIfEligibleForExchange(OperationConte
         return boost::none;
     }
 
+    // From here on the pipeline could write in parallel, so when we have to fall back to a serial
+    // merge, say why: the difference is often the bulk of a large $merge job's wall time.
+    if (internalQueryDisableExchange.load()) {
+        LOGV2_DEBUG(6650022,
+                    1,
+                    "Not splitting $merge into parallel per-shard writers because exchange is "
+                    "disabled by internalQueryDisableExchange");
+        return boost::none;
+    }
+
     const auto cm =
         uassertStatusOK(getCollectionRoutingInfoForTxnCmd(opCtx, mergeStage->getOutputNs()));
     if (!cm.isSharded()) {
+        LOGV2_DEBUG(6650023,
+                    1,
+                    "Not splitting $merge into parallel per-shard writers because the output "
+                    "collection is not sharded",
+                    "outputNs"_attr = mergeStage->getOutputNs());
         return boost::none;
     }
 
@@ -810,7 +821,16 @@ boost::optional<ShardedExchangePolicy> checkIfEligibleForExchange(OperationConte
     // inserted on. With this ability we can insert an exchange on the shards to partition the
     // documents based on which shard will end up owning them. Then each shard can perform a merge
     // of only those documents which belong to it (optimistically, barring chunk migrations).
-    return walkPipelineBackwardsTrackingShardKey(opCtx, mergePipeline, cm);
+    auto policy = walkPipelineBackwardsTrackingShardKey(opCtx, mergePipeline, cm);
+    if (!policy) {
+        LOGV2_DEBUG(6650024,
+                    1,
+                    "Not splitting $merge into parallel per-shard writers because a stage in the "
+                    "merging pipeline modifies the output shard key or requires a single input "
+                    "stream",
+                    "outputNs"_attr = mergeStage->getOutputNs());
+    }
+    return policy;
 }
 
 SplitPipeline splitPipeline(std::unique_ptr<Pipeline, PipelineDeleter> pipeline) {
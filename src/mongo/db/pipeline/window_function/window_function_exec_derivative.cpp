@@ -32,7 +32,14 @@
 namespace mongo {
 
 Value WindowFunctionExecDerivative::getNext() {
-    auto endpoints = _iter.getEndpoints(_bounds);
+    auto endpoints = _iter.getEndpoints(_bounds, _lastEndpoints);
+    if (endpoints) {
+        // On the next call we will have advanced by 1 document, so the document we call '0' now
+        // will be called '-1' then.
+        _lastEndpoints = std::pair(endpoints->first - 1, endpoints->second - 1);
+    } else {
+        _lastEndpoints = boost::none;
+    }
     if (!endpoints)
         return kDefault;
 
@@ -73,13 +73,19 @@ public:
           }()) {}
 
     Value getNext() final;
-    void reset() final {}
+    void reset() final {
+        _lastEndpoints = boost::none;
+    }
 
 private:
     boost::intrusive_ptr<Expression> _position;
     boost::intrusive_ptr<Expression> _time;
     WindowBounds _bounds;
     boost::optional<long long> _unitMillis;
+
+    // The endpoints of the window for the previous document, passed to getEndpoints() as a hint
+    // so range-based bounds are resolved incrementally rather than by rescanning the window.
+    boost::optional<std::pair<int, int>> _lastEndpoints;
 };
 
 }  // namespace mongo
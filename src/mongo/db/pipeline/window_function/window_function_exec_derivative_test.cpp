@@ -50,10 +50,11 @@ public:
         const std::string& positionPath,
         const std::string& timePath,
         WindowBounds bounds,
-        boost::optional<TimeUnit> timeUnit = boost::none) {
+        boost::optional<TimeUnit> timeUnit = boost::none,
+        boost::optional<SortPattern> sortPattern = boost::none) {
         _docSource = DocumentSourceMock::createForTest(std::move(docs), getExpCtx());
         _iter = std::make_unique<PartitionIterator>(
-            getExpCtx().get(), _docSource.get(), &_tracker, boost::none, boost::none);
+            getExpCtx().get(), _docSource.get(), &_tracker, boost::none, std::move(sortPattern));
 
         auto position = ExpressionFieldPath::parse(
             getExpCtx().get(), positionPath, getExpCtx()->variablesParseState);
@@ -233,6 +234,33 @@ TEST_F(WindowFunctionExecDerivativeTest, Unbounded) {
     ASSERT_VALUE_EQ(Value(99.0 / 2), mgr.getNext());
 }
 
+TEST_F(WindowFunctionExecDerivativeTest, RangeBasedWindow) {
+    const auto docs = std::deque<DocumentSource::GetNextResult>{
+        Document{{"t", 0}, {"y", 1}},
+        Document{{"t", 2}, {"y", 2}},
+        Document{{"t", 3}, {"y", 4}},
+        Document{{"t", 7}, {"y", 8}},
+    };
+
+    // A sliding range-based window, 'range: [-2, 0]' over 't'. Repeated getNext() calls
+    // exercise the endpoint hint that each call passes to the next.
+    auto mgr = createForFieldPath(std::move(docs),
+                                  "$y",
+                                  "$t",
+                                  {WindowBounds::RangeBased{Value(-2), Value(0)}},
+                                  boost::none,
+                                  SortPattern(BSON("t" << 1), getExpCtx()));
+    // The window contains only the current document, so the derivative is undefined.
+    ASSERT_VALUE_EQ(Value(BSONNULL), mgr.getNext());
+    advanceIterator();
+    ASSERT_VALUE_EQ(Value(0.5), mgr.getNext());
+    advanceIterator();
+    ASSERT_VALUE_EQ(Value(2), mgr.getNext());
+    advanceIterator();
+    // The window has slid past the previous documents, so it is a singleton again.
+    ASSERT_VALUE_EQ(Value(BSONNULL), mgr.getNext());
+}
+
 TEST_F(WindowFunctionExecDerivativeTest, NonNumbers) {
     auto t0 = Value{0};
     auto t1 = Value{1};
@@ -50,7 +50,7 @@ protected:
           _default(defaultValue.get_value_or(Value(BSONNULL))) {}
 
     Value getFirst() {
-        auto endpoints = _iter.getEndpoints(_bounds);
+        auto endpoints = getEndpoints();
         if (!endpoints)
             return _default;
         const Document doc = *(_iter)[endpoints->first];
@@ -58,19 +58,37 @@ protected:
     }
 
     Value getLast() {
-        auto endpoints = _iter.getEndpoints(_bounds);
+        auto endpoints = getEndpoints();
         if (!endpoints)
             return _default;
         const Document doc = *(_iter)[endpoints->second];
         return _input->evaluate(doc, &_input->getExpressionContext()->variables);
     }
 
-    void reset() final {}
+    void reset() final {
+        _lastEndpoints = boost::none;
+    }
 
 private:
+    boost::optional<std::pair<int, int>> getEndpoints() {
+        // Pass the endpoints from the previous document as a hint, so resolving range-based
+        // bounds resumes scanning from there rather than rescanning the whole window for every
+        // document.
+        auto endpoints = _iter.getEndpoints(_bounds, _lastEndpoints);
+        if (endpoints) {
+            // On the next call we will have advanced by 1 document, so the document we call '0'
+            // now will be called '-1' then.
+            _lastEndpoints = std::pair(endpoints->first - 1, endpoints->second - 1);
+        } else {
+            _lastEndpoints = boost::none;
+        }
+        return endpoints;
+    }
+
     boost::intrusive_ptr<Expression> _input;
     WindowBounds _bounds;
     Value _default;
+    boost::optional<std::pair<int, int>> _lastEndpoints;
 };
 
 class WindowFunctionExecFirst final : public WindowFunctionExecForEndpoint {
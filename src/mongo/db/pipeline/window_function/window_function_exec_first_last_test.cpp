@@ -49,7 +49,8 @@ public:
         std::deque<DocumentSource::GetNextResult> docs,
         WindowBounds bounds,
         boost::optional<Value> defaultVal = boost::none,
-        boost::optional<std::string> keyPath = boost::none) {
+        boost::optional<std::string> keyPath = boost::none,
+        boost::optional<SortPattern> sortPattern = boost::none) {
         // 'defaultValue' is an internal functionality of $first needed for $shift desugaring.
         using optExp = boost::optional<boost::intrusive_ptr<Expression>>;
         using optVal = boost::optional<Value>;
@@ -59,7 +60,7 @@ public:
         auto optKey =
             keyPath ? optExp(ExpressionFieldPath::parse(expCtx, *keyPath, vps)) : boost::none;
         _iter = std::make_unique<PartitionIterator>(
-            expCtx, _docSource.get(), &_tracker, optKey, boost::none);
+            expCtx, _docSource.get(), &_tracker, optKey, std::move(sortPattern));
         auto inputField = ExpressionFieldPath::parse(expCtx, "$val", vps);
 
         return {WindowFunctionExecFirst(
@@ -258,6 +259,34 @@ TEST_F(WindowFunctionExecFirstLastTest, NotAdvancingIterator) {
     ASSERT_VALUE_EQ(Value(1), lst.getNext());
 }
 
+TEST_F(WindowFunctionExecFirstLastTest, RangeBasedWindow) {
+    const auto docs = std::deque<DocumentSource::GetNextResult>{
+        Document{{"val", 0}},
+        Document{{"val", 2}},
+        Document{{"val", 3}},
+        Document{{"val", 7}},
+    };
+
+    // A sliding range-based window, 'range: [-2, +1]' over 'val'. Repeated getNext() calls
+    // exercise the endpoint hint that each call passes to the next.
+    auto [fst, lst] = createExecs(std::move(docs),
+                                  {WindowBounds::RangeBased{Value(-2), Value(1)}},
+                                  boost::none,
+                                  boost::none,
+                                  SortPattern(BSON("val" << 1), getExpCtx()));
+    ASSERT_VALUE_EQ(Value(0), fst.getNext());
+    ASSERT_VALUE_EQ(Value(0), lst.getNext());
+    advanceIterator();
+    ASSERT_VALUE_EQ(Value(0), fst.getNext());
+    ASSERT_VALUE_EQ(Value(3), lst.getNext());
+    advanceIterator();
+    ASSERT_VALUE_EQ(Value(2), fst.getNext());
+    ASSERT_VALUE_EQ(Value(3), lst.getNext());
+    advanceIterator();
+    ASSERT_VALUE_EQ(Value(7), fst.getNext());
+    ASSERT_VALUE_EQ(Value(7), lst.getNext());
+}
+
 TEST_F(WindowFunctionExecFirstLastTest, AcrossPartitions) {
     const auto docs = std::deque<DocumentSource::GetNextResult>{
         Document{{"key", 0}, {"val", 0}},
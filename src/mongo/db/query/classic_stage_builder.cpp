@@ -212,6 +212,15 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             auto ret = std::make_unique<OrStage>(expCtx, _ws, orn->dedup, orn->filter.get());
             for (size_t i = 0; i < orn->children.size(); ++i) {
                 auto childStage = build(orn->children[i]);
+                // When deduping, a record produced by several branches is returned only once.
+                // Give each branch's fetch stage access to the records already returned by
+                // earlier branches so it can skip fetching and filtering them. This matters for
+                // subplanned $or queries whose branches share predicates and therefore produce
+                // heavily overlapping record sets.
+                if (orn->dedup && STAGE_FETCH == childStage->stageType()) {
+                    static_cast<FetchStage*>(childStage.get())
+                        ->setRecordIdDedupSet(ret->seenRecordIds());
+                }
                 ret->addChild(std::move(childStage));
             }
             return ret;
@@ -401,6 +410,7 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             return qds;
         }
         case STAGE_BATCHED_DELETE:
+        case STAGE_BATCHED_UPDATE:
         case STAGE_CACHED_PLAN:
         case STAGE_COUNT:
         case STAGE_DELETE:
@@ -52,6 +52,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/clock_source.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 
@@ -77,14 +78,26 @@ CoreIndexInfo indexInfoFromIndexCatalogEntry(const IndexCatalogEntry& ice) {
             projExec};
 }
 
+size_t numPlanCachePartitions() {
+    // Partitioning the plan cache reduces lock contention between concurrent queries of
+    // different shapes. Each partition receives an equal share of the per-collection entry
+    // budget, so never create more partitions than budgeted entries.
+    return std::max<size_t>(
+        1,
+        std::min<size_t>(ProcessInfo::getNumCores(),
+                         static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load())));
+}
+
 }  // namespace
 
 CollectionQueryInfo::PlanCacheState::PlanCacheState()
-    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load())} {}
+    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load()),
+                       numPlanCachePartitions()} {}
 
 CollectionQueryInfo::PlanCacheState::PlanCacheState(OperationContext* opCtx,
                                                     const CollectionPtr& collection)
-    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load())},
+    : classicPlanCache{static_cast<size_t>(internalQueryCacheMaxEntriesPerCollection.load()),
+                       numPlanCachePartitions()},
       planCacheInvalidator{collection, opCtx->getServiceContext()} {
     std::vector<CoreIndexInfo> indexCores;
 
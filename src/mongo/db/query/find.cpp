@@ -56,6 +56,7 @@
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/query/query_planner_params.h"
+#include "mongo/db/query/query_shape_stats.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/server_options.h"
@@ -121,6 +122,11 @@ void endQueryOp(OperationContext* opCtx,
     explainer.getSummaryStats(&summaryStats);
     curOp->debug().setPlanSummaryMetrics(summaryStats);
 
+    if (auto cq = exec.getCanonicalQuery()) {
+        QueryShapeStats::get(opCtx->getServiceContext())
+            .record(opCtx, *cq, explainer, summaryStats);
+    }
+
     if (collection) {
         CollectionQueryInfo::get(collection).notifyOfQuery(opCtx, collection, summaryStats);
     }
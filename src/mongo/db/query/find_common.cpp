@@ -68,6 +68,11 @@ bool FindCommon::enoughForFirstBatch(const FindCommandRequest& findCommand, long
     tassert(5746104,
             "ntoreturn on the find command should not be set",
             findCommand.getNtoreturn() == boost::none);
+    if (findCommand.getFillBatchToMaxBytes()) {
+        // Only the response size limit terminates the batch, except that an explicit batchSize of
+        // zero keeps its meaning of "return an empty first batch with just a cursor".
+        return batchSize && batchSize.value() == 0;
+    }
     if (!batchSize) {
         // We enforce a default batch size for the initial find if no batch size is specified.
         return numDocs >= query_request_helper::kDefaultBatchSize;
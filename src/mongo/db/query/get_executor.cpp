@@ -33,6 +33,7 @@
 
 #include "mongo/db/query/get_executor.h"
 
+#include <algorithm>
 #include <boost/optional.hpp>
 #include <limits>
 #include <memory>
@@ -110,6 +111,7 @@
 namespace mongo {
 MONGO_FAIL_POINT_DEFINE(includeFakeColumnarIndex);
 MONGO_FAIL_POINT_DEFINE(batchDeletesByDefault);
+MONGO_FAIL_POINT_DEFINE(batchUpdatesByDefault);
 
 boost::intrusive_ptr<ExpressionContext> makeExpressionContextForGetExecutor(
     OperationContext* opCtx, const BSONObj& requestCollation, const NamespaceString& nss) {
@@ -1851,11 +1853,29 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorUpda
 
     updateStageParams.canonicalQuery = cq.get();
     const bool isUpsert = updateStageParams.request->isUpsert();
-    root = (isUpsert
-                ? std::make_unique<UpsertStage>(
-                      cq->getExpCtxRaw(), updateStageParams, ws.get(), collection, root.release())
-                : std::make_unique<UpdateStage>(
-                      cq->getExpCtxRaw(), updateStageParams, ws.get(), collection, root.release()));
+
+    const bool batchUpdate =
+        (!isUpsert && request->isMulti() && !request->shouldReturnAnyDocs() &&
+         request->getSort().isEmpty() && !updateStageParams.numStatsForDoc) &&
+        ((gInternalBatchUserMultiUpdatesForTest.load() &&
+          nss.ns() == "__internalBatchedUpdatesTesting.Collection0") ||
+         (batchUpdatesByDefault.shouldFail()));
+
+    if (isUpsert) {
+        root = std::make_unique<UpsertStage>(
+            cq->getExpCtxRaw(), updateStageParams, ws.get(), collection, root.release());
+    } else if (batchUpdate) {
+        root =
+            std::make_unique<BatchedUpdateStage>(cq->getExpCtxRaw(),
+                                                 updateStageParams,
+                                                 std::make_unique<BatchedUpdateStageBatchParams>(),
+                                                 ws.get(),
+                                                 collection,
+                                                 root.release());
+    } else {
+        root = std::make_unique<UpdateStage>(
+            cq->getExpCtxRaw(), updateStageParams, ws.get(), collection, root.release());
+    }
 
     if (projection) {
         root = std::make_unique<ProjectionStageDefault>(
@@ -2047,6 +2067,10 @@ bool turnIxscanIntoCount(QuerySolution* soln) {
  * suitable index is that the index should be of type BTREE or HASHED and the index cannot be a
  * partial index.
  *
+ * 'fields' is the ordered, non-empty list of fields we are getting distinct combinations of. They
+ * must form a prefix of the index's key pattern so that a DISTINCT_SCAN can skip to the next
+ * combination by seeking past the current key prefix.
+ *
  * Multikey indices are not suitable for DistinctNode when the projection is on an array element.
  * Arrays are flattened in a multikey index which makes it impossible for the distinct scan stage
  * (plan stage generated from DistinctNode) to select the requested element by array index.
@@ -2056,10 +2080,11 @@ bool turnIxscanIntoCount(QuerySolution* soln) {
  * cannot be covered with a dotted field.
  */
 bool getDistinctNodeIndex(const std::vector<IndexEntry>& indices,
-                          const std::string& field,
+                          const std::vector<std::string>& fields,
                           const CollatorInterface* collator,
                           size_t* indexOut) {
     invariant(indexOut);
+    invariant(!fields.empty());
     int minFields = std::numeric_limits<int>::max();
     for (size_t i = 0; i < indices.size(); ++i) {
         // Skip indices with non-matching collator.
@@ -2070,13 +2095,22 @@ bool getDistinctNodeIndex(const std::vector<IndexEntry>& indices,
         if (indices[i].filterExpr) {
             continue;
         }
-        // Skip indices where the first key is not 'field'.
-        auto firstIndexField = indices[i].keyPattern.firstElement();
-        if (firstIndexField.fieldNameStringData() != StringData(field)) {
-            continue;
+        // Skip indices whose key pattern does not begin with 'fields', in order. The keys we skip
+        // past must also not be "plugin" keys such as "hashed" or "2dsphere".
+        BSONObjIterator it(indices[i].keyPattern);
+        bool fieldsMatchPrefix = true;
+        for (auto&& field : fields) {
+            if (!it.more()) {
+                fieldsMatchPrefix = false;
+                break;
+            }
+            auto indexField = it.next();
+            if (indexField.fieldNameStringData() != StringData(field) || !indexField.isNumber()) {
+                fieldsMatchPrefix = false;
+                break;
+            }
         }
-        // Skip the index if the first key is a "plugin" such as "hashed", "2dsphere", and so on.
-        if (!firstIndexField.isNumber()) {
+        if (!fieldsMatchPrefix) {
             continue;
         }
         // Compound hashed indexes can use distinct scan if the first field is 1 or -1. For the
@@ -2216,8 +2250,9 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorCoun
 //
 
 bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
-                                  const std::string& field,
+                                  const std::vector<std::string>& fields,
                                   bool strictDistinctOnly) {
+    invariant(!fields.empty());
     auto root = soln->root();
 
     // We can attempt to convert a plan if it follows one of these patterns (starting from the
@@ -2263,9 +2298,14 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
     }
 
     if (indexScanNode->index.type == IndexType::INDEX_WILDCARD) {
+        // A wildcard index indexes a single field per key, so it cannot answer a multiple-field
+        // distinct scan.
+        if (fields.size() > 1u) {
+            return false;
+        }
         // If the query is on a field other than the distinct key, we may have generated a $** plan
         // which does not actually contain the distinct key field.
-        if (field != std::next(indexScanNode->index.keyPattern.begin())->fieldName()) {
+        if (fields.front() != std::next(indexScanNode->index.keyPattern.begin())->fieldName()) {
             return false;
         }
         // If the query includes object bounds, we cannot turn this IXSCAN into a DISTINCT_SCAN.
@@ -2293,26 +2333,44 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
         return false;
     }
 
-    // Figure out which field we're skipping to the next value of.
+    // Mark which positions in the key pattern hold distinct fields, and figure out which field
+    // we're skipping to the next value of. With multiple distinct fields, skipping past the last
+    // of them skips to the next distinct combination of all of them.
+    std::vector<bool> isDistinctField;
     int fieldNo = 0;
-    BSONObjIterator it(indexScanNode->index.keyPattern);
-    while (it.more()) {
-        if (field == it.next().fieldName()) {
-            break;
+    size_t fieldsFound = 0;
+    {
+        int pos = 0;
+        BSONObjIterator it(indexScanNode->index.keyPattern);
+        while (it.more()) {
+            const bool isDistinct =
+                std::find(fields.begin(), fields.end(), it.next().fieldName()) != fields.end();
+            isDistinctField.push_back(isDistinct);
+            if (isDistinct) {
+                fieldNo = pos;
+                ++fieldsFound;
+            }
+            ++pos;
         }
-        ++fieldNo;
+    }
+    if (fieldsFound != fields.size()) {
+        // The index does not contain all of the distinct fields.
+        return false;
     }
 
     if (strictDistinctOnly) {
-        // If the "distinct" field is not the first field in the index bounds then the only way we
+        // If a "distinct" field is not the first field in the index bounds then the only way we
         // can guarantee that we'll never see duplicate values for the distinct field is to make
-        // sure every field before the distinct field has equality bounds. For example, a
+        // sure every non-distinct field before it has equality bounds. For example, a
         // DISTINCT_SCAN on 'b' over the {a: 1, b: 1} index will scan a particular 'b' value
         // multiple times if that 'b' value exists in documents with different 'a' values. The
         // equality bounds on 'a' prevent the scan from seeing duplicate 'b' values by ensuring the
         // scan is limited to a single value for the 'a' field.
         for (size_t i = 0; i < static_cast<size_t>(fieldNo); ++i) {
             invariant(i < indexScanNode->bounds.size());
+            if (isDistinctField[i]) {
+                continue;
+            }
             if (indexScanNode->bounds.fields[i].intervals.size() != 1 ||
                 !indexScanNode->bounds.fields[i].intervals[0].isPoint()) {
                 return false;
@@ -2320,7 +2378,7 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
         }
     }
 
-    // We should not use a distinct scan if the field over which we are computing the distinct is
+    // We should not use a distinct scan if any field over which we are computing the distinct is
     // multikey.
     if (indexScanNode->index.multikey) {
         const auto& multikeyPaths = indexScanNode->index.multikeyPaths;
@@ -2329,10 +2387,12 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
             return false;
         }
 
-        if (!multikeyPaths[fieldNo].empty()) {
-            // Path-level multikey information indicates that the distinct key contains at least one
-            // array component.
-            return false;
+        for (size_t i = 0; i <= static_cast<size_t>(fieldNo); ++i) {
+            if (isDistinctField[i] && !multikeyPaths[i].empty()) {
+                // Path-level multikey information indicates that a distinct key contains at least
+                // one array component.
+                return false;
+            }
         }
     }
 
@@ -2406,22 +2466,32 @@ QueryPlannerParams fillOutPlannerParamsForDistinct(OperationContext* opCtx,
         // Skip the addition of hidden indexes to prevent use in query planning.
         if (desc->hidden())
             continue;
-        if (desc->keyPattern().hasField(parsedDistinct.getKey())) {
-            if (!mayUnwindArrays &&
-                isAnyComponentOfPathMultikey(desc->keyPattern(),
-                                             ice->isMultikey(opCtx, collection),
-                                             ice->getMultikeyPaths(opCtx, collection),
-                                             parsedDistinct.getKey())) {
-                // If the caller requested "strict" distinct that does not "pre-unwind" arrays,
-                // then an index which is multikey on the distinct field may not be used. This is
-                // because when indexing an array each element gets inserted individually. Any plan
-                // which involves scanning the index will have effectively "unwound" all arrays.
-                continue;
+        const auto& keys = parsedDistinct.getKeys();
+        auto indexCoversAllKeys = [&]() {
+            for (auto&& key : keys) {
+                if (!desc->keyPattern().hasField(key)) {
+                    return false;
+                }
+                if (!mayUnwindArrays &&
+                    isAnyComponentOfPathMultikey(desc->keyPattern(),
+                                                 ice->isMultikey(opCtx, collection),
+                                                 ice->getMultikeyPaths(opCtx, collection),
+                                                 key)) {
+                    // If the caller requested "strict" distinct that does not "pre-unwind" arrays,
+                    // then an index which is multikey on a distinct field may not be used. This is
+                    // because when indexing an array each element gets inserted individually. Any
+                    // plan which involves scanning the index will have effectively "unwound" all
+                    // arrays.
+                    return false;
+                }
             }
-
+            return true;
+        };
+        if (indexCoversAllKeys()) {
             plannerParams.indices.push_back(indexEntryFromIndexCatalogEntry(
                 opCtx, collection, *ice, parsedDistinct.getQuery()));
-        } else if (desc->getIndexType() == IndexType::INDEX_WILDCARD && !query.isEmpty()) {
+        } else if (keys.size() == 1u && desc->getIndexType() == IndexType::INDEX_WILDCARD &&
+                   !query.isEmpty()) {
             // Check whether the $** projection captures the field over which we are distinct-ing.
             auto* proj = static_cast<const WildcardAccessMethod*>(ice->accessMethod())
                              ->getWildcardProjection()
@@ -2486,7 +2556,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorForS
     if (!parsedDistinct->getQuery()->getFindCommandRequest().getFilter().isEmpty() ||
         parsedDistinct->getQuery()->getSortPattern() ||
         !getDistinctNodeIndex(
-            plannerParams.indices, parsedDistinct->getKey(), collator, &distinctNodeIndex)) {
+            plannerParams.indices, parsedDistinct->getKeys(), collator, &distinctNodeIndex)) {
         // Not a "simple" DISTINCT_SCAN or no suitable index was found.
         return {nullptr};
     }
@@ -2496,7 +2566,10 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorForS
     IndexBoundsBuilder::allValuesBounds(
         dn->index.keyPattern, &dn->bounds, dn->index.collator != nullptr);
     dn->queryCollator = collator;
-    dn->fieldNo = 0;
+
+    // The distinct fields form a prefix of the key pattern, so skipping to the next value of the
+    // last of them skips to the next distinct combination of all of them.
+    dn->fieldNo = static_cast<int>(parsedDistinct->getKeys().size()) - 1;
 
     // An index with a non-simple collation requires a FETCH stage.
     std::unique_ptr<QuerySolutionNode> solnRoot = std::move(dn);
@@ -2562,7 +2635,7 @@ getExecutorDistinctFromIndexSolutions(OperationContext* opCtx,
     // We look for a solution that has an ixscan we can turn into a distinctixscan
     for (size_t i = 0; i < solutions.size(); ++i) {
         if (turnIxscanIntoDistinctIxscan(
-                solutions[i].get(), parsedDistinct->getKey(), strictDistinctOnly)) {
+                solutions[i].get(), parsedDistinct->getKeys(), strictDistinctOnly)) {
             // Build and return the SSR over solutions[i].
             std::unique_ptr<WorkingSet> ws = std::make_unique<WorkingSet>();
             std::unique_ptr<QuerySolution> currentSolution = std::move(solutions[i]);
@@ -31,6 +31,7 @@
 
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/exec/batched_delete_stage.h"
+#include "mongo/db/exec/batched_update_stage.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/exec/update_stage.h"
 #include "mongo/db/ops/delete_request_gen.h"
@@ -213,7 +214,12 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorFind
 
 /**
  * If possible, turn the provided QuerySolution into a QuerySolution that uses a DistinctNode
- * to provide results for the distinct command.
+ * to provide results for the distinct command or for a $group stage with distinct-like semantics.
+ *
+ * 'fields' is the ordered, non-empty list of fields for which we want distinct combinations of
+ * values. The distinct command always has exactly one field; the $group-to-DISTINCT_SCAN
+ * optimization may have several, which must all appear in the index so the scan can skip to the
+ * next distinct combination by seeking past the last of them.
  *
  * When 'strictDistinctOnly' is false, any resulting QuerySolution will limit the number of
  * documents that need to be examined to compute the results of a distinct command, but it may not
@@ -223,7 +229,7 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorFind
  * false.
  */
 bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
-                                  const std::string& field,
+                                  const std::vector<std::string>& fields,
                                   bool strictDistinctOnly);
 
 /**
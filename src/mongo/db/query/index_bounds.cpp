@@ -646,6 +646,12 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
     // Field number 'firstNonContainedField' of the index key is after interval we think it's
     // in.  Fields 0 through 'firstNonContained-1' are within their current intervals and we can
     // ignore them.
+    //
+    // Since the key is ahead of field 'firstNonContainedField's current interval, its new
+    // interval can only have a larger index, so the first search below may resume from the
+    // next interval instead of considering the whole list. We know nothing about the fields
+    // to the right, so subsequent searches start from the beginning.
+    size_t searchStartIdx = _curInterval[firstNonContainedField] + 1;
     while (firstNonContainedField < _curInterval.size()) {
         // Find the interval that contains our field.
         size_t newIntervalForField;
@@ -653,7 +659,9 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
         Location where = findIntervalForField(_keyValues[firstNonContainedField],
                                               _bounds->fields[firstNonContainedField],
                                               _expectedDirection[firstNonContainedField],
-                                              &newIntervalForField);
+                                              &newIntervalForField,
+                                              searchStartIdx);
+        searchStartIdx = 0;
 
         if (WITHIN == where) {
             // Found a new interval for field firstNonContainedField.  Move our internal choice
@@ -735,7 +743,8 @@ IndexBoundsChecker::Location IndexBoundsChecker::findIntervalForField(
     const BSONElement& elt,
     const OrderedIntervalList& oil,
     const int expectedDirection,
-    size_t* newIntervalIndex) {
+    size_t* newIntervalIndex,
+    size_t searchStartIdx) {
     // Binary search for interval.
     // Intervals are ordered in the same direction as our keys.
     // Key behind all intervals: [BEHIND, ..., BEHIND]
@@ -743,10 +752,28 @@ IndexBoundsChecker::Location IndexBoundsChecker::findIntervalForField(
     // Key within one interval: [AHEAD, ..., WITHIN, BEHIND, ...]
     // Key not in any inteval: [AHEAD, ..., AHEAD, BEHIND, ...]
 
-    // Find left-most BEHIND/WITHIN interval.
-    vector<Interval>::const_iterator i = std::lower_bound(oil.intervals.begin(),
-                                                          oil.intervals.end(),
-                                                          std::make_pair(elt, expectedDirection),
+    const auto keyAndDirection = std::make_pair(elt, expectedDirection);
+
+    // During an index scan the key typically lands in an interval at or just after the one the
+    // scan is already in, so gallop forward from 'searchStartIdx' in exponentially growing
+    // steps until we pass the key, then binary search the final gap. This costs O(log d)
+    // comparisons for a jump of d intervals rather than O(log n) over the whole list, which
+    // matters when stepping through the thousands of point intervals of a large $in.
+    const size_t numIntervals = oil.intervals.size();
+    size_t lo = std::min(searchStartIdx, numIntervals);
+    size_t hi = lo;
+    for (size_t step = 1; hi < numIntervals; step *= 2) {
+        if (!isKeyAheadOfInterval(oil.intervals[hi], keyAndDirection)) {
+            break;
+        }
+        lo = hi + 1;
+        hi = (numIntervals - hi > step) ? hi + step : numIntervals;
+    }
+
+    // The left-most BEHIND/WITHIN interval, if any, now lies in [lo, hi].
+    vector<Interval>::const_iterator i = std::lower_bound(oil.intervals.begin() + lo,
+                                                          oil.intervals.begin() + hi,
+                                                          keyAndDirection,
                                                           isKeyAheadOfInterval);
 
     // Key ahead of all intervals.
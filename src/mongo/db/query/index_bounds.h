@@ -276,14 +276,19 @@ public:
      *
      * If 'elt' cannot be advanced to any interval, return AHEAD.
      *
-     * Exposed for testing only.
+     * 'searchStartIdx' may be passed when the caller knows that 'elt' is ahead of every
+     * interval with a smaller index; the search is then confined to the intervals at
+     * indices ['searchStartIdx', end). checkKey() uses this to resume from the scan's
+     * current interval rather than re-searching the whole list, which matters for the
+     * large ordered interval lists produced by $in predicates with many elements.
      *
-     * TODO(efficiency): Start search from a given index.
+     * Exposed for testing only.
      */
     static Location findIntervalForField(const BSONElement& elt,
                                          const OrderedIntervalList& oil,
                                          int expectedDirection,
-                                         size_t* newIntervalIndex);
+                                         size_t* newIntervalIndex,
+                                         size_t searchStartIdx = 0);
 
 private:
     /**
@@ -1097,4 +1097,44 @@ TEST(IndexBoundsCheckerTest, FindIntervalForField) {
     testFindIntervalForField(0, pointsObj, -1, IndexBoundsChecker::AHEAD, 0U);
 }
 
+TEST(IndexBoundsCheckerTest, FindIntervalForFieldWithSearchStartIdx) {
+    // Construct a large list of even point intervals: [0, 0], [2, 2], ..., [198, 198]. This is
+    // big enough that the galloping search takes several doubling steps from the start index.
+    OrderedIntervalList oil("foo");
+    for (int j = 0; j < 200; j += 2) {
+        oil.intervals.push_back(Interval(BSON("" << j << "" << j), true, true));
+    }
+
+    // For every key and every valid starting interval at or before the answer, the search must
+    // find the same interval as a search over the whole list.
+    for (int key = 1; key < 200; key += 7) {
+        BSONObj keyObj = BSON("" << key);
+        BSONElement keyElt = keyObj.firstElement();
+
+        size_t expectedIndex = 0;
+        IndexBoundsChecker::Location expectedLocation =
+            IndexBoundsChecker::findIntervalForField(keyElt, oil, 1, &expectedIndex);
+
+        for (size_t startIdx = 0; startIdx <= expectedIndex; ++startIdx) {
+            size_t intervalIndex = 0;
+            IndexBoundsChecker::Location location = IndexBoundsChecker::findIntervalForField(
+                keyElt, oil, 1, &intervalIndex, startIdx);
+            ASSERT_EQUALS(location, expectedLocation);
+            ASSERT_EQUALS(intervalIndex, expectedIndex);
+        }
+    }
+
+    // A key ahead of all intervals is AHEAD regardless of the starting interval.
+    BSONObj keyObj = BSON("" << 500);
+    BSONElement keyElt = keyObj.firstElement();
+    size_t intervalIndex = 0;
+    ASSERT_EQUALS(IndexBoundsChecker::findIntervalForField(keyElt, oil, 1, &intervalIndex, 42U),
+                  IndexBoundsChecker::AHEAD);
+
+    // A start index past the end of the list is also AHEAD.
+    ASSERT_EQUALS(IndexBoundsChecker::findIntervalForField(
+                      keyElt, oil, 1, &intervalIndex, oil.intervals.size() + 1),
+                  IndexBoundsChecker::AHEAD);
+}
+
 }  // namespace
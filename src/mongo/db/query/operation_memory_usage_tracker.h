@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/db/operation_context.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo {
+
+/**
+ * Tracks an estimate of the memory buffered by the blocking execution stages running on behalf of
+ * a single OperationContext, so a runaway operation can be failed before it runs the process out
+ * of memory.
+ *
+ * The per-stage memory limits ('maxMemoryUsageBytes' in DocumentSourceGroup, SortStage,
+ * sbe::HashAggStage, ...) bound each stage in isolation, but an operation with several
+ * memory-hungry stages, or with allowDiskUse raising the spill thresholds, can still accumulate an
+ * unbounded multiple of any single stage limit. Stages that already maintain memory estimates for
+ * their own limits report their current usage here, keyed by stage, and the aggregate is checked
+ * against the 'internalQueryMaxOperationMemoryUsageBytes' server parameter. A limit of 0 (the
+ * default) disables enforcement.
+ *
+ * The tracker is decorated on the OperationContext, so each getMore starts with a clean slate and
+ * re-learns the footprint of the cursor's stages as they report during that operation. It is only
+ * accessed by the thread running the operation.
+ */
+class OperationMemoryUsageTracker {
+public:
+    static OperationMemoryUsageTracker& get(OperationContext* opCtx);
+
+    /**
+     * Records 'currentBytes' as the present memory footprint of 'consumer', replacing any amount
+     * the same consumer reported earlier in this operation. Throws ExceededMemoryLimit if the
+     * aggregate across all consumers exceeds the configured per-operation limit.
+     */
+    void set(const void* consumer, long long currentBytes);
+
+    long long currentMemoryBytes() const {
+        return _memoryUsageBytes;
+    }
+
+    long long maxMemoryBytes() const {
+        return _maxMemoryUsageBytes;
+    }
+
+private:
+    // The most recent amount reported by each consumer, used to convert absolute reports into
+    // deltas against the aggregate.
+    stdx::unordered_map<const void*, long long> _consumers;
+
+    // Tracks the current aggregate memory footprint.
+    long long _memoryUsageBytes = 0;
+
+    // Maximum aggregate footprint observed during this operation.
+    long long _maxMemoryUsageBytes = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,95 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/operation_memory_usage_tracker.h"
+
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+class OperationMemoryUsageTrackerTest : public unittest::Test {
+public:
+    OperationMemoryUsageTrackerTest()
+        : _opCtx(_serviceContext.makeOperationContext()),
+          _previousLimit(internalQueryMaxOperationMemoryUsageBytes.load()) {}
+
+    ~OperationMemoryUsageTrackerTest() {
+        internalQueryMaxOperationMemoryUsageBytes.store(_previousLimit);
+    }
+
+    OperationMemoryUsageTracker& tracker() {
+        return OperationMemoryUsageTracker::get(_opCtx.get());
+    }
+
+private:
+    QueryTestServiceContext _serviceContext;
+    ServiceContext::UniqueOperationContext _opCtx;
+    long long _previousLimit;
+};
+
+TEST_F(OperationMemoryUsageTrackerTest, AggregatesAcrossConsumers) {
+    int consumerA, consumerB;
+    tracker().set(&consumerA, 100);
+    tracker().set(&consumerB, 250);
+    ASSERT_EQ(tracker().currentMemoryBytes(), 350);
+
+    // Each consumer's report replaces its previous one rather than accumulating.
+    tracker().set(&consumerA, 50);
+    ASSERT_EQ(tracker().currentMemoryBytes(), 300);
+    ASSERT_EQ(tracker().maxMemoryBytes(), 350);
+}
+
+TEST_F(OperationMemoryUsageTrackerTest, ThrowsWhenAggregateExceedsLimit) {
+    internalQueryMaxOperationMemoryUsageBytes.store(500);
+
+    int consumerA, consumerB;
+    tracker().set(&consumerA, 300);
+    tracker().set(&consumerB, 200);
+    ASSERT_THROWS_CODE(
+        tracker().set(&consumerB, 201), DBException, ErrorCodes::ExceededMemoryLimit);
+
+    // A consumer shrinking (e.g. after spilling) brings the aggregate back under the limit.
+    tracker().set(&consumerA, 0);
+    tracker().set(&consumerB, 400);
+    ASSERT_EQ(tracker().currentMemoryBytes(), 400);
+}
+
+TEST_F(OperationMemoryUsageTrackerTest, ZeroLimitDisablesEnforcement) {
+    internalQueryMaxOperationMemoryUsageBytes.store(0);
+
+    int consumer;
+    tracker().set(&consumer, 10 * 1024 * 1024 * 1024LL);
+    ASSERT_EQ(tracker().currentMemoryBytes(), 10 * 1024 * 1024 * 1024LL);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -208,7 +208,7 @@ StatusWith<BSONObj> ParsedDistinct::asAggregationCommand() const {
         matchStageBuilder.doneFast();
     }
 
-    FieldPath path(_key);
+    FieldPath path(getKey());
     addNestedUnwind(&pipelineBuilder, path);
     addMatchRemovingNestedArrays(&pipelineBuilder, path);
 
@@ -218,7 +218,7 @@ StatusWith<BSONObj> ParsedDistinct::asAggregationCommand() const {
         groupBuilder.appendNull("_id");
         {
             BSONObjBuilder distinctBuilder(groupBuilder.subobjStart("distinct"));
-            distinctBuilder.append("$addToSet", str::stream() << "$" << _key);
+            distinctBuilder.append("$addToSet", str::stream() << "$" << getKey());
             distinctBuilder.doneFast();
         }
         groupBuilder.doneFast();
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "mongo/base/status_with.h"
 #include "mongo/db/query/canonical_query.h"
@@ -53,7 +54,18 @@ public:
     static const char kCommentField[];
 
     ParsedDistinct(std::unique_ptr<CanonicalQuery> query, const std::string key)
-        : _query(std::move(query)), _key(std::move(key)) {}
+        : ParsedDistinct(std::move(query), std::vector<std::string>{std::move(key)}) {}
+
+    /**
+     * A multiple-key ParsedDistinct requests one result per distinct combination of the given
+     * fields, as produced by a DISTINCT_SCAN over an index with those fields as a prefix of its
+     * key pattern. This form is only constructed by the $group-to-DISTINCT_SCAN optimization; the
+     * distinct command always has exactly one key.
+     */
+    ParsedDistinct(std::unique_ptr<CanonicalQuery> query, std::vector<std::string> keys)
+        : _query(std::move(query)), _keys(std::move(keys)) {
+        invariant(!_keys.empty());
+    }
 
     const CanonicalQuery* getQuery() const {
         return _query.get();
@@ -68,7 +80,11 @@ public:
     }
 
     const std::string& getKey() const {
-        return _key;
+        return _keys.front();
+    }
+
+    const std::vector<std::string>& getKeys() const {
+        return _keys;
     }
 
     /**
@@ -90,8 +106,9 @@ public:
 private:
     std::unique_ptr<CanonicalQuery> _query;
 
-    // The field for which we are getting distinct values.
-    const std::string _key;
+    // The field (or, for the $group optimization, fields) for which we are getting distinct
+    // values. Never empty.
+    const std::vector<std::string> _keys;
 };
 
 }  // namespace mongo
@@ -59,9 +59,19 @@ private:
 
 public:
     CachedPlanHolder(const PlanCacheEntryBase<CachedPlanType, DebugInfoType>& entry)
-        : cachedPlan(entry.cachedPlan->clone()),
-          decisionWorks(entry.works),
-          debugInfo(entry.debugInfo) {}
+        : CachedPlanHolder(entry.cachedPlan, entry.works, entry.debugInfo) {}
+
+    /**
+     * Constructs a holder from a snapshot of an entry's immutable state. Since the snapshot shares
+     * ownership of the cached plan, callers may clone the plan via this constructor without
+     * holding the plan cache partition lock.
+     */
+    CachedPlanHolder(const std::shared_ptr<const CachedPlanType>& cachedPlanSnapshot,
+                     boost::optional<size_t> decisionWorks,
+                     std::shared_ptr<const DebugInfoType> debugInfo)
+        : cachedPlan(cachedPlanSnapshot->clone()),
+          decisionWorks(decisionWorks),
+          debugInfo(std::move(debugInfo)) {}
 
     /**
      * Indicates whether or not the cached plan is pinned to cache.
@@ -186,7 +196,9 @@ public:
     }
 
     // A cached plan that can be used to reconstitute the complete execution plan from cache.
-    const std::unique_ptr<CachedPlanType> cachedPlan;
+    // Immutable and shared, so that readers may snapshot it and clone the plan without holding
+    // the plan cache partition lock.
+    const std::shared_ptr<const CachedPlanType> cachedPlan;
 
     const Date_t timeOfCreation;
 
@@ -463,21 +475,33 @@ public:
      * for the query (if there is one).
      */
     GetResult get(const KeyType& key) const {
-        auto partition = _partitionedCache->lockOnePartition(key);
-        auto entry = partition->get(key);
-        if (!entry.isOK()) {
-            tassert(6007023,
-                    "Unexpected error code from LRU store",
-                    entry.getStatus() == ErrorCodes::NoSuchKey);
-            return {CacheEntryState::kNotPresent, nullptr};
+        CacheEntryState state;
+        std::shared_ptr<const CachedPlanType> cachedPlan;
+        boost::optional<size_t> decisionWorks;
+        std::shared_ptr<const DebugInfoType> debugInfo;
+        {
+            auto partition = _partitionedCache->lockOnePartition(key);
+            auto entry = partition->get(key);
+            if (!entry.isOK()) {
+                tassert(6007023,
+                        "Unexpected error code from LRU store",
+                        entry.getStatus() == ErrorCodes::NoSuchKey);
+                return {CacheEntryState::kNotPresent, nullptr};
+            }
+            tassert(6007024, "LRU store must get a value or an error code", entry.getValue());
+
+            state = entry.getValue()->isActive ? CacheEntryState::kPresentActive
+                                               : CacheEntryState::kPresentInactive;
+            cachedPlan = entry.getValue()->cachedPlan;
+            decisionWorks = entry.getValue()->works;
+            debugInfo = entry.getValue()->debugInfo;
         }
-        tassert(6007024, "LRU store must get a value or an error code", entry.getValue());
 
-        auto state = entry.getValue()->isActive ? CacheEntryState::kPresentActive
-                                                : CacheEntryState::kPresentInactive;
-        return {
-            state,
-            std::make_unique<CachedPlanHolder<CachedPlanType, DebugInfoType>>(*entry.getValue())};
+        // Clone the cached plan from the immutable snapshot after releasing the partition lock.
+        // The snapshot keeps the plan alive even if the entry is evicted concurrently.
+        return {state,
+                std::make_unique<CachedPlanHolder<CachedPlanType, DebugInfoType>>(
+                    cachedPlan, decisionWorks, std::move(debugInfo))};
     }
 
     /**
@@ -389,6 +389,41 @@ TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     ASSERT_EQ(planCache.get(keyC).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+TEST(PlanCacheTest, PartitionedPlanCacheSetGetAndRemove) {
+    // Distribute entries across several partitions.
+    PlanCache planCache(100, 4 /* numPartitions */);
+    QueryTestServiceContext serviceContext;
+
+    unique_ptr<CanonicalQuery> cqA(canonicalize("{a: 1}"));
+    unique_ptr<CanonicalQuery> cqB(canonicalize("{b: 1}"));
+    unique_ptr<CanonicalQuery> cqC(canonicalize("{c: 1}"));
+    for (auto cq : {cqA.get(), cqB.get(), cqC.get()}) {
+        ASSERT_EQ(planCache.get(makeKey(*cq)).state, PlanCache::CacheEntryState::kNotPresent);
+        addCacheEntryForShape(*cq, &planCache);
+    }
+    ASSERT_EQ(planCache.size(), 3U);
+
+    // Each shape hashes to its own partition, but lookups must find each entry and return a
+    // usable cached plan.
+    for (auto cq : {cqA.get(), cqB.get(), cqC.get()}) {
+        auto res = planCache.get(makeKey(*cq));
+        ASSERT_EQ(res.state, PlanCache::CacheEntryState::kPresentInactive);
+        ASSERT(res.cachedPlanHolder);
+        ASSERT(res.cachedPlanHolder->cachedPlan);
+    }
+
+    // Removal only affects the partition owning the key.
+    planCache.remove(makeKey(*cqB));
+    ASSERT_EQ(planCache.size(), 2U);
+    ASSERT_EQ(planCache.get(makeKey(*cqB)).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.get(makeKey(*cqA)).state, PlanCache::CacheEntryState::kPresentInactive);
+
+    // clear() empties every partition.
+    planCache.clear();
+    ASSERT_EQ(planCache.size(), 0U);
+    ASSERT_EQ(planCache.get(makeKey(*cqA)).state, PlanCache::CacheEntryState::kNotPresent);
+}
+
 TEST(PlanCacheTest, PlanCacheRemoveDeletesInactiveEntries) {
     PlanCache planCache(5000);
     unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
@@ -543,7 +543,8 @@ UpdateResult PlanExecutorImpl::getUpdateResult() const {
                 static_cast<UpdateStage*>(_root->child().get())->containsDotsAndDollarsField());
         }
         default:
-            invariant(StageType::STAGE_UPDATE == _root->stageType());
+            invariant(StageType::STAGE_UPDATE == _root->stageType() ||
+                      StageType::STAGE_BATCHED_UPDATE == _root->stageType());
             const auto stats = _root->getSpecificStats();
             return updateStatsToResult(
                 static_cast<const UpdateStats&>(*stats),
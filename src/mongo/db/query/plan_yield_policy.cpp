@@ -31,9 +31,12 @@
 
 #include "mongo/db/query/plan_yield_policy.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/storage/storage_engine_cache_pressure.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
 
@@ -48,7 +51,8 @@ PlanYieldPolicy::PlanYieldPolicy(YieldPolicy policy,
     : _policy(policy),
       _yieldable(yieldable),
       _callbacks(std::move(callbacks)),
-      _elapsedTracker(cs, yieldIterations, yieldPeriod) {}
+      _elapsedTracker(cs, yieldIterations, yieldPeriod),
+      _cachePressureTracker(cs, std::max(1, yieldIterations / 4), yieldPeriod / 4) {}
 
 bool PlanYieldPolicy::shouldYieldOrInterrupt(OperationContext* opCtx) {
     if (_policy == YieldPolicy::INTERRUPT_ONLY) {
@@ -59,11 +63,21 @@ bool PlanYieldPolicy::shouldYieldOrInterrupt(OperationContext* opCtx) {
     invariant(!opCtx->lockState()->inAWriteUnitOfWork());
     if (_forceYield)
         return true;
-    return _elapsedTracker.intervalHasElapsed();
+    // Ping the cache pressure tracker unconditionally so its work counter keeps pace with the
+    // main tracker's.
+    const bool pressureIntervalElapsed = _cachePressureTracker.intervalHasElapsed();
+    if (_elapsedTracker.intervalHasElapsed())
+        return true;
+    // When the storage engine's cache is filling up faster than eviction can drain it, yield at a
+    // quarter of the usual interval so this plan's storage snapshot, which pins cache content, is
+    // abandoned sooner. The cache state is a periodically-updated atomic, so this adds no
+    // per-check storage engine calls.
+    return pressureIntervalElapsed && isStorageEngineCacheUnderPressure();
 }
 
 void PlanYieldPolicy::resetTimer() {
     _elapsedTracker.resetLastTime();
+    _cachePressureTracker.resetLastTime();
 }
 
 Status PlanYieldPolicy::yieldOrInterrupt(OperationContext* opCtx,
@@ -174,7 +174,9 @@ public:
     /**
      * Constructs a PlanYieldPolicy of the given 'policy' type. This class uses an ElapsedTracker
      * to keep track of elapsed time, which is initialized from the parameters 'cs',
-     * 'yieldIterations' and 'yieldPeriod'.
+     * 'yieldIterations' and 'yieldPeriod'. A second tracker runs at a quarter of those intervals
+     * and triggers early yields while the storage engine reports cache pressure, so that
+     * long-running plans release their storage snapshots sooner when eviction is falling behind.
      *
      * If provided, the given 'yieldable' is released and restored by the 'PlanYieldPolicy' (in
      * addition to releasing/restoring locks and the storage engine snapshot).
@@ -310,6 +312,11 @@ private:
 
     bool _forceYield = false;
     ElapsedTracker _elapsedTracker;
+
+    // Runs at a quarter of '_elapsedTracker's intervals and is only consulted while the storage
+    // engine reports cache pressure. Yield points double as interrupt points, so intervals are
+    // only ever shortened, never lengthened, based on cache state.
+    ElapsedTracker _cachePressureTracker;
 };
 
 }  // namespace mongo
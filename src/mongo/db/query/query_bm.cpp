@@ -0,0 +1,290 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * End-to-end benchmarks for the query path: each iteration sends a complete OP_MSG command
+ * through the ServiceEntryPoint of a standalone, ephemeral mongod-like service context, so the
+ * measured cost includes operation context setup, command parsing, authorization, planning,
+ * execution, and reply building. The datasets cover the query classes the server hot paths are
+ * most sensitive to: point reads, indexed $in scans, $group aggregations, and $lookup joins.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/db/auth/authorization_manager_impl.h"
+#include "mongo/db/auth/authz_manager_external_state_mock.h"
+#include "mongo/db/catalog/collection_impl.h"
+#include "mongo/db/catalog/database_holder_impl.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/client_strand.h"
+#include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/index/index_access_method_factory_impl.h"
+#include "mongo/db/op_observer_registry.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/s/collection_sharding_state_factory_standalone.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_entry_point_mongod.h"
+#include "mongo/db/storage/control/storage_control.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/transport/transport_layer_mock.h"
+#include "mongo/unittest/temp_dir.h"
+
+namespace mongo {
+namespace {
+
+constexpr auto kDbName = "query_bm"_sd;
+const NamespaceString kDocsNss("query_bm", "docs");
+const NamespaceString kLookupNss("query_bm", "lookup");
+
+constexpr int kNumDocs = 10'000;
+constexpr int kNumDistinctAValues = 100;
+
+/**
+ * A standalone mongod in miniature with a single client, patterned on OpMsgFuzzerFixture: an
+ * ephemeral storage engine, a mocked replication coordinator, and the real
+ * ServiceEntryPointMongod in front of the real command, query, and catalog layers.
+ */
+class QueryBenchmarkFixture {
+public:
+    QueryBenchmarkFixture() : _dir("query_bm") {
+        setGlobalServiceContext(ServiceContext::make());
+        _session = _transportLayer.createSession();
+
+        _serviceContext = getGlobalServiceContext();
+
+        // The entry point consults the authorization session on every command; run with auth
+        // disabled the way a standalone without --auth does.
+        auto externalState = std::make_unique<AuthzManagerExternalStateMock>();
+        auto authzManager = std::make_unique<AuthorizationManagerImpl>(_serviceContext,
+                                                                       std::move(externalState));
+        authzManager->setAuthEnabled(false);
+        AuthorizationManager::set(_serviceContext, std::move(authzManager));
+
+        _serviceContext->setServiceEntryPoint(
+            std::make_unique<ServiceEntryPointMongod>(_serviceContext));
+        _serviceContext->setOpObserver(std::make_unique<OpObserverRegistry>());
+
+        _clientStrand = ClientStrand::make(_serviceContext->makeClient("queryBM", _session));
+        auto clientGuard = _clientStrand->bind();
+        auto opCtx = _serviceContext->makeOperationContext(clientGuard.get());
+
+        storageGlobalParams.dbpath = _dir.path();
+        storageGlobalParams.engine = "ephemeralForTest";
+        storageGlobalParams.engineSetByUser = true;
+        storageGlobalParams.repair = false;
+        serverGlobalParams.enableMajorityReadConcern = false;
+        // (Generic FCV reference): Initialize FCV.
+        serverGlobalParams.mutableFeatureCompatibility.setVersion(
+            multiversion::GenericFCV::kLatest);
+
+        initializeStorageEngine(opCtx.get(),
+                                StorageEngineInitFlags::kAllowNoLockFile |
+                                    StorageEngineInitFlags::kSkipMetadataFile);
+        StorageControl::startStorageControls(_serviceContext, true /*forTestOnly*/);
+
+        CollectionShardingStateFactory::set(
+            _serviceContext,
+            std::make_unique<CollectionShardingStateFactoryStandalone>(_serviceContext));
+        DatabaseHolder::set(_serviceContext, std::make_unique<DatabaseHolderImpl>());
+        IndexAccessMethodFactory::set(_serviceContext,
+                                      std::make_unique<IndexAccessMethodFactoryImpl>());
+        Collection::Factory::set(_serviceContext,
+                                 std::make_unique<CollectionImpl::FactoryImpl>());
+
+        repl::ReplicationCoordinator::set(_serviceContext,
+                                          std::make_unique<repl::ReplicationCoordinatorMock>(
+                                              _serviceContext, repl::ReplSettings()));
+
+        _serviceContext->getStorageEngine()->notifyStartupComplete();
+
+        _populateData(opCtx.get());
+    }
+
+    /**
+     * Runs one command message through the service entry point on a fresh operation context and
+     * asserts that the command succeeded.
+     */
+    void runRequest(const Message& message) {
+        auto clientGuard = _clientStrand->bind();
+        auto opCtx = _serviceContext->makeOperationContext(clientGuard.get());
+        auto dbResponse =
+            _serviceContext->getServiceEntryPoint()->handleRequest(opCtx.get(), message).get();
+        invariant(OpMsg::parse(dbResponse.response).body["ok"].trueValue());
+    }
+
+private:
+    void _populateData(OperationContext* opCtx) {
+        _createCollection(opCtx, kDocsNss);
+        _createCollection(opCtx, kLookupNss);
+        _createIndexOnEmptyCollection(opCtx, kDocsNss, BSON("a" << 1));
+        _createIndexOnEmptyCollection(opCtx, kLookupNss, BSON("a" << 1));
+
+        DBDirectClient client(opCtx);
+
+        const std::string payload(200, 'x');
+        std::vector<BSONObj> docs;
+        docs.reserve(kNumDocs);
+        for (int i = 0; i < kNumDocs; ++i) {
+            docs.push_back(
+                BSON("_id" << i << "a" << (i % kNumDistinctAValues) << "b" << i << "payload"
+                           << payload));
+        }
+        client.insert(kDocsNss.ns(), docs);
+        invariant(client.count(kDocsNss) == kNumDocs);
+
+        std::vector<BSONObj> lookupDocs;
+        lookupDocs.reserve(kNumDistinctAValues);
+        for (int i = 0; i < kNumDistinctAValues; ++i) {
+            lookupDocs.push_back(BSON("_id" << i << "a" << i << "tag" << (i % 7)));
+        }
+        client.insert(kLookupNss.ns(), lookupDocs);
+        invariant(client.count(kLookupNss) == kNumDistinctAValues);
+    }
+
+    void _createCollection(OperationContext* opCtx, const NamespaceString& nss) {
+        writeConflictRetry(opCtx, "createColl", nss.ns(), [&] {
+            AutoGetDb autoDb(opCtx, nss.db(), MODE_X);
+            auto db = autoDb.ensureDbExists(opCtx);
+            WriteUnitOfWork wuow(opCtx);
+            invariant(db->createCollection(opCtx, nss));
+            wuow.commit();
+        });
+    }
+
+    void _createIndexOnEmptyCollection(OperationContext* opCtx,
+                                       const NamespaceString& nss,
+                                       BSONObj keyPattern) {
+        writeConflictRetry(opCtx, "createIndex", nss.ns(), [&] {
+            AutoGetCollection autoColl(opCtx, nss, MODE_X);
+            WriteUnitOfWork wuow(opCtx);
+            auto collWriter = autoColl.getWritableCollection(opCtx);
+            invariant(collWriter->getIndexCatalog()
+                          ->createIndexOnEmptyCollection(
+                              opCtx,
+                              collWriter,
+                              BSON("v" << 2 << "name" << (keyPattern.firstElementFieldName() +
+                                                          std::string("_1"))
+                                       << "key" << keyPattern))
+                          .getStatus());
+            wuow.commit();
+        });
+    }
+
+    // This member is responsible for both creating and deleting the base directory.
+    const unittest::TempDir _dir;
+
+    ServiceContext* _serviceContext;
+    ClientStrandPtr _clientStrand;
+    transport::TransportLayerMock _transportLayer;
+    transport::SessionHandle _session;
+};
+
+QueryBenchmarkFixture& fixture() {
+    // Deliberately leaked: tearing down the storage engine during static destruction races
+    // thread_local destruction on the main thread (see OpMsgFuzzerFixture's destructor), and the
+    // process is exiting anyway.
+    static auto* instance = new QueryBenchmarkFixture();
+    return *instance;
+}
+
+Message makeCommandMessage(BSONObj body) {
+    return OpMsgRequest::fromDBAndBody(kDbName, std::move(body)).serialize();
+}
+
+void runQueryBenchmark(benchmark::State& state, const Message& message) {
+    auto& fix = fixture();
+    for (auto _ : state) {
+        fix.runRequest(message);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/** A single-document read by _id, the cheapest complete query the server answers. */
+void BM_PointReadById(benchmark::State& state) {
+    auto message = makeCommandMessage(BSON("find" << kDocsNss.coll() << "filter"
+                                                  << BSON("_id" << kNumDocs / 2) << "limit" << 1
+                                                  << "singleBatch" << true));
+    runQueryBenchmark(state, message);
+}
+
+/** An indexed $in scan returning ~1000 documents in a single batch. */
+void BM_IndexedInScan(benchmark::State& state) {
+    auto message = makeCommandMessage(
+        BSON("find" << kDocsNss.coll() << "filter"
+                    << BSON("a" << BSON("$in" << BSON_ARRAY(0 << 7 << 13 << 21 << 34 << 55 << 63
+                                                              << 72 << 88 << 99)))
+                    << "batchSize" << 2 * kNumDocs));
+    runQueryBenchmark(state, message);
+}
+
+/** A full-collection $group aggregation producing one group per distinct key. */
+void BM_GroupAggregation(benchmark::State& state) {
+    auto message = makeCommandMessage(
+        BSON("aggregate" << kDocsNss.coll() << "pipeline"
+                         << BSON_ARRAY(BSON("$group" << BSON("_id"
+                                                             << "$a"
+                                                             << "n" << BSON("$sum" << 1) << "total"
+                                                             << BSON("$sum"
+                                                                     << "$b"))))
+                         << "cursor" << BSONObj()));
+    runQueryBenchmark(state, message);
+}
+
+/** A $lookup join of 100 local documents against an indexed foreign collection. */
+void BM_LookupJoin(benchmark::State& state) {
+    auto message = makeCommandMessage(
+        BSON("aggregate" << kDocsNss.coll() << "pipeline"
+                         << BSON_ARRAY(BSON("$match" << BSON("_id" << BSON("$lt" << 100)))
+                                       << BSON("$lookup" << BSON("from"
+                                                                 << kLookupNss.coll()
+                                                                 << "localField"
+                                                                 << "a"
+                                                                 << "foreignField"
+                                                                 << "a"
+                                                                 << "as"
+                                                                 << "joined"))
+                                       << BSON("$count"
+                                               << "n"))
+                         << "cursor" << BSONObj()));
+    runQueryBenchmark(state, message);
+}
+
+BENCHMARK(BM_PointReadById);
+BENCHMARK(BM_IndexedInScan);
+BENCHMARK(BM_GroupAggregation);
+BENCHMARK(BM_LookupJoin);
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,185 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/query_results_cache.h"
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/query/query_planner_common.h"
+#include "mongo/db/repl/read_concern_args.h"
+
+namespace mongo {
+namespace {
+
+const auto getQueryResultsCache = ServiceContext::declareDecoration<QueryResultsCache>();
+
+// Accounts for the key strings and per-entry bookkeeping of the LRU store and generation map.
+constexpr size_t kPerEntryOverheadBytes = 256;
+
+}  // namespace
+
+QueryResultsCache& QueryResultsCache::get(ServiceContext* serviceContext) {
+    return getQueryResultsCache(serviceContext);
+}
+
+QueryResultsCache& QueryResultsCache::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+bool QueryResultsCache::isActive(ServiceContext* serviceContext) {
+    return get(serviceContext)._everUsed.loadRelaxed();
+}
+
+bool QueryResultsCache::isEligible(OperationContext* opCtx, const CanonicalQuery& cq) {
+    if (!internalQueryEnableResultsCache.load()) {
+        return false;
+    }
+
+    // A hit must be indistinguishable from re-running the query with local read concern on this
+    // node's current committed data.
+    if (opCtx->inMultiDocumentTransaction()) {
+        return false;
+    }
+    const auto& readConcern = repl::ReadConcernArgs::get(opCtx);
+    if (readConcern.getLevel() != repl::ReadConcernLevel::kLocalReadConcern ||
+        readConcern.getArgsAfterClusterTime() || readConcern.getArgsAtClusterTime()) {
+        return false;
+    }
+
+    // Some writes to system and 'local' collections (e.g. the oplog) do not pass through the op
+    // observer, so their generations cannot be trusted.
+    const auto& nss = cq.nss();
+    if (nss.isSystem() || nss.isLocal()) {
+        return false;
+    }
+
+    const auto& findCommand = cq.getFindCommandRequest();
+    if (findCommand.getTailable() || findCommand.getAwaitData() ||
+        findCommand.getRequestResumeToken() || !findCommand.getResumeAfter().isEmpty() ||
+        findCommand.getReadOnce()) {
+        return false;
+    }
+
+    // $expr may reference time-dependent variables such as $$NOW, and $where runs arbitrary
+    // JavaScript; neither is a pure function of the collection contents.
+    if (QueryPlannerCommon::hasNode(cq.root(), MatchExpression::EXPRESSION) ||
+        QueryPlannerCommon::hasNode(cq.root(), MatchExpression::WHERE)) {
+        return false;
+    }
+
+    return true;
+}
+
+std::string QueryResultsCache::computeKey(const CanonicalQuery& cq) {
+    BSONObj serialized = cq.getFindCommandRequest().toBSON(BSONObj());
+    return {serialized.objdata(), static_cast<size_t>(serialized.objsize())};
+}
+
+QueryResultsCache::QueryResultsCache()
+    : _entries(static_cast<size_t>(internalQueryResultsCacheMaxSizeBytes)) {}
+
+boost::optional<std::vector<BSONObj>> QueryResultsCache::lookup(const UUID& collectionUuid,
+                                                                const std::string& key) {
+    _everUsed.store(true);
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto statusWithEntry = _entries.get({collectionUuid, key});
+    if (!statusWithEntry.isOK()) {
+        return boost::none;
+    }
+
+    auto* entry = statusWithEntry.getValue();
+    auto generationIt = _writeGenerations.find(entry->ns);
+    if (generationIt == _writeGenerations.end() ||
+        generationIt->second != entry->writeGeneration) {
+        // A write has committed since this batch was produced.
+        _entries.erase({collectionUuid, key});
+        return boost::none;
+    }
+
+    return entry->firstBatch;
+}
+
+uint64_t QueryResultsCache::writeGeneration(const std::string& ns) {
+    _everUsed.store(true);
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    return _writeGenerations.try_emplace(ns, 0).first->second;
+}
+
+void QueryResultsCache::add(const UUID& collectionUuid,
+                            const std::string& ns,
+                            std::string key,
+                            uint64_t writeGeneration,
+                            std::vector<BSONObj> firstBatch) {
+    size_t sizeBytes = kPerEntryOverheadBytes + key.size();
+    for (const auto& obj : firstBatch) {
+        sizeBytes += obj.objsize();
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto generationIt = _writeGenerations.find(ns);
+    if (generationIt == _writeGenerations.end() || generationIt->second != writeGeneration) {
+        // A write committed while the batch was being produced; it may not be reflected in the
+        // batch, so do not cache it.
+        return;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->firstBatch = std::move(firstBatch);
+    entry->ns = ns;
+    entry->writeGeneration = writeGeneration;
+    entry->sizeBytes = sizeBytes;
+    _entries.add({collectionUuid, std::move(key)}, entry.release());
+}
+
+void QueryResultsCache::notifyOfWrite(const std::string& ns) {
+    if (!_everUsed.loadRelaxed()) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    // Only collections that have been queried through the cache have a generation to maintain.
+    if (auto it = _writeGenerations.find(ns); it != _writeGenerations.end()) {
+        ++it->second;
+    }
+}
+
+void QueryResultsCache::clear() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entries.clear();
+    // Bump the generations rather than dropping them so that any in-flight fill that captured its
+    // generation before the clear can never validate in add().
+    for (auto& [ns, generation] : _writeGenerations) {
+        ++generation;
+    }
+}
+
+}  // namespace mongo
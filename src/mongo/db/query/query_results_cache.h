@@ -0,0 +1,174 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/query/lru_key_value.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+
+class CanonicalQuery;
+class OperationContext;
+
+/**
+ * A server-wide cache of complete find command first batches, keyed by collection UUID and the
+ * exact serialized request the client issued. A cached batch is only served while it is
+ * indistinguishable from re-running the query with local read concern, so workloads that re-issue
+ * identical read-only queries (e.g. a dashboard tier) skip query execution entirely on repeats.
+ *
+ * Staleness is tracked with a per-collection write generation. Committed writes bump the
+ * generation of their collection (notifyOfWrite(), driven from the op observer via an onCommit
+ * handler), and an entry is only served while the generation recorded when it was filled is still
+ * current, making invalidation a counter comparison rather than an entry scan. For this to be
+ * sound the reader must capture the generation (writeGeneration()) BEFORE its storage snapshot is
+ * opened: any write missing from the snapshot then commits after the capture, so its bump
+ * invalidates the entry being filled. Generations are keyed by namespace so they can be captured
+ * before any locks are taken; entries are keyed by UUID so a drop and recreate of a collection can
+ * never serve results across incarnations.
+ *
+ * The cache is opt-in via 'internalQueryEnableResultsCache', and its memory footprint is bounded
+ * by 'internalQueryResultsCacheMaxSizeBytes' with LRU eviction. Eligibility is deliberately
+ * narrow; see isEligible().
+ */
+class QueryResultsCache {
+public:
+    static QueryResultsCache& get(ServiceContext* serviceContext);
+    static QueryResultsCache& get(OperationContext* opCtx);
+
+    /**
+     * Returns true if the cache has ever been consulted on this server. Writes only need to
+     * maintain generations once that has happened; this stays true even if the cache is later
+     * disabled so that entries filled earlier can never be revalidated by mistake.
+     */
+    static bool isActive(ServiceContext* serviceContext);
+
+    /**
+     * Whether results of 'cq' may be served from or stored into the cache. Requires local read
+     * concern outside of a transaction with no afterClusterTime, and rejects cursor options whose
+     * results are not a pure function of the collection's committed contents (tailable,
+     * resumable, readOnce) as well as $expr and $where predicates, which may depend on evaluation
+     * time. System and 'local' collections are excluded since some writes to them bypass the op
+     * observer. The caller must additionally exclude capped collections (whose deletes happen
+     * below the op observer) and shard-versioned queries (whose ownership filter can change
+     * without a local write).
+     */
+    static bool isEligible(OperationContext* opCtx, const CanonicalQuery& cq);
+
+    /**
+     * Computes the cache key for 'cq'. This is the full serialized find command rather than the
+     * plan cache's shape encoding: the latter strips out the filter's constants, which must
+     * obviously discriminate here.
+     */
+    static std::string computeKey(const CanonicalQuery& cq);
+
+    QueryResultsCache();
+
+    /**
+     * Returns the cached first batch for the given collection and key if present and still
+     * current, and boost::none otherwise. Stale entries encountered are removed.
+     */
+    boost::optional<std::vector<BSONObj>> lookup(const UUID& collectionUuid,
+                                                 const std::string& key);
+
+    /**
+     * Returns the current write generation for 'ns', creating it at zero on first use. Must be
+     * called before the storage snapshot the results will be read from is opened; pass the result
+     * to add() once the batch has been produced.
+     */
+    uint64_t writeGeneration(const std::string& ns);
+
+    /**
+     * Caches 'firstBatch' under the given collection and key. A no-op if a write has committed
+     * since 'writeGeneration' was captured, since the batch may then predate that write.
+     */
+    void add(const UUID& collectionUuid,
+             const std::string& ns,
+             std::string key,
+             uint64_t writeGeneration,
+             std::vector<BSONObj> firstBatch);
+
+    /**
+     * Invalidates cached results for 'ns' by bumping its write generation. Called after a write to
+     * the collection has committed.
+     */
+    void notifyOfWrite(const std::string& ns);
+
+    /**
+     * Drops all cached results and advances every generation, e.g. on replication rollback, which
+     * rewinds data without the writes passing through the op observer.
+     */
+    void clear();
+
+private:
+    struct Key {
+        UUID collectionUuid;
+        std::string query;
+
+        bool operator==(const Key& other) const {
+            return collectionUuid == other.collectionUuid && query == other.query;
+        }
+    };
+
+    struct KeyHasher {
+        std::size_t operator()(const Key& key) const {
+            return UUID::Hash{}(key.collectionUuid) ^ std::hash<std::string>{}(key.query);
+        }
+    };
+
+    struct Entry {
+        std::vector<BSONObj> firstBatch;
+        std::string ns;
+        uint64_t writeGeneration;
+        size_t sizeBytes;
+    };
+
+    struct EntryEstimator {
+        size_t operator()(const Entry& entry) const {
+            return entry.sizeBytes;
+        }
+    };
+
+    // Set on first use and never reset; lets notifyOfWrite() bail with a single relaxed load on
+    // deployments that never enable the cache.
+    AtomicWord<bool> _everUsed{false};
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("QueryResultsCache::_mutex");
+    LRUKeyValue<Key, Entry, EntryEstimator, KeyHasher> _entries;
+    stdx::unordered_map<std::string, uint64_t> _writeGenerations;
+};
+
+}  // namespace mongo
@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/query_results_cache.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace {
+
+const std::string kNs = "test.coll";
+const std::string kKey = "key";
+
+std::vector<BSONObj> makeBatch() {
+    return {fromjson("{_id: 1, a: 1}"), fromjson("{_id: 2, a: 2}")};
+}
+
+TEST(QueryResultsCacheTest, AddedBatchIsServedWhileGenerationIsUnchanged) {
+    QueryResultsCache cache;
+    auto uuid = UUID::gen();
+
+    ASSERT_FALSE(cache.lookup(uuid, kKey));
+
+    auto generation = cache.writeGeneration(kNs);
+    cache.add(uuid, kNs, kKey, generation, makeBatch());
+
+    auto cached = cache.lookup(uuid, kKey);
+    ASSERT_TRUE(cached);
+    ASSERT_EQ(cached->size(), 2U);
+    ASSERT_BSONOBJ_EQ((*cached)[0], fromjson("{_id: 1, a: 1}"));
+}
+
+TEST(QueryResultsCacheTest, WriteInvalidatesCachedBatch) {
+    QueryResultsCache cache;
+    auto uuid = UUID::gen();
+
+    auto generation = cache.writeGeneration(kNs);
+    cache.add(uuid, kNs, kKey, generation, makeBatch());
+    ASSERT_TRUE(cache.lookup(uuid, kKey));
+
+    cache.notifyOfWrite(kNs);
+    ASSERT_FALSE(cache.lookup(uuid, kKey));
+
+    // A batch filled against the new generation is served again.
+    cache.add(uuid, kNs, kKey, cache.writeGeneration(kNs), makeBatch());
+    ASSERT_TRUE(cache.lookup(uuid, kKey));
+}
+
+TEST(QueryResultsCacheTest, AddIsSkippedWhenWriteCommittedDuringFill) {
+    QueryResultsCache cache;
+    auto uuid = UUID::gen();
+
+    // A write commits between the generation capture and the batch being cached.
+    auto generation = cache.writeGeneration(kNs);
+    cache.notifyOfWrite(kNs);
+    cache.add(uuid, kNs, kKey, generation, makeBatch());
+
+    ASSERT_FALSE(cache.lookup(uuid, kKey));
+}
+
+TEST(QueryResultsCacheTest, LeastRecentlyUsedEntriesAreEvictedWhenOverBudget) {
+    auto previousLimit = internalQueryResultsCacheMaxSizeBytes;
+    internalQueryResultsCacheMaxSizeBytes = 1024;
+    ON_BLOCK_EXIT([&] { internalQueryResultsCacheMaxSizeBytes = previousLimit; });
+
+    QueryResultsCache cache;
+    auto uuid = UUID::gen();
+    auto generation = cache.writeGeneration(kNs);
+
+    // Each entry costs a few hundred bytes of overhead, so a handful blows the 1KB budget.
+    for (int i = 0; i < 10; ++i) {
+        cache.add(uuid, kNs, "key" + std::to_string(i), generation, makeBatch());
+    }
+
+    ASSERT_FALSE(cache.lookup(uuid, "key0"));
+    ASSERT_TRUE(cache.lookup(uuid, "key9"));
+}
+
+TEST(QueryResultsCacheTest, ClearDropsEntriesAndGenerations) {
+    QueryResultsCache cache;
+    auto uuid = UUID::gen();
+
+    auto generation = cache.writeGeneration(kNs);
+    cache.notifyOfWrite(kNs);
+    cache.notifyOfWrite(kNs);
+    cache.clear();
+
+    ASSERT_FALSE(cache.lookup(uuid, kKey));
+    // The clear advances generations so that a batch captured before it can never validate.
+    ASSERT_EQ(cache.writeGeneration(kNs), generation + 3);
+}
+
+}  // namespace
+}  // namespace mongo
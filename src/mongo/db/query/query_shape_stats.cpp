@@ -0,0 +1,175 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query/query_shape_stats.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/curop.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/canonical_query_encoder.h"
+#include "mongo/db/query/plan_explainer.h"
+#include "mongo/db/query/plan_summary_stats.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+namespace {
+
+const auto getQueryShapeStats = ServiceContext::declareDecoration<QueryShapeStats>();
+
+class QueryShapeStatsServerStatusSection final : public ServerStatusSection {
+public:
+    QueryShapeStatsServerStatusSection() : ServerStatusSection("queryShapeStats") {}
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder builder;
+        QueryShapeStats::get(opCtx->getServiceContext()).append(&builder);
+        return builder.obj();
+    }
+} queryShapeStatsServerStatusSection;
+
+}  // namespace
+
+QueryShapeStats& QueryShapeStats::get(ServiceContext* service) {
+    return getQueryShapeStats(service);
+}
+
+void QueryShapeStats::record(OperationContext* opCtx,
+                             const CanonicalQuery& cq,
+                             const PlanExplainer& explainer,
+                             const PlanSummaryStats& summaryStats) {
+    // Reuse the query hash computed during planning when available; it is the hash of the same
+    // shape encoding that CanonicalQuery::encodeKey() produces.
+    auto curOp = CurOp::get(opCtx);
+    const uint32_t queryHash = curOp->debug().queryHash
+        ? *curOp->debug().queryHash
+        : canonical_query_encoder::computeHash(cq.encodeKey());
+
+    const uint64_t shapeKey = (static_cast<uint64_t>(queryHash) << 1) | 1;
+
+    Bucket* bucket = &_buckets[queryHash % kNumBuckets];
+    uint64_t existing = bucket->shapeKey.load();
+    if (existing != shapeKey) {
+        if (existing != 0 || !bucket->shapeKey.compareAndSwap(&existing, shapeKey)) {
+            // The bucket may still be ours if another thread claimed it for the same shape
+            // concurrently; otherwise it belongs to a different shape.
+            if (existing != shapeKey) {
+                bucket = &_otherShapes;
+            }
+        }
+    }
+
+    const long long micros = durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses());
+
+    const long long count = bucket->count.addAndFetch(1);
+    bucket->totalMicros.fetchAndAdd(micros);
+    bucket->totalDocsExamined.fetchAndAdd(static_cast<long long>(summaryStats.totalDocsExamined));
+    bucket->totalKeysExamined.fetchAndAdd(static_cast<long long>(summaryStats.totalKeysExamined));
+    bucket->totalReturned.fetchAndAdd(static_cast<long long>(summaryStats.nReturned));
+
+    auto maxMicros = bucket->maxMicros.load();
+    while (micros > maxMicros && !bucket->maxMicros.compareAndSwap(&maxMicros, micros)) {
+    }
+
+    // Reservoir sampling with a reservoir of size one: replacing the exemplar with probability
+    // 1/count gives every execution of the shape an equal chance to be the one kept.
+    if (opCtx->getClient()->getPrng().nextInt64(count) != 0) {
+        return;
+    }
+
+    BSONObjBuilder exemplarBuilder;
+    exemplarBuilder.append("ns", cq.ns());
+    const auto& findCommand = cq.getFindCommandRequest();
+    exemplarBuilder.append("filter", findCommand.getFilter());
+    if (!findCommand.getSort().isEmpty()) {
+        exemplarBuilder.append("sort", findCommand.getSort());
+    }
+    if (!findCommand.getProjection().isEmpty()) {
+        exemplarBuilder.append("projection", findCommand.getProjection());
+    }
+    exemplarBuilder.append("planSummary", explainer.getPlanSummary());
+    exemplarBuilder.append("micros", micros);
+    exemplarBuilder.append("docsExamined", static_cast<long long>(summaryStats.totalDocsExamined));
+    exemplarBuilder.append("keysExamined", static_cast<long long>(summaryStats.totalKeysExamined));
+    exemplarBuilder.append("nReturned", static_cast<long long>(summaryStats.nReturned));
+    exemplarBuilder.append("ts", Date_t::now());
+    auto exemplar = exemplarBuilder.obj();
+
+    stdx::unique_lock<Latch> lk(bucket->exemplarMutex, stdx::try_to_lock);
+    if (lk) {
+        bucket->exemplar = std::move(exemplar);
+    }
+}
+
+void QueryShapeStats::append(BSONObjBuilder* builder) const {
+    {
+        BSONObjBuilder shapesBuilder(builder->subobjStart("shapes"));
+        for (auto&& bucket : _buckets) {
+            const auto shapeKey = bucket.shapeKey.load();
+            if (!shapeKey) {
+                continue;
+            }
+            const auto queryHash = static_cast<uint32_t>(shapeKey >> 1);
+            BSONObjBuilder shapeBuilder(shapesBuilder.subobjStart(zeroPaddedHex(queryHash)));
+            _appendBucket(bucket, &shapeBuilder);
+        }
+    }
+
+    if (_otherShapes.count.load() > 0) {
+        BSONObjBuilder otherBuilder(builder->subobjStart("otherShapes"));
+        _appendBucket(_otherShapes, &otherBuilder);
+    }
+}
+
+void QueryShapeStats::_appendBucket(const Bucket& bucket, BSONObjBuilder* builder) {
+    builder->append("count", bucket.count.load());
+    builder->append("totalMicros", bucket.totalMicros.load());
+    builder->append("maxMicros", bucket.maxMicros.load());
+    builder->append("totalDocsExamined", bucket.totalDocsExamined.load());
+    builder->append("totalKeysExamined", bucket.totalKeysExamined.load());
+    builder->append("totalReturned", bucket.totalReturned.load());
+
+    BSONObj exemplar;
+    {
+        stdx::lock_guard<Latch> lk(bucket.exemplarMutex);
+        exemplar = bucket.exemplar;
+    }
+    if (!exemplar.isEmpty()) {
+        builder->append("exemplar", exemplar);
+    }
+}
+
+}  // namespace mongo
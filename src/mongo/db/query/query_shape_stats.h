@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class CanonicalQuery;
+class OperationContext;
+class PlanExplainer;
+class ServiceContext;
+struct PlanSummaryStats;
+
+/**
+ * An always-on registry of per-query-shape execution statistics, so that regressing shapes can be
+ * found in production without enabling the profiler. Shapes are identified by the query hash
+ * (the hash of the shape encoding produced by CanonicalQuery::encodeKey(), the same value the
+ * slow query log reports) and aggregated into a fixed-size table of atomic summaries, so the
+ * per-query cost is a handful of relaxed atomic additions. Each shape additionally keeps one
+ * reservoir-sampled exemplar execution, giving every execution of the shape an equal chance to be
+ * the one on display.
+ *
+ * Two different shapes hashing to the same table slot are not aggregated together: the slot
+ * belongs to whichever shape claimed it first, and later shapes are accounted to a single
+ * overflow summary. Readable through the 'queryShapeStats' serverStatus section, which is
+ * excluded from the default serverStatus output.
+ */
+class QueryShapeStats {
+public:
+    static QueryShapeStats& get(ServiceContext* service);
+
+    /**
+     * Records one execution of 'cq' into the shape's summary. 'summaryStats' must already be
+     * populated and the operation's CurOp must reflect the execution time.
+     */
+    void record(OperationContext* opCtx,
+                const CanonicalQuery& cq,
+                const PlanExplainer& explainer,
+                const PlanSummaryStats& summaryStats);
+
+    /**
+     * Appends all non-empty shape summaries, keyed by their zero-padded hexadecimal query hash.
+     */
+    void append(BSONObjBuilder* builder) const;
+
+private:
+    struct Bucket {
+        // Zero while the bucket is unclaimed; otherwise the owning shape's query hash, offset so
+        // that a shape whose hash is zero remains distinguishable from an empty bucket.
+        AtomicWord<uint64_t> shapeKey;
+
+        AtomicWord<long long> count;
+        AtomicWord<long long> totalMicros;
+        AtomicWord<long long> maxMicros;
+        AtomicWord<long long> totalDocsExamined;
+        AtomicWord<long long> totalKeysExamined;
+        AtomicWord<long long> totalReturned;
+
+        // A sampled exemplar execution of the shape: the concrete query, its plan summary and its
+        // execution statistics. Only written when the reservoir selects a new sample, so the
+        // mutex is almost never contended; writers that do find it contended skip the sample.
+        mutable Mutex exemplarMutex = MONGO_MAKE_LATCH("QueryShapeStats::Bucket::exemplarMutex");
+        BSONObj exemplar;
+    };
+
+    static constexpr size_t kNumBuckets = 1024;
+
+    static void _appendBucket(const Bucket& bucket, BSONObjBuilder* builder);
+
+    std::array<Bucket, kNumBuckets> _buckets;
+
+    // Summary of executions whose shape lost the race for its bucket to a different shape.
+    Bucket _otherShapes;
+};
+
+}  // namespace mongo
@@ -1603,7 +1603,7 @@ public:
         return kName.rawData();
     }
     explicit AccumulatorSBEIncompatible(ExpressionContext* expCtx) : AccumulatorState(expCtx) {}
-    void processInternal(const Value& input, bool merging) final {}
+    void processInternal(Value input, bool merging) final {}
     Value getValue(bool toBeMerged) final {
         return Value(true);
     }
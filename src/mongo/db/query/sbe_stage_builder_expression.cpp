@@ -356,6 +356,9 @@ public:
     void visit(const ExpressionDateToString* expr) final {}
     void visit(const ExpressionDateTrunc* expr) final {}
     void visit(const ExpressionDivide* expr) final {}
+    void visit(const ExpressionDotProduct* expr) final {}
+    void visit(const ExpressionEuclideanDistance* expr) final {}
+    void visit(const ExpressionCosineSimilarity* expr) final {}
     void visit(const ExpressionExp* expr) final {}
     void visit(const ExpressionFieldPath* expr) final {}
     void visit(const ExpressionFilter* expr) final {
@@ -529,6 +532,9 @@ public:
     void visit(const ExpressionDateToString* expr) final {}
     void visit(const ExpressionDateTrunc*) final {}
     void visit(const ExpressionDivide* expr) final {}
+    void visit(const ExpressionDotProduct* expr) final {}
+    void visit(const ExpressionEuclideanDistance* expr) final {}
+    void visit(const ExpressionCosineSimilarity* expr) final {}
     void visit(const ExpressionExp* expr) final {}
     void visit(const ExpressionFieldPath* expr) final {}
     void visit(const ExpressionFilter* expr) final {
@@ -1846,6 +1852,15 @@ public:
         _context->pushExpr(
             sbe::makeE<sbe::ELocalBind>(frameId, std::move(binds), std::move(divideExpr)));
     }
+    void visit(const ExpressionDotProduct* expr) final {
+        generateArrayDistanceExpression("dotProduct");
+    }
+    void visit(const ExpressionEuclideanDistance* expr) final {
+        generateArrayDistanceExpression("euclideanDistance");
+    }
+    void visit(const ExpressionCosineSimilarity* expr) final {
+        generateArrayDistanceExpression("cosineSimilarity");
+    }
     void visit(const ExpressionExp* expr) final {
         auto frameId = _context->state.frameId();
         auto binds = sbe::makeEs(_context->popExpr());
@@ -3337,6 +3352,50 @@ private:
             frameId, std::move(binds), std::move(genericTrignomentricExpr)));
     }
 
+    /**
+     * Shared expression building logic for the array distance measures ($dotProduct,
+     * $euclideanDistance and $cosineSimilarity). The VM builtins return Nothing when either
+     * operand is not an array of numbers or when the arrays differ in length, which we translate
+     * into an error to match the corresponding aggregation expressions.
+     */
+    void generateArrayDistanceExpression(StringData exprName) {
+        _context->ensureArity(2);
+
+        auto arrayDistanceExpr = makeLocalBind(
+            _context->state.frameIdGenerator,
+            [&](sbe::EVariable lhs, sbe::EVariable rhs) {
+                return buildMultiBranchConditional(
+                    CaseValuePair{makeBinaryOp(sbe::EPrimBinary::logicOr,
+                                               generateNullOrMissing(lhs),
+                                               generateNullOrMissing(rhs)),
+                                  makeConstant(sbe::value::TypeTags::Null, 0)},
+                    CaseValuePair{
+                        makeBinaryOp(sbe::EPrimBinary::logicAnd,
+                                     makeFunction("isArray", lhs.clone()),
+                                     makeFunction("isArray", rhs.clone())),
+                        makeLocalBind(
+                            _context->state.frameIdGenerator,
+                            [&](sbe::EVariable result) {
+                                return sbe::makeE<sbe::EIf>(
+                                    makeFunction("exists", result.clone()),
+                                    result.clone(),
+                                    sbe::makeE<sbe::EFail>(
+                                        ErrorCodes::Error{6929916},
+                                        str::stream()
+                                            << "$" << exprName
+                                            << " requires equal-length arrays of numbers"));
+                            },
+                            makeFunction(exprName.toString(), lhs.clone(), rhs.clone())),
+                    },
+                    sbe::makeE<sbe::EFail>(ErrorCodes::Error{6929915},
+                                           str::stream() << "$" << exprName
+                                                         << " requires array operands"));
+            },
+            _context->popExpr(),
+            _context->popExpr());
+        _context->pushExpr(std::move(arrayDistanceExpr));
+    }
+
     /**
      * Shared expression building logic for binary trigonometric expressions to make sure the
      * operands are numeric and are not null.
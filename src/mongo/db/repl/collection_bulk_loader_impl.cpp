@@ -141,21 +141,23 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
                 int bytesInBlock = 0;
                 locs.clear();
 
-                auto onRecordInserted = [&](const RecordId& location) {
-                    locs.emplace_back(location);
-                    return Status::OK();
-                };
-
+                std::vector<BSONObj> docs;
                 while (insertIter != end && bytesInBlock < collectionBulkLoaderBatchSizeInBytes) {
                     const auto& doc = *insertIter++;
                     bytesInBlock += doc.objsize();
-                    // This version of insert will not update any indexes.
-                    const auto status =
-                        (*_collection)
-                            ->insertDocumentForBulkLoader(_opCtx.get(), doc, onRecordInserted);
-                    if (!status.isOK()) {
-                        return status;
-                    }
+                    docs.push_back(doc);
+                }
+
+                // Insert the whole batch with a single vectored record store write. This does not
+                // update any indexes.
+                const auto status = (*_collection)
+                                        ->insertDocumentsForBulkLoader(
+                                            _opCtx.get(), docs, [&](const RecordId& location) {
+                                                locs.emplace_back(location);
+                                                return Status::OK();
+                                            });
+                if (!status.isOK()) {
+                    return status;
                 }
 
                 wunit.commit();
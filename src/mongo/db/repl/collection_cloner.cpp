@@ -373,8 +373,14 @@ void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
     _firstBatchOfQueryRound = false;
 
     {
-        stdx::lock_guard<Latch> lk(_mutex);
+        stdx::unique_lock<Latch> lk(_mutex);
+        // Block the exhaust stream while the database writer has fallen too far behind, so that
+        // TCP flow control applies backpressure to the sync source instead of this buffer
+        // growing without bound.
+        _pendingBatchesDrained.wait(
+            lk, [&] { return _pendingBatches < collectionClonerMaxPendingBatches; });
         _stats.receivedBatches++;
+        _pendingBatches++;
         while (iter.moreInCurrentBatch()) {
             _documentsToInsert.emplace_back(iter.nextSafe());
         }
@@ -416,11 +422,17 @@ void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
 }
 
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
-    uassertStatusOK(cbd.status);
-
+    std::vector<BSONObj> docs;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        std::vector<BSONObj> docs;
+        // The batch counts as handed off to the writer even if this task was canceled, so the
+        // network thread waiting in handleNextBatch() can always make progress.
+        invariant(_pendingBatches > 0);
+        --_pendingBatches;
+        _pendingBatchesDrained.notify_one();
+
+        uassertStatusOK(cbd.status);
+
         // Increment 'fetchedBatches' even if no documents were inserted to match the number of
         // 'receivedBatches'.
         ++_stats.fetchedBatches;
@@ -436,12 +448,14 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
         _progressMeter.hit(int(docs.size()));
         invariant(_collLoader);
-
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
     }
 
+    // The insert happens outside the mutex so the exhaust stream in handleNextBatch() can keep
+    // buffering the next batches while this one is written. CollectionBulkLoader is not thread
+    // safe, but needs no locking here: the TaskRunner executes scheduled tasks strictly in order,
+    // and queryStage() only commits the loader after the task runner is drained.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend()));
+
     initialSyncHangDuringCollectionClone.executeIf(
         [&](const BSONObj&) {
             LOGV2(21138,
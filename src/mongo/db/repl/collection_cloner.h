@@ -36,6 +36,7 @@
 #include "mongo/db/repl/initial_sync_base_cloner.h"
 #include "mongo/db/repl/initial_sync_shared_data.h"
 #include "mongo/db/repl/task_runner.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/progress_meter.h"
 
 namespace mongo {
@@ -250,12 +251,19 @@ private:
     std::vector<BSONObj> _readyIndexSpecs;              // (X) Except for _id_
     std::vector<BSONObj> _unfinishedIndexSpecs;         // (X)
     BSONObj _idIndexSpec;                               // (X)
+    // Also used from database work tasks, which are serialized with each other and with the main
+    // flow of control by _dbWorkTaskRunner.
     std::unique_ptr<CollectionBulkLoader> _collLoader;  // (X)
     //  Function for scheduling database work using the executor.
     ScheduleDbWorkFn _scheduleDbWorkFn;  // (R)
     // Documents read from source to insert.
     std::vector<BSONObj> _documentsToInsert;  // (M)
-    Stats _stats;                             // (M)
+    // Number of fetched batches the database writer has not yet picked up. The network thread
+    // stops reading from the sync source while this reaches collectionClonerMaxPendingBatches.
+    int _pendingBatches = 0;  // (M)
+    // Signaled whenever _pendingBatches is decremented.
+    stdx::condition_variable _pendingBatchesDrained;  // (S)
+    Stats _stats;                                     // (M)
     // Putting _dbWorkTaskRunner last ensures anything the database work threads depend on,
     // like _documentsToInsert, is destroyed after those threads exit.
     TaskRunner _dbWorkTaskRunner;  // (R)
@@ -224,7 +224,8 @@ DbCheckHasher::DbCheckHasher(OperationContext* opCtx,
                              const BSONKey& start,
                              const BSONKey& end,
                              int64_t maxCount,
-                             int64_t maxBytes)
+                             int64_t maxBytes,
+                             bool inclusiveStart)
     : _opCtx(opCtx), _maxKey(end), _maxCount(maxCount), _maxBytes(maxBytes) {
 
     // Get the MD5 hasher set up.
@@ -241,7 +242,9 @@ DbCheckHasher::DbCheckHasher(OperationContext* opCtx,
                                            desc,
                                            start.obj(),
                                            end.obj(),
-                                           BoundInclusion::kIncludeEndKeyOnly,
+                                           inclusiveStart
+                                               ? BoundInclusion::kIncludeBothStartAndEndKeys
+                                               : BoundInclusion::kIncludeEndKeyOnly,
                                            PlanYieldPolicy::YieldPolicy::NO_YIELD,
                                            InternalPlanner::FORWARD,
                                            InternalPlanner::IXSCAN_FETCH);
@@ -255,7 +258,9 @@ DbCheckHasher::DbCheckHasher(OperationContext* opCtx,
             record_id_helpers::keyForDoc(end.obj(),
                                          collection->getClusteredInfo()->getIndexSpec(),
                                          collection->getDefaultCollator())));
-        params.boundInclusion = CollectionScanParams::ScanBoundInclusion::kIncludeEndRecordOnly;
+        params.boundInclusion = inclusiveStart
+            ? CollectionScanParams::ScanBoundInclusion::kIncludeBothStartAndEndRecords
+            : CollectionScanParams::ScanBoundInclusion::kIncludeEndRecordOnly;
         _exec = InternalPlanner::collectionScan(
             opCtx, &collection, params, PlanYieldPolicy::YieldPolicy::NO_YIELD);
     }
@@ -386,7 +391,13 @@ Status dbCheckBatchOnSecondary(OperationContext* opCtx,
             return Status::OK();
         }
 
-        hasher.emplace(opCtx, collection, entry.getMinKey(), entry.getMaxKey());
+        hasher.emplace(opCtx,
+                       collection,
+                       entry.getMinKey(),
+                       entry.getMaxKey(),
+                       std::numeric_limits<int64_t>::max(),
+                       std::numeric_limits<int64_t>::max(),
+                       entry.getInclusiveStart().value_or(false));
         uassertStatusOK(hasher->hashAll(opCtx));
 
         std::string expected = entry.getMd5().toString();
@@ -108,13 +108,17 @@ public:
      * @param end The last key to hash (inclusive).
      * @param maxCount The maximum number of documents to hash.
      * @param maxBytes The maximum number of bytes to hash.
+     * @param inclusiveStart Whether to hash the document with _id equal to `start` as well. Used
+     *                       by incremental dbCheck, whose range bounds are dirty keys that must
+     *                       themselves be checked.
      */
     DbCheckHasher(OperationContext* opCtx,
                   const CollectionPtr& collection,
                   const BSONKey& start,
                   const BSONKey& end,
                   int64_t maxCount = std::numeric_limits<int64_t>::max(),
-                  int64_t maxBytes = std::numeric_limits<int64_t>::max());
+                  int64_t maxBytes = std::numeric_limits<int64_t>::max(),
+                  bool inclusiveStart = false);
 
     /**
      * Hash all documents up to the deadline.
@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/repl/dbcheck_dirty_ranges.h"
+
+#include "mongo/db/repl/dbcheck_gen.h"
+
+namespace mongo {
+namespace {
+
+const auto getDbCheckDirtyRanges = ServiceContext::declareDecoration<DbCheckDirtyRanges>();
+
+// Maximum number of dirty keys a single returned range may span. Grouping nearby keys into one
+// range trades a little extra hashing of clean documents that happen to lie between them for
+// far fewer batches and oplog entries.
+constexpr size_t kMaxKeysPerRange = 64;
+
+}  // namespace
+
+DbCheckDirtyRanges& DbCheckDirtyRanges::get(ServiceContext* serviceContext) {
+    return getDbCheckDirtyRanges(serviceContext);
+}
+
+void DbCheckDirtyRanges::addKey(const NamespaceString& nss, const BSONElement& idElem) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto& state = _collections[nss.ns()];
+    if (state.overflowed) {
+        return;
+    }
+
+    state.keys.insert(BSONKey::parseFromBSON(idElem));
+    if (state.keys.size() > static_cast<size_t>(gDbCheckMaxDirtyKeysPerCollection.load())) {
+        state.keys.clear();
+        state.overflowed = true;
+    }
+}
+
+std::vector<DbCheckDirtyRanges::DirtyRange> DbCheckDirtyRanges::takeRanges(
+    const NamespaceString& nss) {
+    CollectionState state;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _collections.find(nss.ns());
+        if (it == _collections.end()) {
+            return {};
+        }
+        state = std::move(it->second);
+        _collections.erase(it);
+    }
+
+    if (state.overflowed) {
+        return {DirtyRange{BSONKey::min(), BSONKey::max()}};
+    }
+
+    // The keys come out of the set in sorted order, so consecutive groups of them form
+    // non-overlapping inclusive ranges.
+    std::vector<DirtyRange> ranges;
+    auto it = state.keys.begin();
+    while (it != state.keys.end()) {
+        DirtyRange range{*it, *it};
+        for (size_t n = 1; n < kMaxKeysPerRange && std::next(it) != state.keys.end(); n++) {
+            range.end = *++it;
+        }
+        ranges.push_back(std::move(range));
+        ++it;
+    }
+    return ranges;
+}
+
+void DbCheckDirtyRanges::clear(const NamespaceString& nss) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _collections.erase(nss.ns());
+}
+
+}  // namespace mongo
@@ -0,0 +1,92 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/dbcheck_idl.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo {
+
+/**
+ * Tracks the _id keys written to each replicated collection since the last incremental dbCheck
+ * run, so that steady-state consistency verification ({dbCheck: <coll>, onlyDirtyRanges: true})
+ * only needs to hash and compare the key ranges that have actually changed.
+ *
+ * Keys are recorded by DbCheckOpObserver as part of every insert, update and delete. To bound
+ * memory, at most 'dbCheckMaxDirtyKeysPerCollection' keys are retained per collection; beyond
+ * that the collection degrades to a single full-range check, which is what a non-incremental
+ * dbCheck would have done anyway.
+ */
+class DbCheckDirtyRanges {
+public:
+    /**
+     * An inclusive range of _id keys to check.
+     */
+    struct DirtyRange {
+        BSONKey start;
+        BSONKey end;
+    };
+
+    static DbCheckDirtyRanges& get(ServiceContext* serviceContext);
+
+    /**
+     * Records that the document with the given _id element has been written to 'nss'.
+     */
+    void addKey(const NamespaceString& nss, const BSONElement& idElem);
+
+    /**
+     * Returns the dirty key ranges recorded for 'nss' since the last call, coalescing nearby
+     * keys, and resets the collection's state. Returns a single full range if the per-collection
+     * key limit was exceeded.
+     */
+    std::vector<DirtyRange> takeRanges(const NamespaceString& nss);
+
+    /**
+     * Discards all state for 'nss'. Called when the collection is dropped.
+     */
+    void clear(const NamespaceString& nss);
+
+private:
+    struct CollectionState {
+        std::set<BSONKey> keys;
+        bool overflowed = false;
+    };
+
+    Mutex _mutex = MONGO_MAKE_LATCH("DbCheckDirtyRanges::_mutex");
+    stdx::unordered_map<std::string, CollectionState> _collections;
+};
+
+}  // namespace mongo
@@ -0,0 +1,80 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/repl/dbcheck_op_observer.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/repl/dbcheck_dirty_ranges.h"
+
+namespace mongo {
+namespace {
+
+void addDirtyKey(OperationContext* opCtx, const NamespaceString& nss, const BSONElement& idElem) {
+    if (!nss.isReplicated() || idElem.eoo()) {
+        return;
+    }
+    DbCheckDirtyRanges::get(opCtx->getServiceContext()).addKey(nss, idElem);
+}
+
+}  // namespace
+
+void DbCheckOpObserver::onInserts(OperationContext* opCtx,
+                                  const NamespaceString& nss,
+                                  const UUID& uuid,
+                                  std::vector<InsertStatement>::const_iterator begin,
+                                  std::vector<InsertStatement>::const_iterator end,
+                                  bool fromMigrate) {
+    for (auto it = begin; it != end; it++) {
+        addDirtyKey(opCtx, nss, it->doc["_id"]);
+    }
+}
+
+void DbCheckOpObserver::onUpdate(OperationContext* opCtx, const OplogUpdateEntryArgs& args) {
+    addDirtyKey(opCtx, args.nss, args.updateArgs->updatedDoc["_id"]);
+}
+
+void DbCheckOpObserver::aboutToDelete(OperationContext* opCtx,
+                                      const NamespaceString& nss,
+                                      const UUID& uuid,
+                                      const BSONObj& doc) {
+    addDirtyKey(opCtx, nss, doc["_id"]);
+}
+
+repl::OpTime DbCheckOpObserver::onDropCollection(OperationContext* opCtx,
+                                                 const NamespaceString& collectionName,
+                                                 const UUID& uuid,
+                                                 std::uint64_t numRecords,
+                                                 const CollectionDropType dropType) {
+    DbCheckDirtyRanges::get(opCtx->getServiceContext()).clear(collectionName);
+    return {};
+}
+
+}  // namespace mongo
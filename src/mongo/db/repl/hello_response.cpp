@@ -211,12 +211,20 @@ void HelloResponse::addToBSON(BSONObjBuilder* builder, bool useLegacyResponseFie
 }
 
 BSONObj HelloResponse::toBSON(bool useLegacyResponseFields) const {
-    BSONObjBuilder builder;
-    addToBSON(&builder, useLegacyResponseFields);
-    return builder.obj();
+    stdx::lock_guard<Latch> lk(_bsonCacheMutex);
+    auto& cached = _cachedBSON[useLegacyResponseFields ? 1 : 0];
+    if (!cached) {
+        BSONObjBuilder builder;
+        addToBSON(&builder, useLegacyResponseFields);
+        cached = builder.obj();
+    }
+    // Copying a BSONObj shares its underlying buffer, so every caller serializing the same
+    // response gets the same serialization.
+    return *cached;
 }
 
 Status HelloResponse::initialize(const BSONObj& doc) {
+    _invalidateCachedBSON();
     Status status = bsonExtractBooleanField(doc, kIsMasterFieldName, &_isWritablePrimary);
     if (!status.isOK()) {
         return status;
@@ -502,104 +510,131 @@ Status HelloResponse::initialize(const BSONObj& doc) {
 }
 
 void HelloResponse::setIsWritablePrimary(bool isWritablePrimary) {
+    _invalidateCachedBSON();
     _isWritablePrimarySet = true;
     _isWritablePrimary = isWritablePrimary;
 }
 
 void HelloResponse::setIsSecondary(bool secondary) {
+    _invalidateCachedBSON();
     _isSecondarySet = true;
     _secondary = secondary;
 }
 
 void HelloResponse::setReplSetName(StringData setName) {
+    _invalidateCachedBSON();
     _setNameSet = true;
     _setName = setName.toString();
 }
 
 void HelloResponse::setReplSetVersion(long long version) {
+    _invalidateCachedBSON();
     _setVersionSet = true;
     _setVersion = version;
 }
 
 void HelloResponse::addHost(const HostAndPort& host) {
+    _invalidateCachedBSON();
     _hostsSet = true;
     _hosts.push_back(host);
 }
 
 void HelloResponse::addPassive(const HostAndPort& passive) {
+    _invalidateCachedBSON();
     _passivesSet = true;
     _passives.push_back(passive);
 }
 
 void HelloResponse::addArbiter(const HostAndPort& arbiter) {
+    _invalidateCachedBSON();
     _arbitersSet = true;
     _arbiters.push_back(arbiter);
 }
 
 void HelloResponse::setPrimary(const HostAndPort& primary) {
+    _invalidateCachedBSON();
     _primarySet = true;
     _primary = primary;
 }
 
 void HelloResponse::setIsArbiterOnly(bool arbiterOnly) {
+    _invalidateCachedBSON();
     _arbiterOnlySet = true;
     _arbiterOnly = arbiterOnly;
 }
 
 void HelloResponse::setIsPassive(bool passive) {
+    _invalidateCachedBSON();
     _passiveSet = true;
     _passive = passive;
 }
 
 void HelloResponse::setIsHidden(bool hidden) {
+    _invalidateCachedBSON();
     _hiddenSet = true;
     _hidden = hidden;
 }
 
 void HelloResponse::setShouldBuildIndexes(bool buildIndexes) {
+    _invalidateCachedBSON();
     _buildIndexesSet = true;
     _buildIndexes = buildIndexes;
 }
 
 void HelloResponse::setTopologyVersion(TopologyVersion topologyVersion) {
+    _invalidateCachedBSON();
     _topologyVersion = topologyVersion;
 }
 
 void HelloResponse::setSecondaryDelaySecs(Seconds secondaryDelaySecs) {
+    _invalidateCachedBSON();
     _secondaryDelaySecsSet = true;
     _secondaryDelaySecs = secondaryDelaySecs;
 }
 
 void HelloResponse::addTag(const std::string& tagKey, const std::string& tagValue) {
+    _invalidateCachedBSON();
     _tagsSet = true;
     _tags[tagKey] = tagValue;
 }
 
 void HelloResponse::setMe(const HostAndPort& me) {
+    _invalidateCachedBSON();
     _meSet = true;
     _me = me;
 }
 
 void HelloResponse::setElectionId(const OID& electionId) {
+    _invalidateCachedBSON();
     _electionId = electionId;
 }
 
 void HelloResponse::setLastWrite(const OpTime& lastWriteOpTime, const time_t lastWriteDate) {
+    _invalidateCachedBSON();
     _lastWrite = OpTimeWith<time_t>(lastWriteDate, lastWriteOpTime);
 }
 
 void HelloResponse::setLastMajorityWrite(const OpTime& lastMajorityWriteOpTime,
                                          const time_t lastMajorityWriteDate) {
+    _invalidateCachedBSON();
     _lastMajorityWrite = OpTimeWith<time_t>(lastMajorityWriteDate, lastMajorityWriteOpTime);
 }
 
 void HelloResponse::markAsNoConfig() {
+    _invalidateCachedBSON();
     _configSet = false;
 }
 
 void HelloResponse::markAsShutdownInProgress() {
+    _invalidateCachedBSON();
     _shutdownInProgress = true;
 }
 
+void HelloResponse::_invalidateCachedBSON() {
+    stdx::lock_guard<Latch> lk(_bsonCacheMutex);
+    _cachedBSON[0] = boost::none;
+    _cachedBSON[1] = boost::none;
+}
+
 }  // namespace repl
 }  // namespace mongo
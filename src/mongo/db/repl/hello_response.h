@@ -32,9 +32,11 @@
 #include <string>
 #include <vector>
 
+#include "mongo/bson/bsonobj.h"
 #include "mongo/bson/oid.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/optime_with.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/topology_version_gen.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/net/hostandport.h"
@@ -75,6 +77,10 @@ public:
     /**
      * Returns a BSONObj consisting the results of calling addToBSON on an otherwise empty
      * BSONObjBuilder.
+     *
+     * The serialized response is cached, so when one HelloResponse is shared among every waiter
+     * awaiting the same topology change, the serialization work is done once and all waiters
+     * share the resulting buffer. Mutating the response invalidates the cache.
      */
     BSONObj toBSON(bool useLegacyResponseFields = true) const;
 
@@ -253,6 +259,11 @@ public:
     void markAsShutdownInProgress();
 
 private:
+    /**
+     * Drops any cached results of toBSON(). Must be called by every mutator.
+     */
+    void _invalidateCachedBSON();
+
     bool _isWritablePrimary;
     bool _isWritablePrimarySet;
     bool _secondary;
@@ -294,6 +305,12 @@ private:
     // If _shutdownInProgress is true toBSON will return a set of hardcoded values to indicate
     // that we are mid shutdown
     bool _shutdownInProgress;
+
+    // Lazily computed results of toBSON(), indexed by the value of "useLegacyResponseFields".
+    // Guarded by '_bsonCacheMutex' since one immutable HelloResponse is typically serialized
+    // concurrently by all commands awaiting the same topology change.
+    mutable Mutex _bsonCacheMutex = MONGO_MAKE_LATCH("HelloResponse::_bsonCacheMutex");
+    mutable boost::optional<BSONObj> _cachedBSON[2];
 };
 
 }  // namespace repl
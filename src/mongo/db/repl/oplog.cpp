@@ -35,11 +35,14 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <deque>
 #include <memory>
 #include <set>
 #include <vector>
 
+#include "mongo/base/data_type_endian.h"
+#include "mongo/base/data_view.h"
 #include "mongo/bson/util/bson_extract.h"
 #include "mongo/db/auth/action_set.h"
 #include "mongo/db/auth/action_type.h"
@@ -514,13 +517,34 @@ std::vector<OpTime> logInsertOps(
 
     std::vector<OpTime> opTimes(count);
     std::vector<Timestamp> timestamps(count);
-    std::vector<BSONObj> bsonOplogEntries(count);
     std::vector<Record> records(count);
+
+    // Fetch optimes for all statements that don't already have one assigned. Reserving the whole
+    // batch with one call takes the optime mutex once instead of once per statement.
+    std::vector<OplogSlot> batchedSlots;
+    const bool reserveBatchedSlots =
+        std::all_of(begin, end, [](const auto& stmt) { return stmt.oplogSlot.isNull(); });
+    if (reserveBatchedSlots) {
+        batchedSlots = oplogInfo->getNextOpTimes(opCtx, count);
+    }
+
+    // All oplog entries of the batch are serialized back to back into one contiguous buffer, and
+    // the records handed to the storage engine point into it. Size it off the documents being
+    // inserted plus some slack for the per-entry envelope so the common case never reallocates.
+    constexpr size_t kPerEntryEnvelopeBytes = 256;
+    size_t estimatedBufferSize = 0;
+    for (auto it = begin; it != end; it++) {
+        estimatedBufferSize += it->doc.objsize() + kPerEntryEnvelopeBytes;
+    }
+    BufBuilder entriesBuffer(estimatedBufferSize);
+    std::vector<int> entryOffsets(count);
+
     for (size_t i = 0; i < count; i++) {
         // Make a copy from the template for each insert oplog entry.
         MutableOplogEntry oplogEntry = *oplogEntryTemplate;
         // Make a mutable copy.
-        auto insertStatementOplogSlot = begin[i].oplogSlot;
+        auto insertStatementOplogSlot =
+            reserveBatchedSlots ? batchedSlots[i] : begin[i].oplogSlot;
         // Fetch optime now, if not already fetched.
         if (insertStatementOplogSlot.isNull()) {
             insertStatementOplogSlot = oplogInfo->getNextOpTimes(opCtx, 1U)[0];
@@ -557,11 +581,19 @@ std::vector<OpTime> logInsertOps(
 
         opTimes[i] = insertStatementOplogSlot;
         timestamps[i] = insertStatementOplogSlot.getTimestamp();
-        bsonOplogEntries[i] = oplogEntry.toBSON();
-        // The storage engine will assign the RecordId based on the "ts" field of the oplog entry,
-        // see record_id_helpers::extractKey.
-        records[i] = Record{
-            RecordId(), RecordData(bsonOplogEntries[i].objdata(), bsonOplogEntries[i].objsize())};
+        entryOffsets[i] = entriesBuffer.len();
+        BSONObjBuilder entryBuilder(entriesBuffer);
+        oplogEntry.serialize(&entryBuilder);
+        entryBuilder.done();
+    }
+
+    // The buffer may have reallocated while growing, so the records can only be pointed at it
+    // once all entries have been serialized. The storage engine will assign the RecordId based on
+    // the "ts" field of the oplog entry, see record_id_helpers::extractKey.
+    for (size_t i = 0; i < count; i++) {
+        const char* entryData = entriesBuffer.buf() + entryOffsets[i];
+        const auto entrySize = ConstDataView(entryData).read<LittleEndian<std::int32_t>>();
+        records[i] = Record{RecordId(), RecordData(entryData, entrySize)};
     }
 
     sleepBetweenInsertOpTimeGenerationAndLogOp.execute([&](const BSONObj& data) {
@@ -164,6 +164,10 @@ std::unique_ptr<ThreadPool> makeReplWriterPool(int threadCount,
     options.minThreads =
         replWriterMinThreadCount < threadCount ? replWriterMinThreadCount : threadCount;
     options.maxThreads = static_cast<size_t>(threadCount);
+    // Writer tasks arrive in large bursts each batch. Allowing workers to claim several tasks
+    // per queue-lock acquisition keeps the task queue mutex from becoming a bottleneck at high
+    // thread counts; batching only kicks in while the queue is deeper than the thread count.
+    options.maxTaskBatchSize = 8;
     options.onCreateThread = [isKillableByStepdown](const std::string&) {
         Client::initThread(getThreadName());
         auto client = Client::getCurrent();
@@ -31,6 +31,8 @@
 
 #include "mongo/db/repl/oplog_applier_impl.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/database.h"
@@ -116,11 +118,11 @@ void _addOplogChainOpsToWriterVectors(OperationContext* opCtx,
                                       OplogEntry* op,
                                       CachedCollectionProperties* collPropertiesCache,
                                       std::vector<std::vector<const OplogEntry*>>* writerVectors) {
-    std::vector<OplogEntry> txnOps;
-    bool shouldSerialize = false;
-    std::tie(txnOps, shouldSerialize) =
+    auto [txnOps, shouldSerialize] =
         readTransactionOperationsFromOplogChainAndCheckForCommands(opCtx, *op, *partialTxnList);
-    derivedOps->emplace_back(txnOps);
+    // Move the derived ops into place; for large transactions this vector holds thousands of
+    // entries and copying it would stall the (single-threaded) writer vector fill.
+    derivedOps->emplace_back(std::move(txnOps));
     partialTxnList->clear();
 
     // Transaction entries cannot have different session updates.
@@ -425,6 +427,55 @@ void scheduleWritesToOplog(OperationContext* opCtx,
     }
 }
 
+// Issues a best-effort read of the document targeted by 'op' so that the pages holding it and its
+// _id index entry are warm in the storage engine's cache by the time a writer thread applies the
+// op. Only updates and deletes are prefetched: inserts target documents that do not exist yet.
+// Any failure to prefetch is ignored; the apply phase will fault the pages in itself.
+void prefetchOp(OperationContext* opCtx, StorageInterface* storageInterface, const OplogEntry& op) {
+    if (!op.isCrudOpType() || op.getOpType() == OpTypeEnum::kInsert) {
+        return;
+    }
+
+    try {
+        auto idElement = op.getIdElement();
+        if (idElement.eoo()) {
+            return;
+        }
+
+        const auto& uuid = op.getUuid();
+        auto nssOrUUID = uuid ? NamespaceStringOrUUID(op.getNss().db().toString(), *uuid)
+                              : NamespaceStringOrUUID(op.getNss());
+        storageInterface->findById(opCtx, nssOrUUID, idElement).getStatus().ignore();
+    } catch (const DBException&) {
+        // Ignore. Prefetching is an optimization and must never fail the batch.
+    }
+}
+
+// Schedules best-effort prefetch reads for the documents targeted by 'ops' into the writer pool,
+// where they run concurrently with the oplog writes scheduled by 'scheduleWritesToOplog()'. The
+// caller must guarantee that 'ops' stays valid until all scheduled work in the thread pool
+// completes.
+void scheduleDocumentPrefetches(StorageInterface* storageInterface,
+                                ThreadPool* writerPool,
+                                const std::vector<OplogEntry>& ops) {
+    const size_t numPrefetchThreads = writerPool->getStats().options.maxThreads;
+    const size_t numOpsPerThread = std::max(ops.size() / numPrefetchThreads, size_t(1));
+    for (size_t begin = 0; begin < ops.size(); begin += numOpsPerThread) {
+        size_t end = std::min(begin + numOpsPerThread, ops.size());
+        writerPool->schedule([storageInterface, &ops, begin, end](auto status) {
+            invariant(status);
+
+            auto opCtx = cc().makeOperationContext();
+            ShouldNotConflictWithSecondaryBatchApplicationBlock shouldNotConflictBlock(
+                opCtx->lockState());
+
+            for (size_t i = begin; i < end; i++) {
+                prefetchOp(opCtx.get(), storageInterface, ops[i]);
+            }
+        });
+    }
+}
+
 StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
                                                       std::vector<OplogEntry> ops) {
     invariant(!ops.empty());
@@ -465,6 +516,12 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
             scheduleWritesToOplog(opCtx, _storageInterface, _writerPool, ops);
         }
 
+        // Warm the cache with the documents targeted by the batch while the oplog writes are in
+        // flight, so the apply phase below does not stall waiting for page-in.
+        if (oplogApplicationPrefetchDocuments.load()) {
+            scheduleDocumentPrefetches(_storageInterface, _writerPool, ops);
+        }
+
         // Holds 'pseudo operations' generated by secondaries to aid in replication.
         // Keep in scope until all operations in 'ops' and 'derivedOps' have been applied.
         // Pseudo operations include:
@@ -481,6 +538,15 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
         // Wait for writes to finish before applying ops.
         _writerPool->waitForIdle();
 
+        // Kick off a journal flush now that the batch's oplog entries have been written, so the
+        // flush runs concurrently with the apply phase below. By the time the batch finalizer
+        // waits for the entries to become durable, most (or all) of the journaling work has
+        // already happened, and {j: true} write concerns are acknowledged that much sooner.
+        if (!getOptions().skipWritesToOplog &&
+            opCtx->getServiceContext()->getStorageEngine()->isDurable()) {
+            JournalFlusher::get(opCtx)->triggerJournalFlush();
+        }
+
         // Use this fail point to hold the PBWM lock after we have written the oplog entries but
         // before we have applied them.
         if (MONGO_unlikely(pauseBatchApplicationAfterWritingOplogEntries.shouldFail())) {
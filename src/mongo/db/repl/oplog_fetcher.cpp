@@ -33,6 +33,7 @@
 
 #include "mongo/base/counter.h"
 #include "mongo/bson/mutable/document.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/matcher.h"
@@ -233,6 +234,9 @@ void OplogFetcher::_doShutdown_inlock() noexcept {
         _conn->shutdownAndDisallowReconnect();
     }
     _shutdownCondVar.notify_all();
+    // Wake the batch processing thread and anyone waiting to queue or drain batches.
+    _batchQueuedCondVar.notify_all();
+    _batchProcessedCondVar.notify_all();
 }
 
 Mutex* OplogFetcher::_getMutex() noexcept {
@@ -317,6 +321,11 @@ Milliseconds OplogFetcher::_getRetriedFindMaxTime() const {
 
 void OplogFetcher::_finishCallback(Status status) {
     invariant(isActive());
+
+    // Stop the batch processing thread, if any, before reading _receivedRBID below since the
+    // first batch may have been processed on it.
+    _joinBatchProcessor();
+
     // If the oplog fetcher is shutting down, consolidate return code to CallbackCanceled.
     if (_isShuttingDown() && status != ErrorCodes::CallbackCanceled) {
         status = Status(ErrorCodes::CallbackCanceled,
@@ -400,6 +409,22 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
         auto batchResult = _getNextBatch();
         if (!batchResult.isOK()) {
             auto brStatus = batchResult.getStatus();
+
+            // Any batches already received must be processed before consulting the restart
+            // decision or recreating the cursor, so that our view of _lastFetched reflects
+            // them. A batch processing failure takes precedence over the network error since
+            // the batch processing thread interrupts the connection when it fails.
+            auto processingStatus = _drainPendingBatches();
+            if (!processingStatus.isOK()) {
+                // The stopReplProducer fail point expects this to return successfully. If
+                // another fail point wants this to return unsuccessfully, it should use a
+                // different error code.
+                _finishCallback(processingStatus == ErrorCodes::FailPointEnabled
+                                    ? Status::OK()
+                                    : processingStatus);
+                return;
+            }
+
             // Determine if we should stop syncing from our current sync source. If we're going
             // to change sync sources anyway, do it immediately rather than checking if we can
             // retry the error.
@@ -421,8 +446,19 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             }
         }
 
-        // This will advance our view of _lastFetched.
-        status = _onSuccessfulBatch(batchResult.getValue());
+        // Capture the per-batch state now; with pipelined batch processing the cursor and the
+        // response metadata may be overwritten by the next receive before the batch is
+        // processed.
+        Batch batch;
+        batch.documents = std::move(batchResult.getValue());
+        batch.metadataObj = _metadataObj;
+        batch.elapsedMS = _lastBatchElapsedMS;
+        batch.postBatchResumeToken = _cursor->getPostBatchResumeToken();
+        batch.firstBatch = _firstBatch;
+        _firstBatch = false;
+
+        // This will advance our view of _lastFetched once the batch is processed.
+        status = _handleBatch(std::move(batch));
         if (!status.isOK()) {
             // The stopReplProducer fail point expects this to return successfully. If another fail
             // point wants this to return unsuccessfully, it should use a different error code.
@@ -459,6 +495,13 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
                 // This means the sync source closes the tailable cursor with a returned cursorId of
                 // 0. Any users of the oplog fetcher should create a new oplog fetcher if they see a
                 // successful status and would like to continue fetching more oplog entries.
+                // Process every batch received before reporting a successful shutdown.
+                auto processingStatus = _drainPendingBatches();
+                if (!processingStatus.isOK() &&
+                    processingStatus != ErrorCodes::FailPointEnabled) {
+                    _finishCallback(processingStatus);
+                    return;
+                }
                 _finishCallback(Status::OK());
                 return;
             }
@@ -744,7 +787,112 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
     return batch;
 }
 
-Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
+bool OplogFetcher::_usePipelinedBatchProcessing() const {
+    return oplogFetcherPipelineBatchProcessing && !_config.forTenantMigration;
+}
+
+Status OplogFetcher::_handleBatch(Batch batch) {
+    if (!_usePipelinedBatchProcessing()) {
+        return _onSuccessfulBatch(batch);
+    }
+
+    // Bound how far the fetcher may run ahead of batch processing. The front of the deque is
+    // the batch currently being processed, so this allows one batch to be queued behind it
+    // while a third is being received.
+    static constexpr size_t kMaxPendingBatches = 2;
+
+    stdx::unique_lock<Latch> lk(_mutex);
+    if (!_batchProcessorThread.joinable()) {
+        _batchProcessorThread = stdx::thread([this] { _processBatchesLoop(); });
+    }
+
+    _batchProcessedCondVar.wait(lk, [&] {
+        return _pendingBatches.size() < kMaxPendingBatches || !_batchProcessorStatus.isOK() ||
+            _isShuttingDown_inlock();
+    });
+    if (!_batchProcessorStatus.isOK()) {
+        return _batchProcessorStatus;
+    }
+    if (_isShuttingDown_inlock()) {
+        return Status(ErrorCodes::CallbackCanceled, "oplog fetcher shutting down");
+    }
+    _pendingBatches.push_back(std::move(batch));
+    _batchQueuedCondVar.notify_one();
+    return Status::OK();
+}
+
+void OplogFetcher::_processBatchesLoop() {
+    Client::initThread("OplogFetcherBatchProcessor");
+
+    while (true) {
+        Batch* batch;
+        {
+            stdx::unique_lock<Latch> lk(_mutex);
+            _batchQueuedCondVar.wait(lk, [&] {
+                return !_pendingBatches.empty() || _shutdownBatchProcessor ||
+                    _isShuttingDown_inlock();
+            });
+            if (_shutdownBatchProcessor || _isShuttingDown_inlock()) {
+                return;
+            }
+            // Leave the batch at the front of the deque while it is being processed so that an
+            // empty deque means every received batch has been fully processed. Pointers into a
+            // deque remain valid while the fetcher thread pushes onto the back.
+            batch = &_pendingBatches.front();
+        }
+
+        auto status = _onSuccessfulBatch(*batch);
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _pendingBatches.pop_front();
+        if (!status.isOK()) {
+            _batchProcessorStatus = status;
+            // The fetcher never reuses the connection after a batch processing error, so
+            // interrupt it to promptly wake the fetcher thread from a blocking receive.
+            if (_conn) {
+                _conn->shutdownAndDisallowReconnect();
+            }
+            _batchProcessedCondVar.notify_all();
+            return;
+        }
+        _batchProcessedCondVar.notify_all();
+    }
+}
+
+Status OplogFetcher::_drainPendingBatches() {
+    if (!_batchProcessorThread.joinable()) {
+        return Status::OK();
+    }
+
+    stdx::unique_lock<Latch> lk(_mutex);
+    _batchProcessedCondVar.wait(lk, [&] {
+        return _pendingBatches.empty() || !_batchProcessorStatus.isOK() ||
+            _isShuttingDown_inlock();
+    });
+    if (!_batchProcessorStatus.isOK()) {
+        return _batchProcessorStatus;
+    }
+    if (_isShuttingDown_inlock()) {
+        return Status(ErrorCodes::CallbackCanceled, "oplog fetcher shutting down");
+    }
+    return Status::OK();
+}
+
+void OplogFetcher::_joinBatchProcessor() {
+    if (!_batchProcessorThread.joinable()) {
+        return;
+    }
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _shutdownBatchProcessor = true;
+        _batchQueuedCondVar.notify_all();
+    }
+    _batchProcessorThread.join();
+}
+
+Status OplogFetcher::_onSuccessfulBatch(const Batch& batch) {
+    const Documents& documents = batch.documents;
+
     hangBeforeProcessingSuccessfulBatch.pauseWhileSet();
 
     if (_isShuttingDown()) {
@@ -804,7 +952,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         LOGV2_DEBUG(21271, 2, "Oplog fetcher read 0 operations from remote oplog");
     }
 
-    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(_metadataObj);
+    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(batch.metadataObj);
     if (!oqMetadataResult.isOK()) {
         LOGV2_ERROR(21278,
                     "invalid oplog query metadata from sync source {syncSource}: "
@@ -812,12 +960,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
                     "Invalid oplog query metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = oqMetadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return oqMetadataResult.getStatus();
     }
     auto oqMetadata = oqMetadataResult.getValue();
 
-    if (_firstBatch) {
+    if (batch.firstBatch) {
         auto status =
             _checkRemoteOplogStart(documents, oqMetadata.getLastOpApplied(), oqMetadata.getRBID());
         if (!status.isOK()) {
@@ -860,7 +1008,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     auto previousOpTimeFetched = _getLastOpTimeFetched();
 
     auto validateResult = OplogFetcher::validateDocuments(
-        documents, _firstBatch, previousOpTimeFetched.getTimestamp(), _config.startingPoint);
+        documents, batch.firstBatch, previousOpTimeFetched.getTimestamp(), _config.startingPoint);
     if (!validateResult.isOK()) {
         return validateResult.getStatus();
     }
@@ -871,7 +1019,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // Process replset metadata.  It is important that this happen after we've validated the
     // first batch, so we don't progress our knowledge of the commit point from a
     // response that triggers a rollback.
-    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(_metadataObj);
+    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(batch.metadataObj);
     if (!metadataResult.isOK()) {
         LOGV2_ERROR(21279,
                     "invalid replication metadata from sync source {syncSource}: "
@@ -879,7 +1027,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
                     "Invalid replication metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = metadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return metadataResult.getStatus();
     }
     auto replSetMetadata = metadataResult.getValue();
@@ -907,12 +1055,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     opsReadStats.increment(info.networkDocumentCount);
     networkByteStats.increment(info.networkDocumentBytes);
 
-    oplogBatchStats.recordMillis(_lastBatchElapsedMS, documents.empty());
+    oplogBatchStats.recordMillis(batch.elapsedMS, documents.empty());
 
-    if (_cursor->getPostBatchResumeToken()) {
+    if (batch.postBatchResumeToken) {
         auto pbrt = ResumeTokenOplogTimestamp::parse(
             IDLParserErrorContext("OplogFetcher PostBatchResumeToken"),
-            *_cursor->getPostBatchResumeToken());
+            *batch.postBatchResumeToken);
         info.resumeToken = pbrt.getTs();
     }
 
@@ -950,7 +1098,6 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         _lastFetched = lastDocOpTime;
     }
 
-    _firstBatch = false;
     return Status::OK();
 }
 
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <functional>
 
 #include "mongo/base/status_with.h"
@@ -43,6 +44,7 @@
 #include "mongo/db/repl/repl_set_config.h"
 #include "mongo/db/repl/replication_process.h"
 #include "mongo/db/vector_clock_metadata_hook.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point.h"
 
 namespace mongo {
@@ -402,13 +404,68 @@ private:
      */
     StatusWith<Documents> _getNextBatch();
 
+    /**
+     * A successfully received batch together with the per-batch state captured at receive time,
+     * so that the batch can be processed while the fetcher thread receives the next one.
+     */
+    struct Batch {
+        Documents documents;
+
+        // The response metadata set by the ReplyMetadataReader when the batch was received.
+        BSONObj metadataObj;
+
+        // Time spent receiving the batch, for metrics.repl.network.getmores.
+        int elapsedMS = 0;
+
+        // The postBatchResumeToken from the cursor response, if requested.
+        boost::optional<BSONObj> postBatchResumeToken;
+
+        // Whether this was the first batch received via the current cursor.
+        bool firstBatch = false;
+    };
+
+    /**
+     * Whether received batches are handed off to a dedicated batch processing thread so that
+     * processing a batch overlaps with receiving and decompressing the next one. Controlled by
+     * the 'oplogFetcherPipelineBatchProcessing' server parameter. Never used for tenant
+     * migration fetchers, whose non-tailable cursors are torn down and recreated per query.
+     */
+    bool _usePipelinedBatchProcessing() const;
+
+    /**
+     * Hands a successfully received batch off for processing. With pipelined batch processing
+     * enabled this queues the batch for the batch processing thread, blocking while the queue
+     * is full; otherwise the batch is processed inline.
+     */
+    Status _handleBatch(Batch batch);
+
+    /**
+     * Body of the batch processing thread. Processes queued batches in arrival order until a
+     * batch fails to process or the thread is told to exit. On a processing failure, interrupts
+     * the connection to promptly wake the fetcher thread from a blocking receive.
+     */
+    void _processBatchesLoop();
+
+    /**
+     * Blocks until every queued batch has been processed and returns the batch processing
+     * status. Must be called before recreating the cursor, consulting the restart decision, or
+     * finishing cleanly, so that _lastFetched reflects every batch received so far.
+     */
+    Status _drainPendingBatches();
+
+    /**
+     * Tells the batch processing thread to exit, discarding any unprocessed batches, and joins
+     * it. Called once the oplog fetcher is finishing.
+     */
+    void _joinBatchProcessor();
+
     /**
      * Function called by the oplog fetcher when it gets a successful batch from the sync source.
      * This will also process the metadata received from the response.
      *
      * On failure returns a status that will be passed to _finishCallback.
      */
-    Status _onSuccessfulBatch(const Documents& documents);
+    Status _onSuccessfulBatch(const Batch& batch);
 
     /**
      * Notifies caller that the oplog fetcher has completed processing operations from the remote
@@ -510,6 +567,32 @@ private:
 
     // Condition to be notified on shutdown.
     stdx::condition_variable _shutdownCondVar;
+
+    // ====== Pipelined batch processing (see oplogFetcherPipelineBatchProcessing) ======
+
+    // Thread which processes and enqueues queued batches while the fetcher thread receives and
+    // decompresses the next batch. Started lazily on the first batch handed off and only ever
+    // joined by the fetcher thread in _finishCallback.
+    stdx::thread _batchProcessorThread;
+
+    // Batches received but not yet fully processed, in arrival order. The front element is
+    // popped only once its processing completes, so an empty deque means the batch processing
+    // thread is idle. Guarded by _mutex.
+    std::deque<Batch> _pendingBatches;
+
+    // The first error encountered by the batch processing thread, which also causes it to exit.
+    // Guarded by _mutex.
+    Status _batchProcessorStatus = Status::OK();
+
+    // Tells the batch processing thread to exit, discarding unprocessed batches. Guarded by
+    // _mutex.
+    bool _shutdownBatchProcessor = false;
+
+    // Signaled when a batch is queued or the batch processing thread must exit.
+    stdx::condition_variable _batchQueuedCondVar;
+
+    // Signaled when a batch finishes processing or batch processing fails.
+    stdx::condition_variable _batchProcessedCondVar;
 };
 
 class OplogFetcherFactory {
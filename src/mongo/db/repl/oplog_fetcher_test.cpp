@@ -1645,6 +1645,70 @@ TEST_F(OplogFetcherTest, OplogFetcherWorksWithoutExhaust) {
     ASSERT_EQUALS(remoteRBID, shutdownState.getRBID());
 }
 
+TEST_F(OplogFetcherTest, PipelinedBatchProcessingProcessesAllBatchesInOrder) {
+    // Test that the oplog fetcher processes every received batch in order when the
+    // 'oplogFetcherPipelineBatchProcessing' server parameter hands batches off to the batch
+    // processing thread.
+
+    ShutdownState shutdownState;
+
+    oplogFetcherPipelineBatchProcessing = true;
+    ON_BLOCK_EXIT([] { oplogFetcherPipelineBatchProcessing = false; });
+
+    // Create an oplog fetcher with one retry.
+    auto oplogFetcher = getOplogFetcherAfterConnectionCreated(std::ref(shutdownState), 1);
+
+    CursorId cursorId = 22LL;
+    auto firstEntry = makeNoopOplogEntry(lastFetched);
+    auto secondEntry = makeNoopOplogEntry({{Seconds(124), 0}, lastFetched.getTerm()});
+    auto metadataObj = makeOplogBatchMetadata(replSetMetadata, oqMetadata);
+    auto firstBatch = {firstEntry, secondEntry};
+
+    // Creating the cursor will succeed. After this, the cursor will be blocked on call() for the
+    // getMore command while the first batch is processed on the batch processing thread.
+    auto m = processSingleRequestResponse(oplogFetcher->getDBClientConnection_forTest(),
+                                          makeFirstBatch(cursorId, firstBatch, metadataObj),
+                                          true);
+
+    validateFindCommand(
+        m, lastFetched, durationCount<Milliseconds>(oplogFetcher->getInitialFindMaxTime_forTest()));
+
+    auto thirdEntry = makeNoopOplogEntry({{Seconds(456), 0}, lastFetched.getTerm()});
+    auto fourthEntry = makeNoopOplogEntry({{Seconds(457), 0}, lastFetched.getTerm()});
+    auto secondBatch = {thirdEntry, fourthEntry};
+
+    // The first getMore's response. After this, the cursor will be blocked on recv() for the
+    // next exhaust batch.
+    m = processSingleRequestResponse(
+        oplogFetcher->getDBClientConnection_forTest(),
+        makeSubsequentBatch(cursorId, secondBatch, metadataObj, true /* moreToCome */),
+        true);
+
+    validateGetMoreCommand(m,
+                           cursorId,
+                           durationCount<Milliseconds>(oplogFetcher->getAwaitDataTimeout_forTest()),
+                           dataReplicatorExternalState->getCurrentTermAndLastCommittedOpTime());
+
+    auto fifthEntry = makeNoopOplogEntry({{Seconds(789), 0}, lastFetched.getTerm()});
+    auto finalBatch = {fifthEntry};
+
+    // A cursor id of zero closes the cursor. The oplog fetcher must drain the pipeline, so every
+    // queued batch is processed before it finishes with a successful status.
+    processSingleExhaustResponse(
+        oplogFetcher->getDBClientConnection_forTest(),
+        makeSubsequentBatch(0LL, finalBatch, metadataObj, false /* moreToCome */));
+
+    oplogFetcher->join();
+
+    ASSERT_OK(shutdownState.getStatus());
+    ASSERT_EQ(remoteRBID, shutdownState.getRBID());
+
+    // All batches were processed in order, so the last fetched optime is the final batch's entry
+    // and the final batch was the last one enqueued.
+    validateLastBatch(
+        false /* skipFirstDoc */, finalBatch, oplogFetcher->getLastOpTimeFetched_forTest());
+}
+
 TEST_F(OplogFetcherTest, CursorIsDeadShutsDownOplogFetcherWithSuccessfulStatus) {
     ShutdownState shutdownState;
 
@@ -1442,6 +1442,9 @@ void ReplicationCoordinatorImpl::_setMyLastAppliedOpTimeAndWallTime(
 
     _topCoord->setMyLastAppliedOpTimeAndWallTime(
         opTimeAndWallTime, _replExecutor->now(), isRollbackAllowed);
+    // Keep the lock-free shadow of the lastApplied timestamp in step, including backward moves
+    // during rollback.
+    _lastAppliedTimestampShadow.store(opTime.getTimestamp().asULL());
     // If we are using applied times to calculate the commit level, update it now.
     if (!_rsConfig.getWriteConcernMajorityShouldJournal()) {
         _updateLastCommittedOpTimeAndWallTime(lk);
@@ -1621,7 +1624,15 @@ Status ReplicationCoordinatorImpl::_waitUntilOpTime(OperationContext* opCtx,
         return {ErrorCodes::NotYetInitialized, "The oplog does not exist."};
     }
 
-    {
+    // Targets derived from afterClusterTime/atClusterTime carry an uninitialized term and so
+    // compare by timestamp alone. For those, a lock-free read of the lastApplied timestamp shadow
+    // can prove the wait is already satisfied (the common case for session-affine
+    // read-after-write patterns) without contending on the mutex. The shadow may lag the true
+    // lastApplied, in which case we simply take the locked path below.
+    const bool satisfiedByShadow = targetOpTime.getTerm() == OpTime::kUninitializedTerm &&
+        targetOpTime.getTimestamp().asULL() <= _lastAppliedTimestampShadow.load();
+
+    if (!satisfiedByShadow) {
         stdx::unique_lock lock(_mutex);
         if (targetOpTime > _getMyLastAppliedOpTime_inlock()) {
             if (_inShutdown) {
@@ -1807,6 +1807,12 @@ private:
     // Reading this value does not require the replication coordinator mutex to be locked.
     AtomicWord<long long> _termShadow;  // (S)
 
+    // Atomic-synchronized copy of the timestamp of the Topology Coordinator's lastApplied optime,
+    // for use by the fast path of _waitUntilOpTime().
+    // This variable must be written immediately after lastApplied, and thus its value can lag.
+    // Reading this value does not require the replication coordinator mutex to be locked.
+    AtomicWord<unsigned long long> _lastAppliedTimestampShadow;  // (S)
+
     // When we decide to step down due to hearing about a higher term, we remember the term we heard
     // here so we can update our term to match as part of finishing stepdown.
     boost::optional<long long> _pendingTermUpdateDuringStepDown;  // (M)
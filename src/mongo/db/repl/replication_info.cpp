@@ -67,6 +67,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/transport/hello_metrics.h"
+#include "mongo/transport/service_executor.h"
 #include "mongo/util/decimal_counter.h"
 #include "mongo/util/fail_point.h"
 
@@ -400,6 +401,15 @@ public:
                 });
         }
 
+        // Intra-cluster connections carry heartbeat, replication, and sharding traffic whose
+        // timeliness matters more than peak throughput; route them to the prioritized lane so
+        // they cannot queue behind expensive user operations under overload.
+        if (cmd.getInternalClient()) {
+            if (auto seCtx = transport::ServiceExecutorContext::get(client)) {
+                seCtx->setPrioritized(true);
+            }
+        }
+
         // If a client is following the awaitable hello protocol, maxAwaitTimeMS should be
         // present if and only if topologyVersion is present in the request.
         auto clientTopologyVersion = cmd.getTopologyVersion();
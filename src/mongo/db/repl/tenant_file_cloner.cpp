@@ -118,10 +118,27 @@ void TenantFileCloner::preStage() {
                 .startsWith(syncTargetTempDBPath.generic_string()));
 
     // Create and open files and any parent directories.
+    size_t resumeOffset = 0;
     if (boost::filesystem::exists(_localFilePath)) {
-        LOGV2(6113302,
-              "Local file exists at start of TenantFileCloner; truncating.",
-              "localFilePath"_attr = _localFilePath.string());
+        // A previous attempt to copy this file was interrupted. The file is written strictly
+        // sequentially and the temporary directory is cleared whenever a new backup cursor's file
+        // list starts arriving, so any bytes already on disk were streamed from the same backup
+        // cursor checkpoint and can be kept; resume the copy where the previous attempt left off.
+        boost::system::error_code ec;
+        auto existingSize = boost::filesystem::file_size(_localFilePath, ec);
+        if (!ec && existingSize <= _remoteFileSize) {
+            resumeOffset = existingSize;
+            LOGV2(6650038,
+                  "Local file exists at start of TenantFileCloner; resuming copy.",
+                  "localFilePath"_attr = _localFilePath.string(),
+                  "fileOffset"_attr = static_cast<int64_t>(resumeOffset),
+                  "fileSize"_attr = static_cast<int64_t>(_remoteFileSize));
+        } else {
+            LOGV2(6113302,
+                  "Local file exists at start of TenantFileCloner but cannot be resumed; "
+                  "truncating.",
+                  "localFilePath"_attr = _localFilePath.string());
+        }
     } else {
         auto localFileDir = _localFilePath.parent_path();
         boost::system::error_code ec;
@@ -131,12 +148,20 @@ void TenantFileCloner::preStage() {
                               << ec.message(),
                 !ec);
     }
-    _localFile.open(_localFilePath.string(),
-                    std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    auto openMode = std::ios_base::out | std::ios_base::binary;
+    if (resumeOffset > 0) {
+        // Keep the existing contents and position the write pointer at the end of the file, which
+        // is where the resumed query stream picks up.
+        openMode |= std::ios_base::in | std::ios_base::ate;
+    } else {
+        openMode |= std::ios_base::trunc;
+    }
+    _localFile.open(_localFilePath.string(), openMode);
     uassert(ErrorCodes::FileOpenFailed,
             str::stream() << "Failed to open file " << _localFilePath.string(),
             !_localFile.fail());
-    _fileOffset = 0;
+    _fileOffset = resumeOffset;
+    _stats.bytesPreviouslyCopied = resumeOffset;
 }
 
 void TenantFileCloner::postStage() {
@@ -166,6 +191,32 @@ size_t TenantFileCloner::getFileOffset() {
     return _fileOffset;
 }
 
+void TenantFileCloner::throttleIfNeeded(size_t incomingBytes) {
+    auto maxBytesPerSec = fileCopyMaxBytesPerSec.load();
+    if (maxBytesPerSec <= 0) {
+        return;
+    }
+    auto clock = getSharedData()->getClock();
+    auto now = clock->now();
+    if (now - _throttleWindowStart >= Seconds(1)) {
+        _throttleWindowStart = now;
+        _throttleWindowBytes = 0;
+    }
+    _throttleWindowBytes += incomingBytes;
+    if (_throttleWindowBytes < static_cast<size_t>(maxBytesPerSec)) {
+        return;
+    }
+    // This window's budget is spent; sleep out the remainder of the window before asking the sync
+    // source for more data. The rate may be lowered at runtime, so cap each sleep and recheck so
+    // the copy does not stall for long after shutdown is requested.
+    const auto windowEnd = _throttleWindowStart + Seconds(1);
+    while ((now = clock->now()) < windowEnd && !mustExit()) {
+        sleepmillis(std::min(100LL, durationCount<Milliseconds>(windowEnd - now)));
+    }
+    _throttleWindowStart = clock->now();
+    _throttleWindowBytes = 0;
+}
+
 void TenantFileCloner::runQuery() {
     auto backupFileStage = BSON(
         "$_backupFile" << BSON("backupId" << _backupId << "file" << _remoteFileName << "byteOffset"
@@ -223,11 +274,14 @@ void TenantFileCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
                       str::stream() << message << ": " << getSharedData()->getStatus(lk));
         }
     }
+    size_t receivedBytes = 0;
     while (iter.moreInCurrentBatch()) {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.receivedBatches++;
         while (iter.moreInCurrentBatch()) {
-            _dataToWrite.emplace_back(iter.nextSafe());
+            auto doc = iter.nextSafe();
+            receivedBytes += doc.objsize();
+            _dataToWrite.emplace_back(std::move(doc));
         }
     }
 
@@ -243,6 +297,10 @@ void TenantFileCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
         uassertStatusOK(newStatus);
     }
 
+    // Writes have been handed off to the filesystem task runner, so throttling here only delays
+    // the request for the next batch.
+    throttleIfNeeded(receivedBytes);
+
     TenantFileClonerHangAfterHandlingBatchResponse.executeIf(
         [&](const BSONObj&) {
             while (MONGO_unlikely(TenantFileClonerHangAfterHandlingBatchResponse.shouldFail()) &&
@@ -351,6 +409,10 @@ void TenantFileCloner::Stats::append(BSONObjBuilder* builder) const {
     builder->append("filePath", filePath);
     builder->appendNumber("fileSize", static_cast<long long>(fileSize));
     builder->appendNumber("bytesCopied", static_cast<long long>(bytesCopied));
+    if (bytesPreviouslyCopied > 0) {
+        builder->appendNumber("bytesPreviouslyCopied",
+                              static_cast<long long>(bytesPreviouslyCopied));
+    }
     if (start != Date_t()) {
         builder->appendDate("start", start);
         if (end != Date_t()) {
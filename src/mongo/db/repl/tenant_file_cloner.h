@@ -51,6 +51,8 @@ public:
         size_t receivedBatches{0};
         size_t writtenBatches{0};
         size_t bytesCopied{0};
+        // Bytes found already on disk from an earlier, interrupted attempt to copy this file.
+        size_t bytesPreviouslyCopied{0};
 
         std::string toString() const;
         BSONObj toBSON() const;
@@ -140,7 +142,8 @@ private:
 
     /**
      * The preStage sets the begin time in _stats and makes sure the destination file
-     * can be created.
+     * can be created. If a previous attempt to copy this file was interrupted, the copy is
+     * resumed from the bytes already on disk rather than started over.
      */
     void preStage() final;
 
@@ -180,6 +183,13 @@ private:
      */
     size_t getFileOffset();
 
+    /**
+     * Sleeps the calling (query) thread as needed to keep the copy rate under
+     * 'fileCopyMaxBytesPerSec'. Blocking the query thread applies back pressure to the sync
+     * source through the exhaust stream, so the data never piles up on this node.
+     */
+    void throttleIfNeeded(size_t incomingBytes);
+
     // All member variables are labeled with one of the following codes indicating the
     // synchronization rules for accessing them.
     //
@@ -212,6 +222,10 @@ private:
     ProgressMeter _progressMeter;  // (X) progress meter for this instance.
     Stats _stats;                  // (M)
 
+    // Start of the current rate limiting window and the number of bytes received in it.
+    Date_t _throttleWindowStart;     // (X)
+    size_t _throttleWindowBytes = 0;  // (X)
+
     static constexpr int kProgressMeterSecondsBetween = 60;
     static constexpr int kProgressMeterCheckInterval = 128;
 };
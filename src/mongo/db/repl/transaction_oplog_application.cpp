@@ -354,7 +354,7 @@ std::pair<std::vector<OplogEntry>, bool> _readTransactionOperationsFromOplogChai
             }
         }
     }
-    return std::make_pair(ops, isTransactionWithCommand);
+    return std::make_pair(std::move(ops), isTransactionWithCommand);
 }
 
 std::vector<OplogEntry> readTransactionOperationsFromOplogChain(
@@ -363,7 +363,7 @@ std::vector<OplogEntry> readTransactionOperationsFromOplogChain(
     const std::vector<OplogEntry*>& cachedOps) noexcept {
     auto result = _readTransactionOperationsFromOplogChain(
         opCtx, lastEntryInTxn, cachedOps, false /*checkForCommands*/);
-    return std::get<0>(result);
+    return std::get<0>(std::move(result));
 }
 
 std::pair<std::vector<OplogEntry>, bool> readTransactionOperationsFromOplogChainAndCheckForCommands(
@@ -460,6 +460,40 @@ void ReplIndexBuildState::clearLastOpTimeBeforeInterceptors() {
     _lastOpTimeBeforeInterceptors = {};
 }
 
+void ReplIndexBuildState::setMemberBuildProgress(const HostAndPort& member,
+                                                boost::optional<long long> keysProcessed,
+                                                boost::optional<StringData> phase,
+                                                Date_t reportedAt) {
+    stdx::unique_lock<Latch> lk(_mutex);
+    auto& progress = _memberBuildProgress[member];
+    if (keysProcessed) {
+        progress.keysProcessed = keysProcessed;
+    }
+    if (phase) {
+        progress.phase = phase->toString();
+    }
+    progress.reportedAt = reportedAt;
+}
+
+void ReplIndexBuildState::appendMemberBuildProgress(BSONObjBuilder* builder) const {
+    stdx::unique_lock<Latch> lk(_mutex);
+    if (_memberBuildProgress.empty()) {
+        return;
+    }
+    BSONArrayBuilder membersBuilder(builder->subarrayStart("memberProgress"));
+    for (const auto& [member, progress] : _memberBuildProgress) {
+        BSONObjBuilder memberBuilder(membersBuilder.subobjStart());
+        memberBuilder.append("host", member.toString());
+        if (!progress.phase.empty()) {
+            memberBuilder.append("phase", progress.phase);
+        }
+        if (progress.keysProcessed) {
+            memberBuilder.append("keysProcessed", *progress.keysProcessed);
+        }
+        memberBuilder.append("reportedAt", progress.reportedAt);
+    }
+}
+
 bool ReplIndexBuildState::_shouldSkipIndexBuildStateTransitionCheck(OperationContext* opCtx) const {
     const auto replCoord = repl::ReplicationCoordinator::get(opCtx);
     if (replCoord->isReplEnabled() && protocol == IndexBuildProtocol::kTwoPhase) {
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <list>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -362,6 +363,21 @@ public:
     Status onConflictWithNewIndexBuild(const ReplIndexBuildState& otherIndexBuild,
                                        const std::string& otherIndexName) const;
 
+    /**
+     * Records the latest build progress reported by a replica set member over the
+     * 'voteCommitIndexBuild' channel. Reports are advisory and are only used for observability.
+     */
+    void setMemberBuildProgress(const HostAndPort& member,
+                                boost::optional<long long> keysProcessed,
+                                boost::optional<StringData> phase,
+                                Date_t reportedAt);
+
+    /**
+     * Appends the last progress report of each member under a 'memberProgress' array field.
+     * Appends nothing if no member has reported progress.
+     */
+    void appendMemberBuildProgress(BSONObjBuilder* builder) const;
+
     /**
      * Accessor and mutator for last optime in the oplog before the interceptors were installed.
      * This supports resumable index builds.
@@ -457,6 +473,16 @@ private:
     // phase index build, isn't running a hybrid index build, or isn't running during oplog
     // application, this will be null.
     repl::OpTime _lastOpTimeBeforeInterceptors;
+
+    struct MemberBuildProgress {
+        boost::optional<long long> keysProcessed;
+        std::string phase;
+        Date_t reportedAt;
+    };
+
+    // The latest build progress reported by each replica set member. Only populated on the node
+    // accepting 'voteCommitIndexBuild' commands for this build, i.e. the primary.
+    std::map<HostAndPort, MemberBuildProgress> _memberBuildProgress;
 };
 
 }  // namespace mongo
@@ -36,6 +36,7 @@
 #include <random>
 
 #include "mongo/db/s/balancer/type_migration.h"
+#include "mongo/db/s/sharding_config_server_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/catalog/type_tags.h"
@@ -319,10 +320,26 @@ ShardId BalancerPolicy::_getMostOverloadedShard(
     ShardId worst;
     unsigned maxChunks = 0;
 
+    const auto maxDonorLatency = Milliseconds(balancerMigrationsMaxDonorOpLatencyMillis.load());
+
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
             continue;
 
+        // Migrating a chunk degrades the donor further, so skip shards whose operation latency
+        // already exceeds the configured target and let them be balanced in a quieter round.
+        if (maxDonorLatency > Milliseconds(0) && stat.avgOpLatency &&
+            *stat.avgOpLatency > maxDonorLatency) {
+            LOGV2_DEBUG(6650020,
+                        1,
+                        "Not selecting shard as a migration donor because its operation latency "
+                        "exceeds the configured maximum",
+                        "shardId"_attr = stat.shardId,
+                        "avgOpLatency"_attr = *stat.avgOpLatency,
+                        "balancerMigrationsMaxDonorOpLatencyMillis"_attr = maxDonorLatency);
+            continue;
+        }
+
         const unsigned shardChunkCount =
             distribution.numberOfChunksInShardWithTag(stat.shardId, chunkTag);
         if (shardChunkCount <= maxChunks)
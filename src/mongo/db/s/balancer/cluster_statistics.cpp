@@ -97,6 +97,9 @@ BSONObj ClusterStatistics::ShardStatistics::toBSON() const {
     }
 
     builder.append("version", mongoVersion);
+    if (avgOpLatency) {
+        builder.append("avgOpLatencyMillis", durationCount<Milliseconds>(*avgOpLatency));
+    }
     return builder.obj();
 }
 
@@ -33,9 +33,12 @@
 #include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 #include "mongo/base/status_with.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/s/shard_id.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
@@ -104,6 +107,11 @@ public:
 
         // Version of mongod, which runs on this shard's primary
         std::string mongoVersion;
+
+        // Average read/write operation latency on the shard's primary over the most recent
+        // sampling interval, if known. Used to avoid selecting overloaded shards as migration
+        // donors (see the balancerMigrationsMaxDonorOpLatencyMillis server parameter).
+        boost::optional<Milliseconds> avgOpLatency;
     };
 
     virtual ~ClusterStatistics();
@@ -49,16 +49,50 @@ namespace mongo {
 namespace {
 
 const char kVersionField[] = "version";
+const char kOpLatenciesField[] = "opLatencies";
+
+/**
+ * The version of a shard's primary along with the cumulative read/write operation latency
+ * counters reported by the same serverStatus invocation, when available.
+ */
+struct ShardHostStatistics {
+    std::string version;
+    boost::optional<ClusterStatisticsImpl::OpLatencySample> opLatencies;
+};
+
+/**
+ * Extracts the cumulative read and write latency totals from the serverStatus 'opLatencies'
+ * section, or boost::none if the section is missing or malformed.
+ */
+boost::optional<ClusterStatisticsImpl::OpLatencySample> extractOpLatencies(
+    const BSONObj& serverStatus) {
+    auto opLatencies = serverStatus[kOpLatenciesField];
+    if (opLatencies.type() != Object) {
+        return boost::none;
+    }
+
+    ClusterStatisticsImpl::OpLatencySample sample;
+    for (auto&& section : {"reads"_sd, "writes"_sd}) {
+        auto entry = opLatencies.Obj()[section];
+        if (entry.type() != Object) {
+            return boost::none;
+        }
+        sample.latencyMicros += entry.Obj()["latency"].safeNumberLong();
+        sample.ops += entry.Obj()["ops"].safeNumberLong();
+    }
+    return sample;
+}
 
 /**
  * Executes the serverStatus command against the specified shard and obtains the version of the
- * running MongoD service.
+ * running MongoD service, along with its cumulative operation latency counters.
  *
- * Returns the MongoD version in strig format or an error. Known error codes are:
+ * Returns the statistics or an error. Known error codes are:
  *  ShardNotFound if shard by that id is not available on the registry
  *  NoSuchKey if the version could not be retrieved
  */
-StatusWith<std::string> retrieveShardMongoDVersion(OperationContext* opCtx, ShardId shardId) {
+StatusWith<ShardHostStatistics> retrieveShardHostStatistics(OperationContext* opCtx,
+                                                            ShardId shardId) {
     auto shardRegistry = Grid::get(opCtx)->shardRegistry();
     auto shardStatus = shardRegistry->getShard(opCtx, shardId);
     if (!shardStatus.isOK()) {
@@ -81,13 +115,14 @@ StatusWith<std::string> retrieveShardMongoDVersion(OperationContext* opCtx, Shar
 
     BSONObj serverStatus = std::move(commandResponse.getValue().response);
 
-    std::string version;
-    Status status = bsonExtractStringField(serverStatus, kVersionField, &version);
+    ShardHostStatistics hostStats;
+    Status status = bsonExtractStringField(serverStatus, kVersionField, &hostStats.version);
     if (!status.isOK()) {
         return status;
     }
+    hostStats.opLatencies = extractOpLatencies(serverStatus);
 
-    return version;
+    return hostStats;
 }
 }  // namespace
 
@@ -146,18 +181,22 @@ StatusWith<std::vector<ShardStatistics>> ClusterStatisticsImpl::_getStats(
         }
 
         std::string mongoDVersion;
+        boost::optional<Milliseconds> avgOpLatency;
 
-        auto mongoDVersionStatus = retrieveShardMongoDVersion(opCtx, shard.getName());
-        if (mongoDVersionStatus.isOK()) {
-            mongoDVersion = std::move(mongoDVersionStatus.getValue());
+        auto hostStatsStatus = retrieveShardHostStatistics(opCtx, shard.getName());
+        if (hostStatsStatus.isOK()) {
+            auto& hostStats = hostStatsStatus.getValue();
+            mongoDVersion = std::move(hostStats.version);
+            avgOpLatency = _updateOpLatencySample(shard.getName(), hostStats.opLatencies);
         } else {
-            // Since the mongod version is only used for reporting, there is no need to fail the
-            // entire round if it cannot be retrieved, so just leave it empty
+            // Since these statistics are only used for reporting and latency-aware donor
+            // selection, there is no need to fail the entire round if they cannot be retrieved,
+            // so just leave them empty
             LOGV2(21895,
                   "Unable to obtain shard version for {shardId}: {error}",
                   "Unable to obtain shard version",
                   "shardId"_attr = shard.getName(),
-                  "error"_attr = mongoDVersionStatus.getStatus());
+                  "error"_attr = hostStatsStatus.getStatus());
         }
 
         std::set<std::string> shardTags;
@@ -173,9 +212,36 @@ StatusWith<std::vector<ShardStatistics>> ClusterStatisticsImpl::_getStats(
                            std::move(shardTags),
                            std::move(mongoDVersion),
                            ShardStatistics::use_bytes_t{});
+        stats.back().avgOpLatency = avgOpLatency;
     }
 
     return stats;
 }
 
+boost::optional<Milliseconds> ClusterStatisticsImpl::_updateOpLatencySample(
+    const ShardId& shardId, const boost::optional<OpLatencySample>& sample) {
+    if (!sample) {
+        return boost::none;
+    }
+
+    stdx::lock_guard<Latch> lk(_opLatencySamplesMutex);
+    auto it = _lastOpLatencySamples.find(shardId);
+    if (it == _lastOpLatencySamples.end()) {
+        _lastOpLatencySamples.emplace(shardId, *sample);
+        return boost::none;
+    }
+
+    const auto deltaOps = sample->ops - it->second.ops;
+    const auto deltaLatencyMicros = sample->latencyMicros - it->second.latencyMicros;
+    it->second = *sample;
+
+    // Negative deltas mean the shard's primary restarted or stepped over to another node, so its
+    // cumulative counters started over; re-baseline without reporting a latency.
+    if (deltaOps <= 0 || deltaLatencyMicros < 0) {
+        return boost::none;
+    }
+
+    return Milliseconds(deltaLatencyMicros / deltaOps / 1000);
+}
+
 }  // namespace mongo
@@ -31,6 +31,8 @@
 
 #include "mongo/db/s/balancer/balancer_random.h"
 #include "mongo/db/s/balancer/cluster_statistics.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 
@@ -49,12 +51,36 @@ public:
     StatusWith<std::vector<ShardStatistics>> getCollStats(OperationContext* opCtx,
                                                           NamespaceString const& ns) override;
 
+    /**
+     * Cumulative read/write operation latency counters as reported by a shard's serverStatus.
+     */
+    struct OpLatencySample {
+        long long latencyMicros{0};
+        long long ops{0};
+    };
+
 private:
     StatusWith<std::vector<ShardStatistics>> _getStats(OperationContext* opCtx,
                                                        boost::optional<NamespaceString> ns);
 
+    /**
+     * Stores 'sample' as the most recent latency counters seen for 'shardId' and returns the
+     * average operation latency over the interval since the previously stored sample, or
+     * boost::none if this is the first sample or the counters went backwards.
+     */
+    boost::optional<Milliseconds> _updateOpLatencySample(
+        const ShardId& shardId, const boost::optional<OpLatencySample>& sample);
+
     // Source of randomness when metadata needs to be randomized.
     BalancerRandomSource& _random;
+
+    // Protects the map below.
+    Mutex _opLatencySamplesMutex =
+        MONGO_MAKE_LATCH("ClusterStatisticsImpl::_opLatencySamplesMutex");
+
+    // The most recent cumulative latency counters seen for each shard, used to compute per-round
+    // latency averages.
+    stdx::unordered_map<ShardId, OpLatencySample, ShardId::Hasher> _lastOpLatencySamples;
 };
 
 }  // namespace mongo
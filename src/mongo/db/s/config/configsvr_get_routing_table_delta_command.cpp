@@ -0,0 +1,236 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/s/catalog/sharding_catalog_client.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/catalog/type_collection.h"
+#include "mongo/s/grid.h"
+#include "mongo/s/request_types/get_routing_table_delta_gen.h"
+#include "mongo/util/lru_cache.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Bounded cache of serialized routing table delta responses, keyed by namespace and the version
+ * the requester already has. After a round of migrations every router in the cluster asks for the
+ * same chunk diff, so the first request pays for the aggregation and the serialization and the
+ * rest are answered with two indexed point reads used to prove the cached response is current.
+ */
+class RoutingTableDeltaCache {
+public:
+    struct CachedDelta {
+        // The collection version (highest chunk lastmod) the delta was computed at, and the
+        // collection epoch at that time. A cached response may only be served while both still
+        // match the current metadata.
+        ChunkVersion collectionVersion;
+        OID epoch;
+        ConfigsvrGetRoutingTableDeltaResponse response;
+    };
+
+    boost::optional<ConfigsvrGetRoutingTableDeltaResponse> lookup(
+        const std::string& key, const OID& currentEpoch, const ChunkVersion& currentVersion) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _cache.find(key);
+        if (it == _cache.end()) {
+            return boost::none;
+        }
+        const auto& cached = it->second;
+        if (cached.epoch != currentEpoch || cached.collectionVersion != currentVersion) {
+            return boost::none;
+        }
+        return cached.response;
+    }
+
+    void insert(const std::string& key, CachedDelta delta) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _cache.add(key, std::move(delta));
+    }
+
+private:
+    // Bounds the memory the cache may pin. Entries for collections which stopped changing are
+    // naturally evicted as other collections' deltas are cached.
+    static constexpr size_t kMaxCachedDeltas = 256;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("RoutingTableDeltaCache::_mutex");
+    LRUCache<std::string, CachedDelta> _cache{kMaxCachedDeltas};
+};
+
+const auto routingTableDeltaCache = ServiceContext::declareDecoration<RoutingTableDeltaCache>();
+
+class ConfigsvrGetRoutingTableDeltaCmd final
+    : public TypedCommand<ConfigsvrGetRoutingTableDeltaCmd> {
+public:
+    using Request = ConfigsvrGetRoutingTableDelta;
+    using Response = ConfigsvrGetRoutingTableDeltaResponse;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        Response typedRun(OperationContext* opCtx) {
+            uassert(ErrorCodes::IllegalOperation,
+                    str::stream() << ConfigsvrGetRoutingTableDelta::kCommandName
+                                  << " can only be run on config servers",
+                    serverGlobalParams.clusterRole == ClusterRole::ConfigServer);
+
+            const NamespaceString& nss = ns();
+            const auto& sinceVersion = request().getSinceVersion();
+
+            const auto configShard = Grid::get(opCtx)->shardRegistry()->getConfigShard();
+            const ReadPreferenceSetting readPref{ReadPreference::PrimaryOnly};
+
+            // Two indexed point reads establish the collection's epoch and current version, which
+            // is all that is needed to decide whether a cached response is still current.
+            auto collFind = uassertStatusOK(
+                configShard->exhaustiveFindOnConfig(opCtx,
+                                                    readPref,
+                                                    repl::ReadConcernLevel::kMajorityReadConcern,
+                                                    CollectionType::ConfigNS,
+                                                    BSON(CollectionType::kNssFieldName << nss.ns()),
+                                                    BSONObj(),
+                                                    1));
+            uassert(ErrorCodes::NamespaceNotFound,
+                    str::stream() << "Collection " << nss.ns() << " not found",
+                    !collFind.docs.empty());
+            const CollectionType coll(collFind.docs.front());
+
+            auto chunkFind = uassertStatusOK(
+                configShard->exhaustiveFindOnConfig(opCtx,
+                                                    readPref,
+                                                    repl::ReadConcernLevel::kMajorityReadConcern,
+                                                    ChunkType::ConfigNS,
+                                                    BSON(ChunkType::collectionUUID()
+                                                         << coll.getUuid()),
+                                                    BSON(ChunkType::lastmod() << -1),
+                                                    1));
+
+            auto& cache = routingTableDeltaCache(opCtx->getServiceContext());
+            const auto cacheKey = nss.ns() + "|" + sinceVersion.toString();
+
+            if (!chunkFind.docs.empty()) {
+                const auto currentVersion = uassertStatusOK(ChunkType::parseFromConfigBSON(
+                                                                chunkFind.docs.front(),
+                                                                coll.getEpoch(),
+                                                                coll.getTimestamp()))
+                                                .getVersion();
+
+                if (auto cached = cache.lookup(cacheKey, coll.getEpoch(), currentVersion)) {
+                    LOGV2_DEBUG(6650033,
+                                1,
+                                "Serving routing table delta from cache",
+                                "namespace"_attr = nss.ns(),
+                                "sinceVersion"_attr = sinceVersion,
+                                "collectionVersion"_attr = currentVersion);
+                    return std::move(*cached);
+                }
+            }
+
+            // Compute the delta the same way the aggregation-based refresh path does.
+            auto collAndChunks = Grid::get(opCtx)->catalogClient()->getCollectionAndChunks(
+                opCtx,
+                nss,
+                sinceVersion,
+                repl::ReadConcernArgs(repl::ReadConcernLevel::kSnapshotReadConcern));
+
+            Response response;
+            response.setCollection(collAndChunks.first.toBSON());
+            std::vector<BSONObj> changedChunks;
+            changedChunks.reserve(collAndChunks.second.size());
+            for (const auto& chunk : collAndChunks.second) {
+                changedChunks.push_back(chunk.toConfigBSON());
+            }
+            response.setChangedChunks(std::move(changedChunks));
+
+            // The delta is a 'lastmod >= sinceVersion' fetch in ascending lastmod order, so its
+            // last chunk carries the collection version the snapshot observed. If further chunk
+            // changes commit afterwards, the validation reads above will stop matching and the
+            // next request recomputes.
+            if (!collAndChunks.second.empty()) {
+                cache.insert(cacheKey,
+                             {collAndChunks.second.back().getVersion(),
+                              collAndChunks.first.getEpoch(),
+                              response});
+            }
+
+            return response;
+        }
+
+    private:
+        NamespaceString ns() const override {
+            return request().getCommandParameter();
+        }
+
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            uassert(ErrorCodes::Unauthorized,
+                    "Unauthorized",
+                    AuthorizationSession::get(opCtx->getClient())
+                        ->isAuthorizedForActionsOnResource(ResourcePattern::forClusterResource(),
+                                                           ActionType::internal));
+        }
+    };
+
+    bool skipApiVersionCheck() const override {
+        // Internal command (server to server).
+        return true;
+    }
+
+    std::string help() const override {
+        return "Internal command, which is exported by the sharding config server. Do not call "
+               "directly. Returns the collection entry and the chunks which changed since the "
+               "given collection version, serving repeated identical requests from a cache of "
+               "serialized responses.";
+    }
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kNever;
+    }
+
+} configsvrGetRoutingTableDeltaCmd;
+
+}  // namespace
+}  // namespace mongo
@@ -840,20 +840,28 @@ void CreateCollectionCoordinator::_createCollectionOnNonPrimaryShards(
                 "Create collection _createCollectionOnNonPrimaryShards",
                 "namespace"_attr = nss());
 
-    std::vector<AsyncRequestsSender::Request> requests;
-    std::set<ShardId> initializedShards;
     auto dbPrimaryShardId = ShardingState::get(opCtx)->shardId();
 
-    NamespaceStringOrUUID nssOrUUID{nss().db().toString(), *_collectionUUID};
-    auto [collOptions, indexes, idIndex] = getCollectionOptionsAndIndexes(opCtx, nssOrUUID);
-
+    std::set<ShardId> participantShards;
     for (const auto& chunk : _initialChunks.chunks) {
         const auto& chunkShardId = chunk.getShard();
-        if (chunkShardId == dbPrimaryShardId ||
-            initializedShards.find(chunkShardId) != initializedShards.end()) {
-            continue;
+        if (chunkShardId != dbPrimaryShardId) {
+            participantShards.insert(chunkShardId);
         }
+    }
+
+    // All initial chunks are owned by the primary shard, which already has the collection. Skip
+    // gathering the collection options and indexes just to build an empty request list.
+    if (participantShards.empty()) {
+        return;
+    }
+
+    NamespaceStringOrUUID nssOrUUID{nss().db().toString(), *_collectionUUID};
+    auto [collOptions, indexes, idIndex] = getCollectionOptionsAndIndexes(opCtx, nssOrUUID);
 
+    std::vector<AsyncRequestsSender::Request> requests;
+    requests.reserve(participantShards.size());
+    for (const auto& chunkShardId : participantShards) {
         ShardsvrCreateCollectionParticipant createCollectionParticipantRequest(nss());
         createCollectionParticipantRequest.setCollectionUUID(*_collectionUUID);
 
@@ -865,34 +873,30 @@ void CreateCollectionCoordinator::_createCollectionOnNonPrimaryShards(
             chunkShardId,
             CommandHelpers::appendMajorityWriteConcern(
                 createCollectionParticipantRequest.toBSON(osi ? osi->toBSON() : BSONObj())));
-
-        initializedShards.emplace(chunkShardId);
     }
 
-    if (!requests.empty()) {
-        auto responses = gatherResponses(opCtx,
-                                         nss().db(),
-                                         ReadPreferenceSetting(ReadPreference::PrimaryOnly),
-                                         Shard::RetryPolicy::kIdempotent,
-                                         requests);
-
-        // If any shards fail to create the collection, fail the entire shardCollection command
-        // (potentially leaving incomplely created sharded collection)
-        for (const auto& response : responses) {
-            auto shardResponse = uassertStatusOKWithContext(
-                std::move(response.swResponse),
-                str::stream() << "Unable to create collection " << nss().ns() << " on "
-                              << response.shardId);
-            auto status = getStatusFromCommandResult(shardResponse.data);
-            uassertStatusOK(status.withContext(str::stream()
-                                               << "Unable to create collection " << nss().ns()
-                                               << " on " << response.shardId));
-
-            auto wcStatus = getWriteConcernStatusFromCommandResult(shardResponse.data);
-            uassertStatusOK(wcStatus.withContext(str::stream()
-                                                 << "Unable to create collection " << nss().ns()
-                                                 << " on " << response.shardId));
-        }
+    auto responses = gatherResponses(opCtx,
+                                     nss().db(),
+                                     ReadPreferenceSetting(ReadPreference::PrimaryOnly),
+                                     Shard::RetryPolicy::kIdempotent,
+                                     requests);
+
+    // If any shards fail to create the collection, fail the entire shardCollection command
+    // (potentially leaving incomplely created sharded collection)
+    for (const auto& response : responses) {
+        auto shardResponse = uassertStatusOKWithContext(
+            std::move(response.swResponse),
+            str::stream() << "Unable to create collection " << nss().ns() << " on "
+                          << response.shardId);
+        auto status = getStatusFromCommandResult(shardResponse.data);
+        uassertStatusOK(status.withContext(str::stream() << "Unable to create collection "
+                                                         << nss().ns() << " on "
+                                                         << response.shardId));
+
+        auto wcStatus = getWriteConcernStatusFromCommandResult(shardResponse.data);
+        uassertStatusOK(wcStatus.withContext(str::stream() << "Unable to create collection "
+                                                           << nss().ns() << " on "
+                                                           << response.shardId));
     }
 }
 
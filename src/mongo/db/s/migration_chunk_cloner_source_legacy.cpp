@@ -75,6 +75,11 @@ const char kRecvChunkAbort[] = "_recvChunkAbort";
 const int kMaxObjectPerChunk{250000};
 const Hours kMaxWaitToCommitCloneForJumboChunk(6);
 
+// How many record ids to drain from '_cloneLocs' per acquisition of the cloner mutex when
+// building a clone batch. Draining in bulk keeps the mutex from being taken and released once
+// per document while the batch's documents are fetched.
+const size_t kCloneLocsBatchSize = 250;
+
 MONGO_FAIL_POINT_DEFINE(failTooMuchMemoryUsed);
 
 bool isInRange(const BSONObj& obj,
@@ -682,38 +687,56 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
-    stdx::unique_lock<Latch> lk(_mutex);
-    auto iter = _cloneLocs.begin();
+    // Drain record ids from '_cloneLocs' a batch at a time, so the mutex is taken once per batch
+    // instead of once per document while the documents themselves are fetched and appended
+    // without any lock held. Record ids whose documents end up not fitting in this response are
+    // put back for the next batch.
+    std::vector<RecordId> recordIds;
+    const auto returnUnprocessed = [&](size_t firstUnprocessed) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _cloneLocs.insert(recordIds.begin() + firstUnprocessed, recordIds.end());
+    };
 
-    for (; iter != _cloneLocs.end(); ++iter) {
-        // We must always make progress in this method by at least one document because empty
-        // return indicates there is no more initial clone data.
-        if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
-            break;
+    while (true) {
+        recordIds.clear();
+
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            auto iter = _cloneLocs.begin();
+            while (iter != _cloneLocs.end() && recordIds.size() < kCloneLocsBatchSize) {
+                recordIds.push_back(*iter);
+                ++iter;
+            }
+            _cloneLocs.erase(_cloneLocs.begin(), iter);
         }
 
-        auto nextRecordId = *iter;
+        if (recordIds.empty()) {
+            return;
+        }
 
-        lk.unlock();
+        for (size_t i = 0; i < recordIds.size(); ++i) {
+            // We must always make progress in this method by at least one document because empty
+            // return indicates there is no more initial clone data.
+            if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
+                returnUnprocessed(i);
+                return;
+            }
 
-        Snapshotted<BSONObj> doc;
-        if (collection->findDoc(opCtx, nextRecordId, &doc)) {
-            // Use the builder size instead of accumulating the document sizes directly so
-            // that we take into consideration the overhead of BSONArray indices.
-            if (arrBuilder->arrSize() &&
-                (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+            Snapshotted<BSONObj> doc;
+            if (collection->findDoc(opCtx, recordIds[i], &doc)) {
+                // Use the builder size instead of accumulating the document sizes directly so
+                // that we take into consideration the overhead of BSONArray indices.
+                if (arrBuilder->arrSize() &&
+                    (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+                    returnUnprocessed(i);
+                    return;
+                }
 
-                break;
+                arrBuilder->append(doc.value());
+                ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
             }
-
-            arrBuilder->append(doc.value());
-            ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
         }
-
-        lk.lock();
     }
-
-    _cloneLocs.erase(_cloneLocs.begin(), iter);
 }
 
 uint64_t MigrationChunkClonerSourceLegacy::getCloneBatchBufferAllocationSize() {
@@ -526,7 +526,7 @@ repl::OpTime MigrationDestinationManager::fetchAndApplyBatch(
     std::function<bool(OperationContext*, BSONObj*)> fetchBatchFn) {
 
     SingleProducerSingleConsumerQueue<BSONObj>::Options options;
-    options.maxQueueDepth = 1;
+    options.maxQueueDepth = static_cast<size_t>(migrateFetchAheadBatchCount.load());
 
     SingleProducerSingleConsumerQueue<BSONObj> batches(options);
     repl::OpTime lastOpApplied;
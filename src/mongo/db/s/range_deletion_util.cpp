@@ -42,6 +42,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/dbhelpers.h"
+#include "mongo/db/exec/batched_delete_stage.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/index/index_descriptor.h"
@@ -53,9 +54,11 @@
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/wait_for_majority_service.h"
 #include "mongo/db/s/migration_util.h"
 #include "mongo/db/s/shard_key_index_util.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/remove_saver.h"
@@ -164,12 +167,22 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
     auto deleteStageParams = std::make_unique<DeleteStageParams>();
     deleteStageParams->fromMigrate = true;
     deleteStageParams->isMulti = true;
-    deleteStageParams->returnDeleted = true;
 
+    boost::optional<std::unique_ptr<BatchedDeleteStageBatchParams>> batchedDeleteParams;
     if (serverGlobalParams.moveParanoia) {
+        // The batched delete stage does not support a RemoveSaver, so paranoid mode falls back to
+        // document-by-document deletion.
+        deleteStageParams->returnDeleted = true;
         deleteStageParams->removeSaver =
             std::make_unique<RemoveSaver>("moveChunk", nss.ns(), "cleaning");
+    } else {
+        // Resolve the record ids for the batch with a single pass of the shard key index and
+        // remove them in one storage transaction, rather than executing an index lookup and a
+        // separate transaction per deleted document.
+        batchedDeleteParams = std::make_unique<BatchedDeleteStageBatchParams>();
+        (*batchedDeleteParams)->targetPassDocs = numDocsToRemovePerBatch;
     }
+    const bool batched = batchedDeleteParams.has_value();
 
     auto exec =
         InternalPlanner::deleteWithShardKeyIndexScan(opCtx,
@@ -180,57 +193,88 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
                                                      max,
                                                      BoundInclusion::kIncludeStartKeyOnly,
                                                      PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
-                                                     InternalPlanner::FORWARD);
+                                                     InternalPlanner::FORWARD,
+                                                     std::move(batchedDeleteParams));
 
     if (MONGO_unlikely(hangBeforeDoingDeletion.shouldFail())) {
         LOGV2(23768, "Hit hangBeforeDoingDeletion failpoint");
         hangBeforeDoingDeletion.pauseWhileSet(opCtx);
     }
 
-    int numDeleted = 0;
-    do {
-        BSONObj deletedObj;
+    if (throwWriteConflictExceptionInDeleteRange.shouldFail()) {
+        throw WriteConflictException();
+    }
 
-        if (throwWriteConflictExceptionInDeleteRange.shouldFail()) {
-            throw WriteConflictException();
-        }
+    if (throwInternalErrorInDeleteRange.shouldFail()) {
+        uasserted(ErrorCodes::InternalError, "Failing for test");
+    }
 
-        if (throwInternalErrorInDeleteRange.shouldFail()) {
-            uasserted(ErrorCodes::InternalError, "Failing for test");
+    int numDeleted = 0;
+    try {
+        if (batched) {
+            numDeleted = exec->executeDelete();
+        } else {
+            do {
+                BSONObj deletedObj;
+                auto state = exec->getNext(&deletedObj, nullptr);
+                if (state == PlanExecutor::IS_EOF) {
+                    break;
+                }
+                invariant(PlanExecutor::ADVANCED == state);
+            } while (++numDeleted < numDocsToRemovePerBatch);
         }
+    } catch (const DBException& ex) {
+        auto&& explainer = exec->getPlanExplainer();
+        auto&& [stats, _] = explainer.getWinningPlanStats(ExplainOptions::Verbosity::kExecStats);
+        LOGV2_WARNING(23776,
+                      "Cursor error while trying to delete {min} to {max} in {namespace}, "
+                      "stats: {stats}, error: {error}",
+                      "Cursor error while trying to delete range",
+                      "min"_attr = redact(min),
+                      "max"_attr = redact(max),
+                      "namespace"_attr = nss,
+                      "stats"_attr = redact(stats),
+                      "error"_attr = redact(ex.toStatus()));
+        throw;
+    }
 
-        PlanExecutor::ExecState state;
-        try {
-            state = exec->getNext(&deletedObj, nullptr);
-        } catch (const DBException& ex) {
-            auto&& explainer = exec->getPlanExplainer();
-            auto&& [stats, _] =
-                explainer.getWinningPlanStats(ExplainOptions::Verbosity::kExecStats);
-            LOGV2_WARNING(23776,
-                          "Cursor error while trying to delete {min} to {max} in {namespace}, "
-                          "stats: {stats}, error: {error}",
-                          "Cursor error while trying to delete range",
-                          "min"_attr = redact(min),
-                          "max"_attr = redact(max),
-                          "namespace"_attr = nss,
-                          "stats"_attr = redact(stats),
-                          "error"_attr = redact(ex.toStatus()));
-            throw;
-        }
+    ShardingStatistics::get(opCtx).countDocsDeletedOnDonor.addAndFetch(numDeleted);
+
+    return numDeleted;
+}
 
-        if (state == PlanExecutor::IS_EOF) {
-            break;
-        }
 
-        invariant(PlanExecutor::ADVANCED == state);
-        ShardingStatistics::get(opCtx).countDocsDeletedOnDonor.addAndFetch(1);
+/**
+ * Returns the delay to apply before the next deletion batch. When the majority-commit point lags
+ * the primary's last applied operation by more than 'rangeDeleterMaxReplicationLagMS', the
+ * configured delay is extended proportionally to the lag, so that orphan cleanup backs off rather
+ * than adding write load to a replica set that is already falling behind. The extension is capped
+ * at ten times the lag threshold so that a stalled secondary cannot park range deletion forever.
+ */
+Milliseconds delayForReplicationLag(OperationContext* opCtx, Milliseconds delayBetweenBatches) {
+    const Milliseconds maxLag{rangeDeleterMaxReplicationLagMS.load()};
+    if (maxLag <= Milliseconds(0)) {
+        return delayBetweenBatches;
+    }
 
-    } while (++numDeleted < numDocsToRemovePerBatch);
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    const auto lastAppliedWall = replCoord->getMyLastAppliedOpTimeAndWallTime().wallTime;
+    const auto lastCommittedWall = replCoord->getLastCommittedOpTimeAndWallTime().wallTime;
+    if (lastAppliedWall == Date_t() || lastCommittedWall == Date_t() ||
+        lastAppliedWall <= lastCommittedWall + maxLag) {
+        return delayBetweenBatches;
+    }
 
-    return numDeleted;
+    const auto lag = duration_cast<Milliseconds>(lastAppliedWall - lastCommittedWall);
+    const auto throttle = std::min(lag, 10 * maxLag);
+    LOGV2_DEBUG(6650032,
+                1,
+                "Throttling range deletion because of replication lag",
+                "lag"_attr = lag,
+                "delay"_attr = delayBetweenBatches + throttle);
+    return delayBetweenBatches + throttle;
 }
 
-
 template <typename Callable>
 auto withTemporaryOperationContext(Callable&& callable, const NamespaceString& nss) {
     ThreadClient tc(migrationutil::kRangeDeletionThreadName, getGlobalServiceContext());
@@ -347,7 +391,7 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                            // (SERVER-62368) The range-deleter executor is mono-threaded, so
                            // sleeping synchronously for `delayBetweenBatches` ensures that no other
                            // batch is going to be cleared up before the expected delay.
-                           opCtx->sleepFor(delayBetweenBatches);
+                           opCtx->sleepFor(delayForReplicationLag(opCtx, delayBetweenBatches));
                        }
 
                        return numDeleted;
@@ -1010,6 +1010,21 @@ TEST_F(TransactionCoordinatorDriverPersistenceTest,
     deleteCoordinatorDocExpectSuccess(operationContext(), _lsid, _txnNumberAndRetryCounter);
 }
 
+TEST_F(TransactionCoordinatorDriverPersistenceTest,
+       PersistParticipantListThenDecisionThenDeleteSucceedsWithDocumentWriteBatchingDisabled) {
+    RAIIServerParameterControllerForTest batchWritesController{
+        "batchTransactionCoordinatorDocumentWrites", false};
+
+    persistParticipantListExpectSuccess(
+        operationContext(), _lsid, _txnNumberAndRetryCounter, _participants);
+    persistDecisionExpectSuccess(operationContext(),
+                                 _lsid,
+                                 _txnNumberAndRetryCounter,
+                                 _participants,
+                                 _commitTimestamp /* commit */);
+    deleteCoordinatorDocExpectSuccess(operationContext(), _lsid, _txnNumberAndRetryCounter);
+}
+
 TEST_F(TransactionCoordinatorDriverPersistenceTest,
        MultipleTxnNumbersCommitDecisionsPersistedAndDeleteOneSuccessfullyRemovesCorrectDecision) {
     const TxnNumberAndRetryCounter txnNumberAndRetryCounter1{
@@ -33,6 +33,9 @@
 
 #include "mongo/db/s/transaction_coordinator_util.h"
 
+#include <algorithm>
+#include <deque>
+
 #include "mongo/client/remote_command_retry_scheduler.h"
 #include "mongo/db/commands/txn_cmds_gen.h"
 #include "mongo/db/commands/txn_two_phase_commit_cmds_gen.h"
@@ -43,11 +46,14 @@
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/s/transaction_coordinator_futures_util.h"
+#include "mongo/db/s/transaction_coordinator_params_gen.h"
 #include "mongo/db/s/transaction_coordinator_worker_curop_repository.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/fail_point.h"
 
 namespace mongo {
@@ -101,6 +107,238 @@ bool shouldRetryPersistingCoordinatorState(const StatusWith<T>& responseStatus)
         responseStatus != ErrorCodes::TransactionCoordinatorSteppingDown;
 }
 
+/**
+ * Coalesces the coordinators' single-document writes against config.transaction_coordinators into
+ * multi-statement write commands, in the style of journal group commit: the first thread to begin
+ * a flush writes every statement that queued up while the previous flush was running, so no
+ * artificial delay is ever introduced and a batch degenerates to a single-statement command when
+ * there is no concurrency. Each coordinator write is tiny, so under a high rate of concurrent
+ * cross-shard transactions the fixed per-command cost dominates; batching amortizes it.
+ *
+ * A batched statement's outcome can only be attributed to an individual transaction when the whole
+ * batch is conclusive (see the flush functions below). In all other cases the affected callers are
+ * told to redo their writes individually, so that the pre-existing per-transaction error analysis
+ * runs against a single-statement response.
+ */
+template <typename OpEntry>
+class CoordinatorWriteBatcher {
+public:
+    /**
+     * Resolves a flushed batch to a per-statement outcome: the opTime to acknowledge for
+     * statements known to have succeeded, or boost::none for statements which must be redone
+     * individually. Must not throw.
+     */
+    using FlushFn = std::vector<boost::optional<repl::OpTime>> (*)(OperationContext*,
+                                                                   const std::vector<OpEntry>&);
+
+    explicit CoordinatorWriteBatcher(FlushFn flushFn) : _flushFn(flushFn) {}
+
+    /**
+     * Submits one statement and blocks until it has been flushed as part of a batch (possibly by
+     * another thread). Returns the opTime to acknowledge with, or boost::none if the caller must
+     * perform its write individually on its own operation context.
+     */
+    boost::optional<repl::OpTime> write(OperationContext* opCtx, OpEntry entry) {
+        PendingWrite pending(std::move(entry));
+
+        stdx::unique_lock<Latch> lk(_mutex);
+        if (_flushInProgress) {
+            _pending.push_back(&pending);
+            _waitUntilResolved(opCtx, lk, &pending);
+            if (pending.outcome != Outcome::kBecomeFlusher)
+                return pending.outcome == Outcome::kDone ? boost::make_optional(pending.opTime)
+                                                         : boost::none;
+        } else {
+            _flushInProgress = true;
+        }
+
+        // This thread is the flusher: claim every queued statement plus its own and write them all
+        // as one command on this thread's operation context. Claimed writes must not be withdrawn
+        // by their owners until an outcome has been delivered.
+        std::vector<PendingWrite*> batch;
+        batch.push_back(&pending);
+        for (auto* queued : _pending) {
+            queued->claimed = true;
+            batch.push_back(queued);
+        }
+        _pending.clear();
+        lk.unlock();
+
+        std::vector<OpEntry> entries;
+        entries.reserve(batch.size());
+        for (auto* write : batch) {
+            entries.push_back(write->entry);
+        }
+
+        auto outcomes = _flushFn(opCtx, entries);
+        invariant(outcomes.size() == batch.size());
+
+        lk.lock();
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i]->outcome = outcomes[i] ? Outcome::kDone : Outcome::kWriteIndividually;
+            batch[i]->opTime = outcomes[i].value_or(repl::OpTime());
+            batch[i]->resolved = true;
+        }
+
+        // Hand the next flush over to a waiter rather than looping here, so that a steady stream
+        // of new arrivals cannot starve the thread which happened to flush first.
+        if (_pending.empty()) {
+            _flushInProgress = false;
+        } else {
+            auto* nextFlusher = _pending.front();
+            _pending.pop_front();
+            nextFlusher->outcome = Outcome::kBecomeFlusher;
+            nextFlusher->resolved = true;
+        }
+        lk.unlock();
+        _cv.notify_all();
+
+        return pending.outcome == Outcome::kDone ? boost::make_optional(pending.opTime)
+                                                 : boost::none;
+    }
+
+private:
+    enum class Outcome { kDone, kWriteIndividually, kBecomeFlusher };
+
+    struct PendingWrite {
+        explicit PendingWrite(OpEntry entry) : entry(std::move(entry)) {}
+
+        OpEntry entry;
+        bool claimed{false};
+        bool resolved{false};
+        Outcome outcome{Outcome::kWriteIndividually};
+        repl::OpTime opTime;
+    };
+
+    void _waitUntilResolved(OperationContext* opCtx,
+                            stdx::unique_lock<Latch>& lk,
+                            PendingWrite* pending) {
+        try {
+            opCtx->waitForConditionOrInterrupt(_cv, lk, [&] { return pending->resolved; });
+        } catch (const DBException&) {
+            if (!pending->claimed && !pending->resolved) {
+                // Not yet part of a flush; withdraw the statement and let the interruption
+                // propagate.
+                _pending.erase(std::find(_pending.begin(), _pending.end(), pending));
+                throw;
+            }
+            // A flusher already owns this statement, so its memory must remain valid until the
+            // outcome has been delivered. This wait is bounded by the in-progress flush and the
+            // interruption is rediscovered at the operation context's next interruption point.
+            _cv.wait(lk, [&] { return pending->resolved; });
+        }
+    }
+
+    const FlushFn _flushFn;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CoordinatorWriteBatcher::_mutex");
+    stdx::condition_variable _cv;
+    bool _flushInProgress{false};
+    std::deque<PendingWrite*> _pending;
+};
+
+/**
+ * Flushes a batch of coordinator document updates. An update statement's effect is idempotent
+ * (re-running a statement which already executed matches the "same participant list"/"same
+ * decision" arm of its query), so whenever the aggregated reply cannot be attributed per
+ * statement, it is safe for every caller to redo its write individually.
+ */
+std::vector<boost::optional<repl::OpTime>> flushCoordinatorUpdateBatch(
+    OperationContext* opCtx, const std::vector<write_ops::UpdateOpEntry>& entries) try {
+    DBDirectClient client(opCtx);
+
+    write_ops::UpdateCommandRequest updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
+    updateOp.setUpdates(entries);
+    updateOp.getWriteCommandRequestBase().setOrdered(false);
+
+    const auto commandResponse = client.runCommand(updateOp.serialize({}));
+    const auto commandReply = commandResponse->getCommandReply();
+
+    // The batch is only conclusive if every statement succeeded and matched (or upserted) exactly
+    // one document; an aggregated reply cannot tell apart which statements a smaller 'n' or a
+    // write error belongs to.
+    if (!getStatusFromWriteCommandReply(commandReply).isOK() ||
+        commandReply.getIntField("n") != static_cast<int>(entries.size())) {
+        return std::vector<boost::optional<repl::OpTime>>(entries.size(), boost::none);
+    }
+
+    return std::vector<boost::optional<repl::OpTime>>(
+        entries.size(), repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp());
+} catch (const DBException&) {
+    return std::vector<boost::optional<repl::OpTime>>(entries.size(), boost::none);
+}
+
+struct CoordinatorDeleteStatement {
+    // The _id of the coordinator document this statement targets.
+    BSONObj id;
+    write_ops::DeleteOpEntry entry;
+};
+
+/**
+ * Flushes a batch of coordinator document deletions. Unlike the updates, a delete must not be
+ * blindly redone: re-running a statement which already deleted its document is indistinguishable
+ * from the "document missing" anomaly which deleteCoordinatorDocBlocking turns into an error. So
+ * the batch is resolved as follows: if every statement matched a document, all succeeded; if no
+ * statement matched, nothing was deleted and all can safely be redone individually; and if only
+ * some matched, the documents are looked up and the statements whose documents still exist are
+ * redone individually (reproducing the proper error) while the rest are acknowledged with the
+ * batch's opTime. This attribution is best-effort in the same way as the error messages below:
+ * concurrent manual modification of the collection can be misattributed.
+ */
+std::vector<boost::optional<repl::OpTime>> flushCoordinatorDeleteBatch(
+    OperationContext* opCtx, const std::vector<CoordinatorDeleteStatement>& statements) try {
+    DBDirectClient client(opCtx);
+
+    write_ops::DeleteCommandRequest deleteOp(NamespaceString::kTransactionCoordinatorsNamespace);
+    deleteOp.setDeletes([&] {
+        std::vector<write_ops::DeleteOpEntry> deletes;
+        deletes.reserve(statements.size());
+        for (const auto& statement : statements) {
+            deletes.push_back(statement.entry);
+        }
+        return deletes;
+    }());
+    deleteOp.getWriteCommandRequestBase().setOrdered(false);
+
+    const auto commandResponse = client.runCommand(deleteOp.serialize({}));
+    const auto commandReply = commandResponse->getCommandReply();
+
+    const auto opTime = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    const auto numDeleted = commandReply.getIntField("n");
+
+    if (getStatusFromWriteCommandReply(commandReply).isOK() &&
+        numDeleted == static_cast<int>(statements.size())) {
+        return std::vector<boost::optional<repl::OpTime>>(statements.size(), opTime);
+    }
+
+    if (numDeleted <= 0) {
+        return std::vector<boost::optional<repl::OpTime>>(statements.size(), boost::none);
+    }
+
+    std::vector<boost::optional<repl::OpTime>> outcomes;
+    outcomes.reserve(statements.size());
+    for (const auto& statement : statements) {
+        const auto doc =
+            client.findOne(NamespaceString::kTransactionCoordinatorsNamespace,
+                           BSON(TransactionCoordinatorDocument::kIdFieldName << statement.id));
+        outcomes.push_back(doc.isEmpty() ? boost::make_optional(opTime)
+                                         : boost::optional<repl::OpTime>());
+    }
+    return outcomes;
+} catch (const DBException&) {
+    return std::vector<boost::optional<repl::OpTime>>(statements.size(), boost::none);
+}
+
+// The participant list and decision writes are batched separately (even though both produce update
+// statements) so that every statement in a batch runs under an operation context configured for
+// its phase; in particular the decision writes skip storage ticket acquisition (SERVER-60682).
+CoordinatorWriteBatcher<write_ops::UpdateOpEntry> participantListWriteBatcher{
+    &flushCoordinatorUpdateBatch};
+CoordinatorWriteBatcher<write_ops::UpdateOpEntry> decisionWriteBatcher{
+    &flushCoordinatorUpdateBatch};
+CoordinatorWriteBatcher<CoordinatorDeleteStatement> coordinatorDocDeleteBatcher{
+    &flushCoordinatorDeleteBatch};
+
 }  // namespace
 
 namespace {
@@ -129,57 +367,73 @@ repl::OpTime persistParticipantListBlocking(
         sessionInfo.setTxnRetryCounter(*txnNumberAndRetryCounter.getTxnRetryCounter());
     }
 
-    DBDirectClient client(opCtx);
+    const auto entry = [&] {
+        write_ops::UpdateOpEntry entry;
+
+        // Ensure that the document for the (lsid, txnNumber) either has no participant list or
+        // has the same participant list. The document may have the same participant list if an
+        // earlier attempt to write the participant list failed waiting for writeConcern.
+        BSONObj noParticipantList = BSON(TransactionCoordinatorDocument::kParticipantsFieldName
+                                         << BSON("$exists" << false));
+        BSONObj sameParticipantList =
+            BSON("$and" << buildParticipantListMatchesConditions(participantList));
+        entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                        << sessionInfo.toBSON() << "$or"
+                        << BSON_ARRAY(noParticipantList << sameParticipantList)));
+
+        // Update with participant list.
+        TransactionCoordinatorDocument doc;
+        doc.setId(sessionInfo);
+        doc.setParticipants(participantList);
+        entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
+
+        entry.setUpsert(true);
+        return entry;
+    }();
+
+    const auto opTime = [&]() -> repl::OpTime {
+        if (batchTransactionCoordinatorDocumentWrites.load()) {
+            if (auto batchedOpTime = participantListWriteBatcher.write(opCtx, entry)) {
+                return *batchedOpTime;
+            }
+        }
 
-    // Throws if serializing the request or deserializing the response fails.
-    const auto commandResponse = client.runCommand([&] {
-        write_ops::UpdateCommandRequest updateOp(
-            NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) either has no participant list or
-            // has the same participant list. The document may have the same participant list if an
-            // earlier attempt to write the participant list failed waiting for writeConcern.
-            BSONObj noParticipantList = BSON(TransactionCoordinatorDocument::kParticipantsFieldName
-                                             << BSON("$exists" << false));
-            BSONObj sameParticipantList =
-                BSON("$and" << buildParticipantListMatchesConditions(participantList));
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$or"
-                            << BSON_ARRAY(noParticipantList << sameParticipantList)));
-
-            // Update with participant list.
-            TransactionCoordinatorDocument doc;
-            doc.setId(std::move(sessionInfo));
-            doc.setParticipants(std::move(participantList));
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
-
-            entry.setUpsert(true);
-            return entry;
-        }()});
-        return updateOp.serialize({});
-    }());
+        // The write was not conclusively performed as part of a batch; run it individually so any
+        // error can be attributed to this transaction.
+        DBDirectClient client(opCtx);
+
+        // Throws if serializing the request or deserializing the response fails.
+        const auto commandResponse = client.runCommand([&] {
+            write_ops::UpdateCommandRequest updateOp(
+                NamespaceString::kTransactionCoordinatorsNamespace);
+            updateOp.setUpdates({entry});
+            return updateOp.serialize({});
+        }());
+
+        const auto upsertStatus =
+            getStatusFromWriteCommandReply(commandResponse->getCommandReply());
+
+        // Convert a DuplicateKey error to an anonymous error.
+        if (upsertStatus.code() == ErrorCodes::DuplicateKey) {
+            // Attempt to include the document for this (lsid, txnNumber) in the error message, if
+            // one exists. Note that this is best-effort: the document may have been deleted or
+            // manually changed since the update above ran.
+            const auto doc = client.findOne(
+                NamespaceString::kTransactionCoordinatorsNamespace,
+                BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
+            uasserted(51025,
+                      str::stream()
+                          << "While attempting to write participant list "
+                          << buildParticipantListString(participantList) << " for " << lsid.getId()
+                          << ':' << txnNumberAndRetryCounter.toBSON()
+                          << ", found document with a different participant list: " << doc);
+        }
 
-    const auto upsertStatus = getStatusFromWriteCommandReply(commandResponse->getCommandReply());
-
-    // Convert a DuplicateKey error to an anonymous error.
-    if (upsertStatus.code() == ErrorCodes::DuplicateKey) {
-        // Attempt to include the document for this (lsid, txnNumber) in the error message, if one
-        // exists. Note that this is best-effort: the document may have been deleted or manually
-        // changed since the update above ran.
-        const auto doc = client.findOne(
-            NamespaceString::kTransactionCoordinatorsNamespace,
-            BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
-        uasserted(51025,
-                  str::stream() << "While attempting to write participant list "
-                                << buildParticipantListString(participantList) << " for "
-                                << lsid.getId() << ':' << txnNumberAndRetryCounter.toBSON()
-                                << ", found document with a different participant list: " << doc);
-    }
+        // Throw any other error.
+        uassertStatusOK(upsertStatus);
 
-    // Throw any other error.
-    uassertStatusOK(upsertStatus);
+        return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    }();
 
     LOGV2_DEBUG(22465,
                 3,
@@ -187,7 +441,7 @@ repl::OpTime persistParticipantListBlocking(
                 "sessionId"_attr = lsid.getId(),
                 "txnNumberAndRetryCounter"_attr = txnNumberAndRetryCounter);
 
-    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    return opTime;
 }
 }  // namespace
 
@@ -351,63 +605,78 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
         sessionInfo.setTxnRetryCounter(*txnNumberAndRetryCounter.getTxnRetryCounter());
     }
 
-    DBDirectClient client(opCtx);
+    const auto entry = [&] {
+        write_ops::UpdateOpEntry entry;
 
-    // Throws if serializing the request or deserializing the response fails.
-    const auto commandResponse = client.runCommand([&] {
-        write_ops::UpdateCommandRequest updateOp(
-            NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) has the same participant list and
-            // either has no decision or the same decision. The document may have the same decision
-            // if an earlier attempt to write the decision failed waiting for writeConcern.
-            BSONObj noDecision = BSON(TransactionCoordinatorDocument::kDecisionFieldName
-                                      << BSON("$exists" << false));
-            BSONObj sameDecision =
-                BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
-
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$and"
-                            << buildParticipantListMatchesConditions(participantList) << "$or"
-                            << BSON_ARRAY(noDecision << sameDecision)));
-
-            entry.setUpsert(true);
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
-                TransactionCoordinatorDocument doc;
-                doc.setId(sessionInfo);
-                doc.setParticipants(std::move(participantList));
-                doc.setDecision(decision);
-                return doc.toBSON();
-            }()));
-
-            return entry;
-        }()});
-        return updateOp.serialize({});
-    }());
+        // Ensure that the document for the (lsid, txnNumber) has the same participant list and
+        // either has no decision or the same decision. The document may have the same decision
+        // if an earlier attempt to write the decision failed waiting for writeConcern.
+        BSONObj noDecision = BSON(TransactionCoordinatorDocument::kDecisionFieldName
+                                  << BSON("$exists" << false));
+        BSONObj sameDecision =
+            BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
 
-    const auto commandReply = commandResponse->getCommandReply();
-    uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
-
-    // If no document matched, throw an anonymous error. (The update itself will not have thrown an
-    // error, because it's legal for an update to match no documents.)
-    if (commandReply.getIntField("n") != 1) {
-        // Attempt to include the document for this (lsid, txnNumber) in the error message, if one
-        // exists. Note that this is best-effort: the document may have been deleted or manually
-        // changed since the update above ran.
-        const auto doc = client.findOne(
-            NamespaceString::kTransactionCoordinatorsNamespace,
-            BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
-        uasserted(51026,
-                  str::stream() << "While attempting to write decision "
-                                << (isCommit ? "'commit'" : "'abort'") << " for" << lsid.getId()
-                                << ':' << txnNumberAndRetryCounter.toBSON()
-                                << ", either failed to find document for this lsid:txnNumber or "
-                                   "document existed with a different participant list, decision "
-                                   "or commitTimestamp: "
-                                << doc);
-    }
+        entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                        << sessionInfo.toBSON() << "$and"
+                        << buildParticipantListMatchesConditions(participantList) << "$or"
+                        << BSON_ARRAY(noDecision << sameDecision)));
+
+        entry.setUpsert(true);
+        entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
+            TransactionCoordinatorDocument doc;
+            doc.setId(sessionInfo);
+            doc.setParticipants(participantList);
+            doc.setDecision(decision);
+            return doc.toBSON();
+        }()));
+
+        return entry;
+    }();
+
+    const auto opTime = [&]() -> repl::OpTime {
+        if (batchTransactionCoordinatorDocumentWrites.load()) {
+            if (auto batchedOpTime = decisionWriteBatcher.write(opCtx, entry)) {
+                return *batchedOpTime;
+            }
+        }
+
+        // The write was not conclusively performed as part of a batch; run it individually so any
+        // error can be attributed to this transaction.
+        DBDirectClient client(opCtx);
+
+        // Throws if serializing the request or deserializing the response fails.
+        const auto commandResponse = client.runCommand([&] {
+            write_ops::UpdateCommandRequest updateOp(
+                NamespaceString::kTransactionCoordinatorsNamespace);
+            updateOp.setUpdates({entry});
+            return updateOp.serialize({});
+        }());
+
+        const auto commandReply = commandResponse->getCommandReply();
+        uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
+
+        // If no document matched, throw an anonymous error. (The update itself will not have
+        // thrown an error, because it's legal for an update to match no documents.)
+        if (commandReply.getIntField("n") != 1) {
+            // Attempt to include the document for this (lsid, txnNumber) in the error message, if
+            // one exists. Note that this is best-effort: the document may have been deleted or
+            // manually changed since the update above ran.
+            const auto doc = client.findOne(
+                NamespaceString::kTransactionCoordinatorsNamespace,
+                BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
+            uasserted(51026,
+                      str::stream()
+                          << "While attempting to write decision "
+                          << (isCommit ? "'commit'" : "'abort'") << " for" << lsid.getId() << ':'
+                          << txnNumberAndRetryCounter.toBSON()
+                          << ", either failed to find document for this lsid:txnNumber or "
+                             "document existed with a different participant list, decision "
+                             "or commitTimestamp: "
+                          << doc);
+        }
+
+        return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    }();
 
     LOGV2_DEBUG(22469,
                 3,
@@ -417,7 +686,7 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
                 "txnNumberAndRetryCounter"_attr = txnNumberAndRetryCounter,
                 "decision"_attr = (isCommit ? "commit" : "abort"));
 
-    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    return opTime;
 }
 }  // namespace
 
@@ -560,49 +829,55 @@ void deleteCoordinatorDocBlocking(OperationContext* opCtx,
         sessionInfo.setTxnRetryCounter(*txnNumberAndRetryCounter.getTxnRetryCounter());
     }
 
-    DBDirectClient client(opCtx);
-
-    // Throws if serializing the request or deserializing the response fails.
-    auto commandResponse = client.runCommand([&] {
-        write_ops::DeleteCommandRequest deleteOp(
-            NamespaceString::kTransactionCoordinatorsNamespace);
-        deleteOp.setDeletes({[&] {
-            write_ops::DeleteOpEntry entry;
-
-            // Ensure the document is only deleted after a decision has been made.
-            BSONObj abortDecision =
-                BSON(TransactionCoordinatorDocument::kDecisionFieldName << "abort");
-            BSONObj commitDecision =
-                BSON(TransactionCoordinatorDocument::kDecisionFieldName << "commit");
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON()
-                            << TransactionCoordinatorDocument::kDecisionFieldName
-                            << BSON("$exists" << true)));
-
-            entry.setMulti(false);
-            return entry;
-        }()});
-        return deleteOp.serialize({});
-    }());
-
-    const auto commandReply = commandResponse->getCommandReply();
-    uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
-
-    // If no document matched, throw an anonymous error. (The delete itself will not have thrown an
-    // error, because it's legal for a delete to match no documents.)
-    if (commandReply.getIntField("n") != 1) {
-        // Attempt to include the document for this (lsid, txnNumber) in the error message, if one
-        // exists. Note that this is best-effort: the document may have been deleted or manually
-        // changed since the update above ran.
-        const auto doc = client.findOne(
-            NamespaceString::kTransactionCoordinatorsNamespace,
-            BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
-        uasserted(51027,
-                  str::stream() << "While attempting to delete document for " << lsid.getId() << ':'
-                                << txnNumberAndRetryCounter.toBSON()
-                                << ", either failed to find document for this lsid:txnNumber or "
-                                   "document existed without a decision: "
-                                << doc);
+    const auto entry = [&] {
+        write_ops::DeleteOpEntry entry;
+
+        // Ensure the document is only deleted after a decision has been made.
+        entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                        << sessionInfo.toBSON()
+                        << TransactionCoordinatorDocument::kDecisionFieldName
+                        << BSON("$exists" << true)));
+
+        entry.setMulti(false);
+        return entry;
+    }();
+
+    const bool deletedAsPartOfBatch = batchTransactionCoordinatorDocumentWrites.load() &&
+        coordinatorDocDeleteBatcher.write(opCtx, {sessionInfo.toBSON(), entry});
+
+    if (!deletedAsPartOfBatch) {
+        // The delete was not conclusively performed as part of a batch; run it individually so any
+        // error can be attributed to this transaction.
+        DBDirectClient client(opCtx);
+
+        // Throws if serializing the request or deserializing the response fails.
+        auto commandResponse = client.runCommand([&] {
+            write_ops::DeleteCommandRequest deleteOp(
+                NamespaceString::kTransactionCoordinatorsNamespace);
+            deleteOp.setDeletes({entry});
+            return deleteOp.serialize({});
+        }());
+
+        const auto commandReply = commandResponse->getCommandReply();
+        uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
+
+        // If no document matched, throw an anonymous error. (The delete itself will not have
+        // thrown an error, because it's legal for a delete to match no documents.)
+        if (commandReply.getIntField("n") != 1) {
+            // Attempt to include the document for this (lsid, txnNumber) in the error message, if
+            // one exists. Note that this is best-effort: the document may have been deleted or
+            // manually changed since the update above ran.
+            const auto doc = client.findOne(
+                NamespaceString::kTransactionCoordinatorsNamespace,
+                BSON(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
+            uasserted(51027,
+                      str::stream()
+                          << "While attempting to delete document for " << lsid.getId() << ':'
+                          << txnNumberAndRetryCounter.toBSON()
+                          << ", either failed to find document for this lsid:txnNumber or "
+                             "document existed without a decision: "
+                          << doc);
+        }
     }
 
     LOGV2_DEBUG(22474,
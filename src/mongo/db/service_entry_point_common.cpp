@@ -105,12 +105,14 @@
 #include "mongo/s/shard_cannot_refresh_due_to_locks_held_exception.h"
 #include "mongo/s/would_change_owning_shard_exception.h"
 #include "mongo/transport/hello_metrics.h"
+#include "mongo/transport/reply_buffer_pool.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/future_util.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -156,6 +158,42 @@ Future<void> runCommandInvocation(std::shared_ptr<RequestExecutionContext> rec,
         std::move(rec), std::move(invocation), threadingModel);
 }
 
+/**
+ * Remembers command "shapes" — the exact sequence of top-level field names in a request body —
+ * that have already been validated as containing no duplicate top-level keys. Drivers send the
+ * same handful of shapes millions of times, so on a hit the per-field hash-map bookkeeping in
+ * ExecCommandDatabase::_initiateCommand() can be skipped entirely; only the field values differ
+ * and those are extracted as before.
+ *
+ * Entries store the full concatenated field-name sequence and are compared byte-for-byte, so a
+ * hit can never mask a duplicate key; a slot collision between two shapes merely causes them to
+ * evict each other. Slots are plain shared_ptrs accessed with the std::atomic_* free functions,
+ * so lookups take no locks.
+ */
+class CommandShapeValidationCache {
+public:
+    bool isKnownDuplicateFree(const std::string& shape) const {
+        auto cached = std::atomic_load(&_slots[_slotFor(shape)]);  // NOLINT
+        return cached && *cached == shape;
+    }
+
+    void remember(std::string shape) {
+        auto& slot = _slots[_slotFor(shape)];
+        std::atomic_store(&slot, std::make_shared<const std::string>(std::move(shape)));  // NOLINT
+    }
+
+private:
+    static size_t _slotFor(const std::string& shape) {
+        return StringMapHasher()(shape) % kNumSlots;
+    }
+
+    static constexpr size_t kNumSlots = 512;
+
+    std::array<std::shared_ptr<const std::string>, kNumSlots> _slots;
+};
+
+CommandShapeValidationCache commandShapeValidationCache;
+
 /*
  * Allows for the very complex handleRequest function to be decomposed into parts.
  * It also provides the infrastructure to futurize the process of executing commands.
@@ -531,6 +569,7 @@ public:
     Future<void> run() {
         return makeReadyFutureWith([&] {
                    _initiateCommand();
+                   CurOp::get(_execContext->getOpCtx())->cycleSegments().mark(OpSegment::kSetup);
                    return _commandExec();
                })
             .onCompletion([this](Status status) {
@@ -1364,7 +1403,11 @@ void ExecCommandDatabase::_initiateCommand() {
     BSONElement maxTimeMSOpOnlyField;
     BSONElement helpField;
 
-    StringMap<int> topLevelFields;
+    // The sequence of top-level field names identifies the request's shape for the purpose of
+    // memoizing the duplicate-key validation below.
+    std::string commandShape;
+    commandShape.reserve(64);
+
     for (auto&& element : request.body) {
         StringData fieldName = element.fieldNameStringData();
         if (fieldName == query_request_helper::cmdOptionMaxTimeMS) {
@@ -1384,10 +1427,22 @@ void ExecCommandDatabase::_initiateCommand() {
                       "no such command option $maxTimeMs; use maxTimeMS instead");
         }
 
-        uassert(ErrorCodes::FailedToParse,
-                str::stream() << "Parsed command object contains duplicate top level key: "
-                              << fieldName,
-                topLevelFields[fieldName]++ == 0);
+        commandShape.append(fieldName.rawData(), fieldName.size());
+        commandShape.push_back('\0');
+    }
+
+    // A shape already seen cannot contain a duplicate top-level key, so the per-field hash-map
+    // check only runs the first time each layout is encountered.
+    if (!commandShapeValidationCache.isKnownDuplicateFree(commandShape)) {
+        StringMap<int> topLevelFields;
+        for (auto&& element : request.body) {
+            StringData fieldName = element.fieldNameStringData();
+            uassert(ErrorCodes::FailedToParse,
+                    str::stream() << "Parsed command object contains duplicate top level key: "
+                                  << fieldName,
+                    topLevelFields[fieldName]++ == 0);
+        }
+        commandShapeValidationCache.remember(std::move(commandShape));
     }
 
     if (CommandHelpers::isHelpRequest(helpField)) {
@@ -1833,12 +1888,16 @@ void curOpCommandSetup(OperationContext* opCtx, const OpMsgRequest& request) {
 
 Future<void> parseCommand(std::shared_ptr<HandleRequest::ExecutionContext> execContext) try {
     const auto& msg = execContext->getMessage();
-    auto opMsgReq = rpc::opMsgRequestFromAnyProtocol(msg);
+    // The execution context pins the message buffer for the duration of the operation, so the
+    // request can be parsed into unowned views of it without paying a reference count update (or
+    // worse, a copy) per document.
+    auto opMsgReq = rpc::opMsgRequestUnownedFromAnyProtocol(msg);
     if (msg.operation() == dbQuery) {
         checkAllowedOpQueryCommand(*(execContext->getOpCtx()->getClient()),
                                    opMsgReq.getCommandName());
     }
     execContext->setRequest(opMsgReq);
+    CurOp::get(execContext->getOpCtx())->cycleSegments().mark(OpSegment::kParse);
     return Status::OK();
 } catch (const DBException& ex) {
     // Need to set request as `makeCommandResponse` expects an empty request on failure.
@@ -1927,6 +1986,7 @@ Future<void> executeCommand(std::shared_ptr<HandleRequest::ExecutionContext> exe
 
 DbResponse makeCommandResponse(std::shared_ptr<HandleRequest::ExecutionContext> execContext) {
     auto opCtx = execContext->getOpCtx();
+    CurOp::get(opCtx)->cycleSegments().mark(OpSegment::kExecute);
     const Message& message = execContext->getMessage();
     OpMsgRequest request = execContext->getRequest();
     const Command* c = execContext->getCommand();
@@ -1959,14 +2019,27 @@ DbResponse makeCommandResponse(std::shared_ptr<HandleRequest::ExecutionContext>
     }
 
     dbResponse.response = replyBuilder->done();
-    CurOp::get(opCtx)->debug().responseLength = dbResponse.response.header().dataLen();
+    auto curOp = CurOp::get(opCtx);
+    curOp->debug().responseLength = dbResponse.response.header().dataLen();
+    curOp->cycleSegments().mark(OpSegment::kResponse);
+    curOp->cycleSegments().flush(c ? StringData(c->getName()) : "<unknown>"_sd);
 
     return dbResponse;
 }
 
 Future<DbResponse> receivedCommands(std::shared_ptr<HandleRequest::ExecutionContext> execContext) {
-    execContext->setReplyBuilder(
-        rpc::makeReplyBuilder(rpc::protocolForMessage(execContext->getMessage())));
+    CurOp::get(execContext->getOpCtx())->cycleSegments().start();
+
+    // Serialize the reply into the buffer recycled from the previous reply on this connection,
+    // if there is one, rather than a fresh allocation.
+    auto reuseBuffer = [&]() -> SharedBuffer {
+        if (const auto& session = execContext->getOpCtx()->getClient()->session()) {
+            return transport::ReplyBufferPool::forSession(session).acquire();
+        }
+        return {};
+    }();
+    execContext->setReplyBuilder(rpc::makeReplyBuilder(
+        rpc::protocolForMessage(execContext->getMessage()), std::move(reuseBuffer)));
     return parseCommand(execContext)
         .then([execContext]() mutable { return executeCommand(std::move(execContext)); })
         .onError([execContext](Status status) {
@@ -51,18 +51,24 @@ const auto operationSessionDecoration =
 
 }  // namespace
 
+constexpr size_t SessionCatalog::kNumPartitions;
+
 SessionCatalog::~SessionCatalog() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    for (const auto& entry : _sessions) {
-        ObservableSession session(lg, entry.second->session);
-        invariant(!session.hasCurrentOperation());
-        invariant(!session._killed());
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lg(partition.mutex);
+        for (const auto& entry : partition.sessions) {
+            ObservableSession session(lg, entry.second->session);
+            invariant(!session.hasCurrentOperation());
+            invariant(!session._killed());
+        }
     }
 }
 
 void SessionCatalog::reset_forTest() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    _sessions.clear();
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lg(partition.mutex);
+        partition.sessions.clear();
+    }
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -84,7 +90,9 @@ SessionCatalog::ScopedCheckedOutSession SessionCatalog::_checkOutSessionWithPare
         invariant(opCtx->getLogicalSessionId() == lsid);
     }
 
-    stdx::unique_lock<Latch> ul(_mutex);
+    // A child session lives in the same partition as its parent, so one partition mutex covers
+    // both runtime infos.
+    stdx::unique_lock<Latch> ul(_partitionFor(lsid).mutex);
 
     auto parentSri = _getOrCreateSessionRuntimeInfo(ul, *getParentSessionId(lsid), nullptr);
     auto childSri = _getOrCreateSessionRuntimeInfo(ul, lsid, parentSri);
@@ -141,7 +149,7 @@ SessionCatalog::ScopedCheckedOutSession SessionCatalog::_checkOutSessionWithoutP
         invariant(opCtx->getLogicalSessionId() == lsid);
     }
 
-    stdx::unique_lock<Latch> ul(_mutex);
+    stdx::unique_lock<Latch> ul(_partitionFor(lsid).mutex);
 
     auto sri = _getOrCreateSessionRuntimeInfo(ul, lsid, nullptr);
     if (killToken) {
@@ -199,16 +207,17 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
     std::unique_ptr<SessionRuntimeInfo> sessionToReap;
 
     {
-        stdx::lock_guard<Latch> lg(_mutex);
-        auto it = _sessions.find(lsid);
-        if (it != _sessions.end()) {
+        auto& partition = _partitionFor(lsid);
+        stdx::lock_guard<Latch> lg(partition.mutex);
+        auto it = partition.sessions.find(lsid);
+        if (it != partition.sessions.end()) {
             auto& sri = it->second;
             ObservableSession osession(lg, sri->session);
             workerFn(osession);
 
             if (osession._shouldBeReaped(sri->numWaitingToCheckOut)) {
                 sessionToReap = std::move(sri);
-                _sessions.erase(it);
+                partition.sessions.erase(it);
             }
         }
     }
@@ -217,17 +226,14 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
 void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                                   const ScanSessionsCallbackFn& workerFn) {
     std::vector<std::unique_ptr<SessionRuntimeInfo>> sessionsToReap;
+    size_t sessionCount = 0;
 
-    {
-        stdx::lock_guard<Latch> lg(_mutex);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lg(partition.mutex);
 
-        LOGV2_DEBUG(21976,
-                    2,
-                    "Scanning {sessionCount} sessions",
-                    "Scanning sessions",
-                    "sessionCount"_attr = _sessions.size());
+        sessionCount += partition.sessions.size();
 
-        for (auto it = _sessions.begin(); it != _sessions.end(); ++it) {
+        for (auto it = partition.sessions.begin(); it != partition.sessions.end(); ++it) {
             if (matcher.match(it->first)) {
                 auto& sri = it->second;
                 ObservableSession osession(lg, sri->session);
@@ -236,15 +242,21 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
 
                 if (osession._shouldBeReaped(sri->numWaitingToCheckOut)) {
                     sessionsToReap.emplace_back(std::move(sri));
-                    _sessions.erase(it++);
+                    partition.sessions.erase(it++);
                 }
             }
         }
     }
+
+    LOGV2_DEBUG(21976,
+                2,
+                "Scanned {sessionCount} sessions",
+                "Scanned sessions",
+                "sessionCount"_attr = sessionCount);
 }
 
 SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& lsid) {
-    stdx::lock_guard<Latch> lg(_mutex);
+    stdx::lock_guard<Latch> lg(_partitionFor(lsid).mutex);
 
     auto sri = _getSessionRuntimeInfo(lg, lsid);
     uassert(ErrorCodes::NoSuchSession, "Session not found", sri);
@@ -252,12 +264,16 @@ SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& ls
 }
 
 size_t SessionCatalog::size() const {
-    stdx::lock_guard<Latch> lg(_mutex);
-    return _sessions.size();
+    size_t size = 0;
+    for (const auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lg(partition.mutex);
+        size += partition.sessions.size();
+    }
+    return size;
 }
 
 void SessionCatalog::createSessionIfDoesNotExist(const LogicalSessionId& lsid) {
-    stdx::lock_guard<Latch> lg(_mutex);
+    stdx::lock_guard<Latch> lg(_partitionFor(lsid).mutex);
     auto parentSri = [&]() -> SessionRuntimeInfo* {
         if (auto parentLsid = getParentSessionId(lsid)) {
             return _getOrCreateSessionRuntimeInfo(lg, *parentLsid, nullptr);
@@ -269,8 +285,9 @@ void SessionCatalog::createSessionIfDoesNotExist(const LogicalSessionId& lsid) {
 
 SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getSessionRuntimeInfo(
     WithLock, const LogicalSessionId& lsid) {
-    auto it = _sessions.find(lsid);
-    if (it == _sessions.end()) {
+    auto& sessions = _partitionFor(lsid).sessions;
+    auto it = sessions.find(lsid);
+    if (it == sessions.end()) {
         return nullptr;
     }
     return it->second.get();
@@ -282,18 +299,21 @@ SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeIn
         return sri;
     }
 
-    auto it = _sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid, parentSri)).first;
+    auto it = _partitionFor(lsid)
+                  .sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid, parentSri))
+                  .first;
     return it->second.get();
 }
 
 void SessionCatalog::_releaseSession(SessionRuntimeInfo* sri,
                                      SessionRuntimeInfo* parentSri,
                                      boost::optional<KillToken> killToken) {
-    stdx::lock_guard<Latch> lg(_mutex);
+    auto& partition = _partitionFor(sri->session.getSessionId());
+    stdx::lock_guard<Latch> lg(partition.mutex);
 
     // Make sure we have exactly the same session on the map and that it is still associated with an
     // operation context (meaning checked-out)
-    invariant(_sessions[sri->session.getSessionId()].get() == sri);
+    invariant(partition.sessions[sri->session.getSessionId()].get() == sri);
     invariant(sri->session._checkoutOpCtx);
     if (killToken) {
         invariant(killToken->lsidToKill == sri->session.getSessionId());
@@ -329,6 +349,12 @@ void SessionCatalog::_releaseSession(SessionRuntimeInfo* sri,
     }
 }
 
+SessionCatalog::SessionPartition& SessionCatalog::_partitionFor(const LogicalSessionId& lsid) {
+    // Partition by the session UUID only: a child session's lsid carries the same UUID as its
+    // parent's, so both always map to the same partition.
+    return _partitions[UUID::Hash{}(lsid.getId()) % kNumPartitions];
+}
+
 SessionCatalog::SessionRuntimeInfo::~SessionRuntimeInfo() {
     invariant(!numWaitingToCheckOut);
 }
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -94,10 +96,10 @@ public:
     SessionToKill checkOutSessionForKill(OperationContext* opCtx, KillToken killToken);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'matcher'.
+     * Iterates through the SessionCatalog, one partition at a time under that partition's mutex,
+     * and applies 'workerFn' to each Session which matches the specified 'matcher'.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
+     * NOTE: Since this method runs with a partition mutex held, the work done by 'workerFn' is
      * not allowed to block, perform I/O or acquire any lock manager locks.
      * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
      * SessionCatalog.
@@ -108,7 +110,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its partition's mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -144,7 +146,7 @@ private:
         // sessions entries from the map.
         int numWaitingToCheckOut{0};
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the owning partition's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
@@ -167,14 +169,15 @@ private:
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Returns the session runtime info for 'lsid' from the '_sessions' map. The returned pointer
-     * is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the session runtime info for 'lsid' from its partition's map. The returned pointer
+     * is guaranteed to be linked on the map for as long as the partition mutex is held.
      */
     SessionRuntimeInfo* _getSessionRuntimeInfo(WithLock lk, const LogicalSessionId& lsid);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The
-     * returned pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Creates or returns the session runtime info for 'lsid' from its partition's map. The
+     * returned pointer is guaranteed to be linked on the map for as long as the partition mutex is
+     * held.
      *
      * If we're creating a child session, a pointer to the session runtime info of its parent must
      * be provided.
@@ -190,12 +193,28 @@ private:
                          SessionRuntimeInfo* parentSri,
                          boost::optional<KillToken> killToken);
 
-    // Protects the state below
-    mutable Mutex _mutex =
-        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(4), "SessionCatalog::_mutex");
+    /**
+     * The runtime info for all current Sessions, split into partitions so that operations on
+     * unrelated sessions do not contend on a single catalog-wide mutex. Each partition's mutex
+     * protects that partition's map and the state of the sessions it owns, and serves as the mutex
+     * for those sessions' 'availableCondVar'.
+     */
+    struct SessionPartition {
+        mutable Mutex mutex =
+            MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(4), "SessionCatalog::_partitionMutex");
+
+        SessionRuntimeInfoMap sessions;
+    };
+    static constexpr size_t kNumPartitions = 16;
+
+    /**
+     * Returns the partition that owns 'lsid'. Sessions are partitioned by their session UUID only,
+     * which a child session shares with its parent, so a child session and its parent always live
+     * in the same partition and can be operated on under a single partition mutex.
+     */
+    SessionPartition& _partitionFor(const LogicalSessionId& lsid);
 
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    std::array<SessionPartition, kNumPartitions> _partitions;
 };
 
 /**
@@ -297,8 +316,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog partition that owns the observed session and, if the observed session is
+ * bound to an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
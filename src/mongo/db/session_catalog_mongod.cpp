@@ -44,14 +44,17 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/storage_interface_impl.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session_txn_record_gen.h"
 #include "mongo/db/sessions_collection.h"
 #include "mongo/db/transaction_participant.h"
+#include "mongo/db/transaction_participant_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/transaction_router.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/scopeguard.h"
 
@@ -271,6 +274,71 @@ void abortInProgressTransactions(OperationContext* opCtx) {
         opCtx->resetMultiDocumentTransactionState();
     }
 }
+
+/**
+ * Reloads the transaction table state of the most recently written-to sessions back into the
+ * SessionCatalog on a background thread, so that the first retryable write or transaction per
+ * session after a failover does not pay for the refresh from disk on the client's critical path.
+ * Must not run on the step-up thread itself: session refreshes read config.transactions under
+ * collection locks, which may not be acquired while the RSTL is still held.
+ */
+void prewarmRecentlyActiveSessions(ServiceContext* service) {
+    const auto limit = gStepUpSessionPrewarmCount.load();
+    if (limit <= 0) {
+        return;
+    }
+
+    stdx::thread([service, limit] {
+        try {
+            ThreadClient tc("prewarmSessions", service);
+
+            std::vector<LogicalSessionId> lsids;
+            {
+                auto opCtx = tc->makeOperationContext();
+                DBDirectClient client(opCtx.get());
+
+                FindCommandRequest findRequest{
+                    NamespaceString::kSessionTransactionsTableNamespace};
+                findRequest.setSort(BSON(SessionTxnRecord::kLastWriteDateFieldName << -1));
+                findRequest.setProjection(BSON(SessionTxnRecord::kSessionIdFieldName << 1));
+                findRequest.setLimit(limit);
+                auto cursor = client.find(std::move(findRequest));
+                while (cursor->more()) {
+                    lsids.push_back(LogicalSessionId::parse(
+                        IDLParserErrorContext("prewarmSessions"),
+                        cursor->next()[SessionTxnRecord::kSessionIdFieldName].Obj()));
+                }
+            }
+
+            size_t numPrewarmed = 0;
+            for (const auto& lsid : lsids) {
+                // Stop early if this node is no longer primary; any session not warmed simply
+                // refreshes on first use as before.
+                if (!repl::ReplicationCoordinator::get(service)->getMemberState().primary()) {
+                    break;
+                }
+
+                auto opCtx = tc->makeOperationContext();
+                opCtx->setLogicalSessionId(lsid);
+                // Checking out the session refreshes the participant from storage if needed.
+                MongoDOperationContextSession ocs(opCtx.get());
+                numPrewarmed++;
+            }
+
+            LOGV2_DEBUG(6650041,
+                        2,
+                        "Finished pre-warming recently active sessions after step-up",
+                        "numPrewarmed"_attr = numPrewarmed,
+                        "limit"_attr = limit);
+        } catch (const DBException& ex) {
+            // Pre-warming is best effort: sessions that were not warmed refresh on first use.
+            LOGV2_DEBUG(6650042,
+                        2,
+                        "Session pre-warming after step-up interrupted",
+                        "error"_attr = redact(ex));
+        }
+    }).detach();
+}
 }  // namespace
 
 void MongoDSessionCatalog::onStepUp(OperationContext* opCtx) {
@@ -349,6 +417,8 @@ void MongoDSessionCatalog::onStepUp(OperationContext* opCtx) {
     if (repl::feature_flags::gFeatureFlagRetryableFindAndModify.isEnabledAndIgnoreFCV()) {
         createRetryableFindAndModifyTable(opCtx);
     }
+
+    prewarmRecentlyActiveSessions(opCtx->getServiceContext());
 }
 
 boost::optional<UUID> MongoDSessionCatalog::getTransactionTableUUID(OperationContext* opCtx) {
@@ -50,6 +50,7 @@
 
 #include <boost/filesystem/operations.hpp>
 #include <snappy.h>
+#include <zstd.h>
 #include <vector>
 
 #include "mongo/base/string_data.h"
@@ -116,6 +117,17 @@ EncryptionHooks* getEncryptionHooksIfEnabled() {
 
 constexpr std::size_t kSortedFileBufferSize = 64 * 1024;
 
+/**
+ * Bit set in the on-disk block size word, alongside the sign bit that marks a compressed block,
+ * when the block was compressed with zstd rather than snappy. Block sizes are bounded by the
+ * spill buffer size plus a single oversized datum, and so never reach this bit.
+ */
+constexpr int32_t kZstdBlockFlag = 1 << 30;
+
+// Cap on the per-run read-ahead buffer handed to each input of a k-way merge. Keeps wide merges
+// from hogging memory when the sorter's memory budget divided by the fan-in is still large.
+constexpr std::size_t kMaxMergeReadAheadBytes = 1024 * 1024;
+
 }  // namespace
 
 namespace sorter {
@@ -275,6 +287,12 @@ public:
         return {_fileStartOffset, _fileEndOffset, _originalChecksum};
     }
 
+    void setReadAheadBufferBytes(std::size_t bytes) override {
+        // The buffer is allocated lazily on the next read from disk, so resizing is cheap until
+        // then. Read-ahead below the block size would only add a copy without saving any reads.
+        _readAheadSize = bytes >= kSortedFileBufferSize ? bytes : 0;
+    }
+
 private:
     /**
      * Attempts to refill the _bufferReader if it is empty. Expects _done to be false.
@@ -300,6 +318,11 @@ private:
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
+        // The flag bit in the size word records which codec compressed the block, so spill data
+        // written before a change of the codec setting remains readable.
+        const bool zstdCompressed = compressed && (blockSize & kZstdBlockFlag);
+        blockSize &= ~kZstdBlockFlag;
+
         _buffer.reset(new char[blockSize]);
         _read(_buffer.get(), blockSize);
         uassert(16816, "file too short?", !_done);
@@ -326,6 +349,27 @@ private:
             return;
         }
 
+        if (zstdCompressed) {
+            const unsigned long long uncompressedSize =
+                ZSTD_getFrameContentSize(_buffer.get(), blockSize);
+            uassert(6929923,
+                    "couldn't get uncompressed length",
+                    uncompressedSize != ZSTD_CONTENTSIZE_UNKNOWN &&
+                        uncompressedSize != ZSTD_CONTENTSIZE_ERROR);
+
+            std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
+            const size_t decompressed = ZSTD_decompress(
+                decompressionBuffer.get(), uncompressedSize, _buffer.get(), blockSize);
+            uassert(6929924,
+                    "decompression failed",
+                    !ZSTD_isError(decompressed) && decompressed == uncompressedSize);
+
+            // hold on to decompressed data and throw out compressed data at block exit
+            _buffer.swap(decompressionBuffer);
+            _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
+            return;
+        }
+
         dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
 
         size_t uncompressedSize;
@@ -345,19 +389,57 @@ private:
 
     /**
      * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     *
+     * When a read-ahead buffer size has been hinted, reads are served from a buffer that is
+     * refilled with one large sequential read per '_readAheadSize' bytes of file data, rather
+     * than one read per block.
      */
     void _read(void* out, size_t size) {
-        if (_fileCurrentOffset == _fileEndOffset) {
-            _done = true;
+        if (_readAheadSize == 0) {
+            if (_fileCurrentOffset == _fileEndOffset) {
+                _done = true;
+                return;
+            }
+
+            invariant(_fileCurrentOffset < _fileEndOffset,
+                      str::stream() << "Current file offset (" << _fileCurrentOffset
+                                    << ") greater than end offset (" << _fileEndOffset << ")");
+
+            _file->read(_fileCurrentOffset, size, out);
+            _fileCurrentOffset += size;
             return;
         }
 
-        invariant(_fileCurrentOffset < _fileEndOffset,
-                  str::stream() << "Current file offset (" << _fileCurrentOffset
-                                << ") greater than end offset (" << _fileEndOffset << ")");
+        char* dest = static_cast<char*>(out);
+        while (size > 0) {
+            if (_readAheadPos == _readAheadValid) {
+                if (_fileCurrentOffset == _fileEndOffset) {
+                    _done = true;
+                    return;
+                }
+
+                invariant(_fileCurrentOffset < _fileEndOffset,
+                          str::stream() << "Current file offset (" << _fileCurrentOffset
+                                        << ") greater than end offset (" << _fileEndOffset << ")");
+
+                if (!_readAheadBuffer || _readAheadCapacity != _readAheadSize) {
+                    _readAheadBuffer.reset(new char[_readAheadSize]);
+                    _readAheadCapacity = _readAheadSize;
+                }
+                const std::size_t toRead = std::min<std::size_t>(
+                    _readAheadSize, static_cast<std::size_t>(_fileEndOffset - _fileCurrentOffset));
+                _file->read(_fileCurrentOffset, toRead, _readAheadBuffer.get());
+                _fileCurrentOffset += toRead;
+                _readAheadValid = toRead;
+                _readAheadPos = 0;
+            }
 
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+            const std::size_t available = std::min(_readAheadValid - _readAheadPos, size);
+            memcpy(dest, _readAheadBuffer.get() + _readAheadPos, available);
+            _readAheadPos += available;
+            dest += available;
+            size -= available;
+        }
     }
 
     const Settings _settings;
@@ -372,6 +454,15 @@ private:
     std::streamoff _fileEndOffset;      // File offset at which the sorted data range ends.
     boost::optional<std::string> _dbName;
 
+    // Read-ahead buffer of raw file data, allocated lazily once a buffer size has been hinted via
+    // setReadAheadBufferBytes(). '_readAheadPos' and '_readAheadValid' delimit the unconsumed
+    // bytes.
+    std::size_t _readAheadSize = 0;
+    std::size_t _readAheadCapacity = 0;
+    std::unique_ptr<char[]> _readAheadBuffer;
+    std::size_t _readAheadValid = 0;
+    std::size_t _readAheadPos = 0;
+
     // Checksum value that is updated with each read of a data object from disk. We can compare
     // this value with _originalChecksum to check for data corruption if and only if the
     // FileIterator is exhausted.
@@ -401,10 +492,21 @@ public:
           _remaining(opts.limit ? opts.limit : std::numeric_limits<unsigned long long>::max()),
           _positioned(false),
           _greater(comp) {
+        // Hand each file-backed run a read-ahead buffer sized by the merge fan-in, so that the
+        // merge phase issues a few large sequential reads per run rather than one small read per
+        // block.
+        if (iters.size() > 1) {
+            _readAheadPerRun = std::min(kMaxMergeReadAheadBytes,
+                                        _opts.maxMemoryUsageBytes / 2 / iters.size());
+            for (auto&& iter : iters) {
+                iter->setReadAheadBufferBytes(_readAheadPerRun);
+            }
+        }
+
         for (size_t i = 0; i < iters.size(); i++) {
             iters[i]->openSource();
             if (iters[i]->more()) {
-                _heap.push_back(std::make_shared<Stream>(i, iters[i]->next(), iters[i]));
+                _streams.push_back(std::make_shared<Stream>(i, iters[i]->next(), iters[i]));
                 if (i > _maxFile) {
                     _maxFile = i;
                 }
@@ -413,45 +515,38 @@ public:
             }
         }
 
-        if (_heap.empty()) {
+        if (_streams.empty()) {
             _remaining = 0;
             return;
         }
 
-        std::make_heap(_heap.begin(), _heap.end(), _greater);
-        std::pop_heap(_heap.begin(), _heap.end(), _greater);
-        _current = _heap.back();
-        _heap.pop_back();
+        _rebuildTree();
 
         _positioned = true;
     }
 
     ~MergeIterator() {
-        _current.reset();
-        _heap.clear();
+        _streams.clear();
+        _tree.clear();
     }
 
     void openSource() {}
     void closeSource() {}
 
     void addSource(std::shared_ptr<Input> iter) {
+        iter->setReadAheadBufferBytes(_readAheadPerRun);
         iter->openSource();
         if (iter->more()) {
-            _heap.push_back(std::make_shared<Stream>(++_maxFile, iter->next(), iter));
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
-
-            if (_greater(_current, _heap.front())) {
-                std::pop_heap(_heap.begin(), _heap.end(), _greater);
-                std::swap(_current, _heap.back());
-                std::push_heap(_heap.begin(), _heap.end(), _greater);
-            }
+            _streams.push_back(std::make_shared<Stream>(++_maxFile, iter->next(), iter));
+            _rebuildTree();
         } else {
             iter->closeSource();
         }
     }
 
     bool more() {
-        if (_remaining > 0 && (_positioned || !_heap.empty() || _current->more()))
+        if (_remaining > 0 &&
+            (_positioned || _streams.size() > 1 || _streams.front()->more()))
             return true;
 
         _remaining = 0;
@@ -466,7 +561,7 @@ public:
             _positioned = true;
         }
 
-        return _current->current();
+        return _streams[_winner]->current();
     }
 
     Data next() {
@@ -476,23 +571,20 @@ public:
 
         if (_positioned) {
             _positioned = false;
-            return _current->current();
+            return _streams[_winner]->current();
         }
 
         advance();
-        return _current->current();
+        return _streams[_winner]->current();
     }
 
     void advance() {
-        if (!_current->advance()) {
-            verify(!_heap.empty());
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            _current = _heap.back();
-            _heap.pop_back();
-        } else if (!_heap.empty() && _greater(_current, _heap.front())) {
-            std::pop_heap(_heap.begin(), _heap.end(), _greater);
-            std::swap(_current, _heap.back());
-            std::push_heap(_heap.begin(), _heap.end(), _greater);
+        if (!_streams[_winner]->advance()) {
+            verify(_streams.size() > 1);
+            _streams.erase(_streams.begin() + _winner);
+            _rebuildTree();
+        } else if (_streams.size() > 1) {
+            _replayGames(_winner);
         }
     }
 
@@ -554,13 +646,70 @@ private:
         const Comparator _comp;
     };
 
+    /**
+     * Rebuilds the tournament tree over all streams. '_tree' holds the loser of the game played
+     * at each internal node; '_winner' is the overall winner, i.e. the stream whose current value
+     * comes next in the merged order. In a tree over k streams, the leaf for stream 's' is node
+     * 's + k' and internal nodes are 1..k-1, so replaying the games on the path from a leaf to
+     * the root costs exactly ceil(log2(k)) comparisons, about half of what pushing through a
+     * binary heap costs.
+     */
+    void _rebuildTree() {
+        const size_t k = _streams.size();
+        _winner = 0;
+        if (k < 2) {
+            _tree.clear();
+            return;
+        }
+        _tree.assign(k, 0);
+        _winner = _buildWinner(1);
+    }
+
+    /**
+     * Recursively plays the games in the subtree rooted at 'node', recording losers in '_tree'
+     * and returning the winning stream.
+     */
+    size_t _buildWinner(size_t node) {
+        if (node >= _streams.size())
+            return node - _streams.size();
+
+        const size_t left = _buildWinner(2 * node);
+        const size_t right = _buildWinner(2 * node + 1);
+        if (_wins(left, right)) {
+            _tree[node] = right;
+            return left;
+        }
+        _tree[node] = left;
+        return right;
+    }
+
+    /**
+     * Replays the games on the path from the leaf of stream 's' to the root after its current
+     * value changed, updating the stored losers and '_winner'.
+     */
+    void _replayGames(size_t s) {
+        for (size_t node = (s + _streams.size()) / 2; node > 0; node /= 2) {
+            if (_wins(_tree[node], s)) {
+                std::swap(s, _tree[node]);
+            }
+        }
+        _winner = s;
+    }
+
+    // Returns true if stream 'a' comes before stream 'b' in the merged order.
+    bool _wins(size_t a, size_t b) const {
+        return !_greater(_streams[a], _streams[b]);
+    }
+
     SortOptions _opts;
     unsigned long long _remaining;
     bool _positioned;
-    std::shared_ptr<Stream> _current;
-    std::vector<std::shared_ptr<Stream>> _heap;  // MinHeap
-    STLComparator _greater;                      // named so calls make sense
-    size_t _maxFile = 0;                         // The maximum file identifier used thus far
+    std::vector<std::shared_ptr<Stream>> _streams;  // Streams that still have data, in any order.
+    std::vector<size_t> _tree;  // Loser tree over '_streams'; empty with fewer than two streams.
+    size_t _winner = 0;         // Index into '_streams' of the overall tournament winner.
+    STLComparator _greater;     // named so calls make sense
+    size_t _maxFile = 0;        // The maximum file identifier used thus far
+    std::size_t _readAheadPerRun = 0;  // Read-ahead hint handed to each source.
 };
 
 template <typename Key, typename Value, typename Comparator>
@@ -724,10 +873,10 @@ public:
         _data.emplace_back(key.getOwned(), val.getOwned());
 
         auto memUsage = key.memUsageForSorter() + val.memUsageForSorter();
-        _memUsed += memUsage;
+        this->_memUsed += memUsage;
         this->_totalDataSizeSorted += memUsage;
 
-        if (_memUsed > this->_opts.maxMemoryUsageBytes)
+        if (this->_memUsed > this->_opts.maxMemoryUsageBytes)
             spill();
     }
 
@@ -735,12 +884,12 @@ public:
         invariant(!_done);
 
         auto memUsage = key.memUsageForSorter() + val.memUsageForSorter();
-        _memUsed += memUsage;
+        this->_memUsed += memUsage;
         this->_totalDataSizeSorted += memUsage;
 
         _data.emplace_back(std::move(key), std::move(val));
 
-        if (_memUsed > this->_opts.maxMemoryUsageBytes)
+        if (this->_memUsed > this->_opts.maxMemoryUsageBytes)
             spill();
     }
 
@@ -805,13 +954,12 @@ private:
 
         this->_iters.push_back(std::shared_ptr<Iterator>(iteratorPtr));
 
-        _memUsed = 0;
+        this->_memUsed = 0;
 
         this->_numSpills++;
     }
 
     bool _done = false;
-    size_t _memUsed = 0;
     std::deque<Data> _data;  // Data that has not been spilled.
 };
 
@@ -875,7 +1023,6 @@ public:
                const Comparator& comp,
                const Settings& settings = Settings())
         : MergeableSorter<Key, Value, Comparator>(opts, comp, settings),
-          _memUsed(0),
           _haveCutoff(false),
           _worstCount(0),
           _medianCount(0) {
@@ -906,13 +1053,13 @@ public:
             _data.emplace_back(contender.first.getOwned(), contender.second.getOwned());
 
             auto memUsage = key.memUsageForSorter() + val.memUsageForSorter();
-            _memUsed += memUsage;
+            this->_memUsed += memUsage;
             this->_totalDataSizeSorted += memUsage;
 
             if (_data.size() == this->_opts.limit)
                 std::make_heap(_data.begin(), _data.end(), less);
 
-            if (_memUsed > this->_opts.maxMemoryUsageBytes)
+            if (this->_memUsed > this->_opts.maxMemoryUsageBytes)
                 spill();
 
             return;
@@ -926,17 +1073,17 @@ public:
         // Remove the old worst pair and insert the contender, adjusting _memUsed
 
         auto memUsage = key.memUsageForSorter() + val.memUsageForSorter();
-        _memUsed += memUsage;
+        this->_memUsed += memUsage;
         this->_totalDataSizeSorted += memUsage;
 
-        _memUsed -= _data.front().first.memUsageForSorter();
-        _memUsed -= _data.front().second.memUsageForSorter();
+        this->_memUsed -= _data.front().first.memUsageForSorter();
+        this->_memUsed -= _data.front().second.memUsageForSorter();
 
         std::pop_heap(_data.begin(), _data.end(), less);
         _data.back() = {contender.first.getOwned(), contender.second.getOwned()};
         std::push_heap(_data.begin(), _data.end(), less);
 
-        if (_memUsed > this->_opts.maxMemoryUsageBytes)
+        if (this->_memUsed > this->_opts.maxMemoryUsageBytes)
             spill();
     }
 
@@ -1092,13 +1239,12 @@ private:
         Iterator* iteratorPtr = writer.done();
         this->_iters.push_back(std::shared_ptr<Iterator>(iteratorPtr));
 
-        _memUsed = 0;
+        this->_memUsed = 0;
 
         this->_numSpills++;
     }
 
     bool _done = false;
-    size_t _memUsed;
 
     // Data that has not been spilled. Organized as max-heap if size == limit.
     std::vector<Data> _data;
@@ -1146,6 +1292,15 @@ typename Sorter<Key, Value>::PersistedState Sorter<Key, Value>::persistDataForSh
 
 template <typename Key, typename Value>
 Sorter<Key, Value>::File::~File() {
+    if (_writerThread.joinable()) {
+        {
+            stdx::lock_guard<Latch> lk(_writeQueueMutex);
+            _writerShutdown = true;
+            _writeQueueStateChange.notify_all();
+        }
+        _writerThread.join();
+    }
+
     if (_keep) {
         return;
     }
@@ -1160,6 +1315,9 @@ Sorter<Key, Value>::File::~File() {
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size, void* out) {
+    // Any writes enqueued for the background writer thread must be on disk before we read.
+    _waitForWritesToFinish();
+
     if (!_file.is_open()) {
         _open();
     }
@@ -1198,9 +1356,25 @@ template <typename Key, typename Value>
 void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
     _ensureOpenForWriting();
 
+    stdx::lock_guard<Latch> lk(_writeQueueMutex);
+    uassertStatusOK(_writerStatus);
+
+    if (!_writerThread.joinable()) {
+        _writerThread = stdx::thread([this] { _writerThreadMain(); });
+    }
+
+    // Hand the buffer to the writer thread and account for it in the logical end-of-file offset
+    // immediately, so that ranges recorded by SortedFileWriter remain correct while writes are
+    // still in flight.
+    _writeQueue.emplace_back(data, data + size);
+    _offset += size;
+    _writeQueueStateChange.notify_all();
+}
+
+template <typename Key, typename Value>
+void Sorter<Key, Value>::File::_write(const char* data, std::streamsize size) {
     try {
         _file.write(data, size);
-        _offset += size;
     } catch (const std::system_error& ex) {
         if (ex.code() == std::errc::no_space_on_device) {
             uasserted(ErrorCodes::OutOfDiskSpace,
@@ -1216,6 +1390,48 @@ void Sorter<Key, Value>::File::write(const char* data, std::streamsize size) {
     }
 }
 
+template <typename Key, typename Value>
+void Sorter<Key, Value>::File::_writerThreadMain() {
+    stdx::unique_lock<Latch> lk(_writeQueueMutex);
+    while (true) {
+        _writeQueueStateChange.wait(lk,
+                                    [&] { return _writerShutdown || !_writeQueue.empty(); });
+        if (_writeQueue.empty()) {
+            return;
+        }
+
+        // Leave the buffer in the queue while it is written out, so that an empty queue means
+        // all writes have reached the file. References into a deque remain valid when new
+        // buffers are appended. Release the lock around the physical write so that the
+        // operation thread can continue to enqueue spilled runs while this one is in flight.
+        const auto& buffer = _writeQueue.front();
+        lk.unlock();
+        try {
+            _write(buffer.data(), buffer.size());
+            lk.lock();
+            _writeQueue.pop_front();
+        } catch (...) {
+            lk.lock();
+            if (_writerStatus.isOK()) {
+                _writerStatus = exceptionToStatus();
+            }
+            // There is no point writing the rest of the queue after a failure.
+            _writeQueue.clear();
+        }
+
+        if (_writeQueue.empty()) {
+            _writeQueueStateChange.notify_all();
+        }
+    }
+}
+
+template <typename Key, typename Value>
+void Sorter<Key, Value>::File::_waitForWritesToFinish() {
+    stdx::unique_lock<Latch> lk(_writeQueueMutex);
+    _writeQueueStateChange.wait(lk, [&] { return _writeQueue.empty(); });
+    uassertStatusOK(_writerStatus);
+}
+
 template <typename Key, typename Value>
 std::streamoff Sorter<Key, Value>::File::currentOffset() {
     _ensureOpenForWriting();
@@ -1303,8 +1519,22 @@ void SortedFileWriter<Key, Value>::spill() {
     if (size == 0)
         return;
 
+    // Documents spilled by one sort tend to share structure, which zstd exploits much better
+    // than snappy. Fall back to snappy if zstd is disabled or reports an error.
     std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
+    bool usedZstd = false;
+    if (internalExternalSortZstdCompression.load()) {
+        compressed.resize(ZSTD_compressBound(size));
+        const size_t compressedSize = ZSTD_compress(
+            compressed.data(), compressed.size(), outBuffer, size, ZSTD_CLEVEL_DEFAULT);
+        if (!ZSTD_isError(compressedSize)) {
+            compressed.resize(compressedSize);
+            usedZstd = true;
+        }
+    }
+    if (!usedZstd) {
+        snappy::Compress(outBuffer, size, &compressed);
+    }
     verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
     const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
@@ -1331,8 +1561,11 @@ void SortedFileWriter<Key, Value>::spill() {
         size = resultLen;
     }
 
-    // Negative size means compressed.
-    size = shouldCompress ? -size : size;
+    // Negative size means compressed; the flag bit records which codec was used.
+    if (shouldCompress) {
+        invariant(size < kZstdBlockFlag);
+        size = -(size | (usedZstd ? kZstdBlockFlag : 0));
+    }
     _file->write(reinterpret_cast<const char*>(&size), sizeof(size));
     _file->write(outBuffer, std::abs(size));
 
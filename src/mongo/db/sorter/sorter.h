@@ -43,6 +43,9 @@
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/sorter/sorter_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 
@@ -219,6 +222,13 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    /**
+     * Hints how many bytes of raw file data this iterator may buffer ahead of its current read
+     * position, if it reads from a file. Merges size this by their fan-in so that the merge phase
+     * issues fewer, larger, sequential reads per run. A no-op for in-memory iterators.
+     */
+    virtual void setReadAheadBufferBytes(std::size_t) {}
+
 protected:
     SortIteratorInterface() {}  // can only be constructed as a base
 };
@@ -286,11 +296,17 @@ public:
 
         /**
          * Writes the given data to the end of the file. Cannot be called after reading.
+         *
+         * The data is enqueued for a background writer thread and written out asynchronously, so
+         * that spilling overlaps with continued sorting on the operation thread. Write errors are
+         * reported by the next call to write(), read() or currentOffset().
          */
         void write(const char* data, std::streamsize size);
 
         /**
-         * Returns the current offset of the end of the file. Cannot be called after reading.
+         * Returns the current offset of the end of the file, including any data that has been
+         * enqueued but not yet written out by the background writer thread. Cannot be called after
+         * reading.
          */
         std::streamoff currentOffset();
 
@@ -302,15 +318,55 @@ public:
          */
         void _ensureOpenForWriting();
 
+        /**
+         * Writes the given data to the file. Only called from the background writer thread.
+         */
+        void _write(const char* data, std::streamsize size);
+
+        /**
+         * Body of the background writer thread. Writes out enqueued buffers in FIFO order until
+         * shut down. On a write error, records the error and discards all remaining queued
+         * writes.
+         */
+        void _writerThreadMain();
+
+        /**
+         * Blocks until the background writer thread has drained the write queue, then surfaces
+         * any write error it encountered.
+         */
+        void _waitForWritesToFinish();
+
         boost::filesystem::path _path;
         std::fstream _file;
 
         // The current offset of the end of the file if there may be unflushed data, or -1 if the
-        // file either has not yet been opened or has been flushed.
+        // file either has not yet been opened or has been flushed. Includes data that is still in
+        // '_writeQueue'.
         std::streamoff _offset = -1;
 
         // Whether to keep the on-disk file even after this in-memory object has been destructed.
         bool _keep = false;
+
+        // Guards the members below. The background writer thread releases it around each physical
+        // write so that the operation thread can continue to enqueue buffers.
+        Mutex _writeQueueMutex = MONGO_MAKE_LATCH("Sorter::File::_writeQueueMutex");
+
+        // Notified when buffers are enqueued, when the queue is drained, and on shutdown.
+        stdx::condition_variable _writeQueueStateChange;
+
+        // Buffers that have been passed to write() but not yet written out by the writer thread,
+        // in FIFO order.
+        std::deque<std::string> _writeQueue;
+
+        // The first error encountered by the writer thread, reported on the next write() or
+        // read().
+        Status _writerStatus = Status::OK();
+
+        // Set by the destructor to tell the writer thread to exit once the queue is drained.
+        bool _writerShutdown = false;
+
+        // Started lazily on the first write(). Joined by the destructor.
+        stdx::thread _writerThread;
     };
 
     explicit Sorter(const SortOptions& opts);
@@ -355,6 +411,10 @@ public:
         return _totalDataSizeSorted;
     }
 
+    size_t memUsed() const {
+        return _memUsed;
+    }
+
     PersistedState persistDataForShutdown();
 
 protected:
@@ -364,6 +424,7 @@ protected:
 
     size_t _numSorted = 0;              // Keeps track of the number of keys sorted.
     uint64_t _totalDataSizeSorted = 0;  // Keeps track of the total size of data sorted.
+    size_t _memUsed = 0;                // Keeps track of the memory used by unspilled data.
 
     SortOptions _opts;
 
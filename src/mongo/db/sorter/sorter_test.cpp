@@ -353,6 +353,20 @@ public:
             ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter.done()),
                                         std::make_shared<IntIterator>(0, 10 * 1000 * 1000));
         }
+        {  // blocks compressed with different codecs in one file
+            SortedFileWriter<IntWrapper, IntWrapper> sorter(opts, makeFile());
+            for (int i = 0; i < 20 * 1000; i++)
+                sorter.addAlreadySorted(i, -i);
+            internalExternalSortZstdCompression.store(false);
+            for (int i = 20 * 1000; i < 40 * 1000; i++)
+                sorter.addAlreadySorted(i, -i);
+            internalExternalSortZstdCompression.store(true);
+            for (int i = 40 * 1000; i < 60 * 1000; i++)
+                sorter.addAlreadySorted(i, -i);
+
+            ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter.done()),
+                                        std::make_shared<IntIterator>(0, 60 * 1000));
+        }
 
         ASSERT(boost::filesystem::is_empty(tempDir.path()));
     }
@@ -551,6 +551,11 @@ void startupRecoveryReadOnly(OperationContext* opCtx, StorageEngine* storageEngi
 
     FeatureCompatibilityVersion::initializeForStartup(opCtx);
 
+    // Use the BatchedCollectionCatalogWriter so opening the databases initializes all Collections
+    // with a single copy-on-write of the catalog, instead of copying the catalog once per
+    // collection. See the corresponding comment in startupRepair().
+    BatchedCollectionCatalogWriter catalog(opCtx);
+
     openDatabases(opCtx, storageEngine, [&](auto db) {
         // Ensures all collections meet requirements such as having _id indexes.
         uassertStatusOK(ensureCollectionProperties(opCtx, db, EnsureIndexPolicy::kError));
@@ -583,6 +588,12 @@ void startupRecovery(OperationContext* opCtx,
     const bool shouldClearNonLocalTmpCollections =
         !(hasReplSetConfigDoc(opCtx) || usingReplication);
 
+    // Use the BatchedCollectionCatalogWriter so opening the databases initializes all Collections
+    // with a single copy-on-write of the catalog, instead of copying the catalog once per
+    // collection. This is what dominates startup time on nodes with a very large number of
+    // collections. See the corresponding comment in startupRepair().
+    BatchedCollectionCatalogWriter catalog(opCtx);
+
     openDatabases(opCtx, storageEngine, [&](auto db) {
         auto dbName = db->name().dbName();
 
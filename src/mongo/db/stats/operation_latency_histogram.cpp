@@ -153,6 +153,21 @@ void OperationLatencyHistogram::append(bool includeHistograms,
     _append(_transactions, "transactions", includeHistograms, slowMSBucketsOnly, builder);
 }
 
+void OperationLatencyHistogram::merge(const OperationLatencyHistogram& other) {
+    auto mergeData = [](const HistogramData& from, HistogramData* into) {
+        for (int i = 0; i < kMaxBuckets; i++) {
+            into->buckets[i] += from.buckets[i];
+        }
+        into->entryCount += from.entryCount;
+        into->sum += from.sum;
+    };
+
+    mergeData(other._reads, &_reads);
+    mergeData(other._writes, &_writes);
+    mergeData(other._commands, &_commands);
+    mergeData(other._transactions, &_transactions);
+}
+
 // Computes the log base 2 of value, and checks for cases of split buckets.
 int OperationLatencyHistogram::_getBucket(uint64_t value) {
     // Zero is a special case since log(0) is undefined.
@@ -59,7 +59,14 @@ public:
      */
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
+    /**
+     * Adds the counts of 'other' into this histogram.
+     */
+    void merge(const OperationLatencyHistogram& other);
+
 private:
+    friend class ShardedOperationLatencyHistogram;
+
     struct HistogramData {
         std::array<uint64_t, kMaxBuckets> buckets{};
         uint64_t entryCount = 0;
@@ -0,0 +1,101 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/sharded_operation_latency_histogram.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+
+namespace mongo {
+
+ShardedOperationLatencyHistogram::Shard& ShardedOperationLatencyHistogram::_currentShard() {
+    // Threads are spread over the shards round-robin the first time they record a latency. The
+    // assignment is per-thread rather than per-histogram so a thread uses the same shard index in
+    // every ShardedOperationLatencyHistogram it touches.
+    static AtomicWord<size_t> nextShard{0};
+    static thread_local const size_t shard = nextShard.fetchAndAdd(1) % kNumShards;
+    return *_shards[shard];
+}
+
+void ShardedOperationLatencyHistogram::_incrementData(uint64_t latency,
+                                                      int bucket,
+                                                      HistogramShardData* data) {
+    data->buckets[bucket].fetchAndAddRelaxed(1);
+    data->entryCount.fetchAndAddRelaxed(1);
+    data->sum.fetchAndAddRelaxed(latency);
+}
+
+void ShardedOperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteType type) {
+    int bucket = OperationLatencyHistogram::_getBucket(latency);
+    auto& shard = _currentShard();
+    switch (type) {
+        case Command::ReadWriteType::kRead:
+            _incrementData(latency, bucket, &shard.reads);
+            break;
+        case Command::ReadWriteType::kWrite:
+            _incrementData(latency, bucket, &shard.writes);
+            break;
+        case Command::ReadWriteType::kCommand:
+            _incrementData(latency, bucket, &shard.commands);
+            break;
+        case Command::ReadWriteType::kTransaction:
+            _incrementData(latency, bucket, &shard.transactions);
+            break;
+        default:
+            MONGO_UNREACHABLE;
+    }
+}
+
+void ShardedOperationLatencyHistogram::append(bool includeHistograms,
+                                              bool slowMSBucketsOnly,
+                                              BSONObjBuilder* builder) const {
+    // Aggregate the shards into a plain histogram, then reuse its serialization.
+    OperationLatencyHistogram total;
+
+    auto addData = [](const HistogramShardData& shardData,
+                      OperationLatencyHistogram::HistogramData* data) {
+        for (int i = 0; i < OperationLatencyHistogram::kMaxBuckets; i++) {
+            data->buckets[i] += shardData.buckets[i].loadRelaxed();
+        }
+        data->entryCount += shardData.entryCount.loadRelaxed();
+        data->sum += shardData.sum.loadRelaxed();
+    };
+
+    for (auto& shard : _shards) {
+        addData(shard->reads, &total._reads);
+        addData(shard->writes, &total._writes);
+        addData(shard->commands, &total._commands);
+        addData(shard->transactions, &total._transactions);
+    }
+
+    total.append(includeHistograms, slowMSBucketsOnly, builder);
+}
+
+}  // namespace mongo
@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+#pragma once
+
+#include <array>
+
+#include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * Thread-safe collector of operation latencies, designed for write-heavy workloads.
+ *
+ * Recording a latency is a few relaxed atomic adds on counters that are sharded so that threads
+ * running on different cores do not contend on a mutex or bounce the same cache lines. The shards
+ * are only aggregated into a single OperationLatencyHistogram when the statistics are read, which
+ * is rare (serverStatus) relative to how often they are written (every operation).
+ *
+ * Relaxed increments mean a reader may observe a shard mid-update, so 'entryCount' and 'sum' can
+ * be momentarily inconsistent with the buckets; totals are eventually exact once writers quiesce.
+ */
+class ShardedOperationLatencyHistogram {
+public:
+    /**
+     * Increments the bucket of the histogram based on the operation type.
+     */
+    void increment(uint64_t latency, Command::ReadWriteType type);
+
+    /**
+     * Aggregates the shards and appends the four histograms with latency totals and operation
+     * counts.
+     */
+    void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
+
+private:
+    struct HistogramShardData {
+        std::array<AtomicWord<uint64_t>, OperationLatencyHistogram::kMaxBuckets> buckets{};
+        AtomicWord<uint64_t> entryCount{0};
+        AtomicWord<uint64_t> sum{0};
+    };
+
+    struct Shard {
+        HistogramShardData reads, writes, commands, transactions;
+    };
+
+    // The number of shards trades memory for contention: with more shards, fewer threads share a
+    // shard. Threads are assigned round-robin, so this many concurrent writers can record
+    // latencies without touching the same cache lines.
+    static constexpr size_t kNumShards = 16;
+
+    /**
+     * Returns the shard the calling thread records into.
+     */
+    Shard& _currentShard();
+
+    void _incrementData(uint64_t latency, int bucket, HistogramShardData* data);
+
+    std::array<CacheAligned<Shard>, kNumShards> _shards;
+};
+}  // namespace mongo
@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/sharded_operation_latency_histogram.h"
+
+#include <vector>
+
+#include "mongo/db/commands.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+
+namespace {
+const int kMaxBuckets = OperationLatencyHistogram::kMaxBuckets;
+}  // namespace
+
+TEST(ShardedOperationLatencyHistogram, EnsureIncrementsStored) {
+    ShardedOperationLatencyHistogram hist;
+    for (int i = 0; i < kMaxBuckets; i++) {
+        hist.increment(i, Command::ReadWriteType::kRead);
+        hist.increment(i, Command::ReadWriteType::kWrite);
+        hist.increment(i, Command::ReadWriteType::kCommand);
+        hist.increment(i, Command::ReadWriteType::kTransaction);
+    }
+    BSONObjBuilder outBuilder;
+    hist.append(false, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), kMaxBuckets);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), kMaxBuckets);
+    ASSERT_EQUALS(out["commands"]["ops"].Long(), kMaxBuckets);
+    ASSERT_EQUALS(out["transactions"]["ops"].Long(), kMaxBuckets);
+}
+
+TEST(ShardedOperationLatencyHistogram, ConcurrentIncrementsAggregate) {
+    ShardedOperationLatencyHistogram hist;
+
+    constexpr int kThreads = 8;
+    constexpr int kIncrementsPerThread = 1000;
+    constexpr uint64_t kLatency = 10;
+
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIncrementsPerThread; i++) {
+                hist.increment(kLatency, Command::ReadWriteType::kRead);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BSONObjBuilder outBuilder;
+    hist.append(false, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), kThreads * kIncrementsPerThread);
+    ASSERT_EQUALS(out["reads"]["latency"].Long(),
+                  static_cast<long long>(kThreads * kIncrementsPerThread * kLatency));
+}
+
+TEST(ShardedOperationLatencyHistogram, MergePlainHistograms) {
+    OperationLatencyHistogram histA, histB;
+    histA.increment(10, Command::ReadWriteType::kRead);
+    histA.increment(20, Command::ReadWriteType::kWrite);
+    histB.increment(30, Command::ReadWriteType::kRead);
+
+    histA.merge(histB);
+
+    BSONObjBuilder outBuilder;
+    histA.append(false, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2);
+    ASSERT_EQUALS(out["reads"]["latency"].Long(), 40);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), 1);
+    ASSERT_EQUALS(out["writes"]["latency"].Long(), 20);
+}
+
+}  // namespace mongo
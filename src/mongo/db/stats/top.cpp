@@ -71,6 +71,36 @@ Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
+void Top::CollectionData::add(const Top::CollectionData& other) {
+    total.add(other.total);
+    readLock.add(other.readLock);
+    writeLock.add(other.writeLock);
+    queries.add(other.queries);
+    getmore.add(other.getmore);
+    insert.add(other.insert);
+    update.add(other.update);
+    remove.add(other.remove);
+    commands.add(other.commands);
+    opLatencyHistogram.merge(other.opLatencyHistogram);
+}
+
+Top::UsagePartition& Top::_currentPartition() {
+    // Threads are spread over the partitions round-robin the first time they record an operation,
+    // so a recording thread almost always takes an uncontended mutex.
+    static AtomicWord<size_t> nextPartition{0};
+    static thread_local const size_t partition = nextPartition.fetchAndAdd(1) % kNumUsagePartitions;
+    return *_partitions[partition];
+}
+
+void Top::_mergeUsage(UsageMap& out) const {
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<SimpleMutex> lk(partition->lock);
+        for (auto&& [ns, coll] : partition->usage) {
+            out[ns].add(coll);
+        }
+    }
+}
+
 void Top::record(OperationContext* opCtx,
                  StringData ns,
                  LogicalOp logicalOp,
@@ -82,9 +112,10 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& partition = _currentPartition();
+    stdx::lock_guard<SimpleMutex> lk(partition.lock);
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = partition.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -107,7 +138,9 @@ void Top::_record(OperationContext* opCtx,
                   long long micros,
                   Command::ReadWriteType readWriteType) {
 
-    _incrementHistogram(opCtx, micros, &c.opLatencyHistogram, readWriteType);
+    if (_shouldRecordHistogram(opCtx)) {
+        c.opLatencyHistogram.increment(micros, readWriteType);
+    }
 
     c.total.inc(micros);
 
@@ -146,18 +179,21 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(nss.ns());
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<SimpleMutex> lk(partition->lock);
+        partition->usage.erase(nss.ns());
+    }
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    _mergeUsage(out);
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap merged;
+    _mergeUsage(merged);
+    _appendToUsageMap(b, merged);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -202,9 +238,19 @@ void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
     auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+
+    // Merge the histograms the partitions have recorded for this namespace.
+    OperationLatencyHistogram merged;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<SimpleMutex> lk(partition->lock);
+        auto it = partition->usage.find(hashedNs);
+        if (it != partition->usage.end()) {
+            merged.merge(it->second.opLatencyHistogram);
+        }
+    }
+
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    merged.append(includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nss.ns());
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -215,30 +261,24 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    if (_shouldRecordHistogram(opCtx)) {
+        _globalHistogramStats.increment(latency, readWriteType);
+    }
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
     _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
     _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
-void Top::_incrementHistogram(OperationContext* opCtx,
-                              long long latency,
-                              OperationLatencyHistogram* histogram,
-                              Command::ReadWriteType readWriteType) {
-    // Only update histogram if operation came from a user.
+bool Top::_shouldRecordHistogram(OperationContext* opCtx) const {
+    // Only update histograms if the operation came from a user.
     Client* client = opCtx->getClient();
-    if (client->isFromUserConnection() && !client->isInDirectClient()) {
-        histogram->increment(latency, readWriteType);
-    }
+    return client->isFromUserConnection() && !client->isInDirectClient();
 }
 }  // namespace mongo
@@ -38,6 +38,8 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/db/stats/sharded_operation_latency_histogram.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/string_map.h"
 
@@ -64,6 +66,11 @@ public:
             count++;
             time += micros;
         }
+
+        void add(const UsageData& other) {
+            time += other.time;
+            count += other.count;
+        }
     };
 
     struct CollectionData {
@@ -73,6 +80,11 @@ public:
         CollectionData() {}
         CollectionData(const CollectionData& older, const CollectionData& newer);
 
+        /**
+         * Adds the counts of 'other' into this entry.
+         */
+        void add(const CollectionData& other);
+
         UsageData total;
 
         UsageData readLock;
@@ -148,6 +160,30 @@ public:
                                   BSONObjBuilder* builder);
 
 private:
+    /**
+     * The usage map is partitioned so that threads recording operations against different
+     * collections (or even the same collection, from different partitions) do not serialize on a
+     * single mutex. Each thread records into one partition; readers merge all partitions.
+     */
+    struct UsagePartition {
+        mutable SimpleMutex lock;
+        UsageMap usage;
+    };
+
+    // Trades memory for contention: this many concurrent writers can record operations without
+    // sharing a partition mutex.
+    static constexpr size_t kNumUsagePartitions = 16;
+
+    /**
+     * Returns the partition the calling thread records into.
+     */
+    UsagePartition& _currentPartition();
+
+    /**
+     * Merges all partitions' entries into 'out'.
+     */
+    void _mergeUsage(UsageMap& out) const;
+
     void _appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const;
 
     void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
@@ -159,14 +195,12 @@ private:
                  long long micros,
                  Command::ReadWriteType readWriteType);
 
-    void _incrementHistogram(OperationContext* opCtx,
-                             long long latency,
-                             OperationLatencyHistogram* histogram,
-                             Command::ReadWriteType readWriteType);
+    bool _shouldRecordHistogram(OperationContext* opCtx) const;
+
+    std::array<CacheAligned<UsagePartition>, kNumUsagePartitions> _partitions;
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    // Recording into the global histogram is lock-free; it happens on every user operation.
+    ShardedOperationLatencyHistogram _globalHistogramStats;
 };
 
 }  // namespace mongo
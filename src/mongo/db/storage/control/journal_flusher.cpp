@@ -31,16 +31,20 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/db/storage/control/journal_flusher.h"
 
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/future.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -111,8 +115,16 @@ void JournalFlusher::run() {
                 _uniqueCtx->get()->setShouldParticipateInFlowControl(false);
             });
 
+            Timer flushTimer;
             _uniqueCtx->get()->recoveryUnit()->waitUntilDurable(_uniqueCtx->get());
 
+            // Smooth the observed flush latency; it determines how long the next explicitly
+            // requested round may linger to coalesce concurrent committers. Only this thread
+            // accesses the value.
+            _smoothedFlushLatencyMicros = (1 - kFlushLatencySmoothingFactor) *
+                    _smoothedFlushLatencyMicros +
+                kFlushLatencySmoothingFactor * flushTimer.micros();
+
             // Signal the waiters that a round completed.
             _currentSharedPromise->emplaceValue();
         } catch (const AssertionException& e) {
@@ -171,6 +183,24 @@ void JournalFlusher::run() {
             _stateChangeCV.notify_all();
         }
 
+        // If we were woken by an explicit flush request, linger briefly so that concurrent
+        // committers join this round rather than each triggering a near-empty flush of its own.
+        // The window is bounded by a fraction of the observed flush latency, so the added wait
+        // stays small relative to the sync it amortizes.
+        if (_flushJournalNow && !_shuttingDown && !_needToPause) {
+            auto coalescingWindow =
+                Microseconds(gJournalFlushMaxCoalescingWindowMicros.load());
+            coalescingWindow = std::min(
+                coalescingWindow,
+                Microseconds(static_cast<int64_t>(_smoothedFlushLatencyMicros / 2)));
+            if (coalescingWindow > Microseconds(0)) {
+                _flushJournalNowCV.wait_until(
+                    lk,
+                    (Date_t::now() + coalescingWindow).toSystemTimePoint(),
+                    [&] { return _needToPause || _shuttingDown; });
+            }
+        }
+
         _flushJournalNow = false;
 
         if (_shuttingDown) {
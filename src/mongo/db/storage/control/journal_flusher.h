@@ -170,6 +170,12 @@ private:
     std::unique_ptr<SharedPromise<void>> _nextSharedPromise =
         std::make_unique<SharedPromise<void>>();
 
+    // Exponentially smoothed duration of recent flush rounds, in microseconds. Used to bound how
+    // long an explicitly requested round may linger to coalesce concurrent committers. Only
+    // accessed by the flusher thread.
+    static constexpr double kFlushLatencySmoothingFactor = 0.2;
+    double _smoothedFlushLatencyMicros = 0.0;
+
     // Controls whether to ignore the 'storageGlobalParams.journalCommitIntervalMs' setting. If set,
     // data flushes will only be executed upon explicit request, no longer periodically in addition
     // to upon request.
@@ -146,6 +146,14 @@ public:
         return Status::OK();
     }
 
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) override {
+        return Status::OK();
+    }
+
     void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) override {}
 
     virtual void appendNumericCustomStats(OperationContext* opCtx,
@@ -486,6 +486,28 @@ Status EphemeralForTestRecordStore::doTruncate(OperationContext* opCtx) {
     return Status::OK();
 }
 
+Status EphemeralForTestRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                                    const RecordId& minRecordId,
+                                                    const RecordId& maxRecordId,
+                                                    int64_t hintDataSizeDiff,
+                                                    int64_t hintNumRecordsDiff) {
+    // Every removed record is visited here, so the exact sizes are maintained and the caller's
+    // hints are ignored.
+    stdx::lock_guard<stdx::recursive_mutex> lock(_data->recordsMutex);
+    Records::iterator it = minRecordId == RecordId() ? _data->records.begin()
+                                                     : _data->records.lower_bound(minRecordId);
+    while (it != _data->records.end() && (maxRecordId == RecordId() || it->first <= maxRecordId)) {
+        RecordId id = it->first;
+        EphemeralForTestRecord record = it->second;
+
+        opCtx->recoveryUnit()->registerChange(
+            std::make_unique<RemoveChange>(opCtx, _data, id, record));
+        _data->dataSize -= record.size;
+        _data->records.erase(it++);
+    }
+    return Status::OK();
+}
+
 void EphemeralForTestRecordStore::doCappedTruncateAfter(OperationContext* opCtx,
                                                         RecordId end,
                                                         bool inclusive) {
@@ -89,6 +89,11 @@ public:
                                                     bool forward) const final;
 
     Status doTruncate(OperationContext* opCtx) override;
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) override;
 
     void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) override;
 
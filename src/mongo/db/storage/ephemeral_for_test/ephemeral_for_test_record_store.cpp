@@ -257,6 +257,37 @@ StatusWith<int64_t> RecordStore::truncateWithoutUpdatingCount(mongo::RecoveryUni
     return static_cast<int64_t>(toDelete.size());
 }
 
+Status RecordStore::doRangeTruncate(OperationContext* opCtx,
+                                    const RecordId& minRecordId,
+                                    const RecordId& maxRecordId,
+                                    int64_t hintDataSizeDiff,
+                                    int64_t hintNumRecordsDiff) {
+    // This storage engine visits every record it removes, so the SizeAdjuster keeps the counts
+    // exact and the caller's hints are ignored.
+    auto ru = RecoveryUnit::get(opCtx);
+    StringStore* workingCopy(ru->getHead());
+    auto recordIt = minRecordId == RecordId()
+        ? workingCopy->lower_bound(_prefix)
+        : workingCopy->lower_bound(createKey(_ident, minRecordId));
+    auto endIt = maxRecordId == RecordId()
+        ? workingCopy->upper_bound(_postfix)
+        : workingCopy->upper_bound(createKey(_ident, maxRecordId));
+
+    while (recordIt != endIt) {
+        SizeAdjuster adjuster(opCtx, this);
+
+        // Don't need to increment the iterator because the iterator gets revalidated and placed on
+        // the next item after the erase.
+        workingCopy->erase(recordIt->first);
+
+        // Tree modifications are bound to happen here so we need to reposition our end cursor.
+        endIt.repositionIfChanged();
+        ru->makeDirty();
+    }
+
+    return Status::OK();
+}
+
 void RecordStore::doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) {
     auto ru = RecoveryUnit::get(opCtx);
     StringStore* workingCopy(ru->getHead());
@@ -94,6 +94,11 @@ public:
                                                     bool forward) const final;
 
     Status doTruncate(OperationContext* opCtx) final;
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) final;
     StatusWith<int64_t> truncateWithoutUpdatingCount(RecoveryUnit* ru);
 
     void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) final;
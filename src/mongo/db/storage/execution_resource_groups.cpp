@@ -0,0 +1,180 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/storage/execution_resource_groups.h"
+
+#include <fmt/format.h>
+
+#include "mongo/base/parse_number.h"
+#include "mongo/base/status_with.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/rpc/metadata/client_metadata.h"
+
+namespace mongo {
+namespace {
+
+struct GroupSpec {
+    std::string name;
+    int concurrency;
+};
+
+StatusWith<std::vector<GroupSpec>> parseGroupSpecs(const std::vector<std::string>& specs) {
+    std::vector<GroupSpec> parsed;
+    parsed.reserve(specs.size());
+
+    for (const auto& spec : specs) {
+        const auto sep = spec.find('=');
+        if (sep == std::string::npos || sep == 0) {
+            return Status(ErrorCodes::BadValue,
+                          fmt::format("Resource group '{}' is not of the form "
+                                      "'<name>=<maxConcurrentTickets>'",
+                                      spec));
+        }
+
+        GroupSpec group;
+        group.name = spec.substr(0, sep);
+        if (auto status = NumberParser{}(spec.substr(sep + 1), &group.concurrency);
+            !status.isOK()) {
+            return status.withContext(
+                fmt::format("Invalid ticket limit for resource group '{}'", group.name));
+        }
+        if (group.concurrency < 1) {
+            return Status(ErrorCodes::BadValue,
+                          fmt::format("Resource group '{}' must allow at least one "
+                                      "concurrent ticket",
+                                      group.name));
+        }
+        for (const auto& other : parsed) {
+            if (other.name == group.name) {
+                return Status(ErrorCodes::BadValue,
+                              fmt::format("Resource group '{}' is defined twice", group.name));
+            }
+        }
+        parsed.push_back(std::move(group));
+    }
+
+    return parsed;
+}
+
+class ResourceGroupsServerStatusSection : public ServerStatusSection {
+public:
+    ResourceGroupsServerStatusSection() : ServerStatusSection("resourceGroups") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement&) const override {
+        BSONObjBuilder bob;
+        ExecutionResourceGroups::get().appendStats(bob);
+        return bob.obj();
+    }
+} resourceGroupsServerStatusSection;
+
+}  // namespace
+
+ExecutionResourceGroups& ExecutionResourceGroups::get() {
+    static ExecutionResourceGroups gResourceGroups;
+    return gResourceGroups;
+}
+
+std::shared_ptr<ExecutionResourceGroup> ExecutionResourceGroups::lookupForClient(Client* client) {
+    if (_numGroups.loadRelaxed() == 0 || !client) {
+        return nullptr;
+    }
+
+    const auto* metadata = ClientMetadata::getForClient(client);
+    if (!metadata) {
+        return nullptr;
+    }
+
+    auto appName = metadata->getApplicationName();
+    if (appName.empty()) {
+        return nullptr;
+    }
+
+    return lookup(appName);
+}
+
+std::shared_ptr<ExecutionResourceGroup> ExecutionResourceGroups::lookup(StringData name) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _groups.find(name);
+    return it == _groups.end() ? nullptr : it->second;
+}
+
+void ExecutionResourceGroups::appendStats(BSONObjBuilder& builder) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    for (auto&& [name, group] : _groups) {
+        auto* tickets = group->ticketHolder();
+        BSONObjBuilder sub(builder.subobjStart(name));
+        sub.append("out", tickets->used());
+        sub.append("available", tickets->available());
+        sub.append("totalTickets", tickets->outof());
+    }
+}
+
+Status ExecutionResourceGroups::validate(const std::vector<std::string> specs) {
+    return parseGroupSpecs(specs).getStatus();
+}
+
+Status ExecutionResourceGroups::update(const std::vector<std::string>& specs) {
+    auto swParsed = parseGroupSpecs(specs);
+    if (!swParsed.isOK()) {
+        return swParsed.getStatus();
+    }
+
+    auto& registry = get();
+    stdx::lock_guard<Latch> lk(registry._mutex);
+
+    StringMap<std::shared_ptr<ExecutionResourceGroup>> groups;
+    for (auto&& spec : swParsed.getValue()) {
+        auto it = registry._groups.find(spec.name);
+        if (it != registry._groups.end()) {
+            // Keep the existing holder so tickets already handed out stay accounted against it.
+            if (auto status = it->second->ticketHolder()->resize(spec.concurrency);
+                !status.isOK()) {
+                return status;
+            }
+            groups[spec.name] = it->second;
+        } else {
+            groups[spec.name] =
+                std::make_shared<ExecutionResourceGroup>(spec.name, spec.concurrency);
+        }
+    }
+
+    // Groups dropped from the parameter disappear from the registry here, but operations still
+    // waiting on or holding one of their tickets keep the group alive through their own
+    // shared_ptr until the tickets are returned.
+    registry._groups = std::move(groups);
+    registry._numGroups.store(static_cast<int>(registry._groups.size()));
+    return Status::OK();
+}
+
+}  // namespace mongo
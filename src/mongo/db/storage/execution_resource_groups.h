@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class Client;
+
+/**
+ * A named admission group with its own cap on concurrently held execution tickets. Operations in
+ * a group queue against the group's ticket holder before competing for the global read/write
+ * tickets, so one group saturating its cap cannot consume the global ticket pool.
+ */
+class ExecutionResourceGroup {
+public:
+    ExecutionResourceGroup(std::string name, int concurrency)
+        : _name(std::move(name)), _tickets(concurrency) {}
+
+    const std::string& name() const {
+        return _name;
+    }
+
+    TicketHolder* ticketHolder() {
+        return &_tickets;
+    }
+
+private:
+    const std::string _name;
+    SemaphoreTicketHolder _tickets;
+};
+
+/**
+ * Process-wide registry of execution resource groups, configured through the
+ * 'executionResourceGroups' server parameter. Each entry has the form
+ * '<name>=<maxConcurrentTickets>'. An operation is assigned to a group by the application name
+ * its driver reported in the connection handshake, so a tenant opts in by setting 'appName' in
+ * its connection string to the group name.
+ */
+class ExecutionResourceGroups {
+public:
+    static ExecutionResourceGroups& get();
+
+    /**
+     * Returns the group whose name matches the application name of 'client', or nullptr if there
+     * is none. Cheap when no groups are configured.
+     */
+    std::shared_ptr<ExecutionResourceGroup> lookupForClient(Client* client);
+
+    /**
+     * Returns the group named 'name', or nullptr if there is none.
+     */
+    std::shared_ptr<ExecutionResourceGroup> lookup(StringData name);
+
+    /**
+     * Appends a subdocument of ticket statistics per group.
+     */
+    void appendStats(BSONObjBuilder& builder) const;
+
+    /**
+     * Validator and on_update hook for the 'executionResourceGroups' server parameter. Groups
+     * that persist across an update are resized in place so that tickets already handed out
+     * remain accounted against them.
+     */
+    static Status validate(const std::vector<std::string> specs);
+    static Status update(const std::vector<std::string>& specs);
+
+private:
+    // Tracks _groups.size() so that lookupForClient() can bail out without taking the mutex when
+    // no groups are configured.
+    AtomicWord<int> _numGroups{0};
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ExecutionResourceGroups::_mutex");
+    StringMap<std::shared_ptr<ExecutionResourceGroup>> _groups;
+};
+
+}  // namespace mongo
@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/storage/execution_resource_groups.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(ExecutionResourceGroupsTest, ValidateRejectsMalformedSpecs) {
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"analytics"}));
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"=8"}));
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"analytics=notANumber"}));
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"analytics=0"}));
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"analytics=-1"}));
+    ASSERT_NOT_OK(ExecutionResourceGroups::validate({"analytics=8", "analytics=16"}));
+    ASSERT_OK(ExecutionResourceGroups::validate({"analytics=8", "payments=128"}));
+    ASSERT_OK(ExecutionResourceGroups::validate({}));
+}
+
+TEST(ExecutionResourceGroupsTest, UpdateCreatesResizesAndDropsGroups) {
+    ASSERT_OK(ExecutionResourceGroups::update({"analytics=8", "payments=128"}));
+
+    {
+        BSONObjBuilder bob;
+        ExecutionResourceGroups::get().appendStats(bob);
+        auto stats = bob.obj();
+        ASSERT_EQUALS(8, stats["analytics"]["totalTickets"].numberInt());
+        ASSERT_EQUALS(0, stats["analytics"]["out"].numberInt());
+        ASSERT_EQUALS(128, stats["payments"]["totalTickets"].numberInt());
+    }
+
+    // Resizing keeps the group; dropping removes it from the stats.
+    ASSERT_OK(ExecutionResourceGroups::update({"analytics=16"}));
+    {
+        BSONObjBuilder bob;
+        ExecutionResourceGroups::get().appendStats(bob);
+        auto stats = bob.obj();
+        ASSERT_EQUALS(16, stats["analytics"]["totalTickets"].numberInt());
+        ASSERT_TRUE(stats["payments"].eoo());
+    }
+
+    ASSERT_OK(ExecutionResourceGroups::update({}));
+    {
+        BSONObjBuilder bob;
+        ExecutionResourceGroups::get().appendStats(bob);
+        ASSERT_TRUE(bob.obj().isEmpty());
+    }
+}
+
+TEST(ExecutionResourceGroupsTest, ResizePreservesGroupIdentity) {
+    ASSERT_OK(ExecutionResourceGroups::update({"batch=2"}));
+    auto group = ExecutionResourceGroups::get().lookup("batch");
+    ASSERT_TRUE(group);
+
+    ASSERT_OK(ExecutionResourceGroups::update({"batch=4"}));
+    ASSERT_TRUE(group == ExecutionResourceGroups::get().lookup("batch"));
+    ASSERT_EQUALS(4, group->ticketHolder()->outof());
+    ASSERT_OK(ExecutionResourceGroups::update({}));
+}
+
+TEST(ExecutionResourceGroupsTest, TicketsOutliveDroppedGroup) {
+    ASSERT_OK(ExecutionResourceGroups::update({"batch=2"}));
+    auto group = ExecutionResourceGroups::get().lookup("batch");
+    ASSERT_TRUE(group);
+
+    // Simulate an operation holding a group ticket while the group is dropped from the
+    // configuration; the shared_ptr keeps the holder alive so release() stays safe.
+    ASSERT_TRUE(group->ticketHolder()->tryAcquire());
+    ASSERT_OK(ExecutionResourceGroups::update({}));
+    ASSERT_FALSE(ExecutionResourceGroups::get().lookup("batch"));
+    ASSERT_EQUALS(1, group->ticketHolder()->used());
+    group->ticketHolder()->release();
+    ASSERT_EQUALS(0, group->ticketHolder()->used());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -148,7 +148,7 @@ FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator*
          [this](Client* client) {
              FlowControlTicketholder::get(client->getServiceContext())->refreshTo(getNumTickets());
          },
-         Seconds(1)});
+         Milliseconds(gFlowControlRefreshPeriodMillis)});
     _jobAnchor.start();
 }
 
@@ -218,6 +218,10 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     // as integers.
     bob.append("locksPerKiloOp", _lastLocksPerOp.load() * 1000);
     bob.append("sustainerRate", _lastSustainerAppliedCount.load());
+    // Internal controller terms, for tuning the smoothing and derivative parameters.
+    bob.append("rawTargetRateLimit", _lastRawTargetTicketsPermitted.load());
+    bob.append("lagMillis", _lastLagMillis.load());
+    bob.append("lagDerivativeMillisPerSecond", _lastLagDerivativeMillisPerSecond.load());
     bob.append("isLagged", _isLagged.load());
     bob.append("isLaggedCount", _isLaggedCount.load());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.load());
@@ -365,13 +369,30 @@ int FlowControl::getNumTickets(Date_t now) {
     // value for lag, so ignore them.
     const bool ignoreWallTimes = lastCommitted.wallTime > myLastApplied.wallTime;
 
+    const std::uint64_t lagMillis =
+        ignoreWallTimes ? 0 : getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime);
+
+    // Track the rate at which the lag is changing. The derivative is surfaced in serverStatus
+    // and, when `flowControlLagDerivativeGain` is set, feeds back into the throttled ticket
+    // calculation below.
+    double lagDerivative = 0.0;
+    if (_lastLagMeasurementTime != Date_t() && now > _lastLagMeasurementTime) {
+        const auto sincePrevMillis = durationCount<Milliseconds>(now - _lastLagMeasurementTime);
+        lagDerivative = (static_cast<double>(lagMillis) -
+                         static_cast<double>(_lastLagMillis.load())) *
+            1000.0 / static_cast<double>(sincePrevMillis);
+    }
+    _lastLagDerivativeMillisPerSecond.store(lagDerivative);
+    _lastLagMillis.store(static_cast<std::int64_t>(lagMillis));
+    _lastLagMeasurementTime = now;
+
     // _approximateOpsBetween will return -1 if the input timestamps are in the same "bucket".
     // This is an indication that there are very few ops between the two timestamps.
     //
     // Don't let the no-op writer on idle systems fool the sophisticated "is the replica set
     // lagged" classifier.
     const bool isHealthy = !ignoreWallTimes &&
-        (getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime) < thresholdLagMillis ||
+        (lagMillis < thresholdLagMillis ||
          _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
                                 myLastApplied.opTime.getTimestamp()) == -1);
 
@@ -382,6 +403,7 @@ int FlowControl::getNumTickets(Date_t now) {
                                             gFlowControlTicketAdderConstant.load(),
                                         gFlowControlTicketMultiplierConstant.load(),
                                         kMaxTickets);
+        _lastRawTargetTicketsPermitted.store(ret);
         _lastTimeSustainerAdvanced = Date_t::now();
         if (_isLagged.load()) {
             _isLagged.store(false);
@@ -391,14 +413,35 @@ int FlowControl::getNumTickets(Date_t now) {
     } else if (!ignoreWallTimes && sustainerAdvanced(_prevMemberData, _currMemberData)) {
         // Expected case where flow control has meaningful data from the last period to make a new
         // calculation.
-        ret =
-            _calculateNewTicketsForLag(_prevMemberData,
-                                       _currMemberData,
-                                       locksUsedLastPeriod,
-                                       locksPerOp,
-                                       getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
-                                       thresholdLagMillis);
-        if (!_isLagged.load()) {
+        const bool wasThrottled = _isLagged.load();
+        ret = _calculateNewTicketsForLag(_prevMemberData,
+                                         _currMemberData,
+                                         locksUsedLastPeriod,
+                                         locksPerOp,
+                                         lagMillis,
+                                         thresholdLagMillis);
+        _lastRawTargetTicketsPermitted.store(ret);
+
+        const double derivativeGain = gFlowControlLagDerivativeGain.load();
+        if (derivativeGain > 0.0) {
+            // Growing lag cuts the target harder and shrinking lag relaxes it sooner. The factor
+            // is clamped so a noisy derivative cannot swing the target by more than 50% in one
+            // period.
+            double factor = 1.0 - derivativeGain * (lagDerivative / 1000.0);
+            factor = std::min(1.5, std::max(0.5, factor));
+            ret = multiplyWithOverflowCheck(factor, ret, kMaxTickets);
+        }
+
+        const double smoothing = gFlowControlTicketSmoothingFactor.load();
+        if (wasThrottled && smoothing < 1.0) {
+            // Low-pass filter successive targets while already throttled. The first throttled
+            // period always takes the raw target, so engagement is never delayed by blending with
+            // the effectively unbounded target of the healthy state.
+            ret = static_cast<int>(smoothing * ret +
+                                   (1.0 - smoothing) * _lastTargetTicketsPermitted.load());
+        }
+
+        if (!wasThrottled) {
             _isLagged.store(true);
             _isLaggedCount.fetchAndAddRelaxed(1);
             _startWaitTime = curTimeMicros64();
@@ -407,19 +450,28 @@ int FlowControl::getNumTickets(Date_t now) {
         // Unexpected case where consecutive readings from the topology state don't meet some basic
         // expectations, or where the lag measure is nonsensical.
         ret = _lastTargetTicketsPermitted.load();
+        _lastRawTargetTicketsPermitted.store(ret);
         _lastTimeSustainerAdvanced = Date_t::now();
         // Since this case does not give conclusive evidence that isLagged could have meaningfully
         // transitioned from true to false, it does not make sense to update the _isLagged*
         // variables here.
     }
 
-    ret = std::max(ret, gFlowControlMinTicketsPerSecond.load());
+    // `flowControlMinTicketsPerSecond` is a rate; scale it to the refresh period so that shorter
+    // periods do not inflate the effective minimum.
+    const int minTicketsPerSecond = gFlowControlMinTicketsPerSecond.load();
+    const int minTicketsPerPeriod = minTicketsPerSecond > 0
+        ? std::max(1,
+                   static_cast<int>(minTicketsPerSecond *
+                                    (gFlowControlRefreshPeriodMillis / 1000.0)))
+        : 0;
+    ret = std::max(ret, minTicketsPerPeriod);
 
     LOGV2_DEBUG(22220,
                 DEBUG_LOG_LEVEL,
                 "FlowControl debug.",
                 "isLagged"_attr = (_isLagged.load() ? "true" : "false"),
-                "currlagMillis"_attr = getLagMillis(myLastApplied.wallTime, lastCommitted.wallTime),
+                "currlagMillis"_attr = lagMillis,
                 "opsLagged"_attr = _approximateOpsBetween(lastCommitted.opTime.getTimestamp(),
                                                           myLastApplied.opTime.getTimestamp()),
                 "granting"_attr = ret,
@@ -147,6 +147,9 @@ private:
     // These values are updated with each flow control computation and are also surfaced in server
     // status.
     AtomicWord<int> _lastTargetTicketsPermitted{kMaxTickets};
+    AtomicWord<int> _lastRawTargetTicketsPermitted{kMaxTickets};
+    AtomicWord<std::int64_t> _lastLagMillis{0};
+    AtomicWord<double> _lastLagDerivativeMillisPerSecond{0.0};
     AtomicWord<double> _lastLocksPerOp{0.0};
     AtomicWord<int> _lastSustainerAppliedCount{0};
     AtomicWord<bool> _isLagged{false};
@@ -169,6 +172,10 @@ private:
 
     Date_t _lastTimeSustainerAdvanced;
 
+    // When the lag was last measured, for computing its rate of change. Only read and written
+    // from the periodic ticket refresher (and tests driving getNumTickets directly).
+    Date_t _lastLagMeasurementTime;
+
     // This value is used for calculating server status metrics.
     std::uint64_t _startWaitTime = 0;
 
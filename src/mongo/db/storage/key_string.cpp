@@ -2596,6 +2596,155 @@ BSONObj toBson(StringData data, Ordering ord, const TypeBits& typeBits) {
     return toBson(data.rawData(), data.size(), ord, typeBits);
 }
 
+BSONObj DecodePlan::decode(const char* buffer, size_t len, const TypeBits& typeBits) {
+    if (_state == State::kUncompiled) {
+        _compile(buffer, len);
+    }
+    if (_state == State::kFixed && _matchesPlan(buffer, len)) {
+        return _decodeFixed(buffer, len);
+    }
+    return toBsonSafe(buffer, len, _ord, typeBits);
+}
+
+void DecodePlan::_compile(const char* buffer, size_t len) {
+    // Unless every component turns out to have a fixed-size encoding, stay on the generic path
+    // for good.
+    _state = State::kGeneric;
+
+    std::vector<Step> steps;
+    size_t pos = 0;
+    for (int i = 0; pos < len; i++) {
+        const bool inverted = (_ord.get(i) == -1);
+        uint8_t ctype = static_cast<uint8_t>(buffer[pos]);
+        if (inverted) {
+            ctype = ~ctype;
+        }
+
+        if (ctype == kEnd) {
+            _hasEndByte = true;
+            _endInverted = inverted;
+            _endOffset = pos;
+            _minLen = pos + 1;
+            _steps = std::move(steps);
+            _state = State::kFixed;
+            return;
+        }
+
+        size_t payloadSize;
+        switch (ctype) {
+            case CType::kMinKey:
+            case CType::kMaxKey:
+            case CType::kNullish:
+            case CType::kUndefined:
+            case CType::kBoolTrue:
+            case CType::kBoolFalse:
+                payloadSize = 0;
+                break;
+            case CType::kDate:
+            case CType::kTimestamp:
+                payloadSize = sizeof(uint64_t);
+                break;
+            case CType::kOID:
+                payloadSize = OID::kOIDSize;
+                break;
+            default:
+                // Variable-length component (or a discriminator byte, which only appears in
+                // query keys).
+                return;
+        }
+
+        steps.push_back({ctype, inverted, static_cast<uint32_t>(pos)});
+        pos += 1 + payloadSize;
+    }
+
+    if (pos == len) {
+        // The key ended exactly at the end of the buffer with no kEnd byte.
+        _minLen = pos;
+        _steps = std::move(steps);
+        _state = State::kFixed;
+    }
+}
+
+bool DecodePlan::_matchesPlan(const char* buffer, size_t len) const {
+    if (_hasEndByte) {
+        if (len < _minLen) {
+            return false;
+        }
+        const uint8_t raw = static_cast<uint8_t>(buffer[_endOffset]);
+        if ((_endInverted ? static_cast<uint8_t>(~raw) : raw) != kEnd) {
+            return false;
+        }
+    } else if (len != _minLen) {
+        return false;
+    }
+
+    for (const auto& step : _steps) {
+        const uint8_t raw = static_cast<uint8_t>(buffer[step.offset]);
+        if ((step.inverted ? static_cast<uint8_t>(~raw) : raw) != step.ctype) {
+            return false;
+        }
+    }
+    return true;
+}
+
+BSONObj DecodePlan::_decodeFixed(const char* buffer, size_t len) const {
+    BSONObjBuilder builder;
+    for (const auto& step : _steps) {
+        const char* payload = buffer + step.offset + 1;
+        switch (step.ctype) {
+            case CType::kMinKey:
+                builder.appendMinKey("");
+                break;
+            case CType::kMaxKey:
+                builder.appendMaxKey("");
+                break;
+            case CType::kNullish:
+                builder.appendNull("");
+                break;
+            case CType::kUndefined:
+                builder.appendUndefined("");
+                break;
+            case CType::kBoolTrue:
+                builder.appendBool("", true);
+                break;
+            case CType::kBoolFalse:
+                builder.appendBool("", false);
+                break;
+            case CType::kDate: {
+                uint64_t encoded;
+                memcpy(&encoded, payload, sizeof(encoded));
+                if (step.inverted) {
+                    encoded = ~encoded;
+                }
+                builder.appendDate(
+                    "", Date_t::fromMillisSinceEpoch(endian::bigToNative(encoded) ^ (1LL << 63)));
+                break;
+            }
+            case CType::kTimestamp: {
+                uint64_t encoded;
+                memcpy(&encoded, payload, sizeof(encoded));
+                if (step.inverted) {
+                    encoded = ~encoded;
+                }
+                builder.append("", Timestamp(endian::bigToNative(encoded)));
+                break;
+            }
+            case CType::kOID:
+                if (step.inverted) {
+                    char flipped[OID::kOIDSize];
+                    memcpy_flipBits(flipped, payload, OID::kOIDSize);
+                    builder.append("", OID::from(flipped));
+                } else {
+                    builder.append("", OID::from(payload));
+                }
+                break;
+            default:
+                MONGO_UNREACHABLE;
+        }
+    }
+    return builder.obj();
+}
+
 RecordId decodeRecordIdLongAtEnd(const void* bufferRaw, size_t bufSize) {
     const unsigned char* buffer = static_cast<const unsigned char*>(bufferRaw);
     invariant(bufSize >= 2);  // smallest possible encoding of a RecordId.
@@ -424,12 +424,34 @@ public:
         Version keyStringVersion;
     };
 
+    /**
+     * Serializes this Value for spilling by the Sorter. Unlike serialize(), the record is
+     * prefixed with the size of the whole buffer, so deserializeForSorter() can reconstruct the
+     * Value with a single copy without re-parsing the TypeBits encoding to locate the end of the
+     * record. The serialized format takes the following form:
+     *   [keystring size][buffer size][keystring encoding][typebits encoding]
+     * Spill files are ephemeral, so this format may change between versions; an index build
+     * resumed on a binary with a different format will fail to deserialize and restart from
+     * scratch.
+     */
     void serializeForSorter(BufBuilder& buf) const {
-        serialize(buf);
+        buf.appendNum(_ksSize);                                // Serialize size of Keystring
+        buf.appendNum(static_cast<int32_t>(_buffer.size()));   // Serialize size of whole buffer
+        buf.appendBuf(_buffer.get(), _buffer.size());          // Serialize Keystring + Typebits
     }
 
     static Value deserializeForSorter(BufReader& buf, const SorterDeserializeSettings& settings) {
-        return deserialize(buf, settings.keyStringVersion);
+        const int32_t sizeOfKeystring = buf.read<LittleEndian<int32_t>>();
+        const int32_t sizeOfBuffer = buf.read<LittleEndian<int32_t>>();
+
+        BufBuilder newBuf(sizeOfBuffer);
+        newBuf.appendBuf(buf.skip(sizeOfBuffer), sizeOfBuffer);
+        // Note: this variable is needed to make sure that no method is called on 'newBuf'
+        // after a call on its 'release' method.
+        const size_t newBufLen = newBuf.len();
+        return {settings.keyStringVersion,
+                sizeOfKeystring,
+                SharedBufferFragment(newBuf.release(), newBufLen)};
     }
 
     int memUsageForSorter() const {
@@ -991,6 +1013,55 @@ BSONObj toBson(const T& keyString, Ordering ord) noexcept {
     return toBson(keyString.getBuffer(), keyString.getSize(), ord, keyString.getTypeBits());
 }
 
+/**
+ * Decodes index keys into BSON like toBsonSafe(), but remembers the layout of the first key it
+ * sees. KeyString components with fixed-size encodings (dates, timestamps, ObjectIds, booleans,
+ * null, undefined and MinKey/MaxKey) always occupy the same offsets, so later keys that match
+ * the remembered layout are decoded with a few bounds-checked reads instead of generic
+ * type-byte-by-type-byte parsing. Keys containing variable-length components (strings, numerics,
+ * objects, arrays) and keys whose layout differs from the remembered one fall back to the
+ * generic path, so a DecodePlan always produces the same BSON as toBsonSafe().
+ *
+ * Intended to be kept per index cursor, where long covered scans decode millions of keys that
+ * share a single layout.
+ */
+class DecodePlan {
+public:
+    explicit DecodePlan(Ordering ord) : _ord(ord) {}
+
+    BSONObj decode(const char* buffer, size_t len, const TypeBits& typeBits);
+
+private:
+    struct Step {
+        uint8_t ctype;
+        bool inverted;
+        uint32_t offset;  // Offset of the component's type byte within the key buffer.
+    };
+
+    enum class State {
+        kUncompiled,  // No key has been seen yet.
+        kFixed,       // The first key had a fixed-size layout; '_steps' is valid.
+        kGeneric      // The first key was not fixed-size; always use the generic path.
+    };
+
+    void _compile(const char* buffer, size_t len);
+    bool _matchesPlan(const char* buffer, size_t len) const;
+    BSONObj _decodeFixed(const char* buffer, size_t len) const;
+
+    const Ordering _ord;
+    State _state = State::kUncompiled;
+    std::vector<Step> _steps;
+
+    // The number of bytes the compiled layout occupies, including its kEnd byte when present.
+    uint32_t _minLen = 0;
+
+    // Offset and inversion of the kEnd byte terminating the layout. '_hasEndByte' is false when
+    // the layout ends exactly at the end of the buffer.
+    bool _hasEndByte = false;
+    bool _endInverted = false;
+    uint32_t _endOffset = 0;
+};
+
 /**
  * Decodes a RecordId long from the end of a buffer.
  */
@@ -322,6 +322,47 @@ TEST_F(KeyStringBuilderTest, Simple1) {
                      KeyString::Builder(version, b, ALL_ASCENDING, RecordId(1)));
 }
 
+TEST_F(KeyStringBuilderTest, DecodePlanMatchesGenericDecode) {
+    const auto check = [&](Ordering order, const std::vector<BSONObj>& objs) {
+        KeyString::DecodePlan plan(order);
+        for (const auto& obj : objs) {
+            const KeyString::Builder ks(version, obj, order);
+            const BSONObj generic =
+                KeyString::toBsonSafe(ks.getBuffer(), ks.getSize(), order, ks.getTypeBits());
+            const BSONObj planned = plan.decode(ks.getBuffer(), ks.getSize(), ks.getTypeBits());
+            ASSERT_BSONOBJ_EQ(planned, generic);
+            ASSERT_BSONOBJ_EQ(planned, obj);
+        }
+    };
+
+    const OID oid = OID::gen();
+    const auto date = Date_t::fromMillisSinceEpoch(1234567890123LL);
+
+    for (const auto& order : {ALL_ASCENDING, ONE_DESCENDING}) {
+        // The first key compiles a fixed-offset plan; the second reuses it. The third and
+        // fourth have layouts that differ from the plan, so they fall back to the generic
+        // path key by key.
+        check(order,
+              {BSON("" << date << "" << oid << "" << true << "" << Timestamp(123123, 123)),
+               BSON("" << Date_t::fromMillisSinceEpoch(42) << "" << OID::gen() << "" << false << ""
+                       << Timestamp(1, 1)),
+               BSON("" << BSONNULL << "" << oid << "" << true << "" << Timestamp(123123, 123)),
+               BSON(""
+                    << "str"
+                    << "" << oid << "" << true << "" << Timestamp(123123, 123))});
+
+        // A first key with a variable-length component keeps the plan on the generic path.
+        check(order,
+              {BSON(""
+                    << "abc"
+                    << "" << 1),
+               BSON(""
+                    << "d"
+                    << "" << 2.5),
+               BSON("" << MINKEY << "" << MAXKEY)});
+    }
+}
+
 #define ROUNDTRIP_ORDER(version, x, order)                            \
     do {                                                              \
         const BSONObj _orig = x;                                      \
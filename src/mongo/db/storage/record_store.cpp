@@ -81,6 +81,19 @@ void RecordStore::cappedTruncateAfter(OperationContext* opCtx, RecordId end, boo
     doCappedTruncateAfter(opCtx, end, inclusive);
 }
 
+Status RecordStore::rangeTruncate(OperationContext* opCtx,
+                                  const RecordId& minRecordId,
+                                  const RecordId& maxRecordId,
+                                  int64_t hintDataSizeDiff,
+                                  int64_t hintNumRecordsDiff) {
+    validateWriteAllowed();
+    invariant(minRecordId != RecordId() || maxRecordId != RecordId(),
+              "Ranged truncate must have at least one bound defined");
+    invariant(minRecordId == RecordId() || maxRecordId == RecordId() || minRecordId <= maxRecordId,
+              "Start position cannot be after end position");
+    return doRangeTruncate(opCtx, minRecordId, maxRecordId, hintDataSizeDiff, hintNumRecordsDiff);
+}
+
 Status RecordStore::compact(OperationContext* opCtx) {
     validateWriteAllowed();
     return doCompact(opCtx);
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <vector>
 
 #include "mongo/bson/mutable/damage_vector.h"
 #include "mongo/db/exec/collection_scan_common.h"
@@ -48,6 +49,7 @@ class MAdvise;
 class OperationContext;
 
 class RecordStore;
+class UUID;
 
 struct ValidateResults;
 class ValidateAdaptor;
@@ -114,6 +116,25 @@ public:
      */
     virtual boost::optional<Record> next() = 0;
 
+    /**
+     * Moves forward up to 'maxCount' times, appending each record to 'out', and returns the
+     * number of records appended. Fewer records than requested (including zero) indicates EOF.
+     * Because the cursor advances past each buffered record, the appended record data is made
+     * owned. Batched readers amortize the per-record cursor overhead across a batch and check
+     * for interrupt once per call rather than once per record.
+     */
+    virtual size_t nextBatch(size_t maxCount, std::vector<Record>* out) {
+        size_t count = 0;
+        for (; count < maxCount; ++count) {
+            auto record = next();
+            if (!record)
+                break;
+            record->data.makeOwned();
+            out->push_back(std::move(*record));
+        }
+        return count;
+    }
+
     //
     // Saving and restoring state
     //
@@ -274,6 +295,31 @@ public:
      */
     virtual long long numRecords(OperationContext* opCtx) const = 0;
 
+    /**
+     * Returns an order-independent checksum over the record store's contents, maintained
+     * incrementally as records are inserted, updated and deleted, or boost::none if this record
+     * store does not maintain one. The checksum is persisted together with the size metadata, so
+     * like numRecords() and dataSize() it may be inaccurate after an unclean shutdown.
+     */
+    virtual boost::optional<long long> dataChecksum() const {
+        return boost::none;
+    }
+
+    /**
+     * Returns the value dataChecksum() had when recordCleanValidation() was last called, or
+     * boost::none if no clean validation has been recorded (or checksums are not maintained). An
+     * unchanged checksum indicates that no records have been written since that validation.
+     */
+    virtual boost::optional<long long> lastCleanValidateChecksum() const {
+        return boost::none;
+    }
+
+    /**
+     * Records the current dataChecksum() as the baseline returned by lastCleanValidateChecksum().
+     * Called when a validation completes without finding any problems.
+     */
+    virtual void recordCleanValidation() {}
+
     /**
      * Storage engines can manage oplog truncation internally as opposed to having higher layers
      * manage it for them.
@@ -460,6 +506,23 @@ public:
      */
     void cappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive);
 
+    /**
+     * Removes all Records in the range [minRecordId, maxRecordId], inclusive of both ends. A
+     * null RecordId leaves the corresponding end of the range open. The removal is performed by
+     * the storage engine and is not replicated, so it must only be used for unreplicated
+     * collections or for data that every node prunes independently.
+     *
+     * Storage engines may truncate the range without visiting individual records, so the stored
+     * data size and record count are adjusted by 'hintDataSizeDiff' and 'hintNumRecordsDiff'
+     * (both typically negative). Engines that do visit each record maintain exact counts and
+     * ignore the hints.
+     */
+    Status rangeTruncate(OperationContext* opCtx,
+                         const RecordId& minRecordId = RecordId(),
+                         const RecordId& maxRecordId = RecordId(),
+                         int64_t hintDataSizeDiff = 0,
+                         int64_t hintNumRecordsDiff = 0);
+
     /**
      * does this RecordStore support the compact operation?
      *
@@ -605,6 +668,24 @@ public:
                       "getting the earliest oplog timestamp.");
     }
 
+    /**
+     * If supported, returns a timestamp T >= 'fromTs' such that the region of the oplog in
+     * [fromTs, T) is guaranteed to contain no committed entries that carry 'uuid' as their
+     * collection UUID, and no command, transaction or internal entries that could pertain to any
+     * collection. A change stream on the collection identified by 'uuid' that would otherwise
+     * begin scanning at 'fromTs' may begin at T instead without missing any relevant event. Both
+     * 'fromTs' and T must still be in the oplog at the time of the call.
+     *
+     * Returns boost::none if no skip information is available, in which case the caller must scan
+     * from 'fromTs'. The returned timestamp is conservative: regions that cannot be proven free of
+     * relevant entries are never skipped.
+     */
+    virtual boost::optional<Timestamp> getOplogResumeSkipPoint(OperationContext* opCtx,
+                                                               const UUID& uuid,
+                                                               Timestamp fromTs) {
+        return boost::none;
+    }
+
 protected:
     // Functions derived classes need to override to implement this interface. Any write needs to be
     // first checked so we are not in read only mode in this base class and then redirected to the
@@ -625,6 +706,11 @@ protected:
         const mutablebson::DamageVector& damages) = 0;
     virtual Status doTruncate(OperationContext* opCtx) = 0;
     virtual void doCappedTruncateAfter(OperationContext* opCtx, RecordId end, bool inclusive) = 0;
+    virtual Status doRangeTruncate(OperationContext* opCtx,
+                                   const RecordId& minRecordId,
+                                   const RecordId& maxRecordId,
+                                   int64_t hintDataSizeDiff,
+                                   int64_t hintNumRecordsDiff) = 0;
     virtual Status doCompact(OperationContext* opCtx) {
         MONGO_UNREACHABLE;
     }
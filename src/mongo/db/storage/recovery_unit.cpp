@@ -68,7 +68,7 @@ void RecoveryUnit::runPreCommitHooks(OperationContext* opCtx) {
 
 void RecoveryUnit::registerChange(std::unique_ptr<Change> change) {
     validateInUnitOfWork();
-    _changes.push_back(std::move(change));
+    _changes.push(std::move(change));
 }
 
 void RecoveryUnit::registerChangeForCatalogVisibility(std::unique_ptr<Change> change) {
@@ -93,14 +93,15 @@ void RecoveryUnit::commitRegisteredChanges(boost::optional<Timestamp> commitTime
 }
 
 void RecoveryUnit::_executeCommitHandlers(boost::optional<Timestamp> commitTimestamp) {
-    for (auto& change : _changes) {
+    for (auto& entry : _changes.entries()) {
         try {
             // Log at higher level because commits occur far more frequently than rollbacks.
             LOGV2_DEBUG(22244,
                         3,
                         "CUSTOM COMMIT {demangleName_typeid_change}",
-                        "demangleName_typeid_change"_attr = redact(demangleName(typeid(*change))));
-            change->commit(commitTimestamp);
+                        "demangleName_typeid_change"_attr =
+                            redact(demangleName(typeid(*entry.change))));
+            entry.change->commit(commitTimestamp);
         } catch (...) {
             std::terminate();
         }
@@ -140,10 +141,9 @@ void RecoveryUnit::_executeRollbackHandlers() {
                             redact(demangleName(typeid(*_changeForCatalogVisibility))));
             _changeForCatalogVisibility->rollback();
         }
-        for (Changes::const_reverse_iterator it = _changes.rbegin(), end = _changes.rend();
-             it != end;
-             ++it) {
-            Change* change = it->get();
+        const auto& entries = _changes.entries();
+        for (auto it = entries.rbegin(), end = entries.rend(); it != end; ++it) {
+            Change* change = it->change;
             LOGV2_DEBUG(22245,
                         2,
                         "CUSTOM ROLLBACK {demangleName_typeid_change}",
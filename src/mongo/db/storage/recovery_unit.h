@@ -29,9 +29,13 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <memory>
 #include <stdlib.h>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "mongo/base/status.h"
 #include "mongo/bson/timestamp.h"
@@ -571,6 +575,19 @@ public:
      */
     void registerChange(std::unique_ptr<Change> change);
 
+    /**
+     * Constructs a change of type ChangeT directly in this RecoveryUnit's flat commit queue and
+     * registers it. Equivalent to registerChange(std::make_unique<ChangeT>(args...)), but small
+     * changes are placed in inline storage owned by the queue, so bulk writes that register a
+     * change per document do not perform a heap allocation per change. Changes too large for an
+     * inline slot silently fall back to the heap.
+     */
+    template <typename ChangeT, typename... Args>
+    void emplaceChange(Args&&... args) {
+        validateInUnitOfWork();
+        _changes.emplace<ChangeT>(std::forward<Args>(args)...);
+    }
+
     /**
      * Registers a change with the given rollback and commit functions.
      *
@@ -594,7 +611,7 @@ public:
             CommitCallback _commit;
         };
 
-        registerChange(std::make_unique<CallbackChange>(std::move(commit), std::move(rollback)));
+        emplaceChange<CallbackChange>(std::move(commit), std::move(rollback));
     }
 
     /**
@@ -634,7 +651,7 @@ public:
             Callback _callback;
         };
 
-        registerChange(std::make_unique<OnRollbackChange>(std::move(callback)));
+        emplaceChange<OnRollbackChange>(std::move(callback));
     }
 
     /**
@@ -656,7 +673,7 @@ public:
             Callback _callback;
         };
 
-        registerChange(std::make_unique<OnCommitChange>(std::move(callback)));
+        emplaceChange<OnCommitChange>(std::move(callback));
     }
 
     virtual void setOrderedCommit(bool orderedCommit) = 0;
@@ -817,8 +834,90 @@ private:
 
     std::vector<std::function<void(OperationContext*)>> _preCommitHooks;
 
-    typedef std::vector<std::unique_ptr<Change>> Changes;
-    Changes _changes;
+    /**
+     * A flat queue of registered Change objects, executed in registration order on commit and in
+     * reverse order on rollback.
+     *
+     * Changes that fit are constructed directly into fixed-size slots carved out of chunked
+     * buffers owned by the queue, so registering a change normally costs no allocation beyond
+     * the amortized growth of the queue itself; larger changes fall back to individual heap
+     * allocations. Buffers are retained across clear() so a RecoveryUnit reused for many units
+     * of work stops allocating altogether.
+     */
+    class ChangeQueue {
+    public:
+        ChangeQueue() = default;
+        ChangeQueue(const ChangeQueue&) = delete;
+        ChangeQueue& operator=(const ChangeQueue&) = delete;
+
+        ~ChangeQueue() {
+            clear();
+        }
+
+        struct Entry {
+            Change* change;
+            // Heap-allocated changes are deleted; inline ones are only destroyed in place.
+            bool ownedByHeap;
+        };
+
+        void push(std::unique_ptr<Change> change) {
+            _entries.push_back({change.release(), true});
+        }
+
+        template <typename ChangeT, typename... Args>
+        void emplace(Args&&... args) {
+            static_assert(std::is_base_of<Change, ChangeT>::value,
+                          "Registered changes must derive from RecoveryUnit::Change");
+            if constexpr (sizeof(ChangeT) <= kSlotSize && alignof(ChangeT) <= alignof(Slot)) {
+                _entries.push_back(
+                    {new (_allocateSlot()) ChangeT(std::forward<Args>(args)...), false});
+            } else {
+                push(std::make_unique<ChangeT>(std::forward<Args>(args)...));
+            }
+        }
+
+        const std::vector<Entry>& entries() const {
+            return _entries;
+        }
+
+        void clear() {
+            // Destroy in reverse order of registration, mirroring rollback order.
+            for (auto it = _entries.rbegin(); it != _entries.rend(); ++it) {
+                if (it->ownedByHeap) {
+                    delete it->change;
+                } else {
+                    it->change->~Change();
+                }
+            }
+            _entries.clear();
+            _slotsUsed = 0;
+        }
+
+    private:
+        // Large enough for a vtable pointer plus the typical captures of the commit and rollback
+        // hooks registered on the write path (an object pointer, a RecordId and some counters).
+        static constexpr size_t kSlotSize = 64;
+        static constexpr size_t kSlotsPerBuffer = 16;
+
+        struct alignas(std::max_align_t) Slot {
+            unsigned char storage[kSlotSize];
+        };
+        using Buffer = std::array<Slot, kSlotsPerBuffer>;
+
+        void* _allocateSlot() {
+            const size_t bufferIndex = _slotsUsed / kSlotsPerBuffer;
+            if (bufferIndex == _buffers.size()) {
+                _buffers.push_back(std::make_unique<Buffer>());
+            }
+            return &(*_buffers[bufferIndex])[_slotsUsed++ % kSlotsPerBuffer];
+        }
+
+        std::vector<Entry> _entries;
+        std::vector<std::unique_ptr<Buffer>> _buffers;
+        size_t _slotsUsed = 0;
+    };
+
+    ChangeQueue _changes;
     std::unique_ptr<Change> _changeForCatalogVisibility;
     State _state = State::kInactive;
     uint64_t _mySnapshotId;
@@ -128,6 +128,49 @@ TEST_F(RecoveryUnitTestHarness, CommitAndRollbackChanges) {
     ASSERT_EQUALS(count, 0);
 }
 
+TEST_F(RecoveryUnitTestHarness, CommitAndRollbackEmplacedChanges) {
+    int count = 0;
+    const auto rs = harnessHelper->createRecordStore(opCtx.get(), "table1");
+
+    // Register enough changes to span several inline buffers, plus one change too large for an
+    // inline slot, and check they all commit and roll back exactly once.
+    class LargeTestChange final : public RecoveryUnit::Change {
+    public:
+        LargeTestChange(int* count) : _count(count) {}
+
+        void commit(boost::optional<Timestamp>) override {
+            *_count = *_count + 1;
+        }
+
+        void rollback() override {
+            *_count = *_count - 1;
+        }
+
+    private:
+        int* _count;
+        char _padding[128];
+    };
+
+    const int nChanges = 100;
+    ru->beginUnitOfWork(opCtx.get());
+    for (int i = 0; i < nChanges; i++) {
+        ru->emplaceChange<TestChange>(&count);
+    }
+    ru->emplaceChange<LargeTestChange>(&count);
+    ASSERT_EQUALS(count, 0);
+    ru->commitUnitOfWork();
+    ASSERT_EQUALS(count, nChanges + 1);
+
+    ru->beginUnitOfWork(opCtx.get());
+    for (int i = 0; i < nChanges; i++) {
+        ru->emplaceChange<TestChange>(&count);
+    }
+    ru->emplaceChange<LargeTestChange>(&count);
+    ASSERT_EQUALS(count, nChanges + 1);
+    ru->abortUnitOfWork();
+    ASSERT_EQUALS(count, 0);
+}
+
 TEST_F(RecoveryUnitTestHarness, CheckIsActiveWithCommit) {
     Lock::GlobalLock globalLk(opCtx.get(), MODE_IX);
     const auto rs = harnessHelper->createRecordStore(opCtx.get(), "table1");
@@ -236,6 +279,11 @@ DEATH_TEST_F(RecoveryUnitTestHarness, RegisterChangeMustBeInUnitOfWork, "invaria
     opCtx->recoveryUnit()->registerChange(std::make_unique<TestChange>(&count));
 }
 
+DEATH_TEST_F(RecoveryUnitTestHarness, EmplaceChangeMustBeInUnitOfWork, "invariant") {
+    int count = 0;
+    opCtx->recoveryUnit()->emplaceChange<TestChange>(&count);
+}
+
 DEATH_TEST_F(RecoveryUnitTestHarness, CommitMustBeInUnitOfWork, "invariant") {
     opCtx->recoveryUnit()->commitUnitOfWork();
 }
@@ -96,6 +96,21 @@ public:
                           const KeyString::Value& keyString,
                           bool dupsAllowed) = 0;
 
+    /**
+     * Inserts every key in 'keys' into the index, stopping at the first key whose insertion fails.
+     * Equivalent to calling 'insert()' on each key in order, but implementations may amortize
+     * per-key overhead across the batch, e.g. by inserting all keys through a single storage
+     * cursor. Since 'keys' is sorted, such a pass visits the underlying tree in order.
+     */
+    virtual Status insertKeys(OperationContext* opCtx, const KeyStringSet& keys, bool dupsAllowed) {
+        for (const auto& keyString : keys) {
+            if (auto status = insert(opCtx, keyString, dupsAllowed); !status.isOK()) {
+                return status;
+            }
+        }
+        return Status::OK();
+    }
+
     /**
      * Remove the entry from the index with the specified KeyString, which must have a RecordId
      * appended to the end.
@@ -0,0 +1,49 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+namespace mongo {
+
+/**
+ * Returns true if the storage engine has recently reported that its cache is close to full and
+ * eviction is likely falling behind. The value is a single relaxed atomic load, so callers may
+ * consult it on hot paths (e.g. per-document query execution checks) without talking to the
+ * storage engine.
+ */
+bool isStorageEngineCacheUnderPressure();
+
+/**
+ * Publishes whether the storage engine cache is under pressure. Called periodically by the storage
+ * engine from a background thread; the flag may therefore lag the true cache state by up to the
+ * publishing interval.
+ */
+void setStorageEngineCacheUnderPressure(bool underPressure);
+
+}  // namespace mongo
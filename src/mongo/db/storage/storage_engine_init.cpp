@@ -184,6 +184,12 @@ StorageEngine::LastShutdownState initializeStorageEngine(OperationContext* opCtx
                         std::make_unique<FifoTicketHolder>(readTransactions),
                         std::make_unique<FifoTicketHolder>(writeTransactions));
                     break;
+                case QueueingPolicyEnum::LockFree:
+                    LOGV2_DEBUG(6650004, 1, "Using lock-free ticketing scheduler");
+                    ticketHolders.setGlobalThrottling(
+                        std::make_unique<LockFreeTicketHolder>(readTransactions),
+                        std::make_unique<LockFreeTicketHolder>(writeTransactions));
+                    break;
             }
         } else {
             ticketHolders.setGlobalThrottling(
@@ -296,6 +296,29 @@ Status WiredTigerIndex::insert(OperationContext* opCtx,
     return _insert(opCtx, c, keyString, dupsAllowed);
 }
 
+Status WiredTigerIndex::insertKeys(OperationContext* opCtx,
+                                   const KeyStringSet& keys,
+                                   bool dupsAllowed) {
+    dassert(opCtx->lockState()->isWriteLocked());
+
+    // Open the cursor once for the whole batch. 'keys' is sorted, so the inserts walk the table
+    // in order rather than re-seeking from the root for every key.
+    WiredTigerCursor curwrap(_uri, _tableId, false, opCtx);
+    curwrap.assertInActiveTxn();
+    WT_CURSOR* c = curwrap.get();
+
+    for (const auto& keyString : keys) {
+        dassertRecordIdAtEnd(keyString, _rsKeyFormat);
+
+        LOGV2_TRACE_INDEX(6650007, "KeyString: {keyString}", "keyString"_attr = keyString);
+
+        if (auto status = _insert(opCtx, c, keyString, dupsAllowed); !status.isOK()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 void WiredTigerIndex::unindex(OperationContext* opCtx,
                               const KeyString::Value& keyString,
                               bool dupsAllowed) {
@@ -938,7 +961,8 @@ public:
           _forward(forward),
           _key(idx.getKeyStringVersion()),
           _typeBits(idx.getKeyStringVersion()),
-          _query(idx.getKeyStringVersion()) {
+          _query(idx.getKeyStringVersion()),
+          _decodePlan(idx.getOrdering()) {
         _cursor.emplace(_idx.uri(), _idx.tableId(), false, _opCtx);
     }
 
@@ -1098,8 +1122,7 @@ protected:
 
         BSONObj bson;
         if (TRACING_ENABLED || (parts & kWantKey)) {
-            bson =
-                KeyString::toBson(_key.getBuffer(), _key.getSize(), _idx.getOrdering(), _typeBits);
+            bson = _decodePlan.decode(_key.getBuffer(), _key.getSize(), _typeBits);
 
             LOGV2_TRACE_CURSOR(20000, "returning {bson} {id}", "bson"_attr = bson, "id"_attr = _id);
         }
@@ -1352,6 +1375,10 @@ protected:
 
     KeyString::Builder _query;
 
+    // Accelerates decoding keys into BSON in curr() when the index's keys have a fixed-size
+    // layout. Mutable because curr() is const and the plan compiles itself lazily.
+    mutable KeyString::DecodePlan _decodePlan;
+
     std::unique_ptr<KeyString::Builder> _endPosition;
 
     bool _saveStorageCursorOnDetachFromOperationContext = false;
@@ -105,6 +105,10 @@ public:
                           const KeyString::Value& keyString,
                           bool dupsAllowed);
 
+    virtual Status insertKeys(OperationContext* opCtx,
+                              const KeyStringSet& keys,
+                              bool dupsAllowed) override;
+
     virtual void unindex(OperationContext* opCtx,
                          const KeyString::Value& keyString,
                          bool dupsAllowed);
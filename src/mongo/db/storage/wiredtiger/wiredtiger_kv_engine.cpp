@@ -75,6 +75,7 @@
 #include "mongo/db/storage/journal_listener.h"
 #include "mongo/db/storage/key_format.h"
 #include "mongo/db/storage/storage_file_util.h"
+#include "mongo/db/storage/storage_engine_cache_pressure.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/storage_repair_observer.h"
@@ -249,6 +250,8 @@ public:
 
             _sessionCache->closeExpiredIdleSessions(gWiredTigerSessionCloseIdleTimeSecs.load() *
                                                     1000);
+
+            _publishCachePressure();
         }
         LOGV2_DEBUG(22304, 1, "stopping {name} thread", "name"_attr = name());
     }
@@ -265,6 +268,29 @@ public:
     }
 
 private:
+    /**
+     * Publishes whether the WiredTiger cache is close to full, for consumers that must not query
+     * statistics on their own hot paths (e.g. query yield policies). WiredTiger's eviction threads
+     * start stalling application threads once cache use crosses the eviction trigger, which
+     * defaults to 95% of the configured cache size.
+     */
+    void _publishCachePressure() {
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        auto bytesInUse = WiredTigerUtil::getStatisticsValue(session->getSession(),
+                                                             "statistics:",
+                                                             "statistics=(fast)",
+                                                             WT_STAT_CONN_CACHE_BYTES_INUSE);
+        auto bytesMax = WiredTigerUtil::getStatisticsValue(
+            session->getSession(), "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_MAX);
+        if (!bytesInUse.isOK() || !bytesMax.isOK() || bytesMax.getValue() <= 0) {
+            return;
+        }
+        setStorageEngineCacheUnderPressure(bytesInUse.getValue() * 100 >=
+                                           bytesMax.getValue() * kCachePressureThresholdPct);
+    }
+
+    static constexpr int64_t kCachePressureThresholdPct = 95;
+
     WiredTigerSessionCache* _sessionCache;
     AtomicWord<bool> _shuttingDown{false};
 
@@ -561,6 +587,7 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
         // because replication and sharded transactions do not currently run on the inMemory engine.
         // It is live in testing, however.
         minSnapshotHistoryWindowInSeconds.store(0);
+        maxSnapshotHistoryWindowInSeconds.store(0);
     }
 
     _sizeStorerUri = _uri("sizeStorer");
@@ -2265,24 +2292,23 @@ void WiredTigerKVEngine::setOldestTimestamp(Timestamp newOldestTimestamp, bool f
 }
 
 Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp) {
-    // The oldest_timestamp should lag behind the stable_timestamp by
-    // 'minSnapshotHistoryWindowInSeconds' seconds.
+    // The oldest_timestamp should lag behind the stable_timestamp by the snapshot history window.
 
     if (_ephemeral && !TestingProctor::instance().isEnabled()) {
         // No history should be maintained for the inMemory engine because it is not used yet.
         invariant(minSnapshotHistoryWindowInSeconds.load() == 0);
     }
 
-    if (stableTimestamp.getSecs() <
-        static_cast<unsigned>(minSnapshotHistoryWindowInSeconds.load())) {
+    const int windowSeconds = _getSnapshotHistoryWindowInSeconds(stableTimestamp);
+
+    if (stableTimestamp.getSecs() < static_cast<unsigned>(windowSeconds)) {
         // The history window is larger than the timestamp history thus far. We must wait for
         // the history to reach the window size before moving oldest_timestamp forward. This should
         // only happen in unit tests.
         return Timestamp();
     }
 
-    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() -
-                                            minSnapshotHistoryWindowInSeconds.load(),
+    Timestamp calculatedOldestTimestamp(stableTimestamp.getSecs() - windowSeconds,
                                         stableTimestamp.getInc());
 
     if (calculatedOldestTimestamp.asULL() <= _oldestTimestamp.load()) {
@@ -2299,6 +2325,68 @@ Timestamp WiredTigerKVEngine::_calculateHistoryLagFromStableTimestamp(Timestamp
     return calculatedOldestTimestamp;
 }
 
+int WiredTigerKVEngine::_getSnapshotHistoryWindowInSeconds(Timestamp stableTimestamp) {
+    const int minWindow = minSnapshotHistoryWindowInSeconds.load();
+    const int maxWindow = std::max(maxSnapshotHistoryWindowInSeconds.load(), minWindow);
+    if (maxWindow == minWindow) {
+        // Adaptive sizing is disabled; retain the statically configured window.
+        return minWindow;
+    }
+
+    int window = std::min(std::max(_adaptiveSnapshotWindowSeconds.load(), minWindow), maxWindow);
+
+    // Sampling cache statistics on every stable timestamp update would be wasteful; adjust the
+    // window at most once per second of stable time.
+    const auto stableSecs = stableTimestamp.getSecs();
+    if (stableSecs > _adaptiveSnapshotWindowLastAdjustmentSecs.load()) {
+        _adaptiveSnapshotWindowLastAdjustmentSecs.store(stableSecs);
+
+        int newWindow;
+        if (_isSnapshotHistoryCacheUnderPressure()) {
+            // Back off multiplicatively so that a cache filling up with history is relieved
+            // within a few adjustments, well before eviction starts stalling application threads.
+            newWindow = std::max(minWindow, window - std::max(window / 10, 1));
+        } else {
+            // Grow additively to extend how far back in time reads may observe.
+            newWindow = std::min(maxWindow, window + 1);
+        }
+
+        if (newWindow != window) {
+            LOGV2_DEBUG(6650025,
+                        2,
+                        "Adjusted snapshot history window",
+                        "previousSeconds"_attr = window,
+                        "newSeconds"_attr = newWindow);
+            window = newWindow;
+        }
+        _adaptiveSnapshotWindowSeconds.store(window);
+    }
+
+    return window;
+}
+
+bool WiredTigerKVEngine::_isSnapshotHistoryCacheUnderPressure() {
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    auto readStat = [&](int statisticsKey) -> int64_t {
+        auto result = WiredTigerUtil::getStatisticsValue(
+            session->getSession(), "statistics:", "statistics=(fast)", statisticsKey);
+        return result.isOK() ? result.getValue() : 0;
+    };
+
+    const int64_t maxBytes = readStat(WT_STAT_CONN_CACHE_BYTES_MAX);
+    if (maxBytes <= 0) {
+        return false;
+    }
+
+    // Dirty and update content is what eviction must reconcile before it can free cache, and
+    // history store content is what retaining snapshot history costs. Any of them crowding the
+    // cache means the history window should shrink.
+    const int64_t thresholdBytes = maxBytes * snapshotHistoryCachePressureThreshold.load() / 100;
+    return readStat(WT_STAT_CONN_CACHE_BYTES_DIRTY) >= thresholdBytes ||
+        readStat(WT_STAT_CONN_CACHE_BYTES_UPDATES) >= thresholdBytes ||
+        readStat(WT_STAT_CONN_CACHE_BYTES_HS) >= thresholdBytes;
+}
+
 void WiredTigerKVEngine::setInitialDataTimestamp(Timestamp initialDataTimestamp) {
     LOGV2_DEBUG(22344,
                 2,
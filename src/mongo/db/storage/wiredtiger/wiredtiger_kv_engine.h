@@ -416,15 +416,32 @@ private:
     std::string _uri(StringData ident) const;
 
     /**
-     * Uses the 'stableTimestamp', the 'minSnapshotHistoryWindowInSeconds' setting and the
-     * current _oldestTimestamp to calculate what the new oldest_timestamp should be, in order to
-     * maintain a window of available snapshots on the storage engine from oldest to stable
-     * timestamp.
+     * Uses the 'stableTimestamp', the snapshot history window and the current _oldestTimestamp to
+     * calculate what the new oldest_timestamp should be, in order to maintain a window of
+     * available snapshots on the storage engine from oldest to stable timestamp.
      *
      * If the returned Timestamp isNull(), oldest_timestamp should not be moved forward.
      */
     Timestamp _calculateHistoryLagFromStableTimestamp(Timestamp stableTimestamp);
 
+    /**
+     * Returns the number of seconds of snapshot history to retain behind the stable timestamp.
+     *
+     * When 'maxSnapshotHistoryWindowInSeconds' exceeds 'minSnapshotHistoryWindowInSeconds' the
+     * window is sized adaptively: it grows by one second per second of stable time while the
+     * cache has headroom and shrinks by 10% whenever dirty, update or history store content
+     * crosses 'snapshotHistoryCachePressureThreshold' percent of the cache. Otherwise the
+     * configured minimum is returned unchanged.
+     */
+    int _getSnapshotHistoryWindowInSeconds(Timestamp stableTimestamp);
+
+    /**
+     * Returns true if dirty, update or history store content exceeds
+     * 'snapshotHistoryCachePressureThreshold' percent of the WiredTiger cache, meaning that
+     * retaining more snapshot history risks tipping eviction into stalling application threads.
+     */
+    bool _isSnapshotHistoryCacheUnderPressure();
+
     /**
      * Checks whether rollback to a timestamp can occur, enforcing a contract of use between the
      * storage engine and replication.
@@ -498,6 +515,14 @@ private:
     AtomicWord<std::uint64_t> _oldestTimestamp;
     AtomicWord<std::uint64_t> _stableTimestamp;
 
+    // Current size of the adaptively tuned snapshot history window. Negative until the first
+    // adjustment; only meaningful while maxSnapshotHistoryWindowInSeconds exceeds the minimum.
+    AtomicWord<int> _adaptiveSnapshotWindowSeconds{-1};
+
+    // Stable timestamp seconds at which the adaptive snapshot history window was last adjusted.
+    // Limits cache statistics sampling to once per second of stable time.
+    AtomicWord<unsigned> _adaptiveSnapshotWindowLastAdjustmentSecs{0};
+
     // Timestamp of data at startup. Used internally to advise checkpointing and recovery to a
     // timestamp. Provided by replication layer because WT does not persist timestamps.
     AtomicWord<std::uint64_t> _initialDataTimestamp;
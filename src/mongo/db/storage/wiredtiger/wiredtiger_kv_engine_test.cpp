@@ -46,6 +46,7 @@
 #include "mongo/db/storage/checkpointer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/unittest/log_test.h"
 #include "mongo/unittest/temp_dir.h"
@@ -396,6 +397,22 @@ TEST_F(WiredTigerKVEngineTest, IdentDrop) {
     ASSERT(boost::filesystem::exists(renamedFilePath));
 }
 
+TEST_F(WiredTigerKVEngineTest, AdaptiveSnapshotHistoryWindowGrowsWithoutCachePressure) {
+    // This idle test engine cannot reach a pressure threshold of 99% of the cache, so every
+    // stable timestamp update that advances by at least a second grows the window by one second.
+    RAIIServerParameterControllerForTest minWindow{"minSnapshotHistoryWindowInSeconds", 0};
+    RAIIServerParameterControllerForTest maxWindow{"maxSnapshotHistoryWindowInSeconds", 100};
+    RAIIServerParameterControllerForTest threshold{"snapshotHistoryCachePressureThreshold", 99};
+
+    // The first adjustment grows the window from the zero-second minimum to one second.
+    _engine->setStableTimestamp(Timestamp(100, 1), false);
+    ASSERT_EQ(Timestamp(99, 1), _engine->getOldestTimestamp());
+
+    // The next adjustment grows the window to two seconds.
+    _engine->setStableTimestamp(Timestamp(200, 1), false);
+    ASSERT_EQ(Timestamp(198, 1), _engine->getOldestTimestamp());
+}
+
 TEST_F(WiredTigerKVEngineTest, TestBasicPinOldestTimestamp) {
     auto opCtxRaii = _makeOperationContext();
     const Timestamp initTs = Timestamp(1, 0);
@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_oplog_cache.h"
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
+
+namespace mongo {
+namespace {
+
+// Approximate per-entry bookkeeping overhead charged against the cache budget in addition to the
+// entry's data size.
+constexpr std::int64_t kPerEntryOverheadBytes = sizeof(RecordId) * 2 + sizeof(Record);
+
+}  // namespace
+
+WiredTigerOplogCache::WiredTigerOplogCache()
+    : _maxSizeBytes(static_cast<std::int64_t>(gWiredTigerOplogEntryCacheSizeMB.load()) * 1024 *
+                    1024) {}
+
+boost::optional<Record> WiredTigerOplogCache::lookupSuccessor(const RecordId& prevId,
+                                                              std::int64_t visibleTs) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _entriesByPredecessor.find(prevId);
+    if (it == _entriesByPredecessor.end() || it->second.id.getLong() > visibleTs) {
+        return boost::none;
+    }
+    // Copying the record only bumps a reference on the underlying owned buffer, so the returned
+    // record remains valid even if the entry is evicted right after the lookup.
+    return it->second;
+}
+
+void WiredTigerOplogCache::cacheSuccessor(const RecordId& prevId, const Record& successor) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto [it, inserted] = _entriesByPredecessor.try_emplace(prevId);
+    if (!inserted) {
+        // The successor link is immutable while the predecessor is visible, so another reader has
+        // already cached the same entry.
+        return;
+    }
+    it->second = {successor.id, successor.data.getOwned()};
+    _sizeBytes += successor.data.size() + kPerEntryOverheadBytes;
+
+    // Evict the oldest links once over budget. The map is ordered by predecessor RecordId, and
+    // oplog RecordIds increase with time, so evicting from the front drops the oldest entries
+    // first, ring-buffer style.
+    while (_sizeBytes > _maxSizeBytes && !_entriesByPredecessor.empty()) {
+        auto oldest = _entriesByPredecessor.begin();
+        _sizeBytes -= oldest->second.data.size() + kPerEntryOverheadBytes;
+        _entriesByPredecessor.erase(oldest);
+    }
+}
+
+void WiredTigerOplogCache::invalidateAll() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entriesByPredecessor.clear();
+    _sizeBytes = 0;
+}
+
+}  // namespace mongo
@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include <boost/optional.hpp>
+
+#include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+/**
+ * A bounded in-memory cache of recent oplog entries shared by all forward-scanning oplog cursors
+ * of a WiredTigerRecordStore. With many tailing cursors (e.g. change streams) each reader
+ * otherwise decompresses the same WiredTiger pages to re-read the same entries; the cache turns
+ * that fan-out into memory reads.
+ *
+ * The cache maps the RecordId of an oplog entry to an owned copy of the entry that immediately
+ * follows it, as observed by a reader below the oplog visibility point. The region of the oplog
+ * behind the visibility point is immutable except for truncation, so a cached successor link is
+ * valid for any snapshot that can see the predecessor: entries are never updated, holes behind
+ * the visibility point can never be filled, and truncation of the oplog head removes a prefix,
+ * which cannot remove a successor while its predecessor remains visible. Truncation of the oplog
+ * tail during rollback does break links, so the record store invalidates the cache whenever it
+ * truncates.
+ *
+ * The cache is populated by cursor reads that went through the storage engine and evicts its
+ * oldest links once it exceeds the size configured by the 'wiredTigerOplogEntryCacheSizeMB'
+ * server parameter. All methods are thread safe.
+ */
+class WiredTigerOplogCache {
+public:
+    WiredTigerOplogCache();
+
+    /**
+     * Returns an owned copy of the entry immediately following 'prevId' if it is cached and its
+     * timestamp does not exceed 'visibleTs', and boost::none otherwise.
+     */
+    boost::optional<Record> lookupSuccessor(const RecordId& prevId, std::int64_t visibleTs);
+
+    /**
+     * Records that 'successor' is the entry immediately following 'prevId'. The successor's data
+     * is copied, so the caller's buffer need not outlive the call.
+     */
+    void cacheSuccessor(const RecordId& prevId, const Record& successor);
+
+    /**
+     * Drops all cached entries. Must be called whenever oplog entries are truncated.
+     */
+    void invalidateAll();
+
+private:
+    const std::int64_t _maxSizeBytes;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerOplogCache::_mutex");
+    std::map<RecordId, Record> _entriesByPredecessor;
+    std::int64_t _sizeBytes = 0;
+};
+
+}  // namespace mongo
@@ -77,9 +77,11 @@ void WiredTigerOplogManager::startVisibilityThread(OperationContext* opCtx,
     // Need to obtain the mutex before starting the thread, as otherwise it may race ahead
     // see _shuttingDown as true and quit prematurely.
     stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
+    _sessionCache = WiredTigerRecoveryUnit::get(opCtx)->getSessionCache();
+    _oplogRecordStore = oplogRecordStore;
     _oplogVisibilityThread = stdx::thread(&WiredTigerOplogManager::_updateOplogVisibilityLoop,
                                           this,
-                                          WiredTigerRecoveryUnit::get(opCtx)->getSessionCache(),
+                                          _sessionCache,
                                           oplogRecordStore);
 
     _isRunning = true;
@@ -111,11 +113,47 @@ void WiredTigerOplogManager::haltVisibilityThread() {
 }
 
 void WiredTigerOplogManager::triggerOplogVisibilityUpdate() {
+    WiredTigerRecordStore* oplogRecordStore = nullptr;
+    {
+        stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
+        if (_isRunning && !_shuttingDown &&
+            !MONGO_unlikely(WTPauseOplogVisibilityUpdateLoop.shouldFail()) &&
+            (_opsWaitingForOplogVisibilityUpdate || _oplogRecordStore->haveCappedWaiters())) {
+            // Callers are already waiting on oplog visibility, so rather than paying the wakeup
+            // and batching latency of the visibility thread, publish the new all_durable
+            // timestamp inline: this commit may have just filled the last hole.
+            oplogRecordStore = _oplogRecordStore;
+        } else if (!_triggerOplogVisibilityUpdate) {
+            _triggerOplogVisibilityUpdate = true;
+            _oplogVisibilityThreadCV.notify_one();
+        }
+    }
+
+    if (!oplogRecordStore) {
+        return;
+    }
+
+    // Query the all_durable timestamp outside of the mutex, like the visibility thread does. The
+    // timestamp is maintained by WiredTiger and guaranteed not to have any holes behind it
+    // in-memory.
+    const uint64_t newTimestamp = _sessionCache->getKVEngine()->getAllDurableTimestamp().asULL();
+
     stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
-    if (!_triggerOplogVisibilityUpdate) {
-        _triggerOplogVisibilityUpdate = true;
-        _oplogVisibilityThreadCV.notify_one();
+    // Holding the mutex keeps haltVisibilityThread() from completing, so the record store cannot
+    // be destroyed underneath us; re-check the state now that the mutex has been reacquired.
+    if (!_isRunning || _shuttingDown) {
+        return;
     }
+
+    // The timestamp may go backward during secondary batch application, where data file changes
+    // are committed separately from oplog changes; never publish a regression.
+    if (newTimestamp <= getOplogReadTimestamp()) {
+        return;
+    }
+    _setOplogReadTimestamp(lk, newTimestamp);
+
+    // Wake up any awaitData cursors and tell them more data might be visible now.
+    oplogRecordStore->notifyCappedWaitersIfNeeded();
 }
 
 void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
@@ -75,7 +75,13 @@ public:
     }
 
     /**
-     * Signals the oplog visibility thread to update the oplog read timestamp.
+     * Updates the oplog read timestamp in response to a completed oplog write.
+     *
+     * When callers are already waiting on visibility -- operations blocked in
+     * waitForAllEarlierOplogWritesToBeVisible() or tailing oplog cursors -- the new all_durable
+     * timestamp is queried and published inline, so visibility advances as soon as the last hole
+     * is filled rather than after a wakeup of the visibility thread. Otherwise the visibility
+     * thread is signaled, which batches updates to reduce system load.
      */
     void triggerOplogVisibilityUpdate();
 
@@ -132,5 +138,10 @@ private:
     // Incremented when a caller is waiting for more of the oplog to become visible, to avoid update
     // delays for batching.
     int64_t _opsWaitingForOplogVisibilityUpdate = 0;
+
+    // Set by startVisibilityThread() and only valid while _isRunning. Allows
+    // triggerOplogVisibilityUpdate() to advance visibility inline on the committing thread.
+    WiredTigerSessionCache* _sessionCache = nullptr;
+    WiredTigerRecordStore* _oplogRecordStore = nullptr;
 };
 }  // namespace mongo
@@ -34,12 +34,15 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <fmt/format.h>
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 
 #include <memory>
 
+#include <third_party/murmurhash3/MurmurHash3.h>
+
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/util/builder.h"
@@ -55,11 +58,14 @@
 #include "mongo/db/server_recovery.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/oplog_stone_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor_helpers.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_oplog_cache.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store_oplog_stones.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
@@ -83,6 +89,18 @@ using std::unique_ptr;
 
 namespace {
 
+/**
+ * Computes the contribution of a single record to the collection content checksum. Contributions
+ * are combined with wrapping 64-bit addition, so the collection checksum is independent of the
+ * order in which records are written and a record's contribution can be removed again by
+ * subtracting it.
+ */
+uint64_t computeRecordChecksum(const RecordId& id, const char* data, int len) {
+    uint64_t hash[2];
+    MurmurHash3_x64_128(data, len, static_cast<uint32_t>(id.hash()), hash);
+    return hash[0];
+}
+
 struct RecordIdAndWall {
     RecordId id;
     Date_t wall;
@@ -195,7 +213,7 @@ private:
 };
 
 WiredTigerRecordStore::OplogStones::OplogStones(OperationContext* opCtx, WiredTigerRecordStore* rs)
-    : _rs(rs) {
+    : _rs(rs), _boundariesKey(rs->getURI() + "#oplogStones") {
     stdx::lock_guard<Latch> reclaimLk(_oplogReclaimMutex);
     stdx::lock_guard<Latch> lk(_mutex);
 
@@ -219,6 +237,9 @@ WiredTigerRecordStore::OplogStones::OplogStones(OperationContext* opCtx, WiredTi
     invariant(_minBytesPerStone > 0);
 
     _calculateStones(opCtx, numStonesToKeep);
+    // Persist the initial boundaries so the next startup can restore them instead of scanning or
+    // sampling the oplog again.
+    _persistBoundaries_inlock();
     _pokeReclaimThreadIfNeeded();  // Reclaim stones if over the limit.
 }
 
@@ -309,6 +330,7 @@ WiredTigerRecordStore::OplogStones::peekOldestStoneIfNeeded() const {
 void WiredTigerRecordStore::OplogStones::popOldestStone() {
     stdx::lock_guard<Latch> lk(_mutex);
     _stones.pop_front();
+    _persistBoundaries_inlock();
 }
 
 void WiredTigerRecordStore::OplogStones::createNewStoneIfNeeded(OperationContext* opCtx,
@@ -348,8 +370,36 @@ void WiredTigerRecordStore::OplogStones::createNewStoneIfNeeded(OperationContext
         return;
     }
 
-    OplogStones::Stone stone(_currentRecords.swap(0), _currentBytes.swap(0), lastRecord, wallTime);
+    // Close out the UUID tracking state for the stone being filled. The stone's contents are only
+    // known if every record since the previous close was registered (false until the first close
+    // after startup) and no registered command or transaction entry may fall at or below the
+    // boundary. Tracked UUIDs whose highest registered RecordId lies beyond 'lastRecord' are
+    // carried over, since a racing insert may have registered an entry that belongs to the next
+    // stone.
+    boost::optional<stdx::unordered_set<UUID, UUID::Hash>> trackedUuids;
+    if (_currentStoneInfoComplete &&
+        (_minUncategorizedRecordId.isNull() || _minUncategorizedRecordId > lastRecord)) {
+        trackedUuids.emplace();
+        for (const auto& [uuid, maxRecordId] : _currentStoneUuids) {
+            trackedUuids->insert(uuid);
+        }
+    }
+    _currentStoneInfoComplete = true;
+    for (auto it = _currentStoneUuids.begin(); it != _currentStoneUuids.end();) {
+        it = it->second > lastRecord ? std::next(it) : _currentStoneUuids.erase(it);
+    }
+    if (!_maxUncategorizedRecordId.isNull() && _maxUncategorizedRecordId <= lastRecord) {
+        _minUncategorizedRecordId = RecordId();
+        _maxUncategorizedRecordId = RecordId();
+    }
+
+    OplogStones::Stone stone(_currentRecords.swap(0),
+                             _currentBytes.swap(0),
+                             lastRecord,
+                             wallTime,
+                             std::move(trackedUuids));
     _stones.push_back(stone);
+    _persistBoundaries_inlock();
 
     LOGV2_DEBUG(22381,
                 2,
@@ -366,8 +416,113 @@ void WiredTigerRecordStore::OplogStones::updateCurrentStoneAfterInsertOnCommit(
     int64_t bytesInserted,
     const Record& highestInsertedRecord,
     int64_t countInserted) {
-    opCtx->recoveryUnit()->registerChange(std::make_unique<InsertChange>(
-        this, bytesInserted, highestInsertedRecord, countInserted, opCtx));
+    opCtx->recoveryUnit()->emplaceChange<InsertChange>(
+        this, bytesInserted, highestInsertedRecord, countInserted, opCtx);
+}
+
+namespace {
+
+enum class OplogEntryAttribution { kIgnored, kTracked, kUncategorized };
+
+/**
+ * Classifies an oplog entry for per-stone UUID tracking. CRUD and internal entries that carry a
+ * collection UUID ('ui') are attributed to it. Command entries are never attributed to their own
+ * UUID, because they can affect change streams on other collections (e.g. a rename invalidates a
+ * stream on its destination namespace, and transaction control entries apply to every collection
+ * written within the transaction). Plain noop entries with neither a 'ui' nor an 'o2' field, such
+ * as those of the periodic noop writer, can never match a change stream and are ignored.
+ */
+OplogEntryAttribution attributeOplogEntry(const Record& record, boost::optional<UUID>* uuid) {
+    BSONObj obj = record.data.toBson();
+    if (auto uiElem = obj["ui"]) {
+        auto swUuid = UUID::parse(uiElem);
+        if (swUuid.isOK()) {
+            *uuid = swUuid.getValue();
+        }
+    }
+    StringData op = obj["op"].valueStringDataSafe();
+    if (op == "c") {
+        return OplogEntryAttribution::kUncategorized;
+    }
+    if (op == "n" && !*uuid) {
+        return obj.hasField("o2") ? OplogEntryAttribution::kUncategorized
+                                  : OplogEntryAttribution::kIgnored;
+    }
+    return *uuid ? OplogEntryAttribution::kTracked : OplogEntryAttribution::kUncategorized;
+}
+
+}  // namespace
+
+void WiredTigerRecordStore::OplogStones::registerInsertedRecords(const Record* records,
+                                                                 size_t nRecords) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    for (size_t i = 0; i < nRecords; i++) {
+        const auto& record = records[i];
+        boost::optional<UUID> uuid;
+        auto attribution = attributeOplogEntry(record, &uuid);
+        if (attribution == OplogEntryAttribution::kIgnored) {
+            continue;
+        }
+
+        if (!_stones.empty() && record.id <= _stones.back().lastRecord) {
+            // A stone closed past this record while the insert was in progress; attribute the
+            // entry directly to the stone that covers it.
+            auto it = std::lower_bound(
+                _stones.begin(),
+                _stones.end(),
+                record.id,
+                [](const Stone& stone, const RecordId& id) { return stone.lastRecord < id; });
+            invariant(it != _stones.end());
+            if (attribution == OplogEntryAttribution::kUncategorized) {
+                it->trackedUuids = boost::none;
+            } else if (it->trackedUuids) {
+                it->trackedUuids->insert(*uuid);
+            }
+            continue;
+        }
+
+        if (attribution == OplogEntryAttribution::kTracked) {
+            if (auto it = _currentStoneUuids.find(*uuid); it != _currentStoneUuids.end()) {
+                if (record.id > it->second) {
+                    it->second = record.id;
+                }
+                continue;
+            }
+            if (_currentStoneUuids.size() < kMaxTrackedUuidsPerStone) {
+                _currentStoneUuids.emplace(*uuid, record.id);
+                continue;
+            }
+            // Too many distinct collections in this stone; fall through and record the entry as
+            // uncategorized, which marks the stone's contents unknown when it closes.
+        }
+
+        if (_minUncategorizedRecordId.isNull() || record.id < _minUncategorizedRecordId) {
+            _minUncategorizedRecordId = record.id;
+        }
+        if (record.id > _maxUncategorizedRecordId) {
+            _maxUncategorizedRecordId = record.id;
+        }
+    }
+}
+
+boost::optional<Timestamp> WiredTigerRecordStore::OplogStones::nextRelevantTimestampForUuid(
+    const UUID& uuid, Timestamp fromTs, Timestamp visibilityTs) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    Timestamp skipTo = fromTs;
+    for (const auto& stone : _stones) {
+        Timestamp lastTs(static_cast<unsigned long long>(stone.lastRecord.getLong()));
+        if (lastTs < skipTo) {
+            // The stone lies entirely before the scan start.
+            continue;
+        }
+        if (lastTs > visibilityTs || !stone.trackedUuids || stone.trackedUuids->count(uuid)) {
+            break;
+        }
+        skipTo = Timestamp(lastTs.asULL() + 1);
+    }
+
+    return skipTo > fromTs ? boost::make_optional(skipTo) : boost::none;
 }
 
 void WiredTigerRecordStore::OplogStones::clearStonesOnCommit(OperationContext* opCtx) {
@@ -377,6 +532,11 @@ void WiredTigerRecordStore::OplogStones::clearStonesOnCommit(OperationContext* o
 
         stdx::lock_guard<Latch> lk(_mutex);
         _stones.clear();
+        _currentStoneUuids.clear();
+        _minUncategorizedRecordId = RecordId();
+        _maxUncategorizedRecordId = RecordId();
+        _currentStoneInfoComplete = false;
+        _persistBoundaries_inlock();
     });
 }
 
@@ -407,6 +567,16 @@ void WiredTigerRecordStore::OplogStones::updateStonesAfterCappedTruncateAfter(
     // being filled.
     _currentRecords.addAndFetch(recordsInStonesToRemove - recordsRemoved);
     _currentBytes.addAndFetch(bytesInStonesToRemove - bytesRemoved);
+
+    // The surviving records of a partially truncated stone now belong to the stone being filled,
+    // but were registered into the stone that covered them, so the tracking for the current stone
+    // is no longer complete.
+    _currentStoneUuids.clear();
+    _minUncategorizedRecordId = RecordId();
+    _maxUncategorizedRecordId = RecordId();
+    _currentStoneInfoComplete = false;
+
+    _persistBoundaries_inlock();
 }
 
 void WiredTigerRecordStore::OplogStones::setMinBytesPerStone(int64_t size) {
@@ -448,6 +618,12 @@ void WiredTigerRecordStore::OplogStones::_calculateStones(OperationContext* opCt
         return;
     }
 
+    // Prefer restoring the boundaries persisted by the previous incarnation of this record store,
+    // which requires reading only a few kilobytes instead of scanning or sampling the oplog.
+    if (_tryRestorePersistedBoundaries(opCtx)) {
+        return;
+    }
+
     // Only use sampling to estimate where to place the oplog stones if the number of samples drawn
     // is less than 5% of the collection.
     const uint64_t kMinSampleRatioForRandCursor = 20;
@@ -620,6 +796,111 @@ void WiredTigerRecordStore::OplogStones::_calculateStonesBySampling(OperationCon
     _currentBytes.store(_rs->dataSize(opCtx) - estBytesPerStone * wholeStones);
 }
 
+bool WiredTigerRecordStore::OplogStones::_tryRestorePersistedBoundaries(OperationContext* opCtx) {
+    if (!_rs->_sizeStorer) {
+        return false;
+    }
+
+    BSONObj doc = _rs->_sizeStorer->loadAux(opCtx, _boundariesKey);
+    if (doc.isEmpty() || doc["stones"].type() != Array) {
+        return false;
+    }
+
+    // The persisted boundaries are approximate: records may have been truncated from the front of
+    // the oplog or appended to the back since they were last flushed. Boundaries that fall outside
+    // the current oplog contents are discarded, and the partially filled chunk is recomputed from
+    // the size storer totals.
+    RecordId firstRecordId;
+    RecordId lastRecordId;
+    {
+        auto cursor = _rs->getCursor(opCtx, /*forward=*/true);
+        auto record = cursor->next();
+        if (!record) {
+            return false;
+        }
+        firstRecordId = record->id;
+    }
+    {
+        auto cursor = _rs->getCursor(opCtx, /*forward=*/false);
+        auto record = cursor->next();
+        if (!record) {
+            return false;
+        }
+        lastRecordId = record->id;
+    }
+
+    std::deque<Stone> stones;
+    int64_t recordsInStones = 0;
+    int64_t bytesInStones = 0;
+    for (auto&& elem : doc["stones"].Obj()) {
+        if (elem.type() != Object) {
+            return false;
+        }
+        BSONObj stoneDoc = elem.Obj();
+        const int64_t records = stoneDoc["records"].safeNumberLong();
+        const int64_t bytes = stoneDoc["bytes"].safeNumberLong();
+        if (records <= 0 || bytes <= 0 || !stoneDoc["lastRecord"].isNumber() ||
+            stoneDoc["wall"].type() != Date) {
+            return false;
+        }
+        RecordId lastRecord(stoneDoc["lastRecord"].safeNumberLong());
+        if (lastRecord < firstRecordId || lastRecord > lastRecordId) {
+            // This chunk of the oplog has been truncated away (or removed by rollback) since the
+            // boundaries were flushed.
+            continue;
+        }
+        if (!stones.empty() && lastRecord <= stones.back().lastRecord) {
+            return false;
+        }
+        stones.emplace_back(records, bytes, lastRecord, stoneDoc["wall"].Date());
+        recordsInStones += records;
+        bytesInStones += bytes;
+    }
+    if (stones.empty()) {
+        return false;
+    }
+
+    const long long numRecords = _rs->numRecords(opCtx);
+    const long long dataSize = _rs->dataSize(opCtx);
+    if (recordsInStones > numRecords || bytesInStones > dataSize) {
+        // The boundaries account for more data than the size storer believes the oplog holds;
+        // don't trust them.
+        return false;
+    }
+
+    _stones = std::move(stones);
+    _currentRecords.store(numRecords - recordsInStones);
+    _currentBytes.store(dataSize - bytesInStones);
+    _restoredFromPersistedBoundaries.store(true);
+
+    LOGV2(6650015,
+          "Restored oplog truncation markers from persisted boundaries",
+          "numStones"_attr = _stones.size(),
+          "recordsInStones"_attr = recordsInStones,
+          "bytesInStones"_attr = bytesInStones);
+    return true;
+}
+
+void WiredTigerRecordStore::OplogStones::_persistBoundaries_inlock() {
+    auto* sizeStorer = _rs->_sizeStorer;
+    if (!sizeStorer) {
+        return;
+    }
+
+    BSONObjBuilder doc;
+    {
+        BSONArrayBuilder stonesBuilder(doc.subarrayStart("stones"));
+        for (auto&& stone : _stones) {
+            BSONObjBuilder stoneBuilder(stonesBuilder.subobjStart());
+            stoneBuilder.append("records", stone.records);
+            stoneBuilder.append("bytes", stone.bytes);
+            stoneBuilder.append("lastRecord", stone.lastRecord.getLong());
+            stoneBuilder.append("wall", stone.wallTime);
+        }
+    }
+    sizeStorer->storeAux(_boundariesKey, doc.obj());
+}
+
 void WiredTigerRecordStore::OplogStones::_pokeReclaimThreadIfNeeded() {
     if (hasExcessStones_inlock()) {
         _oplogReclaimCv.notify_one();
@@ -907,6 +1188,8 @@ WiredTigerRecordStore::WiredTigerRecordStore(WiredTigerKVEngine* kvEngine,
       _shuttingDown(false),
       _sizeStorer(params.sizeStorer),
       _tracksSizeAdjustments(params.tracksSizeAdjustments),
+      _tracksContentChecksum(gIncrementalValidateEnabled && params.tracksSizeAdjustments &&
+                             !_isOplog),
       _kvEngine(kvEngine) {
     invariant(getIdent().size() > 0);
 
@@ -948,6 +1231,10 @@ WiredTigerRecordStore::WiredTigerRecordStore(WiredTigerKVEngine* kvEngine,
         // may change during replication recovery (if truncated).
         sizeRecoveryState(getGlobalServiceContext())
             .markCollectionAsAlwaysNeedsSizeAdjustment(getIdent());
+
+        if (gWiredTigerOplogEntryCacheSizeMB.load() > 0) {
+            _oplogCache = std::make_unique<WiredTigerOplogCache>();
+        }
     }
 
     // If no SizeStorer is in use, start counting at zero. In practice, this will only ever be the
@@ -1055,7 +1342,8 @@ bool WiredTigerRecordStore::inShutdown() const {
 }
 
 long long WiredTigerRecordStore::dataSize(OperationContext* opCtx) const {
-    return _sizeInfo->dataSize.load();
+    auto dataSize = _sizeInfo->dataSize.load();
+    return dataSize > 0 ? dataSize : 0;
 }
 
 long long WiredTigerRecordStore::numRecords(OperationContext* opCtx) const {
@@ -1155,6 +1443,10 @@ void WiredTigerRecordStore::doDeleteRecord(OperationContext* opCtx, const Record
 
     int64_t old_length = old_value.size;
 
+    uint64_t checksumRemoved = _tracksContentChecksum
+        ? computeRecordChecksum(id, static_cast<const char*>(old_value.data), old_value.size)
+        : 0;
+
     ret = WT_OP_CHECK(wiredTigerCursorRemove(opCtx, c));
     invariantWTOK(ret, c->session);
 
@@ -1163,6 +1455,7 @@ void WiredTigerRecordStore::doDeleteRecord(OperationContext* opCtx, const Record
 
     _changeNumRecords(opCtx, -1);
     _increaseDataSize(opCtx, -old_length);
+    _changeDataChecksum(opCtx, -checksumRemoved);
 }
 
 Timestamp WiredTigerRecordStore::getPinnedOplog() const {
@@ -1292,6 +1585,10 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
 
             wuow.commit();
 
+            if (_oplogCache) {
+                _oplogCache->invalidateAll();
+            }
+
             // Remove the stone after a successful truncation.
             _oplogStones->popOldestStone();
 
@@ -1340,6 +1637,7 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
     invariant(c);
 
     Record highestIdRecord;
+    uint64_t checksumAdded = 0;
     invariant(nRecords != 0);
 
     if (_keyFormat == KeyFormat::Long) {
@@ -1427,12 +1725,22 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
             auto keyLength = computeRecordIdSize(record.id);
             metricsCollector.incrementOneDocWritten(value.size + keyLength);
         }
+
+        if (_tracksContentChecksum) {
+            checksumAdded +=
+                computeRecordChecksum(record.id, record.data.data(), record.data.size());
+        }
     }
 
     _changeNumRecords(opCtx, nRecords);
     _increaseDataSize(opCtx, totalLength);
+    _changeDataChecksum(opCtx, checksumAdded);
 
     if (_oplogStones) {
+        // Register before commit: a rollback merely leaves a harmless false positive in the
+        // per-stone UUID tracking, whereas an entry that became visible without having been
+        // registered could cause getOplogResumeSkipPoint() to skip a committed event.
+        _oplogStones->registerInsertedRecords(records, nRecords);
         _oplogStones->updateCurrentStoneAfterInsertOnCommit(
             opCtx, totalLength, highestIdRecord, nRecords);
     }
@@ -1511,6 +1819,31 @@ StatusWith<Timestamp> WiredTigerRecordStore::getEarliestOplogTimestamp(Operation
     return {Timestamp(static_cast<unsigned long long>(_oplogFirstRecord.getLong()))};
 }
 
+boost::optional<Timestamp> WiredTigerRecordStore::getOplogResumeSkipPoint(OperationContext* opCtx,
+                                                                          const UUID& uuid,
+                                                                          Timestamp fromTs) {
+    if (!_isOplog || !_oplogStones) {
+        return boost::none;
+    }
+
+    // If 'fromTs' has already fallen off the oplog, the caller must discover that through the
+    // usual scan error path; skipping forward would silently mask the lost history.
+    auto earliestTs = getEarliestOplogTimestamp(opCtx);
+    if (!earliestTs.isOK() || fromTs < earliestTs.getValue()) {
+        return boost::none;
+    }
+
+    // Entries above the oplog visibility point may still be uncommitted and unregistered, so the
+    // per-stone tracking is only authoritative at or below it.
+    auto oplogManager = _kvEngine->getOplogManager();
+    if (!oplogManager->isRunning()) {
+        return boost::none;
+    }
+    Timestamp visibilityTs(oplogManager->getOplogReadTimestamp());
+
+    return _oplogStones->nextRelevantTimestampForUuid(uuid, fromTs, visibilityTs);
+}
+
 Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
                                              const RecordId& id,
                                              const char* data,
@@ -1549,6 +1882,13 @@ Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
         return {ErrorCodes::IllegalOperation, "Cannot change the size of a document in the oplog"};
     }
 
+    // Compute the checksum delta up front: 'old_value' points into the cursor's buffer, which may
+    // be repositioned by the update below.
+    uint64_t checksumDelta = _tracksContentChecksum
+        ? computeRecordChecksum(id, data, len) -
+            computeRecordChecksum(id, static_cast<const char*>(old_value.data), old_value.size)
+        : 0;
+
     WiredTigerItem value(data, len);
 
     // Check if we should modify rather than doing a full update.  Look for deltas for documents
@@ -1606,6 +1946,7 @@ Status WiredTigerRecordStore::doUpdateRecord(OperationContext* opCtx,
     invariantWTOK(ret, c->session);
 
     _increaseDataSize(opCtx, len - old_length);
+    _changeDataChecksum(opCtx, checksumDelta);
     return Status::OK();
 }
 
@@ -1658,6 +1999,13 @@ StatusWith<RecordData> WiredTigerRecordStore::doUpdateWithDamages(
     WT_ITEM value;
     invariantWTOK(c->get_value(c, &value), c->session);
 
+    if (_tracksContentChecksum) {
+        _changeDataChecksum(
+            opCtx,
+            computeRecordChecksum(id, static_cast<const char*>(value.data), value.size) -
+                computeRecordChecksum(id, oldRec.data(), oldRec.size()));
+    }
+
     return RecordData(static_cast<const char*>(value.data), value.size).getOwned();
 }
 
@@ -1748,6 +2096,7 @@ Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
                   session);
     _changeNumRecords(opCtx, -numRecords(opCtx));
     _increaseDataSize(opCtx, -dataSize(opCtx));
+    _changeDataChecksum(opCtx, -static_cast<uint64_t>(_sizeInfo->dataChecksum.load()));
 
     if (_oplogStones) {
         _oplogStones->clearStonesOnCommit(opCtx);
@@ -1756,6 +2105,58 @@ Status WiredTigerRecordStore::doTruncate(OperationContext* opCtx) {
     return Status::OK();
 }
 
+Status WiredTigerRecordStore::doRangeTruncate(OperationContext* opCtx,
+                                              const RecordId& minRecordId,
+                                              const RecordId& maxRecordId,
+                                              int64_t hintDataSizeDiff,
+                                              int64_t hintNumRecordsDiff) {
+    WiredTigerCursor startWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* start = startWrap.get();
+    int ret = wiredTigerPrepareConflictRetry(opCtx, [&] { return start->next(start); });
+    // Empty collections don't have anything to truncate.
+    if (ret == WT_NOTFOUND) {
+        return Status::OK();
+    }
+    invariantWTOK(ret, start->session);
+    // Reset the cursor before repositioning it to the start of the range.
+    invariantWTOK(start->reset(start), start->session);
+
+    boost::optional<CursorKey> startKey;
+    if (minRecordId != RecordId()) {
+        startKey = makeCursorKey(minRecordId, _keyFormat);
+        setKey(start, &(*startKey));
+    } else {
+        start = nullptr;
+    }
+
+    WiredTigerCursor finishWrap(_uri, _tableId, true, opCtx);
+    WT_CURSOR* finish = finishWrap.get();
+    boost::optional<CursorKey> finishKey;
+    if (maxRecordId != RecordId()) {
+        finishKey = makeCursorKey(maxRecordId, _keyFormat);
+        setKey(finish, &(*finishKey));
+    } else {
+        finish = nullptr;
+    }
+
+    WT_SESSION* session = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
+    invariantWTOK(WT_OP_CHECK(session->truncate(session, nullptr, start, finish, nullptr)),
+                  session);
+    _changeNumRecords(opCtx, hintNumRecordsDiff);
+    _increaseDataSize(opCtx, hintDataSizeDiff);
+
+    // The truncate discarded records without visiting them, so the content checksum no longer
+    // reflects what is on disk and any previously recorded clean-validation baseline cannot be
+    // trusted.
+    if (_tracksContentChecksum) {
+        _sizeInfo->hasCleanValidateChecksum.store(false);
+        if (_sizeStorer)
+            _sizeStorer->store(_uri, _sizeInfo);
+    }
+
+    return Status::OK();
+}
+
 Status WiredTigerRecordStore::doCompact(OperationContext* opCtx) {
     dassert(opCtx->lockState()->isWriteLocked());
 
@@ -1897,11 +2298,41 @@ void WiredTigerRecordStore::updateStatsAfterRepair(OperationContext* opCtx,
     _sizeInfo->numRecords.store(std::max(numRecords, 0ll));
     _sizeInfo->dataSize.store(std::max(dataSize, 0ll));
 
+    // Repair may have discarded records without adjusting the content checksum, so a previously
+    // recorded clean-validation baseline can no longer be trusted.
+    _sizeInfo->hasCleanValidateChecksum.store(false);
+
     // If we have a WiredTigerSizeStorer, but our size info is not currently cached, add it.
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
 }
 
+boost::optional<long long> WiredTigerRecordStore::dataChecksum() const {
+    if (!_tracksContentChecksum) {
+        return boost::none;
+    }
+    return _sizeInfo->dataChecksum.load();
+}
+
+boost::optional<long long> WiredTigerRecordStore::lastCleanValidateChecksum() const {
+    if (!_tracksContentChecksum || !_sizeInfo->hasCleanValidateChecksum.load()) {
+        return boost::none;
+    }
+    return _sizeInfo->cleanValidateChecksum.load();
+}
+
+void WiredTigerRecordStore::recordCleanValidation() {
+    if (!_tracksContentChecksum) {
+        return;
+    }
+
+    _sizeInfo->cleanValidateChecksum.store(_sizeInfo->dataChecksum.load());
+    _sizeInfo->hasCleanValidateChecksum.store(true);
+
+    if (_sizeStorer)
+        _sizeStorer->store(_uri, _sizeInfo);
+}
+
 void WiredTigerRecordStore::_initNextIdIfNeeded(OperationContext* opCtx) {
     // Clustered record stores do not generate unique ObjectId's for RecordId's as the expectation
     // is for the caller to set the RecordId using the server generated ObjectId.
@@ -1990,9 +2421,9 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
     opCtx->recoveryUnit()->onRollback([this, diff]() {
         LOGV2_DEBUG(
             22404, 3, "WiredTigerRecordStore: rolling back NumRecordsChange", "diff"_attr = -diff);
-        _sizeInfo->numRecords.addAndFetch(-diff);
+        _sizeInfo->numRecords.add(-diff);
     });
-    _sizeInfo->numRecords.addAndFetch(diff);
+    _sizeInfo->numRecords.add(diff);
 }
 
 void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t amount) {
@@ -2008,8 +2439,30 @@ void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t a
         opCtx->recoveryUnit()->onRollback(
             [this, amount]() { _increaseDataSize(nullptr, -amount); });
 
-    if (_sizeInfo->dataSize.fetchAndAdd(amount) < 0)
-        _sizeInfo->dataSize.store(std::max(amount, int64_t(0)));
+    // Negative totals from unclean shutdowns are clamped on read rather than repaired here, as
+    // observing the running total would reintroduce the cross-writer cache line contention the
+    // striped counter exists to avoid.
+    _sizeInfo->dataSize.add(amount);
+
+    if (_sizeStorer)
+        _sizeStorer->store(_uri, _sizeInfo);
+}
+
+void WiredTigerRecordStore::_changeDataChecksum(OperationContext* opCtx, uint64_t delta) {
+    if (!_tracksContentChecksum || delta == 0) {
+        return;
+    }
+
+    if (!sizeRecoveryState(getGlobalServiceContext()).collectionNeedsSizeAdjustment(getIdent())) {
+        return;
+    }
+
+    // All arithmetic on the checksum is wrapping 64-bit addition, so rolling back is a matter of
+    // adding the negated delta.
+    opCtx->recoveryUnit()->onRollback([this, delta]() {
+        _sizeInfo->dataChecksum.fetchAndAdd(static_cast<long long>(-delta));
+    });
+    _sizeInfo->dataChecksum.fetchAndAdd(static_cast<long long>(delta));
 
     if (_sizeStorer)
         _sizeStorer->store(_uri, _sizeInfo);
@@ -2051,6 +2504,7 @@ void WiredTigerRecordStore::doCappedTruncateAfter(OperationContext* opCtx,
 
     int64_t recordsRemoved = 0;
     int64_t bytesRemoved = 0;
+    uint64_t checksumRemoved = 0;
     RecordId lastKeptId;
     RecordId firstRemovedId;
 
@@ -2081,6 +2535,10 @@ void WiredTigerRecordStore::doCappedTruncateAfter(OperationContext* opCtx,
             }
             recordsRemoved++;
             bytesRemoved += record->data.size();
+            if (_tracksContentChecksum) {
+                checksumRemoved +=
+                    computeRecordChecksum(record->id, record->data.data(), record->data.size());
+            }
         } while ((record = cursor->next()));
     }
 
@@ -2098,10 +2556,18 @@ void WiredTigerRecordStore::doCappedTruncateAfter(OperationContext* opCtx,
 
     _changeNumRecords(opCtx, -recordsRemoved);
     _increaseDataSize(opCtx, -bytesRemoved);
+    _changeDataChecksum(opCtx, -checksumRemoved);
 
     wuow.commit();
 
     if (_isOplog) {
+        // Rollback truncates the oplog tail, which breaks the successor links held by the oplog
+        // entry cache: entries written after recovery may have timestamps below those of the
+        // removed entries.
+        if (_oplogCache) {
+            _oplogCache->invalidateAll();
+        }
+
         // Immediately rewind visibility to our truncation point, to prevent new
         // transactions from appearing.
         Timestamp truncTs(lastKeptId.getLong());
@@ -2179,6 +2645,31 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
 
     RecordId id;
     if (!_skipNextAdvance) {
+        // Forward-scanning oplog cursors first consult the in-memory oplog entry cache; with many
+        // tailing cursors this avoids re-reading (and decompressing) the same storage pages for
+        // every reader. Entries below the visibility point are immutable, so a cached successor
+        // link is valid for any snapshot that can see the predecessor.
+        if (_forward && _oplogVisibleTs && !_readTimestampForOplog && !_lastReturnedId.isNull()) {
+            if (auto* oplogCache = _rs.oplogCache()) {
+                if (auto cached = oplogCache->lookupSuccessor(_lastReturnedId, *_oplogVisibleTs)) {
+                    auto& metricsCollector = ResourceConsumption::MetricsCollector::get(_opCtx);
+                    auto keyLength = computeRecordIdSize(cached->id);
+                    metricsCollector.incrementOneDocRead(cached->data.size() + keyLength);
+
+                    _lastReturnedId = cached->id;
+                    // The storage cursor was not advanced and must be repositioned before the
+                    // next read that goes through it.
+                    _cursorNeedsReposition = true;
+                    return cached;
+                }
+            }
+        }
+
+        if (_cursorNeedsReposition) {
+            repositionOnLastReturned(c);
+            _cursorNeedsReposition = false;
+        }
+
         // Nothing after the next line can throw WCEs.
         // Note that an unpositioned (or eof) WT_CURSOR returns the first/last entry in the
         // table when you call next/prev.
@@ -2247,10 +2738,34 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::next() {
     auto keyLength = computeRecordIdSize(id);
     metricsCollector.incrementOneDocRead(value.size + keyLength);
 
+    // Let the oplog entry cache remember the record we just read as the successor of the record
+    // preceding it, so that other tailing cursors can serve it from memory.
+    if (_forward && _oplogVisibleTs && !_readTimestampForOplog && !_lastReturnedId.isNull()) {
+        if (auto* oplogCache = _rs.oplogCache()) {
+            oplogCache->cacheSuccessor(
+                _lastReturnedId,
+                {id, {static_cast<const char*>(value.data), static_cast<int>(value.size)}});
+        }
+    }
+
     _lastReturnedId = id;
     return {{std::move(id), {static_cast<const char*>(value.data), static_cast<int>(value.size)}}};
 }
 
+void WiredTigerRecordStoreCursorBase::repositionOnLastReturned(WT_CURSOR* c) {
+    // The record must exist in this cursor's snapshot: entries behind the oplog visibility point
+    // are only removed by truncating the oplog head, which cannot remove a record that this
+    // snapshot can still see us positioned on.
+    auto key = makeCursorKey(_lastReturnedId, _rs.keyFormat());
+    setKey(c, &key);
+    int seekRet = wiredTigerPrepareConflictRetry(_opCtx, [&] { return c->search(c); });
+    uassert(ErrorCodes::CappedPositionLost,
+            "Oplog cursor could not reposition on the last entry served from the oplog entry "
+            "cache",
+            seekRet != WT_NOTFOUND);
+    invariantWTOK(seekRet, c->session);
+}
+
 boost::optional<Record> WiredTigerRecordStoreCursorBase::seekExact(const RecordId& id) {
     invariant(_hasRestored);
     if (_readTimestampForOplog && id.getLong() > *_readTimestampForOplog) {
@@ -2269,6 +2784,7 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::seekExact(const RecordI
     WiredTigerRecoveryUnit::get(_opCtx)->getSession();
 
     _skipNextAdvance = false;
+    _cursorNeedsReposition = false;
     WT_CURSOR* c = _cursor->get();
     auto key = makeCursorKey(id, _rs.keyFormat());
     setKey(c, &key);
@@ -2309,6 +2825,7 @@ boost::optional<Record> WiredTigerRecordStoreCursorBase::seekNear(const RecordId
     }
 
     _skipNextAdvance = false;
+    _cursorNeedsReposition = false;
     WiredTigerRecoveryUnit::get(_opCtx)->getSession();
     WT_CURSOR* c = _cursor->get();
 
@@ -2416,6 +2933,7 @@ bool WiredTigerRecordStoreCursorBase::restore(bool tolerateCappedRepositioning)
     // This will ensure an active session exists, so any restored cursors will bind to it
     invariant(WiredTigerRecoveryUnit::get(_opCtx)->getSession() == _cursor->getSession());
     _skipNextAdvance = false;
+    _cursorNeedsReposition = false;
     _hasRestored = true;
 
     // If we've hit EOF, then this iterator is done and need not be restored.
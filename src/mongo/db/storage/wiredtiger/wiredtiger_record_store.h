@@ -64,6 +64,7 @@
 namespace mongo {
 
 class RecoveryUnit;
+class WiredTigerOplogCache;
 class WiredTigerSessionCache;
 class WiredTigerSizeStorer;
 
@@ -175,6 +176,11 @@ public:
     std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx) const final;
 
     Status doTruncate(OperationContext* opCtx) final;
+    Status doRangeTruncate(OperationContext* opCtx,
+                           const RecordId& minRecordId,
+                           const RecordId& maxRecordId,
+                           int64_t hintDataSizeDiff,
+                           int64_t hintNumRecordsDiff) final;
 
     virtual bool compactSupported() const {
         return !_isEphemeral;
@@ -205,6 +211,12 @@ public:
                                         long long numRecords,
                                         long long dataSize);
 
+    boost::optional<long long> dataChecksum() const override;
+
+    boost::optional<long long> lastCleanValidateChecksum() const override;
+
+    void recordCleanValidation() override;
+
 
     Status updateOplogSize(long long newOplogSize) final;
 
@@ -252,6 +264,9 @@ public:
 
     StatusWith<Timestamp> getLatestOplogTimestamp(OperationContext* opCtx) const override;
     StatusWith<Timestamp> getEarliestOplogTimestamp(OperationContext* opCtx) override;
+    boost::optional<Timestamp> getOplogResumeSkipPoint(OperationContext* opCtx,
+                                                       const UUID& uuid,
+                                                       Timestamp fromTs) override;
 
     /**
      * The `recoveryTimestamp` is when replication recovery would need to replay from for
@@ -271,6 +286,14 @@ public:
         return _oplogStones.get();
     };
 
+    /**
+     * Returns the in-memory cache of recent oplog entries, or nullptr if this record store does
+     * not underlie the oplog or the cache is disabled.
+     */
+    WiredTigerOplogCache* oplogCache() const {
+        return _oplogCache.get();
+    }
+
     typedef stdx::variant<int64_t, WiredTigerItem> CursorKey;
 
 protected:
@@ -323,6 +346,13 @@ private:
     void _changeNumRecords(OperationContext* opCtx, int64_t diff);
     void _increaseDataSize(OperationContext* opCtx, int64_t amount);
 
+    /**
+     * Folds the given per-record checksum delta into the content checksum, following the same
+     * SizeRecoveryState rules as the size metadata above. A no-op unless this record store tracks
+     * a content checksum.
+     */
+    void _changeDataChecksum(OperationContext* opCtx, uint64_t delta);
+
     const std::string _uri;
     const uint64_t _tableId;  // not persisted
 
@@ -359,11 +389,19 @@ private:
     WiredTigerSizeStorer* _sizeStorer;  // not owned, can be NULL
     std::shared_ptr<WiredTigerSizeStorer::SizeInfo> _sizeInfo;
     bool _tracksSizeAdjustments;
+    // True if this record store maintains an incremental content checksum alongside its size
+    // metadata. Fixed at startup; the oplog is excluded because it is never incrementally
+    // validated and hashing every oplog write would be wasted work.
+    const bool _tracksContentChecksum;
     WiredTigerKVEngine* _kvEngine;  // not owned.
 
     // Non-null if this record store is underlying the active oplog.
     std::shared_ptr<OplogStones> _oplogStones;
 
+    // Non-null if this record store is underlying the active oplog and the oplog entry cache is
+    // enabled. Invalidated whenever oplog entries are truncated.
+    std::unique_ptr<WiredTigerOplogCache> _oplogCache;
+
     AtomicWord<int64_t>
         _totalTimeTruncating;            // Cumulative amount of time spent truncating the oplog.
     AtomicWord<int64_t> _truncateCount;  // Cumulative number of truncates of the oplog.
@@ -429,11 +467,20 @@ protected:
     bool _eof = false;
     RecordId _lastReturnedId;  // If null, need to seek to first/last record.
     bool _hasRestored = true;
+    // True when records were served from the oplog entry cache without advancing the storage
+    // cursor, which must then be repositioned before the next read that goes through WiredTiger.
+    bool _cursorNeedsReposition = false;
 
 private:
     bool isVisible(const RecordId& id);
     void initOplogVisibility(OperationContext* opCtx);
 
+    /**
+     * Repositions the storage cursor on '_lastReturnedId' after one or more records were served
+     * from the oplog entry cache without advancing the storage cursor.
+     */
+    void repositionOnLastReturned(WT_CURSOR* c);
+
     /**
      * This value is used for visibility calculations on what oplog entries can be returned to a
      * client. This value *must* be initialized/updated *before* a WiredTiger snapshot is
@@ -35,6 +35,9 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/unordered_set.h"
+#include "mongo/util/uuid.h"
 
 namespace mongo {
 
@@ -51,8 +54,24 @@ public:
         RecordId lastRecord;  // RecordId of the last record in a chunk of the oplog.
         Date_t wallTime;      // Walltime of when this chunk of the oplog was created.
 
-        Stone(int64_t records, int64_t bytes, RecordId lastRecord, Date_t wallTime)
-            : records(records), bytes(bytes), lastRecord(lastRecord), wallTime(wallTime) {}
+        // The set of collection UUIDs whose entries appear in this chunk of the oplog, if known.
+        // boost::none means the chunk's contents are unknown (it was created by scanning, sampling
+        // or restoring boundaries at startup, or it contains command, transaction or internal
+        // entries that cannot be attributed to a single collection) and the chunk can never be
+        // skipped by nextRelevantTimestampForUuid(). The set may contain UUIDs with no entries in
+        // the chunk; it never misses one that has any.
+        boost::optional<stdx::unordered_set<UUID, UUID::Hash>> trackedUuids;
+
+        Stone(int64_t records,
+              int64_t bytes,
+              RecordId lastRecord,
+              Date_t wallTime,
+              boost::optional<stdx::unordered_set<UUID, UUID::Hash>> trackedUuids = boost::none)
+            : records(records),
+              bytes(bytes),
+              lastRecord(lastRecord),
+              wallTime(wallTime),
+              trackedUuids(std::move(trackedUuids)) {}
     };
 
     OplogStones(OperationContext* opCtx, WiredTigerRecordStore* rs);
@@ -67,7 +86,10 @@ public:
 
     void getOplogStonesStats(BSONObjBuilder& builder) const {
         builder.append("totalTimeProcessingMicros", _totalTimeProcessing.load());
-        builder.append("processingMethod", _processBySampling.load() ? "sampling" : "scanning");
+        builder.append("processingMethod",
+                       _restoredFromPersistedBoundaries.load()
+                           ? "restored"
+                           : (_processBySampling.load() ? "sampling" : "scanning"));
         if (auto oplogMinRetentionHours = storageGlobalParams.oplogMinRetentionHours.load()) {
             builder.append("oplogMinRetentionHours", oplogMinRetentionHours);
         }
@@ -84,6 +106,26 @@ public:
                                                const Record& highestInsertedRecord,
                                                int64_t countInserted);
 
+    /**
+     * Attributes the oplog entries in 'records' to their collection UUIDs for per-stone tracking.
+     * Must be called at insert time, before the inserting transaction commits: an entry registered
+     * by a transaction that later rolls back only leaves a harmless false positive, whereas an
+     * entry that became visible without having been registered could cause a committed event to be
+     * skipped.
+     */
+    void registerInsertedRecords(const Record* records, size_t nRecords);
+
+    /**
+     * Returns a timestamp T >= 'fromTs' such that no oplog entries in [fromTs, T) are relevant to
+     * a change stream on the collection identified by 'uuid', by skipping over whole stones whose
+     * tracked UUID sets prove them irrelevant. Only stones that lie entirely at or below
+     * 'visibilityTs' are skipped, since entries above the oplog visibility point may still be
+     * uncommitted and unregistered. Returns boost::none if nothing can be skipped.
+     */
+    boost::optional<Timestamp> nextRelevantTimestampForUuid(const UUID& uuid,
+                                                            Timestamp fromTs,
+                                                            Timestamp visibilityTs) const;
+
     void clearStonesOnCommit(OperationContext* opCtx);
 
     // Updates the metadata about the oplog stones after a rollback occurs.
@@ -130,12 +172,34 @@ private:
                                     int64_t estRecordsPerStone,
                                     int64_t estBytesPerStone);
 
+    /**
+     * Attempts to restore the stone boundaries persisted alongside the size storer metadata by a
+     * previous incarnation of this record store, so startup can avoid scanning or sampling the
+     * oplog. Returns false if no boundaries were persisted or they are implausible for the
+     * current oplog contents, in which case the caller falls back to scanning or sampling.
+     */
+    bool _tryRestorePersistedBoundaries(OperationContext* opCtx);
+
+    /**
+     * Buffers the current stone boundaries to be persisted with the next size storer flush.
+     */
+    void _persistBoundaries_inlock();
+
     void _pokeReclaimThreadIfNeeded();
 
     static const uint64_t kRandomSamplesPerStone = 10;
 
+    // Upper bound on the number of distinct collection UUIDs tracked for the stone currently being
+    // filled. A stone written to by more collections than this is recorded as having unknown
+    // contents; such a busy region would not be worth skipping anyway.
+    static const size_t kMaxTrackedUuidsPerStone = 2000;
+
     WiredTigerRecordStore* _rs;
 
+    // Key under which the stone boundaries are persisted in the size storer table. Derived from
+    // the record store's URI so it cannot collide with the keys used for size information.
+    const std::string _boundariesKey;
+
     Mutex _oplogReclaimMutex;
     stdx::condition_variable _oplogReclaimCv;
 
@@ -152,10 +216,31 @@ private:
     AtomicWord<int64_t> _totalTimeProcessing;  // Amount of time spent scanning and/or sampling the
                                                // oplog during start up, if any.
     AtomicWord<bool> _processBySampling;       // Whether the oplog was sampled or scanned.
+    AtomicWord<bool> _restoredFromPersistedBoundaries;  // Whether the stones were restored from
+                                                        // boundaries persisted by a previous
+                                                        // incarnation, skipping both.
 
     // Protects against concurrent access to the deque of oplog stones.
     mutable Mutex _mutex = MONGO_MAKE_LATCH("OplogStones::_mutex");
     std::deque<OplogStones::Stone> _stones;  // front = oldest, back = newest.
+
+    // UUID tracking state for the stone currently being filled, maintained by
+    // registerInsertedRecords() and folded into each stone as it closes. Maps each collection
+    // UUID to the highest RecordId registered for it, so that an entry whose RecordId lies beyond
+    // a closing stone's boundary can be carried over into the next stone. Protected by '_mutex'.
+    stdx::unordered_map<UUID, RecordId, UUID::Hash> _currentStoneUuids;
+
+    // RecordId range of registered entries that cannot be attributed to a single collection
+    // (command, transaction and untracked internal entries). Null when none are pending; while
+    // the minimum lies at or below a closing stone's boundary, that stone's contents are recorded
+    // as unknown. Protected by '_mutex'.
+    RecordId _minUncategorizedRecordId;
+    RecordId _maxUncategorizedRecordId;
+
+    // False until the first stone closes after startup. The partial region beyond the last
+    // startup stone may contain records that predate this process and were never registered, so
+    // the first stone to close must be recorded as having unknown contents. Protected by '_mutex'.
+    bool _currentStoneInfoComplete = false;
 };
 
 }  // namespace mongo
@@ -48,6 +48,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/barrier.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
@@ -443,6 +444,122 @@ TEST(WiredTigerRecordStoreTest, OplogStones_CreateNewStone) {
     }
 }
 
+BSONObj makeOplogEntryWithSize(const Timestamp& opTime,
+                               StringData op,
+                               const boost::optional<UUID>& uuid,
+                               int size) {
+    auto buildObj = [&](const std::string& str) {
+        BSONObjBuilder bob;
+        bob.append("ts", opTime);
+        bob.append("op", op);
+        if (uuid) {
+            uuid->appendToBuilder(&bob, "ui");
+        }
+        bob.append("str", str);
+        return bob.obj();
+    };
+
+    BSONObj objTemplate = buildObj("");
+    ASSERT_LTE(objTemplate.objsize(), size);
+    BSONObj obj = buildObj(std::string(size - objTemplate.objsize(), 'x'));
+    ASSERT_EQ(size, obj.objsize());
+
+    return obj;
+}
+
+StatusWith<RecordId> insertOplogEntry(OperationContext* opCtx, RecordStore* rs, const BSONObj& obj) {
+    Timestamp opTime = obj["ts"].timestamp();
+
+    WriteUnitOfWork wuow(opCtx);
+    WiredTigerRecordStore* wtrs = checked_cast<WiredTigerRecordStore*>(rs);
+    invariant(wtrs);
+    Status status = wtrs->oplogDiskLocRegister(opCtx, opTime, false);
+    if (!status.isOK()) {
+        return StatusWith<RecordId>(status);
+    }
+    StatusWith<RecordId> res = rs->insertRecord(opCtx, obj.objdata(), obj.objsize(), opTime);
+    if (res.isOK()) {
+        wuow.commit();
+    }
+    return res;
+}
+
+// Verify the per-stone UUID tracking used to skip irrelevant regions of the oplog when resuming a
+// change stream.
+TEST(WiredTigerRecordStoreTest, OplogStones_UuidSkipPoints) {
+    std::unique_ptr<RecordStoreHarnessHelper> harnessHelper = newRecordStoreHarnessHelper();
+    std::unique_ptr<RecordStore> rs(harnessHelper->newOplogRecordStore());
+
+    WiredTigerRecordStore* wtrs = static_cast<WiredTigerRecordStore*>(rs.get());
+    WiredTigerRecordStore::OplogStones* oplogStones = wtrs->oplogStones();
+
+    oplogStones->setMinBytesPerStone(100);
+
+    auto uuidA = UUID::gen();
+    auto uuidB = UUID::gen();
+
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+
+    auto insert = [&](const Timestamp& opTime, StringData op, const boost::optional<UUID>& uuid) {
+        ASSERT_OK(insertOplogEntry(
+                      opCtx.get(), rs.get(), makeOplogEntryWithSize(opTime, op, uuid, 50))
+                      .getStatus());
+    };
+
+    // The first stone to close covers records that could predate this process, so its contents are
+    // unknown and it can never be skipped.
+    insert(Timestamp(1, 1), "i", uuidA);
+    insert(Timestamp(1, 2), "i", uuidA);
+    ASSERT_EQ(1U, oplogStones->numStones());
+    ASSERT_FALSE(
+        oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 1), Timestamp::max()));
+
+    // The second stone contains only entries for uuidA and the third contains an entry for uuidB,
+    // so a scan for uuidB starting in the second stone may skip to the third.
+    insert(Timestamp(1, 3), "i", uuidA);
+    insert(Timestamp(1, 4), "i", uuidA);
+    insert(Timestamp(1, 5), "i", uuidB);
+    insert(Timestamp(1, 6), "i", uuidA);
+    ASSERT_EQ(3U, oplogStones->numStones());
+
+    auto skipTo =
+        oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 3), Timestamp::max());
+    ASSERT_TRUE(skipTo);
+    ASSERT_EQ(Timestamp(1, 5), *skipTo);
+    ASSERT_FALSE(
+        oplogStones->nextRelevantTimestampForUuid(uuidA, Timestamp(1, 3), Timestamp::max()));
+
+    // Skipping stops at the oplog visibility point: a stone that is not entirely at or below it
+    // may still receive entries from uncommitted transactions.
+    insert(Timestamp(1, 7), "i", uuidA);
+    insert(Timestamp(1, 8), "i", uuidA);
+    ASSERT_EQ(4U, oplogStones->numStones());
+
+    skipTo = oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 7), Timestamp::max());
+    ASSERT_TRUE(skipTo);
+    ASSERT_EQ(Timestamp(1, 9), *skipTo);
+    ASSERT_FALSE(
+        oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 7), Timestamp(1, 7)));
+
+    // A command entry cannot be attributed to a single collection and marks its stone's contents
+    // unknown.
+    insert(Timestamp(1, 9), "c", boost::none);
+    insert(Timestamp(1, 10), "i", uuidA);
+    ASSERT_EQ(5U, oplogStones->numStones());
+    ASSERT_FALSE(
+        oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 9), Timestamp::max()));
+
+    // A plain noop (no 'ui', no 'o2') can never match a change stream and does not prevent its
+    // stone from being skipped.
+    insert(Timestamp(1, 11), "n", boost::none);
+    insert(Timestamp(1, 12), "i", uuidA);
+    ASSERT_EQ(6U, oplogStones->numStones());
+
+    skipTo = oplogStones->nextRelevantTimestampForUuid(uuidB, Timestamp(1, 11), Timestamp::max());
+    ASSERT_TRUE(skipTo);
+    ASSERT_EQ(Timestamp(1, 13), *skipTo);
+}
+
 // Insert records into an oplog and try to update them. The updates shouldn't succeed if the size of
 // record is changed.
 TEST(WiredTigerRecordStoreTest, OplogStones_UpdateRecord) {
@@ -1191,5 +1308,55 @@ TEST(WiredTigerRecordStoreTest, NumRecordsAccurateAfterRollbackWithDelete) {
     ASSERT_EQ(0, rs->numRecords(ctx.get()));
 }
 
+TEST(WiredTigerRecordStoreTest, DataChecksumTracksWrites) {
+    RAIIServerParameterControllerForTest incrementalValidate("incrementalValidateEnabled", true);
+
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newRecordStore());
+
+    ServiceContext::UniqueOperationContext ctx(harnessHelper->newOperationContext());
+
+    // An empty record store has a zero checksum and no clean-validation baseline.
+    ASSERT_EQ(0, *rs->dataChecksum());
+    ASSERT_FALSE(rs->lastCleanValidateChecksum());
+
+    RecordId rid;
+    {
+        WriteUnitOfWork uow(ctx.get());
+        rid = rs->insertRecord(ctx.get(), "a", 2, Timestamp()).getValue();
+        uow.commit();
+    }
+    const long long insertChecksum = *rs->dataChecksum();
+    ASSERT_NE(0, insertChecksum);
+
+    rs->recordCleanValidation();
+    ASSERT_EQ(insertChecksum, *rs->lastCleanValidateChecksum());
+
+    // A rolled-back write leaves the checksum untouched.
+    {
+        WriteUnitOfWork uow(ctx.get());
+        rs->deleteRecord(ctx.get(), rid);
+    }
+    ASSERT_EQ(insertChecksum, *rs->dataChecksum());
+
+    {
+        WriteUnitOfWork uow(ctx.get());
+        ASSERT_OK(rs->updateRecord(ctx.get(), rid, "bb", 3));
+        uow.commit();
+    }
+    ASSERT_NE(insertChecksum, *rs->dataChecksum());
+    ASSERT_NE(*rs->dataChecksum(), *rs->lastCleanValidateChecksum());
+
+    // Deleting the only record restores the empty record store's checksum; the baseline still
+    // reflects the state as of the recorded validation.
+    {
+        WriteUnitOfWork uow(ctx.get());
+        rs->deleteRecord(ctx.get(), rid);
+        uow.commit();
+    }
+    ASSERT_EQ(0, *rs->dataChecksum());
+    ASSERT_EQ(insertChecksum, *rs->lastCleanValidateChecksum());
+}
+
 }  // namespace
 }  // namespace mongo
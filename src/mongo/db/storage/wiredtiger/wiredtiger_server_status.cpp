@@ -55,6 +55,12 @@ bool WiredTigerServerStatusSection::includeByDefault() const {
     return true;
 }
 
+bool WiredTigerServerStatusSection::supportsCaching() const {
+    // Exporting the statistics table reads hundreds of WiredTiger statistics each call, which
+    // adds up under frequent monitoring polls; a slightly stale result is fine for that use.
+    return true;
+}
+
 BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                                                        const BSONElement& configElement) const {
     Lock::GlobalLock lk(opCtx,
@@ -42,6 +42,7 @@ class WiredTigerServerStatusSection : public ServerStatusSection {
 public:
     WiredTigerServerStatusSection();
     bool includeByDefault() const override;
+    bool supportsCaching() const override;
     BSONObj generateSection(OperationContext* opCtx,
                             const BSONElement& configElement) const override;
 };
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <string>
 
@@ -379,9 +380,27 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    /**
+     * Idle sessions are kept in a fixed number of independently locked shards so that concurrent
+     * checkouts and releases on different threads do not contend on one cache-wide mutex. Each
+     * thread is statically assigned to a shard; checkout steals from the other shards when its
+     * own shard is empty. Operations that must visit every cached session (closeAll(),
+     * closeAllCursors(), expired session sweeps) lock the shards one at a time.
+     */
+    struct SessionCacheShard {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCacheShard::lock");
+        SessionCache sessions;
+    };
+    static constexpr size_t kSessionCacheShards = 8;
+
+    /**
+     * Returns the index of the shard to which the calling thread is assigned.
+     */
+    static size_t _myShardId();
+
+    std::array<SessionCacheShard, kSessionCacheShards> _shards;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
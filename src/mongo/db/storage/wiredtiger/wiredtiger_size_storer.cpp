@@ -31,6 +31,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include <wiredtiger.h>
 
 #include "mongo/bson/bsonobj.h"
@@ -67,14 +69,19 @@ WiredTigerSizeStorer::WiredTigerSizeStorer(WT_CONNECTION* conn,
         session.getSession());
 }
 
+size_t WiredTigerSizeStorer::_shardFor(StringData uri) {
+    return StringMapHasher()(uri) % kBufferShards;
+}
+
 void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo) {
     // If the SizeInfo is still dirty, we're done.
     if (sizeInfo->_dirty.load() || _readOnly)
         return;
 
     // Ordering is important: as the entry may be flushed concurrently, set the dirty flag last.
-    stdx::lock_guard<Latch> lk(_bufferMutex);
-    auto& entry = _buffer[uri];
+    auto& shard = _bufferShards[_shardFor(uri)];
+    stdx::lock_guard<Latch> lk(shard.mutex);
+    auto& entry = shard.buffer[uri];
     // During rollback it is possible to get a new SizeInfo. In that case clear the dirty flag,
     // so the SizeInfo can be destructed without triggering the dirty check invariant.
     if (entry && entry.get() != sizeInfo.get())
@@ -90,13 +97,47 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
                 "entryUseCount"_attr = entry.use_count());
 }
 
+void WiredTigerSizeStorer::storeAux(StringData key, BSONObj doc) {
+    if (_readOnly)
+        return;
+
+    stdx::lock_guard<Latch> lk(_auxMutex);
+    _auxBuffer[key] = doc.getOwned();
+}
+
+BSONObj WiredTigerSizeStorer::loadAux(OperationContext* opCtx, StringData key) const {
+    {
+        // Check if we can satisfy the read from the buffer.
+        stdx::lock_guard<Latch> lk(_auxMutex);
+        AuxBuffer::const_iterator it = _auxBuffer.find(key);
+        if (it != _auxBuffer.end())
+            return it->second;
+    }
+
+    WiredTigerCursor cursor(_storageUri, _tableId, /*allowOverwrite=*/false, opCtx);
+
+    {
+        WT_ITEM item = {key.rawData(), key.size()};
+        cursor->set_key(cursor.get(), &item);
+        int ret = cursor->search(cursor.get());
+        if (ret == WT_NOTFOUND)
+            return BSONObj();
+        invariantWTOK(ret, cursor->session);
+    }
+
+    WT_ITEM value;
+    invariantWTOK(cursor->get_value(cursor.get(), &value), cursor->session);
+    return BSONObj(reinterpret_cast<const char*>(value.data)).getOwned();
+}
+
 std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(OperationContext* opCtx,
                                                                            StringData uri) const {
     {
         // Check if we can satisfy the read from the buffer.
-        stdx::lock_guard<Latch> bufferLock(_bufferMutex);
-        Buffer::const_iterator it = _buffer.find(uri);
-        if (it != _buffer.end())
+        auto& shard = _bufferShards[_shardFor(uri)];
+        stdx::lock_guard<Latch> bufferLock(shard.mutex);
+        Buffer::const_iterator it = shard.buffer.find(uri);
+        if (it != shard.buffer.end())
             return it->second;
     }
 
@@ -117,18 +158,41 @@ std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(Opera
 
     LOGV2_DEBUG(
         22424, 2, "WiredTigerSizeStorer::load", "uri"_attr = uri, "data"_attr = redact(data));
-    return std::make_shared<SizeInfo>(data["numRecords"].safeNumberLong(),
-                                      data["dataSize"].safeNumberLong());
+    auto sizeInfo = std::make_shared<SizeInfo>(data["numRecords"].safeNumberLong(),
+                                               data["dataSize"].safeNumberLong());
+    sizeInfo->dataChecksum.store(data["dataChecksum"].safeNumberLong());
+    if (auto cleanChecksum = data["cleanValidateChecksum"]; !cleanChecksum.eoo()) {
+        sizeInfo->cleanValidateChecksum.store(cleanChecksum.safeNumberLong());
+        sizeInfo->hasCleanValidateChecksum.store(true);
+    }
+    return sizeInfo;
 }
 
 void WiredTigerSizeStorer::flush(bool syncToDisk) {
+    // Drain all shards into a single buffer. Each shard's mutex is only held for the duration of
+    // a swap, so concurrent stores are never blocked on the flush itself.
     Buffer buffer;
+    for (auto& shard : _bufferShards) {
+        Buffer shardBuffer;
+        {
+            stdx::lock_guard<Latch> bufferLock(shard.mutex);
+            shard.buffer.swap(shardBuffer);
+        }
+        if (buffer.empty()) {
+            buffer = std::move(shardBuffer);
+        } else {
+            for (auto& it : shardBuffer)
+                buffer.insert(std::move(it));
+        }
+    }
+
+    AuxBuffer auxBuffer;
     {
-        stdx::lock_guard<Latch> bufferLock(_bufferMutex);
-        _buffer.swap(buffer);
+        stdx::lock_guard<Latch> lk(_auxMutex);
+        _auxBuffer.swap(auxBuffer);
     }
 
-    if (buffer.empty())
+    if (buffer.empty() && auxBuffer.empty())
         return;  // Nothing to do.
 
     Timer t;
@@ -143,11 +207,18 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
 
     {
         // On failure, place entries back into the map, unless a newer value already exists.
-        ON_BLOCK_EXIT([this, &buffer]() {
+        ON_BLOCK_EXIT([this, &buffer, &auxBuffer]() {
             if (!buffer.empty()) {
-                stdx::lock_guard<Latch> bufferLock(this->_bufferMutex);
-                for (auto& it : buffer)
-                    this->_buffer.try_emplace(it.first, it.second);
+                for (auto& it : buffer) {
+                    auto& shard = this->_bufferShards[_shardFor(it.first)];
+                    stdx::lock_guard<Latch> bufferLock(shard.mutex);
+                    shard.buffer.try_emplace(it.first, it.second);
+                }
+            }
+            if (!auxBuffer.empty()) {
+                stdx::lock_guard<Latch> lk(_auxMutex);
+                for (auto& it : auxBuffer)
+                    _auxBuffer.try_emplace(it.first, it.second);
             }
         });
 
@@ -167,8 +238,15 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
             // still be written back. So, the required order is to clear the dirty flag first.
             SizeInfo& sizeInfo = *it->second;
             sizeInfo._dirty.store(false);
-            BSONObj data = BSON("numRecords" << sizeInfo.numRecords.load() << "dataSize"
-                                             << sizeInfo.dataSize.load());
+            BSONObjBuilder dataBuilder;
+            // Totals may transiently go negative after an unclean shutdown loses size updates;
+            // never persist a negative value.
+            dataBuilder.append("numRecords", std::max(sizeInfo.numRecords.load(), int64_t(0)));
+            dataBuilder.append("dataSize", std::max(sizeInfo.dataSize.load(), int64_t(0)));
+            dataBuilder.append("dataChecksum", sizeInfo.dataChecksum.load());
+            if (sizeInfo.hasCleanValidateChecksum.load())
+                dataBuilder.append("cleanValidateChecksum", sizeInfo.cleanValidateChecksum.load());
+            BSONObj data = dataBuilder.obj();
 
             auto& uri = it->first;
             LOGV2_DEBUG(22425,
@@ -190,10 +268,32 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
             }
             invariantWTOK(ret, cursor->session);
         }
+
+        for (auto it = auxBuffer.begin(); it != auxBuffer.end(); ++it) {
+            auto& key = it->first;
+            const BSONObj& doc = it->second;
+            LOGV2_DEBUG(6650016,
+                        2,
+                        "WiredTigerSizeStorer::flush aux",
+                        "key"_attr = key,
+                        "data"_attr = redact(doc));
+            WiredTigerItem item(key.c_str(), key.size());
+            WiredTigerItem value(doc.objdata(), doc.objsize());
+            cursor->set_key(cursor, item.Get());
+            cursor->set_value(cursor, value.Get());
+            int ret = cursor->insert(cursor);
+            if (ret == WT_ROLLBACK) {
+                // As above, skip flushing on write conflicts; the buffered documents are restored
+                // on exit.
+                return;
+            }
+            invariantWTOK(ret, cursor->session);
+        }
         txnOpen.done();
         invariantWTOK(session.getSession()->commit_transaction(session.getSession(), nullptr),
                       session.getSession());
         buffer.clear();
+        auxBuffer.clear();
     }
 
     LOGV2_DEBUG(22426,
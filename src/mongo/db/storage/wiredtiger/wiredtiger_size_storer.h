@@ -29,14 +29,17 @@
 
 #pragma once
 
+#include <array>
 #include <string>
 
 #include <wiredtiger.h>
 
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/platform/striped_counter.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -68,8 +71,18 @@ public:
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+
+        // Striped so that concurrent writers adjusting the size of the same collection do not
+        // bounce a shared cache line on every insert, update and delete.
+        StripedCounter64 numRecords;
+        StripedCounter64 dataSize;
+
+        // Order-independent content checksum maintained by the record store as records are
+        // written, and the value it had when the collection last passed validation. The clean
+        // checksum is only persisted once a clean validation has been recorded.
+        AtomicWord<long long> dataChecksum;
+        AtomicWord<long long> cleanValidateChecksum;
+        AtomicWord<bool> hasCleanValidateChecksum;
 
     private:
         friend WiredTigerSizeStorer;
@@ -87,6 +100,20 @@ public:
 
     std::shared_ptr<SizeInfo> load(OperationContext* opCtx, StringData uri) const;
 
+    /**
+     * Buffers an auxiliary document to be written under the given key by the next call to flush.
+     * Auxiliary documents share the size storer's table and flush cadence but carry
+     * caller-defined payloads; keys must be derived from a table URI so they cannot collide with
+     * the URIs used for size information.
+     */
+    void storeAux(StringData key, BSONObj doc);
+
+    /**
+     * Returns the auxiliary document stored under the given key, or an empty document if there is
+     * none.
+     */
+    BSONObj loadAux(OperationContext* opCtx, StringData key) const;
+
     /**
      * Writes all changes to the underlying table.
      */
@@ -103,8 +130,30 @@ private:
 
     using Buffer = StringMap<std::shared_ptr<SizeInfo>>;
 
-    mutable Mutex _bufferMutex =
-        MONGO_MAKE_LATCH("WiredTigerSessionStorer::_bufferMutex");  // Guards _buffer
-    Buffer _buffer;
+    /**
+     * The buffer is striped by a hash of the URI. Every size change of a clean SizeInfo must
+     * re-insert it into the buffer, and right after a flush drains the buffer many record stores
+     * do so at once, so a single buffer mutex would serialize foreground transactions during bulk
+     * ingest.
+     */
+    struct BufferShard {
+        mutable Mutex mutex =
+            MONGO_MAKE_LATCH("WiredTigerSessionStorer::_bufferShardMutex");  // Guards buffer
+        Buffer buffer;
+    };
+    static constexpr size_t kBufferShards = 8;
+
+    /**
+     * Returns the index of the buffer shard responsible for the given URI.
+     */
+    static size_t _shardFor(StringData uri);
+
+    std::array<BufferShard, kBufferShards> _bufferShards;
+
+    using AuxBuffer = StringMap<BSONObj>;
+
+    // Guards _auxBuffer. Auxiliary documents are written rarely, so a single mutex suffices.
+    mutable Mutex _auxMutex = MONGO_MAKE_LATCH("WiredTigerSizeStorer::_auxMutex");
+    AuxBuffer _auxBuffer;
 };
 }  // namespace mongo
@@ -45,28 +45,23 @@ MONGO_FAIL_POINT_DEFINE(hangBeforeMajorityReadTransactionStarted);
 }
 
 void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp) {
-    stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-
-    invariant(!_committedSnapshot || *_committedSnapshot <= timestamp);
-    _committedSnapshot = timestamp;
+    invariant(_committedSnapshot.load() <= timestamp.asULL());
+    _committedSnapshot.store(timestamp.asULL());
 }
 
 void WiredTigerSnapshotManager::setLastApplied(const Timestamp& timestamp) {
-    stdx::lock_guard<Latch> lock(_lastAppliedMutex);
-    if (timestamp.isNull())
-        _lastApplied = boost::none;
-    else
-        _lastApplied = timestamp;
+    _lastApplied.store(timestamp.asULL());
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getLastApplied() {
-    stdx::lock_guard<Latch> lock(_lastAppliedMutex);
-    return _lastApplied;
+    if (auto lastApplied = _lastApplied.load()) {
+        return Timestamp(lastApplied);
+    }
+    return boost::none;
 }
 
 void WiredTigerSnapshotManager::clearCommittedSnapshot() {
-    stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-    _committedSnapshot = boost::none;
+    _committedSnapshot.store(0);
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getMinSnapshotForNextCommittedRead() const {
@@ -74,8 +69,10 @@ boost::optional<Timestamp> WiredTigerSnapshotManager::getMinSnapshotForNextCommi
         return boost::none;
     }
 
-    stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
-    return _committedSnapshot;
+    if (auto committedSnapshot = _committedSnapshot.load()) {
+        return Timestamp(committedSnapshot);
+    }
+    return boost::none;
 }
 
 Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
@@ -84,11 +81,11 @@ Timestamp WiredTigerSnapshotManager::beginTransactionOnCommittedSnapshot(
     RoundUpPreparedTimestamps roundUpPreparedTimestamps) const {
 
     auto committedSnapshot = [this]() {
-        stdx::lock_guard<Latch> lock(_committedSnapshotMutex);
+        auto snapshot = _committedSnapshot.load();
         uassert(ErrorCodes::ReadConcernMajorityNotAvailableYet,
                 "Committed view disappeared while running operation",
-                _committedSnapshot);
-        return _committedSnapshot.get();
+                snapshot);
+        return Timestamp(snapshot);
     }();
 
     if (MONGO_unlikely(hangBeforeMajorityReadTransactionStarted.shouldFail())) {
@@ -30,12 +30,13 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <wiredtiger.h>
 
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/storage/snapshot_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
-#include "mongo/platform/mutex.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 
@@ -80,14 +81,15 @@ public:
     boost::optional<Timestamp> getMinSnapshotForNextCommittedRead() const;
 
 private:
+    // Both timestamps are stored as their raw Timestamp::asULL() value, with zero meaning "not
+    // set". They are published by replication and read by every operation that opens a storage
+    // snapshot, so they are kept in atomics rather than behind mutexes: a reader establishing a
+    // snapshot never contends with the oplog applier advancing these timestamps.
+
     // Snapshot to use for reads at a commit timestamp.
-    mutable Mutex _committedSnapshotMutex =  // Guards _committedSnapshot.
-        MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_committedSnapshotMutex");
-    boost::optional<Timestamp> _committedSnapshot;
+    AtomicWord<std::uint64_t> _committedSnapshot{0};
 
-    // Timestamp to use for reads at a the lastApplied timestamp.
-    mutable Mutex _lastAppliedMutex =  // Guards _lastApplied.
-        MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_lastAppliedMutex");
-    boost::optional<Timestamp> _lastApplied;
+    // Timestamp to use for reads at the lastApplied timestamp.
+    AtomicWord<std::uint64_t> _lastApplied{0};
 };
 }  // namespace mongo
@@ -1172,27 +1172,35 @@ const std::shared_ptr<BucketCatalog::ExecutionStats> BucketCatalog::_getExecutio
     return kEmptyStats;
 }
 
+std::size_t BucketCatalog::_getBucketStatePartition(const OID& id) const {
+    return OID::Hasher()(id) % kNumberOfBucketStatePartitions;
+}
+
 void BucketCatalog::_initializeBucketState(const OID& id) {
-    stdx::lock_guard catalogLock{_mutex};
-    _bucketStates.emplace(id, BucketState::kNormal);
+    auto& partition = _bucketStatePartitions[_getBucketStatePartition(id)];
+    stdx::lock_guard partitionLock{partition.mutex};
+    partition.bucketStates.emplace(id, BucketState::kNormal);
 }
 
 void BucketCatalog::_eraseBucketState(const OID& id) {
-    stdx::lock_guard catalogLock{_mutex};
-    _bucketStates.erase(id);
+    auto& partition = _bucketStatePartitions[_getBucketStatePartition(id)];
+    stdx::lock_guard partitionLock{partition.mutex};
+    partition.bucketStates.erase(id);
 }
 
 boost::optional<BucketCatalog::BucketState> BucketCatalog::_getBucketState(const OID& id) const {
-    stdx::lock_guard catalogLock{_mutex};
-    auto it = _bucketStates.find(id);
-    return it != _bucketStates.end() ? boost::make_optional(it->second) : boost::none;
+    auto& partition = _bucketStatePartitions[_getBucketStatePartition(id)];
+    stdx::lock_guard partitionLock{partition.mutex};
+    auto it = partition.bucketStates.find(id);
+    return it != partition.bucketStates.end() ? boost::make_optional(it->second) : boost::none;
 }
 
 boost::optional<BucketCatalog::BucketState> BucketCatalog::_setBucketState(const OID& id,
                                                                            BucketState target) {
-    stdx::lock_guard catalogLock{_mutex};
-    auto it = _bucketStates.find(id);
-    if (it == _bucketStates.end()) {
+    auto& partition = _bucketStatePartitions[_getBucketStatePartition(id)];
+    stdx::lock_guard partitionLock{partition.mutex};
+    auto it = partition.bucketStates.find(id);
+    if (it == partition.bucketStates.end()) {
         return boost::none;
     }
 
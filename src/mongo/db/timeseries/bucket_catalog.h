@@ -488,18 +488,34 @@ private:
      */
     boost::optional<BucketState> _setBucketState(const OID& id, BucketState target);
 
+    /**
+     * Returns the state partition that tracks the bucket with the given ID.
+     */
+    std::size_t _getBucketStatePartition(const OID& id) const;
+
     static constexpr std::size_t kNumberOfStripes = 32;
     std::array<Stripe, kNumberOfStripes> _stripes;
 
     mutable Mutex _mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "BucketCatalog::_mutex");
 
-    // Bucket state for synchronization with direct writes, protected by '_mutex'
-    stdx::unordered_map<OID, BucketState, OID::Hasher> _bucketStates;
+    /**
+     * Bucket state used for synchronization with direct writes. The state map is checked or
+     * updated on every insert and commit, from all stripes, so it is partitioned by bucket ID to
+     * avoid serializing writers on unrelated buckets behind a single catalog-wide mutex.
+     */
+    struct BucketStatePartition {
+        mutable Mutex mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0),
+                                               "BucketCatalog::BucketStatePartition::mutex");
+        stdx::unordered_map<OID, BucketState, OID::Hasher> bucketStates;
+    };
+
+    static constexpr std::size_t kNumberOfBucketStatePartitions = 32;
+    std::array<BucketStatePartition, kNumberOfBucketStatePartitions> _bucketStatePartitions;
 
-    // Per-namespace execution stats. This map is protected by '_mutex'. Once you complete your
-    // lookup, you can keep the shared_ptr to an individual namespace's stats object and release the
-    // lock. The object itself is thread-safe (using atomics).
+    // Per-namespace execution stats. This map is the only state protected by '_mutex'. Once you
+    // complete your lookup, you can keep the shared_ptr to an individual namespace's stats object
+    // and release the lock. The object itself is thread-safe (using atomics).
     stdx::unordered_map<NamespaceString, std::shared_ptr<ExecutionStats>> _executionStats;
 
     // Approximate memory usage of the bucket catalog.
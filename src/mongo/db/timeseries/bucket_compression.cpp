@@ -46,7 +46,13 @@ namespace timeseries {
 
 namespace {
 MONGO_FAIL_POINT_DEFINE(simulateBsonColumnCompressionDataLoss);
-}
+
+// Write a full uncompressed literal every this many measurements in the compressed columns.
+// Literals are restart points that BSONColumn random access can seek to without decompressing
+// everything before them, this bounds the work for point lookups in large buckets at a small
+// compression cost.
+constexpr size_t kColumnRestartInterval = 128;
+}  // namespace
 
 CompressionResult compressBucket(const BSONObj& bucketDoc,
                                  StringData timeFieldName,
@@ -268,7 +274,8 @@ CompressionResult compressBucket(const BSONObj& bucketDoc,
                 timeFieldName,
                 std::move(columnBuffer),
                 feature_flags::gTimeseriesBucketCompressionWithArrays.isEnabled(
-                    serverGlobalParams.featureCompatibility));
+                    serverGlobalParams.featureCompatibility),
+                kColumnRestartInterval);
             for (const auto& measurement : measurements) {
                 timeColumn.append(measurement.timeField);
             }
@@ -305,7 +312,8 @@ CompressionResult compressBucket(const BSONObj& bucketDoc,
                 columns[i].first,
                 std::move(columnBuffer),
                 feature_flags::gTimeseriesBucketCompressionWithArrays.isEnabled(
-                    serverGlobalParams.featureCompatibility));
+                    serverGlobalParams.featureCompatibility),
+                kColumnRestartInterval);
             for (const auto& measurement : measurements) {
                 if (auto elem = measurement.dataFields[i]) {
                     column.append(elem);
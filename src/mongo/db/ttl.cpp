@@ -449,6 +449,11 @@ private:
         params->isMulti = true;
         params->canonicalQuery = canonicalQuery.getValue().get();
 
+        boost::optional<std::unique_ptr<BatchedDeleteStageBatchParams>> batchParams;
+        if (ttlMonitorBatchDeletes.load()) {
+            batchParams = std::make_unique<BatchedDeleteStageBatchParams>();
+        }
+
         Timer timer;
         auto exec =
             InternalPlanner::deleteWithIndexScan(opCtx,
@@ -459,7 +464,8 @@ private:
                                                  endKey,
                                                  BoundInclusion::kIncludeBothStartAndEndKeys,
                                                  PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
-                                                 direction);
+                                                 direction,
+                                                 std::move(batchParams));
 
         try {
             const auto numDeleted = exec->executeDelete();
@@ -541,6 +547,11 @@ private:
         auto params = std::make_unique<DeleteStageParams>();
         params->isMulti = true;
 
+        boost::optional<std::unique_ptr<BatchedDeleteStageBatchParams>> batchParams;
+        if (ttlMonitorBatchDeletes.load()) {
+            batchParams = std::make_unique<BatchedDeleteStageBatchParams>();
+        }
+
         // Deletes records using a bounded collection scan from the beginning of time to the
         // expiration time (inclusive).
         Timer timer;
@@ -551,7 +562,8 @@ private:
                                                       PlanYieldPolicy::YieldPolicy::YIELD_AUTO,
                                                       InternalPlanner::Direction::FORWARD,
                                                       startId,
-                                                      endId);
+                                                      endId,
+                                                      std::move(batchParams));
 
         try {
             const auto numDeleted = exec->executeDelete();
@@ -292,6 +292,16 @@ struct IsValidUTF8Test {
         bad("\xF5\x80\x80\x80");  // U+140000 > U+10FFFF
         bad("\x80");              // cant start with continuation byte
         bad("\xC0\x80");          // 2-byte version of ASCII NUL
+
+        // Long strings, exercising the vectorized all-ASCII fast path and its boundaries.
+        const std::string ascii(64, 'x');
+        good(ascii);
+        good(ascii + "\xC2\xA2");
+        good(ascii + "\xC2\xA2" + ascii);
+        good(ascii.substr(0, 15) + "\xE2\x82\xAC" + ascii);  // multibyte straddles a chunk
+        bad(ascii + "\xC2");
+        bad(ascii + "\x80" + ascii);
+        bad(ascii.substr(0, 15) + "\xE2\x82" + ascii);
 #undef good
 #undef bad
     }
@@ -0,0 +1,293 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/database.h"
+#include "mongo/db/client.h"
+#include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/batched_update_stage.h"
+#include "mongo/db/exec/collection_scan.h"
+#include "mongo/db/json.h"
+#include "mongo/db/ops/update_request.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/update/update_driver.h"
+#include "mongo/dbtests/dbtests.h"
+
+namespace mongo {
+namespace QueryStageBatchedUpdate {
+
+static const NamespaceString nss("unittests.QueryStageBatchedUpdate");
+
+// For the following tests, fix the targetBatchDocs to 10 documents.
+static const int targetBatchDocs = 10;
+
+class QueryStageBatchedUpdateTest : public unittest::Test {
+public:
+    QueryStageBatchedUpdateTest() : _client(&_opCtx) {}
+
+    virtual ~QueryStageBatchedUpdateTest() {
+        _client.dropCollection(nss.ns());
+    }
+
+    // Populates the collection with nDocs of shape {_id: <int i>, a: <int i>}.
+    void prePopulateCollection(int nDocs) {
+        for (int i = 0; i < nDocs; i++) {
+            insert(BSON("_id" << i << "a" << i));
+        }
+    }
+
+    void insert(const BSONObj& obj) {
+        _client.insert(nss.ns(), obj);
+    }
+
+    void remove(const BSONObj& obj) {
+        _client.remove(nss.ns(), obj);
+    }
+
+    void update(const BSONObj& query, const BSONObj& updateSpec) {
+        _client.update(nss.ns(), query, updateSpec);
+    }
+
+    void getRecordIds(const CollectionPtr& collection,
+                      CollectionScanParams::Direction direction,
+                      std::vector<RecordId>* out) {
+        WorkingSet ws;
+
+        CollectionScanParams params;
+        params.direction = direction;
+        params.tailable = false;
+
+        std::unique_ptr<CollectionScan> scan(
+            new CollectionScan(_expCtx.get(), collection, params, &ws, nullptr));
+        while (!scan->isEOF()) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = scan->work(&id);
+            if (PlanStage::ADVANCED == state) {
+                WorkingSetMember* member = ws.get(id);
+                verify(member->hasRecordId());
+                out->push_back(member->recordId);
+            }
+        }
+    }
+
+    std::unique_ptr<CanonicalQuery> canonicalize(const BSONObj& query) {
+        auto findCommand = std::make_unique<FindCommandRequest>(nss);
+        findCommand->setFilter(query);
+        auto statusWithCQ = CanonicalQuery::canonicalize(&_opCtx, std::move(findCommand));
+        ASSERT_OK(statusWithCQ.getStatus());
+        return std::move(statusWithCQ.getValue());
+    }
+
+    // Constructs a multi-update {$set: {bar: 1}} over documents matching 'query'. The
+    // UpdateRequest and UpdateDriver referenced by the stage's params are owned by the fixture so
+    // they outlive the returned stage.
+    std::unique_ptr<BatchedUpdateStage> makeBatchedUpdateStage(WorkingSet* ws,
+                                                               const CollectionPtr& coll,
+                                                               const BSONObj& query,
+                                                               CanonicalQuery* cq) {
+        _request = std::make_unique<UpdateRequest>();
+        _request->setNamespaceString(nss);
+        _request->setMulti();
+        _request->setQuery(query);
+        _request->setUpdateModification(
+            write_ops::UpdateModification::parseFromClassicUpdate(fromjson("{$set: {bar: 1}}")));
+
+        _driver = std::make_unique<UpdateDriver>(_expCtx);
+        const std::map<StringData, std::unique_ptr<ExpressionWithPlaceholder>> arrayFilters;
+        _driver->parse(
+            _request->getUpdateModification(), arrayFilters, boost::none, _request->isMulti());
+
+        UpdateStageParams updateParams(_request.get(), _driver.get(), &CurOp::get(_opCtx)->debug());
+        updateParams.canonicalQuery = cq;
+
+        auto batchedUpdateParams = std::make_unique<BatchedUpdateStageBatchParams>();
+        batchedUpdateParams->targetBatchDocs = targetBatchDocs;
+        // Disable time-based batching so the tests only exercise targetBatchDocs.
+        batchedUpdateParams->targetBatchTimeMS = Milliseconds(0);
+
+        CollectionScanParams collScanParams;
+        return std::make_unique<BatchedUpdateStage>(
+            _expCtx.get(),
+            updateParams,
+            std::move(batchedUpdateParams),
+            ws,
+            coll,
+            new CollectionScan(_expCtx.get(), coll, collScanParams, ws, nullptr));
+    }
+
+protected:
+    const ServiceContext::UniqueOperationContext _opCtxPtr = cc().makeOperationContext();
+    OperationContext& _opCtx = *_opCtxPtr;
+
+    boost::intrusive_ptr<ExpressionContext> _expCtx =
+        make_intrusive<ExpressionContext>(&_opCtx, nullptr, nss);
+
+    std::unique_ptr<UpdateRequest> _request;
+    std::unique_ptr<UpdateDriver> _driver;
+
+private:
+    DBDirectClient _client;
+};
+
+// Confirms batched updates wait until a batch meets the targetBatchDocs before updating documents.
+TEST_F(QueryStageBatchedUpdateTest, BatchedUpdateTargetBatchDocsBasic) {
+    dbtests::WriteContextForTests ctx(&_opCtx, nss.ns());
+    auto nDocs = 52;
+    prePopulateCollection(nDocs);
+
+    const CollectionPtr& coll = ctx.getCollection();
+    ASSERT(coll);
+
+    const BSONObj query = BSONObj();
+    const std::unique_ptr<CanonicalQuery> cq(canonicalize(query));
+
+    WorkingSet ws;
+    auto updateStage = makeBatchedUpdateStage(&ws, coll, query, cq.get());
+    const UpdateStats* stats = static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+    int nIterations = 0;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    while ((state = updateStage->work(&id)) != PlanStage::IS_EOF) {
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+
+        // Only update documents once the current batch reaches targetBatchDocs.
+        int batch = nIterations / (int)targetBatchDocs;
+        ASSERT_EQUALS(stats->nModified, targetBatchDocs * batch);
+        nIterations++;
+    }
+
+    // There should be 2 more docs updated by the time the command returns EOF.
+    ASSERT_EQUALS(state, PlanStage::IS_EOF);
+    ASSERT_EQUALS(stats->nModified, nDocs);
+}
+
+// A staged document is removed while the BatchedUpdateStage is in a savedState. Upon restoring its
+// state, BatchedUpdateStage's snapshot is incremented and it can see the document has been removed
+// and skips over it.
+TEST_F(QueryStageBatchedUpdateTest, BatchedUpdateStagedDocIsDeleted) {
+    dbtests::WriteContextForTests ctx(&_opCtx, nss.ns());
+    auto nDocs = 11;
+    prePopulateCollection(nDocs);
+
+    const CollectionPtr& coll = ctx.getCollection();
+    ASSERT(coll);
+
+    // Get the RecordIds that would be returned by an in-order scan.
+    std::vector<RecordId> recordIds;
+    getRecordIds(coll, CollectionScanParams::FORWARD, &recordIds);
+
+    const BSONObj query = BSONObj();
+    const std::unique_ptr<CanonicalQuery> cq(canonicalize(query));
+
+    WorkingSet ws;
+    auto updateStage = makeBatchedUpdateStage(&ws, coll, query, cq.get());
+    const UpdateStats* stats = static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+    // Index to pause at before fetching the remaining documents into the update batch.
+    int pauseBatchingIdx = 6;
+
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    for (int i = 0; i < pauseBatchingIdx; i++) {
+        updateStage->work(&id);
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+        ASSERT_EQUALS(stats->nModified, 0);
+    }
+
+    {
+        // Delete a document that has already been added to the update batch.
+        updateStage->saveState();
+        BSONObj targetDoc = coll->docFor(&_opCtx, recordIds[pauseBatchingIdx - 2]).value();
+        ASSERT(!targetDoc.isEmpty());
+        remove(targetDoc);
+        // Increases the snapshotId.
+        updateStage->restoreState(&coll);
+    }
+
+    while ((state = updateStage->work(&id)) != PlanStage::IS_EOF) {
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+    }
+
+    ASSERT_EQUALS(state, PlanStage::IS_EOF);
+    ASSERT_EQUALS(stats->nModified, nDocs - 1);
+}
+
+// One of the staged documents is updated out from under the stage to no longer match the query,
+// and then the BatchedUpdateStage increments its snapshot before discovering the mismatch.
+TEST_F(QueryStageBatchedUpdateTest, BatchedUpdateStagedDocIsUpdatedToNotMatch) {
+    dbtests::WriteContextForTests ctx(&_opCtx, nss.ns());
+    auto nDocs = 11;
+    prePopulateCollection(nDocs);
+
+    const CollectionPtr& coll = ctx.getCollection();
+    ASSERT(coll);
+
+    // Only update documents whose 'a' field is greater than or equal to 0.
+    const BSONObj query = BSON("a" << BSON("$gte" << 0));
+    const std::unique_ptr<CanonicalQuery> cq(canonicalize(query));
+
+    WorkingSet ws;
+    auto updateStage = makeBatchedUpdateStage(&ws, coll, query, cq.get());
+    const UpdateStats* stats = static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+    // Index to pause at before fetching the remaining documents into the update batch.
+    int pauseBatchingIdx = 6;
+
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    for (int i = 0; i < pauseBatchingIdx; i++) {
+        updateStage->work(&id);
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+        ASSERT_EQUALS(stats->nModified, 0);
+    }
+
+    {
+        // Update a staged document so it no longer matches the update query.
+        updateStage->saveState();
+        update(BSON("_id" << 2), BSON("a" << -1));
+        // Increases the snapshotId.
+        updateStage->restoreState(&coll);
+    }
+
+    while ((state = updateStage->work(&id)) != PlanStage::IS_EOF) {
+        ASSERT_EQUALS(state, PlanStage::NEED_TIME);
+    }
+
+    ASSERT_EQUALS(state, PlanStage::IS_EOF);
+    ASSERT_EQUALS(stats->nModified, nDocs - 1);
+}
+
+}  // namespace QueryStageBatchedUpdate
+}  // namespace mongo
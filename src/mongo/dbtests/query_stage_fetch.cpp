@@ -226,6 +226,69 @@ public:
     }
 };
 
+//
+// Test that records already returned by an ancestor deduping OR stage are skipped without
+// being fetched.
+//
+class FetchStageDedupSkip : public QueryStageFetchBase {
+public:
+    void run() {
+        Lock::DBLock lk(&_opCtx, nss().db(), MODE_X);
+        OldClientContext ctx(&_opCtx, ns());
+        Database* db = ctx.db();
+        CollectionPtr coll =
+            CollectionCatalog::get(&_opCtx)->lookupCollectionByNamespace(&_opCtx, nss());
+        if (!coll) {
+            WriteUnitOfWork wuow(&_opCtx);
+            coll = db->createCollection(&_opCtx, nss());
+            wuow.commit();
+        }
+
+        WorkingSet ws;
+
+        // Add an object to the DB.
+        insert(BSON("foo" << 5));
+        set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(1), recordIds.size());
+
+        // Create a mock stage that returns the WSM.
+        auto mockStage = std::make_unique<QueuedDataStage>(_expCtx.get(), &ws);
+
+        // Mock data.
+        {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = *recordIds.begin();
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        auto fetchStage =
+            std::make_unique<FetchStage>(_expCtx.get(), &ws, std::move(mockStage), nullptr, coll);
+
+        // Mark the record as already returned by another branch of a deduping OR.
+        auto seen = std::make_shared<stdx::unordered_set<RecordId, RecordId::Hasher>>();
+        seen->insert(*recordIds.begin());
+        fetchStage->setRecordIdDedupSet(seen);
+
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state;
+
+        // The record is dropped without being fetched.
+        state = fetchStage->work(&id);
+        ASSERT_EQUALS(PlanStage::NEED_TIME, state);
+
+        auto stats = static_cast<const FetchStats*>(fetchStage->getSpecificStats());
+        ASSERT_EQUALS(size_t(1), stats->dupsSkipped);
+        ASSERT_EQUALS(size_t(0), stats->docsExamined);
+
+        // No more data to fetch, so, EOF.
+        state = fetchStage->work(&id);
+        ASSERT_EQUALS(PlanStage::IS_EOF, state);
+    }
+};
+
 class All : public OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_fetch") {}
@@ -233,6 +296,7 @@ public:
     void setupTests() {
         add<FetchStageAlreadyFetched>();
         add<FetchStageFilter>();
+        add<FetchStageDedupSkip>();
     }
 };
 
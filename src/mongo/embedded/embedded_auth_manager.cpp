@@ -132,6 +132,10 @@ public:
         UASSERT_NOT_IMPLEMENTED;
     }
 
+    void invalidateNonExternalUsers(OperationContext*) override {
+        UASSERT_NOT_IMPLEMENTED;
+    }
+
     Status initialize(OperationContext* opCtx) override {
         UASSERT_NOT_IMPLEMENTED;
     }
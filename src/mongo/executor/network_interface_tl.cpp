@@ -797,6 +797,36 @@ void NetworkInterfaceTL::RequestManager::trySend(
                 "requestId"_attr = cmdState->requestOnAny.id,
                 "target"_attr = cmdState->requestOnAny.target[idx]);
 
+    if (requestState->isHedge) {
+        invariant(cmdState->requestOnAny.hedgeOptions);
+        auto delay = Milliseconds(cmdState->requestOnAny.hedgeOptions->delayMS);
+        if (delay > Milliseconds(0)) {
+            // Give the authoritative request a head start. If it responds before the timer
+            // fires, the finish line check in send() returns the connection without ever
+            // dispatching the hedge.
+            LOGV2_DEBUG(6650026,
+                        2,
+                        "Delaying hedged request",
+                        "requestId"_attr = cmdState->requestOnAny.id,
+                        "target"_attr = cmdState->requestOnAny.target[idx],
+                        "delay"_attr = delay);
+            requestState->delayTimer = cmdState->interface->_reactor->makeTimer();
+            requestState->delayTimer->waitUntil(cmdState->interface->now() + delay, cmdState->baton)
+                .getAsync([this, requestState](Status status) mutable {
+                    if (!status.isOK()) {
+                        requestState->returnConnection(Status::OK());
+                        return;
+                    }
+                    send(std::move(requestState));
+                });
+            return;
+        }
+    }
+
+    send(std::move(requestState));
+}
+
+void NetworkInterfaceTL::RequestManager::send(std::shared_ptr<RequestState> requestState) noexcept {
     auto request = &requestState->request.get();
 
     if (requestState->isHedge) {
@@ -812,7 +842,7 @@ void NetworkInterfaceTL::RequestManager::trySend(
                         "originalMaxTime"_attr = request->timeout,
                         "reducedMaxTime"_attr = hedgingMaxTimeMS,
                         "requestId"_attr = cmdState->requestOnAny.id,
-                        "target"_attr = cmdState->requestOnAny.target[idx]);
+                        "target"_attr = request->target);
             request->timeout = hedgingMaxTimeMS;
         }
 
@@ -830,7 +860,7 @@ void NetworkInterfaceTL::RequestManager::trySend(
                     "Set maxTimeMSOpOnly for request",
                     "maxTimeMSOpOnly"_attr = request->timeout,
                     "requestId"_attr = cmdState->requestOnAny.id,
-                    "target"_attr = cmdState->requestOnAny.target[idx]);
+                    "target"_attr = request->target);
 
         BSONObjBuilder updatedCmdBuilder;
         updatedCmdBuilder.appendElements(request->cmdObj);
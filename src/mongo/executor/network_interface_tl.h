@@ -235,6 +235,14 @@ private:
         RequestManager(CommandStateBase* cmdState);
 
         void trySend(StatusWith<ConnectionPool::ConnectionHandle> swConn, size_t idx) noexcept;
+
+        /**
+         * Sends the request over its acquired connection. Hedged requests with a configured
+         * hedging delay pass through a reactor timer first, so the authoritative request gets
+         * a head start and a fast response suppresses the hedge altogether.
+         */
+        void send(std::shared_ptr<RequestState> requestState) noexcept;
+
         void cancelRequests();
         void killOperationsForPendingRequests();
 
@@ -304,6 +312,10 @@ private:
         // True if this request is an additional request sent to hedge the operation.
         bool isHedge{false};
 
+        // Delays sending a hedged request when a hedging delay is configured. Kept on the
+        // request state so it outlives the wait.
+        std::unique_ptr<transport::ReactorTimer> delayTimer;
+
         // Set to true if the response to the request is used to fulfill the command's
         // promise (i.e. arrives before the responses to all other requests and is not
         // a MaxTimeMSExpired error response if this is a hedged request).
@@ -47,6 +47,10 @@ struct RemoteCommandRequestBase {
     struct HedgeOptions {
         size_t count = 0;
         int maxTimeMSForHedgedReads = 0;
+
+        // How long the network interface should wait after dispatching the authoritative
+        // request before dispatching a hedged one. Zero means hedge immediately.
+        int delayMS = 0;
     };
 
     enum FireAndForgetMode { kOn, kOff };
@@ -34,12 +34,18 @@
 #include <boost/iterator/filter_iterator.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/make_shared.hpp>
+#include <deque>
 #include <fmt/format.h>
 #include <fstream>
+#include <utility>
 
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log_detail.h"
 #include "mongo/logv2/shared_access_fstream.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/stacktrace.h"
 #include "mongo/util/string_map.h"
@@ -76,11 +82,92 @@ struct FileRotateSink::Impl {
     Impl(LogTimestampFormat tsFormat) : timestampFormat(tsFormat) {}
     StringMap<boost::shared_ptr<stream_t>> files;
     LogTimestampFormat timestampFormat;
+
+    // State for asynchronous writes. The mutex guards the queue and counters. The streams are
+    // only touched by the writer thread once enableAsync() has been called; rotate() and flush()
+    // drain the queue first and are serialized against consume() by the owning sink frontend.
+    stdx::mutex asyncMutex;
+    stdx::condition_variable asyncCond;
+    stdx::condition_variable asyncIdleCond;
+    std::deque<std::string> asyncQueue;
+    std::size_t asyncQueueBytes = 0;
+    std::size_t asyncMaxQueueBytes = 0;
+    std::size_t asyncDroppedLines = 0;
+    bool asyncWriting = false;
+    bool asyncShutdown = false;
+    bool asyncEnabled = false;
+    stdx::thread asyncThread;
 };
 
 FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat)
     : _impl(std::make_unique<Impl>(timestampFormat)) {}
-FileRotateSink::~FileRotateSink() {}
+FileRotateSink::~FileRotateSink() {
+    if (_impl->asyncEnabled) {
+        {
+            stdx::lock_guard<stdx::mutex> lock(_impl->asyncMutex);
+            _impl->asyncShutdown = true;
+            _impl->asyncCond.notify_one();
+        }
+        // The writer thread exits once the queue is empty, so enqueued lines are still written
+        // during shutdown.
+        _impl->asyncThread.join();
+    }
+}
+
+void FileRotateSink::enableAsync(std::size_t maxQueueSizeBytes) {
+    invariant(!_impl->asyncEnabled);
+    _impl->asyncMaxQueueBytes = maxQueueSizeBytes;
+    _impl->asyncEnabled = true;
+    _impl->asyncThread = stdx::thread([this] {
+        setThreadName("LogWriter");
+
+        std::deque<std::string> batch;
+        for (;;) {
+            std::size_t dropped = 0;
+            {
+                stdx::unique_lock<stdx::mutex> lock(_impl->asyncMutex);
+                _impl->asyncWriting = false;
+                _impl->asyncIdleCond.notify_all();
+                _impl->asyncCond.wait(
+                    lock, [&] { return !_impl->asyncQueue.empty() || _impl->asyncShutdown; });
+                if (_impl->asyncQueue.empty() && _impl->asyncShutdown)
+                    return;
+                batch.swap(_impl->asyncQueue);
+                _impl->asyncQueueBytes = 0;
+                dropped = std::exchange(_impl->asyncDroppedLines, 0);
+                _impl->asyncWriting = true;
+            }
+
+            for (const auto& line : batch) {
+                _writeAndCheckFailure(boost::log::record_view(), line);
+            }
+            batch.clear();
+
+            if (dropped > 0) {
+                DynamicAttributes attrs;
+                attrs.add("droppedLines", static_cast<long long>(dropped));
+
+                fmt::memory_buffer buffer;
+                JSONFormatter(nullptr, _impl->timestampFormat)
+                    .format(buffer,
+                            LogSeverity::Warning(),
+                            LogComponent::kControl,
+                            Date_t::now(),
+                            6650011,
+                            getThreadName(),
+                            "Dropped log lines because the asynchronous log write queue was full",
+                            TypeErasedAttributeStorage(attrs),
+                            LogTag::kNone,
+                            nullptr /* tenantID */,
+                            LogTruncation::Disabled);
+                // Commented out log line below to get validation of the log id with the errorcodes
+                // linter LOGV2_WARNING(6650011, "Dropped log lines because the asynchronous log
+                // write queue was full");
+                _writeAndCheckFailure(boost::log::record_view(), fmt::to_string(buffer));
+            }
+        }
+    });
+}
 
 Status FileRotateSink::addFile(const std::string& filename, bool append) {
     auto statusWithFile = openFile(filename, append);
@@ -102,6 +189,9 @@ void FileRotateSink::removeFile(const std::string& filename) {
 Status FileRotateSink::rotate(bool rename,
                               StringData renameSuffix,
                               std::function<void(Status)> onMinorError) {
+    // Make sure buffered lines are written to the file being rotated out.
+    _drainAsyncQueue();
+
     for (auto& file : _impl->files) {
         const std::string& filename = file.first;
         if (rename) {
@@ -163,6 +253,36 @@ Status FileRotateSink::rotate(bool rename,
 
 void FileRotateSink::consume(const boost::log::record_view& rec,
                              const string_type& formatted_string) {
+    if (_impl->asyncEnabled) {
+        stdx::lock_guard<stdx::mutex> lock(_impl->asyncMutex);
+        if (_impl->asyncQueueBytes + formatted_string.size() > _impl->asyncMaxQueueBytes) {
+            ++_impl->asyncDroppedLines;
+            return;
+        }
+        _impl->asyncQueueBytes += formatted_string.size();
+        _impl->asyncQueue.push_back(formatted_string);
+        _impl->asyncCond.notify_one();
+        return;
+    }
+
+    _writeAndCheckFailure(rec, formatted_string);
+}
+
+void FileRotateSink::flush() {
+    _drainAsyncQueue();
+    boost::log::sinks::text_ostream_backend::flush();
+}
+
+void FileRotateSink::_drainAsyncQueue() {
+    if (!_impl->asyncEnabled)
+        return;
+    stdx::unique_lock<stdx::mutex> lock(_impl->asyncMutex);
+    _impl->asyncIdleCond.wait(
+        lock, [&] { return _impl->asyncQueue.empty() && !_impl->asyncWriting; });
+}
+
+void FileRotateSink::_writeAndCheckFailure(const boost::log::record_view& rec,
+                                           const string_type& formatted_string) {
     auto isFailed = [](const auto& file) { return file.second->fail(); };
     boost::log::sinks::text_ostream_backend::consume(rec, formatted_string);
     if (std::any_of(_impl->files.begin(), _impl->files.end(), isFailed)) {
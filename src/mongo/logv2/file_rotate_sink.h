@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/log/sinks/text_ostream_backend.hpp>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -48,11 +49,29 @@ public:
     Status addFile(const std::string& filename, bool append);
     void removeFile(const std::string& filename);
 
+    /**
+     * Moves file writes off the logging thread. consume() then only enqueues the formatted line
+     * and a dedicated writer thread performs the file I/O. When more than maxQueueSizeBytes of
+     * formatted lines are buffered, additional lines are dropped and the number of dropped lines
+     * is reported in the log once the writer catches up.
+     *
+     * May only be called once, before the sink starts receiving records.
+     */
+    void enableAsync(std::size_t maxQueueSizeBytes);
+
     Status rotate(bool rename, StringData renameSuffix, std::function<void(Status)> onMinorError);
 
     void consume(const boost::log::record_view& rec, const string_type& formatted_string);
+    void flush();
 
 private:
+    void _writeAndCheckFailure(const boost::log::record_view& rec,
+                               const string_type& formatted_string);
+
+    // Blocks until the writer thread has written out all enqueued lines. No-op unless
+    // enableAsync() has been called.
+    void _drainAsyncQueue();
+
     struct Impl;
     std::unique_ptr<Impl> _impl;
 };
@@ -175,6 +175,9 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         if (!ret.isOK())
             return ret;
         backend->lockedBackend<0>()->auto_flush(true);
+        if (options.asyncFileWritesEnabled) {
+            backend->lockedBackend<0>()->enableAsync(options.asyncFileWritesMaxQueueBytes);
+        }
         backend->setFilter<2>(
             TaggedSeverityFilter(_parent, {LogTag::kStartupWarnings}, LogSeverity::Log()));
 
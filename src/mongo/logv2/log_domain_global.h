@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "mongo/logv2/constants.h"
 #include "mongo/logv2/log_domain_internal.h"
 #include "mongo/logv2/log_format.h"
@@ -43,6 +45,11 @@ public:
         bool consoleEnabled{true};
         bool fileEnabled{false};
         std::string filePath;
+        // When set, log file writes happen on a dedicated writer thread and the logging threads
+        // only enqueue formatted lines, dropping them if more than asyncFileWritesMaxQueueBytes
+        // are buffered.
+        bool asyncFileWritesEnabled{false};
+        std::size_t asyncFileWritesMaxQueueBytes{16 * 1024 * 1024};
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
         LogTimestampFormat timestampFormat{LogTimestampFormat::kISO8601UTC};
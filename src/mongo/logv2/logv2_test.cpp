@@ -46,6 +46,7 @@
 #include "mongo/logv2/component_settings_filter.h"
 #include "mongo/logv2/composite_backend.h"
 #include "mongo/logv2/constants.h"
+#include "mongo/logv2/file_rotate_sink.h"
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_capture_backend.h"
@@ -1725,6 +1726,43 @@ TEST_F(LogV2Test, FileLogging) {
     ASSERT(before_rotation == after_rotation);
 }
 
+TEST_F(LogV2Test, AsyncFileRotateSink) {
+    auto logv2_dir = std::make_unique<mongo::unittest::TempDir>("logv2_async");
+    std::string file_name = logv2_dir->path() + "/file.log";
+
+    auto backend = boost::make_shared<FileRotateSink>(LogTimestampFormat::kISO8601UTC);
+    ASSERT_OK(backend->addFile(file_name, false));
+    backend->enableAsync(1024 * 1024);
+
+    auto readFile = [&](std::string const& filename) {
+        std::vector<std::string> lines;
+        std::ifstream file(filename);
+        for (std::string line; std::getline(file, line, '\n');)
+            lines.push_back(std::move(line));
+        return lines;
+    };
+
+    backend->consume(boost::log::record_view(), "line1");
+    backend->consume(boost::log::record_view(), "line2");
+
+    // flush() blocks until the writer thread has drained the queue.
+    backend->flush();
+
+    auto lines = readFile(file_name);
+    ASSERT_EQUALS(lines.size(), 2UL);
+    ASSERT(lines[0] == "line1");
+    ASSERT(lines[1] == "line2");
+
+    // Rotation drains buffered lines into the file being rotated out before reopening.
+    backend->consume(boost::log::record_view(), "line3");
+    ASSERT_OK(backend->rotate(true, "-rotated", nullptr));
+
+    auto rotatedLines = readFile(file_name + "-rotated");
+    ASSERT_EQUALS(rotatedLines.size(), 3UL);
+    ASSERT(rotatedLines.back() == "line3");
+    ASSERT(readFile(file_name).empty());
+}
+
 TEST_F(LogV2Test, UserAssert) {
     std::vector<std::string> lines;
     auto sink = wrapInSynchronousSink(wrapInCompositeBackend(
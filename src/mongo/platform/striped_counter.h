@@ -0,0 +1,131 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/new.h"
+
+namespace mongo {
+
+/**
+ * A 64-bit counter striped across cache lines so that concurrent writers do not contend on a
+ * single atomic. Each updating thread is assigned one of a fixed set of stripes, making add() an
+ * uncontended atomic increment on most workloads, and load() folds the stripes into a total.
+ *
+ * Unlike AtomicWord, an update cannot observe the running total, load() is O(stripe count), and a
+ * load() concurrent with updates may miss some of them (it is no staler than the values at the
+ * time of the call). Each instance allocates one cache line per stripe, with the stripe count
+ * derived from the hardware concurrency and capped at kMaxStripes, so this type is best suited to
+ * counters that are written far more often than they are read and whose instances are relatively
+ * long-lived.
+ */
+class StripedCounter64 {
+public:
+    StripedCounter64() : _stripes(std::make_unique<Stripe[]>(numStripes())) {}
+
+    explicit StripedCounter64(int64_t value) : StripedCounter64() {
+        _stripes[0].value.store(value);
+    }
+
+    StripedCounter64(const StripedCounter64&) = delete;
+    StripedCounter64& operator=(const StripedCounter64&) = delete;
+
+    /**
+     * Adds 'increment' (which may be negative) to the counter.
+     */
+    void add(int64_t increment) {
+        _stripes[_threadStripe()].value.fetchAndAddRelaxed(increment);
+    }
+
+    /**
+     * Returns the sum of all stripes.
+     */
+    int64_t load() const {
+        int64_t sum = 0;
+        for (size_t i = 0; i < numStripes(); ++i) {
+            sum += _stripes[i].value.load();
+        }
+        return sum;
+    }
+
+    /**
+     * Resets the counter to 'value'. Updates made concurrently with a store() may be lost, just
+     * as with AtomicWord<int64_t>::store() racing a fetchAndAdd().
+     */
+    void store(int64_t value) {
+        for (size_t i = numStripes() - 1; i > 0; --i) {
+            _stripes[i].value.store(0);
+        }
+        _stripes[0].value.store(value);
+    }
+
+    /**
+     * The number of stripes in every StripedCounter64: the smallest power of two at or above the
+     * hardware concurrency, capped at kMaxStripes.
+     */
+    static size_t numStripes() {
+        static const size_t n = [] {
+            const size_t hw = std::thread::hardware_concurrency();
+            size_t stripes = 1;
+            while (stripes < hw && stripes < kMaxStripes) {
+                stripes <<= 1;
+            }
+            return stripes;
+        }();
+        return n;
+    }
+
+    static constexpr size_t kMaxStripes = 32;
+
+private:
+    struct alignas(stdx::hardware_destructive_interference_size) Stripe {
+        AtomicWord<int64_t> value;
+    };
+
+    /**
+     * Returns the stripe index assigned to the calling thread. Threads are assigned stripes
+     * round-robin on first use, so any pair of threads contends only if they map to the same
+     * stripe.
+     */
+    static size_t _threadStripe() {
+        static AtomicWord<uint64_t> nextThread{0};
+        thread_local const uint64_t token = nextThread.fetchAndAdd(1);
+        return static_cast<size_t>(token) & (numStripes() - 1);
+    }
+
+    std::unique_ptr<Stripe[]> _stripes;
+};
+
+}  // namespace mongo
@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <vector>
+
+#include "mongo/platform/striped_counter.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(StripedCounter64, BasicOperations) {
+    StripedCounter64 counter;
+    ASSERT_EQUALS(0, counter.load());
+
+    counter.add(5);
+    ASSERT_EQUALS(5, counter.load());
+
+    counter.add(-7);
+    ASSERT_EQUALS(-2, counter.load());
+
+    counter.store(42);
+    ASSERT_EQUALS(42, counter.load());
+
+    counter.store(0);
+    ASSERT_EQUALS(0, counter.load());
+}
+
+TEST(StripedCounter64, InitialValue) {
+    StripedCounter64 counter(123);
+    ASSERT_EQUALS(123, counter.load());
+}
+
+TEST(StripedCounter64, NumStripesIsPowerOfTwo) {
+    const auto n = StripedCounter64::numStripes();
+    ASSERT_GREATER_THAN_OR_EQUALS(n, 1u);
+    ASSERT_LESS_THAN_OR_EQUALS(n, StripedCounter64::kMaxStripes);
+    ASSERT_EQUALS(0u, n & (n - 1));
+}
+
+TEST(StripedCounter64, ConcurrentAddsSumCorrectly) {
+    static constexpr int kThreads = 8;
+    static constexpr int kIterations = 10000;
+
+    StripedCounter64 counter;
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < kIterations; ++i) {
+                counter.add(2);
+                counter.add(-1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQUALS(kThreads * kIterations, counter.load());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -70,6 +70,22 @@ OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage) {
     }
 }
 
+OpMsgRequest opMsgRequestUnownedFromAnyProtocol(const Message& unownedMessage) {
+    switch (unownedMessage.operation()) {
+        case mongo::dbMsg:
+            // Zero-copy mode: the views stay pinned to the message buffer, see the header.
+            return OpMsgRequest::parse(unownedMessage);
+        case mongo::dbQuery:
+            // The legacy request is re-serialized into an owned OP_MSG, so there is no unowned
+            // variant of this upgrade path.
+            return opMsgRequestFromLegacyRequest(unownedMessage);
+        default:
+            uasserted(ErrorCodes::UnsupportedFormat,
+                      str::stream() << "Received a reply message with unexpected opcode: "
+                                    << unownedMessage.operation());
+    }
+}
+
 std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol) {
     switch (protocol) {
         case Protocol::kOpMsg:
@@ -80,5 +96,13 @@ std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol) {
     MONGO_UNREACHABLE;
 }
 
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        SharedBuffer reuseBuffer) {
+    if (protocol == Protocol::kOpMsg && reuseBuffer) {
+        return std::make_unique<OpMsgReplyBuilder>(std::move(reuseBuffer));
+    }
+    return makeReplyBuilder(protocol);
+}
+
 }  // namespace rpc
 }  // namespace mongo
@@ -56,10 +56,28 @@ std::unique_ptr<ReplyInterface> makeReply(const Message* unownedMessage);
  */
 OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage);
 
+/**
+ * Like opMsgRequestFromAnyProtocol(), but for OP_MSG requests the returned request contains
+ * unowned BSONObj views pinned to 'unownedMessage's buffer rather than sharing ownership of it.
+ * This avoids touching the message buffer's reference count for every parsed document. The
+ * caller must guarantee that the message outlives the returned request; code that retains a
+ * document beyond that must copy it (e.g. via BSONObj::getOwned()) or explicitly share
+ * ownership with the message buffer.
+ */
+OpMsgRequest opMsgRequestUnownedFromAnyProtocol(const Message& unownedMessage);
+
 /**
  * Returns the appropriate concrete ReplyBuilder.
  */
 std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol);
 
+/**
+ * Like makeReplyBuilder(), but when 'reuseBuffer' is non-null and the protocol supports it, the
+ * reply is serialized into that buffer (typically recycled from the previous reply on the
+ * connection) rather than into a fresh allocation.
+ */
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        SharedBuffer reuseBuffer);
+
 }  // namespace rpc
 }  // namespace mongo
@@ -223,6 +223,14 @@ public:
         skipHeaderAndFlags();
     }
 
+    /**
+     * Constructs a builder that serializes into 'reuseBuffer' rather than into a fresh
+     * allocation, growing it as needed. The buffer must not be referenced by anyone else.
+     */
+    explicit OpMsgBuilder(SharedBuffer reuseBuffer) : _buf(std::move(reuseBuffer)) {
+        skipHeaderAndFlags();
+    }
+
     /**
      * See the documentation for DocSequenceBuilder below.
      */
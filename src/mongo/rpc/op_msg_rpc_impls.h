@@ -53,6 +53,14 @@ private:
 
 class OpMsgReplyBuilder final : public rpc::ReplyBuilderInterface {
 public:
+    OpMsgReplyBuilder() = default;
+
+    /**
+     * Serializes the reply into 'reuseBuffer' (typically the recycled buffer of the previous
+     * reply on the connection) rather than into a fresh allocation.
+     */
+    explicit OpMsgReplyBuilder(SharedBuffer reuseBuffer) : _builder(std::move(reuseBuffer)) {}
+
     ReplyBuilderInterface& setRawCommandReply(const BSONObj& reply) override {
         _builder.beginBody().appendElements(reply);
         return *this;
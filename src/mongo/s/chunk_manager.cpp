@@ -130,71 +130,73 @@ void validateChunkIsNotOlderThan(const std::shared_ptr<ChunkInfo>& chunk,
 
 ShardVersionMap ChunkMap::constructShardVersionMap() const {
     ShardVersionMap shardVersions;
-    ChunkVector::const_iterator current = _chunkMap.cbegin();
 
     boost::optional<BSONObj> firstMin = boost::none;
     boost::optional<BSONObj> lastMax = boost::none;
 
-    while (current != _chunkMap.cend()) {
-        const auto& firstChunkInRange = *current;
-        const auto& currentRangeShardId = firstChunkInRange->getShardIdAt(boost::none);
-
-        // Tracks the max shard version for the shard on which the current range will reside
-        auto shardVersionIt = shardVersions.find(currentRangeShardId);
-        if (shardVersionIt == shardVersions.end()) {
-            shardVersionIt = shardVersions
-                                 .emplace(std::piecewise_construct,
-                                          std::forward_as_tuple(currentRangeShardId),
-                                          std::forward_as_tuple(_collectionVersion.epoch(),
-                                                                _collectionVersion.getTimestamp()))
-                                 .first;
-        }
+    // The chunk that ended the range currently being scanned and the tracked max shard version of
+    // the shard owning that range. Pointers into 'shardVersions' remain valid across inserts since
+    // the map is node-based.
+    std::shared_ptr<ChunkInfo> prevChunk;
+    ChunkVersion* maxShardVersion = nullptr;
+
+    forEach([&](const auto& chunk) {
+        const auto& chunkShardId = chunk->getShardIdAt(boost::none);
+
+        if (!prevChunk || prevChunk->getShardIdAt(boost::none) != chunkShardId) {
+            if (prevChunk) {
+                // If a shard has chunks it must have a shard version, otherwise we have an invalid
+                // chunk somewhere, which should have been caught at chunk load time
+                invariant(maxShardVersion->isSet());
+
+                // Check the continuity of the chunks map at the range boundary
+                lastMax = prevChunk->getMax();
+                const auto& rangeMin = chunk->getMin();
+                if (!SimpleBSONObjComparator::kInstance.evaluate(*lastMax == rangeMin)) {
+                    if (SimpleBSONObjComparator::kInstance.evaluate(*lastMax < rangeMin))
+                        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                                  str::stream()
+                                      << "Gap exists in the routing table between chunks "
+                                      << findIntersectingChunk(*lastMax)->getRange().toString()
+                                      << " and " << chunk->getRange().toString());
+                    else
+                        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                                  str::stream()
+                                      << "Overlap exists in the routing table between chunks "
+                                      << findIntersectingChunk(*lastMax)->getRange().toString()
+                                      << " and " << chunk->getRange().toString());
+                }
+            } else {
+                firstMin = chunk->getMin();
+            }
 
-        auto& maxShardVersion = shardVersionIt->second.shardVersion;
-
-        current =
-            std::find_if(current,
-                         _chunkMap.cend(),
-                         [&currentRangeShardId, &maxShardVersion](const auto& currentChunk) {
-                             if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
-                                 return true;
-
-                             if (maxShardVersion.isOlderThan(currentChunk->getLastmod()))
-                                 maxShardVersion = currentChunk->getLastmod();
-
-                             return false;
-                         });
-
-        const auto rangeLast = *std::prev(current);
-
-        const auto& rangeMin = firstChunkInRange->getMin();
-        const auto& rangeMax = rangeLast->getMax();
-
-        // Check the continuity of the chunks map
-        if (lastMax && !SimpleBSONObjComparator::kInstance.evaluate(*lastMax == rangeMin)) {
-            if (SimpleBSONObjComparator::kInstance.evaluate(*lastMax < rangeMin))
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream() << "Gap exists in the routing table between chunks "
-                                        << findIntersectingChunk(*lastMax)->getRange().toString()
-                                        << " and " << rangeLast->getRange().toString());
-            else
-                uasserted(ErrorCodes::ConflictingOperationInProgress,
-                          str::stream() << "Overlap exists in the routing table between chunks "
-                                        << findIntersectingChunk(*lastMax)->getRange().toString()
-                                        << " and " << rangeLast->getRange().toString());
+            // Tracks the max shard version for the shard on which the current range will reside
+            auto shardVersionIt = shardVersions.find(chunkShardId);
+            if (shardVersionIt == shardVersions.end()) {
+                shardVersionIt =
+                    shardVersions
+                        .emplace(std::piecewise_construct,
+                                 std::forward_as_tuple(chunkShardId),
+                                 std::forward_as_tuple(_collectionVersion.epoch(),
+                                                       _collectionVersion.getTimestamp()))
+                        .first;
+            }
+            maxShardVersion = &shardVersionIt->second.shardVersion;
         }
 
-        if (!firstMin)
-            firstMin = rangeMin;
+        if (maxShardVersion->isOlderThan(chunk->getLastmod()))
+            *maxShardVersion = chunk->getLastmod();
 
-        lastMax = rangeMax;
+        prevChunk = chunk;
+        return true;
+    });
 
-        // If a shard has chunks it must have a shard version, otherwise we have an invalid chunk
-        // somewhere, which should have been caught at chunk load time
-        invariant(maxShardVersion.isSet());
+    if (prevChunk) {
+        invariant(maxShardVersion->isSet());
+        lastMax = prevChunk->getMax();
     }
 
-    if (!_chunkMap.empty()) {
+    if (!_chunkBuckets.empty()) {
         invariant(!shardVersions.empty());
         invariant(firstMin.is_initialized());
         invariant(lastMax.is_initialized());
@@ -207,8 +209,65 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
 }
 
 void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
-    appendChunkTo(_chunkMap, chunk);
-    const auto chunkVersion = chunk->getLastmod();
+    const auto lastChunk = _lastChunk();
+    if (lastChunk && chunk->getRange().overlaps(lastChunk->getRange())) {
+        // Of two overlapping chunks, keep the newer one.
+        if (lastChunk->getLastmod().isOlderThan(chunk->getLastmod())) {
+            _replaceLastChunk(chunk);
+        }
+    } else {
+        _pushChunk(chunk);
+    }
+
+    _updateCollectionVersion(chunk->getLastmod());
+}
+
+std::shared_ptr<ChunkInfo> ChunkMap::_lastChunk() const {
+    if (_chunkBuckets.empty())
+        return nullptr;
+
+    return _chunkBuckets.back().chunks->back();
+}
+
+void ChunkMap::_pushChunk(const std::shared_ptr<ChunkInfo>& chunk) {
+    if (!_tailOpen || _chunkBuckets.back().chunks->size() >= kMaxChunksPerBucket) {
+        _chunkBuckets.push_back(
+            {std::make_shared<ChunkVector>(),
+             ChunkVersion(0, 0, _collectionVersion.epoch(), _collectionVersion.getTimestamp())});
+        _chunkBuckets.back().chunks->reserve(kMaxChunksPerBucket);
+        _tailOpen = true;
+    }
+
+    auto& bucket = _chunkBuckets.back();
+    bucket.chunks->push_back(chunk);
+    if (bucket.maxLastmod.isOlderThan(chunk->getLastmod()))
+        bucket.maxLastmod = chunk->getLastmod();
+    ++_size;
+}
+
+void ChunkMap::_replaceLastChunk(const std::shared_ptr<ChunkInfo>& chunk) {
+    auto& bucket = _chunkBuckets.back();
+    if (!_tailOpen) {
+        // The tail bucket is shared with the map this one was created from, so it must be copied
+        // before being mutated.
+        bucket.chunks = std::make_shared<ChunkVector>(*bucket.chunks);
+        _tailOpen = true;
+    }
+
+    bucket.chunks->back() = chunk;
+    if (bucket.maxLastmod.isOlderThan(chunk->getLastmod()))
+        bucket.maxLastmod = chunk->getLastmod();
+}
+
+void ChunkMap::_appendBucket(const ChunkBucket& bucket) {
+    dassert(!bucket.chunks->empty());
+    _chunkBuckets.push_back(bucket);
+    _tailOpen = false;
+    _size += bucket.chunks->size();
+    _updateCollectionVersion(bucket.maxLastmod);
+}
+
+void ChunkMap::_updateCollectionVersion(const ChunkVersion& chunkVersion) {
     if (_collectionVersion.isOlderThan(chunkVersion)) {
         _collectionVersion = ChunkVersion(chunkVersion.majorVersion(),
                                           chunkVersion.minorVersion(),
@@ -218,51 +277,66 @@ void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
 }
 
 std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardKey) const {
-    const auto it = _findIntersectingChunk(shardKey);
+    const auto pos = _findIntersectingChunk(shardKey);
 
-    if (it != _chunkMap.end())
-        return *it;
+    if (pos.bucketIndex < _chunkBuckets.size())
+        return _chunkAt(pos);
 
     return std::shared_ptr<ChunkInfo>();
 }
 
 ChunkMap ChunkMap::createMerged(
     const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const {
-    size_t chunkMapIndex = 0;
+    ChunkMap updatedChunkMap(
+        getVersion().epoch(), getVersion().getTimestamp(), _size + changedChunks.size());
+
+    // Min keys of the changed chunks in KeyString form, used to decide whether a whole bucket is
+    // untouched by the update and may be shared instead of copied.
+    std::vector<std::string> changedMinKeyStrings;
+    changedMinKeyStrings.reserve(changedChunks.size());
+    for (const auto& changedChunk : changedChunks) {
+        changedMinKeyStrings.push_back(ShardKeyPattern::toKeyString(changedChunk->getMin()));
+    }
+
     size_t changedChunkIndex = 0;
 
-    ChunkMap updatedChunkMap(
-        getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
+    for (const auto& bucket : _chunkBuckets) {
+        // A bucket can be shared as-is when no remaining changed chunk intersects it and the last
+        // chunk appended so far does not overlap its first chunk (the latter can only happen
+        // right after consuming a changed chunk that extends into this bucket).
+        const bool intersectsChanged = changedChunkIndex < changedChunks.size() &&
+            changedMinKeyStrings[changedChunkIndex] < bucket.chunks->back()->getMaxKeyString();
 
-    while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
-        if (chunkMapIndex >= _chunkMap.size()) {
-            validateChunkIsNotOlderThan(changedChunks[changedChunkIndex], getVersion());
-            updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
-            continue;
-        }
+        const auto lastChunk = updatedChunkMap._lastChunk();
+        const bool conflictsWithTail =
+            lastChunk && lastChunk->getRange().overlaps(bucket.chunks->front()->getRange());
 
-        if (changedChunkIndex >= changedChunks.size()) {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+        if (!intersectsChanged && !conflictsWithTail) {
+            updatedChunkMap._appendBucket(bucket);
             continue;
         }
 
-        auto overlap = _chunkMap[chunkMapIndex]->getRange().overlaps(
-            changedChunks[changedChunkIndex]->getRange());
+        for (const auto& chunkInfo : *bucket.chunks) {
+            while (changedChunkIndex < changedChunks.size() &&
+                   chunkInfo->getRange().overlaps(changedChunks[changedChunkIndex]->getRange())) {
+                const auto& changedChunk = changedChunks[changedChunkIndex++];
 
-        if (overlap) {
-            auto& changedChunk = changedChunks[changedChunkIndex++];
-            auto& chunkInfo = _chunkMap[chunkMapIndex];
+                auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
+                changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
 
-            auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
-            changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
+                validateChunkIsNotOlderThan(changedChunk, getVersion());
+                updatedChunkMap.appendChunk(changedChunk);
+            }
 
-            validateChunkIsNotOlderThan(changedChunk, getVersion());
-            updatedChunkMap.appendChunk(changedChunk);
-        } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+            updatedChunkMap.appendChunk(chunkInfo);
         }
     }
 
+    while (changedChunkIndex < changedChunks.size()) {
+        validateChunkIsNotOlderThan(changedChunks[changedChunkIndex], getVersion());
+        updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
+    }
+
     return updatedChunkMap;
 }
 
@@ -270,53 +344,101 @@ BSONObj ChunkMap::toBSON() const {
     BSONObjBuilder builder;
 
     getVersion().serializeToBSON("startingVersion"_sd, &builder);
-    builder.append("chunkCount", static_cast<int64_t>(_chunkMap.size()));
+    builder.append("chunkCount", static_cast<int64_t>(_size));
 
     {
         BSONArrayBuilder arrayBuilder(builder.subarrayStart("chunks"_sd));
-        for (const auto& chunk : _chunkMap) {
+        forEach([&arrayBuilder](const auto& chunk) {
             arrayBuilder.append(chunk->toString());
-        }
+            return true;
+        });
     }
 
     return builder.obj();
 }
 
-ChunkMap::ChunkVector::const_iterator ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
-                                                                       bool isMaxInclusive) const {
-    auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
+ChunkMap::Position ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
+                                                    bool isMaxInclusive) const {
+    const auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
 
+    // Find the bucket holding the first chunk whose max may satisfy the query, by binary search
+    // over the max key of each bucket's last chunk, then locate the chunk within that bucket.
     if (!isMaxInclusive) {
-        return std::lower_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const auto& chunkInfo, const BSONObj& shardKey) {
-                                    return chunkInfo->getMaxKeyString() < shardKeyString;
-                                });
+        auto bucketIt = std::lower_bound(_chunkBuckets.begin(),
+                                         _chunkBuckets.end(),
+                                         shardKeyString,
+                                         [](const auto& bucket, const std::string& keyString) {
+                                             return bucket.chunks->back()->getMaxKeyString() <
+                                                 keyString;
+                                         });
+        if (bucketIt == _chunkBuckets.end())
+            return {_chunkBuckets.size(), 0};
+
+        const auto& chunks = *bucketIt->chunks;
+        auto chunkIt = std::lower_bound(chunks.begin(),
+                                        chunks.end(),
+                                        shardKeyString,
+                                        [](const auto& chunkInfo, const std::string& keyString) {
+                                            return chunkInfo->getMaxKeyString() < keyString;
+                                        });
+        return {static_cast<size_t>(bucketIt - _chunkBuckets.begin()),
+                static_cast<size_t>(chunkIt - chunks.begin())};
     } else {
-        return std::upper_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const BSONObj& shardKey, const auto& chunkInfo) {
-                                    return shardKeyString < chunkInfo->getMaxKeyString();
-                                });
+        auto bucketIt = std::upper_bound(_chunkBuckets.begin(),
+                                         _chunkBuckets.end(),
+                                         shardKeyString,
+                                         [](const std::string& keyString, const auto& bucket) {
+                                             return keyString <
+                                                 bucket.chunks->back()->getMaxKeyString();
+                                         });
+        if (bucketIt == _chunkBuckets.end())
+            return {_chunkBuckets.size(), 0};
+
+        const auto& chunks = *bucketIt->chunks;
+        auto chunkIt = std::upper_bound(chunks.begin(),
+                                        chunks.end(),
+                                        shardKeyString,
+                                        [](const std::string& keyString, const auto& chunkInfo) {
+                                            return keyString < chunkInfo->getMaxKeyString();
+                                        });
+        return {static_cast<size_t>(bucketIt - _chunkBuckets.begin()),
+                static_cast<size_t>(chunkIt - chunks.begin())};
     }
 }
 
-std::pair<ChunkMap::ChunkVector::const_iterator, ChunkMap::ChunkVector::const_iterator>
-ChunkMap::_overlappingBounds(const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
-    const auto itMin = _findIntersectingChunk(min);
-    const auto itMax = [&]() {
-        auto it = _findIntersectingChunk(max, isMaxInclusive);
-        return it == _chunkMap.end() ? it : ++it;
+std::pair<ChunkMap::Position, ChunkMap::Position> ChunkMap::_overlappingBounds(
+    const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
+    const auto posMin = _findIntersectingChunk(min);
+    const auto posMax = [&]() {
+        auto pos = _findIntersectingChunk(max, isMaxInclusive);
+        return pos.bucketIndex >= _chunkBuckets.size() ? pos : _nextPosition(pos);
     }();
 
-    return {itMin, itMax};
+    return {posMin, posMax};
 }
 
 ShardVersionTargetingInfo::ShardVersionTargetingInfo(const OID& epoch, const Timestamp& timestamp)
     : shardVersion(0, 0, epoch, timestamp) {}
 
+std::shared_ptr<ChunkInfo> ShardKeyToChunkCache::find(const BSONObj& shardKey) {
+    std::string key(shardKey.objdata(), shardKey.objsize());
+    auto& stripe = _stripeFor(key);
+
+    stdx::lock_guard<Latch> lk(stripe.mutex);
+    auto it = stripe.cache.find(key);
+    if (it == stripe.cache.end())
+        return nullptr;
+    return it->second;
+}
+
+void ShardKeyToChunkCache::add(const BSONObj& shardKey, std::shared_ptr<ChunkInfo> chunk) {
+    std::string key(shardKey.objdata(), shardKey.objsize());
+    auto& stripe = _stripeFor(key);
+
+    stdx::lock_guard<Latch> lk(stripe.mutex);
+    stripe.cache.add(key, std::move(chunk));
+}
+
 RoutingTableHistory::RoutingTableHistory(
     NamespaceString nss,
     UUID uuid,
@@ -338,8 +460,22 @@ RoutingTableHistory::RoutingTableHistory(
       _maxChunkSizeBytes(maxChunkSizeBytes),
       _allowMigrations(allowMigrations),
       _chunkMap(std::move(chunkMap)),
+      _shardKeyToChunkCache(std::make_unique<ShardKeyToChunkCache>()),
       _shardVersions(_chunkMap.constructShardVersionMap()) {}
 
+std::shared_ptr<ChunkInfo> RoutingTableHistory::findIntersectingChunk(
+    const BSONObj& shardKey) const {
+    if (auto chunk = _shardKeyToChunkCache->find(shardKey)) {
+        return chunk;
+    }
+
+    auto chunk = _chunkMap.findIntersectingChunk(shardKey);
+    if (chunk) {
+        _shardKeyToChunkCache->add(shardKey, chunk);
+    }
+    return chunk;
+}
+
 void RoutingTableHistory::setShardStale(const ShardId& shardId) {
     if (gEnableFinerGrainedCatalogCacheRefresh) {
         auto it = _shardVersions.find(shardId);
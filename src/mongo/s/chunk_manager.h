@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <set>
 #include <string>
 #include <vector>
@@ -36,6 +37,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/s/chunk.h"
 #include "mongo/s/database_version.h"
 #include "mongo/s/resharding/type_collection_fields_gen.h"
@@ -43,6 +45,7 @@
 #include "mongo/s/type_collection_common_types_gen.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/lru_cache.h"
 #include "mongo/util/read_through_cache.h"
 
 namespace mongo {
@@ -74,14 +77,44 @@ class ChunkMap {
     // Vector of chunks ordered by max key.
     using ChunkVector = std::vector<std::shared_ptr<ChunkInfo>>;
 
+    /**
+     * A run of at most 'kMaxChunksPerBucket' consecutive chunks. Once a bucket is no longer the
+     * tail of the map it is logically immutable: 'createMerged()' shares the buckets that are not
+     * intersected by any changed chunk with the updated ChunkMap it produces, so a routing table
+     * refresh only copies the buckets it actually changes.
+     */
+    struct ChunkBucket {
+        std::shared_ptr<ChunkVector> chunks;
+
+        // Max lastmod across every chunk ever appended to the bucket; used to roll the collection
+        // version forward without rescanning shared buckets.
+        ChunkVersion maxLastmod;
+    };
+
+    /**
+     * Position of a chunk in the two-level bucket structure. The past-the-end position is
+     * normalized to {number of buckets, 0}.
+     */
+    struct Position {
+        size_t bucketIndex = 0;
+        size_t chunkIndex = 0;
+
+        bool operator==(const Position& other) const {
+            return bucketIndex == other.bucketIndex && chunkIndex == other.chunkIndex;
+        }
+        bool operator!=(const Position& other) const {
+            return !(*this == other);
+        }
+    };
+
 public:
     explicit ChunkMap(OID epoch, const Timestamp& timestamp, size_t initialCapacity = 0)
         : _collectionVersion(0, 0, epoch, timestamp), _collTimestamp(timestamp) {
-        _chunkMap.reserve(initialCapacity);
+        _chunkBuckets.reserve(initialCapacity / kMaxChunksPerBucket + 1);
     }
 
     size_t size() const {
-        return _chunkMap.size();
+        return _size;
     }
 
     ChunkVersion getVersion() const {
@@ -90,11 +123,14 @@ public:
 
     template <typename Callable>
     void forEach(Callable&& handler, const BSONObj& shardKey = BSONObj()) const {
-        auto it = shardKey.isEmpty() ? _chunkMap.begin() : _findIntersectingChunk(shardKey);
-
-        for (; it != _chunkMap.end(); ++it) {
-            if (!handler(*it))
-                break;
+        auto pos = shardKey.isEmpty() ? Position{} : _findIntersectingChunk(shardKey);
+
+        for (; pos.bucketIndex < _chunkBuckets.size(); ++pos.bucketIndex, pos.chunkIndex = 0) {
+            const auto& chunks = *_chunkBuckets[pos.bucketIndex].chunks;
+            for (; pos.chunkIndex < chunks.size(); ++pos.chunkIndex) {
+                if (!handler(chunks[pos.chunkIndex]))
+                    return;
+            }
         }
     }
 
@@ -105,8 +141,8 @@ public:
                                  Callable&& handler) const {
         const auto bounds = _overlappingBounds(min, max, isMaxInclusive);
 
-        for (auto it = bounds.first; it != bounds.second; ++it) {
-            if (!handler(*it))
+        for (auto pos = bounds.first; pos != bounds.second; pos = _nextPosition(pos)) {
+            if (!handler(_chunkAt(pos)))
                 break;
         }
     }
@@ -121,12 +157,39 @@ public:
     BSONObj toBSON() const;
 
 private:
-    ChunkVector::const_iterator _findIntersectingChunk(const BSONObj& shardKey,
-                                                       bool isMaxInclusive = true) const;
-    std::pair<ChunkVector::const_iterator, ChunkVector::const_iterator> _overlappingBounds(
-        const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const;
+    static constexpr size_t kMaxChunksPerBucket = 512;
+
+    Position _findIntersectingChunk(const BSONObj& shardKey, bool isMaxInclusive = true) const;
+    std::pair<Position, Position> _overlappingBounds(const BSONObj& min,
+                                                     const BSONObj& max,
+                                                     bool isMaxInclusive) const;
+
+    const std::shared_ptr<ChunkInfo>& _chunkAt(const Position& pos) const {
+        return (*_chunkBuckets[pos.bucketIndex].chunks)[pos.chunkIndex];
+    }
+
+    Position _nextPosition(Position pos) const {
+        if (++pos.chunkIndex >= _chunkBuckets[pos.bucketIndex].chunks->size()) {
+            ++pos.bucketIndex;
+            pos.chunkIndex = 0;
+        }
+        return pos;
+    }
+
+    std::shared_ptr<ChunkInfo> _lastChunk() const;
+    void _pushChunk(const std::shared_ptr<ChunkInfo>& chunk);
+    void _replaceLastChunk(const std::shared_ptr<ChunkInfo>& chunk);
+    void _appendBucket(const ChunkBucket& bucket);
+    void _updateCollectionVersion(const ChunkVersion& chunkVersion);
+
+    // Buckets of chunks ordered by max key. All buckets are non-empty.
+    std::vector<ChunkBucket> _chunkBuckets;
 
-    ChunkVector _chunkMap;
+    // Whether the last bucket is still exclusively owned by this map and may be appended to.
+    bool _tailOpen{false};
+
+    // Total number of chunks across all buckets.
+    size_t _size{0};
 
     // Max version across all chunks
     ChunkVersion _collectionVersion;
@@ -140,6 +203,45 @@ private:
     Timestamp _collTimestamp;
 };
 
+/**
+ * A striped LRU cache from shard key value to the chunk that contains it, used to serve repeated
+ * single-document targeting (e.g. a stream of updates keyed by the same customer ids) without
+ * re-walking the chunk map for every write.
+ *
+ * Each RoutingTableHistory owns its own instance. Since routing tables are immutable and any
+ * epoch or placement version change produces a new RoutingTableHistory, a refresh implicitly
+ * swaps in a fresh, empty cache and entries can never go stale. The stripes keep concurrent
+ * targeting threads on a router from serializing on a single mutex.
+ */
+class ShardKeyToChunkCache {
+public:
+    /**
+     * Returns the cached chunk for 'shardKey', or nullptr if the key has not been looked up (or
+     * has been evicted) since this routing table was constructed.
+     */
+    std::shared_ptr<ChunkInfo> find(const BSONObj& shardKey);
+
+    void add(const BSONObj& shardKey, std::shared_ptr<ChunkInfo> chunk);
+
+private:
+    static constexpr size_t kNumStripes = 8;
+    static constexpr size_t kEntriesPerStripe = 512;
+
+    struct Stripe {
+        Mutex mutex = MONGO_MAKE_LATCH("ShardKeyToChunkCache::Stripe::mutex");
+
+        // Keyed by the shard key's BSON bytes, so only an exact repeat of a previously targeted
+        // key can hit.
+        LRUCache<std::string, std::shared_ptr<ChunkInfo>> cache{kEntriesPerStripe};
+    };
+
+    Stripe& _stripeFor(const std::string& key) {
+        return _stripes[std::hash<std::string>{}(key) % kNumStripes];
+    }
+
+    std::array<Stripe, kNumStripes> _stripes;
+};
+
 /**
  * In-memory representation of the routing table for a single sharded collection at various points
  * in time.
@@ -263,9 +365,7 @@ public:
             min, max, isMaxInclusive, std::forward<Callable>(handler));
     }
 
-    std::shared_ptr<ChunkInfo> findIntersectingChunk(const BSONObj& shardKey) const {
-        return _chunkMap.findIntersectingChunk(shardKey);
-    }
+    std::shared_ptr<ChunkInfo> findIntersectingChunk(const BSONObj& shardKey) const;
 
     /**
      * Returns the ids of all shards on which the collection has any chunks.
@@ -357,6 +457,10 @@ private:
     // ranges must cover the complete space from [MinKey, MaxKey).
     ChunkMap _chunkMap;
 
+    // Caches findIntersectingChunk() results. Behind a unique_ptr so that RoutingTableHistory
+    // stays movable; never null.
+    std::unique_ptr<ShardKeyToChunkCache> _shardKeyToChunkCache;
+
     // The representation of shard versions and staleness indicators for this namespace. If a
     // shard does not exist, it will not have an entry in the map.
     // Note: this declaration must not be moved before _chunkMap since it is initialized by using
@@ -170,4 +170,62 @@ TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     ASSERT_EQ(count, 3);
 }
 
+TEST_F(ChunkMapTest, TestUpdateMapSpanningMultipleBuckets) {
+    const OID epoch = OID::gen();
+    ChunkMap chunkMap{epoch, Timestamp(1, 1)};
+    ChunkVersion version{1, 0, epoch, Timestamp(1, 1)};
+
+    // Use enough chunks that the map spans several of its internal buckets.
+    const int numChunks = 1200;
+    std::vector<std::shared_ptr<ChunkInfo>> initialChunks;
+    initialChunks.reserve(numChunks);
+    for (int i = 0; i < numChunks; ++i) {
+        auto min = i == 0 ? getShardKeyPattern().globalMin() : BSON("a" << i);
+        auto max = i == numChunks - 1 ? getShardKeyPattern().globalMax() : BSON("a" << i + 1);
+        initialChunks.push_back(std::make_shared<ChunkInfo>(
+            ChunkType{uuid(), ChunkRange{std::move(min), std::move(max)}, version, kThisShard}));
+    }
+
+    auto initialChunkMap = chunkMap.createMerged(initialChunks);
+    ASSERT_EQ(initialChunkMap.size(), numChunks);
+
+    // Split a chunk in the middle of the map and verify that the updated map remains ordered and
+    // continuous across the buckets it shares with the initial map.
+    ChunkVersion newVersion{2, 0, epoch, Timestamp(1, 1)};
+    auto updatedChunkMap = initialChunkMap.createMerged(
+        {std::make_shared<ChunkInfo>(ChunkType{uuid(),
+                                               ChunkRange{BSON("a" << 600), BSON("a" << 600.5)},
+                                               newVersion,
+                                               kThisShard}),
+         std::make_shared<ChunkInfo>(ChunkType{uuid(),
+                                               ChunkRange{BSON("a" << 600.5), BSON("a" << 601)},
+                                               newVersion,
+                                               kThisShard})});
+
+    ASSERT_EQ(updatedChunkMap.size(), numChunks + 1);
+    ASSERT(updatedChunkMap.getVersion() == newVersion);
+
+    int count = 0;
+    boost::optional<BSONObj> lastMax;
+    updatedChunkMap.forEach([&](const auto& chunkInfo) {
+        if (lastMax) {
+            ASSERT(SimpleBSONObjComparator::kInstance.evaluate(*lastMax == chunkInfo->getMin()));
+        }
+        lastMax = chunkInfo->getMax();
+        count++;
+
+        return true;
+    });
+
+    ASSERT_EQ(count, updatedChunkMap.size());
+
+    auto intersectingChunk = updatedChunkMap.findIntersectingChunk(BSON("a" << 600.2));
+
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << 600)));
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMax() ==
+                                                       BSON("a" << 600.5)));
+}
+
 }  // namespace mongo
@@ -197,6 +197,13 @@ ShardRegistry::Cache::LookupResult ShardRegistry::_lookup(OperationContext* opCt
                 "Finished ShardRegistry::_lookup",
                 "returnData"_attr = returnData.toBSON(),
                 "returnTime"_attr = returnTime);
+
+    // Republish the new data as an immutable snapshot, so that getShard() and the "NoReload"
+    // accessors can probe it without going through the cache. Lookups for the singleton key are
+    // serialized by the cache, so the snapshot never goes backwards in time.
+    std::atomic_store(&_latestSnapshot,  // NOLINT
+                      std::make_shared<const Snapshot>(returnData, returnTime));
+
     return Cache::LookupResult{returnData, returnTime};
 }
 
@@ -272,6 +279,23 @@ std::shared_ptr<Shard> ShardRegistry::getConfigShard() const {
 
 StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opCtx,
                                                            const ShardId& shardId) {
+    // Fast path: probe the latest snapshot published by _lookup(). A hit is equivalent to the
+    // cache acquisition below as long as the snapshot is not stale with respect to the times the
+    // cache would wait on, so validate it against the latest gossiped topologyTime and this
+    // registry's increments before trusting it. Everything here other than the topologyTime read
+    // is a wait-free atomic load.
+    if (auto snapshot = std::atomic_load(&_latestSnapshot)) {  // NOLINT
+        if (auto shard = snapshot->data.findShard(shardId)) {
+            const Time latestKnownTime{
+                VectorClock::get(opCtx)->getTime().topologyTime().asTimestamp(),
+                _rsmIncrement.load(),
+                _forceReloadIncrement.load()};
+            if (snapshot->time >= latestKnownTime) {
+                return shard;
+            }
+        }
+    }
+
     // First check if this is a non config shard lookup
     // This call will may be blocking if there is an ongoing or a need of a cache rebuild
     if (auto shard = _getData(opCtx)->findShard(shardId)) {
@@ -427,6 +451,14 @@ SharedSemiFuture<ShardRegistry::Cache::ValueHandle> ShardRegistry::_reloadIntern
 
 void ShardRegistry::clearEntries() {
     LOGV2_DEBUG(6471800, 1, "Invalidating Shard Registry");
+
+    // Retire the fast-path snapshot along with the cache entry. Bumping the forceReloadIncrement
+    // also ensures that a concurrently completing _lookup() cannot republish a snapshot that would
+    // pass getShard()'s staleness check, since such a snapshot necessarily carries the old
+    // increment.
+    std::atomic_store(&_latestSnapshot, std::shared_ptr<const Snapshot>());  // NOLINT
+    _forceReloadIncrement.addAndFetch(1);
+
     _cache->invalidateAll();
 }
 
@@ -521,6 +553,11 @@ std::shared_ptr<Shard> ShardRegistry::getShardNoReload(const ShardId& shardId) c
             return shard;
         }
     }
+    // These accessors are explicitly not causally consistent, so the latest published snapshot is
+    // as good as the cache's latest value and can be probed without taking the cache's mutex.
+    if (auto snapshot = std::atomic_load(&_latestSnapshot)) {  // NOLINT
+        return snapshot->data.findShard(shardId);
+    }
     auto data = _getCachedData();
     return data->findShard(shardId);
 }
@@ -533,6 +570,9 @@ std::shared_ptr<Shard> ShardRegistry::getShardForHostNoReload(const HostAndPort&
             return shard;
         }
     }
+    if (auto snapshot = std::atomic_load(&_latestSnapshot)) {  // NOLINT
+        return snapshot->data.findByHostAndPort(host);
+    }
     auto data = _getCachedData();
     return data->findByHostAndPort(host);
 }
@@ -466,6 +466,23 @@ private:
     mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("ShardRegistry::_cacheMutex");
     std::unique_ptr<Cache> _cache;
 
+    /**
+     * The ShardRegistryData most recently returned by _lookup(), together with the Time it
+     * corresponds to. This is the same value the _cache holds, republished as an immutable
+     * snapshot so that getShard() and the "NoReload" accessors can resolve a shard with a single
+     * atomic load and hash probe, instead of going through the cache's mutex and future
+     * machinery. The pointed-to value is never mutated; _lookup() swaps in a whole new snapshot.
+     * Must be accessed via std::atomic_load/std::atomic_store.
+     */
+    struct Snapshot {
+        Snapshot(ShardRegistryData data, Time time)
+            : data(std::move(data)), time(std::move(time)) {}
+
+        const ShardRegistryData data;
+        const Time time;
+    };
+    std::shared_ptr<const Snapshot> _latestSnapshot;
+
     // Counters for incrementing the rsmIncrement and forceReloadIncrement fields of the Time used
     // by the _cache.  See the comments for these fields in the Time class above for an explanation
     // of their purpose.
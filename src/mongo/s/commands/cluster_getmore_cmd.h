@@ -101,12 +101,12 @@ public:
 
             Impl::checkCanRunHere(opCtx);
 
-            auto bob = reply->getBodyBuilder();
-            auto response = uassertStatusOK(ClusterFind::runGetMore(opCtx, _cmd));
-            response.addToBSON(CursorResponse::ResponseType::SubsequentResponse, &bob);
+            // The batch is streamed directly into 'reply' so that each document is copied into the
+            // response message exactly once.
+            uassertStatusOK(ClusterFind::runGetMore(opCtx, _cmd, reply));
 
             if (getTestCommandsEnabled()) {
-                validateResult(bob.asTempObj());
+                validateResult(reply->getBodyBuilder().asTempObj());
             }
         }
 
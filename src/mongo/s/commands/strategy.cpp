@@ -90,6 +90,7 @@
 #include "mongo/s/stale_exception.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/transport/hello_metrics.h"
+#include "mongo/transport/reply_buffer_pool.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/fail_point.h"
@@ -1168,7 +1169,16 @@ private:
 
 void ClientCommand::_parseMessage() try {
     const auto& msg = _rec->getMessage();
-    _rec->setReplyBuilder(rpc::makeReplyBuilder(rpc::protocolForMessage(msg)));
+    // Serialize the reply into the buffer recycled from the previous reply on this connection,
+    // if there is one, rather than a fresh allocation.
+    auto reuseBuffer = [&]() -> SharedBuffer {
+        if (const auto& session = _rec->getOpCtx()->getClient()->session()) {
+            return transport::ReplyBufferPool::forSession(session).acquire();
+        }
+        return {};
+    }();
+    _rec->setReplyBuilder(
+        rpc::makeReplyBuilder(rpc::protocolForMessage(msg), std::move(reuseBuffer)));
     auto opMsgReq = rpc::opMsgRequestFromAnyProtocol(msg);
     if (msg.operation() == dbQuery) {
         checkAllowedOpQueryCommand(*(_rec->getOpCtx()->getClient()), opMsgReq.getCommandName());
@@ -35,13 +35,18 @@
 
 #include <memory>
 
+#include "mongo/client/read_preference.h"
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/vector_clock.h"
 #include "mongo/logv2/log.h"
 #include "mongo/s/catalog/sharding_catalog_client.h"
+#include "mongo/s/catalog/type_chunk.h"
+#include "mongo/s/catalog/type_collection.h"
 #include "mongo/s/grid.h"
+#include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
+#include "mongo/s/request_types/get_routing_table_delta_gen.h"
 
 namespace mongo {
 
@@ -49,6 +54,64 @@ using CollectionAndChangedChunks = CatalogCacheLoader::CollectionAndChangedChunk
 
 namespace {
 
+CollectionAndChangedChunks makeCollectionAndChangedChunks(const CollectionType& coll,
+                                                          std::vector<ChunkType> changedChunks) {
+    return CollectionAndChangedChunks{coll.getEpoch(),
+                                      coll.getTimestamp(),
+                                      coll.getUuid(),
+                                      coll.getKeyPattern().toBSON(),
+                                      coll.getDefaultCollation(),
+                                      coll.getUnique(),
+                                      coll.getTimeseriesFields(),
+                                      coll.getReshardingFields(),
+                                      coll.getMaxChunkSizeBytes(),
+                                      coll.getAllowAutoSplit(),
+                                      coll.getAllowMigrations(),
+                                      std::move(changedChunks)};
+}
+
+/**
+ * Attempts to fetch the changed chunks through the config server's routing table delta command,
+ * which serves repeated identical requests from a cache of serialized responses. Returns
+ * boost::none if the config server does not support the command, in which case the caller falls
+ * back to the aggregation-based fetch.
+ */
+boost::optional<CollectionAndChangedChunks> getChangedChunksViaDeltaCommand(
+    OperationContext* opCtx, const NamespaceString& nss, ChunkVersion sinceVersion) {
+    ConfigsvrGetRoutingTableDelta request(nss);
+    request.setSinceVersion(sinceVersion);
+    request.setDbName(NamespaceString::kAdminDb);
+
+    auto swResponse =
+        Grid::get(opCtx)->shardRegistry()->getConfigShard()->runCommandWithFixedRetryAttempts(
+            opCtx,
+            ReadPreferenceSetting{ReadPreference::PrimaryOnly},
+            NamespaceString::kAdminDb.toString(),
+            request.toBSON({}),
+            Shard::RetryPolicy::kIdempotent);
+
+    const auto status = Shard::CommandResponse::getEffectiveStatus(swResponse);
+    if (status == ErrorCodes::CommandNotFound) {
+        // The config server predates the delta command (e.g. during an upgrade).
+        return boost::none;
+    }
+    uassertStatusOK(status);
+
+    const auto response = ConfigsvrGetRoutingTableDeltaResponse::parse(
+        IDLParserErrorContext("ConfigsvrGetRoutingTableDeltaResponse"),
+        swResponse.getValue().response);
+
+    const CollectionType coll(response.getCollection());
+    std::vector<ChunkType> changedChunks;
+    changedChunks.reserve(response.getChangedChunks().size());
+    for (const auto& chunkObj : response.getChangedChunks()) {
+        changedChunks.push_back(uassertStatusOK(
+            ChunkType::parseFromConfigBSON(chunkObj, coll.getEpoch(), coll.getTimestamp())));
+    }
+
+    return makeCollectionAndChangedChunks(coll, std::move(changedChunks));
+}
+
 /**
  * Blocking method, which returns the chunks which changed since the specified version.
  */
@@ -56,6 +119,16 @@ CollectionAndChangedChunks getChangedChunks(OperationContext* opCtx,
                                             const NamespaceString& nss,
                                             ChunkVersion sinceVersion,
                                             bool avoidSnapshotForRefresh) {
+    // Routers ask the config server for the delta rather than computing it via an aggregation, so
+    // that identical refreshes from the rest of the fleet can be served from the config server's
+    // response cache. The config server's own loader keeps reading locally.
+    if (serverGlobalParams.clusterRole != ClusterRole::ConfigServer &&
+        gEnableRoutingTableDeltaFetch && !avoidSnapshotForRefresh) {
+        if (auto collAndChunks = getChangedChunksViaDeltaCommand(opCtx, nss, sinceVersion)) {
+            return std::move(*collAndChunks);
+        }
+    }
+
     const auto readConcern = [&]() -> repl::ReadConcernArgs {
         // TODO SERVER-54394 always use snapshot read concern once
         // ephemeral storage engine supports it
@@ -74,19 +147,7 @@ CollectionAndChangedChunks getChangedChunks(OperationContext* opCtx,
     auto collAndChunks = Grid::get(opCtx)->catalogClient()->getCollectionAndChunks(
         opCtx, nss, sinceVersion, readConcern);
 
-    const auto& coll = collAndChunks.first;
-    return CollectionAndChangedChunks{coll.getEpoch(),
-                                      coll.getTimestamp(),
-                                      coll.getUuid(),
-                                      coll.getKeyPattern().toBSON(),
-                                      coll.getDefaultCollation(),
-                                      coll.getUnique(),
-                                      coll.getTimeseriesFields(),
-                                      coll.getReshardingFields(),
-                                      coll.getMaxChunkSizeBytes(),
-                                      coll.getAllowAutoSplit(),
-                                      coll.getAllowMigrations(),
-                                      std::move(collAndChunks.second)};
+    return makeCollectionAndChangedChunks(collAndChunks.first, std::move(collAndChunks.second));
 }
 
 }  // namespace
@@ -29,7 +29,12 @@
 
 #include "mongo/s/hedge_options_util.h"
 
+#include <algorithm>
+#include <limits>
+
+#include "mongo/platform/mutex.h"
 #include "mongo/s/mongos_server_parameters_gen.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -45,6 +50,53 @@ const std::set<std::string> supportedCmds{"collStats",
                                           "listCollections",
                                           "listIndexes",
                                           "planCacheListFilters"};
+
+/**
+ * Token bucket enforcing the 'maxHedgedReadsPerSecond' ceiling across all operations on this
+ * mongos. Reads that exceed the budget are simply sent without a hedge, so an aggressive
+ * hedging configuration degrades to normal reads rather than doubling the load on the shards.
+ */
+class HedgingBudget {
+public:
+    /**
+     * Takes one token from the budget if one is available, refilling the bucket according to
+     * the time elapsed since the last acquisition. Returns false if the budget is exhausted.
+     * A non-positive rate disables budget enforcement entirely.
+     */
+    bool tryAcquire() {
+        const auto ratePerSec = gMaxHedgedReadsPerSecond.load();
+        if (ratePerSec <= 0) {
+            return true;
+        }
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        const auto now = _timer.elapsed();
+        // Allow bursts of up to one second's worth of hedges.
+        _tokens = std::min(static_cast<double>(ratePerSec),
+                           _tokens +
+                               durationCount<Microseconds>(now - _lastRefill) * ratePerSec * 1e-6);
+        _lastRefill = now;
+
+        if (_tokens < 1) {
+            return false;
+        }
+        _tokens -= 1;
+        return true;
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("HedgingBudget::_mutex");
+    Timer _timer;
+    Microseconds _lastRefill{0};
+
+    // The bucket starts full; the first refill clamps this down to the configured rate.
+    double _tokens{std::numeric_limits<double>::max()};
+};
+
+HedgingBudget& hedgingBudget() {
+    static auto budget = new HedgingBudget();
+    return *budget;
+}
 }  // namespace
 
 boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeOptions(
@@ -56,9 +108,9 @@ boost::optional<executor::RemoteCommandRequestOnAny::HedgeOptions> extractHedgeO
 
     auto cmdName(cmdObj.firstElement().fieldNameStringData().toString());
 
-    if (supportedCmds.count(cmdName)) {
-        return executor::RemoteCommandRequestOnAny::HedgeOptions{1,
-                                                                 gMaxTimeMSForHedgedReads.load()};
+    if (supportedCmds.count(cmdName) && hedgingBudget().tryAcquire()) {
+        return executor::RemoteCommandRequestOnAny::HedgeOptions{
+            1, gMaxTimeMSForHedgedReads.load(), gHedgingDelayMS.load()};
     }
     return boost::none;
 }
@@ -68,7 +68,8 @@ protected:
                            const BSONObj& cmdObj,
                            const BSONObj& rspObj,
                            const bool hedge,
-                           const int maxTimeMSForHedgedReads = kMaxTimeMSForHedgedReadsDefault) {
+                           const int maxTimeMSForHedgedReads = kMaxTimeMSForHedgedReadsDefault,
+                           const int delayMS = 0) {
         setParameters(serverParameters);
 
         auto readPref = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(rspObj));
@@ -77,6 +78,7 @@ protected:
         if (hedge) {
             ASSERT_TRUE(hedgeOptions.has_value());
             ASSERT_EQ(hedgeOptions->maxTimeMSForHedgedReads, maxTimeMSForHedgedReads);
+            ASSERT_EQ(hedgeOptions->delayMS, delayMS);
         } else {
             ASSERT_FALSE(hedgeOptions.has_value());
         }
@@ -88,11 +90,15 @@ protected:
 
     static inline const std::string kReadHedgingModeFieldName = "readHedgingMode";
     static inline const std::string kMaxTimeMSForHedgedReadsFieldName = "maxTimeMSForHedgedReads";
+    static inline const std::string kMaxHedgedReadsPerSecondFieldName = "maxHedgedReadsPerSecond";
+    static inline const std::string kHedgingDelayMSFieldName = "hedgingDelayMS";
     static inline const int kMaxTimeMSForHedgedReadsDefault = 10;
 
     static inline const BSONObj kDefaultParameters =
         BSON(kReadHedgingModeFieldName << "on" << kMaxTimeMSForHedgedReadsFieldName
-                                       << kMaxTimeMSForHedgedReadsDefault);
+                                       << kMaxTimeMSForHedgedReadsDefault
+                                       << kMaxHedgedReadsPerSecondFieldName << 0
+                                       << kHedgingDelayMSFieldName << 0);
 
 private:
     ServiceContext::UniqueServiceContext _serviceCtx = ServiceContext::make();
@@ -187,5 +193,28 @@ TEST_F(HedgeOptionsUtilTestFixture, MaxTimeMSForHedgedReads) {
     checkHedgeOptions(parameters, cmdObj, rspObj, true, 100);
 }
 
+TEST_F(HedgeOptionsUtilTestFixture, HedgingDelay) {
+    const auto parameters = BSON(kHedgingDelayMSFieldName << 75);
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto rspObj = BSON("mode"
+                             << "nearest"
+                             << "hedge" << BSONObj());
+
+    checkHedgeOptions(parameters, cmdObj, rspObj, true, kMaxTimeMSForHedgedReadsDefault, 75);
+}
+
+TEST_F(HedgeOptionsUtilTestFixture, HedgingBudgetExhaustion) {
+    const auto parameters = BSON(kMaxHedgedReadsPerSecondFieldName << 1);
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto rspObj = BSON("mode"
+                             << "nearest"
+                             << "hedge" << BSONObj());
+
+    // The budget allows one hedged read per second, so the first extraction succeeds and the
+    // second, issued immediately after, falls back to an unhedged read.
+    checkHedgeOptions(parameters, cmdObj, rspObj, true);
+    checkHedgeOptions(parameters, cmdObj, rspObj, false);
+}
+
 }  // namespace
 }  // namespace mongo
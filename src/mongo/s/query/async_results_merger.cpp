@@ -41,6 +41,7 @@
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/kill_cursors_gen.h"
 #include "mongo/db/query/query_feature_flags_gen.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/s/catalog/type_shard.h"
@@ -107,8 +108,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _mergeQueue(MergingComparator(_remotes, _params.getSort().value_or(BSONObj()))),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -323,8 +323,7 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
 
     auto smallestRemote = _mergeQueue.top();
     auto smallestResult = _remotes[smallestRemote].docBuffer.front();
-    auto keyWeWantToReturn =
-        extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
+    auto keyWeWantToReturn = smallestResult.getSortKey();
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
     auto minPromisedSortKey = _getMinPromisedSortKey(lk);
     invariant(minPromisedSortKey);
@@ -362,7 +361,37 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
         return {ClusterQueryResult()};
     }
 
-    return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
+    auto result = _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
+
+    // Consuming a result may have drained a buffer to the prefetch watermark; if so, get the next
+    // batch in flight now rather than when the buffer runs dry.
+    _schedulePrefetches(lk);
+
+    return result;
+}
+
+void AsyncResultsMerger::_schedulePrefetches(WithLock lk) {
+    // Prefetching needs an OperationContext to schedule the getMore against, and may not apply to
+    // tailable cursors since their getMores may block on the remote waiting for new data.
+    const auto prefetchWatermark =
+        static_cast<size_t>(internalQueryAsyncResultsMergerPrefetchWatermark.load());
+    if (!prefetchWatermark || !_opCtx || _tailableMode != TailableModeEnum::kNormal ||
+        _lifecycleState != kAlive) {
+        return;
+    }
+
+    for (size_t i = 0; i < _remotes.size(); ++i) {
+        auto& remote = _remotes[i];
+
+        if (!remote.status.isOK() || remote.exhausted() || remote.cbHandle.isValid() ||
+            remote.docBuffer.size() > prefetchWatermark) {
+            continue;
+        }
+
+        // Prefetching is best effort: if the getMore cannot be scheduled now, the regular
+        // 'nextEvent()' path will schedule (and surface any error from) it later.
+        _askForNextBatch(lk, i).ignore();
+    }
 }
 
 ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
@@ -391,8 +420,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
         if (_remotes[smallestRemote].eligibleForHighWaterMark) {
-            _highWaterMark =
-                extractSortKey(*front.getResult(), _params.getCompareWholeSortKey()).getOwned();
+            _highWaterMark = front.getSortKey().getOwned();
         }
     }
 
@@ -475,11 +503,24 @@ Status AsyncResultsMerger::_askForNextBatch(WithLock, size_t remoteIndex) {
     executor::RemoteCommandRequest request(
         remote.getTargetHost(), remote.cursorNss.db().toString(), cmdObj, _opCtx);
 
-    auto callbackStatus =
-        _executor->scheduleRemoteCommand(request, [this, remoteIndex](auto const& cbData) {
-            stdx::lock_guard<Latch> lk(this->_mutex);
-            this->_handleBatchResponse(lk, cbData, remoteIndex);
-        });
+    // For ordinary cursors outside of transactions, the shard may stream subsequent batches via
+    // the exhaust protocol, saving a request/response round trip per batch. Tailable cursors are
+    // excluded: their getMores carry evolving maxTimeMS values that an exhaust stream would
+    // keep reusing.
+    const bool useExhaust = internalQueryUseExhaustForClusterGetMores.load() &&
+        _tailableMode == TailableModeEnum::kNormal && !_params.getTxnNumber();
+
+    auto callbackStatus = useExhaust
+        ? _executor->scheduleExhaustRemoteCommand(request,
+                                                  [this, remoteIndex](auto const& cbData) {
+                                                      stdx::lock_guard<Latch> lk(this->_mutex);
+                                                      this->_handleExhaustBatchResponse(
+                                                          lk, cbData, remoteIndex);
+                                                  })
+        : _executor->scheduleRemoteCommand(request, [this, remoteIndex](auto const& cbData) {
+              stdx::lock_guard<Latch> lk(this->_mutex);
+              this->_handleBatchResponse(lk, cbData, remoteIndex);
+          });
 
     if (!callbackStatus.isOK()) {
         return callbackStatus.getStatus();
@@ -498,6 +539,14 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
     // Before scheduling more work, check whether the cursor has been invalidated.
     _assertNotInvalidated(lk);
 
+    // When prefetching is enabled, a getMore is issued to a remote as soon as its buffer falls to
+    // the watermark rather than only once it is fully drained, so the next batch is (ideally)
+    // already in flight by the time the merger needs it. Tailable cursors are excluded since their
+    // getMores may block on the remote waiting for new data.
+    const auto prefetchWatermark = _tailableMode == TailableModeEnum::kNormal
+        ? static_cast<size_t>(internalQueryAsyncResultsMergerPrefetchWatermark.load())
+        : 0;
+
     // Schedule remote work on hosts for which we need more results.
     for (size_t i = 0; i < _remotes.size(); ++i) {
         auto& remote = _remotes[i];
@@ -506,7 +555,9 @@ Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
             return remote.status;
         }
 
-        if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid()) {
+        const bool buffersLow = !remote.hasNext() || remote.docBuffer.size() <= prefetchWatermark;
+
+        if (buffersLow && !remote.exhausted() && !remote.cbHandle.isValid()) {
             // If this remote is not exhausted and there is no outstanding request for it, schedule
             // work to retrieve the next batch.
             auto nextBatchStatus = _askForNextBatch(lk, i);
@@ -708,6 +759,31 @@ void AsyncResultsMerger::_handleBatchResponse(WithLock lk,
     _signalCurrentEventIfReady(lk);  // Wake up anyone waiting on '_currentEvent'.
 }
 
+void AsyncResultsMerger::_handleExhaustBatchResponse(WithLock lk,
+                                                     CbData const& cbData,
+                                                     size_t remoteIndex) {
+    // The stream ends when the remote leaves the moreToCome flag unset, which it does once the
+    // cursor is exhausted or an error occurs. Until then we are still waiting on replies, so the
+    // callback handle must stay valid to prevent scheduling another getMore for this remote.
+    if (!cbData.response.status.isOK() || !cbData.response.moreToCome) {
+        _remotes[remoteIndex].cbHandle = executor::TaskExecutor::CallbackHandle();
+    }
+
+    //  On shutdown, there is no need to process the response. Note that cancellation surfaces as
+    //  a final reply with a non-OK status, so a killed stream always reaches this clean-up path.
+    if (_lifecycleState != kAlive) {
+        _signalCurrentEventIfReady(lk);  // First, wake up anyone waiting on '_currentEvent'.
+        _cleanUpKilledBatch(lk);
+        return;
+    }
+    try {
+        _processBatchResults(lk, cbData.response, remoteIndex);
+    } catch (DBException const& e) {
+        _remotes[remoteIndex].status = e.toStatus();
+    }
+    _signalCurrentEventIfReady(lk);  // Wake up anyone waiting on '_currentEvent'.
+}
+
 void AsyncResultsMerger::_cleanUpKilledBatch(WithLock lk) {
     invariant(_lifecycleState == kKillStarted);
 
@@ -777,9 +853,12 @@ void AsyncResultsMerger::_processBatchResults(WithLock lk,
     if (_tailableMode == TailableModeEnum::kTailable && !remote.hasNext()) {
         invariant(_remotes.size() == 1);
         _eofNext = true;
-    } else if (!remote.hasNext() && !remote.exhausted() && _lifecycleState == kAlive && _opCtx) {
+    } else if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid() &&
+               _lifecycleState == kAlive && _opCtx) {
         // If this is normal or tailable-awaitData cursor and we still don't have anything buffered
         // after receiving this batch, we can schedule work to retrieve the next batch right away.
+        // A still-valid callback handle means an exhaust stream is delivering the next batch
+        // without being asked, so there is nothing to schedule.
         // Be careful only to do this when '_opCtx' is non-null, since it is illegal to schedule a
         // remote command on a user's behalf without a non-null OperationContext.
         remote.status = _askForNextBatch(lk, remoteIndex);
@@ -790,6 +869,7 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            size_t remoteIndex,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
+    const bool bufferWasEmpty = remote.docBuffer.empty();
     _updateRemoteMetadata(lk, remoteIndex, response);
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
@@ -810,14 +890,20 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
-        ClusterQueryResult result(obj);
+        // If merging by sort key, extract the key once now. The merge queue comparator looks at
+        // the front results' sort keys every time the queue is adjusted, and re-parsing the
+        // document for each comparison is wasteful for wide documents and wide merges.
+        ClusterQueryResult result = _params.getSort()
+            ? ClusterQueryResult(obj, extractSortKey(obj, _params.getCompareWholeSortKey()))
+            : ClusterQueryResult(obj);
         remote.docBuffer.push(result);
         ++remote.fetchedCount;
     }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
-    // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
+    // queue. If the buffer already had results, e.g. because this batch was prefetched, then the
+    // remote is on the merge queue already and pushing it again would corrupt the merge.
+    if (_params.getSort() && bufferWasEmpty && !remote.docBuffer.empty()) {
         _mergeQueue.push(remoteIndex);
     }
     return true;
@@ -933,9 +1019,7 @@ bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const
     const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
     const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
 
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    return compareSortKeys(leftDoc.getSortKey(), rightDoc.getSortKey(), _sort) > 0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
@@ -323,10 +323,8 @@ private:
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes, const BSONObj& sort)
+            : _remotes(remotes), _sort(sort) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
@@ -334,11 +332,6 @@ private:
         const std::vector<RemoteCursorData>& _remotes;
 
         const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -406,6 +399,13 @@ private:
      */
     void _handleBatchResponse(WithLock, CbData const&, size_t remoteIndex);
 
+    /**
+     * Like '_handleBatchResponse', but invoked once per reply of an exhaust stream. The remote's
+     * callback handle remains valid until the final reply of the stream, which the remote
+     * indicates by leaving the moreToCome flag unset.
+     */
+    void _handleExhaustBatchResponse(WithLock, CbData const&, size_t remoteIndex);
+
     /**
      * Cleans up if the remote cursor was killed while waiting for a response.
      */
@@ -458,6 +458,15 @@ private:
      */
     Status _scheduleGetMores(WithLock);
 
+    /**
+     * Best-effort: schedules a getMore on any remote host whose buffer has drained to the prefetch
+     * watermark, so the next batch is already in flight when the buffer runs dry. Does nothing
+     * unless the 'internalQueryAsyncResultsMergerPrefetchWatermark' knob is set, and never applies
+     * to tailable cursors. Scheduling failures are swallowed; the regular '_scheduleGetMores()'
+     * path will retry and surface them.
+     */
+    void _schedulePrefetches(WithLock);
+
     /**
      * Schedules a killCursors command to be run on all remote hosts that have open cursors.
      */
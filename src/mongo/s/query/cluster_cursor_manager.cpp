@@ -65,6 +65,8 @@ Status cursorInUseStatus(CursorId cursorId) {
 
 }  // namespace
 
+constexpr int ClusterCursorManager::kNumPartitions;
+
 ClusterCursorManager::PinnedCursor::PinnedCursor(ClusterCursorManager* manager,
                                                  ClusterClientCursorGuard&& cursorGuard,
                                                  const NamespaceString& nss,
@@ -138,18 +140,21 @@ void ClusterCursorManager::PinnedCursor::returnAndKillCursor() {
 ClusterCursorManager::ClusterCursorManager(ClockSource* clockSource)
     : _clockSource(clockSource),
       _randomSeed(SecureRandom().nextInt64()),
-      _pseudoRandom(_randomSeed) {
+      _pseudoRandom(_randomSeed),
+      _cursorEntryMap(std::make_unique<Partitioned<CursorEntryMap>>(kNumPartitions)) {
     invariant(_clockSource);
 }
 
 ClusterCursorManager::~ClusterCursorManager() {
-    invariant(_cursorEntryMap.empty());
+    invariant(_cursorEntryMap->empty());
 }
 
 void ClusterCursorManager::shutdown(OperationContext* opCtx) {
     {
-        stdx::lock_guard<Latch> lk(_mutex);
-        _inShutdown = true;
+        // Taking '_registrationMutex' guarantees that any registration which saw '_inShutdown' as
+        // false has finished inserting its cursor before killAllCursors() below runs.
+        stdx::lock_guard<Latch> lk(_registrationMutex);
+        _inShutdown.store(true);
     }
     killAllCursors(opCtx);
 }
@@ -164,9 +169,12 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     // Read the clock out of the lock.
     const auto now = _clockSource->now();
 
-    stdx::unique_lock<Latch> lk(_mutex);
+    // Note we must hold '_registrationMutex' from the shutdown check until insertion into
+    // '_cursorEntryMap', both so that shutdown cannot miss this cursor and so that we don't
+    // register two cursors with the same cursor id.
+    stdx::unique_lock<Latch> lk(_registrationMutex);
 
-    if (_inShutdown) {
+    if (_inShutdown.load()) {
         lk.unlock();
         cursor->kill(opCtx);
         return Status(ErrorCodes::ShutdownInProgress,
@@ -177,21 +185,30 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     cursor->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
 
     auto cursorId = generic_cursor::allocateCursorId(
-        [&](CursorId cursorId) -> bool { return _cursorEntryMap.count(cursorId) == 0; },
+        [&](CursorId cursorId) -> bool {
+            // Even though we drop the lock on the '_cursorEntryMap' partition, another thread
+            // cannot register a cursor with the same id because we still hold
+            // '_registrationMutex'.
+            auto partition = _cursorEntryMap->lockOnePartition(cursorId);
+            return partition->count(cursorId) == 0;
+        },
         _pseudoRandom);
 
-    // Create a new CursorEntry and register it in the CursorEntryContainer's map.
-    auto emplaceResult = _cursorEntryMap.emplace(cursorId,
-                                                 CursorEntry(std::move(cursor),
-                                                             cursorType,
-                                                             cursorLifetime,
-                                                             now,
-                                                             authenticatedUsers,
-                                                             opCtx->getClient()->getUUID(),
-                                                             opCtx->getOperationKey(),
-                                                             nss));
+    // Create a new CursorEntry and register it in its partition's map.
+    auto partition = _cursorEntryMap->lockOnePartition(cursorId);
+    auto emplaceResult = partition->emplace(cursorId,
+                                            CursorEntry(std::move(cursor),
+                                                        cursorType,
+                                                        cursorLifetime,
+                                                        now,
+                                                        authenticatedUsers,
+                                                        opCtx->getClient()->getUUID(),
+                                                        opCtx->getOperationKey(),
+                                                        nss));
     invariant(emplaceResult.second);
 
+    _cursorTypeCounter(cursorType).fetchAndAdd(1);
+
     return cursorId;
 }
 
@@ -201,17 +218,17 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     AuthzCheckFn authChecker,
     AuthCheck checkSessionAuth) {
 
-    stdx::lock_guard<Latch> lk(_mutex);
-
-    if (_inShutdown) {
+    if (_inShutdown.load()) {
         return Status(ErrorCodes::ShutdownInProgress,
                       "Cannot check out cursor as we are in the process of shutting down");
     }
 
-    CursorEntry* entry = _getEntry(lk, cursorId);
-    if (!entry) {
+    auto lockedPartition = _cursorEntryMap->lockOnePartition(cursorId);
+    auto entryIt = lockedPartition->find(cursorId);
+    if (entryIt == lockedPartition->end()) {
         return cursorNotFoundStatus(cursorId);
     }
+    CursorEntry* entry = &entryIt->second;
 
     // Check if the user is coauthorized to access this cursor.
     auto authCheckStatus = authChecker(entry->getAuthenticatedUsers());
@@ -247,6 +264,8 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
 
     CurOp::get(opCtx)->debug().queryHash = cursorGuard->getQueryHash();
 
+    _cursorsPinned.fetchAndAdd(1);
+
     return PinnedCursor(this, std::move(cursorGuard), entry->getNamespace(), cursorId);
 }
 
@@ -263,13 +282,19 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
     cursor->detachFromOperationContext();
     cursor->setLastUseDate(now);
 
-    stdx::unique_lock<Latch> lk(_mutex);
-
-    CursorEntry* entry = _getEntry(lk, cursorId);
-    invariant(entry);
+    auto lockedPartition = _cursorEntryMap->lockOnePartition(cursorId);
+    auto entryIt = lockedPartition->find(cursorId);
+    invariant(entryIt != lockedPartition->end());
+    CursorEntry* entry = &entryIt->second;
 
     // killPending will be true if killCursor() was called while the cursor was in use.
-    const bool killPending = entry->isKillPending();
+    const bool killPending = entry->isKillPending() || entry->isKilledWhileCheckedOut();
+
+    if (!entry->isKilledWhileCheckedOut()) {
+        // If the cursor was killed while checked out, killOperationUsingCursor() already stopped
+        // counting it as pinned.
+        _cursorsPinned.fetchAndSubtract(1);
+    }
 
     entry->setLastActive(now);
     entry->returnCursor(std::move(cursor));
@@ -281,30 +306,41 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
 
     // After detaching the cursor, the entry will be destroyed.
     entry = nullptr;
-    detachAndKillCursor(std::move(lk), opCtx, cursorId);
+    detachAndKillCursor(std::move(lockedPartition), opCtx, cursorId);
 }
 
 Status ClusterCursorManager::checkAuthForKillCursors(OperationContext* opCtx,
                                                      CursorId cursorId,
                                                      AuthzCheckFn authChecker) {
-    stdx::lock_guard<Latch> lk(_mutex);
-    auto entry = _getEntry(lk, cursorId);
-
-    if (!entry) {
+    auto lockedPartition = _cursorEntryMap->lockOnePartition(cursorId);
+    auto entryIt = lockedPartition->find(cursorId);
+    if (entryIt == lockedPartition->end()) {
         return cursorNotFoundStatus(cursorId);
     }
 
     // Note that getAuthenticatedUsers() is thread-safe, so it's okay to call even if there's
     // an operation using the cursor.
-    return authChecker(entry->getAuthenticatedUsers());
+    return authChecker(entryIt->second.getAuthenticatedUsers());
 }
 
-void ClusterCursorManager::killOperationUsingCursor(WithLock, CursorEntry* entry) {
+void ClusterCursorManager::killOperationUsingCursor(CursorEntry* entry) {
     invariant(entry->getOperationUsingCursor());
     // Interrupt any operation currently using the cursor.
     OperationContext* opUsingCursor = entry->getOperationUsingCursor();
-    stdx::lock_guard<Client> lk(*opUsingCursor->getClient());
-    opUsingCursor->getServiceContext()->killOperation(lk, opUsingCursor, ErrorCodes::CursorKilled);
+    {
+        stdx::lock_guard<Client> lk(*opUsingCursor->getClient());
+        opUsingCursor->getServiceContext()->killOperation(
+            lk, opUsingCursor, ErrorCodes::CursorKilled);
+    }
+
+    // For reporting purposes the cursor is killed from this point on, even though the entry stays
+    // registered until the operation checks the cursor back in. Update the stats counters now, and
+    // record that we did so that check-in doesn't update them a second time.
+    if (!entry->isKilledWhileCheckedOut()) {
+        entry->setKilledWhileCheckedOut();
+        _cursorsPinned.fetchAndSubtract(1);
+        _cursorTypeCounter(entry->getCursorType()).fetchAndSubtract(1);
+    }
 
     // Don't delete the cursor, as an operation is using it. It will be cleaned up when the
     // operation is done.
@@ -313,38 +349,40 @@ void ClusterCursorManager::killOperationUsingCursor(WithLock, CursorEntry* entry
 Status ClusterCursorManager::killCursor(OperationContext* opCtx, CursorId cursorId) {
     invariant(opCtx);
 
-    stdx::unique_lock<Latch> lk(_mutex);
-
-    CursorEntry* entry = _getEntry(lk, cursorId);
-    if (!entry) {
+    auto lockedPartition = _cursorEntryMap->lockOnePartition(cursorId);
+    auto entryIt = lockedPartition->find(cursorId);
+    if (entryIt == lockedPartition->end()) {
         return cursorNotFoundStatus(cursorId);
     }
+    CursorEntry* entry = &entryIt->second;
 
     // Interrupt any operation currently using the cursor, unless if it's the current operation.
     OperationContext* opUsingCursor = entry->getOperationUsingCursor();
     if (opUsingCursor) {
         // The caller shouldn't need to call killCursor on their own cursor.
         invariant(opUsingCursor != opCtx, "Cannot call killCursor() on your own cursor");
-        killOperationUsingCursor(lk, entry);
+        killOperationUsingCursor(entry);
         return Status::OK();
     }
 
     // No one is using the cursor, so we destroy it.
-    detachAndKillCursor(std::move(lk), opCtx, cursorId);
+    detachAndKillCursor(std::move(lockedPartition), opCtx, cursorId);
 
-    // We no longer hold the lock here.
+    // We no longer hold the partition lock here.
 
     return Status::OK();
 }
 
-void ClusterCursorManager::detachAndKillCursor(stdx::unique_lock<Latch> lk,
+void ClusterCursorManager::detachAndKillCursor(Partitioned<CursorEntryMap>::OnePartition&& lk,
                                                OperationContext* opCtx,
                                                CursorId cursorId) {
-    auto detachedCursorGuard = _detachCursor(lk, opCtx, cursorId);
+    auto detachedCursorGuard = [&] {
+        // Limit the scope of the partition lock: deletion of the cursor can happen out of it.
+        auto lockWithRestrictedScope = std::move(lk);
+        return _detachCursor(lockWithRestrictedScope, opCtx, cursorId);
+    }();
     invariant(detachedCursorGuard.getStatus());
 
-    // Deletion of the cursor can happen out of the lock.
-    lk.unlock();
     detachedCursorGuard.getValue()->kill(opCtx);
 }
 
@@ -378,39 +416,40 @@ void ClusterCursorManager::killAllCursors(OperationContext* opCtx) {
 std::size_t ClusterCursorManager::killCursorsSatisfying(
     OperationContext* opCtx, const std::function<bool(CursorId, const CursorEntry&)>& pred) {
     invariant(opCtx);
-    stdx::unique_lock<Latch> lk(_mutex);
     std::size_t nKilled = 0;
 
     std::vector<ClusterClientCursorGuard> cursorsToDestroy;
-    auto cursorIdEntryIt = _cursorEntryMap.begin();
-    while (cursorIdEntryIt != _cursorEntryMap.end()) {
-        auto cursorId = cursorIdEntryIt->first;
-        auto& entry = cursorIdEntryIt->second;
-
-        if (!pred(cursorId, entry)) {
-            ++cursorIdEntryIt;
-            continue;
-        }
+    for (std::size_t partitionId = 0; partitionId < kNumPartitions; ++partitionId) {
+        auto lockedPartition = _cursorEntryMap->lockOnePartitionById(partitionId);
+        for (auto cursorIdEntryIt = lockedPartition->begin();
+             cursorIdEntryIt != lockedPartition->end();) {
+            auto cursorId = cursorIdEntryIt->first;
+            auto& entry = cursorIdEntryIt->second;
+
+            if (!pred(cursorId, entry)) {
+                ++cursorIdEntryIt;
+                continue;
+            }
 
-        ++nKilled;
+            ++nKilled;
 
-        if (entry.getOperationUsingCursor()) {
-            // Mark the OperationContext using the cursor as killed, and move on.
-            killOperationUsingCursor(lk, &entry);
-            ++cursorIdEntryIt;
-            continue;
-        }
+            if (entry.getOperationUsingCursor()) {
+                // Mark the OperationContext using the cursor as killed, and move on.
+                killOperationUsingCursor(&entry);
+                ++cursorIdEntryIt;
+                continue;
+            }
 
-        cursorsToDestroy.push_back(entry.releaseCursor(opCtx));
+            cursorsToDestroy.push_back(entry.releaseCursor(opCtx));
+            _cursorTypeCounter(entry.getCursorType()).fetchAndSubtract(1);
 
-        // Destroy the entry and set the iterator to the next element.
-        _cursorEntryMap.erase(cursorIdEntryIt++);
+            // Destroy the entry and set the iterator to the next element.
+            lockedPartition->erase(cursorIdEntryIt++);
+        }
     }
 
-    // Ensure cursors are killed outside the lock, as killing may require waiting for callbacks to
-    // finish.
-    lk.unlock();
-
+    // Ensure cursors are killed outside the partition locks, as killing may require waiting for
+    // callbacks to finish.
     for (auto&& cursorGuard : cursorsToDestroy) {
         invariant(cursorGuard);
         cursorGuard->kill(opCtx);
@@ -420,46 +459,28 @@ std::size_t ClusterCursorManager::killCursorsSatisfying(
 }
 
 ClusterCursorManager::Stats ClusterCursorManager::stats() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-
     Stats stats;
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending()) {
-            // Killed cursors do not count towards the number of pinned cursors or the number of
-            // open cursors.
-            continue;
-        }
-
-        if (entry.getOperationUsingCursor()) {
-            ++stats.cursorsPinned;
-        }
-
-        switch (entry.getCursorType()) {
-            case CursorType::SingleTarget:
-                ++stats.cursorsSingleTarget;
-                break;
-            case CursorType::MultiTarget:
-                ++stats.cursorsMultiTarget;
-                break;
-        }
-    }
+    stats.cursorsMultiTarget = _cursorsMultiTarget.load();
+    stats.cursorsSingleTarget = _cursorsSingleTarget.load();
+    stats.cursorsPinned = _cursorsPinned.load();
 
     return stats;
 }
 
 void ClusterCursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
-    stdx::lock_guard<Latch> lk(_mutex);
-
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending()) {
-            // Don't include sessions for killed cursors.
-            continue;
-        }
+    auto allPartitions = _cursorEntryMap->lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto&& [cursorId, entry] : *partition) {
+            if (entry.isKillPending()) {
+                // Don't include sessions for killed cursors.
+                continue;
+            }
 
-        auto lsid = entry.getLsid();
-        if (lsid) {
-            lsids->insert(*lsid);
+            auto lsid = entry.getLsid();
+            if (lsid) {
+                lsids->insert(*lsid);
+            }
         }
     }
 }
@@ -486,27 +507,27 @@ std::vector<GenericCursor> ClusterCursorManager::getIdleCursors(
     const OperationContext* opCtx, MongoProcessInterface::CurrentOpUserMode userMode) const {
     std::vector<GenericCursor> cursors;
 
-    stdx::lock_guard<Latch> lk(_mutex);
-
     AuthorizationSession* ctxAuth = AuthorizationSession::get(opCtx->getClient());
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        // If auth is enabled, and userMode is allUsers, check if the current user has
-        // permission to see this cursor.
-        if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
-            userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
-            !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUsers())) {
-            continue;
-        }
-        if (entry.isKillPending() || entry.getOperationUsingCursor()) {
-            // Don't include sessions for killed or pinned cursors.
-            continue;
-        }
+    auto allPartitions = _cursorEntryMap->lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto&& [cursorId, entry] : *partition) {
+            // If auth is enabled, and userMode is allUsers, check if the current user has
+            // permission to see this cursor.
+            if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
+                userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
+                !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUsers())) {
+                continue;
+            }
+            if (entry.isKillPending() || entry.getOperationUsingCursor()) {
+                // Don't include sessions for killed or pinned cursors.
+                continue;
+            }
 
-        cursors.emplace_back(entry.cursorToGenericCursor(cursorId, entry.getNamespace()));
+            cursors.emplace_back(entry.cursorToGenericCursor(cursorId, entry.getNamespace()));
+        }
     }
 
-
     return cursors;
 }
 
@@ -525,41 +546,33 @@ std::pair<Status, int> ClusterCursorManager::killCursorsWithMatchingSessions(
 
 stdx::unordered_set<CursorId> ClusterCursorManager::getCursorsForSession(
     LogicalSessionId lsid) const {
-    stdx::lock_guard<Latch> lk(_mutex);
-
     stdx::unordered_set<CursorId> cursorIds;
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending()) {
-            // Don't include sessions for killed cursors.
-            continue;
-        }
+    auto allPartitions = _cursorEntryMap->lockAllPartitions();
+    for (auto&& partition : allPartitions) {
+        for (auto&& [cursorId, entry] : *partition) {
+            if (entry.isKillPending()) {
+                // Don't include sessions for killed cursors.
+                continue;
+            }
 
-        auto cursorLsid = entry.getLsid();
-        if (lsid == cursorLsid) {
-            cursorIds.insert(cursorId);
+            auto cursorLsid = entry.getLsid();
+            if (lsid == cursorLsid) {
+                cursorIds.insert(cursorId);
+            }
         }
     }
 
     return cursorIds;
 }
 
-auto ClusterCursorManager::_getEntry(WithLock, CursorId cursorId) -> CursorEntry* {
-    auto entryMapIt = _cursorEntryMap.find(cursorId);
-    if (entryMapIt == _cursorEntryMap.end()) {
-        return nullptr;
-    }
-
-    return &entryMapIt->second;
-}
-
-StatusWith<ClusterClientCursorGuard> ClusterCursorManager::_detachCursor(WithLock lk,
-                                                                         OperationContext* opCtx,
-                                                                         CursorId cursorId) {
-    CursorEntry* entry = _getEntry(lk, cursorId);
-    if (!entry) {
+StatusWith<ClusterClientCursorGuard> ClusterCursorManager::_detachCursor(
+    Partitioned<CursorEntryMap>::OnePartition& lk, OperationContext* opCtx, CursorId cursorId) {
+    auto entryIt = lk->find(cursorId);
+    if (entryIt == lk->end()) {
         return cursorNotFoundStatus(cursorId);
     }
+    CursorEntry* entry = &entryIt->second;
 
     if (entry->getOperationUsingCursor()) {
         return cursorInUseStatus(cursorId);
@@ -568,10 +581,25 @@ StatusWith<ClusterClientCursorGuard> ClusterCursorManager::_detachCursor(WithLoc
     // Transfer ownership away from the entry.
     ClusterClientCursorGuard cursor = entry->releaseCursor(opCtx);
 
+    if (!entry->isKilledWhileCheckedOut()) {
+        // If the cursor was killed while checked out, killOperationUsingCursor() already stopped
+        // counting it as open.
+        _cursorTypeCounter(entry->getCursorType()).fetchAndSubtract(1);
+    }
+
     // Destroy the entry.
-    size_t eraseResult = _cursorEntryMap.erase(cursorId);
-    invariant(1 == eraseResult);
+    lk->erase(entryIt);
 
     return std::move(cursor);
 }
+
+AtomicWord<size_t>& ClusterCursorManager::_cursorTypeCounter(CursorType cursorType) {
+    switch (cursorType) {
+        case CursorType::SingleTarget:
+            return _cursorsSingleTarget;
+        case CursorType::MultiTarget:
+            return _cursorsMultiTarget;
+    }
+    MONGO_UNREACHABLE;
+}
 }  // namespace mongo
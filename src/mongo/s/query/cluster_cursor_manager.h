@@ -33,18 +33,19 @@
 #include <utility>
 #include <vector>
 
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/db/generic_cursor.h"
 #include "mongo/db/kill_sessions.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/session_killer.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/query/cluster_client_cursor.h"
 #include "mongo/s/query/cluster_client_cursor_guard.h"
 #include "mongo/s/query/cluster_client_cursor_params.h"
 #include "mongo/stdx/unordered_map.h"
-#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -338,6 +339,19 @@ public:
             return _originatingClient;
         }
 
+        /**
+         * Records that killCursor() (or shutdown) interrupted the operation using this cursor.
+         * The manager uses this to adjust its stats counters exactly once for a cursor that is
+         * killed while checked out but whose entry survives until check-in.
+         */
+        void setKilledWhileCheckedOut() {
+            _killedWhileCheckedOut = true;
+        }
+
+        bool isKilledWhileCheckedOut() const {
+            return _killedWhileCheckedOut;
+        }
+
     private:
         std::unique_ptr<ClusterClientCursor> _cursor;
         CursorType _cursorType = CursorType::SingleTarget;
@@ -366,6 +380,11 @@ public:
          * The set of users authorized to use this cursor.
          */
         std::vector<UserName> _authenticatedUsers;
+
+        /**
+         * Whether killCursor() was called on this cursor while it was checked out.
+         */
+        bool _killedWhileCheckedOut = false;
     };
 
     /**
@@ -517,16 +536,20 @@ public:
     stdx::unordered_set<CursorId> getCursorsForSession(LogicalSessionId lsid) const;
 
     void incrementCursorsTimedOut(size_t inc) {
-        _cursorsTimedOut += inc;
+        _cursorsTimedOut.fetchAndAdd(inc);
     }
 
     size_t cursorsTimedOut() const {
-        return _cursorsTimedOut;
+        return _cursorsTimedOut.load();
     }
 
 private:
     using CursorEntryMap = stdx::unordered_map<CursorId, CursorEntry>;
 
+    // The number of partitions of the cursor map. A larger value increases the probability that
+    // two concurrent operations on different cursors will not contend on a partition mutex.
+    static constexpr int kNumPartitions = 16;
+
     /**
      * Transfers ownership of the given pinned cursor back to the manager, and moves the cursor to
      * the 'idle' state.
@@ -543,60 +566,65 @@ private:
                        CursorState cursorState);
 
     /**
-     * Will detach a cursor, release the lock and then call kill() on it.
+     * Will detach a cursor, release the lock on its partition and then call kill() on it.
      */
-    void detachAndKillCursor(stdx::unique_lock<Latch> lk,
+    void detachAndKillCursor(Partitioned<CursorEntryMap>::OnePartition&& lk,
                              OperationContext* opCtx,
                              CursorId cursorId);
 
-    /**
-     * Returns a pointer to the CursorEntry for the given cursor.  If the given cursor is not
-     * registered, returns null.
-     *
-     * Not thread-safe.
-     */
-    CursorEntry* _getEntry(WithLock, CursorId cursorId);
-
-    /**
-     * Allocates a new cursor id (a positive 64 bit number) that is not already in use.
-     */
-    CursorId _allocateCursorId();
-
     /**
      * De-registers the given cursor, and returns an owned pointer to the underlying
-     * ClusterClientCursor object.
+     * ClusterClientCursor object.  'lk' must be the lock guard for the partition that owns the
+     * cursor.
      *
      * If the given cursor is pinned, returns an error Status with code CursorInUse.  If the given
      * cursor is not registered, returns an error Status with code CursorNotFound.
-     *
-     * Not thread-safe.
      */
-    StatusWith<ClusterClientCursorGuard> _detachCursor(WithLock,
+    StatusWith<ClusterClientCursorGuard> _detachCursor(Partitioned<CursorEntryMap>::OnePartition& lk,
                                                        OperationContext* opCtx,
                                                        CursorId cursorId);
 
     /**
-     * Flags the OperationContext that's using the given cursor as interrupted.
+     * Flags the OperationContext that's using the given cursor as interrupted, and updates the
+     * stats counters to no longer count the cursor as open.  The caller must hold the lock on the
+     * partition that owns 'entry'.
      */
-    void killOperationUsingCursor(WithLock, CursorEntry* entry);
+    void killOperationUsingCursor(CursorEntry* entry);
+
+    /**
+     * Returns the open-cursor counter corresponding to the given cursor type.
+     */
+    AtomicWord<size_t>& _cursorTypeCounter(CursorType cursorType);
 
     // Clock source.  Used when the 'last active' time for a cursor needs to be set/updated.  May be
     // concurrently accessed by multiple threads.
     ClockSource* _clockSource;
 
-    // Synchronizes access to all private state variables below.
-    mutable Mutex _mutex = MONGO_MAKE_LATCH("ClusterCursorManager::_mutex");
+    // Whether the manager is shutting down.  Set under '_registrationMutex', but may be read
+    // without it.
+    AtomicWord<bool> _inShutdown{false};
 
-    bool _inShutdown{false};
+    // Protects '_pseudoRandom' and serializes cursor registration with shutdown.  Must be held
+    // from cursor id allocation until insertion into '_cursorEntryMap' so that two cursors cannot
+    // be registered with the same id.  If a partition lock is also held, '_registrationMutex' must
+    // be acquired first.
+    mutable Mutex _registrationMutex = MONGO_MAKE_LATCH("ClusterCursorManager::_registrationMutex");
 
     // Randomness source.  Used for cursor id generation.
     const int64_t _randomSeed;
     PseudoRandom _pseudoRandom;
 
-    // Map from CursorId to CursorEntry.
-    CursorEntryMap _cursorEntryMap;
+    // Map from CursorId to CursorEntry, partitioned on the low bits of the cursor id so that
+    // operations on different cursors can proceed without contending on a single mutex.
+    std::unique_ptr<Partitioned<CursorEntryMap>> _cursorEntryMap;
+
+    // Counters for stats().  Kept outside the map partitions so that reporting them does not
+    // require locking every partition.
+    AtomicWord<size_t> _cursorsMultiTarget{0};
+    AtomicWord<size_t> _cursorsSingleTarget{0};
+    AtomicWord<size_t> _cursorsPinned{0};
 
-    size_t _cursorsTimedOut = 0;
+    AtomicWord<size_t> _cursorsTimedOut{0};
 };
 
 }  // namespace mongo
@@ -692,8 +692,9 @@ void validateOperationSessionInfo(OperationContext* opCtx,
     returnCursorGuard.dismiss();
 }
 
-StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
-                                                   const GetMoreCommandRequest& cmd) {
+Status ClusterFind::runGetMore(OperationContext* opCtx,
+                               const GetMoreCommandRequest& cmd,
+                               rpc::ReplyBuilderInterface* replyBuilder) {
     auto cursorManager = Grid::get(opCtx)->getCursorManager();
 
     auto authzSession = AuthorizationSession::get(opCtx->getClient());
@@ -762,11 +763,16 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
         return opCtxSetupStatus;
     }
 
-    std::vector<BSONObj> batch;
-    size_t bytesBuffered = 0;
+    // Stream the documents of the batch directly into the reply message rather than buffering
+    // them in an intermediate container; each document is then copied exactly once.
+    CursorResponseBuilder::Options options;
+    if (!opCtx->inMultiDocumentTransaction()) {
+        options.atClusterTime = repl::ReadConcernArgs::get(opCtx).getArgsAtClusterTime();
+    }
+    CursorResponseBuilder nextBatch(replyBuilder, options);
+    std::uint64_t numResults = 0;
     long long batchSize = cmd.getBatchSize().value_or(0);
     auto cursorState = ClusterCursorManager::CursorState::NotExhausted;
-    BSONObj postBatchResumeToken;
     bool stashedResult = false;
 
     // If the 'waitWithPinnedCursorDuringGetMoreBatch' fail point is enabled, set the 'msg'
@@ -777,7 +783,7 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
                                                          "waitWithPinnedCursorDuringGetMoreBatch");
     }
 
-    while (!FindCommon::enoughForGetMore(batchSize, batch.size())) {
+    while (!FindCommon::enoughForGetMore(batchSize, numResults)) {
         StatusWith<ClusterQueryResult> next =
             Status{ErrorCodes::InternalError, "uninitialized cluster query result"};
         try {
@@ -795,7 +801,7 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
             const auto extraInfo = ex.extraInfo<ChangeStreamInvalidationInfo>();
             tassert(5493707, "Missing ChangeStreamInvalidationInfo on exception", extraInfo);
 
-            postBatchResumeToken = extraInfo->getInvalidateResumeToken();
+            nextBatch.setPostBatchResumeToken(extraInfo->getInvalidateResumeToken());
             cursorState = ClusterCursorManager::CursorState::Exhausted;
             break;
         }
@@ -817,7 +823,7 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
         }
 
         if (!FindCommon::haveSpaceForNext(
-                *next.getValue().getResult(), batch.size(), bytesBuffered)) {
+                *next.getValue().getResult(), numResults, nextBatch.bytesUsed())) {
             pinnedCursor.getValue()->queueResult(*next.getValue().getResult());
             stashedResult = true;
             break;
@@ -826,14 +832,12 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
         // As soon as we get a result, this operation no longer waits.
         awaitDataState(opCtx).shouldWaitForInserts = false;
 
-        // Add doc to the batch. Account for the space overhead associated with returning this doc
-        // inside a BSON array.
-        bytesBuffered +=
-            (next.getValue().getResult()->objsize() + kPerDocumentOverheadBytesUpperBound);
-        batch.push_back(std::move(*next.getValue().getResult()));
+        // Add doc to the batch.
+        nextBatch.append(*next.getValue().getResult());
+        numResults++;
 
         // Update the postBatchResumeToken. For non-$changeStream aggregations, this will be empty.
-        postBatchResumeToken = pinnedCursor.getValue()->getPostBatchResumeToken();
+        nextBatch.setPostBatchResumeToken(pinnedCursor.getValue()->getPostBatchResumeToken());
     }
 
     // If the cursor has been exhausted, we will communicate this by returning a CursorId of zero.
@@ -843,10 +847,10 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
     // For empty batches, or in the case where the final result was added to the batch rather than
     // being stashed, we update the PBRT here to ensure that it is the most recent available.
     if (idToReturn && !stashedResult) {
-        postBatchResumeToken = pinnedCursor.getValue()->getPostBatchResumeToken();
+        nextBatch.setPostBatchResumeToken(pinnedCursor.getValue()->getPostBatchResumeToken());
     }
 
-    const bool partialResultsReturned = pinnedCursor.getValue()->partialResultsReturned();
+    nextBatch.setPartialResultsReturned(pinnedCursor.getValue()->partialResultsReturned());
     pinnedCursor.getValue()->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
     pinnedCursor.getValue()->incNBatches();
     // Upon successful completion, transfer ownership of the cursor back to the cursor manager. If
@@ -855,7 +859,7 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
 
     // Set nReturned and whether the cursor has been exhausted.
     CurOp::get(opCtx)->debug().cursorExhausted = (idToReturn == 0);
-    CurOp::get(opCtx)->debug().nreturned = batch.size();
+    CurOp::get(opCtx)->debug().nreturned = numResults;
 
     if (MONGO_unlikely(waitBeforeUnpinningOrDeletingCursorAfterGetMoreBatch.shouldFail())) {
         CurOpFailpointHelpers::waitWhileFailPointEnabled(
@@ -864,19 +868,8 @@ StatusWith<CursorResponse> ClusterFind::runGetMore(OperationContext* opCtx,
             "waitBeforeUnpinningOrDeletingCursorAfterGetMoreBatch");
     }
 
-    auto atClusterTime = !opCtx->inMultiDocumentTransaction()
-        ? repl::ReadConcernArgs::get(opCtx).getArgsAtClusterTime()
-        : boost::none;
-    return CursorResponse(nss,
-                          idToReturn,
-                          std::move(batch),
-                          atClusterTime ? atClusterTime->asTimestamp()
-                                        : boost::optional<Timestamp>{},
-                          postBatchResumeToken,
-                          boost::none,
-                          boost::none,
-                          boost::none,
-                          partialResultsReturned);
+    nextBatch.done(idToReturn, nss.ns());
+    return Status::OK();
 }
 
 }  // namespace mongo
@@ -68,10 +68,13 @@ public:
                              bool* partialResultsReturned = nullptr);
 
     /**
-     * Executes the getMore command 'cmd', and on success returns a CursorResponse.
+     * Executes the getMore command 'cmd', streaming the documents of the resulting batch directly
+     * into 'replyBuilder' rather than buffering them in an intermediate container. On failure
+     * returns a non-OK status and any partially built cursor response is removed from the reply.
      */
-    static StatusWith<CursorResponse> runGetMore(OperationContext* opCtx,
-                                                 const GetMoreCommandRequest& cmd);
+    static Status runGetMore(OperationContext* opCtx,
+                             const GetMoreCommandRequest& cmd,
+                             rpc::ReplyBuilderInterface* replyBuilder);
 };
 
 }  // namespace mongo
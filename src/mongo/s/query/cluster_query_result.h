@@ -45,6 +45,9 @@ public:
 
     ClusterQueryResult(BSONObj resObj) : _resultObj(resObj) {}
 
+    ClusterQueryResult(BSONObj resObj, BSONObj sortKey)
+        : _resultObj(resObj), _sortKey(std::move(sortKey)) {}
+
     bool isEOF() const {
         return !_resultObj;
     }
@@ -53,8 +56,21 @@ public:
         return _resultObj;
     }
 
+    /**
+     * Returns this result's sort key, extracted from the $sortKey metadata field when the result
+     * was buffered, or an empty BSONObj if no sort key was attached. The returned object may be a
+     * view into getResult()'s buffer, so it must not outlive this result.
+     */
+    const BSONObj& getSortKey() const {
+        return _sortKey;
+    }
+
 private:
     boost::optional<BSONObj> _resultObj;
+
+    // Cached by the merging machinery so that sort key comparisons do not have to re-parse the
+    // result document.
+    BSONObj _sortKey;
 };
 
 }  // namespace mongo
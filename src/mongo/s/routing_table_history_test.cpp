@@ -700,5 +700,64 @@ TEST_F(RoutingTableHistoryTest, TestFlatten) {
     ASSERT_EQ(chunk1->getMax().woCompare(BSON("a" << 10)), 0);
 }
 
+TEST_F(RoutingTableHistoryTest, TestFindIntersectingChunkRepeatedLookups) {
+    const UUID uuid = UUID::gen();
+    const OID epoch = OID::gen();
+    const Timestamp timestamp(1);
+
+    std::vector<ChunkType> initialChunks = {
+        ChunkType{uuid,
+                  ChunkRange{getShardKeyPattern().globalMin(), BSON("a" << 0)},
+                  ChunkVersion{2, 1, epoch, timestamp},
+                  kThisShard},
+        ChunkType{uuid,
+                  ChunkRange{BSON("a" << 0), getShardKeyPattern().globalMax()},
+                  ChunkVersion{2, 2, epoch, timestamp},
+                  kThisShard}};
+
+    auto rt = RoutingTableHistory::makeNew(kNss,
+                                           uuid,
+                                           getShardKeyPattern(),
+                                           nullptr,
+                                           false,
+                                           epoch,
+                                           timestamp,
+                                           boost::none /* timeseriesFields */,
+                                           boost::none,
+                                           boost::none /* chunkSizeBytes */,
+                                           true,
+                                           initialChunks);
+    ASSERT_EQ(rt.numChunks(), 2);
+
+    // The second lookup for the same shard key is served from the routing table's shard key
+    // cache and must return the same chunk as the first.
+    auto chunk1 = rt.findIntersectingChunk(BSON("a" << 5));
+    auto chunk2 = rt.findIntersectingChunk(BSON("a" << 5));
+    ASSERT_EQ(chunk1.get(), chunk2.get());
+    ASSERT_EQ(chunk1->getLastmod(), ChunkVersion(2, 2, epoch, timestamp));
+    ASSERT_EQ(chunk1->getMin().woCompare(BSON("a" << 0)), 0);
+
+    // Refreshing produces a new routing table with a fresh cache, so lookups observe the
+    // updated chunk boundaries rather than a stale cached entry.
+    std::vector<ChunkType> changedChunks = {
+        ChunkType{uuid,
+                  ChunkRange{BSON("a" << 0), BSON("a" << 10)},
+                  ChunkVersion{3, 0, epoch, timestamp},
+                  kThisShard},
+        ChunkType{uuid,
+                  ChunkRange{BSON("a" << 10), getShardKeyPattern().globalMax()},
+                  ChunkVersion{3, 1, epoch, timestamp},
+                  kThisShard}};
+
+    auto rt1 = rt.makeUpdated(
+        boost::none /* timeseriesFields */, boost::none, boost::none, true, changedChunks);
+    ASSERT_EQ(rt1.numChunks(), 3);
+
+    auto chunk3 = rt1.findIntersectingChunk(BSON("a" << 5));
+    ASSERT_EQ(chunk3->getLastmod(), ChunkVersion(3, 0, epoch, timestamp));
+    ASSERT_EQ(chunk3->getMin().woCompare(BSON("a" << 0)), 0);
+    ASSERT_EQ(chunk3->getMax().woCompare(BSON("a" << 10)), 0);
+}
+
 }  // namespace
 }  // namespace mongo
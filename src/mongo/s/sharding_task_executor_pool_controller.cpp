@@ -231,6 +231,23 @@ auto ShardingTaskExecutorPoolController::updateHost(PoolId id, const HostState&
         poolData.target = maxConns;
     }
 
+    // Hold the target at its recent high-water mark while the retention window is open, so the
+    // pool does not shed connections on a momentary dip only to re-establish them one refresh
+    // at a time when demand returns.
+    const auto demandRetention = Milliseconds{gParameters.demandRetentionMS.load()};
+    if (demandRetention > Milliseconds{0}) {
+        const auto now = Date_t::now();
+        if (poolData.target >= poolData.retainedTarget ||
+            now >= poolData.retainedTargetExpiration) {
+            poolData.retainedTarget = poolData.target;
+            poolData.retainedTargetExpiration = now + demandRetention;
+        } else {
+            poolData.target = std::min(poolData.retainedTarget, maxConns);
+        }
+    }
+
+    poolData.isRampingUp = stats.pending + stats.ready < poolData.target;
+
     poolData.isAbleToShutdown = stats.health.isExpired;
 
     // If the pool isn't in a groupData, we can return now
@@ -295,7 +312,14 @@ auto ShardingTaskExecutorPoolController::getControls(PoolId id) -> ConnectionCon
     stdx::lock_guard lk(_mutex);
     auto& poolData = getOrInvariant(_poolDatas, id);
 
-    const size_t maxPending = gParameters.maxConnecting.load();
+    size_t maxPending = gParameters.maxConnecting.load();
+
+    // While the pool is below its target, allow a wider establishment window so a cold pool
+    // reaches steady-state in a few batches instead of one refresh at a time.
+    const size_t warmupMaxConnecting = gParameters.warmupMaxConnecting.load();
+    if (poolData.isRampingUp && warmupMaxConnecting > maxPending) {
+        maxPending = warmupMaxConnecting;
+    }
 
     auto groupData = poolData.groupData.lock();
     if (!groupData || gParameters.matchingStrategy.load() == MatchingStrategy::kDisabled) {
@@ -37,6 +37,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -100,6 +101,9 @@ public:
         AtomicWord<int> pendingTimeoutMS;
         AtomicWord<int> toRefreshTimeoutMS;
 
+        AtomicWord<int> demandRetentionMS;
+        AtomicWord<int> warmupMaxConnecting;
+
         synchronized_value<std::string> matchingStrategyString;
         AtomicWord<MatchingStrategy> matchingStrategy;
     };
@@ -192,6 +196,17 @@ private:
         // The number of connections the host should maintain
         size_t target = 0;
 
+        // A high-water mark of recent demand. While demandRetentionMS is set, the target never
+        // drops below this value until the retention window expires, so a transient dip in load
+        // does not discard connections that will be needed again shortly.
+        size_t retainedTarget = 0;
+
+        // When the retained high-water mark lapses back to the instantaneous demand
+        Date_t retainedTargetExpiration;
+
+        // True while the pool has fewer established or in-flight connections than its target
+        bool isRampingUp = false;
+
         // This host is able to shutdown
         bool isAbleToShutdown = false;
     };
@@ -47,6 +47,7 @@
 #include "mongo/s/multi_statement_transaction_requests_sender.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/s/write_ops/batch_write_op.h"
+#include "mongo/s/write_ops/shard_write_coalescer.h"
 #include "mongo/util/exit.h"
 
 namespace mongo {
@@ -104,6 +105,152 @@ bool hasTransientTransactionError(const BatchedCommandResponse& response) {
 // applies when no writes are occurring and metadata is not changing on reload.
 const int kMaxRoundsWithoutProgress(5);
 
+/**
+ * Processes a response from a shard for the given dispatched batch, noting the outcome on the
+ * batch op and the targeter. Returns true if execution of the batch op must be aborted. Throws
+ * when the error should become the top-level error instead of a write error.
+ */
+bool processResponseFromRemote(OperationContext* opCtx,
+                               NSTargeter& targeter,
+                               BatchWriteOp& batchOp,
+                               const AsyncRequestsSender::Response& response,
+                               TargetedWriteBatch* batch,
+                               BatchWriteExecStats* stats) {
+    const auto shardInfo = response.shardHostAndPort ? response.shardHostAndPort->toString()
+                                                     : batch->getEndpoint().shardName;
+
+    // Then check if we successfully got a response.
+    Status responseStatus = response.swResponse.getStatus();
+    BatchedCommandResponse batchedCommandResponse;
+    if (responseStatus.isOK()) {
+        std::string errMsg;
+        if (!batchedCommandResponse.parseBSON(response.swResponse.getValue().data, &errMsg)) {
+            responseStatus = {ErrorCodes::FailedToParse, errMsg};
+        }
+    }
+
+    if (responseStatus.isOK()) {
+        TrackedErrors trackedErrors;
+        trackedErrors.startTracking(ErrorCodes::StaleConfig);
+        trackedErrors.startTracking(ErrorCodes::OBSOLETE_StaleShardVersion);
+        trackedErrors.startTracking(ErrorCodes::StaleDbVersion);
+        trackedErrors.startTracking(ErrorCodes::TenantMigrationAborted);
+
+        LOGV2_DEBUG(22907,
+                    4,
+                    "Write results received from {shardInfo}: {response}",
+                    "Write results received",
+                    "shardInfo"_attr = shardInfo,
+                    "status"_attr = redact(batchedCommandResponse.toStatus()));
+
+        // Dispatch was ok, note response
+        batchOp.noteBatchResponse(*batch, batchedCommandResponse, &trackedErrors);
+
+        // If we are in a transaction, we must fail the whole batch on any error.
+        if (TransactionRouter::get(opCtx)) {
+            // Note: this returns a bad status if any part of the batch failed.
+            auto batchStatus = batchedCommandResponse.toStatus();
+            if (!batchStatus.isOK() && batchStatus != ErrorCodes::WouldChangeOwningShard) {
+                auto newStatus = batchStatus.withContext(
+                    str::stream() << "Encountered error from " << shardInfo
+                                  << " during a transaction");
+
+                batchOp.forgetTargetedBatchesOnTransactionAbortingError();
+
+                // Throw when there is a transient transaction error since this
+                // should be a top level error and not just a write error.
+                if (hasTransientTransactionError(batchedCommandResponse)) {
+                    uassertStatusOK(newStatus);
+                }
+
+                return true;
+            }
+        }
+
+        // Note if anything was stale
+        auto staleConfigErrors = trackedErrors.getErrors(ErrorCodes::StaleConfig);
+        {
+            const auto& staleShardVersionErrors =
+                trackedErrors.getErrors(ErrorCodes::OBSOLETE_StaleShardVersion);
+            staleConfigErrors.insert(staleConfigErrors.begin(),
+                                     staleShardVersionErrors.begin(),
+                                     staleShardVersionErrors.end());
+        }
+        const auto& staleDbErrors = trackedErrors.getErrors(ErrorCodes::StaleDbVersion);
+        const auto& tenantMigrationAbortedErrors =
+            trackedErrors.getErrors(ErrorCodes::TenantMigrationAborted);
+
+        if (!staleConfigErrors.empty()) {
+            invariant(staleDbErrors.empty());
+            noteStaleShardResponses(opCtx, staleConfigErrors, &targeter);
+            ++stats->numStaleShardBatches;
+        }
+
+        if (!staleDbErrors.empty()) {
+            invariant(staleConfigErrors.empty());
+            noteStaleDbResponses(opCtx, staleDbErrors, &targeter);
+            ++stats->numStaleDbBatches;
+        }
+
+        if (!tenantMigrationAbortedErrors.empty()) {
+            ++stats->numTenantMigrationAbortedErrors;
+        }
+
+        if (response.shardHostAndPort) {
+            // Remember that we successfully wrote to this shard
+            // NOTE: This will record lastOps for shards where we actually didn't update
+            // or delete any documents, which preserves old behavior but is conservative
+            stats->noteWriteAt(*response.shardHostAndPort,
+                               batchedCommandResponse.isLastOpSet()
+                                   ? batchedCommandResponse.getLastOp()
+                                   : repl::OpTime(),
+                               batchedCommandResponse.isElectionIdSet()
+                                   ? batchedCommandResponse.getElectionId()
+                                   : OID());
+        }
+    } else {
+        if ((ErrorCodes::isShutdownError(responseStatus) ||
+             responseStatus == ErrorCodes::CallbackCanceled) &&
+            globalInShutdownDeprecated()) {
+            // Throw an error since the mongos itself is shutting down so this should
+            // be a top level error instead of a write error.
+            uassertStatusOK(responseStatus);
+        }
+
+        // Error occurred dispatching, note it
+        const Status status = responseStatus.withContext(
+            str::stream() << "Write results unavailable "
+                          << (response.shardHostAndPort
+                                  ? "from "
+                                  : "from failing to target a host in the shard ")
+                          << shardInfo);
+
+        batchOp.noteBatchError(*batch, write_ops::WriteError(0, status));
+
+        LOGV2_DEBUG(22908,
+                    4,
+                    "Unable to receive write results from {shardInfo}: {error}",
+                    "Unable to receive write results",
+                    "shardInfo"_attr = shardInfo,
+                    "error"_attr = redact(status));
+
+        // If we are in a transaction, we must stop immediately (even for unordered).
+        if (TransactionRouter::get(opCtx)) {
+            batchOp.forgetTargetedBatchesOnTransactionAbortingError();
+
+            // Throw when there is a transient transaction error since this should be a
+            // top level error and not just a write error.
+            if (isTransientTransactionError(status.code(), false, false)) {
+                uassertStatusOK(status);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
 }  // namespace
 
 void BatchWriteExec::executeBatch(OperationContext* opCtx,
@@ -122,6 +269,9 @@ void BatchWriteExec::executeBatch(OperationContext* opCtx,
 
     BatchWriteOp batchOp(opCtx, clientRequest);
 
+    auto& coalescer = ShardWriteCoalescer::get(opCtx->getServiceContext());
+    const bool coalesceDispatch = coalescer.shouldCoalesce(opCtx, clientRequest);
+
     // Current batch status
     bool refreshedTargeter = false;
     int rounds = 0;
@@ -241,159 +391,46 @@ void BatchWriteExec::executeBatch(OperationContext* opCtx,
 
             bool isRetryableWrite = opCtx->getTxnNumber() && !TransactionRouter::get(opCtx);
 
-            MultiStatementTransactionRequestsSender ars(
-                opCtx,
-                Grid::get(opCtx)->getExecutorPool()->getArbitraryExecutor(),
-                clientRequest.getNS().db().toString(),
-                requests,
-                kPrimaryOnlyReadPreference,
-                isRetryableWrite ? Shard::RetryPolicy::kIdempotent : Shard::RetryPolicy::kNoRetry);
-            numSent += pendingBatches.size();
-
-            //
-            // Receive the responses.
-            //
-
-            while (!ars.done()) {
-                // Block until a response is available.
-                auto response = ars.next();
-
-                // Get the TargetedWriteBatch to find where to put the response
-                dassert(pendingBatches.find(response.shardId) != pendingBatches.end());
-                TargetedWriteBatch* batch = pendingBatches.find(response.shardId)->second.get();
-
-                const auto shardInfo = response.shardHostAndPort
-                    ? response.shardHostAndPort->toString()
-                    : batch->getEndpoint().shardName;
-
-                // Then check if we successfully got a response.
-                Status responseStatus = response.swResponse.getStatus();
-                BatchedCommandResponse batchedCommandResponse;
-                if (responseStatus.isOK()) {
-                    std::string errMsg;
-                    if (!batchedCommandResponse.parseBSON(response.swResponse.getValue().data,
-                                                          &errMsg)) {
-                        responseStatus = {ErrorCodes::FailedToParse, errMsg};
-                    }
+            if (coalesceDispatch && pendingBatches.size() == 1) {
+                // All child batches in this round target a single shard, so the round trip can go
+                // through the coalescer without giving up any dispatch parallelism.
+                invariant(requests.size() == 1);
+                auto response = coalescer.dispatch(opCtx,
+                                                   requests.front().shardId,
+                                                   clientRequest.getNS().db().toString(),
+                                                   requests.front().cmdObj);
+                numSent += pendingBatches.size();
+
+                TargetedWriteBatch* batch = pendingBatches.begin()->second.get();
+                if (processResponseFromRemote(opCtx, targeter, batchOp, response, batch, stats)) {
+                    abortBatch = true;
                 }
-
-                if (responseStatus.isOK()) {
-                    TrackedErrors trackedErrors;
-                    trackedErrors.startTracking(ErrorCodes::StaleConfig);
-                    trackedErrors.startTracking(ErrorCodes::OBSOLETE_StaleShardVersion);
-                    trackedErrors.startTracking(ErrorCodes::StaleDbVersion);
-                    trackedErrors.startTracking(ErrorCodes::TenantMigrationAborted);
-
-                    LOGV2_DEBUG(22907,
-                                4,
-                                "Write results received from {shardInfo}: {response}",
-                                "Write results received",
-                                "shardInfo"_attr = shardInfo,
-                                "status"_attr = redact(batchedCommandResponse.toStatus()));
-
-                    // Dispatch was ok, note response
-                    batchOp.noteBatchResponse(*batch, batchedCommandResponse, &trackedErrors);
-
-                    // If we are in a transaction, we must fail the whole batch on any error.
-                    if (TransactionRouter::get(opCtx)) {
-                        // Note: this returns a bad status if any part of the batch failed.
-                        auto batchStatus = batchedCommandResponse.toStatus();
-                        if (!batchStatus.isOK() &&
-                            batchStatus != ErrorCodes::WouldChangeOwningShard) {
-                            auto newStatus = batchStatus.withContext(
-                                str::stream() << "Encountered error from " << shardInfo
-                                              << " during a transaction");
-
-                            batchOp.forgetTargetedBatchesOnTransactionAbortingError();
-
-                            // Throw when there is a transient transaction error since this
-                            // should be a top level error and not just a write error.
-                            if (hasTransientTransactionError(batchedCommandResponse)) {
-                                uassertStatusOK(newStatus);
-                            }
-
-                            abortBatch = true;
-                            break;
-                        }
-                    }
-
-                    // Note if anything was stale
-                    auto staleConfigErrors = trackedErrors.getErrors(ErrorCodes::StaleConfig);
-                    {
-                        const auto& staleShardVersionErrors =
-                            trackedErrors.getErrors(ErrorCodes::OBSOLETE_StaleShardVersion);
-                        staleConfigErrors.insert(staleConfigErrors.begin(),
-                                                 staleShardVersionErrors.begin(),
-                                                 staleShardVersionErrors.end());
-                    }
-                    const auto& staleDbErrors = trackedErrors.getErrors(ErrorCodes::StaleDbVersion);
-                    const auto& tenantMigrationAbortedErrors =
-                        trackedErrors.getErrors(ErrorCodes::TenantMigrationAborted);
-
-                    if (!staleConfigErrors.empty()) {
-                        invariant(staleDbErrors.empty());
-                        noteStaleShardResponses(opCtx, staleConfigErrors, &targeter);
-                        ++stats->numStaleShardBatches;
-                    }
-
-                    if (!staleDbErrors.empty()) {
-                        invariant(staleConfigErrors.empty());
-                        noteStaleDbResponses(opCtx, staleDbErrors, &targeter);
-                        ++stats->numStaleDbBatches;
-                    }
-
-                    if (!tenantMigrationAbortedErrors.empty()) {
-                        ++stats->numTenantMigrationAbortedErrors;
-                    }
-
-                    if (response.shardHostAndPort) {
-                        // Remember that we successfully wrote to this shard
-                        // NOTE: This will record lastOps for shards where we actually didn't update
-                        // or delete any documents, which preserves old behavior but is conservative
-                        stats->noteWriteAt(*response.shardHostAndPort,
-                                           batchedCommandResponse.isLastOpSet()
-                                               ? batchedCommandResponse.getLastOp()
-                                               : repl::OpTime(),
-                                           batchedCommandResponse.isElectionIdSet()
-                                               ? batchedCommandResponse.getElectionId()
-                                               : OID());
-                    }
-                } else {
-                    if ((ErrorCodes::isShutdownError(responseStatus) ||
-                         responseStatus == ErrorCodes::CallbackCanceled) &&
-                        globalInShutdownDeprecated()) {
-                        // Throw an error since the mongos itself is shutting down so this should
-                        // be a top level error instead of a write error.
-                        uassertStatusOK(responseStatus);
-                    }
-
-                    // Error occurred dispatching, note it
-                    const Status status = responseStatus.withContext(
-                        str::stream() << "Write results unavailable "
-                                      << (response.shardHostAndPort
-                                              ? "from "
-                                              : "from failing to target a host in the shard ")
-                                      << shardInfo);
-
-                    batchOp.noteBatchError(*batch, write_ops::WriteError(0, status));
-
-                    LOGV2_DEBUG(22908,
-                                4,
-                                "Unable to receive write results from {shardInfo}: {error}",
-                                "Unable to receive write results",
-                                "shardInfo"_attr = shardInfo,
-                                "error"_attr = redact(status));
-
-                    // If we are in a transaction, we must stop immediately (even for unordered).
-                    if (TransactionRouter::get(opCtx)) {
-                        batchOp.forgetTargetedBatchesOnTransactionAbortingError();
-
-                        // Throw when there is a transient transaction error since this should be a
-                        // top level error and not just a write error.
-                        if (isTransientTransactionError(status.code(), false, false)) {
-                            uassertStatusOK(status);
-                        }
-
+            } else {
+                MultiStatementTransactionRequestsSender ars(
+                    opCtx,
+                    Grid::get(opCtx)->getExecutorPool()->getArbitraryExecutor(),
+                    clientRequest.getNS().db().toString(),
+                    requests,
+                    kPrimaryOnlyReadPreference,
+                    isRetryableWrite ? Shard::RetryPolicy::kIdempotent
+                                     : Shard::RetryPolicy::kNoRetry);
+                numSent += pendingBatches.size();
+
+                //
+                // Receive the responses.
+                //
+
+                while (!ars.done()) {
+                    // Block until a response is available.
+                    auto response = ars.next();
+
+                    // Get the TargetedWriteBatch to find where to put the response
+                    dassert(pendingBatches.find(response.shardId) != pendingBatches.end());
+                    TargetedWriteBatch* batch =
+                        pendingBatches.find(response.shardId)->second.get();
+
+                    if (processResponseFromRemote(
+                            opCtx, targeter, batchOp, response, batch, stats)) {
                         abortBatch = true;
                         break;
                     }
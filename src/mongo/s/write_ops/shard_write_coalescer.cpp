@@ -0,0 +1,263 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/s/write_ops/shard_write_coalescer.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/ops/write_ops.h"
+#include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/s/grid.h"
+#include "mongo/s/transaction_router.h"
+#include "mongo/s/write_ops/batched_command_request.h"
+#include "mongo/s/write_ops/batched_command_response.h"
+#include "mongo/s/write_ops/shard_write_coalescer_gen.h"
+
+namespace mongo {
+namespace {
+
+const auto getShardWriteCoalescer = ServiceContext::declareDecoration<ShardWriteCoalescer>();
+
+const ReadPreferenceSetting kPrimaryOnlyReadPreference(ReadPreference::PrimaryOnly);
+
+// Caps on the size of a merged command, so that joining a group can never push a batch that was
+// individually valid over the limits the shard enforces. The byte cap leaves ample headroom below
+// the maximum command size for the non-document fields.
+constexpr size_t kMaxCoalescedDocuments = write_ops::kMaxWriteBatchSize;
+constexpr int kMaxCoalescedDocumentBytes = BSONObjMaxUserSize / 2;
+
+}  // namespace
+
+ShardWriteCoalescer& ShardWriteCoalescer::get(ServiceContext* service) {
+    return getShardWriteCoalescer(service);
+}
+
+bool ShardWriteCoalescer::shouldCoalesce(OperationContext* opCtx,
+                                         const BatchedCommandRequest& clientRequest) const {
+    if (gShardWriteCoalescingWindowMicros.load() <= 0)
+        return false;
+
+    if (clientRequest.getBatchType() != BatchedCommandRequest::BatchType_Insert ||
+        clientRequest.getWriteCommandRequestBase().getOrdered())
+        return false;
+
+    // Writes in a session are executed with the client's lsid and txnNumber, which a command
+    // merged across clients cannot carry.
+    return !opCtx->getLogicalSessionId() && !TransactionRouter::get(opCtx);
+}
+
+AsyncRequestsSender::Response ShardWriteCoalescer::dispatch(OperationContext* opCtx,
+                                                            const ShardId& shardId,
+                                                            const std::string& dbName,
+                                                            const BSONObj& cmdObj) {
+    auto cmd = cmdObj.getOwned();
+    auto header = cmd.removeField(write_ops::InsertCommandRequest::kDocumentsFieldName);
+
+    std::vector<BSONObj> documents;
+    int documentBytes = 0;
+    for (auto&& doc : cmd[write_ops::InsertCommandRequest::kDocumentsFieldName].Obj()) {
+        documents.push_back(doc.Obj());
+        documentBytes += doc.Obj().objsize();
+    }
+
+    // Commands may only be merged when every field other than the documents array is identical,
+    // so the group is keyed by the exact bytes of the remaining fields.
+    std::string key;
+    key.reserve(shardId.toString().size() + dbName.size() + header.objsize() + 2);
+    key.append(shardId.toString());
+    key.push_back('\0');
+    key.append(dbName);
+    key.push_back('\0');
+    key.append(header.objdata(), header.objsize());
+
+    auto pf = makePromiseFuture<AsyncRequestsSender::Response>();
+
+    std::shared_ptr<Group> group;
+    bool isLeader = false;
+    bool dispatchImmediately = false;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto& slot = _groups[key];
+        if (slot &&
+            (slot->documents.size() + documents.size() <= kMaxCoalescedDocuments &&
+             slot->documentBytes + documentBytes <= kMaxCoalescedDocumentBytes)) {
+            group = slot;
+        } else if (!slot) {
+            slot = std::make_shared<Group>();
+            slot->shardId = shardId;
+            slot->dbName = dbName;
+            slot->header = header;
+            group = slot;
+            isLeader = true;
+        } else {
+            // The pending group is full. Dispatch this batch on its own, without registering the
+            // group, rather than splitting the batch across groups.
+            group = std::make_shared<Group>();
+            group->shardId = shardId;
+            group->dbName = dbName;
+            group->header = header;
+            isLeader = true;
+            dispatchImmediately = true;
+        }
+
+        group->participants.push_back(
+            {std::move(cmd), group->documents.size(), documents.size(), std::move(pf.promise)});
+        group->documents.insert(group->documents.end(), documents.begin(), documents.end());
+        group->documentBytes += documentBytes;
+    }
+
+    if (isLeader) {
+        if (!dispatchImmediately) {
+            // Give concurrent client requests a chance to join the group before dispatching.
+            try {
+                opCtx->sleepFor(Microseconds(gShardWriteCoalescingWindowMicros.load()));
+            } catch (const DBException&) {
+                // Even if this operation was interrupted, the group must still be dispatched:
+                // other requests may have joined it and are waiting on this thread. The dispatch
+                // below will fail fast on an interrupted operation context.
+            }
+
+            stdx::lock_guard<Latch> lk(_mutex);
+            auto it = _groups.find(key);
+            if (it != _groups.end() && it->second == group)
+                _groups.erase(it);
+        }
+
+        try {
+            _dispatchGroup(opCtx, *group);
+        } catch (const DBException& ex) {
+            // _dispatchGroup only fulfills promises as its final step, so on an exception no
+            // participant has been answered yet.
+            for (auto&& participant : group->participants) {
+                participant.promise.setError(ex.toStatus());
+            }
+        }
+    }
+
+    auto swResponse = std::move(pf.future).getNoThrow(opCtx);
+    if (!swResponse.isOK())
+        return AsyncRequestsSender::Response{shardId, swResponse.getStatus(), boost::none};
+    return std::move(swResponse.getValue());
+}
+
+void ShardWriteCoalescer::_dispatchGroup(OperationContext* opCtx, Group& group) {
+    BSONObjBuilder cmdBuilder;
+    cmdBuilder.appendElements(group.header);
+    {
+        BSONArrayBuilder docsBuilder(
+            cmdBuilder.subarrayStart(write_ops::InsertCommandRequest::kDocumentsFieldName));
+        for (auto&& doc : group.documents) {
+            docsBuilder.append(doc);
+        }
+    }
+
+    if (group.participants.size() > 1) {
+        LOGV2_DEBUG(6650017,
+                    4,
+                    "Dispatching coalesced write batch",
+                    "shardId"_attr = group.shardId,
+                    "clientBatches"_attr = group.participants.size(),
+                    "documents"_attr = group.documents.size());
+    }
+
+    std::vector<AsyncRequestsSender::Request> requests;
+    requests.emplace_back(group.shardId, cmdBuilder.obj());
+
+    AsyncRequestsSender ars(opCtx,
+                            Grid::get(opCtx)->getExecutorPool()->getArbitraryExecutor(),
+                            group.dbName,
+                            requests,
+                            kPrimaryOnlyReadPreference,
+                            Shard::RetryPolicy::kNoRetry,
+                            nullptr /* no resource yielder */);
+    auto response = ars.next();
+    invariant(ars.done());
+
+    // On a dispatch error, an unparseable response or a command-level failure there is nothing to
+    // demultiplex; every participant observes the shard's response as-is.
+    BatchedCommandResponse merged;
+    std::string errMsg;
+    if (!response.swResponse.isOK() || group.participants.size() == 1 ||
+        !merged.parseBSON(response.swResponse.getValue().data, &errMsg) || !merged.getOk()) {
+        for (auto&& participant : group.participants) {
+            participant.promise.emplaceValue(response);
+        }
+        return;
+    }
+
+    // Split the merged response: each participant contributed a contiguous range of documents, so
+    // its write errors are the ones whose index falls within the range, rebased to the range's
+    // start. Build all of the responses before fulfilling any promise, so that an exception here
+    // cannot leave the group partially answered.
+    const auto elapsed = response.swResponse.getValue().elapsed.value_or(Microseconds(0));
+    std::vector<AsyncRequestsSender::Response> splitResponses;
+    splitResponses.reserve(group.participants.size());
+    for (auto&& participant : group.participants) {
+        BatchedCommandResponse split;
+        split.setStatus(Status::OK());
+
+        long long n = participant.count;
+        if (merged.isErrDetailsSet()) {
+            for (auto&& error : merged.getErrDetails()) {
+                const auto index = static_cast<size_t>(error.getIndex());
+                if (index >= participant.offset && index < participant.offset + participant.count) {
+                    split.addToErrDetails(write_ops::WriteError(
+                        static_cast<int32_t>(index - participant.offset), error.getStatus()));
+                    --n;
+                }
+            }
+        }
+        split.setN(n);
+
+        if (merged.isLastOpSet())
+            split.setLastOp(merged.getLastOp());
+        if (merged.isElectionIdSet())
+            split.setElectionId(merged.getElectionId());
+        if (merged.isWriteConcernErrorSet()) {
+            auto wcError = std::make_unique<WriteConcernErrorDetail>();
+            merged.getWriteConcernError()->cloneTo(wcError.get());
+            split.setWriteConcernError(wcError.release());
+        }
+
+        splitResponses.push_back(
+            AsyncRequestsSender::Response{group.shardId,
+                                          executor::RemoteCommandResponse(split.toBSON(), elapsed),
+                                          response.shardHostAndPort});
+    }
+
+    for (size_t i = 0; i < group.participants.size(); ++i) {
+        group.participants[i].promise.emplaceValue(std::move(splitResponses[i]));
+    }
+}
+
+}  // namespace mongo
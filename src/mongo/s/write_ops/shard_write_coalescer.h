@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/s/async_requests_sender.h"
+#include "mongo/s/shard_id.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+
+class BatchedCommandRequest;
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Coalesces insert batches targeted at the same shard by concurrent client requests into a single
+ * shard command, to cut the per-command overhead on the shards when many clients issue small
+ * batches at once. The first request to arrive for a given (shard, command fields) combination
+ * waits out a short gather window, during which later requests append their documents to the
+ * pending group, then dispatches one merged command and demultiplexes the response back to every
+ * participant.
+ *
+ * Only unordered inserts issued outside of sessions and transactions are eligible: writes in
+ * sessions carry per-client identity (lsid, txnNumber) that a merged command cannot represent,
+ * and ordered batches rely on stopping at the first error within a single client's sequence.
+ * Commands whose non-document fields differ in any way (write concern, shard version, database
+ * version, document validation settings, ...) are never merged.
+ *
+ * Disabled by default; enabled by setting shardWriteCoalescingWindowMicros to a non-zero value.
+ */
+class ShardWriteCoalescer {
+public:
+    static ShardWriteCoalescer& get(ServiceContext* service);
+
+    /**
+     * Returns true if child batches of 'clientRequest' may be dispatched through dispatch().
+     */
+    bool shouldCoalesce(OperationContext* opCtx, const BatchedCommandRequest& clientRequest) const;
+
+    /**
+     * Dispatches the shard insert command 'cmdObj', possibly merged with commands from concurrent
+     * client requests targeting the same shard, and blocks until this request's share of the
+     * response is available. The returned response is indistinguishable from one obtained by
+     * sending 'cmdObj' on its own: write error indexes are rebased to the caller's documents.
+     *
+     * Must only be called when shouldCoalesce() returned true for the client request.
+     */
+    AsyncRequestsSender::Response dispatch(OperationContext* opCtx,
+                                           const ShardId& shardId,
+                                           const std::string& dbName,
+                                           const BSONObj& cmdObj);
+
+private:
+    struct Participant {
+        // The original shard command; keeps the document payloads referenced by the group alive.
+        BSONObj cmd;
+
+        // The contiguous range of the group's documents contributed by this participant.
+        size_t offset;
+        size_t count;
+
+        Promise<AsyncRequestsSender::Response> promise;
+    };
+
+    struct Group {
+        ShardId shardId;
+        std::string dbName;
+
+        // The shard command minus its 'documents' array, shared by all participants.
+        BSONObj header;
+
+        std::vector<BSONObj> documents;
+        int documentBytes = 0;
+        std::vector<Participant> participants;
+    };
+
+    /**
+     * Sends the group's merged command and fulfills every participant's promise with its share of
+     * the response.
+     */
+    void _dispatchGroup(OperationContext* opCtx, Group& group);
+
+    // Guards _groups.
+    Mutex _mutex = MONGO_MAKE_LATCH("ShardWriteCoalescer::_mutex");
+
+    // Pending groups, keyed by shard, database and the exact bytes of the command fields that all
+    // participants must share.
+    stdx::unordered_map<std::string, std::shared_ptr<Group>> _groups;
+};
+
+}  // namespace mongo
@@ -43,6 +43,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/scripting/dbdirectclient_factory.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/ctype.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/file.h"
@@ -434,23 +435,100 @@ private:
 };
 
 ScopeCache scopeCache;
+
+/**
+ * Caches at most one idle scope per thread. Scopes created for the current thread execute
+ * JavaScript on the calling thread and must never migrate to another one, so they cannot live in
+ * the global ScopeCache. Reusing a scope skips the expensive setup of a fresh JS runtime and, as
+ * the scope keeps its compiled-function cache across reset(), recompilation of function bodies it
+ * has already seen.
+ */
+class ThreadScopeCache {
+public:
+    std::shared_ptr<Scope> tryAcquire(OperationContext* opCtx, const string& poolName) {
+        // Always evict the cached entry: either it is handed to the caller, or it is destroyed
+        // here so that at most one scope bound to this thread exists when the caller creates a
+        // new one.
+        auto cached = std::move(_cached);
+        _cached = {};
+
+        if (!cached.scope || cached.poolName != poolName) {
+            return nullptr;
+        }
+
+        if (Date_t::now() - cached.scope->getCreateTime() > kMaxScopeReuseTime) {
+            return nullptr;  // too old to reuse
+        }
+
+        cached.scope->reset();
+        cached.scope->registerOperation(opCtx);
+        return std::move(cached.scope);
+    }
+
+    void release(const string& poolName, const std::shared_ptr<Scope>& scope) {
+        if (scope->hasOutOfMemoryException()) {
+            return;
+        }
+
+        if (Date_t::now() - scope->getCreateTime() > kMaxScopeReuseTime) {
+            return;  // too old to save
+        }
+
+        if (!scope->getError().empty()) {
+            return;  // not saving errored scopes
+        }
+
+        scope->reset();
+        _cached = {scope, poolName};
+    }
+
+    void clear() {
+        _cached = {};
+    }
+
+private:
+    struct ScopeAndPool {
+        std::shared_ptr<Scope> scope;
+        string poolName;
+    };
+
+    constexpr static inline Seconds kMaxScopeReuseTime = Seconds(10);
+
+    ScopeAndPool _cached;
+};
+
+thread_local ThreadScopeCache threadScopeCache;
 }  // anonymous namespace
 
 void ScriptEngine::dropScopeCache() {
     scopeCache.clear();
+    // Only the calling thread's cached scope can be dropped from here; other threads' scopes are
+    // discarded when they expire on their next acquire.
+    threadScopeCache.clear();
 }
 
 class PooledScope : public Scope {
 public:
-    PooledScope(const std::string& pool, const std::shared_ptr<Scope>& real)
-        : _pool(pool), _real(real) {}
+    PooledScope(const std::string& pool, const std::shared_ptr<Scope>& real, bool perThread = false)
+        : _pool(pool),
+          _real(real),
+          _perThread(perThread),
+          _acquireThreadId(stdx::this_thread::get_id()) {}
 
     virtual ~PooledScope() {
         // SERVER-53671: Sometimes, ScopeCache::release() will generate an 'InterruptedAtShutdown'
         // exception. We catch and ignore such exceptions here to prevent them from crashing the
         // server while it is shutting down.
         try {
-            scopeCache.release(_pool, _real);
+            if (_perThread) {
+                // A scope bound to the acquiring thread must not be returned to another thread's
+                // cache; if we are being destroyed elsewhere, simply let the scope die with us.
+                if (_acquireThreadId == stdx::this_thread::get_id()) {
+                    threadScopeCache.release(_pool, _real);
+                }
+            } else {
+                scopeCache.release(_pool, _real);
+            }
         } catch (const ExceptionFor<ErrorCodes::InterruptedAtShutdown>&) {
             LOGV2(5367100, "Interrupted at shutdown during ~PooledScope()");
         }
@@ -598,6 +676,8 @@ protected:
 private:
     string _pool;
     std::shared_ptr<Scope> _real;
+    bool _perThread;
+    stdx::thread::id _acquireThreadId;
 };
 
 /** Get a scope from the pool of scopes matching the supplied pool name */
@@ -618,6 +698,26 @@ unique_ptr<Scope> ScriptEngine::getPooledScope(OperationContext* opCtx,
     return p;
 }
 
+/** Get a scope cached on the current thread, or create a new thread-bound one */
+unique_ptr<Scope> ScriptEngine::getPooledScopeForCurrentThread(OperationContext* opCtx,
+                                                               const string& db,
+                                                               const string& scopeType,
+                                                               boost::optional<int> jsHeapLimitMB) {
+    // Scopes created with different heap limits are not interchangeable.
+    const string fullPoolName = str::stream()
+        << db << scopeType << "_heap" << jsHeapLimitMB.value_or(-1);
+    std::shared_ptr<Scope> s = threadScopeCache.tryAcquire(opCtx, fullPoolName);
+    if (!s) {
+        s.reset(newScopeForCurrentThread(jsHeapLimitMB));
+        s->registerOperation(opCtx);
+    }
+
+    unique_ptr<Scope> p;
+    p.reset(new PooledScope(fullPoolName, s, true /* perThread */));
+    p->setLocalDB(db);
+    return p;
+}
+
 void (*ScriptEngine::_connectCallback)(DBClientBase&, StringData) = nullptr;
 
 ScriptEngine* getGlobalScriptEngine() {
@@ -263,6 +263,23 @@ public:
                                           const std::string& db,
                                           const std::string& scopeType);
 
+    /** gets an idle scope cached on the current thread or a new one if there is none
+     *
+     * Unlike getPooledScope(), the returned scope runs JavaScript directly on the calling thread
+     * and must only be used from it. A reused scope keeps its compiled-function cache, so
+     * repeated executions of the same function body skip both scope setup and compilation.
+     *
+     * @param db The db name
+     * @param scopeType A unique id to limit scope sharing.
+     *                  This must include authenticated users.
+     * @param jsHeapLimitMB The heap limit the scope is created with.
+     * @return the scope
+     */
+    std::unique_ptr<Scope> getPooledScopeForCurrentThread(OperationContext* opCtx,
+                                                          const std::string& db,
+                                                          const std::string& scopeType,
+                                                          boost::optional<int> jsHeapLimitMB);
+
     void setScopeInitCallback(void (*func)(Scope&)) {
         _scopeInitCallback = func;
     }
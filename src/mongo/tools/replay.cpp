@@ -0,0 +1,338 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
+
+#include "mongo/platform/basic.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/data_range_cursor.h"
+#include "mongo/base/init.h"
+#include "mongo/base/initializer.h"
+#include "mongo/bson/bson_validate.h"
+#include "mongo/client/async_client.h"
+#include "mongo/db/concurrency/locker_noop_client_observer.h"
+#include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/tools/mongoreplay_options.h"
+#include "mongo/transport/transport_layer_asio.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/exit.h"
+#include "mongo/util/exit_code.h"
+#include "mongo/util/quick_exit.h"
+#include "mongo/util/signal_handlers.h"
+#include "mongo/util/str.h"
+#include "mongo/util/text.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * One captured command. The capture file is a flat sequence of BSON documents of the form
+ *
+ *   {
+ *       session: <long>,   // logical connection the op was captured from
+ *       offset:  <long>,   // microseconds since the start of the capture
+ *       db:      <string>, // database the command ran against
+ *       command: <object>, // the command body as received by the server
+ *       micros:  <long>    // latency observed when the op was captured
+ *   }
+ *
+ * with no surrounding framing, so captures can be produced by anything that can write BSON and
+ * concatenated with 'cat'.
+ */
+struct CapturedOp {
+    int64_t sessionId;
+    Microseconds offset;
+    std::string db;
+    BSONObj command;
+    Microseconds observedLatency;
+};
+
+/**
+ * Replayed-vs-observed latency totals for one command shape. Shapes are keyed coarsely by
+ * database and command name, which is enough to line a replay report up against the server's
+ * per-command serverStatus metrics.
+ */
+struct ShapeStats {
+    int64_t count = 0;
+    int64_t failed = 0;
+    int64_t observedTotalMicros = 0;
+    int64_t replayedTotalMicros = 0;
+};
+
+std::vector<CapturedOp> loadCaptureFile(const std::string& path) {
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    uassert(6929917,
+            str::stream() << "Unable to open capture file \"" << path << "\" for reading",
+            static_cast<bool>(stream));
+
+    std::string contents;
+    while (stream) {
+        char buffer[4096];
+        stream.read(buffer, sizeof(buffer));
+        contents.append(buffer, stream.gcount());
+    }
+
+    // Walk the raw bytes as a series of contiguous BSON objects, validating each one before
+    // interpreting it, as readDumpFile() does in the shell.
+    std::vector<CapturedOp> ops;
+    ConstDataRangeCursor cursor(contents.data(), contents.size());
+    while (!cursor.empty()) {
+        const auto valid = cursor.length();
+        const auto obj = uassertStatusOK(cursor.readAndAdvanceNoThrow<BSONObj>());
+        uassertStatusOK(validateBSON(obj.objdata(), valid));
+
+        auto session = obj["session"];
+        auto offset = obj["offset"];
+        auto db = obj["db"];
+        auto command = obj["command"];
+        auto micros = obj["micros"];
+        uassert(6929918,
+                str::stream() << "Malformed captured op at index " << ops.size() << ": "
+                              << redact(obj),
+                session.isNumber() && offset.isNumber() && db.type() == String &&
+                    command.type() == Object && micros.isNumber() &&
+                    !command.Obj().isEmpty());
+
+        ops.push_back({session.safeNumberLong(),
+                       Microseconds{offset.safeNumberLong()},
+                       db.str(),
+                       command.Obj().getOwned(),
+                       Microseconds{micros.safeNumberLong()}});
+    }
+
+    uassert(
+        6929919, str::stream() << "Capture file \"" << path << "\" contains no ops", !ops.empty());
+    return ops;
+}
+
+std::string opShape(const CapturedOp& op) {
+    return str::stream() << op.db << "." << op.command.firstElementFieldName();
+}
+
+/**
+ * Replays the ops of a single captured session, in capture order, over one dedicated
+ * connection. A session's ops must not be reordered or interleaved with another connection's
+ * (cursors, transactions and causal consistency are all per-connection state), so each session
+ * gets its own AsyncDBClient; the sockets still share the one reactor thread.
+ *
+ * 'start' is the common replay epoch: each op is dispatched once its scaled capture offset has
+ * elapsed since 'start', which reproduces both the original inter-arrival spacing within this
+ * session and the original concurrency across sessions.
+ */
+void replaySession(ServiceContext* serviceContext,
+                   transport::ReactorHandle reactor,
+                   const HostAndPort& dest,
+                   const std::vector<const CapturedOp*>& ops,
+                   Date_t start,
+                   std::map<std::string, ShapeStats>* stats,
+                   Mutex* statsMutex) try {
+    auto client =
+        AsyncDBClient::connect(
+            dest, transport::kGlobalSSLMode, serviceContext, reactor, Seconds{30})
+            .get();
+    client->initWireVersion("mongoreplay", nullptr).get();
+
+    const double speed = mongoReplayGlobalParams.speed;
+    for (const auto* op : ops) {
+        auto scheduled = start +
+            Microseconds{static_cast<int64_t>(durationCount<Microseconds>(op->offset) / speed)};
+        if (auto now = Date_t::now(); scheduled > now) {
+            sleepFor(scheduled - now);
+        }
+
+        Timer timer;
+        bool ok = false;
+        try {
+            auto reply = client->runCommand(OpMsgRequest::fromDBAndBody(op->db, op->command)).get();
+            ok = reply->getCommandReply()["ok"].trueValue();
+        } catch (const DBException& e) {
+            LOGV2_DEBUG(6650027,
+                        1,
+                        "Replayed op failed",
+                        "shape"_attr = opShape(*op),
+                        "error"_attr = redact(e));
+        }
+        auto replayedMicros = timer.micros();
+
+        stdx::lock_guard<Latch> lk(*statsMutex);
+        auto& shapeStats = (*stats)[opShape(*op)];
+        shapeStats.count++;
+        if (!ok) {
+            shapeStats.failed++;
+        }
+        shapeStats.observedTotalMicros += durationCount<Microseconds>(op->observedLatency);
+        shapeStats.replayedTotalMicros += replayedMicros;
+    }
+
+    client->end();
+} catch (const DBException& e) {
+    LOGV2_ERROR(6650028,
+                "Failed to replay session",
+                "session"_attr = ops.front()->sessionId,
+                "error"_attr = redact(e));
+}
+
+void printReport(const std::map<std::string, ShapeStats>& stats) {
+    int64_t totalOps = 0;
+    std::cout << std::left << std::setw(40) << "shape" << std::right << std::setw(10) << "count"
+              << std::setw(10) << "failed" << std::setw(16) << "observed(us)" << std::setw(16)
+              << "replayed(us)" << std::setw(12) << "delta(%)" << std::endl;
+    for (auto&& [shape, shapeStats] : stats) {
+        totalOps += shapeStats.count;
+        auto observedMean = shapeStats.observedTotalMicros / shapeStats.count;
+        auto replayedMean = shapeStats.replayedTotalMicros / shapeStats.count;
+        auto deltaPercent = observedMean
+            ? 100.0 * (replayedMean - observedMean) / static_cast<double>(observedMean)
+            : 0.0;
+        std::cout << std::left << std::setw(40) << shape << std::right << std::setw(10)
+                  << shapeStats.count << std::setw(10) << shapeStats.failed << std::setw(16)
+                  << observedMean << std::setw(16) << replayedMean << std::setw(12) << std::fixed
+                  << std::setprecision(1) << deltaPercent << std::endl;
+    }
+    std::cout << totalOps << " ops replayed" << std::endl;
+}
+
+}  // namespace
+
+int replayMain(int argc, char** argv) {
+
+    registerShutdownTask([&] {
+        // NOTE: This function may be called at any time. It must not
+        // depend on the prior execution of mongo initializers or the
+        // existence of threads.
+        if (hasGlobalServiceContext()) {
+            auto sc = getGlobalServiceContext();
+            if (sc->getTransportLayer())
+                sc->getTransportLayer()->shutdown();
+        }
+    });
+
+    setupSignalHandlers();
+    runGlobalInitializersOrDie(std::vector<std::string>(argv, argv + argc));
+    startSignalProcessingThread(LogFileStatus::kNoLogFileToRotate);
+
+    auto serviceContextHolder = ServiceContext::make();
+    serviceContextHolder->registerClientObserver(std::make_unique<LockerNoopClientObserver>());
+    setGlobalServiceContext(std::move(serviceContextHolder));
+    auto serviceContext = getGlobalServiceContext();
+
+    {
+        transport::TransportLayerASIO::Options opts;
+        opts.mode = transport::TransportLayerASIO::Options::kEgress;
+
+        auto tl = std::make_unique<mongo::transport::TransportLayerASIO>(opts, nullptr);
+        serviceContext->setTransportLayer(std::move(tl));
+    }
+
+    if (auto status = serviceContext->getTransportLayer()->setup(); !status.isOK()) {
+        LOGV2(6650029, "Error setting up transport layer", "error"_attr = status);
+        return EXIT_NET_ERROR;
+    }
+
+    if (auto status = serviceContext->getTransportLayer()->start(); !status.isOK()) {
+        LOGV2(6650030, "Error starting transport layer", "error"_attr = status);
+        return EXIT_NET_ERROR;
+    }
+
+    const HostAndPort dest(mongoReplayGlobalParams.destUri);
+    const auto ops = loadCaptureFile(mongoReplayGlobalParams.inputFile);
+
+    // Partition the capture by session, preserving capture order within each.
+    stdx::unordered_map<int64_t, std::vector<const CapturedOp*>> sessions;
+    for (auto&& op : ops) {
+        sessions[op.sessionId].push_back(&op);
+    }
+
+    LOGV2(6650031,
+          "Replaying capture",
+          "ops"_attr = ops.size(),
+          "sessions"_attr = sessions.size(),
+          "dest"_attr = dest,
+          "speed"_attr = mongoReplayGlobalParams.speed);
+
+    auto reactor =
+        serviceContext->getTransportLayer()->getReactor(transport::TransportLayer::kNewReactor);
+    stdx::thread reactorThread([&] { reactor->run(); });
+
+    std::map<std::string, ShapeStats> stats;
+    Mutex statsMutex = MONGO_MAKE_LATCH("mongoreplay::statsMutex");
+    const auto start = Date_t::now();
+
+    std::vector<stdx::thread> workers;
+    workers.reserve(sessions.size());
+    for (auto&& session : sessions) {
+        workers.emplace_back([&, sessionOps = &session.second] {
+            replaySession(serviceContext, reactor, dest, *sessionOps, start, &stats, &statsMutex);
+        });
+    }
+    for (auto&& worker : workers) {
+        worker.join();
+    }
+
+    reactor->stop();
+    reactorThread.join();
+
+    printReport(stats);
+
+    serviceContext->getTransportLayer()->shutdown();
+    return EXIT_CLEAN;
+}
+
+}  // namespace mongo
+
+#if defined(_WIN32)
+// In Windows, wmain() is an alternate entry point for main(), and receives the same parameters
+// as main() but encoded in Windows Unicode (UTF-16); "wide" 16-bit wchar_t characters.  The
+// WindowsCommandLine object converts these wide character strings to a UTF-8 coded equivalent
+// and makes them available through the argv() and envp() members.  This enables replayMain()
+// to process UTF-8 encoded arguments and environment variables without regard to platform.
+int wmain(int argc, wchar_t* argvW[]) {
+    mongo::quickExit(mongo::replayMain(argc, mongo::WindowsCommandLine(argc, argvW).argv()));
+}
+#else
+int main(int argc, char* argv[]) {
+    mongo::quickExit(mongo::replayMain(argc, argv));
+}
+#endif
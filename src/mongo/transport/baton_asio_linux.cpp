@@ -38,6 +38,7 @@
 #include "mongo/base/status.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/errno_util.h"
 #include "mongo/util/fail_point.h"
@@ -61,6 +62,13 @@ Status getCanceledError() {
  * RAII type that wraps up an `eventfd` and reading/writing to it.
  * We don't use the counter portion and only use the file descriptor (i.e., `fd`) to notify and
  * interrupt the client thread blocked polling (see `BatonASIO::run`).
+ *
+ * Notifications are coalesced through a small state machine so that the `eventfd` is only written
+ * when a poller is blocked (or about to block) in `::poll` and has not been notified yet. All
+ * other notifications just flip the state and cost no syscall, and the poller skips blocking when
+ * a notification arrived since its last wakeup. On connection-heavy nodes most notifications
+ * arrive while the baton thread is busy processing, so this collapses the
+ * `eventfd_write`/`eventfd_read` syscall pair per scheduling into a plain atomic store.
  */
 struct EventFDHolder {
     EventFDHolder(const EventFDHolder&) = delete;
@@ -87,14 +95,27 @@ struct EventFDHolder {
     }
 
     void notify() {
-        while (::eventfd_write(fd, 1) != 0) {
-            const auto savedErrno = errno;
-            if (savedErrno == EINTR)
-                continue;
-            LOGV2_FATAL(6328202, "eventfd write failed", "fd"_attr = fd, "errno"_attr = savedErrno);
+        // Only the notification that finds a poller in `::poll` has to pay for the wakeup; any
+        // state already being `kNotified` means a wakeup is on its way or the next `beforePoll()`
+        // will return without blocking.
+        if (_state.swap(kNotified) == kInPoll) {
+            _write();
         }
     }
 
+    /**
+     * Called before blocking in `::poll`. Returns false if a notification arrived since the last
+     * `afterPoll()`, in which case the caller must not block.
+     */
+    bool beforePoll() {
+        auto expected = kNone;
+        return _state.compareAndSwap(&expected, kInPoll);
+    }
+
+    void afterPoll() {
+        _state.swap(kNone);
+    }
+
     void wait() {
         // If we have activity on the `eventfd`, pull the count out.
         ::eventfd_t u;
@@ -107,6 +128,20 @@ struct EventFDHolder {
     }
 
     const int fd;
+
+private:
+    void _write() {
+        while (::eventfd_write(fd, 1) != 0) {
+            const auto savedErrno = errno;
+            if (savedErrno == EINTR)
+                continue;
+            LOGV2_FATAL(6328202, "eventfd write failed", "fd"_attr = fd, "errno"_attr = savedErrno);
+        }
+    }
+
+    // kNone means nobody is polling and nobody has notified since the last wakeup.
+    enum State : int { kNone = 0, kNotified, kInPoll };
+    AtomicWord<int> _state{kNone};
 };
 
 const auto getEventFDForClient = Client::declareDecoration<EventFDHolder>();
@@ -348,8 +383,14 @@ std::list<Promise<void>> TransportLayerASIO::BatonASIO::_poll(stdx::unique_lock<
 
         blockBatonASIOBeforePoll.pauseWhileSet();
         int timeout = deadline ? Milliseconds(*deadline - now).count() : -1;
+        if (!efd(_opCtx).beforePoll()) {
+            // A notification arrived since our last wakeup; collect any ready events without
+            // blocking.
+            timeout = 0;
+        }
         int events = ::poll(_pollSet.data(), _pollSet.size(), timeout);
         const auto savedErrno = errno;
+        efd(_opCtx).afterPoll();
         if (events < 0 && savedErrno != EINTR) {
             LOGV2_FATAL(50834, "error in poll", "error"_attr = errnoWithDescription(savedErrno));
         }
@@ -74,6 +74,13 @@ struct CompressionHeader {
 
 const transport::Session::Decoration<MessageCompressorManager> getForSession =
     transport::Session::declareDecoration<MessageCompressorManager>();
+
+// Very small messages (replica set heartbeats, acks) gain almost nothing from compression: the
+// few bytes saved cannot amortize the OP_COMPRESSED header or the CPU spent running the codec,
+// and across tens of thousands of intra-cluster connections that CPU adds up. Messages below this
+// size are passed through uncompressed; peers accept uncompressed messages regardless of what was
+// negotiated.
+constexpr std::size_t kMinMessageSizeToCompress = 256;
 }  // namespace
 
 MessageCompressorManager::MessageCompressorManager()
@@ -95,6 +102,10 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    if (static_cast<std::size_t>(msg.dataSize()) < kMinMessageSizeToCompress) {
+        return {msg};
+    }
+
     LOGV2_DEBUG(22925,
                 3,
                 "Compressing message with {compressor}",
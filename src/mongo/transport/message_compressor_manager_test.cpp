@@ -43,6 +43,7 @@
 #include "mongo/transport/message_compressor_snappy.h"
 #include "mongo/transport/message_compressor_zlib.h"
 #include "mongo/transport/message_compressor_zstd.h"
+#include "mongo/transport/message_compressor_zstd_dict.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -169,7 +170,11 @@ void checkOverflow(std::unique_ptr<MessageCompressorBase> compressor) {
 }
 
 Message buildMessage() {
-    const auto data = std::string{"Hello, world!"};
+    // Large enough that the manager will not take the small-message passthrough.
+    std::string data;
+    while (data.size() < 1024) {
+        data += "Hello, world!";
+    }
     const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
     auto buf = SharedBuffer::allocate(bufferSize);
     MsgData::View testView(buf.get());
@@ -241,6 +246,34 @@ TEST(MessageCompressorManager, FullNormalCompression) {
     clientManager.clientFinish(serverObj);
 }
 
+TEST(MessageCompressorManager, SmallMessagesArePassedThrough) {
+    MessageCompressorRegistry registry;
+    registry.setSupportedCompressors({"snappy"});
+    registry.registerImplementation(std::make_unique<SnappyMessageCompressor>());
+    registry.finalizeSupportedCompressors().transitional_ignore();
+
+    MessageCompressorManager mgr(&registry);
+    BSONObjBuilder negotiatorOut;
+    std::vector<StringData> negotiator({"snappy"_sd});
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+
+    // A message well below the passthrough threshold should come back untouched even though a
+    // compressor was negotiated.
+    const auto data = std::string{"Hello, world!"};
+    const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
+    auto buf = SharedBuffer::allocate(bufferSize);
+    MsgData::View testView(buf.get());
+    testView.setId(123456);
+    testView.setResponseToMsgId(654321);
+    testView.setOperation(dbQuery);
+    testView.setLen(bufferSize);
+    memcpy(testView.data(), data.data(), data.size());
+
+    auto swm = mgr.compressMessage(Message{buf});
+    ASSERT_OK(swm.getStatus());
+    ASSERT_EQ(swm.getValue().operation(), dbQuery);
+}
+
 TEST(NoopMessageCompressor, Fidelity) {
     auto testMessage = buildMessage();
     checkFidelity(testMessage, std::make_unique<NoopMessageCompressor>());
@@ -261,6 +294,67 @@ TEST(ZstdMessageCompressor, Fidelity) {
     checkFidelity(testMessage, std::make_unique<ZstdMessageCompressor>());
 }
 
+TEST(ZstdMessageCompressor, LargeMessageFidelity) {
+    // Build a message large enough to take the wide-window long distance matching path, made of
+    // a repeated document-like pattern the way a big command reply batch would be.
+    const auto pattern = std::string{"{_id: ObjectId, chunkData: BinData, metadata: {n: 1}}"};
+    std::string data;
+    while (data.size() <= (4 << 20)) {
+        data += pattern;
+    }
+    const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
+    auto buf = SharedBuffer::allocate(bufferSize);
+    MsgData::View testView(buf.get());
+    testView.setId(123456);
+    testView.setResponseToMsgId(654321);
+    testView.setOperation(dbQuery);
+    testView.setLen(bufferSize);
+    memcpy(testView.data(), data.data(), data.size());
+
+    checkFidelity(Message{buf}, std::make_unique<ZstdMessageCompressor>());
+}
+
+TEST(ZstdDictMessageCompressor, Fidelity) {
+    auto testMessage = buildMessage();
+    checkFidelity(testMessage, std::make_unique<ZstdDictMessageCompressor>());
+}
+
+TEST(ZstdDictMessageCompressor, DictionaryHelpsFieldNameHeavyPayloads) {
+    // A payload made of first occurrences of common intra-cluster field names, the shape the
+    // built-in dictionary is targeted at. Plain zstd has nothing earlier in the message to match
+    // them against; the dictionary compressor should therefore do strictly better.
+    static constexpr char kPayload[] =
+        "ts\0t\0h\0v\0op\0ns\0ui\0o\0o2\0wall\0lsid\0uid\0txnNumber\0stmtId\0"
+        "prevOpTime\0fromMigrate\0$clusterTime\0clusterTime\0signature\0keyId\0"
+        "operationTime\0lastCommittedOpTime\0$replData\0$oplogQueryData";
+    const std::string data(kPayload, sizeof(kPayload) - 1);
+    ConstDataRange input(data.data(), data.size());
+
+    ZstdDictMessageCompressor dictCompressor;
+    ZstdMessageCompressor plainCompressor;
+
+    std::vector<char> dictBuffer(dictCompressor.getMaxCompressedSize(data.size()));
+    auto swDictSize =
+        dictCompressor.compressData(input, DataRange(dictBuffer.data(), dictBuffer.size()));
+    ASSERT_OK(swDictSize);
+
+    std::vector<char> plainBuffer(plainCompressor.getMaxCompressedSize(data.size()));
+    auto swPlainSize =
+        plainCompressor.compressData(input, DataRange(plainBuffer.data(), plainBuffer.size()));
+    ASSERT_OK(swPlainSize);
+
+    ASSERT_LT(swDictSize.getValue(), swPlainSize.getValue());
+
+    // And the dictionary frames must round-trip through the dictionary decompressor.
+    std::vector<char> scratch(data.size());
+    auto swDecompressedSize =
+        dictCompressor.decompressData(ConstDataRange(dictBuffer.data(), swDictSize.getValue()),
+                                      DataRange(scratch.data(), scratch.size()));
+    ASSERT_OK(swDecompressedSize);
+    ASSERT_EQ(swDecompressedSize.getValue(), data.size());
+    ASSERT_EQ(memcmp(scratch.data(), data.data(), data.size()), 0);
+}
+
 TEST(SnappyMessageCompressor, Overflow) {
     checkOverflow(std::make_unique<SnappyMessageCompressor>());
 }
@@ -57,6 +57,10 @@ StringData getMessageCompressorName(MessageCompressor id) {
             return "zlib"_sd;
         case MessageCompressor::kZstd:
             return "zstd"_sd;
+        case MessageCompressor::kZstdDict:
+            // The version suffix names the built-in field name dictionary; peers negotiate this
+            // compressor only when both sides carry the identical dictionary.
+            return "zstd-dict-v1"_sd;
         default:
             fassert(40269, "Invalid message compressor ID");
     }
@@ -38,6 +38,40 @@
 #include <zlib.h>
 
 namespace mongo {
+namespace {
+
+// The one-shot ::compress2()/::uncompress() entry points run deflateInit()/inflateInit() on
+// every call. Deflate's internal state alone is a few hundred kilobytes, so allocating and
+// initializing it per message costs more than actually deflating a small message does. Keep one
+// stream per thread per direction, initialized once and rewound between messages;
+// deflateReset()/inflateReset() reuse the existing allocations.
+z_stream* getThreadLocalDeflateStream() {
+    thread_local struct DeflateStream {
+        DeflateStream() : ok(deflateInit(&strm, Z_DEFAULT_COMPRESSION) == Z_OK) {}
+        ~DeflateStream() {
+            if (ok)
+                deflateEnd(&strm);
+        }
+        z_stream strm{};
+        bool ok;
+    } stream;
+    return stream.ok ? &stream.strm : nullptr;
+}
+
+z_stream* getThreadLocalInflateStream() {
+    thread_local struct InflateStream {
+        InflateStream() : ok(inflateInit(&strm) == Z_OK) {}
+        ~InflateStream() {
+            if (ok)
+                inflateEnd(&strm);
+        }
+        z_stream strm{};
+        bool ok;
+    } stream;
+    return stream.ok ? &stream.strm : nullptr;
+}
+
+}  // namespace
 
 ZlibMessageCompressor::ZlibMessageCompressor() : MessageCompressorBase(MessageCompressor::kZlib) {}
 
@@ -48,6 +82,23 @@ std::size_t ZlibMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 StatusWith<std::size_t> ZlibMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
     size_t outLength = output.length();
+
+    if (auto* strm = getThreadLocalDeflateStream()) {
+        strm->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input.data()));
+        strm->avail_in = input.length();
+        strm->next_out = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data()));
+        strm->avail_out = outLength;
+
+        int ret = ::deflate(strm, Z_FINISH);
+        outLength = strm->total_out;
+        if (::deflateReset(strm) == Z_OK && ret == Z_STREAM_END) {
+            counterHitCompress(input.length(), outLength);
+            return {outLength};
+        }
+        // Fall through to the one-shot path below if the reused stream failed for any reason.
+        outLength = output.length();
+    }
+
     int ret = ::compress2(const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data())),
                           reinterpret_cast<uLongf*>(&outLength),
                           reinterpret_cast<const Bytef*>(input.data()),
@@ -63,6 +114,22 @@ StatusWith<std::size_t> ZlibMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZlibMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
+    if (auto* strm = getThreadLocalInflateStream()) {
+        strm->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input.data()));
+        strm->avail_in = input.length();
+        strm->next_out = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data()));
+        strm->avail_out = output.length();
+
+        int ret = ::inflate(strm, Z_FINISH);
+        std::size_t outLength = strm->total_out;
+        if (::inflateReset(strm) != Z_OK || ret != Z_STREAM_END) {
+            return Status{ErrorCodes::BadValue, "Compressed message was invalid or corrupted"};
+        }
+
+        counterHitDecompress(input.length(), outLength);
+        return {outLength};
+    }
+
     uLongf length = output.length();
     int ret = ::uncompress(const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data())),
                            &length,
@@ -38,6 +38,45 @@
 #include "mongo/transport/message_compressor_zstd.h"
 
 namespace mongo {
+namespace {
+
+// The one-shot ZSTD_compress()/ZSTD_decompress() entry points allocate and tear down a full
+// (de)compression context on every call, which is a measurable fraction of the cost of
+// compressing small messages. Keep one context per thread and reuse it; zstd resets the
+// context state on each *_usingCCtx/DCtx call.
+ZSTD_CCtx* getThreadLocalCCtx() {
+    thread_local std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)> cctx(ZSTD_createCCtx(),
+                                                                              &ZSTD_freeCCtx);
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadLocalDCtx() {
+    thread_local std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)> dctx(ZSTD_createDCtx(),
+                                                                              &ZSTD_freeDCtx);
+    return dctx.get();
+}
+
+// At the default compression level zstd's match window covers only the last couple of megabytes
+// of input, so in a large command reply made up of identically shaped documents, matches against
+// the field names and values of documents earlier in the batch are lost once the batch outgrows
+// the window. For messages bigger than this threshold we widen the window to span the whole
+// message and enable long distance matching to keep searching the enlarged window cheap.
+constexpr std::size_t kLongDistanceMatchingMinSize = std::size_t{1} << 21;
+
+// Largest window a zstd decompressor accepts without explicitly opting in to larger windows
+// (ZSTD_WINDOWLOG_LIMIT_DEFAULT). Staying at or below this keeps our frames decodable by the
+// stock one-shot zstd decompressors that drivers and older servers use.
+constexpr int kMaxWindowLog = 27;
+
+int windowLogForInputSize(std::size_t inputSize) {
+    int windowLog = 10;  // ZSTD_WINDOWLOG_MIN
+    while ((std::size_t{1} << windowLog) < inputSize && windowLog < kMaxWindowLog) {
+        ++windowLog;
+    }
+    return windowLog;
+}
+
+}  // namespace
 
 ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
 
@@ -47,11 +86,35 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    size_t ret;
+    auto* cctx = getThreadLocalCCtx();
+    if (cctx && input.length() > kLongDistanceMatchingMinSize) {
+        ZSTD_CCtx_reset(cctx, ZSTD_reset_session_and_parameters);
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT);
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_enableLongDistanceMatching, 1);
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, windowLogForInputSize(input.length()));
+        ret = ZSTD_compress2(cctx,
+                             const_cast<char*>(output.data()),
+                             output.length(),
+                             input.data(),
+                             input.length());
+    } else if (cctx) {
+        // ZSTD_compressCCtx() compresses at the requested level, ignoring any advanced
+        // parameters left on the context by the long distance matching path above.
+        ret = ZSTD_compressCCtx(cctx,
+                                const_cast<char*>(output.data()),
+                                output.length(),
+                                input.data(),
+                                input.length(),
+                                ZSTD_CLEVEL_DEFAULT);
+    } else {
+        // Context allocation failed; fall back to the one-shot entry point.
+        ret = ZSTD_compress(const_cast<char*>(output.data()),
+                            output.length(),
+                            input.data(),
+                            input.length(),
+                            ZSTD_CLEVEL_DEFAULT);
+    }
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -63,8 +126,15 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    size_t ret;
+    if (auto* dctx = getThreadLocalDCtx()) {
+        ret = ZSTD_decompressDCtx(
+            dctx, const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    } else {
+        // Context allocation failed; fall back to the one-shot entry point.
+        ret = ZSTD_decompress(
+            const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    }
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -0,0 +1,217 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <memory>
+#include <string>
+
+#include <zstd.h>
+
+#include "mongo/base/init.h"
+#include "mongo/transport/message_compressor_registry.h"
+#include "mongo/transport/message_compressor_zstd_dict.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Field names that recur in nearly every intra-cluster message, stored as they appear on the
+ * wire in BSON: each name is followed by its NUL terminator so that matches cover the
+ * terminator too. The list is used as a raw-content zstd dictionary, i.e. as virtual content
+ * preceding every message; zstd weights content near the end of the dictionary most, so the
+ * names are ordered roughly by ascending expected frequency with oplog entry and replication
+ * metadata fields last.
+ *
+ * The contents are part of the negotiated protocol: any edit here must be accompanied by a
+ * version bump of the "zstd-dict-v1" compressor name, otherwise peers on different binaries
+ * would silently disagree about the dictionary.
+ */
+constexpr StringData kDictionaryV1FieldNames[] = {
+    // CRUD commands and their replies.
+    "find"_sd, "filter"_sd, "sort"_sd, "projection"_sd, "limit"_sd, "batchSize"_sd,
+    "singleBatch"_sd, "aggregate"_sd, "pipeline"_sd, "$match"_sd, "$group"_sd, "$project"_sd,
+    "$sort"_sd, "$limit"_sd, "insert"_sd, "documents"_sd, "update"_sd, "updates"_sd, "q"_sd,
+    "u"_sd, "multi"_sd, "upsert"_sd, "delete"_sd, "deletes"_sd, "getMore"_sd, "collection"_sd,
+
+    // Cursor replies.
+    "cursor"_sd, "id"_sd, "firstBatch"_sd, "nextBatch"_sd, "postBatchResumeToken"_sd,
+    "partialResultsReturned"_sd,
+
+    // Write results.
+    "n"_sd, "nModified"_sd, "upserted"_sd, "writeErrors"_sd, "index"_sd, "code"_sd,
+    "codeName"_sd, "errmsg"_sd, "writeConcernError"_sd,
+
+    // Command envelope, read/write concern, and routing metadata.
+    "$db"_sd, "maxTimeMS"_sd, "readConcern"_sd, "level"_sd, "afterClusterTime"_sd,
+    "writeConcern"_sd, "w"_sd, "wtimeout"_sd, "$readPreference"_sd, "mode"_sd, "shardVersion"_sd,
+    "databaseVersion"_sd, "$configServerState"_sd, "$audit"_sd, "$client"_sd, "ok"_sd,
+    "operationTime"_sd, "$clusterTime"_sd, "clusterTime"_sd, "signature"_sd, "hash"_sd,
+    "keyId"_sd,
+
+    // Replication protocol and heartbeats.
+    "replSetUpdatePosition"_sd, "optimes"_sd, "appliedOpTime"_sd, "appliedWallTime"_sd,
+    "durableOpTime"_sd, "durableWallTime"_sd, "memberId"_sd, "configVersion"_sd, "configTerm"_sd,
+    "term"_sd, "lastCommittedOpTime"_sd, "$replData"_sd, "$oplogQueryData"_sd,
+    "lastOpCommitted"_sd, "lastCommittedWall"_sd, "lastOpApplied"_sd, "rbid"_sd,
+    "primaryIndex"_sd, "syncSourceIndex"_sd,
+
+    // Logical sessions and transactions.
+    "lsid"_sd, "uid"_sd, "txnNumber"_sd, "stmtId"_sd, "autocommit"_sd, "startTransaction"_sd,
+    "prevOpTime"_sd, "preImageOpTime"_sd, "postImageOpTime"_sd,
+
+    // Oplog entries, the single most repetitive document shape shipped between nodes.
+    "fromMigrate"_sd, "wall"_sd, "ui"_sd, "o2"_sd, "o"_sd, "op"_sd, "ns"_sd, "v"_sd, "t"_sd,
+    "ts"_sd, "_id"_sd,
+};
+
+const std::string& fieldNameDictionary() {
+    static const std::string dictionary = [] {
+        std::string dict;
+        for (auto name : kDictionaryV1FieldNames) {
+            dict.append(name.rawData(), name.size());
+            dict.push_back('\0');
+        }
+        return dict;
+    }();
+    return dictionary;
+}
+
+// The digested dictionaries are built once and shared by all threads for the life of the
+// process; ZSTD_compress_usingCDict()/ZSTD_decompress_usingDDict() use them read-only.
+ZSTD_CDict* getSharedCDict() {
+    static ZSTD_CDict* cdict = [] {
+        const auto& dict = fieldNameDictionary();
+        return ZSTD_createCDict(dict.data(), dict.size(), ZSTD_CLEVEL_DEFAULT);
+    }();
+    return cdict;
+}
+
+ZSTD_DDict* getSharedDDict() {
+    static ZSTD_DDict* ddict = [] {
+        const auto& dict = fieldNameDictionary();
+        return ZSTD_createDDict(dict.data(), dict.size());
+    }();
+    return ddict;
+}
+
+// Like the plain zstd compressor, keep one (de)compression context per thread rather than
+// paying for context setup on every message.
+ZSTD_CCtx* getThreadLocalCCtx() {
+    thread_local std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)> cctx(ZSTD_createCCtx(),
+                                                                              &ZSTD_freeCCtx);
+    return cctx.get();
+}
+
+ZSTD_DCtx* getThreadLocalDCtx() {
+    thread_local std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)> dctx(ZSTD_createDCtx(),
+                                                                              &ZSTD_freeDCtx);
+    return dctx.get();
+}
+
+}  // namespace
+
+ZstdDictMessageCompressor::ZstdDictMessageCompressor()
+    : MessageCompressorBase(MessageCompressor::kZstdDict) {}
+
+std::size_t ZstdDictMessageCompressor::getMaxCompressedSize(size_t inputSize) {
+    return ZSTD_compressBound(inputSize);
+}
+
+StatusWith<std::size_t> ZstdDictMessageCompressor::compressData(ConstDataRange input,
+                                                                DataRange output) {
+    size_t ret;
+    auto* cctx = getThreadLocalCCtx();
+    auto* cdict = getSharedCDict();
+    if (cctx && cdict) {
+        ret = ZSTD_compress_usingCDict(cctx,
+                                       const_cast<char*>(output.data()),
+                                       output.length(),
+                                       input.data(),
+                                       input.length(),
+                                       cdict);
+    } else if (cctx) {
+        // Dictionary construction failed; fall back to plain compression. A raw-content
+        // dictionary is just virtual content preceding the frame, so frames produced without
+        // it still decompress correctly on a peer that applies the dictionary.
+        ret = ZSTD_compressCCtx(cctx,
+                                const_cast<char*>(output.data()),
+                                output.length(),
+                                input.data(),
+                                input.length(),
+                                ZSTD_CLEVEL_DEFAULT);
+    } else {
+        // Context allocation failed; fall back to the one-shot entry point.
+        ret = ZSTD_compress(const_cast<char*>(output.data()),
+                            output.length(),
+                            input.data(),
+                            input.length(),
+                            ZSTD_CLEVEL_DEFAULT);
+    }
+
+    if (ZSTD_isError(ret)) {
+        return Status{ErrorCodes::BadValue,
+                      str::stream() << "Could not compress input: " << ZSTD_getErrorName(ret)};
+    }
+    counterHitCompress(input.length(), ret);
+    return {ret};
+}
+
+StatusWith<std::size_t> ZstdDictMessageCompressor::decompressData(ConstDataRange input,
+                                                                  DataRange output) {
+    auto* dctx = getThreadLocalDCtx();
+    auto* ddict = getSharedDDict();
+    if (!dctx || !ddict) {
+        return Status{ErrorCodes::BadValue,
+                      "Could not allocate zstd dictionary decompression state"};
+    }
+
+    size_t ret = ZSTD_decompress_usingDDict(dctx,
+                                            const_cast<char*>(output.data()),
+                                            output.length(),
+                                            input.data(),
+                                            input.length(),
+                                            ddict);
+    if (ZSTD_isError(ret)) {
+        return Status{ErrorCodes::BadValue,
+                      str::stream() << "Could not decompress message: " << ZSTD_getErrorName(ret)};
+    }
+
+    counterHitDecompress(input.length(), ret);
+    return {ret};
+}
+
+MONGO_INITIALIZER_GENERAL(ZstdDictMessageCompressorInit,
+                          ("EndStartupOptionHandling"),
+                          ("AllCompressorsRegistered"))
+(InitializerContext* context) {
+    auto& compressorRegistry = MessageCompressorRegistry::get();
+    compressorRegistry.registerImplementation(std::make_unique<ZstdDictMessageCompressor>());
+}
+}  // namespace mongo
@@ -0,0 +1,62 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/transport/message_compressor_base.h"
+
+namespace mongo {
+
+/**
+ * A zstd compressor primed with a built-in dictionary of the field names that dominate
+ * intra-cluster traffic (oplog entries, command envelopes, replication metadata). The dictionary
+ * lets small messages compress references to those names even though they have no earlier
+ * occurrence inside the message itself.
+ *
+ * The dictionary is baked into the binary and versioned through the negotiated compressor name
+ * ("zstd-dict-v1"); two peers use this compressor only when both advertise the identical name,
+ * so a frame is never decompressed against a different dictionary than it was compressed with.
+ * Any change to the dictionary contents must therefore bump the version suffix in the name.
+ *
+ * Because only peers running a binary with this compressor ever advertise the name, enabling it
+ * via networkMessageCompressors is safe in mixed clusters: drivers and older servers simply
+ * ignore the unknown name during negotiation and fall back to the other configured compressors.
+ */
+class ZstdDictMessageCompressor final : public MessageCompressorBase {
+public:
+    ZstdDictMessageCompressor();
+
+    std::size_t getMaxCompressedSize(size_t inputSize) override;
+
+    StatusWith<std::size_t> compressData(ConstDataRange input, DataRange output) override;
+
+    StatusWith<std::size_t> decompressData(ConstDataRange input, DataRange output) override;
+};
+
+}  // namespace mongo
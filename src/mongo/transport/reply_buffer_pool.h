@@ -0,0 +1,71 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/transport/session.h"
+#include "mongo/util/shared_buffer.h"
+
+namespace mongo {
+namespace transport {
+
+/**
+ * Retains the buffer of the last reply sent over a Session so that the next reply on the same
+ * connection can be serialized into it, saving an allocate/free pair (and the attendant page
+ * faults) per operation. The retained buffer naturally grows to the connection's reply-size
+ * high-water mark, and is periodically dropped so that one outsized reply does not pin its
+ * allocation for the life of the connection.
+ *
+ * A session's replies are serialized and sunk one at a time, so no synchronization is needed.
+ */
+class ReplyBufferPool {
+public:
+    static ReplyBufferPool& forSession(const SessionHandle& session);
+
+    /**
+     * Removes and returns the retained buffer. The result may be null if nothing has been
+     * recycled yet (or the pool has recently decayed), in which case the caller should fall
+     * back to a fresh allocation.
+     */
+    SharedBuffer acquire();
+
+    /**
+     * Offers the buffer of a sent reply back to the pool. Buffers that are still referenced
+     * elsewhere are ignored, since a recycled buffer must be exclusively owned before it can be
+     * written into.
+     */
+    void recycle(SharedBuffer buffer);
+
+private:
+    SharedBuffer _buffer;
+    size_t _repliesSinceDecay = 0;
+};
+
+}  // namespace transport
+}  // namespace mongo
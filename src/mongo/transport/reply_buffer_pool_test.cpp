@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2022-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/rpc/op_msg_rpc_impls.h"
+#include "mongo/transport/reply_buffer_pool.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace transport {
+namespace {
+
+TEST(ReplyBufferPool, StartsEmpty) {
+    ReplyBufferPool pool;
+    ASSERT_FALSE(pool.acquire());
+}
+
+TEST(ReplyBufferPool, RecycledBufferIsReturnedByAcquire) {
+    ReplyBufferPool pool;
+    auto buffer = SharedBuffer::allocate(1024);
+    auto* bufferPtr = buffer.get();
+    pool.recycle(std::move(buffer));
+
+    auto acquired = pool.acquire();
+    ASSERT_TRUE(acquired);
+    ASSERT_EQ(acquired.get(), bufferPtr);
+
+    // The pool only retains one buffer at a time.
+    ASSERT_FALSE(pool.acquire());
+}
+
+TEST(ReplyBufferPool, SharedBuffersAreNotRetained) {
+    ReplyBufferPool pool;
+    auto buffer = SharedBuffer::allocate(1024);
+    auto extraRef = buffer;
+    pool.recycle(std::move(buffer));
+    ASSERT_FALSE(pool.acquire());
+}
+
+TEST(ReplyBufferPool, KeepsLargestBuffer) {
+    ReplyBufferPool pool;
+    auto large = SharedBuffer::allocate(4096);
+    auto* largePtr = large.get();
+    pool.recycle(std::move(large));
+    pool.recycle(SharedBuffer::allocate(512));
+
+    auto acquired = pool.acquire();
+    ASSERT_TRUE(acquired);
+    ASSERT_EQ(acquired.get(), largePtr);
+}
+
+TEST(ReplyBufferPool, PeriodicallyDecays) {
+    ReplyBufferPool pool;
+
+    // The pool drops its retained buffer every 256 replies so that one outsized reply does not
+    // pin its allocation forever. Cycle well past that and verify an empty pool is observed.
+    bool sawEmptyPool = false;
+    for (int i = 0; i < 300; ++i) {
+        pool.recycle(SharedBuffer::allocate(1024));
+        auto acquired = pool.acquire();
+        if (!acquired) {
+            sawEmptyPool = true;
+        } else {
+            pool.recycle(std::move(acquired));
+        }
+    }
+    ASSERT_TRUE(sawEmptyPool);
+}
+
+TEST(ReplyBufferPool, OpMsgReplyBuilderSerializesIntoRecycledBuffer) {
+    auto buffer = SharedBuffer::allocate(64 * 1024);
+    auto* bufferPtr = buffer.get();
+
+    rpc::OpMsgReplyBuilder builder(std::move(buffer));
+    builder.setRawCommandReply(BSON("ok" << 1));
+    auto message = builder.done();
+
+    // The reply is small enough that no reallocation was necessary, so the message occupies the
+    // donated buffer.
+    ASSERT_EQ(message.buf(), bufferPtr);
+    ASSERT_BSONOBJ_EQ(OpMsg::parse(message).body, BSON("ok" << 1));
+}
+
+}  // namespace
+}  // namespace transport
+}  // namespace mongo
@@ -37,6 +37,7 @@
 
 #include "mongo/logv2/log.h"
 #include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/service_executor_fixed.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/service_executor_synchronous.h"
@@ -223,9 +224,70 @@ void ServiceExecutorContext::setCanUseReserved(bool canUseReserved) noexcept {
     }
 }
 
+void ServiceExecutorContext::setPrioritized(bool prioritized) noexcept {
+    _prioritized = prioritized;
+    if (prioritized) {
+        // Prioritized traffic must not queue behind regular user operations, so it always runs on
+        // a dedicated thread and may dip into the reserved executor when the server is saturated.
+        setThreadingModel(ThreadingModel::kDedicated);
+        setCanUseReserved(true);
+    }
+}
+
+void ServiceExecutorContext::maybeAdjustThreadingModel() noexcept {
+    // Prioritized clients are pinned to a dedicated thread; demoting them to the shared fixed
+    // executor would put heartbeat traffic back behind expensive user operations.
+    if (_prioritized) {
+        return;
+    }
+
+    const auto hotOpsPerSec = adaptiveServiceExecutorHotConnectionOpsPerSec.load();
+    if (hotOpsPerSec <= 0 ||
+        ServiceExecutor::getInitialThreadingModel() != ThreadingModel::kBorrowed) {
+        return;
+    }
+
+    const auto now = _client->getServiceContext()->getFastClockSource()->now();
+    const auto sinceLastOp = now - _adaptiveLastOp;
+    _adaptiveLastOp = now;
+
+    if (_adaptiveWindowStart == Date_t{} ||
+        sinceLastOp >= Milliseconds(adaptiveServiceExecutorIdleDemotionMillis.load())) {
+        // The connection went idle (or is brand new). Start a fresh window and make sure the
+        // upcoming idle waits are multiplexed on the fixed executor rather than parking a
+        // dedicated thread.
+        _adaptiveWindowStart = now;
+        _adaptiveOpsInWindow = 0;
+        if (_threadingModel == ThreadingModel::kDedicated) {
+            LOGV2_DEBUG(6650005,
+                        kDiagnosticLogLevel,
+                        "Demoting idle client to the borrowed executor",
+                        "client"_attr = _client->desc());
+            setThreadingModel(ThreadingModel::kBorrowed);
+        }
+        return;
+    }
+
+    if (now - _adaptiveWindowStart >= Seconds(1)) {
+        _adaptiveWindowStart = now;
+        _adaptiveOpsInWindow = 0;
+    }
+
+    if (++_adaptiveOpsInWindow >= hotOpsPerSec && _threadingModel == ThreadingModel::kBorrowed) {
+        LOGV2_DEBUG(6650006,
+                    kDiagnosticLogLevel,
+                    "Promoting hot client to a dedicated thread",
+                    "client"_attr = _client->desc(),
+                    "opsInWindow"_attr = _adaptiveOpsInWindow);
+        setThreadingModel(ThreadingModel::kDedicated);
+    }
+}
+
 ServiceExecutor* ServiceExecutorContext::getServiceExecutor() noexcept {
     invariant(_client);
 
+    maybeAdjustThreadingModel();
+
     switch (_threadingModel) {
         case ThreadingModel::kBorrowed:
             return ServiceExecutorFixed::get(_client->getServiceContext());
@@ -245,7 +307,10 @@ ServiceExecutor* ServiceExecutorContext::getServiceExecutor() noexcept {
         return _sep->numOpenSessions() > _sep->maxOpenSessions();
     };
 
-    if (_canUseReserved && !_hasUsedSynchronous && shouldUseReserved()) {
+    // Prioritized clients may return to the reserved executor even after using the synchronous
+    // executor; their long-lived connections are typically established well before the server
+    // saturates, and they must still make progress once it does.
+    if (_canUseReserved && (_prioritized || !_hasUsedSynchronous) && shouldUseReserved()) {
         if (auto exec = transport::ServiceExecutorReserved::get(_client->getServiceContext())) {
             // We are allowed to use the reserved, we have not used the synchronous, we should use
             // the reserved, and the reserved exists.
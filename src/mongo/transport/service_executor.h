@@ -41,6 +41,7 @@
 #include "mongo/util/duration.h"
 #include "mongo/util/functional.h"
 #include "mongo/util/out_of_line_executor.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace transport {
@@ -173,12 +174,20 @@ public:
         : _client{std::exchange(seCtx._client, nullptr)},
           _sep{std::exchange(seCtx._sep, nullptr)},
           _threadingModel{seCtx._threadingModel},
-          _canUseReserved{seCtx._canUseReserved} {}
+          _canUseReserved{seCtx._canUseReserved},
+          _prioritized{seCtx._prioritized},
+          _adaptiveWindowStart{seCtx._adaptiveWindowStart},
+          _adaptiveOpsInWindow{seCtx._adaptiveOpsInWindow},
+          _adaptiveLastOp{seCtx._adaptiveLastOp} {}
     ServiceExecutorContext& operator=(ServiceExecutorContext&& seCtx) {
         _client = std::exchange(seCtx._client, nullptr);
         _sep = std::exchange(seCtx._sep, nullptr);
         _threadingModel = seCtx._threadingModel;
         _canUseReserved = seCtx._canUseReserved;
+        _prioritized = seCtx._prioritized;
+        _adaptiveWindowStart = seCtx._adaptiveWindowStart;
+        _adaptiveOpsInWindow = seCtx._adaptiveOpsInWindow;
+        _adaptiveLastOp = seCtx._adaptiveLastOp;
         return *this;
     }
 
@@ -196,6 +205,16 @@ public:
      */
     void setCanUseReserved(bool canUseReserved) noexcept;
 
+    /**
+     * Mark the associated Client as carrying prioritized traffic, e.g. intra-cluster heartbeats
+     * and replication. Prioritized Clients always run on a dedicated thread and may fall back to
+     * the reserved executor under overload, so their operations never queue behind regular user
+     * operations in the fixed executor.
+     *
+     * This function is only valid to invoke with the Client lock or on the Client thread.
+     */
+    void setPrioritized(bool prioritized) noexcept;
+
     /**
      * Get the ThreadingModel for the associated Client.
      *
@@ -214,12 +233,31 @@ public:
     ServiceExecutor* getServiceExecutor() noexcept;
 
 private:
+    /**
+     * Promote or demote the ThreadingModel based on the rate of operations this Client has been
+     * scheduling. When adaptive promotion is enabled (see the
+     * adaptiveServiceExecutorHotConnectionOpsPerSec server parameter), Clients that exceed the
+     * configured operation rate are moved onto a dedicated thread, and are handed back to the
+     * borrowed (fixed) executor at the first operation after an idle period, so their idle waits
+     * happen on the reactor instead of parking a thread and its stack.
+     *
+     * This function is only valid to invoke from the associated Client thread.
+     */
+    void maybeAdjustThreadingModel() noexcept;
+
     Client* _client = nullptr;
     ServiceEntryPoint* _sep = nullptr;
 
     ThreadingModel _threadingModel = ThreadingModel::kDedicated;
     bool _canUseReserved = false;
+    bool _prioritized = false;
     bool _hasUsedSynchronous = false;
+
+    // State for adaptive threading model adjustment. Tracks the operations scheduled within the
+    // current one second window and the time of the last scheduled operation.
+    Date_t _adaptiveWindowStart;
+    int _adaptiveOpsInWindow = 0;
+    Date_t _adaptiveLastOp;
 };
 
 /**
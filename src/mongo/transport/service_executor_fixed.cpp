@@ -31,12 +31,21 @@
 
 #include "mongo/transport/service_executor_fixed.h"
 
+#ifdef __linux__
+#include <sched.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+#endif
+
 #include "mongo/base/error_codes.h"
 #include "mongo/logv2/log.h"
 #include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/errno_util.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/testing_proctor.h"
 #include "mongo/util/thread_safety_context.h"
@@ -52,6 +61,83 @@ Status inShutdownStatus() {
     return Status(ErrorCodes::ServiceExecutorInShutdown, "ServiceExecutorFixed is not running");
 }
 
+#ifdef __linux__
+/**
+ * Returns one CPU affinity mask per NUMA node, read from sysfs. Returns an empty vector when the
+ * machine has a single node or the topology cannot be determined.
+ */
+std::vector<cpu_set_t> loadNumaNodeCpuMasks() {
+    std::vector<cpu_set_t> masks;
+    for (size_t node = 0;; ++node) {
+        std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(node) +
+                                  "/cpulist");
+        if (!cpuListFile)
+            break;
+
+        std::string cpuList;
+        std::getline(cpuListFile, cpuList);
+
+        // The cpulist format is a comma-separated sequence of CPU numbers and ranges, e.g.
+        // "0-31,64-95".
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        const char* p = cpuList.c_str();
+        while (*p) {
+            char* end;
+            const long first = strtol(p, &end, 10);
+            long last = first;
+            if (end == p)
+                return {};
+            p = end;
+            if (*p == '-') {
+                last = strtol(p + 1, &end, 10);
+                if (end == p + 1)
+                    return {};
+                p = end;
+            }
+            if (first < 0 || last < first || last >= CPU_SETSIZE)
+                return {};
+            for (long cpu = first; cpu <= last; ++cpu)
+                CPU_SET(cpu, &mask);
+            if (*p == ',')
+                ++p;
+            else if (*p)
+                return {};
+        }
+        if (!CPU_COUNT(&mask))
+            return {};
+        masks.push_back(mask);
+    }
+
+    if (masks.size() < 2)
+        return {};
+    return masks;
+}
+
+/**
+ * Pins the calling thread to the next NUMA node in round-robin order, so that the executor's
+ * threads spread evenly over the nodes and their allocations stay node-local under first-touch
+ * placement. A no-op on machines without multiple NUMA nodes.
+ */
+void pinThreadToNumaNode() {
+    static const std::vector<cpu_set_t> masks = loadNumaNodeCpuMasks();
+    if (masks.empty())
+        return;
+
+    static AtomicWord<size_t> nextThread{0};
+    const size_t node = nextThread.fetchAndAdd(1) % masks.size();
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &masks[node]) != 0) {
+        auto savedErrno = errno;
+        LOGV2_WARNING(6650018,
+                      "Failed to pin service executor thread to NUMA node",
+                      "node"_attr = node,
+                      "error"_attr = errnoWithDescription(savedErrno));
+        return;
+    }
+    LOGV2_DEBUG(6650019, 3, "Pinned service executor thread to NUMA node", "node"_attr = node);
+}
+#endif  // __linux__
+
 class Handle {
 public:
     explicit Handle(std::shared_ptr<ServiceExecutorFixed> ptr) : _ptr{std::move(ptr)} {}
@@ -185,6 +271,10 @@ ServiceExecutorFixed::ServiceExecutorFixed(ServiceContext* ctx, ThreadPool::Limi
           ThreadPool::Options opt(std::move(limits));
           opt.poolName = "ServiceExecutorFixed";
           opt.onCreateThread = [this](const auto&) {
+#ifdef __linux__
+              if (fixedServiceExecutorNumaPinning)
+                  pinThreadToNumaNode();
+#endif
               _executorContext = std::make_unique<ExecutorThreadContext>(this);
           };
           return opt;
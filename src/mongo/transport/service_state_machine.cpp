@@ -50,6 +50,7 @@
 #include "mongo/rpc/op_msg.h"
 #include "mongo/transport/message_compressor_base.h"
 #include "mongo/transport/message_compressor_manager.h"
+#include "mongo/transport/reply_buffer_pool.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer.h"
@@ -309,7 +310,8 @@ void ServiceStateMachine::Impl::sinkMessage() {
     //
     // Otherwise, update the current state depending on whether we're in exhaust or not and return
     // from this function to let startNewLoop() continue the future chaining of state transitions.
-    if (auto status = session()->sinkMessage(std::exchange(_outMessage, {})); !status.isOK()) {
+    Message sentMessage = std::exchange(_outMessage, {});
+    if (auto status = session()->sinkMessage(sentMessage); !status.isOK()) {
         LOGV2(22989,
               "Error sending response to client. Ending connection from remote",
               "error"_attr = status,
@@ -323,6 +325,13 @@ void ServiceStateMachine::Impl::sinkMessage() {
         _state.store(State::Source);
     }
 
+    // Now that the reply is on the wire, the session's copy of it has been destroyed and the
+    // buffer is typically exclusively ours again, so retain it for the next reply serialized on
+    // this connection.
+    auto sentBuffer = sentMessage.sharedBuffer();
+    sentMessage.reset();
+    ReplyBufferPool::forSession(session()).recycle(std::move(sentBuffer));
+
     // Performance testing showed a significant benefit from yielding here.
     // TODO SERVER-57531: Once we enable the use of a fixed-size thread pool
     // for handling client connection handshaking, we should only yield here if
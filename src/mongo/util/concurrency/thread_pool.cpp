@@ -160,10 +160,10 @@ private:
     void _drainPendingTasks();
 
     /**
-     * Executes one task from _pendingTasks. "lk" must own _mutex, and _pendingTasks must have at
-     * least one entry.
+     * Executes a batch of up to _options.maxTaskBatchSize tasks from _pendingTasks. "lk" must own
+     * _mutex, and _pendingTasks must have at least one entry.
      */
-    void _doOneTask(stdx::unique_lock<Latch>* lk) noexcept;
+    void _doTasks(stdx::unique_lock<Latch>* lk) noexcept;
 
     /**
      * Changes the lifecycle state (_state) of the pool and wakes up any threads waiting for a state
@@ -325,7 +325,7 @@ void ThreadPool::Impl::_drainPendingTasks() {
             _options.onCreateThread(threadName);
         stdx::unique_lock<Latch> lock(_mutex);
         while (!_pendingTasks.empty()) {
-            _doOneTask(&lock);
+            _doTasks(&lock);
         }
     });
     cleanThread.join();
@@ -413,7 +413,7 @@ void ThreadPool::Impl::_consumeTasks() {
     stdx::unique_lock<Latch> lk(_mutex);
     while (_state == running) {
         if (!_pendingTasks.empty()) {
-            _doOneTask(&lk);
+            _doTasks(&lk);
             continue;
         }
 
@@ -479,7 +479,7 @@ void ThreadPool::Impl::_consumeTasks() {
     if (_state == joinRequired || _state == joining) {
         // Drain the leftover pending tasks.
         while (!_pendingTasks.empty()) {
-            _doOneTask(&lk);
+            _doTasks(&lk);
         }
         --_numIdleThreads;
         return;
@@ -511,24 +511,41 @@ void ThreadPool::Impl::_consumeTasks() {
     _retiredThreads.splice(_retiredThreads.end(), _threads, pos);
 }
 
-void ThreadPool::Impl::_doOneTask(stdx::unique_lock<Latch>* lk) noexcept {
+void ThreadPool::Impl::_doTasks(stdx::unique_lock<Latch>* lk) noexcept {
     invariant(!_pendingTasks.empty());
     LOGV2_DEBUG(23109,
                 3,
                 "Executing a task on behalf of pool {poolName}",
                 "Executing a task on behalf of pool",
                 "poolName"_attr = _options.poolName);
-    Task task = std::move(_pendingTasks.front());
-    _pendingTasks.pop_front();
+
+    // Only claim more than one task when the queue holds more tasks than there are threads to
+    // run them, so that batching never delays a task behind this thread while an idle sibling
+    // could have picked it up.
+    size_t batchSize = 1;
+    if (_options.maxTaskBatchSize > 1 && !_threads.empty()) {
+        batchSize = std::min({_options.maxTaskBatchSize,
+                              std::max<size_t>(_pendingTasks.size() / _threads.size(), 1),
+                              _pendingTasks.size()});
+    }
+
+    std::vector<Task> tasks;
+    tasks.reserve(batchSize);
+    for (size_t i = 0; i < batchSize; ++i) {
+        tasks.emplace_back(std::move(_pendingTasks.front()));
+        _pendingTasks.pop_front();
+    }
     --_numIdleThreads;
 
     lk->unlock();
-    // Run the task outside of the lock. Note that if the task throws, the task destructor will run
+    // Run the tasks outside of the lock. Note that if a task throws, its destructor will run
     // outside of the lock before the exception hits the noexcept boundary.
-    task(Status::OK());
+    for (auto& task : tasks) {
+        task(Status::OK());
 
-    // Reset the task and run the dtor before we reacquire the lock.
-    task = {};
+        // Reset the task and run the dtor before we reacquire the lock.
+        task = {};
+    }
     lk->lock();
 
     ++_numIdleThreads;
@@ -308,6 +308,30 @@ TEST(ThreadPoolTest, JoinAllRetiredThreads) {
     ASSERT_EQ(pool.getStats().numIdleThreads, 0);
 }
 
+TEST(ThreadPoolTest, TaskBatchingRunsAllScheduledTasks) {
+    ThreadPool::Options options;
+    options.minThreads = 2;
+    options.maxThreads = 4;
+    options.maxTaskBatchSize = 8;
+    ThreadPool pool(options);
+
+    // Schedule the tasks before startup so the queue is deep when the workers begin consuming
+    // tasks and batch claiming takes effect.
+    const size_t numTasks = 1000;
+    AtomicWord<size_t> tasksRun{0};
+    for (size_t i = 0; i < numTasks; ++i) {
+        pool.schedule([&](Status status) {
+            ASSERT_OK(status);
+            tasksRun.fetchAndAdd(1);
+        });
+    }
+    pool.startup();
+    pool.waitForIdle();
+    ASSERT_EQ(tasksRun.load(), numTasks);
+    pool.shutdown();
+    pool.join();
+}
+
 TEST(ThreadPoolTest, SafeToCallWaitForIdleBeforeShutdown) {
     ThreadPool::Options options;
     options.minThreads = 1;
@@ -378,6 +378,84 @@ bool FifoTicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until)
     }
 }
 
+LockFreeTicketHolder::LockFreeTicketHolder(int num)
+    : _ticketsAvailable(num), _capacity(num), _waiterCount(0) {}
+
+LockFreeTicketHolder::~LockFreeTicketHolder() = default;
+
+int LockFreeTicketHolder::available() const {
+    return _ticketsAvailable.load();
+}
+int LockFreeTicketHolder::used() const {
+    return outof() - available();
+}
+int LockFreeTicketHolder::outof() const {
+    return _capacity.load();
+}
+
+bool LockFreeTicketHolder::tryAcquire() {
+    auto available = _ticketsAvailable.load();
+    while (available > 0) {
+        if (_ticketsAvailable.compareAndSwap(&available, available - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LockFreeTicketHolder::release() {
+    _ticketsAvailable.fetchAndAdd(1);
+    if (MONGO_unlikely(_waiterCount.load() > 0)) {
+        // Taking the parking mutex closes the race with a waiter that has observed no tickets but
+        // has not parked on the condition variable yet; without it the wakeup could be lost.
+        stdx::lock_guard<Latch> lk(_parkingMutex);
+        _newTicket.notify_one();
+    }
+}
+
+void LockFreeTicketHolder::waitForTicket(OperationContext* opCtx) {
+    waitForTicketUntil(opCtx, Date_t::max());
+}
+
+bool LockFreeTicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
+    // Attempt a quick acquisition first.
+    if (tryAcquire()) {
+        return true;
+    }
+
+    stdx::unique_lock<Latch> lk(_parkingMutex);
+    _waiterCount.fetchAndAdd(1);
+    ScopeGuard unregisterWaiter([&] { _waiterCount.subtractAndFetch(1); });
+
+    // The registration above is ordered before the re-check of the available count inside the
+    // predicate, matching the reverse order in release(), so either the releaser sees our
+    // registration or we see its ticket.
+    auto pred = [this] { return tryAcquire(); };
+    auto interruptible = opCtx ? opCtx : Interruptible::notInterruptible();
+    return interruptible->waitForConditionOrInterruptUntil(_newTicket, lk, until, pred);
+}
+
+Status LockFreeTicketHolder::resize(int newSize) {
+    stdx::lock_guard<Latch> lk(_resizeMutex);
+
+    if (newSize < 5)
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Minimum value for ticket holder is 5; given " << newSize);
+
+    while (_capacity.load() < newSize) {
+        release();
+        _capacity.fetchAndAdd(1);
+    }
+
+    while (_capacity.load() > newSize) {
+        this->TicketHolder::waitForTicket();
+        _capacity.subtractAndFetch(1);
+    }
+
+    invariant(_capacity.load() == newSize);
+    return Status::OK();
+}
+
 Status FifoTicketHolder::resize(int newSize) {
     stdx::lock_guard<Latch> lk(_resizeMutex);
 
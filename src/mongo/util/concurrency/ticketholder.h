@@ -175,6 +175,49 @@ private:
     AtomicWord<int> _ticketsAvailable;
 };
 
+/**
+ * A ticketholder implementation whose uncontended fast path is lock-free: acquiring is a single
+ * compare-and-swap on the available count and releasing is a single fetch-and-add. Threads that
+ * find no tickets park on a condition variable, which releasers only signal when someone is
+ * actually waiting, so the futex traffic of the mutex/condvar implementations disappears from
+ * the uncontended path. Unlike FifoTicketHolder there is no fairness guarantee between waiters.
+ */
+class LockFreeTicketHolder final : public TicketHolder {
+public:
+    explicit LockFreeTicketHolder(int num);
+    ~LockFreeTicketHolder() override final;
+
+    bool tryAcquire() override final;
+
+    void waitForTicket(OperationContext* opCtx) override final;
+
+    bool waitForTicketUntil(OperationContext* opCtx, Date_t until) override final;
+
+    void release() override final;
+
+    Status resize(int newSize) override final;
+
+    int available() const override final;
+
+    int used() const override final;
+
+    int outof() const override final;
+
+private:
+    AtomicWord<int> _ticketsAvailable;
+    AtomicWord<int> _capacity;
+
+    // Number of threads in the parked slow path. release() only touches '_parkingMutex' and the
+    // condition variable when this is non-zero.
+    AtomicWord<int> _waiterCount;
+
+    Mutex _resizeMutex =
+        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(1), "LockFreeTicketHolder::_resizeMutex");
+    Mutex _parkingMutex =
+        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "LockFreeTicketHolder::_parkingMutex");
+    stdx::condition_variable _newTicket;
+};
+
 class ScopedTicket {
 public:
     ScopedTicket(TicketHolder* holder) : _holder(holder) {
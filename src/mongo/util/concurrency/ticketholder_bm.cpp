@@ -67,6 +67,8 @@ BENCHMARK_TEMPLATE(BM_tryAcquire, SemaphoreTicketHolder)->ThreadRange(kThreadMin
 
 BENCHMARK_TEMPLATE(BM_tryAcquire, FifoTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
 
+BENCHMARK_TEMPLATE(BM_tryAcquire, LockFreeTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
+
 template <class TicketHolderImpl>
 void BM_acquire(benchmark::State& state) {
     static std::unique_ptr<TicketHolder> ticketHolder;
@@ -91,6 +93,8 @@ BENCHMARK_TEMPLATE(BM_acquire, SemaphoreTicketHolder)->ThreadRange(kThreadMin, k
 
 BENCHMARK_TEMPLATE(BM_acquire, FifoTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
 
+BENCHMARK_TEMPLATE(BM_acquire, LockFreeTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
+
 template <class TicketHolderImpl>
 void BM_release(benchmark::State& state) {
     static std::unique_ptr<TicketHolder> ticketHolder;
@@ -115,6 +119,8 @@ BENCHMARK_TEMPLATE(BM_release, SemaphoreTicketHolder)->ThreadRange(kThreadMin, k
 
 BENCHMARK_TEMPLATE(BM_release, FifoTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
 
+BENCHMARK_TEMPLATE(BM_release, LockFreeTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
+
 
 template <class H>
 void BM_acquireAndRelease(benchmark::State& state) {
@@ -141,5 +147,8 @@ BENCHMARK_TEMPLATE(BM_acquireAndRelease, SemaphoreTicketHolder)
 
 BENCHMARK_TEMPLATE(BM_acquireAndRelease, FifoTicketHolder)->ThreadRange(kThreadMin, kThreadMax);
 
+BENCHMARK_TEMPLATE(BM_acquireAndRelease, LockFreeTicketHolder)
+    ->ThreadRange(kThreadMin, kThreadMax);
+
 }  // namespace
 }  // namespace mongo
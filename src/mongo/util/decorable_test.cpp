@@ -114,6 +114,32 @@ TEST(DecorableTest, SimpleDecoration) {
     ASSERT_EQ(4, numDestructedAs);
 }
 
+TEST(DecorableTest, BufferReuseRunsConstructorsAndDestructors) {
+    struct MyDecorable : Decorable<MyDecorable> {};
+    numConstructedAs = 0;
+    numDestructedAs = 0;
+    static const auto dd1 = MyDecorable::template declareDecoration<A>();
+
+    const A* firstAddress;
+    {
+        MyDecorable decorable;
+        dd1(decorable).value = 42;
+        firstAddress = &dd1(decorable);
+    }
+    ASSERT_EQ(1, numConstructedAs);
+    ASSERT_EQ(1, numDestructedAs);
+
+    {
+        // The storage buffer comes back from this thread's cache, so the decoration lands at
+        // the same address, but it must be a freshly constructed instance.
+        MyDecorable decorable;
+        ASSERT_EQ(firstAddress, &dd1(decorable));
+        ASSERT_EQ(0, dd1(decorable).value);
+    }
+    ASSERT_EQ(2, numConstructedAs);
+    ASSERT_EQ(2, numDestructedAs);
+}
+
 TEST(DecorableTest, ThrowingConstructor) {
     struct MyDecorable : Decorable<MyDecorable> {};
     numConstructedAs = 0;
@@ -40,6 +40,70 @@ class DecorationRegistry;
 template <typename DecoratedType>
 class Decorable;
 
+/**
+ * A small thread-local cache of decoration storage buffers for one decorated type.
+ *
+ * Short-lived decorables like OperationContext are created at very high rates, and every
+ * subsystem that registers a decoration grows the single storage buffer each construction
+ * allocates. Recycling that buffer makes the heap traffic of constructing a decorable
+ * independent of how many decorations are registered; the decoration constructors and
+ * destructors still run on every use, so no state leaks from one instance to the next.
+ *
+ * The buffer size is fixed once the registry is finalized at startup. If the registry grows
+ * while cached buffers exist (only possible during single-threaded initialization), the stale
+ * buffers are discarded on the next allocation.
+ */
+template <typename DecoratedType>
+class DecorationBufferCache {
+public:
+    static unsigned char* allocate(size_t sizeBytes) {
+        auto& cache = _instance();
+        if (cache._bufferSizeBytes != sizeBytes) {
+            cache._clear();
+            cache._bufferSizeBytes = sizeBytes;
+        }
+        if (cache._numBuffers > 0) {
+            return cache._buffers[--cache._numBuffers];
+        }
+        return new unsigned char[sizeBytes];
+    }
+
+    static void deallocate(unsigned char* buffer, size_t sizeBytes) noexcept {
+        auto& cache = _instance();
+        if (sizeBytes == cache._bufferSizeBytes && cache._numBuffers < kCapacity) {
+            cache._buffers[cache._numBuffers++] = buffer;
+            return;
+        }
+        delete[] buffer;
+    }
+
+private:
+    // Covers the handful of instances a thread has alive at once (e.g. nested operation
+    // contexts) without holding meaningful memory per thread.
+    static constexpr size_t kCapacity = 4;
+
+    static DecorationBufferCache& _instance() {
+        thread_local DecorationBufferCache cache;
+        return cache;
+    }
+
+    DecorationBufferCache() = default;
+
+    ~DecorationBufferCache() {
+        _clear();
+    }
+
+    void _clear() noexcept {
+        while (_numBuffers > 0) {
+            delete[] _buffers[--_numBuffers];
+        }
+    }
+
+    unsigned char* _buffers[kCapacity];
+    size_t _numBuffers = 0;
+    size_t _bufferSizeBytes = 0;
+};
+
 /**
  * An container for decorations.
  */
@@ -96,8 +160,7 @@ public:
      */
     explicit DecorationContainer(Decorable<DecoratedType>* const decorated,
                                  const DecorationRegistry<DecoratedType>* const registry)
-        : _registry(registry),
-          _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+        : _registry(registry), _decorationData(_allocateDecorationBuffer(registry)) {
         // Because the decorations live in the externally allocated storage buffer at
         // `_decorationData`, there needs to be a way to get back from a known location within this
         // buffer to the type which owns those decorations.  We place a pointer to ourselves, a
@@ -116,8 +179,7 @@ public:
     explicit DecorationContainer(Decorable<DecoratedType>* const decorated,
                                  const DecorationRegistry<DecoratedType>* const registry,
                                  const DecorationContainer& other)
-        : _registry(registry),
-          _decorationData(new unsigned char[registry->getDecorationBufferSizeBytes()]) {
+        : _registry(registry), _decorationData(_allocateDecorationBuffer(registry)) {
         // Because the decorations live in the externally allocated storage buffer at
         // `_decorationData`, there needs to be a way to get back from a known location within this
         // buffer to the type which owns those decorations.  We place a pointer to ourselves, a
@@ -165,8 +227,29 @@ public:
     }
 
 private:
+    /**
+     * Returns the decoration storage buffer to the thread-local cache when the container goes
+     * away, after the registry has run the decoration destructors.
+     */
+    struct DecorationBufferDeleter {
+        void operator()(unsigned char* buffer) const noexcept {
+            DecorationBufferCache<DecoratedType>::deallocate(buffer, bufferSizeBytes);
+        }
+
+        size_t bufferSizeBytes;
+    };
+
+    using DecorationBuffer = std::unique_ptr<unsigned char[], DecorationBufferDeleter>;
+
+    static DecorationBuffer _allocateDecorationBuffer(
+        const DecorationRegistry<DecoratedType>* const registry) {
+        const auto sizeBytes = registry->getDecorationBufferSizeBytes();
+        return DecorationBuffer(DecorationBufferCache<DecoratedType>::allocate(sizeBytes),
+                                DecorationBufferDeleter{sizeBytes});
+    }
+
     const DecorationRegistry<DecoratedType>* const _registry;
-    const std::unique_ptr<unsigned char[]> _decorationData;
+    const DecorationBuffer _decorationData;
 };
 
 }  // namespace mongo
@@ -37,6 +37,10 @@
 #include <memory>
 #include <sstream>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #ifdef _WIN32
 #include <io.h>
 #endif
@@ -118,29 +122,39 @@ inline int leadingOnes(unsigned char c) {
 }
 
 bool isValidUTF8(StringData s) {
-    int left = 0;  // how many bytes are left in the current codepoint
-    for (unsigned char c : s) {
+    const char* p = s.rawData();
+    const char* const end = p + s.size();
+
+    while (p != end) {
+#if defined(__SSE2__)
+        // ASCII-only stretches, by far the common case, are validated 16 bytes at a time: a
+        // chunk without any high bit set needs no per-byte checks. This may only run on a
+        // codepoint boundary, which holds here because the loop below consumes whole codepoints.
+        while (p + 16 <= end &&
+               !_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))) {
+            p += 16;
+        }
+        if (p == end)
+            break;
+#endif
+        const unsigned char c = *p++;
         const int ones = leadingOnes(c);
-        if (left) {
-            if (ones != 1)
-                return false;  // should be a continuation byte
-            left--;
-        } else {
-            if (ones == 0)
-                continue;  // ASCII byte
-            if (ones == 1)
-                return false;  // unexpected continuation byte
-            if (c > 0xF4)
-                return false;  // codepoint too large (< 0x10FFFF)
-            if (c == 0xC0 || c == 0xC1)
-                return false;  // codepoints <= 0x7F shouldn't be 2 bytes
-
-            // still valid
-            left = ones - 1;
+        if (ones == 0)
+            continue;  // ASCII byte
+        if (ones == 1)
+            return false;  // unexpected continuation byte
+        if (c > 0xF4)
+            return false;  // codepoint too large (< 0x10FFFF)
+        if (c == 0xC0 || c == 0xC1)
+            return false;  // codepoints <= 0x7F shouldn't be 2 bytes
+
+        for (int left = ones - 1; left; --left) {
+            // Each remaining byte of the codepoint must exist and be a continuation byte.
+            if (p == end || leadingOnes(static_cast<unsigned char>(*p)) != 1)
+                return false;
+            ++p;
         }
     }
-    if (left != 0)
-        return false;  // string ended mid-codepoint
     return true;
 }
 